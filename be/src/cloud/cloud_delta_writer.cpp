@@ -20,6 +20,7 @@
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_rowset_builder.h"
 #include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "olap/delta_writer.h"
 #include "runtime/thread_context.h"
 
@@ -57,7 +58,7 @@ Status CloudDeltaWriter::batch_init(std::vector<CloudDeltaWriter*> writers) {
         });
     }
 
-    return cloud::bthread_fork_join(tasks, 10);
+    return cloud::bthread_fork_join(tasks, std::max(config::load_rowset_rpc_concurrency, 1));
 }
 
 Status CloudDeltaWriter::write(const vectorized::Block* block,
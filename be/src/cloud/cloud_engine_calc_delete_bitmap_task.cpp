@@ -76,40 +76,22 @@ Status CloudEngineCalcDeleteBitmapTask::execute() {
             if (tablet == nullptr) {
                 LOG(WARNING) << "can't get tablet when calculate delete bitmap. tablet_id="
                              << tablet_id;
-                _error_tablet_ids->push_back(tablet_id);
-                _res = Status::Error<ErrorCode::PUSH_TABLE_NOT_EXIST>(
-                        "can't get tablet when calculate delete bitmap. tablet_id={}", tablet_id);
-                break;
-            }
-
-            Status st = tablet->sync_rowsets();
-            if (!st.ok() && !st.is<ErrorCode::INVALID_TABLET_STATE>()) {
-                return st;
-            }
-            if (st.is<ErrorCode::INVALID_TABLET_STATE>()) [[unlikely]] {
-                add_succ_tablet_id(tablet->tablet_id());
-                LOG(INFO)
-                        << "tablet is under alter process, delete bitmap will be calculated later, "
-                           "tablet_id: "
-                        << tablet->tablet_id() << " txn_id: " << transaction_id
-                        << ", request_version=" << version;
-                continue;
-            }
-            int64_t max_version = tablet->max_version_unlocked();
-            if (version != max_version + 1) {
-                _error_tablet_ids->push_back(tablet_id);
-                _res = Status::Error<ErrorCode::DELETE_BITMAP_LOCK_ERROR, false>(
-                        "version not continuous");
-                LOG(WARNING) << "version not continuous, current max version=" << max_version
-                             << ", request_version=" << version
-                             << " tablet_id=" << tablet->tablet_id();
+                // the submitted tasks may be reporting their results concurrently
+                add_error_tablet_id(tablet_id,
+                                    Status::Error<ErrorCode::PUSH_TABLE_NOT_EXIST>(
+                                            "can't get tablet when calculate delete bitmap. "
+                                            "tablet_id={}",
+                                            tablet_id));
                 break;
             }
 
+            // the rowsets of the tablets are synced by the tasks, so that the RPCs to the
+            // meta-service of the tablets are issued in parallel
             auto tablet_calc_delete_bitmap_ptr = std::make_shared<CloudTabletCalcDeleteBitmapTask>(
                     _engine, this, tablet, transaction_id, version);
             auto submit_st = token->submit_func([=]() { tablet_calc_delete_bitmap_ptr->handle(); });
             if (!submit_st.ok()) {
+                std::lock_guard<std::mutex> lck(_mutex);
                 _res = submit_st;
                 break;
             }
@@ -140,6 +122,31 @@ CloudTabletCalcDeleteBitmapTask::CloudTabletCalcDeleteBitmapTask(
 
 void CloudTabletCalcDeleteBitmapTask::handle() const {
     SCOPED_ATTACH_TASK(_mem_tracker);
+    Status st = _tablet->sync_rowsets();
+    if (st.is<ErrorCode::INVALID_TABLET_STATE>()) [[unlikely]] {
+        _engine_calc_delete_bitmap_task->add_succ_tablet_id(_tablet->tablet_id());
+        LOG(INFO) << "tablet is under alter process, delete bitmap will be calculated later, "
+                     "tablet_id: "
+                  << _tablet->tablet_id() << " txn_id: " << _transaction_id
+                  << ", request_version=" << _version;
+        return;
+    }
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to sync rowsets. tablet_id=" << _tablet->tablet_id()
+                     << ", txn_id=" << _transaction_id << ", status=" << st;
+        _engine_calc_delete_bitmap_task->add_error_tablet_id(_tablet->tablet_id(), st);
+        return;
+    }
+    int64_t max_version = _tablet->max_version_unlocked();
+    if (_version != max_version + 1) {
+        LOG(WARNING) << "version not continuous, current max version=" << max_version
+                     << ", request_version=" << _version << " tablet_id=" << _tablet->tablet_id();
+        _engine_calc_delete_bitmap_task->add_error_tablet_id(
+                _tablet->tablet_id(), Status::Error<ErrorCode::DELETE_BITMAP_LOCK_ERROR, false>(
+                                              "version not continuous"));
+        return;
+    }
+
     RowsetSharedPtr rowset;
     DeleteBitmapPtr delete_bitmap;
     RowsetIdUnorderedSet rowset_ids;
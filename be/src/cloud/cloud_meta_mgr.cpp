@@ -33,6 +33,7 @@
 #include <shared_mutex>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "cloud/cloud_tablet.h"
@@ -53,6 +54,7 @@
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/stream_load/stream_load_context.h"
+#include "util/doris_metrics.h"
 #include "util/network_util.h"
 #include "util/s3_util.h"
 #include "util/thrift_rpc_helper.h"
@@ -128,6 +130,11 @@ constexpr int kBrpcRetryTimes = 3;
 bvar::LatencyRecorder _get_rowset_latency("doris_CloudMetaMgr", "get_rowset");
 bvar::LatencyRecorder g_cloud_commit_txn_resp_redirect_latency("cloud_table_stats_report_latency");
 
+void record_meta_service_rpc_latency(std::string_view op_name, int64_t latency_us) {
+    DorisMetrics::instance()->meta_service_rpc_latency_us->get(std::string(op_name))->add(
+            latency_us);
+}
+
 class MetaServiceProxy {
 public:
     static Status get_client(std::shared_ptr<MetaService_Stub>* stub) {
@@ -322,6 +329,7 @@ Status retry_rpc(std::string_view op_name, const Request& req, Response* res,
         cntl.set_max_retry(kBrpcRetryTimes);
         res->Clear();
         (stub.get()->*method)(&cntl, &req, res, nullptr);
+        record_meta_service_rpc_latency(op_name, cntl.latency_us());
         if (cntl.Failed()) [[unlikely]] {
             error_msg = cntl.ErrorText();
         } else if (res->status().code() == MetaServiceCode::OK) {
@@ -345,6 +353,26 @@ Status retry_rpc(std::string_view op_name, const Request& req, Response* res,
     return Status::RpcError("failed to {}: rpc timeout, last msg={}", op_name, error_msg);
 }
 
+// The rowset metas of the same key have the same schema, so it is decoded only once. Empty if
+// the schema of the rowset meta can not be shared, the columns of a variant schema vary with
+// its rowsets.
+std::string shared_schema_key(const RowsetMetaCloudPB& rs_meta) {
+    if (!rs_meta.has_tablet_schema()) {
+        return "";
+    }
+    const auto& schema = rs_meta.tablet_schema();
+    for (const auto& column : schema.column()) {
+        if (column.type() == "VARIANT") {
+            return "";
+        }
+    }
+    std::string key = fmt::format("{}-{}", rs_meta.index_id(), schema.schema_version());
+    if (rs_meta.has_schema_dict_key_list()) {
+        key.append(rs_meta.schema_dict_key_list().SerializeAsString());
+    }
+    return key;
+}
+
 } // namespace
 
 Status CloudMetaMgr::get_tablet_meta(int64_t tablet_id, TabletMetaSharedPtr* tablet_meta) {
@@ -407,6 +435,7 @@ Status CloudMetaMgr::sync_tablet_rowsets(CloudTablet* tablet, bool warmup_delta_
         stub->get_rowset(&cntl, &req, &resp, nullptr);
         int64_t latency = cntl.latency_us();
         _get_rowset_latency << latency;
+        record_meta_service_rpc_latency("get rowset", latency);
         int retry_times = config::meta_service_rpc_retry_times;
         if (cntl.Failed()) {
             if (tried++ < retry_times) {
@@ -503,7 +532,9 @@ Status CloudMetaMgr::sync_tablet_rowsets(CloudTablet* tablet, bool warmup_delta_
             }
             std::vector<RowsetSharedPtr> rowsets;
             rowsets.reserve(resp.rowset_meta().size());
-            for (const auto& cloud_rs_meta_pb : resp.rowset_meta()) {
+            // the first rowset meta of each schema, whose decoded schema the others share
+            std::unordered_map<std::string, RowsetMetaSharedPtr> schema_owners;
+            for (auto& cloud_rs_meta_pb : *resp.mutable_rowset_meta()) {
                 VLOG_DEBUG << "get rowset meta, tablet_id=" << cloud_rs_meta_pb.tablet_id()
                            << ", version=[" << cloud_rs_meta_pb.start_version() << '-'
                            << cloud_rs_meta_pb.end_version() << ']';
@@ -513,9 +544,21 @@ Status CloudMetaMgr::sync_tablet_rowsets(CloudTablet* tablet, bool warmup_delta_
                     existed_rowset->rowset_id().to_string() == cloud_rs_meta_pb.rowset_id_v2()) {
                     continue; // Same rowset, skip it
                 }
-                RowsetMetaPB meta_pb = cloud_rowset_meta_to_doris(cloud_rs_meta_pb);
+                std::string schema_key = shared_schema_key(cloud_rs_meta_pb);
+                RowsetMetaSharedPtr schema_owner;
+                if (auto it = schema_owners.find(schema_key);
+                    !schema_key.empty() && it != schema_owners.end()) {
+                    schema_owner = it->second;
+                    cloud_rs_meta_pb.clear_tablet_schema();
+                }
+                RowsetMetaPB meta_pb = cloud_rowset_meta_to_doris(std::move(cloud_rs_meta_pb));
                 auto rs_meta = std::make_shared<RowsetMeta>();
                 rs_meta->init_from_pb(meta_pb);
+                if (schema_owner != nullptr) {
+                    rs_meta->share_tablet_schema(*schema_owner);
+                } else if (!schema_key.empty()) {
+                    schema_owners.emplace(std::move(schema_key), rs_meta);
+                }
                 RowsetSharedPtr rowset;
                 // schema is nullptr implies using RowsetMeta.tablet_schema
                 Status s = RowsetFactory::create_rowset(nullptr, tablet->tablet_path(), rs_meta,
@@ -591,6 +634,7 @@ Status CloudMetaMgr::sync_tablet_delete_bitmap(CloudTablet* tablet, int64_t old_
 
     VLOG_DEBUG << "send GetDeleteBitmapRequest: " << req.ShortDebugString();
     stub->get_delete_bitmap(&cntl, &req, &res, nullptr);
+    record_meta_service_rpc_latency("get delete bitmap", cntl.latency_us());
     if (cntl.Failed()) {
         return Status::RpcError("failed to get delete bitmap: {}", cntl.ErrorText());
     }
@@ -896,6 +940,7 @@ Status CloudMetaMgr::update_tablet_schema(int64_t tablet_id, const TabletSchema&
     tablet_schema.to_schema_pb(&tablet_schema_pb);
     doris_tablet_schema_to_cloud(req.mutable_tablet_schema(), std::move(tablet_schema_pb));
     stub->update_tablet_schema(&cntl, &req, &resp, nullptr);
+    record_meta_service_rpc_latency("update tablet schema", cntl.latency_us());
     if (cntl.Failed()) {
         return Status::RpcError("failed to update tablet schema: {}", cntl.ErrorText());
     }
@@ -132,6 +132,14 @@ Status CloudTablet::sync_rowsets(int64_t query_version, bool warmup_delta_data)
     return st;
 }
 
+bool CloudTablet::rowsets_synced(int64_t query_version) {
+    if (query_version <= 0 || tablet_state() != TABLET_RUNNING) {
+        return false;
+    }
+    std::shared_lock rlock(_meta_lock);
+    return _max_version >= query_version;
+}
+
 // Sync tablet meta and all rowset meta if not running.
 // This could happen when BE didn't finish schema change job and another BE committed this schema change job.
 // It should be a quite rare situation.
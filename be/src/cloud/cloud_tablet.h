@@ -70,6 +70,10 @@ public:
     // rowsets datum async.
     Status sync_rowsets(int64_t query_version = -1, bool warmup_delta_data = false);
 
+    // Whether the tablet is running and has the rowsets of `query_version` locally, then
+    // `sync_rowsets(query_version)` does nothing.
+    bool rowsets_synced(int64_t query_version);
+
     // Synchronize the tablet meta from meta service.
     Status sync_meta();
 
@@ -17,7 +17,9 @@
 
 #include "cloud/cloud_tablet_hotspot.h"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <mutex>
 
 #include "cloud/config.h"
@@ -165,6 +167,75 @@ uint64_t HotspotCounter::qpw() {
     return week_history_counter + cur_counter.load();
 }
 
+uint64_t HotspotCounter::predict(int64_t lookahead_hours) {
+    // history_counters[i] counts the hour which ended i hours ago, so the coming hour of
+    // yesterday is at day_counters_size - lookahead_hours, and every day before is a day further
+    uint64_t counter = 0;
+    for (int64_t i = day_counters_size - lookahead_hours;
+         i >= 0 && i < static_cast<int64_t>(history_counters.size());
+         i += day_counters_size + 1) {
+        counter += history_counters[i];
+    }
+    return counter;
+}
+
+std::vector<int64_t> TabletHotspot::get_predicted_hot_tablets() {
+    std::lock_guard lock(_mtx);
+    return _predicted_hot_tablets;
+}
+
+void TabletHotspot::predict_hot_tablets() {
+    int64_t lookahead_hours = config::file_cache_predictive_warm_up_lookahead_hours;
+    auto min_queries = static_cast<uint64_t>(config::file_cache_predictive_warm_up_min_queries);
+    // pair<predicted queries, tablet id>
+    std::vector<std::pair<uint64_t, int64_t>> hot_tablets;
+    std::for_each(_tablets_hotspot.begin(), _tablets_hotspot.end(), [&](HotspotMap& map) {
+        std::lock_guard lock(map.mtx);
+        for (auto& [tablet_id, counter] : map.map) {
+            // the history is only changed by the counter thread, which is the current thread
+            if (uint64_t queries = counter->predict(lookahead_hours); queries >= min_queries) {
+                hot_tablets.emplace_back(queries, tablet_id);
+            }
+        }
+    });
+    std::sort(hot_tablets.begin(), hot_tablets.end(), std::greater<>());
+    std::vector<int64_t> tablet_ids;
+    tablet_ids.reserve(hot_tablets.size());
+    for (const auto& [_, tablet_id] : hot_tablets) {
+        tablet_ids.push_back(tablet_id);
+    }
+    std::lock_guard lock(_mtx);
+    _predicted_hot_tablets = std::move(tablet_ids);
+}
+
+int64_t TabletHotspot::file_cache_ttl_seconds(const BaseTablet& tablet) {
+    int64_t ttl_seconds = tablet.ttl_seconds();
+    if (ttl_seconds != 0 || config::file_cache_hot_tablet_ttl_seconds <= 0) {
+        return ttl_seconds;
+    }
+    std::shared_lock lock(_hot_tablets_lock);
+    return _hot_tablets.contains(tablet.tablet_id()) ? config::file_cache_hot_tablet_ttl_seconds
+                                                     : 0;
+}
+
+void TabletHotspot::update_hot_tablets() {
+    std::unordered_set<int64_t> hot_tablets;
+    if (config::file_cache_hot_tablet_ttl_seconds > 0) {
+        auto min_queries =
+                static_cast<uint64_t>(config::file_cache_hot_tablet_min_queries_per_day);
+        std::for_each(_tablets_hotspot.begin(), _tablets_hotspot.end(), [&](HotspotMap& map) {
+            std::lock_guard lock(map.mtx);
+            for (auto& [tablet_id, counter] : map.map) {
+                if (counter->qpd() >= min_queries) {
+                    hot_tablets.insert(tablet_id);
+                }
+            }
+        });
+    }
+    std::lock_guard lock(_hot_tablets_lock);
+    _hot_tablets = std::move(hot_tablets);
+}
+
 void TabletHotspot::make_dot_point() {
     while (true) {
         {
@@ -186,6 +257,10 @@ void TabletHotspot::make_dot_point() {
             std::for_each(counters.begin(), counters.end(),
                           [](HotspotCounterPtr& counter) { counter->make_dot_point(); });
         });
+        if (config::enable_file_cache_predictive_warm_up) {
+            predict_hot_tablets();
+        }
+        update_hot_tablets();
     }
 }
 
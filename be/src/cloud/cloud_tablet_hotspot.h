@@ -21,6 +21,8 @@
 #include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <shared_mutex>
+#include <unordered_set>
 
 #include "gen_cpp/BackendService.h"
 #include "olap/tablet.h"
@@ -35,6 +37,9 @@ struct HotspotCounter {
     void make_dot_point();
     uint64_t qpd();
     uint64_t qpw();
+    // The queries in the hour which starts `lookahead_hours` later, summed over the same hour
+    // of the previous days in the history.
+    uint64_t predict(int64_t lookahead_hours);
     int64_t table_id;
     int64_t index_id;
     int64_t partition_id;
@@ -57,9 +62,17 @@ public:
     // When query the tablet, count it
     void count(const BaseTablet& tablet);
     void get_top_n_hot_partition(std::vector<THotTableMessage>* hot_tables);
+    // The tablets predicted to be queried in the coming hour, the most queried first.
+    // It is updated every hour.
+    std::vector<int64_t> get_predicted_hot_tablets();
+    // The TTL of the file cache for reading the tablet, which is its own TTL, or
+    // `file_cache_hot_tablet_ttl_seconds` if it has none and it was hot in the last day.
+    int64_t file_cache_ttl_seconds(const BaseTablet& tablet);
 
 private:
     void make_dot_point();
+    void predict_hot_tablets();
+    void update_hot_tablets();
 
     struct HotspotMap {
         std::mutex mtx;
@@ -71,6 +84,11 @@ private:
     bool _closed {false};
     std::mutex _mtx;
     std::condition_variable _cond;
+    std::vector<int64_t> _predicted_hot_tablets;
+    // The tablets queried at least `file_cache_hot_tablet_min_queries_per_day` times in the
+    // last day, it is updated every hour.
+    std::shared_mutex _hot_tablets_lock;
+    std::unordered_set<int64_t> _hot_tablets;
 };
 
 } // namespace doris
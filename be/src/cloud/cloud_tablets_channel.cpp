@@ -20,6 +20,7 @@
 #include "cloud/cloud_delta_writer.h"
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "olap/delta_writer.h"
 #include "runtime/tablets_channel.h"
 
@@ -203,7 +204,8 @@ Status CloudTabletsChannel::close(LoadChannel* parent, const PTabletWriterAddBlo
     for (auto* writer : writers_to_commit) {
         tasks.emplace_back([writer] { return writer->commit_rowset(); });
     }
-    _close_status = cloud::bthread_fork_join(tasks, 10);
+    _close_status =
+            cloud::bthread_fork_join(tasks, std::max(config::load_rowset_rpc_concurrency, 1));
     if (!_close_status.ok()) {
         return _close_status;
     }
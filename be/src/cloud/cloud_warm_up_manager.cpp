@@ -23,7 +23,9 @@
 #include <cstddef>
 #include <tuple>
 
+#include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/cloud_tablet_mgr.h"
+#include "cloud/config.h"
 #include "common/logging.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "olap/rowset/beta_rowset.h"
@@ -36,6 +38,7 @@ namespace doris {
 
 CloudWarmUpManager::CloudWarmUpManager(CloudStorageEngine& engine) : _engine(engine) {
     _download_thread = std::thread(&CloudWarmUpManager::handle_jobs, this);
+    _predictive_warm_up_thread = std::thread(&CloudWarmUpManager::handle_predictive_warm_up, this);
 }
 
 CloudWarmUpManager::~CloudWarmUpManager() {
@@ -47,6 +50,56 @@ CloudWarmUpManager::~CloudWarmUpManager() {
     if (_download_thread.joinable()) {
         _download_thread.join();
     }
+    if (_predictive_warm_up_thread.joinable()) {
+        _predictive_warm_up_thread.join();
+    }
+}
+
+// Submit the downloads of all the segments of the rowset, returns the bytes of the segments.
+// `wait` is signaled when each download is done if it is not null.
+static int64_t download_rowset_segments(io::FileCacheBlockDownloader& downloader,
+                                        const TabletMeta& tablet_meta,
+                                        const RowsetMetaSharedPtr& rs,
+                                        const std::shared_ptr<bthread::CountdownEvent>& wait) {
+    auto fs = rs->fs();
+    if (!fs) {
+        LOG(WARNING) << "failed to get fs. tablet_id=" << tablet_meta.tablet_id()
+                     << " rowset_id=" << rs->rowset_id() << " resource_id=" << rs->resource_id();
+        return 0;
+    }
+    int64_t expiration_time = tablet_meta.ttl_seconds() == 0 || rs->newest_write_timestamp() <= 0
+                                      ? 0
+                                      : rs->newest_write_timestamp() + tablet_meta.ttl_seconds();
+    if (expiration_time <= UnixSeconds()) {
+        expiration_time = 0;
+    }
+    int64_t bytes = 0;
+    for (int64_t seg_id = 0; seg_id < rs->num_segments(); seg_id++) {
+        if (wait) {
+            wait->add_count();
+        }
+        bytes += rs->segment_file_size(seg_id);
+        downloader.submit_download_task(io::DownloadFileMeta {
+                .path = BetaRowset::remote_segment_path(rs->tablet_id(), rs->rowset_id(), seg_id),
+                .file_size = rs->segment_file_size(seg_id),
+                .file_system = fs,
+                .ctx =
+                        {
+                                .is_warmup = true,
+                                .expiration_time = expiration_time,
+                        },
+                .download_done =
+                        [wait](Status st) {
+                            if (!st) {
+                                LOG_WARNING("Warm up error ").error(st);
+                            }
+                            if (wait) {
+                                wait->signal();
+                            }
+                        },
+        });
+    }
+    return bytes;
 }
 
 void CloudWarmUpManager::handle_jobs() {
@@ -80,43 +133,8 @@ void CloudWarmUpManager::handle_jobs() {
             auto tablet_meta = tablet->tablet_meta();
             auto rs_metas = tablet_meta->snapshot_rs_metas();
             for (auto& [_, rs] : rs_metas) {
-                for (int64_t seg_id = 0; seg_id < rs->num_segments(); seg_id++) {
-                    auto fs = rs->fs();
-                    if (!fs) {
-                        LOG(WARNING) << "failed to get fs. tablet_id=" << tablet_id
-                                     << " rowset_id=" << rs->rowset_id()
-                                     << " resource_id=" << rs->resource_id();
-                        continue;
-                    }
-
-                    int64_t expiration_time =
-                            tablet_meta->ttl_seconds() == 0 || rs->newest_write_timestamp() <= 0
-                                    ? 0
-                                    : rs->newest_write_timestamp() + tablet_meta->ttl_seconds();
-                    if (expiration_time <= UnixSeconds()) {
-                        expiration_time = 0;
-                    }
-
-                    wait->add_count();
-                    _engine.file_cache_block_downloader().submit_download_task(
-                            io::DownloadFileMeta {
-                                    .path = BetaRowset::remote_segment_path(
-                                            rs->tablet_id(), rs->rowset_id(), seg_id),
-                                    .file_size = rs->segment_file_size(seg_id),
-                                    .file_system = std::move(fs),
-                                    .ctx =
-                                            {
-                                                    .expiration_time = expiration_time,
-                                            },
-                                    .download_done =
-                                            [wait](Status st) {
-                                                if (!st) {
-                                                    LOG_WARNING("Warm up error ").error(st);
-                                                }
-                                                wait->signal();
-                                            },
-                            });
-                }
+                download_rowset_segments(_engine.file_cache_block_downloader(), *tablet_meta, rs,
+                                         wait);
             }
             timespec time;
             time.tv_sec = UnixSeconds() + WAIT_TIME_SECONDS;
@@ -133,6 +151,64 @@ void CloudWarmUpManager::handle_jobs() {
 #endif
 }
 
+void CloudWarmUpManager::handle_predictive_warm_up() {
+#ifndef BE_TEST
+    while (true) {
+        {
+            std::unique_lock lock(_mtx);
+            _cond.wait_for(lock, std::chrono::seconds(HotspotCounter::time_interval),
+                           [this]() { return _closed; });
+            if (_closed) {
+                break;
+            }
+        }
+        if (!config::enable_file_cache_predictive_warm_up) {
+            continue;
+        }
+        int64_t max_bytes = config::file_cache_predictive_warm_up_max_bytes;
+        int64_t bytes = 0;
+        int64_t num_tablets = 0;
+        for (int64_t tablet_id : _engine.tablet_hotspot().get_predicted_hot_tablets()) {
+            if (bytes >= max_bytes) {
+                break;
+            }
+            auto res = _engine.tablet_mgr().get_tablet(tablet_id);
+            if (!res.has_value()) {
+                continue;
+            }
+            auto tablet = res.value();
+            // sync the rowsets, so the outputs of the recent compactions are warmed up rather
+            // than their inputs
+            if (auto st = tablet->sync_rowsets(); !st) {
+                LOG_WARNING("Predictive warm up error ").tag("tablet_id", tablet_id).error(st);
+                continue;
+            }
+            auto tablet_meta = tablet->tablet_meta();
+            std::vector<RowsetMetaSharedPtr> rs_metas;
+            for (auto& [_, rs] : tablet_meta->snapshot_rs_metas()) {
+                rs_metas.push_back(rs);
+            }
+            // the newest data is the most likely to be queried
+            std::sort(rs_metas.begin(), rs_metas.end(), [](const auto& a, const auto& b) {
+                return a->end_version() > b->end_version();
+            });
+            for (const auto& rs : rs_metas) {
+                if (bytes >= max_bytes) {
+                    break;
+                }
+                bytes += download_rowset_segments(_engine.file_cache_block_downloader(),
+                                                  *tablet_meta, rs, nullptr);
+            }
+            ++num_tablets;
+        }
+        if (num_tablets > 0) {
+            LOG(INFO) << "predictive warm up " << num_tablets << " tablets, " << bytes
+                      << " bytes";
+        }
+    }
+#endif
+}
+
 JobMeta::JobMeta(const TJobMeta& meta)
         : be_ip(meta.be_ip), brpc_port(meta.brpc_port), tablet_ids(meta.tablet_ids) {
     switch (meta.download_type) {
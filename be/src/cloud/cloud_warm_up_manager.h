@@ -69,6 +69,8 @@ public:
 
 private:
     void handle_jobs();
+    // Warm up the tablets predicted by the query history every hour
+    void handle_predictive_warm_up();
 
     std::mutex _mtx;
     std::condition_variable _cond;
@@ -77,6 +79,7 @@ private:
     std::deque<JobMeta> _pending_job_metas;
     std::vector<JobMeta> _finish_job;
     std::thread _download_thread;
+    std::thread _predictive_warm_up_thread;
     bool _closed {false};
     // the attribute for compile in ut
     [[maybe_unused]] CloudStorageEngine& _engine;
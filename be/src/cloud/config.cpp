@@ -48,6 +48,7 @@ DEFINE_mDouble(cumu_compaction_thread_num_factor, "0.5");
 DEFINE_mInt32(check_auto_compaction_interval_seconds, "5");
 DEFINE_mInt32(max_base_compaction_task_num_per_disk, "2");
 DEFINE_mBool(prioritize_query_perf_in_compaction, "false");
+DEFINE_mDouble(compaction_write_file_cache_min_hot_ratio, "0.1");
 
 DEFINE_mInt32(refresh_s3_info_interval_s, "60");
 DEFINE_mInt32(vacuum_stale_rowsets_interval_s, "300");
@@ -55,6 +56,17 @@ DEFINE_mInt32(schedule_sync_tablets_interval_s, "600");
 
 DEFINE_mInt32(mow_stream_load_commit_retry_times, "10");
 
+DEFINE_mInt32(load_rowset_rpc_concurrency, "10");
+
 DEFINE_mInt32(sync_load_for_tablets_thread, "32");
 
+DEFINE_mBool(enable_file_cache_predictive_warm_up, "false");
+DEFINE_mInt32(file_cache_predictive_warm_up_lookahead_hours, "1");
+DEFINE_Validator(file_cache_predictive_warm_up_lookahead_hours,
+                 [](const int config) -> bool { return config >= 0 && config <= 23; });
+DEFINE_mInt64(file_cache_predictive_warm_up_min_queries, "10");
+DEFINE_mInt64(file_cache_predictive_warm_up_max_bytes, "10737418240");
+DEFINE_mInt64(file_cache_hot_tablet_ttl_seconds, "0");
+DEFINE_mInt64(file_cache_hot_tablet_min_queries_per_day, "100");
+
 } // namespace doris::config
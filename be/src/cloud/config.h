@@ -79,6 +79,11 @@ DECLARE_mDouble(cumu_compaction_thread_num_factor);
 DECLARE_mInt32(check_auto_compaction_interval_seconds);
 DECLARE_mInt32(max_base_compaction_task_num_per_disk);
 DECLARE_mBool(prioritize_query_perf_in_compaction);
+// Write the output of a base or full compaction into the file cache if at least this ratio of
+// the data of its input rowsets is hot in the file cache, so that a hot tablet is still cached
+// after the compaction. The output of cumulative compaction is always written. Set a value
+// greater than 1 to disable it.
+DECLARE_mDouble(compaction_write_file_cache_min_hot_ratio);
 
 // CloudStorageEngine config
 DECLARE_mInt32(refresh_s3_info_interval_s);
@@ -88,7 +93,31 @@ DECLARE_mInt32(schedule_sync_tablets_interval_s);
 // Cloud mow
 DECLARE_mInt32(mow_stream_load_commit_retry_times);
 
+// The max number of the in-flight prepare/commit rowset RPCs of a load on a BE, a load into
+// many tablets issues one RPC per tablet.
+DECLARE_mInt32(load_rowset_rpc_concurrency);
+
 // the theads which sync the datas which loaded in other clusters
 DECLARE_mInt32(sync_load_for_tablets_thread);
 
+// Warm up the file cache by prediction: every hour, download the segments of the tablets which
+// were queried in the coming hour of the previous days, so that the first queries of a daily
+// peak do not read from the remote storage.
+DECLARE_mBool(enable_file_cache_predictive_warm_up);
+// Predict the hour which starts this many hours later, in [0, 23].
+DECLARE_mInt32(file_cache_predictive_warm_up_lookahead_hours);
+// A tablet is warmed up if it was queried at least this many times in that hour of the
+// previous days of the last week.
+DECLARE_mInt64(file_cache_predictive_warm_up_min_queries);
+// The max bytes of the segments to warm up in one round, the newest rowsets of the most
+// queried tablets first.
+DECLARE_mInt64(file_cache_predictive_warm_up_max_bytes);
+// The segments of a tablet which was queried at least
+// `file_cache_hot_tablet_min_queries_per_day` times in the last day are read into the TTL queue
+// of the file cache with this TTL, counted from the newest write of each rowset, so that the hot
+// tablets are not evicted by scans of cold ones. The tablets with their own TTL are not changed.
+// 0 to disable it.
+DECLARE_mInt64(file_cache_hot_tablet_ttl_seconds);
+DECLARE_mInt64(file_cache_hot_tablet_min_queries_per_day);
+
 } // namespace doris::config
@@ -105,6 +105,8 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // P.S. This is also required, because tcmalloc can not allocate a chunk of
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
+DEFINE_mInt64(mmap_chunk_cache_size, "0"); // bytes
+DEFINE_mBool(enable_mmap_transparent_huge_pages, "false");
 
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
@@ -137,6 +139,16 @@ DEFINE_mInt64(large_memory_check_bytes, "2147483648");
 
 DEFINE_mBool(enable_memory_orphan_check, "true");
 
+DEFINE_mBool(enable_mem_site_tracking, "false");
+
+DEFINE_mBool(enable_plan_regression_detector, "true");
+DEFINE_mDouble(plan_regression_ratio, "1.0");
+DEFINE_mInt64(plan_regression_min_time_ms, "1000");
+DEFINE_mInt32(plan_baseline_min_samples, "5");
+DEFINE_mInt32(plan_baseline_max_fingerprints, "10000");
+DEFINE_mString(fragment_capture_query_id, "");
+DEFINE_mDouble(fragment_capture_sample_ratio, "1.0");
+
 // The maximum time a thread waits for full GC. Currently only query will wait for full gc.
 DEFINE_mInt32(thread_wait_gc_max_milliseconds, "1000");
 
@@ -247,6 +259,7 @@ DEFINE_Validator(doris_scanner_thread_pool_thread_num, [](const int config) -> b
 DEFINE_Int32(doris_max_remote_scanner_thread_pool_thread_num, "-1");
 // number of olap scanner thread pool queue size
 DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
+DEFINE_mInt32(parallel_scan_granules_per_scanner, "4");
 // default thrift client connect timeout(in seconds)
 DEFINE_mInt32(thrift_connect_timeout_seconds, "3");
 DEFINE_mInt32(fetch_rpc_timeout_seconds, "30");
@@ -265,6 +278,7 @@ DEFINE_mInt32(doris_scanner_row_num, "16384");
 // single read execute fragment row bytes
 DEFINE_mInt32(doris_scanner_row_bytes, "10485760");
 DEFINE_mInt32(min_bytes_in_scanner_queue, "67108864");
+DEFINE_mInt64(block_target_bytes, "0");
 // number of max scan keys
 DEFINE_mInt32(doris_max_scan_key_num, "48");
 // the max number of push down values of a single column.
@@ -278,10 +292,14 @@ DEFINE_mInt64(column_dictionary_key_ratio_threshold, "0");
 DEFINE_mInt64(column_dictionary_key_size_threshold, "0");
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+// Whether to read the blocks of the old rowset on another thread during schema change.
+DEFINE_mBool(enable_schema_change_read_ahead, "true");
 DEFINE_mInt64(memory_limitation_per_thread_for_storage_migration_bytes, "100000000");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "300");
+DEFINE_String(clock_cache_types, "");
+DEFINE_mBool(enable_cache_prune_by_cost, "true");
 // the clean interval of tablet lookup cache
 DEFINE_mInt32(tablet_lookup_cache_stale_sweep_time_sec, "30");
 DEFINE_mInt32(point_query_row_cache_stale_sweep_time_sec, "300");
@@ -339,10 +357,18 @@ DEFINE_Bool(disable_pk_storage_page_cache, "false");
 DEFINE_String(pk_storage_page_cache_limit, "10%");
 // data page size for primary key index
 DEFINE_Int32(primary_key_data_page_size, "32768");
+DEFINE_mBool(enable_alp_float_encoding, "false");
+DEFINE_mBool(enable_fsst_string_page, "false");
+DEFINE_mBool(enable_delta_bitpacked_encoding, "false");
 
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
+// Cache for decoded data pages, 0 to disable
+DEFINE_String(decoded_page_cache_limit, "0");
+DEFINE_mInt32(decoded_page_cache_stale_sweep_time_sec, "300");
+DEFINE_mBool(enable_scan_io_stats, "true");
+DEFINE_mInt32(scan_io_stats_max_tablets, "10000");
 
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
@@ -362,6 +388,7 @@ DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "1024");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
+DEFINE_mInt64(vertical_compaction_read_ahead_min_input_bytes, "1073741824");
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
@@ -451,6 +478,8 @@ DEFINE_mInt64(pick_rowset_to_compact_interval_sec, "86400");
 DEFINE_mBool(enable_compaction_priority_scheduling, "true");
 DEFINE_mInt32(low_priority_compaction_task_num_per_disk, "1");
 DEFINE_mDouble(low_priority_tablet_version_num_ratio, "0.7");
+DEFINE_mDouble(compaction_query_heat_weight, "1.0");
+DEFINE_mDouble(compaction_merge_on_read_heat_factor, "2.0");
 
 // Thread count to do tablet meta checkpoint, -1 means use the data directories count.
 DEFINE_Int32(max_meta_checkpoint_threads, "-1");
@@ -552,6 +581,10 @@ DEFINE_Int32(min_buffer_size, "1024"); // 1024, The minimum read buffer size (in
 DEFINE_String(pprof_profile_dir, "${DORIS_HOME}/log");
 // for jeprofile in jemalloc
 DEFINE_mString(jeprofile_dir, "${DORIS_HOME}/log");
+DEFINE_Int32(continuous_cpu_profile_frequency, "0");
+DEFINE_Bool(continuous_cpu_profile_with_stacks, "false");
+DEFINE_mInt32(continuous_cpu_profile_window_seconds, "600");
+DEFINE_mInt64(continuous_cpu_profile_max_stacks, "100000");
 DEFINE_mBool(enable_je_purge_dirty_pages, "true");
 
 // to forward compatibility, will be removed later
@@ -587,14 +620,21 @@ DEFINE_mInt32(memtable_hard_limit_active_percent, "50");
 // percent of (active memtables size / all memtables size) when reach soft limit
 DEFINE_mInt32(memtable_soft_limit_active_percent, "50");
 
+DEFINE_mBool(enable_memtable_predictive_flush, "true");
+DEFINE_mInt64(memtable_predictive_flush_horizon_ms, "1000");
+DEFINE_mInt64(memtable_predictive_flush_interval_ms, "100");
+
 // memtable insert memory tracker will multiply input block size with this ratio
 DEFINE_mDouble(memtable_insert_memory_ratio, "1.4");
 // max write buffer size before flush, default 200MB
 DEFINE_mInt64(write_buffer_size, "209715200");
 // max buffer size used in memtable for the aggregated table, default 400MB
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
+DEFINE_mBool(enable_memtable_sort_on_insert, "true");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
+DEFINE_mInt32(memtable_flush_max_parallel_segments, "1");
+DEFINE_mInt64(memtable_flush_parallel_segment_min_bytes, "67108864");
 
 DEFINE_Int32(load_process_max_memory_limit_percent, "50"); // 50%
 
@@ -629,6 +669,7 @@ DEFINE_Bool(enable_metric_calculator, "true");
 
 // max consumer num in one data consumer group, for routine load
 DEFINE_mInt32(max_consumer_num_per_group, "3");
+DEFINE_mInt32(routine_load_consume_batch_size, "256");
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -713,6 +754,10 @@ DEFINE_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 DEFINE_Bool(ignore_load_tablet_failure, "false");
 
+// Thread count of each data dir to load the tablet headers and delete bitmaps at startup,
+// a value no larger than 1 loads them serially.
+DEFINE_Int32(load_tablet_meta_thread_num_per_data_dir, "8");
+
 // Whether to continue to start be when load tablet from header failed.
 DEFINE_mBool(ignore_rowset_stale_unconsistent_delete, "false");
 
@@ -810,6 +855,7 @@ DEFINE_mInt32(external_table_connect_timeout_sec, "30");
 
 // Time to clean up useless JDBC connection pool cache
 DEFINE_mInt32(jdbc_connection_pool_cache_clear_time_sec, "28800");
+DEFINE_mInt32(jdbc_scan_split_num, "1");
 
 // Global bitmap cache capacity for aggregation cache, size in bytes
 DEFINE_Int64(delete_bitmap_agg_cache_capacity, "104857600");
@@ -898,6 +944,11 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 // if it is lower than a specific threshold, the predicate will be disabled.
 DEFINE_mInt32(rf_predicate_check_row_num, "204800");
 
+DEFINE_mBool(enable_late_arrival_runtime_filter_page_pruning, "true");
+
+DEFINE_mInt32(segment_prefetch_pages_ahead, "0");
+DEFINE_mInt32(segment_prefetch_merge_gap_bytes, "65536");
+
 // cooldown task configs
 DEFINE_Int32(cooldown_thread_num, "5");
 DEFINE_mInt64(generate_cooldown_task_interval_sec, "20");
@@ -969,6 +1020,19 @@ DEFINE_Bool(enable_fuzzy_mode, "false");
 DEFINE_Bool(enable_debug_points, "false");
 
 DEFINE_Int32(pipeline_executor_size, "0");
+DEFINE_Bool(enable_pipeline_task_numa_aware_schedule, "false");
+DEFINE_mInt32(pipeline_task_cross_numa_steal_idle_ms, "10");
+DEFINE_String(pipeline_task_queue_type, "multi_core");
+DEFINE_Validator(pipeline_task_queue_type, [](const std::string& config) -> bool {
+    return config == "multi_core" || config == "work_stealing";
+});
+DEFINE_mInt32(pipeline_task_core_affinity_queue_threshold, "8");
+DEFINE_Bool(enable_workload_group_fair_task_queue, "false");
+DEFINE_mBool(enable_pipeline_task_adaptive_time_slice, "false");
+DEFINE_mInt32(pipeline_task_min_time_slice_ms, "10");
+DEFINE_mInt32(pipeline_task_max_time_slice_ms, "500");
+DEFINE_mBool(enable_pipeline_perf_events, "false");
+DEFINE_mInt32(pipeline_perf_events_profile_level, "2");
 DEFINE_Bool(enable_workload_group_for_scan, "false");
 DEFINE_mInt64(workload_group_scan_task_wait_timeout_ms, "10000");
 
@@ -979,6 +1043,7 @@ DEFINE_Bool(enable_index_apply_preds_except_leafnode_of_andnode, "true");
 DEFINE_mBool(variant_enable_flatten_nested, "false");
 DEFINE_mDouble(variant_ratio_of_defaults_as_sparse_column, "1");
 DEFINE_mInt64(variant_threshold_rows_to_estimate_sparse_column, "1000");
+DEFINE_mInt32(variant_max_subcolumns_count, "0");
 
 // block file cache
 DEFINE_Bool(enable_file_cache, "false");
@@ -994,6 +1059,18 @@ DEFINE_mInt32(file_cache_exit_disk_resource_limit_mode_percent, "80");
 DEFINE_mBool(enable_read_cache_file_directly, "false");
 DEFINE_mBool(file_cache_enable_evict_from_other_queue_by_size, "false");
 DEFINE_mInt64(file_cache_ttl_valid_check_interval_second, "0"); // zero for not checking
+DEFINE_Int32(file_cache_shard_num, "1");
+DEFINE_String(file_cache_admission_policy, "lru");
+DEFINE_Validator(file_cache_admission_policy, [](const std::string& config) -> bool {
+    return config == "lru" || config == "tinylfu";
+});
+DEFINE_mInt64(file_cache_shard_rebalance_interval_second, "60");
+DEFINE_Bool(enable_file_cache_persistent_index, "false");
+DEFINE_mInt64(file_cache_index_checkpoint_interval_second, "600");
+DEFINE_mBool(enable_file_cache_coalesce_remote_read, "true");
+DEFINE_mString(file_cache_peer_addresses, "");
+DEFINE_mInt32(file_cache_peer_fetch_max_peers, "2");
+DEFINE_mInt32(file_cache_peer_fetch_timeout_ms, "1000");
 
 DEFINE_mInt32(index_cache_entry_stay_time_after_lookup_s, "1800");
 DEFINE_mInt32(inverted_index_cache_stale_sweep_time_sec, "600");
@@ -1026,6 +1103,10 @@ DEFINE_mBool(debug_inverted_index_compaction, "false");
 DEFINE_mBool(inverted_index_ram_dir_enable, "false");
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DEFINE_Int32(num_broadcast_buffer, "32");
+DEFINE_mInt64(broadcast_join_parallel_build_min_rows, "8388608");
+DEFINE_mBool(enable_hash_join_build_dict_encoding, "false");
+DEFINE_mBool(enable_join_probe_bloom_filter, "true");
+DEFINE_mBool(enable_multi_cast_share_columns, "false");
 
 // max depth of expression tree allowed.
 DEFINE_Int32(max_depth_of_expr_tree, "600");
@@ -1039,10 +1120,18 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 
 // Page size of row column, default 4KB
 DEFINE_mInt64(row_column_page_size, "4096");
+DEFINE_mString(row_column_compression, "");
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+DEFINE_mInt32(s3_file_buffer_pool_max_num, "16");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
+DEFINE_mInt64(s3_parallel_read_min_part_bytes, "8388608");
+DEFINE_mInt32(s3_parallel_read_max_parts, "8");
+DEFINE_mBool(enable_s3_hedged_read, "false");
+DEFINE_mInt64(s3_hedged_read_max_bytes, "4194304");
+DEFINE_mDouble(s3_hedged_read_percentile, "0.99");
+DEFINE_mInt32(s3_hedged_read_min_threshold_ms, "100");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
 DEFINE_mInt64(hdfs_write_batch_buffer_size_mb, "1"); // 1MB
 
@@ -1057,6 +1146,9 @@ DEFINE_mInt32(estimated_num_columns_per_segment, "30");
 DEFINE_mInt32(estimated_mem_per_column_reader, "1024");
 // The value is calculate by storage_page_cache_limit * index_page_cache_percentage
 DEFINE_mInt32(segment_cache_memory_percentage, "2");
+// Percentage of the memory limit to cache the serialized footers of the segments, which are
+// kept after the opened segments are evicted from the segment cache. 0 disables the cache.
+DEFINE_Int32(segment_footer_cache_memory_percentage, "1");
 
 // enable feature binlog, default false
 DEFINE_Bool(enable_feature_binlog, "false");
@@ -1067,6 +1159,7 @@ DEFINE_Bool(enable_set_in_bitmap_value, "false");
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "1000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "3600");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+DEFINE_mInt32(external_file_meta_prefetch_num, "8");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
@@ -1077,6 +1170,7 @@ DEFINE_Int32(rocksdb_max_write_buffer_number, "5");
 DEFINE_Bool(allow_invalid_decimalv2_literal, "false");
 DEFINE_mString(kerberos_ccache_path, "");
 DEFINE_mString(kerberos_krb5_conf_path, "/etc/krb5.conf");
+DEFINE_mString(hdfs_short_circuit_read_domain_socket_path, "");
 
 DEFINE_mString(get_stack_trace_tool, "libunwind");
 DEFINE_mString(dwarf_location_info_mode, "FAST");
@@ -1102,6 +1196,8 @@ DEFINE_mBool(enable_rowid_conversion_correctness_check, "false");
 // When the number of missing versions is more than this value, do not directly
 // retry the publish and handle it through async publish.
 DEFINE_mInt32(mow_publish_max_discontinuous_version_num, "20");
+DEFINE_mBool(enable_mow_primary_key_filter, "true");
+DEFINE_mInt64(mow_primary_key_filter_max_keys, "16777216");
 
 // The secure path with user files, used in the `local` table function.
 DEFINE_mString(user_files_secure_path, "${DORIS_HOME}");
@@ -1130,6 +1226,8 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+DEFINE_mInt64(group_commit_target_latency_ms, "0");
+DEFINE_mBool(group_commit_wal_group_sync, "true");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1166,6 +1264,47 @@ DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 DEFINE_mBool(enable_column_type_check, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
+DEFINE_mBool(enable_local_exchange_skew_rebalance, "false");
+// 8MB
+DEFINE_mInt64(local_exchange_skew_rebalance_min_partition_data_processed_threshold, "8388608");
+// 32MB
+DEFINE_mInt64(local_exchange_skew_rebalance_min_data_processed_threshold, "33554432");
+DEFINE_mBool(enable_agg_local_merge, "false");
+DEFINE_mInt64(streaming_agg_reduction_window_rows, "65536");
+DEFINE_mBool(enable_sort_normalized_key, "true");
+DEFINE_mInt32(parallel_sort_max_tasks, "8");
+DEFINE_mInt64(parallel_sort_min_rows_per_task, "131072");
+DEFINE_mBool(enable_topn_runtime_predicate_page_pruning, "true");
+DEFINE_mInt64(spill_zstd_max_disk_bandwidth_mb, "256");
+DEFINE_mBool(enable_spill_async_io, "true");
+DEFINE_mInt64(spill_hash_join_partition_max_bytes, "1073741824");
+DEFINE_mInt32(spill_hash_join_repartition_fanout, "8");
+DEFINE_mInt32(spill_hash_join_max_repartition_depth, "3");
+DEFINE_mBool(enable_analytic_spill, "false");
+DEFINE_mBool(enable_set_operation_spill, "false");
+DEFINE_mInt32(set_operation_spill_partition_count, "16");
+DEFINE_mBool(enable_partition_topn_revoke_memory, "false");
+DEFINE_mBool(enable_query_memory_reservation, "false");
+DEFINE_mInt64(analytic_segment_tree_min_frame_rows, "64");
+DEFINE_mBool(exchange_sink_batch_rpc_by_host, "false");
+DEFINE_mInt64(exchange_sink_batch_rpc_max_bytes, "67108864");
+DEFINE_mBool(exchange_sink_send_block_by_attachment, "false");
+DEFINE_mBool(enable_exchange_adaptive_compression, "false");
+DEFINE_mInt64(exchange_adaptive_compression_probe_interval, "32");
+DEFINE_mBool(enable_exchange_sender_credits, "false");
+DEFINE_mInt64(exchange_sender_min_credit_bytes, "1048576");
+DEFINE_mInt32(runtime_filter_merge_lanes, "4");
+DEFINE_mDouble(runtime_filter_bloom_filter_fold_max_fill, "0.5");
+DEFINE_mBool(enable_runtime_filter_bloom_filter_ndv_sizing, "true");
+DEFINE_mBool(enable_parquet_bloom_filter_pruning, "true");
+DEFINE_mInt64(parquet_scan_range_split_min_bytes, "134217728");
+DEFINE_mBool(enable_orc_runtime_filter_search_argument, "true");
+DEFINE_String(iceberg_position_delete_cache_limit, "1%");
+DEFINE_mInt32(iceberg_position_delete_cache_stale_sweep_time_sec, "1800");
+DEFINE_mBool(enable_local_file_io_uring, "false");
+DEFINE_Int32(local_file_io_uring_entries, "64");
+DEFINE_Bool(local_file_io_uring_sqpoll, "false");
+DEFINE_mBool(enable_local_file_direct_io, "false");
 
 // Default 300s, if its value <= 0, then log is disabled
 DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
@@ -1204,6 +1343,9 @@ DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 DEFINE_mInt32(max_s3_client_retry, "10");
 
 DEFINE_mBool(enable_s3_rate_limiter, "false");
+DEFINE_mInt64(schema_change_read_io_limit_mb_per_sec, "0");
+DEFINE_mInt64(compaction_read_io_limit_mb_per_sec, "0");
+DEFINE_mInt64(warmup_read_io_limit_mb_per_sec, "0");
 
 DEFINE_String(trino_connector_plugin_dir, "${DORIS_HOME}/connectors");
 
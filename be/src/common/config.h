@@ -145,6 +145,12 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // P.S. This is also required, because tcmalloc can not allocate a chunk of
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
+// The max bytes of the chunks freed by the mmap branch of the allocator that are kept to be reused
+// by the next allocations of the same size, 0 means the chunks are always unmapped.
+DECLARE_mInt64(mmap_chunk_cache_size); // bytes
+// Whether to advise the kernel to back the chunks allocated by the mmap branch of the allocator
+// with transparent huge pages, it only takes effect if THP is enabled as `madvise` or `always`.
+DECLARE_mBool(enable_mmap_transparent_huge_pages);
 
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
@@ -184,6 +190,29 @@ DECLARE_mInt64(large_memory_check_bytes);
 // default is true. if any memory tracking in Orphan mem tracker will report error.
 DECLARE_mBool(enable_memory_orphan_check);
 
+// Whether to split the memory of each operator by the data structures holding it, e.g. the hash
+// table, the arena and the buffered blocks. The peak of each is added to the profile, and the
+// memory held by each is logged when a query is cancelled. Applies to the new queries.
+DECLARE_mBool(enable_mem_site_tracking);
+
+// Whether to keep rolling baselines of the fragments by the fingerprints of their plans, and to
+// log and count (bvar plan_regression_count) the executions deviating from their baselines.
+DECLARE_mBool(enable_plan_regression_detector);
+// An execution deviates if its time, rows, spilled bytes or skew is more than this ratio above
+// the baseline, or its rows or rows filtered by the runtime filters are that much below.
+DECLARE_mDouble(plan_regression_ratio);
+// The time deviations smaller than this are ignored.
+DECLARE_mInt64(plan_regression_min_time_ms);
+// The executions a baseline needs before the executions are compared with it.
+DECLARE_mInt32(plan_baseline_min_samples);
+// The max number of baselines, the least recently executed ones are evicted.
+DECLARE_mInt32(plan_baseline_max_fingerprints);
+// The id of the query whose fragments are captured for an offline replay, see
+// pipeline::FragmentCapture, empty to capture none.
+DECLARE_mString(fragment_capture_query_id);
+// The ratio of the blocks of each exchange and scan captured, 1 to capture all of them.
+DECLARE_mDouble(fragment_capture_sample_ratio);
+
 // The maximum time a thread waits for a full GC. Currently only query will wait for full gc.
 DECLARE_mInt32(thread_wait_gc_max_milliseconds);
 
@@ -291,6 +320,10 @@ DECLARE_mInt32(doris_scanner_thread_pool_thread_num);
 DECLARE_Int32(doris_max_remote_scanner_thread_pool_thread_num);
 // number of olap scanner thread pool queue size
 DECLARE_Int32(doris_scanner_thread_pool_queue_size);
+// the parallel scan of a dup or mow table builds this many scanners per scanner thread, the
+// threads which finish their scanners early take the remaining ones, so a scanner of dense
+// ranges does not leave a long single-threaded tail
+DECLARE_mInt32(parallel_scan_granules_per_scanner);
 // default thrift client connect timeout(in seconds)
 DECLARE_mInt32(thrift_connect_timeout_seconds);
 DECLARE_mInt32(fetch_rpc_timeout_seconds);
@@ -309,6 +342,10 @@ DECLARE_mInt32(doris_scanner_row_num);
 // single read execute fragment row bytes
 DECLARE_mInt32(doris_scanner_row_bytes);
 DECLARE_mInt32(min_bytes_in_scanner_queue);
+// The bytes budget of a block built by the scanners and the exchange senders, blocks of wide rows
+// stop growing at this size before reaching the batch size, so that they stay cache friendly.
+// 0 means only the batch size limits the blocks.
+DECLARE_mInt64(block_target_bytes);
 // number of max scan keys
 DECLARE_mInt32(doris_max_scan_key_num);
 // the max number of push down values of a single column.
@@ -322,11 +359,20 @@ DECLARE_mInt64(column_dictionary_key_ratio_threshold);
 DECLARE_mInt64(column_dictionary_key_size_threshold);
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// Whether to read the blocks of the old rowset on another thread during schema change.
+DECLARE_mBool(enable_schema_change_read_ahead);
 DECLARE_mInt64(memory_limitation_per_thread_for_storage_migration_bytes);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
 DECLARE_mInt32(cache_periodic_prune_stale_sweep_sec);
+// Caches that evict with CLOCK instead of LRU, comma separated names of the cache types,
+// e.g. "DataPageCache,SegmentCache". Lookups of a CLOCK cache do not take the shard lock,
+// which helps the caches with a lot of concurrent hits, such as point queries.
+DECLARE_String(clock_cache_types);
+// Full GC prunes the caches weighted by the refill cost and the recent hit ratio first,
+// and only prunes all the caches if it does not free enough memory.
+DECLARE_mBool(enable_cache_prune_by_cost);
 // the clean interval of tablet lookup cache
 DECLARE_mInt32(tablet_lookup_cache_stale_sweep_time_sec);
 DECLARE_mInt32(point_query_row_cache_stale_sweep_time_sec);
@@ -387,12 +433,32 @@ DECLARE_Bool(disable_pk_storage_page_cache);
 DECLARE_String(pk_storage_page_cache_limit);
 // data page size for primary key index
 DECLARE_Int32(primary_key_data_page_size);
+// Encode the FLOAT and DOUBLE columns of the new segments with ALP, see alp_page.h. The
+// segments can't be read by the versions without it.
+DECLARE_mBool(enable_alp_float_encoding);
+// Compress the data pages of the dictionary encoded string columns by FSST after the dictionary
+// is full, instead of storing them plain, see fsst_page.h. The segments can't be read by the
+// versions without it.
+DECLARE_mBool(enable_fsst_string_page);
+// Encode the integer sort key columns and the time columns of the new segments by FOR_ENCODING,
+// whose frames of ascending values store the deltas from the smallest delta, see
+// frame_of_reference_coding.h. The segments can't be read by the versions without it.
+DECLARE_mBool(enable_delta_bitpacked_encoding);
 
 // inc_rowset snapshot rs sweep time interval
 DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
 DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
+// Cache for the decoded values of data pages, it is separated from storage_page_cache_limit.
+// A hit skips the decoding of the page. 0 to disable it.
+DECLARE_String(decoded_page_cache_limit);
+DECLARE_mInt32(decoded_page_cache_stale_sweep_time_sec);
+// Whether to aggregate the pages and bytes read by the scans per tablet and column,
+// see `/api/scan_io_stats`.
+DECLARE_mBool(enable_scan_io_stats);
+// The max number of tablets in the scan io stats, the least recently scanned ones are evicted.
+DECLARE_mInt32(scan_io_stats_max_tablets);
 
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
@@ -412,6 +478,9 @@ DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
+// In vertical compaction, if the input rowsets are larger than this, the blocks are read on
+// another thread while the output segments are written, <= 0 to disable
+DECLARE_mInt64(vertical_compaction_read_ahead_min_input_bytes);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
@@ -496,6 +565,14 @@ DECLARE_mInt64(pick_rowset_to_compact_interval_sec);
 DECLARE_mBool(enable_compaction_priority_scheduling);
 DECLARE_mInt32(low_priority_compaction_task_num_per_disk);
 DECLARE_mDouble(low_priority_tablet_version_num_ratio);
+// When picking the tablet to compact, the compaction score is multiplied by
+// (1 + weight * log2(1 + scans per second of the tablet)), so that the tablets read most by
+// queries are compacted first. 0 to pick by the compaction score only.
+DECLARE_mDouble(compaction_query_heat_weight);
+// The query heat of a tablet whose reads merge the rows of its rowsets, i.e. AGG_KEYS or
+// merge-on-read UNIQUE_KEYS, is multiplied by this factor, because every query of it pays for
+// merging all the rowsets that a compaction would merge once.
+DECLARE_mDouble(compaction_merge_on_read_heat_factor);
 
 // Thread count to do tablet meta checkpoint, -1 means use the data directories count.
 DECLARE_Int32(max_meta_checkpoint_threads);
@@ -602,6 +679,18 @@ DECLARE_Int32(min_buffer_size); // 1024, The minimum read buffer size (in bytes)
 DECLARE_String(pprof_profile_dir);
 // for jeprofile in jemalloc
 DECLARE_mString(jeprofile_dir);
+// The samples per second of the process cpu time of the continuous cpu profiler, which tags each
+// sample with the query and the workload group of the thread, see `/pprof/continuous`.
+// 0 disables it.
+DECLARE_Int32(continuous_cpu_profile_frequency);
+// Unwind the whole call stack of each sample, which needs the phdr cache to be async signal
+// safe and conflicts with the heap profiling of jemalloc. Otherwise a sample only keeps the
+// function it interrupted.
+DECLARE_Bool(continuous_cpu_profile_with_stacks);
+// The profiler keeps the samples of the last two windows of so long.
+DECLARE_mInt32(continuous_cpu_profile_window_seconds);
+// The distinct call stacks kept in a window, the samples of the others are dropped.
+DECLARE_mInt64(continuous_cpu_profile_max_stacks);
 // Purge all unused dirty pages for all arenas.
 DECLARE_mBool(enable_je_purge_dirty_pages);
 
@@ -638,14 +727,31 @@ DECLARE_mInt32(memtable_hard_limit_active_percent);
 // percent of (active memtables size / all memtables size) when reach soft limit
 DECLARE_mInt32(memtable_soft_limit_active_percent);
 
+// Flush the memtables growing fastest ahead of time when the load memory predicted by the growth
+// rate of the active memtables will reach the soft limit, instead of blocking the writers after.
+DECLARE_mBool(enable_memtable_predictive_flush);
+// how far ahead in milliseconds the load memory is predicted
+DECLARE_mInt64(memtable_predictive_flush_horizon_ms);
+// min interval in milliseconds between two rounds of predictive flush, to stagger the flushes
+DECLARE_mInt64(memtable_predictive_flush_interval_ms);
+
 // memtable insert memory tracker will multiply input block size with this ratio
 DECLARE_mDouble(memtable_insert_memory_ratio);
 // max write buffer size before flush, default 200MB
 DECLARE_mInt64(write_buffer_size);
 // max buffer size used in memtable for the aggregated table, default 400MB
 DECLARE_mInt64(write_buffer_size_for_agg);
+// Sort the rows of each insert into a memtable as a sorted run when they arrive, and merge the
+// runs when the memtable is flushed or shrunk, instead of sorting all the rows at that time.
+DECLARE_mBool(enable_memtable_sort_on_insert);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
+// Split a large memtable of a duplicate keys table by rows into at most this many segments,
+// which are encoded concurrently on the flush threads. 1 means a memtable is always flushed
+// into one segment.
+DECLARE_mInt32(memtable_flush_max_parallel_segments);
+// Each of the segments split from a memtable holds at least this much memtable memory.
+DECLARE_mInt64(memtable_flush_parallel_segment_min_bytes);
 
 DECLARE_Int32(load_process_max_memory_limit_percent); // 50%
 
@@ -680,6 +786,9 @@ DECLARE_Bool(enable_metric_calculator);
 
 // max consumer num in one data consumer group, for routine load
 DECLARE_mInt32(max_consumer_num_per_group);
+// max kafka msgs a routine load consumer hands to its group at once. The msgs already fetched
+// by librdkafka are taken without waiting, and appended to the pipe in one buffer.
+DECLARE_mInt32(routine_load_consume_batch_size);
 
 // the max size of thread pool for routine load task.
 // this should be larger than FE config 'max_routine_load_task_num_per_be' (default 5)
@@ -767,6 +876,10 @@ DECLARE_Int32(txn_shard_size);
 // Whether to continue to start be when load tablet from header failed.
 DECLARE_Bool(ignore_load_tablet_failure);
 
+// Thread count of each data dir to load the tablet headers and delete bitmaps at startup,
+// a value no larger than 1 loads them serially.
+DECLARE_Int32(load_tablet_meta_thread_num_per_data_dir);
+
 // Whether to continue to start be when load tablet from header failed.
 DECLARE_mBool(ignore_rowset_stale_unconsistent_delete);
 
@@ -865,6 +978,10 @@ DECLARE_mInt32(external_table_connect_timeout_sec);
 // Time to clean up useless JDBC connection pool cache
 DECLARE_mInt32(jdbc_connection_pool_cache_clear_time_sec);
 
+// Split a jdbc scan of a mysql or postgresql table into this many scanners. Each of them reads
+// the rows of an integer column with a different remainder, on its own connection. 1 to disable.
+DECLARE_mInt32(jdbc_scan_split_num);
+
 // Global bitmap cache capacity for aggregation cache, size in bytes
 DECLARE_Int64(delete_bitmap_agg_cache_capacity);
 DECLARE_String(delete_bitmap_dynamic_agg_cache_limit);
@@ -948,6 +1065,17 @@ DECLARE_mInt64(small_column_size_buffer);
 // if it is lower than a specific threshold, the predicate will be disabled.
 DECLARE_mInt32(rf_predicate_check_row_num);
 
+// Whether the min/max and in runtime filters which arrive after the scan has started are used
+// to prune the unread pages of the segments by zone map and bloom filter index.
+DECLARE_mBool(enable_late_arrival_runtime_filter_page_pruning);
+
+// The max number of data pages of every column read ahead asynchronously by the segment iterator
+// on remote storage, the adjacent pages are coalesced into one read. 0 means disabled.
+DECLARE_mInt32(segment_prefetch_pages_ahead);
+// The page reads of different columns of a segment are merged into one prefetch read if the gap
+// between them is not larger than it.
+DECLARE_mInt32(segment_prefetch_merge_gap_bytes);
+
 // cooldown task configs
 DECLARE_Int32(cooldown_thread_num);
 DECLARE_mInt64(generate_cooldown_task_interval_sec);
@@ -1017,6 +1145,31 @@ DECLARE_Bool(enable_fuzzy_mode);
 DECLARE_Bool(enable_debug_points);
 
 DECLARE_Int32(pipeline_executor_size);
+// Bind pipeline executors to numa nodes and prefer stealing tasks inside the local numa node.
+DECLARE_Bool(enable_pipeline_task_numa_aware_schedule);
+// A pipeline executor only steals tasks from other numa nodes after it has been idle for so long.
+DECLARE_mInt32(pipeline_task_cross_numa_steal_idle_ms);
+// The task queue of pipeline task schedulers, "multi_core" or "work_stealing".
+// "work_stealing" uses lock-free per core deques instead of mutex guarded priority queues.
+DECLARE_String(pipeline_task_queue_type);
+// A woken pipeline task goes back to the core that last ran it, unless that core already has
+// more runnable tasks queued than this threshold. Then a less loaded core of the same numa node
+// is chosen. -1 means always keep the affinity.
+DECLARE_mInt32(pipeline_task_core_affinity_queue_threshold);
+// All workload groups share one pipeline executor pool, and the executors pick tasks across
+// the queues of the workload groups by their cpu share, instead of one pool per workload group.
+DECLARE_Bool(enable_workload_group_fair_task_queue);
+// Adapt the time slice of each pipeline task to its block latency and the queue depth of its
+// core, within [pipeline_task_min_time_slice_ms, pipeline_task_max_time_slice_ms].
+// Otherwise a task always yields after 100ms.
+DECLARE_mBool(enable_pipeline_task_adaptive_time_slice);
+DECLARE_mInt32(pipeline_task_min_time_slice_ms);
+DECLARE_mInt32(pipeline_task_max_time_slice_ms);
+// Count the cpu cycles, instructions, last level cache misses and branch misses of each pipeline
+// operator by the perf events of the executor threads, and report them in the query profile at
+// the counter level `pipeline_perf_events_profile_level`. Takes effect for the new queries.
+DECLARE_mBool(enable_pipeline_perf_events);
+DECLARE_mInt32(pipeline_perf_events_profile_level);
 
 // Temp config. True to use optimization for bitmap_index apply predicate except leaf node of the and node.
 // Will remove after fully test.
@@ -1036,6 +1189,30 @@ DECLARE_Int32(file_cache_exit_disk_resource_limit_mode_percent);
 DECLARE_mBool(enable_read_cache_file_directly);
 DECLARE_Bool(file_cache_enable_evict_from_other_queue_by_size);
 DECLARE_mInt64(file_cache_ttl_valid_check_interval_second);
+// Split the metadata of every file cache path into this many shards by key hash, each shard
+// has its own lock and queues. The data of a shard is stored in `shard_<i>` under the path,
+// so changing it drops the cached data.
+DECLARE_Int32(file_cache_shard_num);
+// The admission policy of the file cache queues. "lru" admits every block, "tinylfu" only
+// admits a new block if it has been accessed more often recently than the block it evicts.
+DECLARE_String(file_cache_admission_policy);
+// The interval to rebalance the capacity between the shards of a file cache path.
+DECLARE_mInt64(file_cache_shard_rebalance_interval_second);
+// Keep an index of the cached blocks in `index_snapshot` and `index_log` under every cache
+// path, so a restart loads the index instead of walking all the cache directories.
+DECLARE_Bool(enable_file_cache_persistent_index);
+// The interval to write a new snapshot of the file cache index and truncate its log.
+DECLARE_mInt64(file_cache_index_checkpoint_interval_second);
+// Let the concurrent remote reads of the file cache share one read of the same file range,
+// instead of sending a request each, e.g. when many scanners miss the same evicted blocks.
+DECLARE_mBool(enable_file_cache_coalesce_remote_read);
+// The http addresses, "host:webserver_port" separated by ",", of the other BEs in the same
+// compute group. A block missed in the file cache is fetched from the file cache of these
+// peers before the remote storage, e.g. after a scale out. Empty to disable it.
+DECLARE_mString(file_cache_peer_addresses);
+// A block is looked up in at most this many peers, chosen by rendezvous hashing of its file.
+DECLARE_mInt32(file_cache_peer_fetch_max_peers);
+DECLARE_mInt32(file_cache_peer_fetch_timeout_ms);
 
 // inverted index searcher cache
 // cache entry stay time after lookup
@@ -1069,6 +1246,17 @@ DECLARE_mBool(debug_inverted_index_compaction);
 DECLARE_mBool(inverted_index_ram_dir_enable);
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DECLARE_Int32(num_broadcast_buffer);
+// The shared hash table of a broadcast join is built by multiple threads if the build side has
+// at least so many rows. 0 means disabled.
+DECLARE_mInt64(broadcast_join_parallel_build_min_rows);
+// Whether to encode the low cardinality string columns of the hash join build side that are not
+// join keys by a dictionary, they are decoded only when the matched rows are output.
+DECLARE_mBool(enable_hash_join_build_dict_encoding);
+// Whether a large join hash table has a bloom filter for the probe rows to skip the table.
+DECLARE_mBool(enable_join_probe_bloom_filter);
+// Whether the consumers of a multi cast (e.g. a reused CTE) share the columns of each block
+// instead of deep copying them, a consumer copies a column only when it mutates it.
+DECLARE_mBool(enable_multi_cast_share_columns);
 
 // max depth of expression tree allowed.
 DECLARE_Int32(max_depth_of_expr_tree);
@@ -1082,10 +1270,28 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 
 // Page size of row column, default 4KB
 DECLARE_mInt64(row_column_page_size);
+// Compression of row column, e.g. LZ4 or ZSTD, empty means the compression of the table.
+// A point query decompresses the whole page of its row, so a fast codec lowers its latency.
+DECLARE_mString(row_column_compression);
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// The max number of the released s3 file buffers kept for reuse.
+DECLARE_mInt32(s3_file_buffer_pool_max_num);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
+// A s3 read of at least twice this many bytes is split into the ranged GETs of at least this
+// many bytes, which are issued in parallel.
+DECLARE_mInt64(s3_parallel_read_min_part_bytes);
+// The max number of the parallel ranged GETs of a s3 read, 1 to disable the parallel read.
+DECLARE_mInt32(s3_parallel_read_max_parts);
+// Whether a s3 read of at most s3_hedged_read_max_bytes fires a backup GET when it does not
+// finish within the s3_hedged_read_percentile latency of the recent GETs, and takes the first
+// response of them.
+DECLARE_mBool(enable_s3_hedged_read);
+DECLARE_mInt64(s3_hedged_read_max_bytes);
+DECLARE_mDouble(s3_hedged_read_percentile);
+// The min latency a s3 read waits before its backup GET.
+DECLARE_mInt32(s3_hedged_read_min_threshold_ms);
 // the max number of cached file handle for block segemnt
 DECLARE_mInt64(file_cache_max_file_reader_cache_size);
 DECLARE_mInt64(hdfs_write_batch_buffer_size_mb);
@@ -1100,6 +1306,9 @@ DECLARE_mInt32(segment_cache_capacity);
 DECLARE_mInt32(estimated_num_columns_per_segment);
 DECLARE_mInt32(estimated_mem_per_column_reader);
 DECLARE_Int32(segment_cache_memory_percentage);
+// Percentage of the memory limit to cache the serialized footers of the segments, which are
+// kept after the opened segments are evicted from the segment cache. 0 disables the cache.
+DECLARE_Int32(segment_footer_cache_memory_percentage);
 
 // enable binlog
 DECLARE_Bool(enable_feature_binlog);
@@ -1113,6 +1322,9 @@ DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// number of upcoming parquet ranges of a file scanner whose footers are read into
+// the file meta cache in background. 0 means disable the prefetch.
+DECLARE_mInt32(external_file_meta_prefetch_num);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1125,6 +1337,9 @@ DECLARE_mBool(allow_invalid_decimalv2_literal);
 DECLARE_mString(kerberos_ccache_path);
 // set krb5.conf path, use "/etc/krb5.conf" by default
 DECLARE_mString(kerberos_krb5_conf_path);
+// The domain socket path of the co-located DataNode. If it is set, the hdfs clients read the
+// local blocks by short-circuit, unless the catalog sets dfs.client.read.shortcircuit itself.
+DECLARE_mString(hdfs_short_circuit_read_domain_socket_path);
 
 // Values include `none`, `glog`, `boost`, `glibc`, `libunwind`
 DECLARE_mString(get_stack_trace_tool);
@@ -1158,6 +1373,9 @@ DECLARE_mDouble(variant_ratio_of_defaults_as_sparse_column);
 // Threshold to estimate a column is sparsed
 // Notice: TEST ONLY
 DECLARE_mInt64(variant_threshold_rows_to_estimate_sparse_column);
+// The max number of subcolumns a variant column materializes when it is loaded, the sparsest
+// subcolumns beyond it are merged into the root column. 0 means no limit.
+DECLARE_mInt32(variant_max_subcolumns_count);
 
 DECLARE_mBool(enable_merge_on_write_correctness_check);
 // rowid conversion correctness check when compaction for mow table
@@ -1165,6 +1383,12 @@ DECLARE_mBool(enable_rowid_conversion_correctness_check);
 // When the number of missing versions is more than this value, do not directly
 // retry the publish and handle it through async publish.
 DECLARE_mInt32(mow_publish_max_discontinuous_version_num);
+// Whether the keys of the rowsets of a merge-on-write tablet are summarized by a bloom filter,
+// the rowsets which do not contain a key are skipped when looking up the key.
+DECLARE_mBool(enable_mow_primary_key_filter);
+// The max number of keys in the primary key filter of a tablet, the filter is reset when the
+// keys exceed it.
+DECLARE_mInt64(mow_primary_key_filter_max_keys);
 
 // The secure path with user files, used in the `local` table function.
 DECLARE_mString(user_files_secure_path);
@@ -1201,6 +1425,13 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Target latency(ms) from a row arriving to its group commit finishing. If greater than 0, the
+// commit interval and data size of each table are adapted from its measured commit cost and
+// incoming data rate instead of the table properties.
+DECLARE_mInt64(group_commit_target_latency_ms);
+// Sync the wal files finalized by concurrent loads in groups, which syncs their directories once
+// per group instead of once per file.
+DECLARE_mBool(group_commit_wal_group_sync);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1246,6 +1477,131 @@ DECLARE_Bool(enable_snapshot_action);
 DECLARE_mInt32(variant_max_merged_tablet_schema_size);
 
 DECLARE_mInt64(local_exchange_buffer_mem_limit);
+// Split the hot partitions of a local hash shuffle across several tasks when the downstream
+// operator allows it, e.g. the first phase aggregation.
+DECLARE_mBool(enable_local_exchange_skew_rebalance);
+// The bytes a partition must have processed before it is split to one more task.
+DECLARE_mInt64(local_exchange_skew_rebalance_min_partition_data_processed_threshold);
+// The bytes processed by a local shuffle between two rebalances.
+DECLARE_mInt64(local_exchange_skew_rebalance_min_data_processed_threshold);
+// Merge the first phase aggregation of the instances on the same BE by key before sending it.
+DECLARE_mBool(enable_agg_local_merge);
+// The streaming pre-aggregation measures the reduction of its hash table every so many rows,
+// and passes the rows through while it does not reduce. 0 means only the hash table size
+// decides.
+DECLARE_mInt64(streaming_agg_reduction_window_rows);
+// Sort and merge by one memcmp-comparable key per row when all the sort columns of a
+// multi-column ORDER BY are of fixed width types.
+DECLARE_mBool(enable_sort_normalized_key);
+// A full sort which is the only task of its pipeline on the BE splits a large buffered block
+// into at most this many sub-runs and sorts them in parallel. 1 disables it.
+DECLARE_mInt32(parallel_sort_max_tasks);
+// The min rows of a sub-run of the parallel sort.
+DECLARE_mInt64(parallel_sort_min_rows_per_task);
+
+// Whether the segment iterators prune their unread pages by zone map every time the topn
+// runtime predicate is tightened, instead of only when the segment is opened.
+DECLARE_mBool(enable_topn_runtime_predicate_page_pruning);
+
+// The spilled blocks are compressed by ZSTD while the measured write bandwidth of the spill disk
+// is below it in MB/s, the disk is the bottleneck then, and by LZ4 otherwise.
+DECLARE_mInt64(spill_zstd_max_disk_bandwidth_mb);
+// Whether the spill writer writes a block while serializing the next one, and the spill reader
+// reads the next block while deserializing the current one.
+DECLARE_mBool(enable_spill_async_io);
+
+// A spilled hash join partition whose build side is larger than it is split into
+// spill_hash_join_repartition_fanout partitions by other bits of the hash when it is reloaded,
+// at most spill_hash_join_max_repartition_depth times, 0 disables it. An inner join partition
+// still larger after that, usually one heavy key, is built and probed chunk by chunk.
+DECLARE_mInt64(spill_hash_join_partition_max_bytes);
+DECLARE_mInt32(spill_hash_join_repartition_fanout);
+DECLARE_mInt32(spill_hash_join_max_repartition_depth);
+
+// Whether the analytic operator spills the buffered partitions when the memory of the
+// workload group is revoked. It is always on when the query forces spill.
+DECLARE_mBool(enable_analytic_spill);
+
+// Whether INTERSECT/EXCEPT spill the rows of all children, partitioned by hash, when the
+// memory of the workload group is revoked before the hash table is built.
+DECLARE_mBool(enable_set_operation_spill);
+// The number of hash partitions of a spilled set operation.
+DECLARE_mInt32(set_operation_spill_partition_count);
+// Whether the partition topn operator turns to pass through its rows when the memory of the
+// workload group is revoked, the rows buffered are output without being filtered. The
+// global phase of the two phase partition topn can not pass through.
+DECLARE_mBool(enable_partition_topn_revoke_memory);
+
+// Whether the sinks with revocable memory reserve memory from the workload group before they
+// grow, a sink spills when the reservation fails. The workload group also asks the queries
+// with the largest revocable memory to spill first when its memory is above the high watermark.
+DECLARE_mBool(enable_query_memory_reservation);
+
+// The sliding ROWS frames of sum/count/avg/min/max which have at least this number of rows are
+// evaluated by merging the aggregate states of a segment tree built over the partition,
+// instead of adding every row of every frame. 0 disables it.
+DECLARE_mInt64(analytic_segment_tree_min_frame_rows);
+
+// Whether the exchange sink sends the packages of the instances on the same host by one rpc,
+// the packages after the first one are carried by the brpc attachment. All the BEs must
+// support it before enabling it. It is disabled when transfer_large_data_by_brpc is true.
+DECLARE_mBool(exchange_sink_batch_rpc_by_host);
+// The packages are not added to a batched exchange rpc after it has this number of bytes.
+DECLARE_mInt64(exchange_sink_batch_rpc_max_bytes);
+// Whether the exchange sink sends the column values of the blocks by the brpc attachment, which
+// references them instead of copying them into the serialized request. A broadcasted block is
+// shared by the attachments of all the channels. All the BEs must support it before enabling
+// it. It is disabled when transfer_large_data_by_brpc is true.
+DECLARE_mBool(exchange_sink_send_block_by_attachment);
+// Whether the exchange sink chooses the codec of the blocks sent to every instance among none,
+// lz4 and zstd by the measured compression ratio, compression time and rpc throughput,
+// instead of using fragment_transmission_compression_codec for all of them.
+DECLARE_mBool(enable_exchange_adaptive_compression);
+// With the adaptive exchange compression, another codec is tried every this many blocks to
+// keep its measurement fresh. 0 means never.
+DECLARE_mInt64(exchange_adaptive_compression_probe_interval);
+// Whether the exchange receiver holds back the rpc response of a sender only when the bytes
+// of the sender buffered by the receiver exceed its credit, its share of
+// exchg_node_buffer_size_bytes by the rate its blocks are consumed, instead of holding the
+// response of whichever sender comes when the whole receiver is full.
+DECLARE_mBool(enable_exchange_sender_credits);
+// The least credit of a sender of the exchange receiver, in bytes.
+DECLARE_mInt64(exchange_sender_min_credit_bytes);
+// The merge node of a runtime filter merges the filters of the producers into this many
+// filters in parallel, which are merged into one when all of them arrived, instead of merging
+// them one by one into a single filter.
+DECLARE_mInt32(runtime_filter_merge_lanes);
+// The merge node of a runtime filter folds a sparse bloom filter into a smaller one before
+// publishing it, for as long as at most this fraction of its bits are set. 0 means never.
+DECLARE_mDouble(runtime_filter_bloom_filter_fold_max_fill);
+// Whether a bloom filter which is sized by the rows of the build side and not merged with the
+// filters of other instances is sized by the estimated number of distinct build keys instead.
+DECLARE_mBool(enable_runtime_filter_bloom_filter_ndv_sizing);
+// Whether the row groups of a parquet file are filtered by the bloom filters of their column
+// chunks, with the values of the equal and IN predicates and runtime filters.
+DECLARE_mBool(enable_parquet_bloom_filter_pruning);
+// A parquet scan range of at least twice this many bytes is split into slices of at least this
+// many bytes for the idle scanners of a file scan, each slice reads the row groups whose middle
+// lies in it. 0 means never.
+DECLARE_mInt64(parquet_scan_range_split_min_bytes);
+// Whether the IN and min/max runtime filters which arrived before an orc file is opened are
+// pushed into its search argument, to skip the stripes and row groups by them.
+DECLARE_mBool(enable_orc_runtime_filter_search_argument);
+// Cache for the parsed rows of iceberg position delete files, which is shared by the scanners of
+// all queries. 0 to disable it.
+DECLARE_String(iceberg_position_delete_cache_limit);
+DECLARE_mInt32(iceberg_position_delete_cache_stale_sweep_time_sec);
+// Whether the local file readers submit their reads to a per thread io_uring instead of pread.
+// The reads fall back to pread if io_uring is not available.
+DECLARE_mBool(enable_local_file_io_uring);
+// Number of submission queue entries of each io_uring.
+DECLARE_Int32(local_file_io_uring_entries);
+// Whether the io_uring polls the submission queue by a kernel thread, which saves the submit
+// syscalls at the cost of a busy kernel thread per ring.
+DECLARE_Bool(local_file_io_uring_sqpoll);
+// Whether the local file reads of compactions and disposable file cache bypass the page cache
+// by O_DIRECT, so that they do not evict the hot pages.
+DECLARE_mBool(enable_local_file_direct_io);
 
 DECLARE_mInt64(enable_debug_log_timeout_secs);
 
@@ -1280,6 +1636,11 @@ DECLARE_Int32(spill_io_thread_pool_queue_size);
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
 DECLARE_mBool(enable_s3_rate_limiter);
+// The max bytes per second read by the schema changes, compactions and file cache warm ups from
+// the local disks, and from the remote storage, 0 means unlimited. The queries are never limited.
+DECLARE_mInt64(schema_change_read_io_limit_mb_per_sec);
+DECLARE_mInt64(compaction_read_io_limit_mb_per_sec);
+DECLARE_mInt64(warmup_read_io_limit_mb_per_sec);
 // max s3 client retry times
 DECLARE_mInt32(max_s3_client_retry);
 
@@ -55,6 +55,7 @@
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/runtime_query_statistics_mgr.h"
 #include "runtime/workload_group/workload_group_manager.h"
+#include "util/continuous_cpu_profiler.h"
 #include "util/cpu_info.h"
 #include "util/debug_util.h"
 #include "util/disk_info.h"
@@ -392,6 +393,19 @@ void Daemon::wg_mem_used_refresh_thread() {
     }
 }
 
+void Daemon::cpu_profile_collect_thread() {
+    auto* profiler = ContinuousCpuProfiler::instance();
+    if (Status st = profiler->start(); !st.ok()) {
+        LOG(WARNING) << "failed to start the continuous cpu profiler: " << st;
+        return;
+    }
+    while (!_stop_background_threads_latch.wait_for(std::chrono::milliseconds(10))) {
+        profiler->collect();
+        profiler->rotate_if_needed();
+    }
+    profiler->stop();
+}
+
 void Daemon::start() {
     Status st;
     st = Thread::create(
@@ -429,6 +443,13 @@ void Daemon::start() {
             "Daemon", "wg_mem_refresh_thread", [this]() { this->wg_mem_used_refresh_thread(); },
             &_threads.emplace_back());
     CHECK(st.ok()) << st;
+
+    if (config::continuous_cpu_profile_frequency > 0) {
+        st = Thread::create(
+                "Daemon", "cpu_profile_collect_thread",
+                [this]() { this->cpu_profile_collect_thread(); }, &_threads.emplace_back());
+        CHECK(st.ok()) << st;
+    }
 }
 
 void Daemon::stop() {
@@ -45,6 +45,7 @@ private:
     void je_purge_dirty_pages_thread() const;
     void report_runtime_query_statistics_thread();
     void wg_mem_used_refresh_thread();
+    void cpu_profile_collect_thread();
 
     CountDownLatch _stop_background_threads_latch;
     std::vector<scoped_refptr<Thread>> _threads;
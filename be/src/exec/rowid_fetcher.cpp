@@ -293,41 +293,44 @@ auto scope_timer_run(Func fn, int64_t* cost) -> decltype(fn()) {
     return res;
 }
 
-struct IteratorKey {
+struct SegmentKey {
     int64_t tablet_id;
     RowsetId rowset_id;
     uint64_t segment_id;
-    int slot_id;
 
     // unordered map std::equal_to
-    bool operator==(const IteratorKey& rhs) const {
+    bool operator==(const SegmentKey& rhs) const {
         return tablet_id == rhs.tablet_id && rowset_id == rhs.rowset_id &&
-               segment_id == rhs.segment_id && slot_id == rhs.slot_id;
+               segment_id == rhs.segment_id;
     }
 };
 
-struct HashOfIteratorKey {
-    size_t operator()(const IteratorKey& key) const {
+struct HashOfSegmentKey {
+    size_t operator()(const SegmentKey& key) const {
         size_t seed = 0;
         seed = HashUtil::hash64(&key.tablet_id, sizeof(key.tablet_id), seed);
         seed = HashUtil::hash64(&key.rowset_id.hi, sizeof(key.rowset_id.hi), seed);
         seed = HashUtil::hash64(&key.rowset_id.mi, sizeof(key.rowset_id.mi), seed);
         seed = HashUtil::hash64(&key.rowset_id.lo, sizeof(key.rowset_id.lo), seed);
         seed = HashUtil::hash64(&key.segment_id, sizeof(key.segment_id), seed);
-        seed = HashUtil::hash64(&key.slot_id, sizeof(key.slot_id), seed);
         return seed;
     }
 };
 
-struct IteratorItem {
-    std::unique_ptr<ColumnIterator> iterator;
+// The requested rows that live in one segment.
+struct SegmentRows {
+    BaseTabletSPtr tablet;
+    BetaRowsetSharedPtr rowset;
     // for holding the reference of segment to avoid use after release
     SegmentSharedPtr segment;
+    // Indexes into the row_locs of the request.
+    std::vector<size_t> row_loc_idxs;
 };
 
 Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                                           PMultiGetResponse* response) {
-    // read from storage engine row id by row id
+    // read from storage engine, rows of the same segment are read together in ordinal order,
+    // so every column is read by a single sequential pass over the segment.
     OlapReaderStatistics stats;
     vectorized::Block result_block;
     int64_t acquire_tablet_ms = 0;
@@ -350,12 +353,21 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
         full_read_schema.append_column(TabletColumn(column_pb));
     }
 
-    std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey> iterator_map;
-    // read row by row
+    // group rows by segment, keep the order in which the segments are first seen
+    std::vector<SegmentRows> segment_rows;
+    std::unordered_map<SegmentKey, size_t, HashOfSegmentKey> segment_idx_map;
     for (size_t i = 0; i < request.row_locs_size(); ++i) {
         const auto& row_loc = request.row_locs(i);
-        MonotonicStopWatch watch;
-        watch.start();
+        RowsetId rowset_id;
+        rowset_id.init(row_loc.rowset_id());
+        SegmentKey segment_key {.tablet_id = row_loc.tablet_id(),
+                                .rowset_id = rowset_id,
+                                .segment_id = row_loc.segment_id()};
+        auto it = segment_idx_map.find(segment_key);
+        if (it != segment_idx_map.end()) {
+            segment_rows[it->second].row_loc_idxs.push_back(i);
+            continue;
+        }
         BaseTabletSPtr tablet = scope_timer_run(
                 [&]() {
                     auto res = ExecEnv::get_tablet(row_loc.tablet_id());
@@ -363,8 +375,6 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                                             : std::dynamic_pointer_cast<BaseTablet>(res.value());
                 },
                 &acquire_tablet_ms);
-        RowsetId rowset_id;
-        rowset_id.init(row_loc.rowset_id());
         if (!tablet) {
             continue;
         }
@@ -378,13 +388,6 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
             LOG(INFO) << "no such rowset " << rowset_id;
             continue;
         }
-        size_t row_size = 0;
-        Defer _defer([&]() {
-            LOG_EVERY_N(INFO, 100)
-                    << "multiget_data single_row, cost(us):" << watch.elapsed_time() / 1000
-                    << ", row_size:" << row_size;
-            *response->add_row_locs() = row_loc;
-        });
         SegmentCacheHandle segment_cache;
         RETURN_IF_ERROR(scope_timer_run(
                 [&]() {
@@ -392,57 +395,92 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                 },
                 &acquire_segments_ms));
         // find segment
-        auto it = std::find_if(segment_cache.get_segments().cbegin(),
-                               segment_cache.get_segments().cend(),
-                               [&row_loc](const segment_v2::SegmentSharedPtr& seg) {
-                                   return seg->id() == row_loc.segment_id();
-                               });
-        if (it == segment_cache.get_segments().end()) {
+        auto seg_it = std::find_if(segment_cache.get_segments().cbegin(),
+                                   segment_cache.get_segments().cend(),
+                                   [&row_loc](const segment_v2::SegmentSharedPtr& seg) {
+                                       return seg->id() == row_loc.segment_id();
+                                   });
+        if (seg_it == segment_cache.get_segments().end()) {
             continue;
         }
-        segment_v2::SegmentSharedPtr segment = *it;
-        GlobalRowLoacation row_location(row_loc.tablet_id(), rowset->rowset_id(),
-                                        row_loc.segment_id(), row_loc.ordinal_id());
+        segment_idx_map.emplace(segment_key, segment_rows.size());
+        segment_rows.push_back(SegmentRows {.tablet = std::move(tablet),
+                                            .rowset = std::move(rowset),
+                                            .segment = *seg_it,
+                                            .row_loc_idxs = {i}});
+    }
+
+    std::vector<segment_v2::rowid_t> row_ids;
+    std::vector<uint32_t> positions;
+    for (auto& rows : segment_rows) {
+        MonotonicStopWatch watch;
+        watch.start();
+        std::stable_sort(rows.row_loc_idxs.begin(), rows.row_loc_idxs.end(),
+                         [&request](size_t l, size_t r) {
+                             return request.row_locs(l).ordinal_id() <
+                                    request.row_locs(r).ordinal_id();
+                         });
+        size_t row_size = 0;
+        Defer _defer([&]() {
+            LOG_EVERY_N(INFO, 100)
+                    << "multiget_data segment_rows, cost(us):" << watch.elapsed_time() / 1000
+                    << ", rows:" << rows.row_loc_idxs.size() << ", row_size:" << row_size;
+            for (size_t idx : rows.row_loc_idxs) {
+                *response->add_row_locs() = request.row_locs(idx);
+            }
+        });
         // fetch by row store, more effcient way
         if (request.fetch_row_store()) {
-            CHECK(tablet->tablet_schema()->store_row_column());
-            RowLocation loc(rowset_id, segment->id(), row_loc.ordinal_id());
-            string* value = response->add_binary_row_data();
-            RETURN_IF_ERROR(scope_timer_run(
-                    [&]() {
-                        return tablet->lookup_row_data({}, loc, rowset, &desc, stats, *value);
-                    },
-                    &lookup_row_data_ms));
-            row_size = value->size();
+            CHECK(rows.tablet->tablet_schema()->store_row_column());
+            for (size_t idx : rows.row_loc_idxs) {
+                RowLocation loc(rows.rowset->rowset_id(), rows.segment->id(),
+                                request.row_locs(idx).ordinal_id());
+                string* value = response->add_binary_row_data();
+                RETURN_IF_ERROR(scope_timer_run(
+                        [&]() {
+                            return rows.tablet->lookup_row_data({}, loc, rows.rowset, &desc, stats,
+                                                                *value);
+                        },
+                        &lookup_row_data_ms));
+                row_size += value->size();
+            }
             continue;
         }
 
-        // fetch by column store
+        // fetch by column store, the column iterators require sorted and unique row ids
+        row_ids.clear();
+        positions.clear();
+        for (size_t idx : rows.row_loc_idxs) {
+            auto row_id = static_cast<segment_v2::rowid_t>(request.row_locs(idx).ordinal_id());
+            if (row_ids.empty() || row_ids.back() != row_id) {
+                row_ids.push_back(row_id);
+            }
+            positions.push_back(row_ids.size() - 1);
+        }
+        bool has_duplicated_row = row_ids.size() < positions.size();
         if (result_block.is_empty_column()) {
             result_block = vectorized::Block(desc.slots(), request.row_locs().size());
         }
-        VLOG_DEBUG << "Read row location "
-                   << fmt::format("{}, {}, {}, {}", row_location.tablet_id,
-                                  row_location.row_location.rowset_id.to_string(),
-                                  row_location.row_location.segment_id,
-                                  row_location.row_location.row_id);
+        VLOG_DEBUG << "Read segment rows "
+                   << fmt::format("{}, {}, {}, rows:{}", rows.tablet->tablet_id(),
+                                  rows.rowset->rowset_id().to_string(), rows.segment->id(),
+                                  row_ids.size());
         for (int x = 0; x < desc.slots().size(); ++x) {
-            auto row_id = static_cast<segment_v2::rowid_t>(row_loc.ordinal_id());
             vectorized::MutableColumnPtr column =
                     result_block.get_by_position(x).column->assume_mutable();
-            IteratorKey iterator_key {.tablet_id = tablet->tablet_id(),
-                                      .rowset_id = rowset_id,
-                                      .segment_id = row_loc.segment_id(),
-                                      .slot_id = desc.slots()[x]->id()};
-            IteratorItem& iterator_item = iterator_map[iterator_key];
-            if (iterator_item.segment == nullptr) {
-                // hold the reference
-                iterator_map[iterator_key].segment = segment;
+            std::unique_ptr<ColumnIterator> iterator;
+            if (!has_duplicated_row) {
+                RETURN_IF_ERROR(rows.segment->seek_and_read_by_rowids(
+                        full_read_schema, desc.slots()[x], row_ids.data(), row_ids.size(), column,
+                        stats, iterator));
+                continue;
             }
-            segment = iterator_item.segment;
-            RETURN_IF_ERROR(segment->seek_and_read_by_rowid(full_read_schema, desc.slots()[x],
-                                                            row_id, column, stats,
-                                                            iterator_item.iterator));
+            vectorized::MutableColumnPtr unique_column = column->clone_empty();
+            RETURN_IF_ERROR(rows.segment->seek_and_read_by_rowids(
+                    full_read_schema, desc.slots()[x], row_ids.data(), row_ids.size(),
+                    unique_column, stats, iterator));
+            column->insert_indices_from(*unique_column, positions.data(),
+                                        positions.data() + positions.size());
         }
     }
     // serialize block if not empty
@@ -414,6 +414,28 @@ bool VOlapTablePartitionParam::_part_contains(VOlapTablePartition* part,
            || !comparator(key, std::tuple {part->start_key.first, part->start_key.second, false});
 }
 
+bool VOlapTablePartitionParam::_range_part_contains(VOlapTablePartition* part,
+                                                    BlockRowWithIndicator key) const {
+    VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
+    return comparator(key, std::tuple {part->end_key.first, part->end_key.second, false}) &&
+           _part_contains(part, key);
+}
+
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    VOlapTablePartition* last_partition = nullptr;
+    for (int row = 0; row < rows; ++row) {
+        if (last_partition != nullptr &&
+            _range_part_contains(last_partition, std::tuple {block, row, true})) {
+            partitions[row] = last_partition;
+            continue;
+        }
+        find_partition(block, row, partitions[row]);
+        // a list partition has no range to check the next row against
+        last_partition = _is_in_partition ? nullptr : partitions[row];
+    }
+}
+
 // insert value into _partition_block's column
 // NOLINTBEGIN(readability-function-size)
 static Status _create_partition_key(const TExprNode& t_expr, BlockRow* part_key, uint16_t pos) {
@@ -194,6 +194,12 @@ public:
         return (partition != nullptr);
     }
 
+    // find_partition() for the first `rows` rows of the block. The rows of a range partition are
+    // usually clustered, e.g. by time, so a row is checked against the partition of the previous
+    // row before the search in the partitions map.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
@@ -202,23 +208,21 @@ public:
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
+        std::vector<uint32_t> hash_vals;
         if (!_distributed_slot_locs.empty()) {
-            //TODO: refactor by saving the hash values. then we can calculate in columnwise.
-            compute_function = [this](vectorized::Block* block, uint32_t row,
-                                      const VOlapTablePartition& partition) -> uint32_t {
-                uint32_t hash_val = 0;
-                for (unsigned short _distributed_slot_loc : _distributed_slot_locs) {
-                    auto* slot_desc = _slots[_distributed_slot_loc];
-                    auto& column = block->get_by_position(_distributed_slot_loc).column;
-                    auto val = column->get_data_at(row);
-                    if (val.data != nullptr) {
-                        hash_val = RawValue::zlib_crc32(val.data, val.size, slot_desc->type().type,
-                                                        hash_val);
-                    } else {
-                        hash_val = HashUtil::zlib_crc_hash_null(hash_val);
-                    }
-                }
-                return hash_val % partition.num_buckets;
+            // hash the distribution columns of all the rows column by column, which is the same
+            // crc as the bucket shuffle computes
+            hash_vals.resize(block->rows(), 0);
+            for (auto distributed_slot_loc : _distributed_slot_locs) {
+                auto column = block->get_by_position(distributed_slot_loc)
+                                      .column->convert_to_full_column_if_const();
+                column->update_crcs_with_value(hash_vals.data(),
+                                               _slots[distributed_slot_loc]->type().type,
+                                               static_cast<uint32_t>(hash_vals.size()));
+            }
+            compute_function = [&hash_vals](vectorized::Block* block, uint32_t row,
+                                            const VOlapTablePartition& partition) -> uint32_t {
+                return hash_vals[row] % partition.num_buckets;
             };
         } else { // random distribution
             compute_function = [](vectorized::Block* block, uint32_t row,
@@ -282,6 +286,8 @@ private:
 
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
+    // check both ends of a range partition, while _part_contains() only checks the left one
+    bool _range_part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
     // this partition only valid in this schema
     std::shared_ptr<OlapTableSchemaParam> _schema;
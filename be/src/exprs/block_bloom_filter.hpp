@@ -131,6 +131,14 @@ public:
     // - Or'ing with kAlwaysTrueFilter is disallowed.
     Status merge(const BlockBloomFilter& other);
 
+    // Halves the directory by or'ing its upper half into its lower half, for as long as at most
+    // `max_fill` of the bits are set afterwards. The buckets are addressed by the low bits of
+    // the rehashed value, so the folded filter still finds every inserted element, with a higher
+    // false positive rate. Returns whether it is folded.
+    // Notes:
+    // - A folded filter can not be merged with the filters of the original size.
+    bool fold(double max_fill);
+
     // Computes out[i] |= in[i] for the arrays 'in' and 'out' of length 'n' bytes where 'n'
     // is multiple of 32-bytes.
     static Status or_equal_array(size_t n, const uint8_t* __restrict__ in,
@@ -245,4 +245,35 @@ Status BlockBloomFilter::merge(const BlockBloomFilter& other) {
     return Status::OK();
 }
 
+bool BlockBloomFilter::fold(double max_fill) {
+    DCHECK(_directory);
+    bool folded = false;
+    while (_log_num_buckets > 1) {
+        const size_t half_size = directory_size() / 2;
+        const auto* lower = reinterpret_cast<const uint64_t*>(_directory);
+        const auto* upper = reinterpret_cast<const uint64_t*>(
+                reinterpret_cast<const uint8_t*>(_directory) + half_size);
+        size_t set_bits = 0;
+        for (size_t i = 0; i < half_size / sizeof(uint64_t); ++i) {
+            set_bits += __builtin_popcountll(lower[i] | upper[i]);
+        }
+        if (static_cast<double>(set_bits) > max_fill * static_cast<double>(half_size * CHAR_BIT)) {
+            break;
+        }
+        or_equal_array_internal(half_size, reinterpret_cast<const uint8_t*>(upper),
+                                reinterpret_cast<uint8_t*>(_directory));
+        --_log_num_buckets;
+        _directory_mask >>= 1;
+        folded = true;
+    }
+    Bucket* directory = nullptr;
+    // the filter is usable in the original memory too, so a failed allocation is ignored
+    if (folded && posix_memalign((void**)&directory, 32, directory_size()) == 0) {
+        memcpy(directory, _directory, directory_size());
+        free(_directory);
+        _directory = directory;
+    }
+    return folded;
+}
+
 } // namespace doris
@@ -41,6 +41,8 @@ public:
 
     Status merge(BloomFilterAdaptor* other) { return _bloom_filter->merge(*other->_bloom_filter); }
 
+    bool fold(double max_fill) { return _bloom_filter->fold(max_fill); }
+
     Status init(int len) {
         int log_space = (int)log2(len);
         return _bloom_filter->init(log_space, /*hash_seed*/ 0);
@@ -192,6 +194,16 @@ public:
         return _bloom_filter->init(data, data_size);
     }
 
+    // Folds a sparse filter into a smaller one, see BlockBloomFilter::fold. It is only done to
+    // a filter which all the producer filters are merged into already.
+    void fold(double max_fill) {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_inited && _bloom_filter->fold(max_fill)) {
+            _bloom_filter_alloced = _bloom_filter->size();
+            _bloom_filter_length = _bloom_filter_alloced;
+        }
+    }
+
     void get_data(char** data, int* len) {
         *data = _bloom_filter->data();
         *len = _bloom_filter->size();
@@ -997,9 +997,16 @@ Status IRuntimeFilter::publish(bool publish_local) {
         RETURN_IF_ERROR(_state->runtime_filter_mgr->get_local_merge_producer_filters(
                 _filter_id, &local_merge_filters));
         std::lock_guard l(*local_merge_filters->lock);
+        if (local_merge_filters->first_merge_ms == 0) {
+            local_merge_filters->first_merge_ms = MonotonicMillis();
+        }
         RETURN_IF_ERROR(local_merge_filters->filters[0]->merge_from(_wrapper));
         local_merge_filters->merge_time--;
         if (local_merge_filters->merge_time == 0) {
+            _profile->add_info_string(
+                    "LocalMergeWaitTime",
+                    std::to_string(MonotonicMillis() - local_merge_filters->first_merge_ms) +
+                            " ms");
             if (_has_local_target) {
                 RETURN_IF_ERROR(send_to_local(local_merge_filters->filters[0]->_wrapper));
             } else {
@@ -1335,6 +1342,12 @@ BloomFilterFuncBase* IRuntimeFilter::get_bloomfilter() const {
     return _wrapper->get_bloomfilter();
 }
 
+void IRuntimeFilter::fold_bloom_filter(double max_fill) {
+    if (!_wrapper->is_ignored() && _wrapper->get_real_type() == RuntimeFilterType::BLOOM_FILTER) {
+        get_bloomfilter()->fold(max_fill);
+    }
+}
+
 Status IRuntimeFilter::init_with_desc(const TRuntimeFilterDesc* desc, const TQueryOptions* options,
                                       int node_id, bool build_bf_exactly) {
     // if node_id == -1 , it shouldn't be a consumer
@@ -276,12 +276,16 @@ public:
 
     BloomFilterFuncBase* get_bloomfilter() const;
 
+    // Folds a sparse bloom filter before it is published, so that less is sent and probed.
+    void fold_bloom_filter(double max_fill);
+
     // serialize _wrapper to protobuf
     Status serialize(PMergeFilterRequest* request, void** data, int* len);
     Status serialize(PPublishFilterRequest* request, void** data = nullptr, int* len = nullptr);
     Status serialize(PPublishFilterRequestV2* request, void** data = nullptr, int* len = nullptr);
 
     Status merge_from(const RuntimePredicateWrapper* wrapper);
+    Status merge_from(const IRuntimeFilter* filter) { return merge_from(filter->_wrapper); }
 
     static Status create_wrapper(const MergeRuntimeFilterParams* param, ObjectPool* pool,
                                  std::unique_ptr<RuntimePredicateWrapper>* wrapper);
@@ -17,9 +17,11 @@
 
 #pragma once
 
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "exprs/runtime_filter.h"
+#include "olap/hll.h"
 #include "runtime/runtime_filter_mgr.h"
 #include "runtime/runtime_state.h"
 #include "vec/columns/column_nullable.h"
@@ -92,7 +94,12 @@ public:
         return Status::OK();
     }
 
-    Status init_filters(RuntimeState* state, uint64_t local_hash_table_size) {
+    // `block` is the build block with the evaluated build expressions, if it is given the bloom
+    // filters sized by the local rows are sized by the estimated distinct keys instead.
+    Status init_filters(RuntimeState* state, uint64_t local_hash_table_size,
+                        const vectorized::Block* block = nullptr) {
+        // expr order => the estimated number of the distinct keys
+        std::map<int, uint64_t> ndvs;
         // process IN_OR_BLOOM_FILTER's real type
         for (auto* filter : _runtime_filters) {
             if (filter->type() == RuntimeFilterType::IN_OR_BLOOM_FILTER &&
@@ -101,8 +108,17 @@ public:
             }
 
             if (filter->get_real_type() == RuntimeFilterType::BLOOM_FILTER) {
-                RETURN_IF_ERROR(
-                        filter->init_bloom_filter(get_real_size(filter, local_hash_table_size)));
+                uint64_t size = get_real_size(filter, local_hash_table_size);
+                if (block != nullptr && !filter->isset_synced_size() &&
+                    filter->get_bloomfilter()->get_build_bf_cardinality() &&
+                    config::enable_runtime_filter_bloom_filter_ndv_sizing) {
+                    auto [iter, inserted] = ndvs.emplace(filter->expr_order(), 0);
+                    if (inserted) {
+                        iter->second = _estimate_ndv(*block, filter->expr_order());
+                    }
+                    size = std::min(size, std::max<uint64_t>(iter->second, 1));
+                }
+                RETURN_IF_ERROR(filter->init_bloom_filter(size));
             }
         }
         return Status::OK();
@@ -161,6 +177,20 @@ public:
     bool empty() { return _runtime_filters_map.empty(); }
 
 private:
+    uint64_t _estimate_ndv(const vectorized::Block& block, int expr_order) const {
+        int result_column_id = _build_expr_context[expr_order]->get_last_result_column_id();
+        auto column =
+                block.get_by_position(result_column_id).column->convert_to_full_column_if_const();
+        std::vector<uint64_t> hashes(column->size(), 0);
+        column->update_hashes_with_value(hashes.data());
+        HyperLogLog hll;
+        // the first row is mocked by the hash join build, like in `insert`
+        for (size_t i = 1; i < hashes.size(); ++i) {
+            hll.update(hashes[i]);
+        }
+        return hll.estimate_cardinality();
+    }
+
     const std::vector<std::shared_ptr<vectorized::VExprContext>>& _build_expr_context;
     std::vector<IRuntimeFilter*> _runtime_filters;
     // prob_contition index -> [IRuntimeFilter]
@@ -17,6 +17,7 @@
 
 #include "file_cache_action.h"
 
+#include <exception>
 #include <memory>
 #include <shared_mutex>
 #include <sstream>
@@ -27,6 +28,7 @@
 #include "http/http_request.h"
 #include "http/http_status.h"
 #include "io/cache/block_file_cache_factory.h"
+#include "io/cache/peer_file_cache.h"
 #include "olap/olap_define.h"
 #include "olap/tablet_meta.h"
 #include "util/easy_json.h"
@@ -35,6 +37,7 @@ namespace doris {
 
 const static std::string HEADER_JSON = "application/json";
 const static std::string OP = "op";
+const static size_t MAX_FETCH_SIZE = 64 * 1024 * 1024;
 
 Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metrics) {
     req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
@@ -54,7 +57,41 @@ Status FileCacheAction::_handle_header(HttpRequest* req, std::string* json_metri
     return Status::InternalError("invalid operation: {}", operation);
 }
 
+void FileCacheAction::_handle_fetch(HttpRequest* req) {
+    io::UInt128Wrapper hash;
+    size_t offset = 0;
+    size_t size = 0;
+    Status st = io::PeerFileCache::parse_hash(req->param("hash"), &hash);
+    try {
+        offset = std::stoull(req->param("offset"));
+        size = std::stoull(req->param("size"));
+    } catch (const std::exception& e) {
+        st = Status::InvalidArgument("invalid offset or size: {}", e.what());
+    }
+    if (st.ok() && (size == 0 || size > MAX_FETCH_SIZE)) {
+        st = Status::InvalidArgument("invalid size: {}", size);
+    }
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, st.to_json());
+        return;
+    }
+    std::string data(size, '\0');
+    st = io::PeerFileCache::read_cached(hash, offset, Slice(data.data(), data.size()));
+    if (!st.ok()) {
+        auto status = st.is<ErrorCode::NOT_FOUND>() ? HttpStatus::NOT_FOUND
+                                                    : HttpStatus::INTERNAL_SERVER_ERROR;
+        HttpChannel::send_reply(req, status, st.to_json());
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/octet-stream");
+    HttpChannel::send_reply(req, HttpStatus::OK, data);
+}
+
 void FileCacheAction::handle(HttpRequest* req) {
+    if (req->param(OP) == "fetch") {
+        _handle_fetch(req);
+        return;
+    }
     std::string json_metrics;
     Status status = _handle_header(req, &json_metrics);
     std::string status_result = status.to_json();
@@ -36,5 +36,7 @@ public:
 
 private:
     Status _handle_header(HttpRequest* req, std::string* json_metrics);
+    // Serve a range of a file in the file cache to a peer BE, see `io::PeerFileCache`.
+    void _handle_fetch(HttpRequest* req);
 };
 } // namespace doris
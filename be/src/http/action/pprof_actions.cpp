@@ -35,12 +35,16 @@
 #include "http/ev_http_server.h"
 #include "http/http_channel.h"
 #include "http/http_handler.h"
+#include "http/http_headers.h"
 #include "http/http_method.h"
 #include "http/http_request.h"
+#include "http/http_status.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 #include "util/bfd_parser.h"
+#include "util/continuous_cpu_profiler.h"
 #include "util/pprof_utils.h" // IWYU pragma: keep
+#include "util/uid_util.h"
 
 namespace doris {
 
@@ -242,6 +246,66 @@ void CmdlineAction::handle(HttpRequest* req) {
     HttpChannel::send_reply(req, str);
 }
 
+// The samples of the continuous cpu profiler, see ContinuousCpuProfiler.
+//   /pprof/continuous?type=flamegraph[&query_id=xxx][&workload_group_id=xxx]
+//     the folded call stacks for flamegraph.pl or speedscope.
+//   /pprof/continuous?type=top
+//     the samples of each query and each workload group in json.
+//   /pprof/continuous?type=reset
+class ContinuousProfileAction : public HttpHandler {
+public:
+    ContinuousProfileAction() {}
+    virtual ~ContinuousProfileAction() {}
+    virtual void handle(HttpRequest* req) override;
+};
+
+void ContinuousProfileAction::handle(HttpRequest* req) {
+    auto* profiler = ContinuousCpuProfiler::instance();
+    if (!profiler->started()) {
+        HttpChannel::send_reply(req, HttpStatus::SERVICE_UNAVAILABLE,
+                                "continuous cpu profiler is not running, "
+                                "see continuous_cpu_profile_frequency\n");
+        return;
+    }
+    const std::string& type = req->param("type");
+    if (type == "top") {
+        req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+        HttpChannel::send_reply(req, profiler->top_json());
+        return;
+    }
+    if (type == "reset") {
+        profiler->reset();
+        HttpChannel::send_reply(req, "OK\n");
+        return;
+    }
+    if (!type.empty() && type != "flamegraph") {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST, "unknown type: " + type + "\n");
+        return;
+    }
+    TUniqueId query_id;
+    const std::string& query_id_str = req->param("query_id");
+    if (!query_id_str.empty() && !parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                "invalid query_id: " + query_id_str + "\n");
+        return;
+    }
+    uint64_t workload_group_id = 0;
+    const std::string& workload_group_id_str = req->param("workload_group_id");
+    if (!workload_group_id_str.empty()) {
+        try {
+            workload_group_id = std::stoull(workload_group_id_str);
+        } catch (const std::exception&) {
+            HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                    "invalid workload_group_id: " + workload_group_id_str + "\n");
+            return;
+        }
+    }
+    HttpChannel::send_reply(
+            req, profiler->folded_stacks(query_id_str.empty() ? nullptr : &query_id,
+                                         workload_group_id_str.empty() ? nullptr
+                                                                       : &workload_group_id));
+}
+
 class SymbolAction : public HttpHandler {
 public:
     SymbolAction(BfdParser* parser) : _parser(parser) {}
@@ -305,6 +369,8 @@ Status PprofActions::setup(ExecEnv* exec_env, EvHttpServer* http_server, ObjectP
     http_server->register_handler(HttpMethod::GET, "/pprof/contention",
                                   pool.add(new ContentionAction()));
     http_server->register_handler(HttpMethod::GET, "/pprof/cmdline", pool.add(new CmdlineAction()));
+    http_server->register_handler(HttpMethod::GET, "/pprof/continuous",
+                                  pool.add(new ContinuousProfileAction()));
     auto action = pool.add(new SymbolAction(exec_env->bfd_parser()));
     http_server->register_handler(HttpMethod::GET, "/pprof/symbol", action);
     http_server->register_handler(HttpMethod::HEAD, "/pprof/symbol", action);
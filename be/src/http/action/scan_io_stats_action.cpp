@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/scan_io_stats_action.h"
+
+#include <exception>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "olap/scan_io_stats.h"
+
+namespace doris {
+
+const static std::string HEADER_JSON = "application/json";
+
+ScanIOStatsAction::ScanIOStatsAction(ExecEnv* exec_env, TPrivilegeHier::type hier,
+                                     TPrivilegeType::type type)
+        : HttpHandlerWithAuth(exec_env, hier, type) {}
+
+void ScanIOStatsAction::handle(HttpRequest* req) {
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    auto* scan_io_stats = ScanIOStats::instance();
+    if (req->param("op") == "reset") {
+        scan_io_stats->reset();
+        HttpChannel::send_reply(req, HttpStatus::OK, Status::OK().to_json());
+        return;
+    }
+
+    int64_t tablet_id = 0;
+    size_t limit = 100;
+    try {
+        if (!req->param("tablet_id").empty()) {
+            tablet_id = std::stoll(req->param("tablet_id"));
+        }
+        if (!req->param("limit").empty()) {
+            limit = std::stoull(req->param("limit"));
+        }
+    } catch (const std::exception& e) {
+        HttpChannel::send_reply(
+                req, HttpStatus::BAD_REQUEST,
+                Status::InvalidArgument("invalid argument: {}", e.what()).to_json());
+        return;
+    }
+
+    if (tablet_id != 0) {
+        ScanIOStats::TabletStats stats;
+        std::vector<std::pair<int64_t, ScanIOStats::TabletStats>> tablets;
+        if (scan_io_stats->get(tablet_id, &stats)) {
+            tablets.emplace_back(tablet_id, std::move(stats));
+        }
+        HttpChannel::send_reply(req, HttpStatus::OK, ScanIOStats::to_json(tablets));
+        return;
+    }
+    HttpChannel::send_reply(req, HttpStatus::OK, scan_io_stats->to_json(limit));
+}
+
+} // namespace doris
@@ -21,6 +21,8 @@
 #include <gen_cpp/olap_file.pb.h>
 #include <gflags/gflags.h>
 
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -82,6 +84,7 @@ DEFINE_string(dest_idx_dirs_file, "", "destination segment index files");
 DEFINE_string(dest_seg_num_rows_file, "", "destination segment number of rows");
 DEFINE_string(tablet_path, "", "tablet path");
 DEFINE_string(trans_vec_file, "", "rowid conversion map file");
+DEFINE_int32(repeat, 1, "times to run a match_all term query, the average time is printed");
 
 std::string get_usage(const std::string& progname) {
     std::stringstream ss;
@@ -93,6 +96,9 @@ std::string get_usage(const std::string& progname) {
     ss << "./index_tool --operation=term_query --directory=directory "
           "--idx_file_name=file --print_row_id --term=term --column_name=column_name "
           "--pred_type=eq/lt/gt/le/ge/match etc\n";
+    ss << "./index_tool --operation=term_query --directory=directory "
+          "--idx_file_name=file --term=term1|term2 --column_name=column_name "
+          "--pred_type=match_all --repeat=10\n";
     ss << "*** debug_index_compaction operation is only for offline debug index compaction, do not "
           "use in production ***\n";
     ss << "./index_tool --operation=debug_index_compaction --idx_id=index_id "
@@ -166,10 +172,20 @@ void search(lucene::store::Directory* dir, std::string& field, std::string& toke
         roaring::Roaring result;
         std::vector<std::string> terms = split(token, '|');
 
-        doris::TQueryOptions queryOptions;
-        ConjunctionQuery conjunct_query(s, queryOptions);
-        conjunct_query.add(field_ws, terms);
-        conjunct_query.search(result);
+        int32_t repeat = std::max(FLAGS_repeat, 1);
+        int64_t elapsed_us = 0;
+        for (int32_t i = 0; i < repeat; ++i) {
+            result = roaring::Roaring();
+            auto start = std::chrono::steady_clock::now();
+            doris::TQueryOptions queryOptions;
+            ConjunctionQuery conjunct_query(s, queryOptions);
+            conjunct_query.add(field_ws, terms);
+            conjunct_query.search(result);
+            elapsed_us += std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count();
+        }
+        std::cout << "Term query average time(us):" << elapsed_us / repeat << std::endl;
 
         total += result.cardinality();
     } else {
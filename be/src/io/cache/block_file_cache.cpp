@@ -28,6 +28,7 @@
 #include <sys/statfs.h>
 #endif
 
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <mutex>
 #include <ranges>
@@ -38,6 +39,7 @@
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
 #include "io/cache/fs_file_cache_storage.h"
+#include "util/doris_metrics.h"
 #include "util/time.h"
 #include "vec/common/sip_hash.h"
 #include "vec/common/uint128.h"
@@ -78,6 +80,19 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
     _total_evict_size_metrics = std::make_shared<bvar::Adder<size_t>>(
             _cache_base_path.c_str(), "file_cache_total_evict_size");
 
+    const auto& policy = config::file_cache_admission_policy;
+    _hit_ratio_metrics = std::make_shared<bvar::Status<double>>(
+            _cache_base_path.c_str(), "file_cache_" + policy + "_hit_ratio", 0.0);
+    _recent_hit_ratio_metrics = std::make_shared<bvar::Status<double>>(
+            _cache_base_path.c_str(), "file_cache_" + policy + "_recent_hit_ratio", 0.0);
+    _admission_reject_num_metrics = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_admission_reject_num");
+    if (policy == "tinylfu") {
+        _admission_sketch = std::make_unique<FrequencySketch>(
+                cache_settings.disposable_queue_elements + cache_settings.index_queue_elements +
+                cache_settings.query_queue_elements);
+    }
+
     _disposable_queue = LRUQueue(cache_settings.disposable_queue_size,
                                  cache_settings.disposable_queue_elements, 60 * 60);
     _index_queue = LRUQueue(cache_settings.index_queue_size, cache_settings.index_queue_elements,
@@ -268,6 +283,25 @@ FileBlocks BlockFileCache::get_impl(const UInt128Wrapper& hash, const CacheConte
             return {};
         }
     }
+    // The blocks loaded from the persistent index are checked on first access.
+    if (auto missing_offsets = _storage->get_missing_blocks_unlocked(this, hash, cache_lock);
+        !missing_offsets.empty()) {
+        for (size_t offset : missing_offsets) {
+            auto* cell = get_cell(hash, offset, cache_lock);
+            if (cell == nullptr || !cell->releasable()) {
+                continue;
+            }
+            FileBlockSPtr file_block = cell->file_block;
+            std::lock_guard block_lock(file_block->_mutex);
+            // There is no data to remove in the storage.
+            file_block->_download_state = FileBlock::State::EMPTY;
+            remove(file_block, cache_lock, block_lock);
+        }
+        it = _files.find(hash);
+        if (it == _files.end()) {
+            return {};
+        }
+    }
 
     auto& file_blocks = it->second;
     DCHECK(!file_blocks.empty());
@@ -619,6 +653,8 @@ void BlockFileCache::fill_holes_with_empty_file_blocks(FileBlocks& file_blocks,
 
 FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t offset, size_t size,
                                             const CacheContext& context) {
+    // including the wait for the lock, the most of the tail latency
+    ScopedLatencyTimer latency_timer(DorisMetrics::instance()->file_cache_lookup_latency_us);
     FileBlock::Range range(offset, offset + size - 1);
 
     std::lock_guard cache_lock(_mutex);
@@ -638,6 +674,9 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
         if (block->state() == FileBlock::State::DOWNLOADED) {
             _num_hit_blocks++;
         }
+        if (_admission_sketch) {
+            _admission_sketch->increment(admission_key(hash, block->offset()));
+        }
     }
     return FileBlocksHolder(std::move(file_blocks));
 }
@@ -823,6 +862,11 @@ bool BlockFileCache::try_reserve(const UInt128Wrapper& hash, const CacheContext&
         return try_reserve_for_ttl(size, cache_lock);
     }
 
+    if (_admission_sketch && !admit(hash, context, offset, size, cache_lock)) {
+        *_admission_reject_num_metrics << 1;
+        return false;
+    }
+
     auto query_context = config::enable_file_cache_query_limit &&
                                          (context.query_id.hi != 0 || context.query_id.lo != 0)
                                  ? get_query_context(context.query_id, cache_lock)
@@ -1132,6 +1176,20 @@ bool BlockFileCache::try_reserve_from_other_queue(FileCacheType cur_cache_type,
     return try_reserve_from_other_queue_by_size(other_cache_types, size, cache_lock);
 }
 
+bool BlockFileCache::admit(const UInt128Wrapper& hash, const CacheContext& context,
+                           size_t offset, size_t size, std::lock_guard<std::mutex>& cache_lock) {
+    auto& queue = get_queue(context.cache_type);
+    bool need_evict = _cur_cache_size + size > _capacity ||
+                      queue.get_capacity(cache_lock) + size > queue.get_max_size();
+    if (!need_evict || queue.begin() == queue.end()) {
+        return true;
+    }
+    const auto& victim = *queue.begin();
+    // The access of the block itself is recorded after the reservation, so count it here.
+    return _admission_sketch->estimate(admission_key(hash, offset)) + 1 >
+           _admission_sketch->estimate(admission_key(victim.hash, victim.offset));
+}
+
 bool BlockFileCache::try_reserve_for_lru(const UInt128Wrapper& hash,
                                          QueryFileCacheContextPtr query_context,
                                          const CacheContext& context, size_t offset, size_t size,
@@ -1435,6 +1493,7 @@ void BlockFileCache::check_disk_resource_limit(const std::string& path) {
 
 void BlockFileCache::run_background_operation() {
     int64_t interval_time_seconds = 20;
+    int64_t last_checkpoint_time = UnixSeconds();
     while (!_close) {
         TEST_SYNC_POINT_CALLBACK("BlockFileCache::set_sleep_time", &interval_time_seconds);
         check_disk_resource_limit(_cache_base_path);
@@ -1446,6 +1505,14 @@ void BlockFileCache::run_background_operation() {
             }
         }
         recycle_deleted_blocks();
+        if (_shard_group && _shard_idx == 0) {
+            _shard_group->rebalance();
+        }
+        if (_lazy_open_done && UnixSeconds() - last_checkpoint_time >=
+                                       config::file_cache_index_checkpoint_interval_second) {
+            _storage->checkpoint(this, false);
+            last_checkpoint_time = UnixSeconds();
+        }
         // gc
         int64_t cur_time = UnixSeconds();
         std::lock_guard cache_lock(_mutex);
@@ -1473,6 +1540,83 @@ void BlockFileCache::run_background_operation() {
                 _disposable_queue.get_capacity(cache_lock));
         _cur_disposable_queue_element_count_metrics->set_value(
                 _disposable_queue.get_elements_num(cache_lock));
+        if (_num_read_blocks > 0) {
+            _hit_ratio_metrics->set_value(static_cast<double>(_num_hit_blocks) /
+                                          static_cast<double>(_num_read_blocks));
+        }
+        if (_num_read_blocks > _num_read_blocks_last_report) {
+            _recent_hit_ratio_metrics->set_value(
+                    static_cast<double>(_num_hit_blocks - _num_hit_blocks_last_report) /
+                    static_cast<double>(_num_read_blocks - _num_read_blocks_last_report));
+        }
+        _num_read_blocks_last_report = _num_read_blocks;
+        _num_hit_blocks_last_report = _num_hit_blocks;
+    }
+}
+
+void BlockFileCache::reset_capacity(size_t new_capacity) {
+    std::lock_guard cache_lock(_mutex);
+    size_t old_capacity = _capacity;
+    if (old_capacity == 0 || new_capacity == old_capacity) {
+        return;
+    }
+    double ratio = static_cast<double>(new_capacity) / static_cast<double>(old_capacity);
+    for (auto* queue : {&_index_queue, &_normal_queue, &_disposable_queue}) {
+        queue->max_size = static_cast<size_t>(static_cast<double>(queue->max_size) * ratio);
+    }
+    _capacity = new_capacity;
+}
+
+size_t BlockFileCache::get_cur_cache_size() const {
+    std::lock_guard cache_lock(_mutex);
+    return _cur_cache_size;
+}
+
+void FileCacheShardGroup::rebalance() {
+    int64_t now = UnixSeconds();
+    if (now - last_rebalance_time < config::file_cache_shard_rebalance_interval_second ||
+        shards.size() <= 1) {
+        return;
+    }
+    last_rebalance_time = now;
+    last_evict_sizes.resize(shards.size(), 0);
+    // The demand of a shard is what it holds plus what it has evicted since the last
+    // rebalance, a shard under pressure evicts more and gets more capacity.
+    std::vector<double> demands(shards.size());
+    double total_demand = 0;
+    for (size_t i = 0; i < shards.size(); ++i) {
+        size_t evict_size = shards[i]->get_total_evict_size();
+        demands[i] = static_cast<double>(shards[i]->get_cur_cache_size() + evict_size -
+                                         last_evict_sizes[i]);
+        last_evict_sizes[i] = evict_size;
+        total_demand += demands[i];
+    }
+    if (total_demand == 0) {
+        return;
+    }
+    // Keep every shard within [1/2, 2] of the even share, and skip the small changes.
+    double even_share = static_cast<double>(total_capacity) / shards.size();
+    std::vector<size_t> capacities(shards.size());
+    double total = 0;
+    for (size_t i = 0; i < shards.size(); ++i) {
+        double capacity = std::clamp(total_capacity * demands[i] / total_demand, even_share / 2,
+                                     even_share * 2);
+        capacities[i] = static_cast<size_t>(capacity);
+        total += capacity;
+    }
+    for (auto& capacity : capacities) {
+        capacity = static_cast<size_t>(capacity * (total_capacity / total));
+    }
+    // Shrink first, so the sum of the capacities does not exceed the total one.
+    for (bool shrink : {true, false}) {
+        for (size_t i = 0; i < shards.size(); ++i) {
+            size_t old_capacity = shards[i]->capacity();
+            size_t diff = old_capacity > capacities[i] ? old_capacity - capacities[i]
+                                                       : capacities[i] - old_capacity;
+            if ((old_capacity > capacities[i]) == shrink && diff > even_share / 16) {
+                shards[i]->reset_capacity(capacities[i]);
+            }
+        }
     }
 }
 
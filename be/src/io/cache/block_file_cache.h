@@ -22,11 +22,14 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
 #include "io/cache/file_cache_storage.h"
+#include "io/cache/frequency_sketch.h"
 
 namespace doris::io {
 
@@ -35,6 +38,7 @@ concept IsXLock = std::same_as<Lock, std::lock_guard<std::mutex>> ||
                   std::same_as<Lock, std::unique_lock<std::mutex>>;
 
 class FSFileCacheStorage;
+struct FileCacheShardGroup;
 
 // The BlockFileCache is responsible for the management of the blocks
 // The current strategies are lru and ttl.
@@ -60,6 +64,10 @@ public:
         if (_cache_background_thread.joinable()) {
             _cache_background_thread.join();
         }
+        // Nothing changes the cache any more, the next init can skip the directories.
+        if (_storage && _lazy_open_done) {
+            _storage->checkpoint(this, true);
+        }
     }
 
     /// Restore cache from local filesystem.
@@ -68,6 +76,22 @@ public:
     /// Cache capacity in bytes.
     [[nodiscard]] size_t capacity() const { return _capacity; }
 
+    // Makes the cache a shard of `group`, must be called before `initialize`.
+    void set_shard_group(std::shared_ptr<FileCacheShardGroup> group, size_t shard_idx) {
+        _shard_group = std::move(group);
+        _shard_idx = shard_idx;
+    }
+
+    // Changes the capacity, the queues keep their proportion. If the cache shrinks, the
+    // blocks beyond the new capacity are evicted by the next reservations.
+    void reset_capacity(size_t new_capacity);
+
+    [[nodiscard]] size_t get_cur_cache_size() const;
+
+    [[nodiscard]] size_t get_total_evict_size() const {
+        return _total_evict_size_metrics->get_value();
+    }
+
     // try to release all releasable block
     // it maybe hang the io/system
     size_t try_release();
@@ -382,9 +406,18 @@ private:
 
     bool is_overflow(size_t removed_size, size_t need_size, size_t cur_cache_size) const;
 
+    static uint64_t admission_key(const UInt128Wrapper& hash, size_t offset) {
+        return KeyHash()(hash) * 31 + offset;
+    }
+
+    // TinyLFU: if the queue of the block has to evict, only admit the block when it is more
+    // frequent than the victim at the head of the queue.
+    bool admit(const UInt128Wrapper& hash, const CacheContext& context, size_t offset,
+               size_t size, std::lock_guard<std::mutex>& cache_lock);
+
     // info
     std::string _cache_base_path;
-    size_t _capacity = 0;
+    std::atomic<size_t> _capacity = 0;
     size_t _max_file_block_size = 0;
     size_t _max_query_cache_size = 0;
 
@@ -399,6 +432,8 @@ private:
     // disk space or inode is less than the specified value
     bool _disk_resource_limit_mode {false};
     bool _is_initialized {false};
+    std::shared_ptr<FileCacheShardGroup> _shard_group;
+    size_t _shard_idx = 0;
 
     // strategy
     using FileBlocksByOffset = std::map<size_t, FileBlockCell>;
@@ -418,10 +453,14 @@ private:
     LRUQueue _index_queue;
     LRUQueue _normal_queue;
     LRUQueue _disposable_queue;
+    // Set if the admission policy is tinylfu, accessed with the cache lock.
+    std::unique_ptr<FrequencySketch> _admission_sketch;
 
     // metrics
     size_t _num_read_blocks = 0;
     size_t _num_hit_blocks = 0;
+    size_t _num_read_blocks_last_report = 0;
+    size_t _num_hit_blocks_last_report = 0;
     size_t _num_removed_blocks = 0;
     std::shared_ptr<bvar::Status<size_t>> _cur_cache_size_metrics;
     std::shared_ptr<bvar::Status<size_t>> _cur_ttl_cache_size_metrics;
@@ -433,6 +472,33 @@ private:
     std::shared_ptr<bvar::Status<size_t>> _cur_disposable_queue_cache_size_metrics;
     std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _queue_evict_size_metrics;
     std::shared_ptr<bvar::Adder<size_t>> _total_evict_size_metrics;
+    // The hit ratios are named by the admission policy, so the policies could be compared.
+    std::shared_ptr<bvar::Status<double>> _hit_ratio_metrics;
+    std::shared_ptr<bvar::Status<double>> _recent_hit_ratio_metrics;
+    std::shared_ptr<bvar::Adder<size_t>> _admission_reject_num_metrics;
+};
+
+// The shards of one file cache path, a key always belongs to the same shard. The shards
+// share the capacity of the path, the background thread of the first shard moves capacity
+// to the shards with more demand from time to time.
+struct FileCacheShardGroup {
+    FileCacheShardGroup(std::string base_path_, size_t total_capacity_)
+            : base_path(std::move(base_path_)), total_capacity(total_capacity_) {}
+
+    BlockFileCache* get_shard(const UInt128Wrapper& hash) const {
+        // The low bits of the hash may already be used to choose the path.
+        return shards[(KeyHash()(hash) >> 16) % shards.size()];
+    }
+
+    void rebalance();
+
+    const std::string base_path;
+    const size_t total_capacity;
+    std::vector<BlockFileCache*> shards;
+
+    // Only accessed by the rebalancing thread.
+    std::vector<size_t> last_evict_sizes;
+    int64_t last_rebalance_time = 0;
 };
 
 } // namespace doris::io
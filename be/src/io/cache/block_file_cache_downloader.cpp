@@ -180,6 +180,7 @@ void FileCacheBlockDownloader::download_file_cache_block(
                 .ctx =
                         {
                                 .is_index_data = meta.cache_type() == ::doris::FileCacheType::INDEX,
+                                .is_warmup = true,
                                 .expiration_time = meta.expiration_time(),
                         },
                 .download_done = std::move(download_done),
@@ -20,6 +20,7 @@
 
 #include "io/cache/block_file_cache_factory.h"
 
+#include <fmt/format.h>
 #include <glog/logging.h>
 #if defined(__APPLE__)
 #include <sys/mount.h>
@@ -28,6 +29,7 @@
 #endif
 
 #include <algorithm>
+#include <filesystem>
 #include <ostream>
 #include <utility>
 
@@ -56,7 +58,11 @@ size_t FileCacheFactory::try_release() {
 size_t FileCacheFactory::try_release(const std::string& base_path) {
     auto iter = _path_to_cache.find(base_path);
     if (iter != _path_to_cache.end()) {
-        return iter->second->try_release();
+        size_t elements = 0;
+        for (auto* shard : iter->second->shards) {
+            elements += shard->try_release();
+        }
+        return elements;
     }
     return 0;
 }
@@ -90,11 +96,42 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
         file_cache_settings =
                 get_file_cache_settings(disk_capacity, file_cache_settings.max_query_cache_size);
     }
-    auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
-    RETURN_IF_ERROR(cache->initialize());
-    _path_to_cache[cache_base_path] = cache.get();
-    _caches.push_back(std::move(cache));
-    LOG(INFO) << "[FileCache] path: " << cache_base_path
+    auto shard_group =
+            std::make_shared<FileCacheShardGroup>(cache_base_path, file_cache_settings.capacity);
+    size_t shard_num = std::max(config::file_cache_shard_num, 1);
+    if (shard_num == 1) {
+        auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
+        RETURN_IF_ERROR(cache->initialize());
+        shard_group->shards.push_back(cache.get());
+        _caches.push_back(std::move(cache));
+    } else {
+        // Every shard takes an even share of the capacity and the query limit, with the same
+        // proportion of the queues, so the quota of every cache type holds for the path.
+        auto shard_settings = file_cache_settings;
+        shard_settings.capacity = file_cache_settings.capacity / shard_num;
+        shard_settings.max_query_cache_size = file_cache_settings.max_query_cache_size / shard_num;
+        shard_settings.disposable_queue_size =
+                file_cache_settings.disposable_queue_size / shard_num;
+        shard_settings.index_queue_size = file_cache_settings.index_queue_size / shard_num;
+        shard_settings.query_queue_size = shard_settings.capacity -
+                                          shard_settings.disposable_queue_size -
+                                          shard_settings.index_queue_size;
+        for (size_t i = 0; i < shard_num; ++i) {
+            auto shard_path = (std::filesystem::path(cache_base_path) / fmt::format("shard_{}", i))
+                                      .native();
+            RETURN_IF_ERROR(fs->create_directory(shard_path));
+            auto cache = std::make_unique<BlockFileCache>(shard_path, shard_settings);
+            cache->set_shard_group(shard_group, i);
+            shard_group->shards.push_back(cache.get());
+            _caches.push_back(std::move(cache));
+        }
+        for (auto* shard : shard_group->shards) {
+            RETURN_IF_ERROR(shard->initialize());
+        }
+    }
+    _path_to_cache[cache_base_path] = shard_group.get();
+    _shard_groups.push_back(std::move(shard_group));
+    LOG(INFO) << "[FileCache] path: " << cache_base_path << " shard_num: " << shard_num
               << " total_size: " << file_cache_settings.capacity
               << " disk_total_size: " << disk_capacity;
     _capacity += file_cache_settings.capacity;
@@ -102,7 +139,7 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
 }
 
 BlockFileCache* FileCacheFactory::get_by_path(const UInt128Wrapper& key) {
-    return _caches[KeyHash()(key) % _caches.size()].get();
+    return _shard_groups[KeyHash()(key) % _shard_groups.size()]->get_shard(key);
 }
 
 BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path) {
@@ -110,7 +147,17 @@ BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path
     if (iter == _path_to_cache.end()) {
         return nullptr;
     } else {
-        return iter->second;
+        return iter->second->shards.front();
+    }
+}
+
+BlockFileCache* FileCacheFactory::get_by_path(const std::string& cache_base_path,
+                                              const UInt128Wrapper& hash) {
+    auto iter = _path_to_cache.find(cache_base_path);
+    if (iter == _path_to_cache.end()) {
+        return nullptr;
+    } else {
+        return iter->second->get_shard(hash);
     }
 }
 
@@ -56,7 +56,10 @@ public:
     [[nodiscard]] size_t get_cache_instance_size() const { return _caches.size(); }
 
     BlockFileCache* get_by_path(const UInt128Wrapper& hash);
+    // Returns the first shard of the path.
     BlockFileCache* get_by_path(const std::string& cache_base_path);
+    // Returns the shard of the path which `hash` belongs to.
+    BlockFileCache* get_by_path(const std::string& cache_base_path, const UInt128Wrapper& hash);
     std::vector<BlockFileCache::QueryFileCacheContextHolderPtr> get_query_context_holders(
             const TUniqueId& query_id);
 
@@ -75,8 +78,10 @@ public:
     FileCacheFactory(const FileCacheFactory&) = delete;
 
 private:
+    // All the shards of all the paths.
     std::vector<std::unique_ptr<BlockFileCache>> _caches;
-    std::unordered_map<std::string, BlockFileCache*> _path_to_cache;
+    std::vector<std::shared_ptr<FileCacheShardGroup>> _shard_groups;
+    std::unordered_map<std::string, FileCacheShardGroup*> _path_to_cache;
     size_t _capacity = 0;
     std::atomic_size_t _next_index {0}; // use for round-robin
 };
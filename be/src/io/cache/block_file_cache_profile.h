@@ -82,6 +82,7 @@ struct FileCacheProfileReporter {
     RuntimeProfile::Counter* write_cache_io_timer = nullptr;
     RuntimeProfile::Counter* bytes_write_into_cache = nullptr;
     RuntimeProfile::Counter* num_skip_cache_io_total = nullptr;
+    RuntimeProfile::Counter* num_parallel_remote_read_parts = nullptr;
 
     FileCacheProfileReporter(RuntimeProfile* profile) {
         static const char* cache_profile = "FileCache";
@@ -98,6 +99,8 @@ struct FileCacheProfileReporter {
                                                               TUnit::BYTES, cache_profile, 1);
         num_skip_cache_io_total = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "NumSkipCacheIOTotal",
                                                                TUnit::UNIT, cache_profile, 1);
+        num_parallel_remote_read_parts = ADD_CHILD_COUNTER_WITH_LEVEL(
+                profile, "NumParallelRemoteReadParts", TUnit::UNIT, cache_profile, 1);
         bytes_scanned_from_cache = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "BytesScannedFromCache",
                                                                 TUnit::BYTES, cache_profile, 1);
         bytes_scanned_from_remote = ADD_CHILD_COUNTER_WITH_LEVEL(profile, "BytesScannedFromRemote",
@@ -112,6 +115,7 @@ struct FileCacheProfileReporter {
         COUNTER_UPDATE(write_cache_io_timer, statistics->write_cache_io_timer);
         COUNTER_UPDATE(bytes_write_into_cache, statistics->bytes_write_into_cache);
         COUNTER_UPDATE(num_skip_cache_io_total, statistics->num_skip_cache_io_total);
+        COUNTER_UPDATE(num_parallel_remote_read_parts, statistics->num_parallel_remote_read_parts);
         COUNTER_UPDATE(bytes_scanned_from_cache, statistics->bytes_read_from_local);
         COUNTER_UPDATE(bytes_scanned_from_remote, statistics->bytes_read_from_remote);
     }
@@ -33,6 +33,8 @@
 #include "io/cache/block_file_cache_factory.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/cache/file_block.h"
+#include "io/cache/peer_file_cache.h"
+#include "io/cache/remote_read_single_flight.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
@@ -63,7 +65,7 @@ CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader
             _cache = FileCacheFactory::instance()->get_by_path(_cache_hash);
         } else {
             // from query session variable: file_cache_base_path
-            _cache = FileCacheFactory::instance()->get_by_path(opts.cache_base_path);
+            _cache = FileCacheFactory::instance()->get_by_path(opts.cache_base_path, _cache_hash);
             if (_cache == nullptr) {
                 LOG(WARNING) << "Can't get cache from base path: " << opts.cache_base_path
                              << ", using random instead.";
@@ -203,19 +205,18 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
         empty_start = empty_blocks.front()->range().left;
         empty_end = empty_blocks.back()->range().right;
         size_t size = empty_end - empty_start + 1;
-        std::unique_ptr<char[]> buffer(new char[size]);
+        RemoteReadSingleFlight::FlightSPtr flight;
         {
-            s3_read_counter << 1;
             SCOPED_RAW_TIMER(&stats.remote_read_timer);
-            RETURN_IF_ERROR(_remote_file_reader->read_at(empty_start, Slice(buffer.get(), size),
-                                                         &size, io_ctx));
+            RETURN_IF_ERROR(_read_remote(empty_start, size, io_ctx, &flight));
         }
+        const char* buffer = flight->data(empty_start);
         for (auto& block : empty_blocks) {
             if (block->state() == FileBlock::State::SKIP_CACHE) {
                 continue;
             }
             SCOPED_RAW_TIMER(&stats.local_write_timer);
-            char* cur_ptr = buffer.get() + block->range().left - empty_start;
+            const char* cur_ptr = buffer + block->range().left - empty_start;
             size_t block_size = block->range().size();
             Status st = block->append(Slice(cur_ptr, block_size));
             if (st.ok()) {
@@ -234,7 +235,7 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
             size_t copy_left_offset = offset < empty_start ? empty_start : offset;
             size_t copy_right_offset = right_offset < empty_end ? right_offset : empty_end;
             char* dst = result.data + (copy_left_offset - offset);
-            char* src = buffer.get() + (copy_left_offset - empty_start);
+            const char* src = buffer + (copy_left_offset - empty_start);
             size_t copy_size = copy_right_offset - copy_left_offset + 1;
             memcpy(dst, src, copy_size);
         }
@@ -290,14 +291,16 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
                                  file_offset);
             }
             if (!st || block_state != FileBlock::State::DOWNLOADED) {
-                size_t bytes_read {0};
+                // Read the whole block, so that the other readers falling back on the same
+                // block share the read.
+                RemoteReadSingleFlight::FlightSPtr flight;
                 stats.hit_cache = false;
-                s3_read_counter << 1;
-                SCOPED_RAW_TIMER(&stats.remote_read_timer);
-                RETURN_IF_ERROR(_remote_file_reader->read_at(
-                        current_offset, Slice(result.data + (current_offset - offset), read_size),
-                        &bytes_read));
-                DCHECK(bytes_read == read_size);
+                {
+                    SCOPED_RAW_TIMER(&stats.remote_read_timer);
+                    RETURN_IF_ERROR(_read_remote(left, right - left + 1, io_ctx, &flight));
+                }
+                memcpy(result.data + (current_offset - offset), flight->data(current_offset),
+                       read_size);
             }
         }
         *bytes_read += read_size;
@@ -307,6 +310,25 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
     return Status::OK();
 }
 
+Status CachedRemoteFileReader::_read_remote(size_t offset, size_t size, const IOContext* io_ctx,
+                                            RemoteReadSingleFlight::FlightSPtr* flight) {
+    auto read_func = [&](Slice slice) {
+        // the files of doris tables are immutable, so a range cached by a peer is up to date
+        if (_is_doris_table && PeerFileCache::enabled() &&
+            PeerFileCache::fetch(_cache_hash, offset, slice).ok()) {
+            return Status::OK();
+        }
+        s3_read_counter << 1;
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(_remote_file_reader->read_at(offset, slice, &bytes_read, io_ctx));
+        DCHECK(bytes_read == slice.size);
+        return Status::OK();
+    };
+    bool coalesced = false;
+    return RemoteReadSingleFlight::instance()->read(_cache_hash, offset, size, read_func, flight,
+                                                    &coalesced);
+}
+
 void CachedRemoteFileReader::_update_state(const ReadStatistics& read_stats,
                                            FileCacheStatistics* statis) const {
     if (statis == nullptr) {
@@ -29,6 +29,7 @@
 #include "io/cache/block_file_cache.h"
 #include "io/cache/file_block.h"
 #include "io/cache/file_cache_common.h"
+#include "io/cache/remote_read_single_flight.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "io/fs/file_system.h"
@@ -64,6 +65,10 @@ protected:
 
 private:
     void _insert_file_reader(FileBlockSPtr file_block);
+    // Read [offset, offset + size) from the remote file, shared with the concurrent readers
+    // of the same range.
+    Status _read_remote(size_t offset, size_t size, const IOContext* io_ctx,
+                        RemoteReadSingleFlight::FlightSPtr* flight);
     bool _is_doris_table;
     FileReaderSPtr _remote_file_reader;
     UInt128Wrapper _cache_hash;
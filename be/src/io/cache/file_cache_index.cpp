@@ -0,0 +1,304 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/file_cache_index.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "common/logging.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/local_file_system.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace doris::io {
+
+static constexpr char SNAPSHOT_MAGIC[4] = {'D', 'F', 'C', 'I'};
+static constexpr uint32_t INDEX_VERSION = 1;
+// magic, version, clean flag, first log seq and the crc32c of them.
+static constexpr size_t SNAPSHOT_HEADER_SIZE = 4 + 4 + 1 + 8 + 4;
+static constexpr std::string_view LOG_FILE_PREFIX = "index_log_";
+
+FileCacheIndex::FileCacheIndex(std::string base_path) : _base_path(std::move(base_path)) {}
+
+FileCacheIndex::~FileCacheIndex() {
+    if (_log_writer) {
+        static_cast<void>(_log_writer->close());
+    }
+}
+
+std::string FileCacheIndex::_snapshot_path() const {
+    return Path(_base_path) / "index_snapshot";
+}
+
+std::string FileCacheIndex::_log_path(uint64_t seq) const {
+    return Path(_base_path) / (std::string(LOG_FILE_PREFIX) + std::to_string(seq));
+}
+
+void FileCacheIndex::_encode(Op op, const UInt128Wrapper& hash, size_t offset, size_t size,
+                             uint64_t expiration_time, FileCacheType type, uint8_t* buf) {
+    encode_fixed8(buf, static_cast<uint8_t>(op));
+    encode_fixed128_le(buf + 1, hash.value_);
+    encode_fixed64_le(buf + 17, offset);
+    encode_fixed64_le(buf + 25, size);
+    encode_fixed64_le(buf + 33, expiration_time);
+    encode_fixed8(buf + 41, static_cast<uint8_t>(type));
+    encode_fixed32_le(buf + 42, crc32c::Value(reinterpret_cast<const char*>(buf), 42));
+}
+
+size_t FileCacheIndex::_replay(std::string_view data, Entries* entries) {
+    size_t num_records = 0;
+    for (size_t pos = 0; pos + RECORD_SIZE <= data.size(); pos += RECORD_SIZE) {
+        const auto* buf = reinterpret_cast<const uint8_t*>(data.data() + pos);
+        if (crc32c::Value(data.data() + pos, 42) != decode_fixed32_le(buf + 42) ||
+            decode_fixed8(buf + 41) > static_cast<uint8_t>(FileCacheType::TTL)) {
+            break;
+        }
+        UInt128Wrapper hash(decode_fixed128_le(buf + 1));
+        size_t offset = decode_fixed64_le(buf + 17);
+        size_t size = decode_fixed64_le(buf + 25);
+        uint64_t expiration_time = decode_fixed64_le(buf + 33);
+        auto type = static_cast<FileCacheType>(decode_fixed8(buf + 41));
+        auto iter = entries->find(hash);
+        switch (static_cast<Op>(decode_fixed8(buf))) {
+        case Op::ADD:
+            (*entries)[hash][offset] = Entry {size, expiration_time, type};
+            break;
+        case Op::REMOVE:
+            if (iter != entries->end()) {
+                iter->second.erase(offset);
+                if (iter->second.empty()) {
+                    entries->erase(iter);
+                }
+            }
+            break;
+        case Op::CHANGE_TYPE:
+            if (iter != entries->end()) {
+                if (auto entry = iter->second.find(offset); entry != iter->second.end()) {
+                    entry->second.type = type;
+                }
+            }
+            break;
+        case Op::CHANGE_EXPIRATION:
+            if (iter != entries->end()) {
+                for (auto& [_, entry] : iter->second) {
+                    entry.expiration_time = expiration_time;
+                }
+            }
+            break;
+        default:
+            return num_records;
+        }
+        ++num_records;
+    }
+    return num_records;
+}
+
+Status FileCacheIndex::_read_file(const std::string& path, std::string* data) {
+    const auto& fs = global_local_filesystem();
+    int64_t file_size = 0;
+    RETURN_IF_ERROR(fs->file_size(path, &file_size));
+    data->resize(file_size);
+    FileReaderSPtr reader;
+    RETURN_IF_ERROR(fs->open_file(path, &reader));
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(reader->read_at(0, Slice(data->data(), file_size), &bytes_read));
+    data->resize(bytes_read);
+    return reader->close();
+}
+
+Status FileCacheIndex::load(Entries* entries, bool* clean) {
+    entries->clear();
+    *clean = false;
+    const auto& fs = global_local_filesystem();
+    std::vector<FileInfo> files;
+    bool exists = false;
+    RETURN_IF_ERROR(fs->list(_base_path, true, &files, &exists));
+    std::vector<uint64_t> log_seqs;
+    bool snapshot_exists = false;
+    for (auto& file : files) {
+        if (file.file_name == "index_snapshot") {
+            snapshot_exists = true;
+        } else if (file.file_name.starts_with(LOG_FILE_PREFIX)) {
+            try {
+                log_seqs.push_back(std::stoull(file.file_name.substr(LOG_FILE_PREFIX.size())));
+            } catch (...) {
+                LOG(WARNING) << "unknown file cache index log " << file.file_name;
+            }
+        }
+    }
+    std::sort(log_seqs.begin(), log_seqs.end());
+
+    bool snapshot_clean = false;
+    if (snapshot_exists) {
+        std::string data;
+        RETURN_IF_ERROR(_read_file(_snapshot_path(), &data));
+        const auto* buf = reinterpret_cast<const uint8_t*>(data.data());
+        if (data.size() < SNAPSHOT_HEADER_SIZE || memcmp(buf, SNAPSHOT_MAGIC, 4) != 0 ||
+            decode_fixed32_le(buf + 4) != INDEX_VERSION ||
+            crc32c::Value(data.data(), SNAPSHOT_HEADER_SIZE - 4) !=
+                    decode_fixed32_le(buf + SNAPSHOT_HEADER_SIZE - 4)) {
+            LOG(WARNING) << "invalid file cache index snapshot " << _snapshot_path();
+        } else {
+            std::string_view records(data.data() + SNAPSHOT_HEADER_SIZE,
+                                     data.size() - SNAPSHOT_HEADER_SIZE);
+            size_t num_records = _replay(records, entries);
+            if (num_records * RECORD_SIZE != records.size()) {
+                // The snapshot is synced before it is renamed, it should not happen.
+                LOG(WARNING) << "corrupted file cache index snapshot " << _snapshot_path()
+                             << ", only " << num_records << " records are loaded";
+            } else {
+                _has_snapshot = true;
+                snapshot_clean = decode_fixed8(buf + 8) == 1;
+                _first_log_seq = decode_fixed64_le(buf + 9);
+            }
+        }
+    }
+    if (!_has_snapshot) {
+        // Keep what the logs tell.
+        _first_log_seq = log_seqs.empty() ? 0 : log_seqs.front();
+    }
+
+    size_t num_log_records = 0;
+    for (uint64_t seq : log_seqs) {
+        _log_seq = std::max(_log_seq, seq);
+        if (seq < _first_log_seq) {
+            // A crash after the snapshot was written but before the log was removed.
+            static_cast<void>(fs->delete_file(_log_path(seq)));
+            continue;
+        }
+        std::string data;
+        RETURN_IF_ERROR(_read_file(_log_path(seq), &data));
+        size_t num_records = _replay(data, entries);
+        if (num_records * RECORD_SIZE != data.size()) {
+            LOG(INFO) << "file cache index log " << _log_path(seq) << " has a torn tail, "
+                      << num_records << " records are loaded";
+        }
+        num_log_records += num_records;
+    }
+    _log_seq = std::max(_log_seq, _first_log_seq);
+    *clean = snapshot_clean && num_log_records == 0;
+    LOG(INFO) << "load file cache index of " << _base_path << ", keys=" << entries->size()
+              << ", log records=" << num_log_records << ", clean=" << *clean;
+    return Status::OK();
+}
+
+Status FileCacheIndex::open() {
+    std::lock_guard lock(_mtx);
+    return _rotate_log();
+}
+
+Status FileCacheIndex::_rotate_log() {
+    if (_log_writer) {
+        auto st = _log_writer->close();
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to close file cache index log: " << st;
+        }
+        _log_writer.reset();
+    }
+    ++_log_seq;
+    FileWriterOptions opts {.sync_file_data = false};
+    return global_local_filesystem()->create_file(_log_path(_log_seq), &_log_writer, &opts);
+}
+
+void FileCacheIndex::_append(Op op, const UInt128Wrapper& hash, size_t offset, size_t size,
+                             uint64_t expiration_time, FileCacheType type) {
+    uint8_t buf[RECORD_SIZE];
+    _encode(op, hash, offset, size, expiration_time, type, buf);
+    std::lock_guard lock(_mtx);
+    if (!_log_writer) {
+        return;
+    }
+    // A lost record is either found by the reconciliation or the verification on access.
+    auto st = _log_writer->append(Slice(buf, RECORD_SIZE));
+    if (!st.ok()) {
+        LOG_EVERY_N(WARNING, 100) << "failed to append file cache index log: " << st;
+    }
+}
+
+void FileCacheIndex::log_add(const UInt128Wrapper& hash, size_t offset, size_t size,
+                             uint64_t expiration_time, FileCacheType type) {
+    _append(Op::ADD, hash, offset, size, expiration_time, type);
+}
+
+void FileCacheIndex::log_remove(const UInt128Wrapper& hash, size_t offset) {
+    _append(Op::REMOVE, hash, offset, 0, 0, FileCacheType::NORMAL);
+}
+
+void FileCacheIndex::log_change_type(const UInt128Wrapper& hash, size_t offset,
+                                     FileCacheType type) {
+    _append(Op::CHANGE_TYPE, hash, offset, 0, 0, type);
+}
+
+void FileCacheIndex::log_change_expiration(const UInt128Wrapper& hash, uint64_t expiration_time) {
+    _append(Op::CHANGE_EXPIRATION, hash, 0, 0, expiration_time, FileCacheType::NORMAL);
+}
+
+Status FileCacheIndex::checkpoint(const CaptureFunc& capture, bool clean) {
+    std::lock_guard checkpoint_lock(_checkpoint_mtx);
+    uint64_t first_log_seq = 0;
+    {
+        std::lock_guard lock(_mtx);
+        RETURN_IF_ERROR(_rotate_log());
+        first_log_seq = clean ? _log_seq : _log_seq - 1;
+    }
+    Entries entries;
+    capture(&entries);
+
+    size_t num_records = 0;
+    for (auto& [_, blocks] : entries) {
+        num_records += blocks.size();
+    }
+    std::string data(SNAPSHOT_HEADER_SIZE + num_records * RECORD_SIZE, '\0');
+    auto* buf = reinterpret_cast<uint8_t*>(data.data());
+    memcpy(buf, SNAPSHOT_MAGIC, 4);
+    encode_fixed32_le(buf + 4, INDEX_VERSION);
+    encode_fixed8(buf + 8, clean ? 1 : 0);
+    encode_fixed64_le(buf + 9, first_log_seq);
+    encode_fixed32_le(buf + SNAPSHOT_HEADER_SIZE - 4,
+                      crc32c::Value(data.data(), SNAPSHOT_HEADER_SIZE - 4));
+    auto* record = buf + SNAPSHOT_HEADER_SIZE;
+    for (auto& [hash, blocks] : entries) {
+        for (auto& [offset, entry] : blocks) {
+            _encode(Op::ADD, hash, offset, entry.size, entry.expiration_time, entry.type, record);
+            record += RECORD_SIZE;
+        }
+    }
+
+    const auto& fs = global_local_filesystem();
+    std::string tmp_path = _snapshot_path() + ".tmp";
+    FileWriterPtr writer;
+    FileWriterOptions opts {.sync_file_data = true};
+    RETURN_IF_ERROR(fs->create_file(tmp_path, &writer, &opts));
+    RETURN_IF_ERROR(writer->append(Slice(data)));
+    RETURN_IF_ERROR(writer->close());
+    RETURN_IF_ERROR(fs->rename(tmp_path, _snapshot_path()));
+
+    for (uint64_t seq = _first_log_seq; seq < first_log_seq; ++seq) {
+        RETURN_IF_ERROR(fs->delete_file(_log_path(seq)));
+    }
+    _first_log_seq = first_log_seq;
+    LOG(INFO) << "checkpoint file cache index of " << _base_path << ", keys=" << entries.size()
+              << ", blocks=" << num_records << ", clean=" << clean;
+    return Status::OK();
+}
+
+} // namespace doris::io
@@ -0,0 +1,121 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "common/status.h"
+#include "io/cache/file_cache_common.h"
+#include "io/fs/file_writer.h"
+
+namespace doris::io {
+
+// A persistent index of the downloaded blocks of a cache path, it lets a restart load the
+// blocks without walking all the cache directories. The index is a snapshot of all blocks
+// written by `checkpoint` and the logs of the changes after it, every checkpoint starts a
+// new log `index_log_<seq>` and the snapshot records the first log it does not cover.
+// The records are checksummed, a torn tail of a log after a crash is ignored. The logs are
+// not synced on every change, so the index may lag behind the directories after a crash;
+// the caller verifies the blocks on first access and reconciles with the directories if
+// the index is not clean.
+class FileCacheIndex {
+public:
+    struct Entry {
+        size_t size;
+        uint64_t expiration_time;
+        FileCacheType type;
+    };
+    using Entries = std::unordered_map<UInt128Wrapper, std::map<size_t, Entry>, KeyHash>;
+    // Fills the blocks to snapshot.
+    using CaptureFunc = std::function<void(Entries*)>;
+
+    explicit FileCacheIndex(std::string base_path);
+
+    ~FileCacheIndex();
+
+    // Loads the snapshot and replays the logs after it. `clean` is set if the snapshot was
+    // written by a clean shutdown and nothing changed after it.
+    Status load(Entries* entries, bool* clean);
+
+    // Starts a new log to append the changes, must be called after `load`.
+    Status open();
+
+    // Whether `load` found a valid snapshot.
+    bool has_snapshot() const { return _has_snapshot; }
+
+    void log_add(const UInt128Wrapper& hash, size_t offset, size_t size, uint64_t expiration_time,
+                 FileCacheType type);
+    void log_remove(const UInt128Wrapper& hash, size_t offset);
+    void log_change_type(const UInt128Wrapper& hash, size_t offset, FileCacheType type);
+    // Changes the expiration time of all blocks of `hash`.
+    void log_change_expiration(const UInt128Wrapper& hash, uint64_t expiration_time);
+
+    // Starts a new log, then writes the blocks returned by `capture` as the new snapshot and
+    // removes the logs covered by it. A block may be logged right before the new log starts
+    // but captured as not downloaded, so the snapshot only covers the log before the last
+    // one, unless `clean` is set which means nothing changes while checkpointing.
+    Status checkpoint(const CaptureFunc& capture, bool clean);
+
+    static constexpr size_t RECORD_SIZE = 46;
+
+private:
+    enum class Op : uint8_t {
+        ADD = 1,
+        REMOVE = 2,
+        CHANGE_TYPE = 3,
+        CHANGE_EXPIRATION = 4,
+    };
+
+    void _append(Op op, const UInt128Wrapper& hash, size_t offset, size_t size,
+                 uint64_t expiration_time, FileCacheType type);
+
+    static void _encode(Op op, const UInt128Wrapper& hash, size_t offset, size_t size,
+                        uint64_t expiration_time, FileCacheType type, uint8_t* buf);
+
+    // Applies the records in `data` till the first corrupted one, returns the number of
+    // applied records.
+    static size_t _replay(std::string_view data, Entries* entries);
+
+    static Status _read_file(const std::string& path, std::string* data);
+
+    // Closes the current log and creates the next one, requires `_mtx`.
+    Status _rotate_log();
+
+    std::string _snapshot_path() const;
+    std::string _log_path(uint64_t seq) const;
+
+    const std::string _base_path;
+    bool _has_snapshot = false;
+    std::mutex _mtx;
+    FileWriterPtr _log_writer;
+    uint64_t _log_seq = 0;
+    // The logs before it are covered by the snapshot and removed.
+    uint64_t _first_log_seq = 0;
+    // Only one checkpoint at a time.
+    std::mutex _checkpoint_mtx;
+};
+
+} // namespace doris::io
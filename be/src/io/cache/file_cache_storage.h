@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
+
 #include "io/cache/file_cache_common.h"
 #include "util/slice.h"
 
@@ -44,6 +47,15 @@ public:
     // use when lazy load cache
     virtual void load_blocks_directly_unlocked(BlockFileCache* _mgr, const FileCacheKey& key,
                                                std::lock_guard<std::mutex>& cache_lock) {}
+    // use when the blocks are loaded from a persistent index, returns the offsets of the
+    // blocks of the key whose data is missing, only checks once for every key
+    virtual std::vector<size_t> get_missing_blocks_unlocked(
+            BlockFileCache* _mgr, const UInt128Wrapper& hash,
+            std::lock_guard<std::mutex>& cache_lock) {
+        return {};
+    }
+    // persist the blocks meta to speed up the next init, `clean` means nothing is changing
+    virtual void checkpoint(BlockFileCache* _mgr, bool clean) {}
 };
 
 } // namespace doris::io
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/frequency_sketch.h"
+
+#include <algorithm>
+
+namespace doris::io {
+
+static constexpr size_t MAX_SKETCH_WIDTH = 1 << 24;
+static constexpr uint64_t SEEDS[] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL,
+                                     0x9ae16a3b2f90404fULL, 0xcbf29ce484222325ULL};
+
+FrequencySketch::FrequencySketch(size_t num_counters) {
+    size_t width = 1;
+    while (width < std::min(std::max<size_t>(num_counters, 16), MAX_SKETCH_WIDTH)) {
+        width <<= 1;
+    }
+    _mask = width - 1;
+    for (auto& row : _table) {
+        row.resize(width, 0);
+    }
+    _sample_size = width * 10;
+}
+
+size_t FrequencySketch::_index(uint64_t hash, int row) const {
+    uint64_t h = (hash + SEEDS[row]) * 0x9e3779b97f4a7c15ULL;
+    h ^= h >> 32;
+    return h & _mask;
+}
+
+void FrequencySketch::increment(uint64_t hash) {
+    bool added = false;
+    for (int i = 0; i < DEPTH; ++i) {
+        auto& counter = _table[i][_index(hash, i)];
+        if (counter < MAX_COUNT) {
+            counter++;
+            added = true;
+        }
+    }
+    if (added && ++_additions >= _sample_size) {
+        _reset();
+    }
+}
+
+uint8_t FrequencySketch::estimate(uint64_t hash) const {
+    uint8_t count = MAX_COUNT;
+    for (int i = 0; i < DEPTH; ++i) {
+        count = std::min(count, _table[i][_index(hash, i)]);
+    }
+    return count;
+}
+
+void FrequencySketch::_reset() {
+    for (auto& row : _table) {
+        for (auto& counter : row) {
+            counter >>= 1;
+        }
+    }
+    _additions /= 2;
+}
+
+} // namespace doris::io
@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace doris::io {
+
+// A count-min sketch of 4-bit counters used as the TinyLFU admission filter of the file
+// cache. It estimates how often a block has been accessed recently: all counters are halved
+// after `10 * width` increments, so the old accesses fade out.
+class FrequencySketch {
+public:
+    explicit FrequencySketch(size_t num_counters);
+
+    void increment(uint64_t hash);
+
+    // The estimated access count of `hash`, saturated at MAX_COUNT.
+    uint8_t estimate(uint64_t hash) const;
+
+    size_t width() const { return _mask + 1; }
+
+    static constexpr uint8_t MAX_COUNT = 15;
+
+private:
+    size_t _index(uint64_t hash, int row) const;
+
+    void _reset();
+
+    static constexpr int DEPTH = 4;
+
+    size_t _mask;
+    std::vector<uint8_t> _table[DEPTH];
+    size_t _additions = 0;
+    size_t _sample_size;
+};
+
+} // namespace doris::io
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <system_error>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -100,12 +101,37 @@ size_t FDCache::file_reader_cache_size() {
 
 Status FSFileCacheStorage::init(BlockFileCache* _mgr) {
     _cache_base_path = _mgr->_cache_base_path;
-    RETURN_IF_ERROR(rebuild_data_structure());
-    _cache_background_load_thread = std::thread([this, mgr = _mgr]() {
-        load_cache_info_into_memory(mgr);
-        mgr->_lazy_open_done = true;
-        LOG_INFO("FileCache {} lazy load done.", _cache_base_path);
-    });
+    FileCacheIndex::Entries entries;
+    bool clean = false;
+    if (config::enable_file_cache_persistent_index) {
+        _index = std::make_unique<FileCacheIndex>(_cache_base_path);
+        if (auto st = _index->load(&entries, &clean); !st.ok()) {
+            LOG_WARNING("failed to load file cache index of {}", _cache_base_path).error(st);
+            entries.clear();
+            clean = false;
+        }
+        RETURN_IF_ERROR(_index->open());
+    }
+    // The directories are rebuilt before the snapshot is written.
+    if (!_index || !_index->has_snapshot()) {
+        RETURN_IF_ERROR(rebuild_data_structure());
+    }
+    _cache_background_load_thread = std::thread(
+            [this, mgr = _mgr, entries = std::move(entries), clean]() {
+                if (!entries.empty()) {
+                    load_index_into_memory(mgr, entries);
+                    LOG_INFO("FileCache {} load index done, clean={}", _cache_base_path, clean);
+                }
+                // The index may miss some blocks if the last shutdown is not clean.
+                if (!clean) {
+                    load_cache_info_into_memory(mgr);
+                }
+                if (_index && !clean) {
+                    checkpoint(mgr, false);
+                }
+                mgr->_lazy_open_done = true;
+                LOG_INFO("FileCache {} lazy load done.", _cache_base_path);
+            });
     return Status::OK();
 }
 
@@ -147,7 +173,12 @@ Status FSFileCacheStorage::finalize(const FileCacheKey& key) {
     RETURN_IF_ERROR(file_writer->close());
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string true_file = get_path_in_local_cache(dir, key.offset, key.meta.type);
-    return fs->rename(file_writer->path(), true_file);
+    RETURN_IF_ERROR(fs->rename(file_writer->path(), true_file));
+    if (_index) {
+        _index->log_add(key.hash, key.offset, file_writer->bytes_appended(),
+                        key.meta.expiration_time, key.meta.type);
+    }
+    return Status::OK();
 }
 
 Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Slice buffer) {
@@ -170,6 +201,9 @@ Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string file = get_path_in_local_cache(dir, key.offset, key.meta.type);
     RETURN_IF_ERROR(fs->delete_file(file));
+    if (_index) {
+        _index->log_remove(key.hash, key.offset);
+    }
     std::vector<FileInfo> files;
     bool exists {false};
     RETURN_IF_ERROR(fs->list(dir, true, &files, &exists));
@@ -191,11 +225,17 @@ Status FSFileCacheStorage::change_key_meta(const FileCacheKey& key, const KeyMet
         if (!st.ok() && !st.is<ErrorCode::NOT_FOUND>()) {
             return st;
         }
+        if (_index) {
+            _index->log_change_expiration(key.hash, new_meta.expiration_time);
+        }
     } else if (key.meta.type != new_meta.type) {
         std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
         std::string original_file = get_path_in_local_cache(dir, key.offset, key.meta.type);
         std::string new_file = get_path_in_local_cache(dir, key.offset, new_meta.type);
         RETURN_IF_ERROR(fs->rename(original_file, new_file));
+        if (_index) {
+            _index->log_change_type(key.hash, key.offset, new_meta.type);
+        }
     }
     return Status::OK();
 }
@@ -569,6 +609,83 @@ void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, cons
     }
 }
 
+void FSFileCacheStorage::load_index_into_memory(BlockFileCache* mgr,
+                                                const FileCacheIndex::Entries& entries) {
+    size_t scan_length = 10000;
+    auto iter = entries.begin();
+    while (iter != entries.end()) {
+        std::lock_guard cache_lock(mgr->_mutex);
+        for (size_t num_blocks = 0; iter != entries.end() && num_blocks < scan_length; ++iter) {
+            const auto& [hash, blocks] = *iter;
+            // already loaded directly from the directory by a query
+            if (mgr->_files.contains(hash)) {
+                continue;
+            }
+            CacheContext context;
+            context.query_id = TUniqueId();
+            for (const auto& [offset, entry] : blocks) {
+                context.cache_type = entry.type;
+                context.expiration_time = entry.expiration_time;
+                mgr->add_cell(hash, context, offset, entry.size, FileBlock::State::DOWNLOADED,
+                              cache_lock);
+            }
+            num_blocks += blocks.size();
+            _unverified_keys.insert(hash);
+        }
+    }
+}
+
+std::vector<size_t> FSFileCacheStorage::get_missing_blocks_unlocked(
+        BlockFileCache* mgr, const UInt128Wrapper& hash,
+        std::lock_guard<std::mutex>& cache_lock) {
+    std::vector<size_t> missing_offsets;
+    if (_unverified_keys.erase(hash) == 0) {
+        return missing_offsets;
+    }
+    auto iter = mgr->_files.find(hash);
+    if (iter == mgr->_files.end() || iter->second.empty()) {
+        return missing_offsets;
+    }
+    std::string dir = get_path_in_local_cache(
+            hash, iter->second.begin()->second.file_block->expiration_time());
+    for (auto& [offset, cell] : iter->second) {
+        std::error_code ec;
+        auto file = get_path_in_local_cache(dir, offset, cell.file_block->cache_type());
+        if (!std::filesystem::exists(file, ec) && !ec) {
+            missing_offsets.push_back(offset);
+        }
+    }
+    if (!missing_offsets.empty()) {
+        LOG_WARNING("{} blocks in file cache index are missing", missing_offsets.size())
+                .tag("key", hash.to_string())
+                .tag("path", dir);
+    }
+    return missing_offsets;
+}
+
+void FSFileCacheStorage::checkpoint(BlockFileCache* mgr, bool clean) {
+    if (!_index) {
+        return;
+    }
+    auto capture = [mgr](FileCacheIndex::Entries* entries) {
+        std::lock_guard cache_lock(mgr->_mutex);
+        for (auto& [hash, blocks] : mgr->_files) {
+            for (auto& [offset, cell] : blocks) {
+                const auto& file_block = cell.file_block;
+                if (file_block->state() != FileBlock::State::DOWNLOADED) {
+                    continue;
+                }
+                (*entries)[hash][offset] = FileCacheIndex::Entry {file_block->range().size(),
+                                                                  file_block->expiration_time(),
+                                                                  file_block->cache_type()};
+            }
+        }
+    };
+    if (auto st = _index->checkpoint(capture, clean); !st.ok()) {
+        LOG_WARNING("failed to checkpoint file cache index of {}", _cache_base_path).error(st);
+    }
+}
+
 FSFileCacheStorage::~FSFileCacheStorage() {
     if (_cache_background_load_thread.joinable()) {
         _cache_background_load_thread.join();
@@ -20,8 +20,10 @@
 #include <memory>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_set>
 
 #include "io/cache/file_cache_common.h"
+#include "io/cache/file_cache_index.h"
 #include "io/cache/file_cache_storage.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
@@ -68,6 +70,10 @@ public:
     Status change_key_meta(const FileCacheKey& key, const KeyMeta& new_meta) override;
     void load_blocks_directly_unlocked(BlockFileCache* _mgr, const FileCacheKey& key,
                                        std::lock_guard<std::mutex>& cache_lock) override;
+    std::vector<size_t> get_missing_blocks_unlocked(
+            BlockFileCache* _mgr, const UInt128Wrapper& hash,
+            std::lock_guard<std::mutex>& cache_lock) override;
+    void checkpoint(BlockFileCache* _mgr, bool clean) override;
 
     [[nodiscard]] static std::string get_path_in_local_cache(const std::string& dir, size_t offset,
                                                              FileCacheType type,
@@ -87,6 +93,8 @@ private:
 
     void load_cache_info_into_memory(BlockFileCache* _mgr) const;
 
+    void load_index_into_memory(BlockFileCache* _mgr, const FileCacheIndex::Entries& entries);
+
     using FileWriterMapKey = std::pair<UInt128Wrapper, size_t>;
     struct FileWriterMapKeyHash {
         std::size_t operator()(const FileWriterMapKey& w) const {
@@ -106,6 +114,11 @@ private:
     // TODO(Lchangliang): use a more efficient data structure
     std::mutex _mtx;
     std::unordered_map<FileWriterMapKey, FileWriterPtr, FileWriterMapKeyHash> _key_to_writer;
+    // Only set if config::enable_file_cache_persistent_index is true.
+    std::unique_ptr<FileCacheIndex> _index;
+    // The keys loaded from the index whose files are not checked yet, protected by the
+    // cache lock of the manager.
+    std::unordered_set<UInt128Wrapper, KeyHash> _unverified_keys;
 };
 
 } // namespace doris::io
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/peer_file_cache.h"
+
+#include <bvar/bvar.h>
+#include <fmt/format.h>
+#include <glog/logging.h>
+#include <string.h>
+
+#include <algorithm>
+#include <cctype>
+#include <utility>
+
+#include "common/config.h"
+#include "gutil/strings/split.h"
+#include "gutil/strings/strip.h"
+#include "http/http_client.h"
+#include "io/cache/block_file_cache.h"
+#include "io/cache/block_file_cache_factory.h"
+#include "io/cache/file_block.h"
+#include "service/backend_options.h"
+#include "util/hash_util.hpp"
+#include "vec/common/hex.h"
+
+namespace doris::io {
+
+bvar::Adder<uint64_t> peer_fetch_hit_counter("file_cache_peer_fetch_hit");
+bvar::Adder<uint64_t> peer_fetch_miss_counter("file_cache_peer_fetch_miss");
+
+bool PeerFileCache::enabled() {
+    return !config::file_cache_peer_addresses.empty() &&
+           config::file_cache_peer_fetch_max_peers > 0;
+}
+
+std::vector<std::string> PeerFileCache::peers_of(const UInt128Wrapper& hash,
+                                                 const std::string& addresses,
+                                                 const std::string& self, size_t max_peers) {
+    // pair<weight, address>, the peers with the highest weights are tried
+    std::vector<std::pair<uint64_t, std::string>> peers;
+    std::vector<std::string> addresses_list =
+            strings::Split(addresses, ",", strings::SkipWhitespace());
+    for (auto& address : addresses_list) {
+        StripWhiteSpace(&address);
+        if (address.empty() || address == self) {
+            continue;
+        }
+        uint64_t weight = HashUtil::hash64(address.data(), static_cast<int32_t>(address.size()),
+                                           static_cast<uint64_t>(hash.value_));
+        weight = HashUtil::hash64(&weight, sizeof(weight),
+                                  static_cast<uint64_t>(hash.value_ >> 64));
+        peers.emplace_back(weight, std::move(address));
+    }
+    std::sort(peers.begin(), peers.end(), std::greater<>());
+    peers.resize(std::min(peers.size(), max_peers));
+    std::vector<std::string> result;
+    result.reserve(peers.size());
+    for (auto& [_, address] : peers) {
+        result.push_back(std::move(address));
+    }
+    return result;
+}
+
+Status PeerFileCache::fetch(const UInt128Wrapper& hash, size_t offset, Slice buffer) {
+    std::string self =
+            fmt::format("{}:{}", BackendOptions::get_localhost(), config::webserver_port);
+    auto peers = peers_of(hash, config::file_cache_peer_addresses, self,
+                          config::file_cache_peer_fetch_max_peers);
+    for (const auto& peer : peers) {
+        std::string url =
+                fmt::format("http://{}/api/file_cache?op=fetch&hash={}&offset={}&size={}", peer,
+                            hash.to_string(), offset, buffer.size);
+        size_t received = 0;
+        auto callback = [&](const void* data, size_t length) {
+            if (received + length > buffer.size) {
+                return false;
+            }
+            memcpy(buffer.data + received, data, length);
+            received += length;
+            return true;
+        };
+        HttpClient client;
+        Status st = client.init(url);
+        if (st.ok()) {
+            client.set_timeout_ms(config::file_cache_peer_fetch_timeout_ms);
+            st = client.execute(callback);
+        }
+        if (st.ok() && client.get_http_status() == 200 && received == buffer.size) {
+            peer_fetch_hit_counter << 1;
+            return Status::OK();
+        }
+        VLOG_DEBUG << "failed to fetch file cache from peer " << peer << ", hash "
+                   << hash.to_string() << ", offset " << offset << ", size " << buffer.size
+                   << ": " << st;
+    }
+    peer_fetch_miss_counter << 1;
+    return Status::NotFound("range is not cached by the peers");
+}
+
+Status PeerFileCache::read_cached(const UInt128Wrapper& hash, size_t offset, Slice buffer) {
+    BlockFileCache* cache = FileCacheFactory::instance()->get_by_path(hash);
+    if (cache == nullptr) {
+        return Status::NotFound("file cache is not enabled");
+    }
+    auto blocks = cache->get_blocks_by_key(hash);
+    auto iter = blocks.upper_bound(offset);
+    if (iter != blocks.begin()) {
+        --iter;
+    }
+    size_t cur_offset = offset;
+    size_t end_offset = offset + buffer.size;
+    for (; cur_offset < end_offset && iter != blocks.end(); ++iter) {
+        const auto& block = iter->second;
+        if (block->offset() > cur_offset || block->range().right < cur_offset) {
+            break;
+        }
+        size_t read_size = std::min(end_offset, block->range().right + 1) - cur_offset;
+        RETURN_IF_ERROR(block->read(Slice(buffer.data + (cur_offset - offset), read_size),
+                                    cur_offset - block->offset()));
+        cur_offset += read_size;
+    }
+    if (cur_offset < end_offset) {
+        return Status::NotFound("range is not cached");
+    }
+    return Status::OK();
+}
+
+Status PeerFileCache::parse_hash(const std::string& str, UInt128Wrapper* hash) {
+    if (str.size() != sizeof(uint128_t) * 2) {
+        return Status::InvalidArgument("invalid file cache hash: {}", str);
+    }
+    uint128_t value = 0;
+    for (char c : str) {
+        if (!isxdigit(c)) {
+            return Status::InvalidArgument("invalid file cache hash: {}", str);
+        }
+        value = (value << 4) | vectorized::unhex(c);
+    }
+    *hash = UInt128Wrapper(value);
+    return Status::OK();
+}
+
+} // namespace doris::io
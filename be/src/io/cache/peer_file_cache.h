@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "io/cache/file_cache_common.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+// Reads the blocks missed in the local file cache from the file caches of the other BEs in the
+// same compute group, `config::file_cache_peer_addresses`. A peer serves a range only if it is
+// all cached there, by `read_cached` behind `/api/file_cache?op=fetch`, so a peer never reads
+// the remote storage for another BE.
+class PeerFileCache {
+public:
+    static bool enabled();
+
+    // Fill the whole `buffer` with the data at `offset` of the file `hash` from a peer.
+    // NotFound if none of the peers tried has the range cached.
+    static Status fetch(const UInt128Wrapper& hash, size_t offset, Slice buffer);
+
+    // Fill the whole `buffer` with the data at `offset` of the file `hash` from the local file
+    // cache, NotFound if some of the range is not cached.
+    static Status read_cached(const UInt128Wrapper& hash, size_t offset, Slice buffer);
+
+    // The peers to try for the file `hash`, the first one first. Rendezvous hashing keeps
+    // the order of the other peers when a peer joins or leaves.
+    static std::vector<std::string> peers_of(const UInt128Wrapper& hash,
+                                             const std::string& addresses,
+                                             const std::string& self, size_t max_peers);
+
+    // Parse the hash printed by `UInt128Wrapper::to_string`.
+    static Status parse_hash(const std::string& str, UInt128Wrapper* hash);
+};
+
+} // namespace doris::io
@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/remote_read_single_flight.h"
+
+#include <bvar/bvar.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+
+namespace doris::io {
+
+bvar::Adder<uint64_t> s3_read_coalesced_counter("cached_remote_reader_s3_read_coalesced");
+
+static RemoteReadSingleFlight::FlightSPtr new_flight(size_t offset, size_t size) {
+    auto flight = std::make_shared<RemoteReadSingleFlight::Flight>();
+    flight->offset = offset;
+    flight->size = size;
+    flight->buffer.reset(new char[size]);
+    return flight;
+}
+
+// read the range by itself, without sharing it
+static Status read_alone(size_t offset, size_t size, const std::function<Status(Slice)>& read_func,
+                         RemoteReadSingleFlight::FlightSPtr* flight) {
+    *flight = new_flight(offset, size);
+    (*flight)->done = true;
+    (*flight)->status = read_func(Slice((*flight)->buffer.get(), size));
+    return (*flight)->status;
+}
+
+RemoteReadSingleFlight* RemoteReadSingleFlight::instance() {
+    static RemoteReadSingleFlight s_instance;
+    return &s_instance;
+}
+
+Status RemoteReadSingleFlight::read(const UInt128Wrapper& key, size_t offset, size_t size,
+                                    const std::function<Status(Slice)>& read_func,
+                                    FlightSPtr* flight, bool* coalesced) {
+    *coalesced = false;
+    if (!config::enable_file_cache_coalesce_remote_read) {
+        return read_alone(offset, size, read_func, flight);
+    }
+    Shard& shard = _shards[KeyHash()(key) % NUM_SHARDS];
+    FlightSPtr leader;
+    {
+        std::lock_guard lock(shard.mtx);
+        auto& flights = shard.flights[key];
+        auto iter = std::find_if(flights.begin(), flights.end(), [&](const FlightSPtr& f) {
+            return f->offset <= offset && offset + size <= f->offset + f->size;
+        });
+        if (iter != flights.end()) {
+            leader = *iter;
+        } else {
+            *flight = new_flight(offset, size);
+            flights.push_back(*flight);
+        }
+    }
+    if (leader == nullptr) {
+        return _lead(shard, key, *flight, read_func);
+    }
+
+    {
+        std::unique_lock lock(leader->mtx);
+        leader->cv.wait(lock, [&] { return leader->done; });
+    }
+    if (leader->status.ok()) {
+        s3_read_coalesced_counter << 1;
+        *coalesced = true;
+        *flight = std::move(leader);
+        return Status::OK();
+    }
+    // The leader may fail for its own reason, e.g. its query is cancelled, so read it again
+    // rather than failing all the waiters.
+    return read_alone(offset, size, read_func, flight);
+}
+
+Status RemoteReadSingleFlight::_lead(Shard& shard, const UInt128Wrapper& key,
+                                     const FlightSPtr& flight,
+                                     const std::function<Status(Slice)>& read_func) {
+    Status st = read_func(Slice(flight->buffer.get(), flight->size));
+    {
+        std::lock_guard lock(shard.mtx);
+        auto iter = shard.flights.find(key);
+        DCHECK(iter != shard.flights.end());
+        auto& flights = iter->second;
+        flights.erase(std::find(flights.begin(), flights.end(), flight));
+        if (flights.empty()) {
+            shard.flights.erase(iter);
+        }
+    }
+    {
+        std::lock_guard lock(flight->mtx);
+        flight->status = st;
+        flight->done = true;
+    }
+    flight->cv.notify_all();
+    return st;
+}
+
+size_t RemoteReadSingleFlight::num_flights() {
+    size_t num = 0;
+    for (auto& shard : _shards) {
+        std::lock_guard lock(shard.mtx);
+        for (const auto& [_, flights] : shard.flights) {
+            num += flights.size();
+        }
+    }
+    return num;
+}
+
+} // namespace doris::io
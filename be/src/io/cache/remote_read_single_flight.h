@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "io/cache/file_cache_common.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+// Coalesces the concurrent reads of the same remote file range. The first reader of a range
+// becomes the leader and reads it into a shared buffer, the later readers whose range is
+// covered by an in-flight read wait for it and share its buffer instead of reading again.
+class RemoteReadSingleFlight {
+public:
+    struct Flight {
+        size_t offset = 0;
+        size_t size = 0;
+        std::unique_ptr<char[]> buffer;
+
+        std::mutex mtx;
+        std::condition_variable cv;
+        bool done = false;
+        Status status;
+
+        const char* data(size_t file_offset) const { return buffer.get() + file_offset - offset; }
+    };
+    using FlightSPtr = std::shared_ptr<Flight>;
+
+    static RemoteReadSingleFlight* instance();
+
+    // Read [offset, offset + size) of the file `key` by `read_func`, which fills the whole
+    // slice, or wait for an in-flight read which covers the range. The data is in the buffer
+    // of `*flight`. If the shared read failed, the range is read again by `read_func`.
+    // `*coalesced` is set to whether the range was shared with another reader.
+    Status read(const UInt128Wrapper& key, size_t offset, size_t size,
+                const std::function<Status(Slice)>& read_func, FlightSPtr* flight,
+                bool* coalesced);
+
+    size_t num_flights();
+
+private:
+    static constexpr size_t NUM_SHARDS = 32;
+
+    struct Shard {
+        std::mutex mtx;
+        std::unordered_map<UInt128Wrapper, std::vector<FlightSPtr>, KeyHash> flights;
+    };
+
+    Status _lead(Shard& shard, const UInt128Wrapper& key, const FlightSPtr& flight,
+                 const std::function<Status(Slice)>& read_func);
+
+    Shard _shards[NUM_SHARDS];
+};
+
+} // namespace doris::io
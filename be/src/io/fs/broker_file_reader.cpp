@@ -108,6 +108,7 @@ Status BrokerFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes
         return Status::InternalError("connect to broker failed");
     }
 
+    ScopedLatencyTimer latency_timer(DorisMetrics::instance()->broker_file_read_latency_us);
     TBrokerPReadRequest request;
     request.__set_version(TBrokerVersion::VERSION_ONE);
     request.__set_fd(_fd);
@@ -31,6 +31,7 @@
 #include "common/sync_point.h"
 #include "io/fs/err_utils.h"
 #include "io/hdfs_util.h"
+#include "io/io_throttler.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 
@@ -114,7 +115,7 @@ Status HdfsFileReader::close() {
 
 #ifdef USE_HADOOP_HDFS
 Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                    const IOContext* /*io_ctx*/) {
+                                    const IOContext* io_ctx) {
     if (closed()) [[unlikely]] {
         return Status::InternalError("read closed file: {}", _path.native());
     }
@@ -131,6 +132,8 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     if (UNLIKELY(bytes_req == 0)) {
         return Status::OK();
     }
+    IOThrottler::instance().acquire(io_ctx, IOThrottler::Domain::REMOTE, bytes_req);
+    ScopedLatencyTimer latency_timer(DorisMetrics::instance()->hdfs_file_read_latency_us);
 
     size_t has_read = 0;
     while (has_read < bytes_req) {
@@ -166,7 +169,7 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
 // The hedged read only support hdfsPread().
 // TODO: rethink here to see if there are some difference between hdfsPread() and hdfsRead()
 Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                    const IOContext* /*io_ctx*/) {
+                                    const IOContext* io_ctx) {
     if (closed()) [[unlikely]] {
         return Status::InternalError("read closed file: ", _path.native());
     }
@@ -195,6 +198,8 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
     if (UNLIKELY(bytes_req == 0)) {
         return Status::OK();
     }
+    IOThrottler::instance().acquire(io_ctx, IOThrottler::Domain::REMOTE, bytes_req);
+    ScopedLatencyTimer latency_timer(DorisMetrics::instance()->hdfs_file_read_latency_us);
 
     size_t has_read = 0;
     while (has_read < bytes_req) {
@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <vector>
+
 #include "io/fs/stream_load_pipe.h"
+#include "util/byte_buffer.h"
+#include "util/slice.h"
 
 namespace doris {
 namespace io {
@@ -39,6 +43,24 @@ public:
         return st;
     }
 
+    // append the lines with a line delimiter after each of them, in one buffer
+    virtual Status append_lines(const std::vector<Slice>& lines) {
+        size_t size = 0;
+        for (const auto& line : lines) {
+            size += line.size + 1;
+        }
+        if (size == 0) {
+            return Status::OK();
+        }
+        ByteBufferPtr buf = ByteBuffer::allocate(size);
+        for (const auto& line : lines) {
+            buf->put_bytes(line.data, line.size);
+            buf->put_bytes("\n", 1);
+        }
+        buf->flip();
+        return append(buf);
+    }
+
     virtual Status append_json(const char* data, size_t size) {
         return append_and_flush(data, size);
     }
@@ -21,6 +21,7 @@
 // IWYU pragma: no_include <bthread/errno.h>
 #include <bvar/bvar.h>
 #include <errno.h> // IWYU pragma: keep
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <glog/logging.h>
 #include <unistd.h>
@@ -28,18 +29,49 @@
 #include <algorithm>
 #include <atomic>
 #include <cstring>
+#include <limits>
 #include <string>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/sync_point.h"
+#include "gutil/macros.h"
 #include "io/fs/err_utils.h"
+#include "io/fs/local_io_uring.h"
+#include "io/io_common.h"
+#include "io/io_throttler.h"
 #include "util/async_io.h"
 #include "util/doris_metrics.h"
 
 namespace doris {
 namespace io {
 
+static constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+static constexpr size_t DIRECT_IO_BUFFER_SIZE = 4 * 1024 * 1024;
+
+// The aligned buffer of the O_DIRECT reads of a thread, which is allocated at the first direct
+// read of the thread and reused by all its later direct reads.
+class DirectIOBuffer {
+public:
+    ~DirectIOBuffer() { free(_data); }
+
+    static char* thread_local_buffer() {
+        static thread_local DirectIOBuffer buffer;
+        if (buffer._data == nullptr) [[unlikely]] {
+            void* data = nullptr;
+            if (posix_memalign(&data, DIRECT_IO_ALIGNMENT, DIRECT_IO_BUFFER_SIZE) != 0) {
+                return nullptr;
+            }
+            buffer._data = static_cast<char*>(data);
+        }
+        return buffer._data;
+    }
+
+private:
+    char* _data = nullptr;
+};
+
 LocalFileReader::LocalFileReader(Path path, size_t file_size, int fd)
         : _fd(fd), _path(std::move(path)), _file_size(file_size) {
     DorisMetrics::instance()->local_file_open_reading->increment(1);
@@ -60,12 +92,16 @@ Status LocalFileReader::close() {
             return localfs_error(errno, fmt::format("failed to close {}", _path.native()));
         }
         _fd = -1;
+        if (_direct_fd >= 0) {
+            ::close(_direct_fd);
+            _direct_fd = -1;
+        }
     }
     return Status::OK();
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -81,6 +117,32 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     char* to = result.data;
     bytes_req = std::min(bytes_req, _file_size - offset);
     *bytes_read = 0;
+    IOThrottler::instance().acquire(io_ctx, IOThrottler::Domain::LOCAL, bytes_req);
+    ScopedLatencyTimer latency_timer(DorisMetrics::instance()->local_file_read_latency_us);
+
+    if (bytes_req != 0 && _use_direct_io(io_ctx)) {
+        size_t res = _read_direct(offset, to, bytes_req);
+        to += res;
+        offset += res;
+        bytes_req -= res;
+        *bytes_read += res;
+    } else if (config::enable_local_file_io_uring && bytes_req != 0 &&
+               bytes_req <= std::numeric_limits<uint32_t>::max()) {
+        if (auto* ring = LocalIoUring::thread_local_ring(); ring != nullptr) {
+            LocalIoUring::ReadRequest request {.fd = _fd,
+                                               .offset = offset,
+                                               .buf = to,
+                                               .len = static_cast<uint32_t>(bytes_req)};
+            auto st = ring->read({&request, 1});
+            if (st.ok() && request.res > 0) {
+                to += request.res;
+                offset += request.res;
+                bytes_req -= request.res;
+                *bytes_read += request.res;
+            }
+            // the short or failed read is finished or reported by pread below
+        }
+    }
 
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
@@ -102,5 +164,60 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     return Status::OK();
 }
 
+bool LocalFileReader::_use_direct_io(const IOContext* io_ctx) {
+    if (!config::enable_local_file_direct_io || io_ctx == nullptr) {
+        return false;
+    }
+    switch (io_ctx->reader_type) {
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_COLD_DATA_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        return true;
+    default:
+        return io_ctx->is_disposable;
+    }
+}
+
+size_t LocalFileReader::_read_direct(size_t offset, char* to, size_t bytes_req) {
+    std::call_once(_direct_fd_once, [this] {
+        int fd = -1;
+        RETRY_ON_EINTR(fd, ::open(_path.c_str(), O_RDONLY | O_DIRECT));
+        if (fd < 0) {
+            LOG_EVERY_N(WARNING, 100) << "failed to open " << _path.native()
+                                      << " by O_DIRECT: " << errno_to_str();
+        }
+        _direct_fd = fd;
+    });
+    char* buffer = DirectIOBuffer::thread_local_buffer();
+    if (_direct_fd < 0 || buffer == nullptr) {
+        return 0;
+    }
+
+    size_t bytes_read = 0;
+    while (bytes_req != 0) {
+        size_t aligned_offset = offset & ~(DIRECT_IO_ALIGNMENT - 1);
+        size_t skip = offset - aligned_offset;
+        size_t bytes = std::min(bytes_req, DIRECT_IO_BUFFER_SIZE - skip);
+        size_t aligned_bytes =
+                (skip + bytes + DIRECT_IO_ALIGNMENT - 1) & ~(DIRECT_IO_ALIGNMENT - 1);
+        ssize_t res = -1;
+        RETRY_ON_EINTR(res, ::pread(_direct_fd, buffer, aligned_bytes, aligned_offset));
+        if (res <= static_cast<ssize_t>(skip)) {
+            break;
+        }
+        bytes = std::min(bytes, static_cast<size_t>(res) - skip);
+        memcpy(to, buffer + skip, bytes);
+        to += bytes;
+        offset += bytes;
+        bytes_req -= bytes;
+        bytes_read += bytes;
+        if (static_cast<size_t>(res) < aligned_bytes) {
+            break;
+        }
+    }
+    return bytes_read;
+}
+
 } // namespace io
 } // namespace doris
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/fs/file_reader.h"
@@ -47,8 +48,19 @@ private:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    // Whether the read of `io_ctx` bypasses the page cache, which holds for the reads of
+    // compactions and disposable cache, whose data are not read again soon.
+    static bool _use_direct_io(const IOContext* io_ctx);
+    // Read as many bytes as possible by O_DIRECT into `to`, return the number of bytes read.
+    // The rest of the bytes, e.g. if the file system does not support O_DIRECT, is left to
+    // the buffered read.
+    size_t _read_direct(size_t offset, char* to, size_t bytes_req);
+
 private:
     int _fd = -1; // owned
+    // opened by O_DIRECT at the first direct read, -1 if it can not be opened
+    int _direct_fd = -1; // owned
+    std::once_flag _direct_fd_once;
     Path _path;
     size_t _file_size;
     std::atomic<bool> _closed = false;
@@ -0,0 +1,223 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/local_io_uring.h"
+
+#include <errno.h> // IWYU pragma: keep
+#include <glog/logging.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+
+#include "common/config.h"
+#include "io/fs/err_utils.h"
+
+#if __has_include(<linux/io_uring.h>) && defined(__NR_io_uring_setup)
+#include <linux/io_uring.h>
+#define DORIS_HAS_IO_URING 1
+#endif
+
+namespace doris::io {
+
+#ifdef DORIS_HAS_IO_URING
+
+// Set once a ring fails to set up, e.g. the kernel is too old or io_uring is forbidden by
+// seccomp, so that the other threads do not try again.
+static std::atomic<bool> s_io_uring_unavailable = false;
+
+LocalIoUring* LocalIoUring::thread_local_ring() {
+    static thread_local std::unique_ptr<LocalIoUring> ring;
+    static thread_local bool inited = false;
+    if (!inited) [[unlikely]] {
+        if (s_io_uring_unavailable.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        inited = true;
+        std::unique_ptr<LocalIoUring> new_ring(new LocalIoUring());
+        auto st = new_ring->_init(std::max(config::local_file_io_uring_entries, 1),
+                                  config::local_file_io_uring_sqpoll);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to setup io_uring, fall back to pread: " << st;
+            s_io_uring_unavailable.store(true, std::memory_order_relaxed);
+            return nullptr;
+        }
+        ring = std::move(new_ring);
+    }
+    return ring.get();
+}
+
+LocalIoUring::~LocalIoUring() {
+    if (_sqes != nullptr) {
+        ::munmap(_sqes, _sqes_size);
+    }
+    if (_cq_ptr != nullptr && _cq_ptr != _sq_ptr) {
+        ::munmap(_cq_ptr, _cq_size);
+    }
+    if (_sq_ptr != nullptr) {
+        ::munmap(_sq_ptr, _sq_size);
+    }
+    if (_ring_fd >= 0) {
+        ::close(_ring_fd);
+    }
+}
+
+Status LocalIoUring::_init(uint32_t entries, bool sqpoll) {
+    io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    if (sqpoll) {
+        params.flags |= IORING_SETUP_SQPOLL;
+        params.sq_thread_idle = 1000;
+    }
+    _ring_fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (_ring_fd < 0) {
+        return localfs_error(errno, "io_uring_setup");
+    }
+    _sqpoll = sqpoll;
+
+    _sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    _cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+        _sq_size = _cq_size = std::max(_sq_size, _cq_size);
+    }
+    void* ptr = ::mmap(nullptr, _sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                       _ring_fd, IORING_OFF_SQ_RING);
+    if (ptr == MAP_FAILED) {
+        return localfs_error(errno, "mmap io_uring submission queue");
+    }
+    _sq_ptr = ptr;
+    if (single_mmap) {
+        _cq_ptr = _sq_ptr;
+    } else {
+        ptr = ::mmap(nullptr, _cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     _ring_fd, IORING_OFF_CQ_RING);
+        if (ptr == MAP_FAILED) {
+            return localfs_error(errno, "mmap io_uring completion queue");
+        }
+        _cq_ptr = ptr;
+    }
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    ptr = ::mmap(nullptr, _sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _ring_fd,
+                 IORING_OFF_SQES);
+    if (ptr == MAP_FAILED) {
+        return localfs_error(errno, "mmap io_uring submission entries");
+    }
+    _sqes = static_cast<io_uring_sqe*>(ptr);
+
+    auto* sq = static_cast<char*>(_sq_ptr);
+    _sq_entries = params.sq_entries;
+    _sq_tail = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    _sq_mask = reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    _sq_flags = reinterpret_cast<uint32_t*>(sq + params.sq_off.flags);
+    _sq_array = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    auto* cq = static_cast<char*>(_cq_ptr);
+    _cq_head = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    _cq_tail = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    _cq_mask = reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    _cqes = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    return Status::OK();
+}
+
+Status LocalIoUring::_enter(uint32_t to_submit, uint32_t min_complete) {
+    uint32_t flags = IORING_ENTER_GETEVENTS;
+    if (_sqpoll) {
+        // the kernel thread submits the entries, it only needs a wakeup after being idle
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (__atomic_load_n(_sq_flags, __ATOMIC_RELAXED) & IORING_SQ_NEED_WAKEUP) {
+            flags |= IORING_ENTER_SQ_WAKEUP;
+        }
+    }
+    while (true) {
+        long res = ::syscall(__NR_io_uring_enter, _ring_fd, to_submit, min_complete, flags,
+                             nullptr, 0);
+        if (res >= 0) {
+            return Status::OK();
+        }
+        if (errno != EINTR) {
+            return localfs_error(errno, "io_uring_enter");
+        }
+    }
+}
+
+Status LocalIoUring::read(std::span<ReadRequest> requests) {
+    size_t next = 0;
+    while (next < requests.size()) {
+        // never submit more than the ring holds, so that the completions can not overflow
+        auto batch = static_cast<uint32_t>(std::min<size_t>(requests.size() - next, _sq_entries));
+        uint32_t tail = *_sq_tail;
+        for (uint32_t i = 0; i < batch; ++i) {
+            const auto& request = requests[next + i];
+            uint32_t index = tail & *_sq_mask;
+            io_uring_sqe* sqe = &_sqes[index];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_READ;
+            sqe->fd = request.fd;
+            sqe->off = request.offset;
+            sqe->addr = reinterpret_cast<uint64_t>(request.buf);
+            sqe->len = request.len;
+            sqe->user_data = next + i;
+            _sq_array[index] = index;
+            ++tail;
+        }
+        __atomic_store_n(_sq_tail, tail, __ATOMIC_RELEASE);
+
+        uint32_t completed = 0;
+        uint32_t to_submit = batch;
+        while (completed < batch) {
+            RETURN_IF_ERROR(_enter(to_submit, batch - completed));
+            to_submit = 0;
+            uint32_t head = *_cq_head;
+            uint32_t cq_tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+            for (; head != cq_tail; ++head, ++completed) {
+                const io_uring_cqe* cqe = &_cqes[head & *_cq_mask];
+                requests[cqe->user_data].res = cqe->res;
+            }
+            __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+        }
+        next += batch;
+    }
+    return Status::OK();
+}
+
+#else
+
+LocalIoUring* LocalIoUring::thread_local_ring() {
+    return nullptr;
+}
+
+LocalIoUring::~LocalIoUring() = default;
+
+Status LocalIoUring::_init(uint32_t /*entries*/, bool /*sqpoll*/) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status LocalIoUring::_enter(uint32_t /*to_submit*/, uint32_t /*min_complete*/) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+Status LocalIoUring::read(std::span<ReadRequest> /*requests*/) {
+    return Status::NotSupported("io_uring is not supported");
+}
+
+#endif
+
+} // namespace doris::io
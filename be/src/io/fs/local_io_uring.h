@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <sys/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "common/status.h"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace doris::io {
+
+// A minimal io_uring, which submits a batch of reads of local files and waits for all of them.
+// It talks to the kernel by the raw syscalls, so it does not need liburing.
+// Each thread owns its ring, so a ring is never shared and needs no lock.
+class LocalIoUring {
+public:
+    struct ReadRequest {
+        int fd = -1;
+        uint64_t offset = 0;
+        char* buf = nullptr;
+        uint32_t len = 0;
+        // bytes read, or -errno if the read failed
+        ssize_t res = 0;
+    };
+
+    // The ring of the calling thread, nullptr if io_uring is not available.
+    static LocalIoUring* thread_local_ring();
+
+    ~LocalIoUring();
+
+    LocalIoUring(const LocalIoUring&) = delete;
+    LocalIoUring& operator=(const LocalIoUring&) = delete;
+
+    // Submit the reads and wait for their completions. The result of each read is set to its
+    // `res`, an error status is returned only if the ring itself fails.
+    Status read(std::span<ReadRequest> requests);
+
+private:
+    LocalIoUring() = default;
+
+    Status _init(uint32_t entries, bool sqpoll);
+    Status _enter(uint32_t to_submit, uint32_t min_complete);
+
+    int _ring_fd = -1;
+    bool _sqpoll = false;
+
+    void* _sq_ptr = nullptr;
+    size_t _sq_size = 0;
+    void* _cq_ptr = nullptr;
+    size_t _cq_size = 0;
+    io_uring_sqe* _sqes = nullptr;
+    size_t _sqes_size = 0;
+
+    uint32_t _sq_entries = 0;
+    uint32_t* _sq_tail = nullptr;
+    uint32_t* _sq_mask = nullptr;
+    uint32_t* _sq_flags = nullptr;
+    uint32_t* _sq_array = nullptr;
+
+    uint32_t* _cq_head = nullptr;
+    uint32_t* _cq_tail = nullptr;
+    uint32_t* _cq_mask = nullptr;
+    io_uring_cqe* _cqes = nullptr;
+};
+
+} // namespace doris::io
@@ -49,6 +49,13 @@ Status MultiTablePipe::append_with_line_delimiter(const char* data, size_t size)
     return dispatch(table, data + prefix_len, size - prefix_len, cb);
 }
 
+Status MultiTablePipe::append_lines(const std::vector<Slice>& lines) {
+    for (const auto& line : lines) {
+        RETURN_IF_ERROR(append_with_line_delimiter(line.data, line.size));
+    }
+    return Status::OK();
+}
+
 Status MultiTablePipe::append_json(const char* data, size_t size) {
     const std::string& table = parse_dst_table(data, size);
     if (table.empty()) {
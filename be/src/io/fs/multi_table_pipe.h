@@ -38,6 +38,9 @@ public:
 
     Status append_with_line_delimiter(const char* data, size_t size) override;
 
+    // the lines may go to different tables, so they are dispatched one by one
+    Status append_lines(const std::vector<Slice>& lines) override;
+
     Status append_json(const char* data, size_t size) override;
 
     // for pipe consumers, i.e. scanners, to get underlying KafkaConsumerPipes
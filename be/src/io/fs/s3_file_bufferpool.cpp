@@ -19,8 +19,10 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
+#include <vector>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -64,12 +66,51 @@ struct Memory : boost::noncopyable, Allocator {
     char* _data;
 };
 
+// The memories of the released file buffers, which are reused by the new buffers, so that a
+// writer does not allocate and fault in a fresh memory for each part.
+class FileBufferMemoryPool {
+public:
+    static FileBufferMemoryPool& instance() {
+        // never destructed, since the memory trackers may be gone at exit
+        static auto* pool = new FileBufferMemoryPool();
+        return *pool;
+    }
+
+    std::unique_ptr<Memory<>> get(size_t size) {
+        std::unique_ptr<Memory<>> memory;
+        {
+            std::lock_guard lock(_mutex);
+            if (!_memories.empty()) {
+                memory = std::move(_memories.back());
+                _memories.pop_back();
+            }
+        }
+        // the size differs if s3_write_buffer_size is changed
+        if (memory == nullptr || memory->_size != size) {
+            memory = std::make_unique<Memory<>>(size);
+        }
+        return memory;
+    }
+
+    void put(std::unique_ptr<Memory<>> memory) {
+        auto max_num = static_cast<size_t>(std::max(config::s3_file_buffer_pool_max_num, 0));
+        std::lock_guard lock(_mutex);
+        if (_memories.size() < max_num) {
+            _memories.push_back(std::move(memory));
+        }
+    }
+
+private:
+    std::mutex _mutex;
+    std::vector<std::unique_ptr<Memory<>>> _memories;
+};
+
 struct FileBuffer::PartData {
-    Memory<> _memory;
-    PartData() : _memory(config::s3_write_buffer_size) {}
-    ~PartData() = default;
-    [[nodiscard]] Slice data() const { return Slice {_memory._data, _memory._size}; }
-    [[nodiscard]] size_t size() const { return _memory._size; }
+    std::unique_ptr<Memory<>> _memory;
+    PartData() : _memory(FileBufferMemoryPool::instance().get(config::s3_write_buffer_size)) {}
+    ~PartData() { FileBufferMemoryPool::instance().put(std::move(_memory)); }
+    [[nodiscard]] Slice data() const { return Slice {_memory->_data, _memory->_size}; }
+    [[nodiscard]] size_t size() const { return _memory->_size; }
 };
 
 Slice FileBuffer::get_slice() const {
@@ -99,7 +140,9 @@ Status UploadFileBuffer::append_data(const Slice& data) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("UploadFileBuffer::append_data", Status::OK());
     std::memcpy((void*)(_inner_data->data().get_data() + _size), data.get_data(), data.get_size());
     _size += data.get_size();
+    // checksum the data while it is still in cache
     _crc_value = crc32c::Extend(_crc_value, data.get_data(), data.get_size());
+    _md5.update(data.get_data(), data.get_size());
     return Status::OK();
 }
 
@@ -146,6 +189,7 @@ void UploadFileBuffer::on_upload() {
         set_status(Status::IOError("Buffer checksum not match"));
         return;
     }
+    _md5.digest();
     _upload_to_remote(*this);
     if (config::enable_flush_file_cache_async) {
         // If we call is_cancelled() after _state.set_status() then there might one situation where
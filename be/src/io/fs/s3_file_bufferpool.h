@@ -28,6 +28,7 @@
 #include "common/status.h"
 #include "io/cache/file_block.h"
 #include "util/crc32c.h"
+#include "util/md5.h"
 #include "util/slice.h"
 #include "util/threadpool.h"
 
@@ -182,6 +183,10 @@ struct UploadFileBuffer final : public FileBuffer {
     * @return the stream representing the inner memory buffer
     */
     std::shared_ptr<std::iostream> get_stream() const { return _stream_ptr; }
+    /**
+    * @return the MD5_DIGEST_LENGTH bytes md5 of the buffer, which is computed while appending
+    */
+    const unsigned char* get_md5() const { return _md5.raw(); }
 
     /**
     * Currently only used for small file to set callback
@@ -199,6 +204,7 @@ private:
     decltype(_holder->file_blocks.begin()) _cur_file_block;
     size_t _append_offset {0};
     uint32_t _crc_value = 0;
+    Md5Digest _md5;
 };
 
 struct FileBufferBuilder {
@@ -29,14 +29,23 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/s3_common.h"
+#include "io/io_common.h"
+#include "io/io_throttler.h"
+#include "runtime/exec_env.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -47,6 +56,75 @@ bvar::Adder<uint64_t> s3_file_being_read("s3_file_reader", "file_being_read");
 bvar::LatencyRecorder s3_bytes_per_read("s3_file_reader", "bytes_per_read"); // also QPS
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3_read_throughput",
                                                            &s3_bytes_read_total);
+bvar::Adder<uint64_t> s3_parallel_read_parts("s3_file_reader", "parallel_read_parts");
+bvar::Adder<uint64_t> s3_hedged_reads("s3_file_reader", "hedged_reads");
+bvar::Adder<uint64_t> s3_hedged_read_wins("s3_file_reader", "hedged_read_wins");
+
+// Read [offset, offset + bytes_req) of the object into `to` by a ranged GET.
+// The GET is aborted once `cancelled` is set.
+static Status get_object_range(Aws::S3::S3Client& client, const std::string& bucket,
+                               const std::string& key, const Path& path, size_t offset, char* to,
+                               size_t bytes_req, const std::atomic<bool>* cancelled = nullptr) {
+    Aws::S3::Model::GetObjectRequest request;
+    request.WithBucket(bucket).WithKey(key);
+    request.SetRange(fmt::format("bytes={}-{}", offset, offset + bytes_req - 1));
+    request.SetResponseStreamFactory(AwsWriteableStreamFactory(to, bytes_req));
+    if (cancelled != nullptr) {
+        request.SetContinueRequestHandler([cancelled](const Aws::Http::HttpRequest*) {
+            return !cancelled->load(std::memory_order_relaxed);
+        });
+    }
+
+    SCOPED_BVAR_LATENCY(s3_bvar::s3_get_latency);
+    auto outcome = client.GetObject(request);
+    if (!outcome.IsSuccess()) {
+        return s3fs_error(outcome.GetError(), fmt::format("failed to read from {}", path.native()));
+    }
+    size_t bytes_read = outcome.GetResult().GetContentLength();
+    if (bytes_read != bytes_req) {
+        return Status::InternalError("failed to read from {}(bytes read: {}, bytes req: {})",
+                                     path.native(), bytes_read, bytes_req);
+    }
+    return Status::OK();
+}
+
+// The parts of a parallel read. The parts are claimed one by one by the reading thread and the
+// helper tasks, so the read makes progress even if no helper task gets a thread.
+struct ParallelReadParts {
+    std::shared_ptr<Aws::S3::S3Client> client;
+    std::string bucket;
+    std::string key;
+    Path path;
+    size_t offset;
+    char* to;
+    size_t bytes_req;
+    size_t part_size;
+    size_t num_parts;
+
+    std::atomic<size_t> next_part = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t finished_parts = 0;
+    Status status;
+
+    // Read the unclaimed parts until there is none.
+    void run() {
+        size_t part;
+        while ((part = next_part.fetch_add(1)) < num_parts) {
+            size_t part_offset = part * part_size;
+            Status st = get_object_range(*client, bucket, key, path, offset + part_offset,
+                                         to + part_offset,
+                                         std::min(part_size, bytes_req - part_offset));
+            std::lock_guard lock(mutex);
+            if (!st.ok() && status.ok()) {
+                status = std::move(st);
+            }
+            if (++finished_parts == num_parts) {
+                cv.notify_all();
+            }
+        }
+    }
+};
 
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const S3ClientHolder> client,
                                             std::string bucket, std::string key,
@@ -92,8 +170,46 @@ Status S3FileReader::close() {
     return Status::OK();
 }
 
+// A read which may be issued by a primary GET and a backup GET. Each GET reads into its own
+// buffer, since the loser may still be running after the read returns.
+struct HedgedRead {
+    static constexpr int PRIMARY = 0;
+    static constexpr int BACKUP = 1;
+
+    std::shared_ptr<Aws::S3::S3Client> client;
+    std::string bucket;
+    std::string key;
+    Path path;
+    size_t offset;
+    size_t bytes_req;
+
+    // set by whoever runs the primary GET
+    std::atomic<bool> primary_claimed = false;
+    // set once a GET succeeds, which cancels the other one
+    std::atomic<bool> done = false;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::unique_ptr<char[]> buffers[2];
+    Status statuses[2];
+    bool finished[2] = {false, false};
+    int winner = -1;
+
+    void run(int request) {
+        Status st = get_object_range(*client, bucket, key, path, offset, buffers[request].get(),
+                                     bytes_req, &done);
+        std::lock_guard lock(mutex);
+        statuses[request] = std::move(st);
+        finished[request] = true;
+        if (statuses[request].ok() && winner < 0) {
+            winner = request;
+            done = true;
+        }
+        cv.notify_all();
+    }
+};
+
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                  const IOContext* /*io_ctx*/) {
+                                  const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::InternalError(
@@ -108,26 +224,26 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
         return Status::OK();
     }
 
-    Aws::S3::Model::GetObjectRequest request;
-    request.WithBucket(_bucket).WithKey(_key);
-    request.SetRange(fmt::format("bytes={}-{}", offset, offset + bytes_req - 1));
-    request.SetResponseStreamFactory(AwsWriteableStreamFactory(to, bytes_req));
-
     auto client = _client->get();
     if (!client) {
         return Status::InternalError("init s3 client error");
     }
-    SCOPED_BVAR_LATENCY(s3_bvar::s3_get_latency);
-    auto outcome = client->GetObject(request);
-    if (!outcome.IsSuccess()) {
-        return s3fs_error(outcome.GetError(),
-                          fmt::format("failed to read from {}", _path.native()));
-    }
-    *bytes_read = outcome.GetResult().GetContentLength();
-    if (*bytes_read != bytes_req) {
-        return Status::InternalError("failed to read from {}(bytes read: {}, bytes req: {})",
-                                     _path.native(), *bytes_read, bytes_req);
+    IOThrottler::instance().acquire(io_ctx, IOThrottler::Domain::REMOTE, bytes_req);
+    ScopedLatencyTimer latency_timer(DorisMetrics::instance()->s3_file_read_latency_us);
+    size_t num_parts = _num_parallel_read_parts(bytes_req);
+    if (num_parts > 1) {
+        RETURN_IF_ERROR(_parallel_read(std::move(client), offset, to, bytes_req, num_parts));
+        if (io_ctx != nullptr && io_ctx->file_cache_stats != nullptr) {
+            io_ctx->file_cache_stats->num_parallel_remote_read_parts += num_parts;
+        }
+    } else if (config::enable_s3_hedged_read &&
+               bytes_req <= static_cast<size_t>(config::s3_hedged_read_max_bytes) &&
+               ExecEnv::GetInstance()->s3_file_upload_thread_pool() != nullptr) {
+        RETURN_IF_ERROR(_hedged_read(std::move(client), offset, to, bytes_req));
+    } else {
+        RETURN_IF_ERROR(get_object_range(*client, _bucket, _key, _path, offset, to, bytes_req));
     }
+    *bytes_read = bytes_req;
     s3_bytes_read_total << *bytes_read;
     s3_bytes_per_read << *bytes_read;
     s3_file_reader_read_counter << 1;
@@ -135,4 +251,98 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::OK();
 }
 
+size_t S3FileReader::_num_parallel_read_parts(size_t bytes_req) {
+    auto min_part_size =
+            static_cast<size_t>(std::max<int64_t>(config::s3_parallel_read_min_part_bytes, 1));
+    auto max_parts = static_cast<size_t>(std::max(config::s3_parallel_read_max_parts, 1));
+    if (max_parts == 1 || bytes_req < 2 * min_part_size ||
+        ExecEnv::GetInstance()->s3_file_upload_thread_pool() == nullptr) {
+        return 1;
+    }
+    return std::min(max_parts, bytes_req / min_part_size);
+}
+
+Status S3FileReader::_parallel_read(std::shared_ptr<Aws::S3::S3Client> client, size_t offset,
+                                    char* to, size_t bytes_req, size_t num_parts) {
+    auto parts = std::make_shared<ParallelReadParts>();
+    parts->client = std::move(client);
+    parts->bucket = _bucket;
+    parts->key = _key;
+    parts->path = _path;
+    parts->offset = offset;
+    parts->to = to;
+    parts->bytes_req = bytes_req;
+    parts->part_size = (bytes_req + num_parts - 1) / num_parts;
+    parts->num_parts = (bytes_req + parts->part_size - 1) / parts->part_size;
+
+    auto* pool = ExecEnv::GetInstance()->s3_file_upload_thread_pool();
+    for (size_t i = 1; i < parts->num_parts; ++i) {
+        if (!pool->submit_func([parts] { parts->run(); }).ok()) {
+            break;
+        }
+    }
+    parts->run();
+    // all the parts are claimed now, wait for the ones being read by the helper tasks,
+    // which write into `to`
+    std::unique_lock lock(parts->mutex);
+    parts->cv.wait(lock, [&] { return parts->finished_parts == parts->num_parts; });
+    s3_parallel_read_parts << parts->num_parts;
+    return parts->status;
+}
+
+Status S3FileReader::_hedged_read(std::shared_ptr<Aws::S3::S3Client> client, size_t offset,
+                                  char* to, size_t bytes_req) {
+    auto read = std::make_shared<HedgedRead>();
+    read->client = std::move(client);
+    read->bucket = _bucket;
+    read->key = _key;
+    read->path = _path;
+    read->offset = offset;
+    read->bytes_req = bytes_req;
+    read->buffers[HedgedRead::PRIMARY].reset(new char[bytes_req]);
+
+    auto* pool = ExecEnv::GetInstance()->s3_file_upload_thread_pool();
+    bool submitted = pool->submit_func([read] {
+                             if (!read->primary_claimed.exchange(true)) {
+                                 read->run(HedgedRead::PRIMARY);
+                             }
+                         }).ok();
+    // the tail latency of the recent GETs, in microseconds
+    int64_t threshold_us =
+            std::max<int64_t>(config::s3_hedged_read_min_threshold_ms * 1000L,
+                              s3_bvar::s3_get_latency.latency_percentile(
+                                      config::s3_hedged_read_percentile));
+    bool primary_finished = false;
+    if (submitted) {
+        std::unique_lock lock(read->mutex);
+        primary_finished = read->cv.wait_for(lock, std::chrono::microseconds(threshold_us),
+                                             [&] { return read->finished[HedgedRead::PRIMARY]; });
+    }
+    bool hedged = false;
+    if (!read->primary_claimed.exchange(true)) {
+        // the primary GET is still queued, a backup GET would wait in the same queue
+        read->run(HedgedRead::PRIMARY);
+    } else if (!primary_finished) {
+        hedged = true;
+        s3_hedged_reads << 1;
+        read->buffers[HedgedRead::BACKUP].reset(new char[bytes_req]);
+        read->run(HedgedRead::BACKUP);
+    }
+
+    std::unique_lock lock(read->mutex);
+    read->cv.wait(lock, [&] {
+        return read->winner >= 0 ||
+               (read->finished[HedgedRead::PRIMARY] &&
+                (!hedged || read->finished[HedgedRead::BACKUP]));
+    });
+    if (read->winner < 0) {
+        return read->statuses[HedgedRead::PRIMARY];
+    }
+    if (read->winner == HedgedRead::BACKUP) {
+        s3_hedged_read_wins << 1;
+    }
+    memcpy(to, read->buffers[read->winner].get(), bytes_req);
+    return Status::OK();
+}
+
 } // namespace doris::io
@@ -54,6 +54,18 @@ protected:
                         const IOContext* io_ctx) override;
 
 private:
+    // The number of the parallel ranged GETs of a read of `bytes_req` bytes, 1 means the read
+    // is issued by a single GET.
+    static size_t _num_parallel_read_parts(size_t bytes_req);
+    // Split the read into `num_parts` ranged GETs, which are issued by the s3 file thread pool
+    // and this thread in parallel.
+    Status _parallel_read(std::shared_ptr<Aws::S3::S3Client> client, size_t offset, char* to,
+                          size_t bytes_req, size_t num_parts);
+    // Issue the read by a GET on the s3 file thread pool, and by a backup GET on this thread if
+    // the first one is slower than the tail latency of the recent GETs.
+    Status _hedged_read(std::shared_ptr<Aws::S3::S3Client> client, size_t offset, char* to,
+                        size_t bytes_req);
+
     Path _path;
     size_t _file_size;
 
@@ -340,7 +340,7 @@ void S3FileWriter::_upload_one_part(int64_t part_num, UploadFileBuffer& buf) {
 
     upload_request.SetBody(buf.get_stream());
 
-    Aws::Utils::ByteBuffer part_md5(Aws::Utils::HashingUtils::CalculateMD5(*buf.get_stream()));
+    Aws::Utils::ByteBuffer part_md5(buf.get_md5(), MD5_DIGEST_LENGTH);
     upload_request.SetContentMD5(Aws::Utils::HashingUtils::Base64Encode(part_md5));
 
     upload_request.SetContentLength(buf.get_size());
@@ -500,7 +500,7 @@ void S3FileWriter::_put_object(UploadFileBuffer& buf) {
     DCHECK(!closed());
     Aws::S3::Model::PutObjectRequest request;
     request.WithBucket(_bucket).WithKey(_key);
-    Aws::Utils::ByteBuffer part_md5(Aws::Utils::HashingUtils::CalculateMD5(*buf.get_stream()));
+    Aws::Utils::ByteBuffer part_md5(buf.get_md5(), MD5_DIGEST_LENGTH);
     request.SetContentMD5(Aws::Utils::HashingUtils::Base64Encode(part_md5));
     request.SetBody(buf.get_stream());
     request.SetContentLength(buf.get_size());
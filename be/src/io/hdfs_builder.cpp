@@ -117,6 +117,14 @@ Status create_hdfs_builder(const THdfsParams& hdfsParams, const std::string& fs_
         hdfsBuilderSetKeyTabFile(builder->get(), nullptr);
 #endif
     }
+    // read the blocks of the co-located DataNode by short-circuit, which could be overridden
+    // by the conf of the catalog below
+    builder->domain_socket_path = doris::config::hdfs_short_circuit_read_domain_socket_path;
+    if (!builder->domain_socket_path.empty()) {
+        hdfsBuilderConfSetStr(builder->get(), "dfs.client.read.shortcircuit", "true");
+        hdfsBuilderConfSetStr(builder->get(), "dfs.domain.socket.path",
+                              builder->domain_socket_path.c_str());
+    }
     // set other conf
     if (hdfsParams.__isset.hdfs_conf) {
         for (const THdfsConf& conf : hdfsParams.hdfs_conf) {
@@ -64,6 +64,8 @@ private:
     bool kerberos_login {false};
     std::string hdfs_kerberos_keytab;
     std::string hdfs_kerberos_principal;
+    // the hdfs builder refers to the conf values instead of copying them
+    std::string domain_socket_path;
 };
 
 THdfsParams parse_properties(const std::map<std::string, std::string>& properties);
@@ -45,6 +45,7 @@ struct FileCacheStatistics {
     int64_t write_cache_io_timer = 0;
     int64_t bytes_write_into_cache = 0;
     int64_t num_skip_cache_io_total = 0;
+    int64_t num_parallel_remote_read_parts = 0;
 };
 
 struct IOContext {
@@ -52,6 +53,8 @@ struct IOContext {
     // FIXME(plat1ko): Seems `is_disposable` can be inferred from the `reader_type`?
     bool is_disposable = false;
     bool is_index_data = false;
+    // read by the file cache warm up
+    bool is_warmup = false;
     bool read_file_cache = true;
     // TODO(lightman): use following member variables to control file cache
     bool is_persistent = false;
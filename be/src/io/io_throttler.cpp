@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/io_throttler.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <thread>
+
+#include "common/config.h"
+#include "io/io_common.h"
+
+namespace doris::io {
+
+static const char* priority_name(IOPriority priority) {
+    switch (priority) {
+    case IOPriority::QUERY:
+        return "query";
+    case IOPriority::SCHEMA_CHANGE:
+        return "schema_change";
+    case IOPriority::COMPACTION:
+        return "compaction";
+    case IOPriority::WARMUP:
+        return "warmup";
+    default:
+        return "unknown";
+    }
+}
+
+IOThrottler& IOThrottler::instance() {
+    static IOThrottler throttler;
+    return throttler;
+}
+
+IOThrottler::IOThrottler() {
+    for (size_t i = 0; i < static_cast<size_t>(IOPriority::NUM_PRIORITIES); ++i) {
+        _wait_us[i] = std::make_unique<bvar::Adder<int64_t>>(
+                "io_throttler", fmt::format("{}_wait_us", priority_name(IOPriority(i))));
+    }
+}
+
+IOPriority IOThrottler::priority(const IOContext* io_ctx) {
+    if (io_ctx == nullptr) {
+        return IOPriority::QUERY;
+    }
+    if (io_ctx->is_warmup) {
+        return IOPriority::WARMUP;
+    }
+    switch (io_ctx->reader_type) {
+    case ReaderType::READER_BASE_COMPACTION:
+    case ReaderType::READER_CUMULATIVE_COMPACTION:
+    case ReaderType::READER_COLD_DATA_COMPACTION:
+    case ReaderType::READER_SEGMENT_COMPACTION:
+    case ReaderType::READER_FULL_COMPACTION:
+        return IOPriority::COMPACTION;
+    case ReaderType::READER_ALTER_TABLE:
+    case ReaderType::READER_CHECKSUM:
+        return IOPriority::SCHEMA_CHANGE;
+    default:
+        return IOPriority::QUERY;
+    }
+}
+
+int64_t IOThrottler::_limit_bytes_per_sec(IOPriority priority) {
+    int64_t limit_mb = 0;
+    switch (priority) {
+    case IOPriority::SCHEMA_CHANGE:
+        limit_mb = config::schema_change_read_io_limit_mb_per_sec;
+        break;
+    case IOPriority::COMPACTION:
+        limit_mb = config::compaction_read_io_limit_mb_per_sec;
+        break;
+    case IOPriority::WARMUP:
+        limit_mb = config::warmup_read_io_limit_mb_per_sec;
+        break;
+    default:
+        break;
+    }
+    return std::max<int64_t>(limit_mb, 0) * 1024 * 1024;
+}
+
+int64_t IOThrottler::acquire(const IOContext* io_ctx, Domain domain, size_t bytes) {
+    IOPriority prio = priority(io_ctx);
+    int64_t limit = _limit_bytes_per_sec(prio);
+    if (limit == 0) {
+        return 0;
+    }
+    auto& limiter = _limiters[static_cast<size_t>(prio)][static_cast<size_t>(domain)];
+    int64_t wait_us = 0;
+    {
+        std::lock_guard lock(limiter.mutex);
+        auto now = std::chrono::steady_clock::now();
+        if (limiter.limit_bytes_per_sec != limit) {
+            // the limit is changed, start with a full bucket of the new limit
+            limiter.limit_bytes_per_sec = limit;
+            limiter.tokens = static_cast<double>(limit);
+        } else {
+            double elapsed_sec = std::chrono::duration<double>(now - limiter.last_refill).count();
+            limiter.tokens = std::min(limiter.tokens + elapsed_sec * static_cast<double>(limit),
+                                      static_cast<double>(limit));
+        }
+        limiter.last_refill = now;
+        limiter.tokens -= static_cast<double>(bytes);
+        if (limiter.tokens < 0) {
+            wait_us = static_cast<int64_t>(-limiter.tokens * 1000000 / static_cast<double>(limit));
+        }
+    }
+    if (wait_us > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+        *_wait_us[static_cast<size_t>(prio)] << wait_us;
+    }
+    return wait_us;
+}
+
+} // namespace doris::io
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bvar/bvar.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace doris::io {
+struct IOContext;
+
+// The classes of the io workloads, in the descending order of priority.
+enum class IOPriority : uint8_t {
+    QUERY = 0,
+    SCHEMA_CHANGE = 1,
+    COMPACTION = 2,
+    WARMUP = 3,
+    NUM_PRIORITIES = 4,
+};
+
+// Throttles the bytes read by the background workloads, so that the compactions, schema changes
+// and file cache warm ups can not take all the bandwidth of the disks or the remote storage
+// from the queries. Each priority except QUERY has a token bucket of bytes per domain, whose
+// speed is set by its `*_read_io_limit_mb_per_sec` config, 0 means unlimited.
+class IOThrottler {
+public:
+    enum class Domain : uint8_t { LOCAL = 0, REMOTE = 1, NUM_DOMAINS = 2 };
+
+    static IOThrottler& instance();
+
+    static IOPriority priority(const IOContext* io_ctx);
+
+    // Wait until `bytes` may be read by the workload of `io_ctx` from `domain`.
+    // Returns the microseconds waited.
+    int64_t acquire(const IOContext* io_ctx, Domain domain, size_t bytes);
+
+private:
+    IOThrottler();
+
+    static int64_t _limit_bytes_per_sec(IOPriority priority);
+
+    // A token bucket of one second of bytes. The tokens go negative when a read takes more
+    // than the bucket has, and the read waits until they are refilled.
+    struct Limiter {
+        std::mutex mutex;
+        int64_t limit_bytes_per_sec = 0;
+        double tokens = 0;
+        std::chrono::steady_clock::time_point last_refill;
+    };
+    Limiter _limiters[static_cast<size_t>(IOPriority::NUM_PRIORITIES)]
+                     [static_cast<size_t>(Domain::NUM_DOMAINS)];
+    std::unique_ptr<bvar::Adder<int64_t>>
+            _wait_us[static_cast<size_t>(IOPriority::NUM_PRIORITIES)];
+};
+
+} // namespace doris::io
@@ -24,6 +24,7 @@
 #include "olap/calc_delete_bitmap_executor.h"
 #include "olap/delete_bitmap_calculator.h"
 #include "olap/memtable.h"
+#include "olap/primary_key_filter.h"
 #include "olap/primary_key_index.h"
 #include "olap/rowid_conversion.h"
 #include "olap/rowset/beta_rowset.h"
@@ -48,6 +49,7 @@ bvar::LatencyRecorder g_tablet_commit_phase_update_delete_bitmap_latency(
         "doris_pk", "commit_phase_update_delete_bitmap");
 bvar::LatencyRecorder g_tablet_lookup_rowkey_latency("doris_pk", "tablet_lookup_rowkey");
 bvar::Adder<uint64_t> g_tablet_pk_not_found("doris_pk", "lookup_not_found");
+bvar::Adder<uint64_t> g_tablet_pk_filter_skipped_rowsets("doris_pk", "filter_skipped_rowsets");
 bvar::PerSecond<bvar::Adder<uint64_t>> g_tablet_pk_not_found_per_second(
         "doris_pk", "lookup_not_found_per_second", &g_tablet_pk_not_found, 60);
 bvar::LatencyRecorder g_tablet_update_delete_bitmap_latency("doris_pk", "update_delete_bitmap");
@@ -136,6 +138,9 @@ BaseTablet::BaseTablet(TabletMetaSharedPtr tablet_meta) : _tablet_meta(std::move
     _metric_entity = DorisMetrics::instance()->metric_registry()->register_entity(
             fmt::format("Tablet.{}", tablet_id()), {{"tablet_id", std::to_string(tablet_id())}},
             MetricEntityType::kTablet);
+    if (enable_unique_key_merge_on_write()) {
+        _pk_filter = std::make_unique<PrimaryKeyFilter>();
+    }
     INT_COUNTER_METRIC_REGISTER(_metric_entity, query_scan_bytes);
     INT_COUNTER_METRIC_REGISTER(_metric_entity, query_scan_rows);
     INT_COUNTER_METRIC_REGISTER(_metric_entity, query_scan_count);
@@ -496,6 +501,23 @@ Status BaseTablet::lookup_row_data(const Slice& encoded_key, const RowLocation&
     return Status::OK();
 }
 
+Status BaseTablet::lookup_rows_data(RowsetSharedPtr input_rowset, uint32_t segid,
+                                    const std::vector<uint32_t>& rowids,
+                                    OlapReaderStatistics& stats,
+                                    vectorized::MutableColumnPtr& values) {
+    BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(input_rowset);
+    CHECK(rowset);
+    const TabletSchemaSPtr tablet_schema = rowset->tablet_schema();
+    CHECK(tablet_schema->store_row_column());
+    SegmentCacheHandle segment_cache_handle;
+    std::unique_ptr<segment_v2::ColumnIterator> column_iterator;
+    RETURN_IF_ERROR(_get_segment_column_iterator(rowset, segid,
+                                                 tablet_schema->column(BeConsts::ROW_STORE_COL),
+                                                 &segment_cache_handle, &column_iterator, &stats));
+    RETURN_IF_ERROR(column_iterator->read_by_rowids(rowids.data(), rowids.size(), values));
+    return Status::OK();
+}
+
 Status BaseTablet::lookup_row_key(const Slice& encoded_key, bool with_seq_col,
                                   const std::vector<RowsetSharedPtr>& specified_rowsets,
                                   RowLocation* row_location, uint32_t version,
@@ -517,7 +539,19 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, bool with_seq_col,
             Slice(encoded_key.get_data(), encoded_key.get_size() - seq_col_length - rowid_length);
     RowLocation loc;
 
+    // the rowsets which do not contain the key for sure
+    std::vector<bool> skipped_rowsets;
+    if (_pk_filter != nullptr && config::enable_mow_primary_key_filter &&
+        _pk_filter->may_skip(PrimaryKeyFilter::hash(key_without_seq), specified_rowsets,
+                             &skipped_rowsets)) {
+        g_tablet_pk_filter_skipped_rowsets
+                << std::count(skipped_rowsets.begin(), skipped_rowsets.end(), true);
+    }
+
     for (size_t i = 0; i < specified_rowsets.size(); i++) {
+        if (!skipped_rowsets.empty() && skipped_rowsets[i]) {
+            continue;
+        }
         auto& rs = specified_rowsets[i];
         auto& segments_key_bounds = rs->rowset_meta()->get_segments_key_bounds();
         int num_segments = rs->num_segments();
@@ -547,7 +581,8 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, bool with_seq_col,
         DCHECK_EQ(segments.size(), num_segments);
 
         for (auto id : picked_segments) {
-            Status s = segments[id]->lookup_row_key(encoded_key, with_seq_col, with_rowid, &loc);
+            Status s = segments[id]->lookup_row_key(encoded_key, with_seq_col, with_rowid, &loc,
+                                                    segment_caches[i]->pk_index_iterator(id));
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -673,13 +708,28 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // the hashes of all keys of the segment, added to the primary key filter of the tablet
+    bool add_to_pk_filter = _pk_filter != nullptr && config::enable_mow_primary_key_filter;
+    std::vector<uint64_t> key_hashes;
+    size_t key_suffix_length = 0;
+    if (add_to_pk_filter) {
+        key_hashes.reserve(total);
+        if (_tablet_meta->tablet_schema()->has_sequence_col()) {
+            key_suffix_length += _tablet_meta->tablet_schema()
+                                         ->column(_tablet_meta->tablet_schema()->sequence_col_idx())
+                                         .length() +
+                                 1;
+        }
+        if (!_tablet_meta->tablet_schema()->cluster_key_idxes().empty()) {
+            key_suffix_length += PrimaryKeyIndexReader::ROW_ID_LENGTH;
+        }
+    }
+    std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
+    RETURN_IF_ERROR(pk_idx->new_iterator(&iter));
+    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+            pk_idx->type_info()->type(), 1, 0);
     while (remaining > 0) {
-        std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
-        RETURN_IF_ERROR(pk_idx->new_iterator(&iter));
-
         size_t num_to_read = std::min(batch_size, remaining);
-        auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
-                pk_idx->type_info()->type(), 1, 0);
         auto index_column = index_type->create_column();
         Slice last_key_slice(last_key);
         RETURN_IF_ERROR(iter->seek_at_or_after(&last_key_slice, &exact_match));
@@ -700,6 +750,10 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
         }
         for (size_t i = 0; i < num_read; i++, row_id++) {
             Slice key = Slice(index_column->get_data_at(i).data, index_column->get_data_at(i).size);
+            if (add_to_pk_filter) {
+                key_hashes.push_back(PrimaryKeyFilter::hash(
+                        Slice(key.get_data(), key.get_size() - key_suffix_length)));
+            }
             RowLocation loc;
             // calculate row id
             if (!_tablet_meta->tablet_schema()->cluster_key_idxes().empty()) {
@@ -795,6 +849,9 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
         remaining -= num_read;
     }
     // DCHECK_EQ(total, row_id) << "segment total rows: " << total << " row_id:" << row_id;
+    if (add_to_pk_filter) {
+        RETURN_IF_ERROR(_pk_filter->add_segment(rowset_id, seg->id(), key_hashes));
+    }
 
     if (config::enable_merge_on_write_correctness_check) {
         RowsetIdUnorderedSet rowsetids;
@@ -36,6 +36,7 @@ class RowsetWriter;
 class CalcDeleteBitmapToken;
 class SegmentCacheHandle;
 class RowIdConversion;
+class PrimaryKeyFilter;
 
 struct TabletWithVersion {
     BaseTabletSPtr tablet;
@@ -74,6 +75,9 @@ public:
     // Property encapsulated in TabletMeta
     const TabletMetaSharedPtr& tablet_meta() { return _tablet_meta; }
 
+    // Not null for merge-on-write tablets.
+    PrimaryKeyFilter* pk_filter() const { return _pk_filter.get(); }
+
     // FIXME(plat1ko): It is not appropriate to expose this lock
     std::shared_mutex& get_header_lock() { return _meta_lock; }
 
@@ -137,6 +141,13 @@ public:
                            OlapReaderStatistics& stats, std::string& values,
                            bool write_to_cache = false);
 
+    // Lookup the rows of a segment in one pass, `rowids` must be sorted. The values of the row
+    // store column are appended to `values` in the order of `rowids`.
+    static Status lookup_rows_data(RowsetSharedPtr rowset, uint32_t segid,
+                                   const std::vector<uint32_t>& rowids,
+                                   OlapReaderStatistics& stats,
+                                   vectorized::MutableColumnPtr& values);
+
     // Lookup the row location of `encoded_key`, the function sets `row_location` on success.
     // NOTE: the method only works in unique key model with primary key index, you will got a
     //       not supported error in other data model.
@@ -281,6 +292,7 @@ protected:
     std::unordered_map<Version, RowsetSharedPtr, HashOfVersion> _stale_rs_version_map;
     const TabletMetaSharedPtr _tablet_meta;
     TabletSchemaSPtr _max_version_schema;
+    std::unique_ptr<PrimaryKeyFilter> _pk_filter;
 
     std::string _tablet_path;
 
@@ -0,0 +1,585 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/clock_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <functional>
+#include <new>
+
+#include "gutil/bits.h"
+#include "runtime/memory/lru_cache_value_base.h"
+#include "util/doris_metrics.h"
+#include "util/time.h"
+
+namespace doris {
+
+// Defined in lru_cache.cpp, the metrics are the same as ShardedLRUCache.
+extern MetricPrototype METRIC_cache_capacity;
+extern MetricPrototype METRIC_cache_usage;
+extern MetricPrototype METRIC_cache_usage_ratio;
+extern MetricPrototype METRIC_cache_lookup_count;
+extern MetricPrototype METRIC_cache_hit_count;
+extern MetricPrototype METRIC_cache_hit_ratio;
+
+// Marks a slot whose entry was removed, lookups probe past it.
+static ClockHandle* const TOMBSTONE = reinterpret_cast<ClockHandle*>(1);
+static constexpr uint32_t MIN_TABLE_LENGTH = 16;
+
+struct ClockCache::Table {
+    explicit Table(uint32_t length_)
+            : length(length_), slots(std::make_unique<std::atomic<ClockHandle*>[]>(length_)) {
+        for (uint32_t i = 0; i < length; ++i) {
+            slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    const uint32_t length;
+    std::unique_ptr<std::atomic<ClockHandle*>[]> slots;
+    Table* next_retired = nullptr;
+};
+
+static void free_clock_handle(ClockHandle* h) {
+    if (h->lru.value != nullptr) { // value allows null pointer.
+        delete (LRUCacheValueBase*)h->lru.value;
+    }
+    ::free(h);
+}
+
+ClockCache::ClockCache(LRUCacheType type) : _type(type), _table(new Table(MIN_TABLE_LENGTH)) {
+    _readers[0] = 0;
+    _readers[1] = 0;
+}
+
+ClockCache::~ClockCache() {
+    // No lookup is running when the cache is destroyed.
+    Table* table = _table.load();
+    for (uint32_t i = 0; i < table->length; ++i) {
+        ClockHandle* h = table->slots[i].load();
+        if (h != nullptr && h != TOMBSTONE) {
+            DCHECK_EQ(h->refs.load(), ClockHandle::IN_CACHE) << "entry is still in use";
+            free_clock_handle(h);
+        }
+    }
+    delete table;
+    _free(_retired);
+    _free(_pending);
+}
+
+uint32_t ClockCache::_enter_read() {
+    while (true) {
+        uint64_t epoch = _epoch.load();
+        _readers[epoch & 1].fetch_add(1);
+        // The epoch is switched before this reader is counted, the writer may have
+        // missed it, so register again with the new epoch.
+        if (_epoch.load() == epoch) {
+            return epoch & 1;
+        }
+        _readers[epoch & 1].fetch_sub(1);
+    }
+}
+
+Cache::Handle* ClockCache::lookup(const CacheKey& key, uint32_t hash) {
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    ClockHandle* found = nullptr;
+    uint32_t parity = _enter_read();
+    Table* table = _table.load(std::memory_order_acquire);
+    const uint32_t mask = table->length - 1;
+    for (uint32_t i = hash & mask, probes = 0; probes < table->length;
+         i = (i + 1) & mask, ++probes) {
+        ClockHandle* h = table->slots[i].load(std::memory_order_acquire);
+        if (h == nullptr) {
+            break;
+        }
+        if (h == TOMBSTONE || h->lru.hash != hash || h->lru.key() != key) {
+            continue;
+        }
+        // The entry may be removed by a writer concurrently, only take the reference
+        // if it is still in the cache.
+        uint32_t refs = h->refs.load(std::memory_order_relaxed);
+        while ((refs & ClockHandle::IN_CACHE) != 0) {
+            if (h->refs.compare_exchange_weak(refs, refs + 1, std::memory_order_acquire)) {
+                found = h;
+                break;
+            }
+        }
+        break;
+    }
+    _exit_read(parity);
+
+    if (found == nullptr) {
+        return nullptr;
+    }
+    _hit_count.fetch_add(1, std::memory_order_relaxed);
+    // Avoid dirtying the cache line if it is already set.
+    if (!found->visited.load(std::memory_order_relaxed)) {
+        found->visited.store(true, std::memory_order_relaxed);
+    }
+    __atomic_store_n(&found->lru.last_visit_time, UnixMillis(), __ATOMIC_RELAXED);
+    return reinterpret_cast<Cache::Handle*>(&found->lru);
+}
+
+void ClockCache::release(Cache::Handle* handle) {
+    if (handle == nullptr) {
+        return;
+    }
+    ClockHandle* h = ClockHandle::from_lru(reinterpret_cast<LRUHandle*>(handle));
+    uint32_t refs = h->refs.fetch_sub(1, std::memory_order_acq_rel) - 1;
+    if (refs != 0) {
+        return;
+    }
+    // The entry was removed from the cache and this is the last user.
+    RetiredList to_free;
+    {
+        std::lock_guard l(_mutex);
+        _retire(h);
+        to_free = _try_reclaim();
+    }
+    _free(to_free);
+}
+
+Cache::Handle* ClockCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
+                                  CachePriority priority) {
+    size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
+    auto* h = reinterpret_cast<ClockHandle*>(malloc(offsetof(ClockHandle, lru) + handle_size));
+    new (&h->refs) std::atomic<uint32_t>(ClockHandle::IN_CACHE | 1); // one for the returned handle
+    new (&h->visited) std::atomic<bool>(false);
+    h->next_retired = nullptr;
+    LRUHandle* e = &h->lru;
+    e->value = value;
+    e->charge = charge;
+    e->key_length = key.size();
+    // if LRUCacheType::NUMBER, charge not add handle_size,
+    // because charge at this time is no longer the memory size, but an weight.
+    e->total_size = (_type == LRUCacheType::SIZE ? handle_size + charge : charge);
+    e->hash = hash;
+    e->refs = 0; // not used, see ClockHandle::refs
+    e->next = e->prev = e->next_hash = nullptr;
+    e->in_cache = true;
+    e->priority = priority;
+    e->type = _type;
+    memcpy(e->key_data, key.data(), key.size());
+    e->last_visit_time = UnixMillis();
+
+    RetiredList to_free;
+    {
+        std::lock_guard l(_mutex);
+        int64_t slot = _find(key, hash);
+        if (slot >= 0) {
+            Table* table = _table.load(std::memory_order_relaxed);
+            ClockHandle* old = table->slots[slot].load(std::memory_order_relaxed);
+            table->slots[slot].store(h, std::memory_order_release);
+            _remove_from_cache(old);
+        } else {
+            // note that the cache might get larger than its capacity if all the
+            // entries are in use
+            _evict(_capacity > e->total_size ? _capacity - e->total_size : 0,
+                   _element_count_capacity);
+            _maybe_grow();
+            slot = _find_free_slot(hash);
+            Table* table = _table.load(std::memory_order_relaxed);
+            if (table->slots[slot].load(std::memory_order_relaxed) == TOMBSTONE) {
+                --_tombstones;
+            }
+            table->slots[slot].store(h, std::memory_order_release);
+            ++_elems;
+        }
+        _usage.fetch_add(e->total_size, std::memory_order_relaxed);
+        to_free = _try_reclaim();
+    }
+    _free(to_free);
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
+void ClockCache::erase(const CacheKey& key, uint32_t hash) {
+    RetiredList to_free;
+    {
+        std::lock_guard l(_mutex);
+        int64_t slot = _find(key, hash);
+        if (slot >= 0) {
+            Table* table = _table.load(std::memory_order_relaxed);
+            ClockHandle* h = table->slots[slot].load(std::memory_order_relaxed);
+            table->slots[slot].store(TOMBSTONE, std::memory_order_release);
+            --_elems;
+            ++_tombstones;
+            _remove_from_cache(h);
+        }
+        to_free = _try_reclaim();
+    }
+    _free(to_free);
+}
+
+PrunedInfo ClockCache::prune() {
+    return prune_if([](const LRUHandle*) { return true; });
+}
+
+PrunedInfo ClockCache::prune_if(CachePrunePredicate pred) {
+    PrunedInfo pruned_info;
+    RetiredList to_free;
+    {
+        std::lock_guard l(_mutex);
+        Table* table = _table.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < table->length; ++i) {
+            ClockHandle* h = table->slots[i].load(std::memory_order_relaxed);
+            if (h == nullptr || h == TOMBSTONE ||
+                h->refs.load(std::memory_order_relaxed) != ClockHandle::IN_CACHE ||
+                !pred(&h->lru)) {
+                continue;
+            }
+            size_t total_size = h->lru.total_size;
+            if (_try_evict(i, h)) {
+                ++pruned_info.pruned_count;
+                pruned_info.pruned_size += total_size;
+            }
+        }
+        to_free = _try_reclaim();
+    }
+    _free(to_free);
+    return pruned_info;
+}
+
+PrunedInfo ClockCache::prune_usage(size_t usage) {
+    PrunedInfo pruned_info;
+    RetiredList to_free;
+    {
+        std::lock_guard l(_mutex);
+        size_t cur_usage = _usage.load(std::memory_order_relaxed);
+        pruned_info = _evict(cur_usage > usage ? cur_usage - usage : 0, 0);
+        to_free = _try_reclaim();
+    }
+    _free(to_free);
+    return pruned_info;
+}
+
+int64_t ClockCache::_find(const CacheKey& key, uint32_t hash) const {
+    Table* table = _table.load(std::memory_order_relaxed);
+    const uint32_t mask = table->length - 1;
+    for (uint32_t i = hash & mask, probes = 0; probes < table->length;
+         i = (i + 1) & mask, ++probes) {
+        ClockHandle* h = table->slots[i].load(std::memory_order_relaxed);
+        if (h == nullptr) {
+            break;
+        }
+        if (h != TOMBSTONE && h->lru.hash == hash && h->lru.key() == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int64_t ClockCache::_find_free_slot(uint32_t hash) const {
+    Table* table = _table.load(std::memory_order_relaxed);
+    const uint32_t mask = table->length - 1;
+    for (uint32_t i = hash & mask, probes = 0; probes < table->length;
+         i = (i + 1) & mask, ++probes) {
+        ClockHandle* h = table->slots[i].load(std::memory_order_relaxed);
+        if (h == nullptr || h == TOMBSTONE) {
+            return i;
+        }
+    }
+    // _maybe_grow keeps a quarter of the slots free.
+    LOG(FATAL) << "no free slot in clock cache";
+    return -1;
+}
+
+void ClockCache::_maybe_grow() {
+    Table* table = _table.load(std::memory_order_relaxed);
+    // Keep the load factor (tombstones included) under 0.75, so the probes stay short.
+    if ((_elems + _tombstones + 1) * 4 <= table->length * 3) {
+        return;
+    }
+    uint32_t new_length = MIN_TABLE_LENGTH;
+    while (new_length < (_elems + 1) * 2) {
+        new_length *= 2;
+    }
+    auto* new_table = new Table(new_length);
+    const uint32_t mask = new_length - 1;
+    for (uint32_t i = 0; i < table->length; ++i) {
+        ClockHandle* h = table->slots[i].load(std::memory_order_relaxed);
+        if (h == nullptr || h == TOMBSTONE) {
+            continue;
+        }
+        uint32_t j = h->lru.hash & mask;
+        while (new_table->slots[j].load(std::memory_order_relaxed) != nullptr) {
+            j = (j + 1) & mask;
+        }
+        new_table->slots[j].store(h, std::memory_order_relaxed);
+    }
+    _table.store(new_table, std::memory_order_release);
+    _tombstones = 0;
+    _clock_hand = 0;
+    // Lookups may still probe the old table.
+    table->next_retired = _pending.tables;
+    _pending.tables = table;
+}
+
+PrunedInfo ClockCache::_evict(size_t max_usage, uint32_t max_elems) {
+    PrunedInfo pruned_info;
+    auto need_evict = [&]() {
+        return _usage.load(std::memory_order_relaxed) > max_usage ||
+               (max_elems != 0 && _elems >= max_elems);
+    };
+    Table* table = _table.load(std::memory_order_relaxed);
+    const uint32_t mask = table->length - 1;
+    // 1. evict normal cache entries, 2. evict durable cache entries if need.
+    // Two rounds of the clock hand clear the visited bits and evict all the entries
+    // that are not in use.
+    for (auto priority : {CachePriority::NORMAL, CachePriority::DURABLE}) {
+        for (size_t step = 0; step < 2 * table->length && need_evict(); ++step) {
+            size_t slot = _clock_hand;
+            _clock_hand = (_clock_hand + 1) & mask;
+            ClockHandle* h = table->slots[slot].load(std::memory_order_relaxed);
+            if (h == nullptr || h == TOMBSTONE || h->lru.priority > priority) {
+                continue;
+            }
+            if (h->visited.load(std::memory_order_relaxed)) {
+                h->visited.store(false, std::memory_order_relaxed);
+                continue;
+            }
+            size_t total_size = h->lru.total_size;
+            if (_try_evict(slot, h)) {
+                ++pruned_info.pruned_count;
+                pruned_info.pruned_size += total_size;
+            }
+        }
+    }
+    return pruned_info;
+}
+
+bool ClockCache::_try_evict(size_t slot, ClockHandle* h) {
+    // Only entries that are not in use can be evicted, it fails if a lookup takes
+    // a reference concurrently.
+    uint32_t expected = ClockHandle::IN_CACHE;
+    if (!h->refs.compare_exchange_strong(expected, 0, std::memory_order_acq_rel)) {
+        return false;
+    }
+    _table.load(std::memory_order_relaxed)->slots[slot].store(TOMBSTONE, std::memory_order_release);
+    --_elems;
+    ++_tombstones;
+    h->lru.in_cache = false;
+    _usage.fetch_sub(h->lru.total_size, std::memory_order_relaxed);
+    _retire(h);
+    return true;
+}
+
+void ClockCache::_remove_from_cache(ClockHandle* h) {
+    h->lru.in_cache = false;
+    _usage.fetch_sub(h->lru.total_size, std::memory_order_relaxed);
+    uint32_t refs = h->refs.fetch_and(~ClockHandle::IN_CACHE, std::memory_order_acq_rel);
+    if (refs == ClockHandle::IN_CACHE) {
+        // not in use, otherwise it is retired by the last release.
+        _retire(h);
+    }
+}
+
+void ClockCache::_retire(ClockHandle* h) {
+    h->next_retired = _pending.handles;
+    _pending.handles = h;
+}
+
+ClockCache::RetiredList ClockCache::_try_reclaim() {
+    RetiredList to_free;
+    // Two switches at most: the entries retired before the last switch can be freed after
+    // the first one, and the pending entries after the second one if no lookup is running.
+    for (int i = 0; i < 2; ++i) {
+        if (_pending.handles == nullptr && _pending.tables == nullptr &&
+            _retired.handles == nullptr && _retired.tables == nullptr) {
+            break;
+        }
+        uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+        // The lookups that started before the last switch.
+        if (_readers[(epoch + 1) & 1].load() != 0) {
+            break;
+        }
+        while (_retired.handles != nullptr) {
+            ClockHandle* next = _retired.handles->next_retired;
+            _retired.handles->next_retired = to_free.handles;
+            to_free.handles = _retired.handles;
+            _retired.handles = next;
+        }
+        while (_retired.tables != nullptr) {
+            Table* next = _retired.tables->next_retired;
+            _retired.tables->next_retired = to_free.tables;
+            to_free.tables = _retired.tables;
+            _retired.tables = next;
+        }
+        _retired = _pending;
+        _pending = RetiredList();
+        _epoch.store(epoch + 1);
+    }
+    return to_free;
+}
+
+void ClockCache::_free(RetiredList list) {
+    while (list.handles != nullptr) {
+        ClockHandle* next = list.handles->next_retired;
+        free_clock_handle(list.handles);
+        list.handles = next;
+    }
+    while (list.tables != nullptr) {
+        Table* next = list.tables->next_retired;
+        delete list.tables;
+        list.tables = next;
+    }
+}
+
+ShardedClockCache::ShardedClockCache(const std::string& name, size_t total_capacity,
+                                     LRUCacheType type, uint32_t num_shards,
+                                     uint32_t total_element_count_capacity)
+        : _name(name),
+          _num_shard_bits(Bits::FindLSBSetNonZero(num_shards)),
+          _num_shards(num_shards),
+          _last_id(1),
+          _total_capacity(total_capacity) {
+    CHECK(num_shards > 0) << "num_shards cannot be 0";
+    CHECK_EQ((num_shards & (num_shards - 1)), 0)
+            << "num_shards should be power of two, but got " << num_shards;
+
+    const size_t per_shard = (total_capacity + (_num_shards - 1)) / _num_shards;
+    const size_t per_shard_element_count_capacity =
+            (total_element_count_capacity + (_num_shards - 1)) / _num_shards;
+    _shards = std::make_unique<std::unique_ptr<ClockCache>[]>(_num_shards);
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s] = std::make_unique<ClockCache>(type);
+        _shards[s]->set_capacity(per_shard);
+        _shards[s]->set_element_count_capacity(per_shard_element_count_capacity);
+    }
+
+    _entity = DorisMetrics::instance()->metric_registry()->register_entity(
+            std::string("lru_cache:") + name, {{"name", name}});
+    _entity->register_hook(name, std::bind(&ShardedClockCache::update_cache_metrics, this));
+    INT_GAUGE_METRIC_REGISTER(_entity, cache_capacity);
+    INT_GAUGE_METRIC_REGISTER(_entity, cache_usage);
+    INT_DOUBLE_METRIC_REGISTER(_entity, cache_usage_ratio);
+    INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_lookup_count);
+    INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
+    INT_DOUBLE_METRIC_REGISTER(_entity, cache_hit_ratio);
+}
+
+ShardedClockCache::~ShardedClockCache() {
+    _entity->deregister_hook(_name);
+    DorisMetrics::instance()->metric_registry()->deregister_entity(_entity);
+}
+
+Cache::Handle* ShardedClockCache::insert(const CacheKey& key, void* value, size_t charge,
+                                         CachePriority priority) {
+    const uint32_t hash = key.hash(key.data(), key.size(), 0);
+    return _shards[_shard(hash)]->insert(key, hash, value, charge, priority);
+}
+
+Cache::Handle* ShardedClockCache::lookup(const CacheKey& key) {
+    const uint32_t hash = key.hash(key.data(), key.size(), 0);
+    return _shards[_shard(hash)]->lookup(key, hash);
+}
+
+void ShardedClockCache::release(Handle* handle) {
+    LRUHandle* h = reinterpret_cast<LRUHandle*>(handle);
+    _shards[_shard(h->hash)]->release(handle);
+}
+
+void ShardedClockCache::erase(const CacheKey& key) {
+    const uint32_t hash = key.hash(key.data(), key.size(), 0);
+    _shards[_shard(hash)]->erase(key, hash);
+}
+
+void* ShardedClockCache::value(Handle* handle) {
+    return reinterpret_cast<LRUHandle*>(handle)->value;
+}
+
+uint64_t ShardedClockCache::new_id() {
+    return _last_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+PrunedInfo ShardedClockCache::prune() {
+    PrunedInfo pruned_info;
+    for (int s = 0; s < _num_shards; s++) {
+        PrunedInfo info = _shards[s]->prune();
+        pruned_info.pruned_count += info.pruned_count;
+        pruned_info.pruned_size += info.pruned_size;
+    }
+    return pruned_info;
+}
+
+PrunedInfo ShardedClockCache::prune_if(CachePrunePredicate pred, bool /*lazy_mode*/) {
+    PrunedInfo pruned_info;
+    for (int s = 0; s < _num_shards; s++) {
+        PrunedInfo info = _shards[s]->prune_if(pred);
+        pruned_info.pruned_count += info.pruned_count;
+        pruned_info.pruned_size += info.pruned_size;
+    }
+    return pruned_info;
+}
+
+PrunedInfo ShardedClockCache::prune_usage(size_t usage) {
+    PrunedInfo pruned_info;
+    const size_t per_shard = (usage + (_num_shards - 1)) / _num_shards;
+    for (int s = 0; s < _num_shards; s++) {
+        PrunedInfo info = _shards[s]->prune_usage(per_shard);
+        pruned_info.pruned_count += info.pruned_count;
+        pruned_info.pruned_size += info.pruned_size;
+    }
+    return pruned_info;
+}
+
+uint64_t ShardedClockCache::get_lookup_count() {
+    uint64_t total_lookup_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_lookup_count += _shards[i]->get_lookup_count();
+    }
+    return total_lookup_count;
+}
+
+uint64_t ShardedClockCache::get_hit_count() {
+    uint64_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+    return total_hit_count;
+}
+
+int64_t ShardedClockCache::get_usage() {
+    size_t total_usage = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_usage += _shards[i]->get_usage();
+    }
+    return total_usage;
+}
+
+void ShardedClockCache::update_cache_metrics() const {
+    size_t total_capacity = 0;
+    size_t total_usage = 0;
+    size_t total_lookup_count = 0;
+    size_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_capacity += _shards[i]->get_capacity();
+        total_usage += _shards[i]->get_usage();
+        total_lookup_count += _shards[i]->get_lookup_count();
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+
+    cache_capacity->set_value(total_capacity);
+    cache_usage->set_value(total_usage);
+    cache_lookup_count->set_value(total_lookup_count);
+    cache_hit_count->set_value(total_hit_count);
+    cache_usage_ratio->set_value(total_capacity == 0 ? 0 : ((double)total_usage / total_capacity));
+    cache_hit_ratio->set_value(
+            total_lookup_count == 0 ? 0 : ((double)total_hit_count / total_lookup_count));
+}
+
+} // namespace doris
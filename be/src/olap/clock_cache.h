@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "olap/lru_cache.h"
+#include "util/metrics.h"
+
+namespace doris {
+
+// An entry of ClockCache. The LRUHandle is kept as the last member, so the handles
+// returned to users are LRUHandle* as the ones of ShardedLRUCache, and the predicates
+// of prune_if work on both of them.
+struct ClockHandle {
+    // Set when the entry is in the hash table, the cache holds one reference by it.
+    static constexpr uint32_t IN_CACHE = 1U << 31;
+
+    // IN_CACHE bit and the number of handles returned to users.
+    std::atomic<uint32_t> refs;
+    // Set by lookup, cleared by the clock hand, entries with it set survive one more round.
+    std::atomic<bool> visited;
+    ClockHandle* next_retired;
+    LRUHandle lru;
+    // Note! lru must be at the end, it ends with the key.
+
+    static ClockHandle* from_lru(LRUHandle* e) {
+        return reinterpret_cast<ClockHandle*>(reinterpret_cast<char*>(e) -
+                                              offsetof(ClockHandle, lru));
+    }
+};
+
+// A single shard of ShardedClockCache.
+//
+// Unlike LRUCache, a lookup does not take the mutex: the hash table is an open
+// addressing array of atomic pointers, a hit only increases `refs` with a CAS and sets
+// `visited`. Writers (insert, erase, eviction, prune) are serialized by the mutex.
+// Tables and entries removed by writers may still be read by concurrent lookups, they
+// are freed after all the lookups started before the removal have finished, which is
+// tracked by two reader counters switched by an epoch.
+class ClockCache {
+public:
+    explicit ClockCache(LRUCacheType type);
+    ~ClockCache();
+
+    // Separate from constructor so caller can easily make an array of ClockCache
+    void set_capacity(size_t capacity) { _capacity = capacity; }
+    void set_element_count_capacity(uint32_t element_count_capacity) {
+        _element_count_capacity = element_count_capacity;
+    }
+
+    // Like Cache methods, but with an extra "hash" parameter.
+    // Must call release on the returned handle pointer.
+    Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
+                          CachePriority priority = CachePriority::NORMAL);
+    Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+    void release(Cache::Handle* handle);
+    void erase(const CacheKey& key, uint32_t hash);
+    PrunedInfo prune();
+    // There is no access order in a clock cache, so lazy mode is not supported and
+    // all the entries are checked.
+    PrunedInfo prune_if(CachePrunePredicate pred);
+    // Prune by the clock hand until `usage` is freed.
+    PrunedInfo prune_usage(size_t usage);
+
+    uint64_t get_lookup_count() const { return _lookup_count.load(std::memory_order_relaxed); }
+    uint64_t get_hit_count() const { return _hit_count.load(std::memory_order_relaxed); }
+    size_t get_usage() const { return _usage.load(std::memory_order_relaxed); }
+    size_t get_capacity() const { return _capacity; }
+
+private:
+    struct Table;
+
+    // Entries and tables waiting for the lookups that may read them to finish.
+    struct RetiredList {
+        ClockHandle* handles = nullptr;
+        Table* tables = nullptr;
+    };
+
+    uint32_t _enter_read();
+    void _exit_read(uint32_t parity) { _readers[parity].fetch_sub(1); }
+
+    // All the following functions must be called with _mutex held.
+    int64_t _find(const CacheKey& key, uint32_t hash) const;
+    int64_t _find_free_slot(uint32_t hash) const;
+    void _maybe_grow();
+    // Evicts by the clock hand until the usage is not larger than `max_usage` and the
+    // number of entries is less than `max_elems`, 0 means no limit.
+    PrunedInfo _evict(size_t max_usage, uint32_t max_elems);
+    bool _try_evict(size_t slot, ClockHandle* h);
+    void _remove_from_cache(ClockHandle* h);
+    void _retire(ClockHandle* h);
+    // Returns the entries and tables that can be freed out of the mutex.
+    RetiredList _try_reclaim();
+
+    static void _free(RetiredList list);
+
+    const LRUCacheType _type;
+
+    // Initialized before use.
+    size_t _capacity = 0;
+    uint32_t _element_count_capacity = 0;
+
+    std::atomic<Table*> _table;
+    std::atomic<uint64_t> _epoch = 0;
+    // Number of running lookups for each parity of the epoch.
+    std::atomic<int64_t> _readers[2];
+
+    std::atomic<uint64_t> _lookup_count = 0;
+    std::atomic<uint64_t> _hit_count = 0;
+    std::atomic<size_t> _usage = 0;
+
+    // _mutex protects the following state.
+    std::mutex _mutex;
+    uint32_t _elems = 0;
+    uint32_t _tombstones = 0;
+    size_t _clock_hand = 0;
+    // Removed before the last epoch switch.
+    RetiredList _retired;
+    // Removed after the last epoch switch.
+    RetiredList _pending;
+};
+
+// Same as ShardedLRUCache, but evicts with the CLOCK algorithm and lookups do not take
+// any lock, see ClockCache. Chosen by config::clock_cache_types.
+class ShardedClockCache : public Cache {
+public:
+    ~ShardedClockCache() override;
+    Handle* insert(const CacheKey& key, void* value, size_t charge,
+                   CachePriority priority = CachePriority::NORMAL) override;
+    Handle* lookup(const CacheKey& key) override;
+    void release(Handle* handle) override;
+    void erase(const CacheKey& key) override;
+    void* value(Handle* handle) override;
+    uint64_t new_id() override;
+    PrunedInfo prune() override;
+    PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false) override;
+    PrunedInfo prune_usage(size_t usage) override;
+    int64_t get_usage() override;
+    size_t get_total_capacity() override { return _total_capacity; };
+    uint64_t get_lookup_count() override;
+    uint64_t get_hit_count() override;
+
+private:
+    // ClockCache can only be created and managed with LRUCachePolicy.
+    friend class LRUCachePolicy;
+
+    explicit ShardedClockCache(const std::string& name, size_t total_capacity, LRUCacheType type,
+                               uint32_t num_shards, uint32_t element_count_capacity);
+
+    void update_cache_metrics() const;
+
+    uint32_t _shard(uint32_t hash) const {
+        return _num_shard_bits > 0 ? (hash >> (32 - _num_shard_bits)) : 0;
+    }
+
+    std::string _name;
+    const int _num_shard_bits;
+    const uint32_t _num_shards;
+    std::unique_ptr<std::unique_ptr<ClockCache>[]> _shards;
+    std::atomic<uint64_t> _last_id;
+    size_t _total_capacity;
+
+    std::shared_ptr<MetricEntity> _entity;
+    IntGauge* cache_capacity = nullptr;
+    IntGauge* cache_usage = nullptr;
+    DoubleGauge* cache_usage_ratio = nullptr;
+    IntAtomicCounter* cache_lookup_count = nullptr;
+    IntAtomicCounter* cache_hit_count = nullptr;
+    DoubleGauge* cache_hit_ratio = nullptr;
+};
+
+} // namespace doris
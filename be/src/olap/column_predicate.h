@@ -26,6 +26,7 @@
 #include "olap/schema.h"
 #include "olap/selection_vector.h"
 #include "runtime/define_primitive_type.h"
+#include "util/simd/bits.h"
 #include "vec/columns/column.h"
 #include "vec/exprs/vruntimefilter_wrapper.h"
 
@@ -160,6 +161,32 @@ struct PredicateTypeTraits {
         }                                                                                 \
     }
 
+// Evaluates `pred` on the rows [0, size) of a dense column and writes the selected rows into
+// `sel`. The flags of 32 rows are computed by a branchless loop which the compiler vectorizes,
+// then the selected rows are extracted from the bitmask of the flags.
+template <typename Pred>
+uint16_t evaluate_dense_column_by_bitmask(uint16_t size, uint16_t* sel, Pred pred) {
+    uint16_t new_size = 0;
+    uint32_t i = 0;
+    uint8_t flags[32];
+    for (; i + 32 <= size; i += 32) {
+        for (uint32_t j = 0; j < 32; ++j) {
+            flags[j] = pred(i + j);
+        }
+        uint32_t mask = simd::bytes32_mask_to_bits32_mask(flags);
+        while (mask != 0) {
+            sel[new_size++] = i + __builtin_ctz(mask);
+            mask &= mask - 1;
+        }
+    }
+    for (; i < size; ++i) {
+        if (pred(i)) {
+            sel[new_size++] = i;
+        }
+    }
+    return new_size;
+}
+
 class ColumnPredicate {
 public:
     explicit ColumnPredicate(uint32_t column_id, bool opposite = false)
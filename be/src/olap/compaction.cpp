@@ -36,6 +36,7 @@
 
 #include "cloud/cloud_meta_mgr.h"
 #include "cloud/cloud_storage_engine.h"
+#include "cloud/config.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "common/sync_point.h"
@@ -47,6 +48,7 @@
 #include "olap/cumulative_compaction_time_series_policy.h"
 #include "olap/data_dir.h"
 #include "olap/olap_define.h"
+#include "olap/primary_key_filter.h"
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/beta_rowset_writer.h"
 #include "olap/rowset/rowset.h"
@@ -78,14 +80,13 @@ using namespace ErrorCode;
 
 namespace {
 
-bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs) {
+// `allow_equal_keys` is only true for the duplicate keys table, the rows with the same key
+// must be merged in the other tables.
+bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs, bool allow_equal_keys) {
     size_t min_tidy_size = config::ordered_data_compaction_min_segment_size;
     if (rhs->num_segments() == 0) {
         return true;
     }
-    if (rhs->is_segments_overlapping()) {
-        return false;
-    }
     // check segment size
     auto* beta_rowset = reinterpret_cast<BetaRowset*>(rhs.get());
     std::vector<size_t> segments_size;
@@ -96,16 +97,21 @@ bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs) {
             return false;
         }
     }
-    std::string min_key;
-    auto ret = rhs->min_key(&min_key);
-    if (!ret) {
+    // The segments of a rowset flushed from several memtables are marked overlapping, but
+    // their key ranges are ordered if the keys are loaded in order, e.g. time series data.
+    // So check the key bounds of each segment instead of the overlapping flag.
+    const auto& key_bounds = rhs->rowset_meta()->get_segments_key_bounds();
+    if (key_bounds.size() != rhs->num_segments()) {
+        // the rowset of an old version has no segment key bounds
         return false;
     }
-    if (min_key < pre_max_key) {
-        return false;
+    for (const auto& key_bound : key_bounds) {
+        if (key_bound.min_key() < pre_max_key ||
+            (!allow_equal_keys && !pre_max_key.empty() && key_bound.min_key() == pre_max_key)) {
+            return false;
+        }
+        pre_max_key = key_bound.max_key();
     }
-    CHECK(rhs->max_key(&pre_max_key));
-
     return true;
 }
 
@@ -349,8 +355,9 @@ bool CompactionMixin::handle_ordered_data_compaction() {
     // files to handle compaction
     auto input_size = _input_rowsets.size();
     std::string pre_max_key;
+    bool allow_equal_keys = _tablet->keys_type() == KeysType::DUP_KEYS;
     for (auto i = 0; i < input_size; ++i) {
-        if (!is_rowset_tidy(pre_max_key, _input_rowsets[i])) {
+        if (!is_rowset_tidy(pre_max_key, _input_rowsets[i], allow_equal_keys)) {
             if (i <= input_size / 2) {
                 return false;
             } else {
@@ -956,6 +963,10 @@ Status CompactionMixin::modify_rowsets() {
         RETURN_IF_ERROR(tablet()->modify_rowsets(output_rowsets, _input_rowsets, true));
     }
 
+    if (_tablet->pk_filter() != nullptr) {
+        _tablet->pk_filter()->inherit(_input_rowsets, _output_rowset);
+    }
+
     if (config::tablet_rowset_stale_sweep_by_size &&
         _tablet->tablet_meta()->all_stale_rs_metas().size() >=
                 config::tablet_rowset_stale_sweep_threshold_size) {
@@ -1119,13 +1130,39 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.compaction_level =
             _engine.cumu_compaction_policy(compaction_policy)->new_compaction_level(_input_rowsets);
 
-    ctx.write_file_cache = compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION;
+    ctx.write_file_cache = compaction_type() == ReaderType::READER_CUMULATIVE_COMPACTION ||
+                           is_input_hot_in_file_cache();
     ctx.file_cache_ttl_sec = _tablet->ttl_seconds();
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
     RETURN_IF_ERROR(_engine.meta_mgr().prepare_rowset(*_output_rs_writer->rowset_meta().get()));
     return Status::OK();
 }
 
+bool CloudCompactionMixin::is_input_hot_in_file_cache() {
+    if (!config::enable_file_cache || config::compaction_write_file_cache_min_hot_ratio > 1) {
+        return false;
+    }
+    int64_t input_bytes = 0;
+    int64_t hot_bytes = 0;
+    for (const auto& rs : _input_rowsets) {
+        input_bytes += rs->rowset_meta()->data_disk_size();
+        for (int64_t seg_id = 0; seg_id < rs->num_segments(); seg_id++) {
+            auto hash = io::BlockFileCache::hash(
+                    io::Path(rs->segment_file_path(seg_id)).filename().native());
+            auto* file_cache = io::FileCacheFactory::instance()->get_by_path(hash);
+            for (const auto& block_meta : file_cache->get_hot_blocks_meta(hash)) {
+                hot_bytes += std::get<1>(block_meta);
+            }
+        }
+    }
+    bool is_hot = input_bytes > 0 &&
+                  hot_bytes >= config::compaction_write_file_cache_min_hot_ratio * input_bytes;
+    VLOG_DEBUG << "tablet " << _tablet->tablet_id() << " compaction input bytes " << input_bytes
+               << ", hot bytes in file cache " << hot_bytes << ", write output into file cache "
+               << is_hot;
+    return is_hot;
+}
+
 void CloudCompactionMixin::garbage_collection() {
     if (!config::enable_file_cache) {
         return;
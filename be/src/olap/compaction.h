@@ -187,6 +187,9 @@ private:
     virtual Status modify_rowsets();
 
     int64_t get_compaction_permits();
+
+    // Whether the input rowsets are hot enough in the file cache to write the output into it
+    bool is_input_hot_in_file_cache();
 };
 
 } // namespace doris
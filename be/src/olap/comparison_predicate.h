@@ -551,6 +551,19 @@ private:
                         return _opposite ? size : 0;
                     }
                 }
+                if (pred_col.size() == size) {
+                    // dense dict codes, evaluate with simd bitmask
+                    if constexpr (is_nullable) {
+                        return evaluate_dense_column_by_bitmask(size, sel, [&](uint32_t idx) {
+                            return _opposite ^
+                                   (!null_map[idx] && _operator(pred_col_data[idx], dict_code));
+                        });
+                    } else {
+                        return evaluate_dense_column_by_bitmask(size, sel, [&](uint32_t idx) {
+                            return _opposite ^ _operator(pred_col_data[idx], dict_code);
+                        });
+                    }
+                }
                 uint16_t new_size = 0;
 #define EVALUATE_WITH_NULL_IMPL(IDX) \
     _opposite ^ (!null_map[IDX] && _operator(pred_col_data[IDX], dict_code))
@@ -28,7 +28,9 @@
 #include <chrono> // IWYU pragma: keep
 #include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
@@ -63,6 +65,7 @@
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -409,16 +412,37 @@ Status DataDir::load() {
         LOG(INFO) << "load rowset from meta finished, data dir: " << _path;
     }
 
+    // The tablet headers and the delete bitmaps are deserialized and loaded by a pool, the meta
+    // iterator itself is single threaded so it only hands over the values.
+    std::unique_ptr<ThreadPool> load_meta_pool;
+    if (config::load_tablet_meta_thread_num_per_data_dir > 1) {
+        Status st = ThreadPoolBuilder("LoadTabletMetaThreadPool")
+                            .set_min_threads(1)
+                            .set_max_threads(config::load_tablet_meta_thread_num_per_data_dir)
+                            .build(&load_meta_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to build load tablet meta thread pool, load serially: " << st;
+            load_meta_pool.reset();
+        }
+    }
+    // run the task in the pool, or in place if there is no pool or the pool rejects it
+    auto run_load_meta_task = [&load_meta_pool](const std::function<void()>& task) {
+        if (load_meta_pool == nullptr || !load_meta_pool->submit_func(task).ok()) {
+            task();
+        }
+    };
+
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    std::mutex tablet_ids_lock;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    const std::string& value) -> bool {
+    auto load_tablet = [this, &tablet_ids_lock, &tablet_ids, &failed_tablet_ids](
+                               int64_t tablet_id, int32_t schema_hash, const std::string& value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_lock);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -441,9 +465,19 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    auto load_tablet_func = [&load_tablet, &run_load_meta_task](
+                                    int64_t tablet_id, int32_t schema_hash,
+                                    const std::string& value) -> bool {
+        run_load_meta_task([&load_tablet, tablet_id, schema_hash, value]() {
+            load_tablet(tablet_id, schema_hash, value);
+        });
         return true;
     };
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    if (load_meta_pool != nullptr) {
+        load_meta_pool->wait();
+    }
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
                      << ", loaded tablet: " << tablet_ids.size()
@@ -588,10 +622,10 @@ Status DataDir::load() {
         }
     }
 
-    auto load_delete_bitmap_func = [this](int64_t tablet_id, int64_t version, const string& val) {
+    auto load_delete_bitmap = [this](int64_t tablet_id, int64_t version, const string& val) {
         TabletSharedPtr tablet = _engine.tablet_manager()->get_tablet(tablet_id);
         if (!tablet) {
-            return true;
+            return;
         }
         const std::vector<RowsetMetaSharedPtr>& all_rowsets = tablet->tablet_meta()->all_rs_metas();
         RowsetIdUnorderedSet rowset_ids;
@@ -606,6 +640,9 @@ Status DataDir::load() {
         int seg_maps_size = delete_bitmap_pb.segment_delete_bitmaps_size();
         CHECK(rst_ids_size == seg_ids_size && seg_ids_size == seg_maps_size);
 
+        // the bitmaps are decoded without the lock, the versions of one tablet may be loaded
+        // by several threads at the same time
+        std::vector<std::pair<DeleteBitmap::BitmapKey, roaring::Roaring>> bitmaps;
         for (size_t i = 0; i < rst_ids_size; ++i) {
             RowsetId rst_id;
             rst_id.init(delete_bitmap_pb.rowset_ids(i));
@@ -614,19 +651,30 @@ Status DataDir::load() {
                 continue;
             }
             auto seg_id = delete_bitmap_pb.segment_ids(i);
-            auto iter = tablet->tablet_meta()->delete_bitmap().delete_bitmap.find(
-                    {rst_id, seg_id, version});
-            // This version of delete bitmap already exists
-            if (iter != tablet->tablet_meta()->delete_bitmap().delete_bitmap.end()) {
-                continue;
-            }
             auto bitmap = delete_bitmap_pb.segment_delete_bitmaps(i).data();
-            tablet->tablet_meta()->delete_bitmap().delete_bitmap[{rst_id, seg_id, version}] =
-                    roaring::Roaring::read(bitmap);
+            bitmaps.emplace_back(DeleteBitmap::BitmapKey {rst_id, seg_id, version},
+                                 roaring::Roaring::read(bitmap));
+        }
+        auto& delete_bitmap = tablet->tablet_meta()->delete_bitmap();
+        std::lock_guard l(delete_bitmap.lock);
+        for (auto& [key, bitmap] : bitmaps) {
+            // This version of delete bitmap already exists
+            delete_bitmap.delete_bitmap.try_emplace(key, std::move(bitmap));
         }
+    };
+    auto load_delete_bitmap_func = [&load_delete_bitmap, &run_load_meta_task](
+                                           int64_t tablet_id, int64_t version, const string& val) {
+        run_load_meta_task([&load_delete_bitmap, tablet_id, version, val]() {
+            load_delete_bitmap(tablet_id, version, val);
+        });
         return true;
     };
-    RETURN_IF_ERROR(TabletMetaManager::traverse_delete_bitmap(_meta, load_delete_bitmap_func));
+    Status load_delete_bitmap_status =
+            TabletMetaManager::traverse_delete_bitmap(_meta, load_delete_bitmap_func);
+    if (load_meta_pool != nullptr) {
+        load_meta_pool->wait();
+    }
+    RETURN_IF_ERROR(load_delete_bitmap_status);
 
     // At startup, we only count these invalid rowset, but do not actually delete it.
     // The actual delete operation is in StorageEngine::_clean_unused_rowset_metas,
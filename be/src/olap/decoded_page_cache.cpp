@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/decoded_page_cache.h"
+
+#include "runtime/exec_env.h"
+
+namespace doris {
+
+DecodedPageCache* DecodedPageCache::instance() {
+    return ExecEnv::GetInstance()->get_decoded_page_cache();
+}
+
+vectorized::ColumnPtr DecodedPageCache::lookup_column(const StoragePageCache::CacheKey& key) {
+    auto* lru_handle = lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return nullptr;
+    }
+    // The value keeps a reference of the column, so it is safe to release the handle.
+    auto column = ((CacheValue*)LRUCachePolicy::value(lru_handle))->column;
+    release(lru_handle);
+    return column;
+}
+
+void DecodedPageCache::insert_column(const StoragePageCache::CacheKey& key,
+                                     vectorized::ColumnPtr column) {
+    size_t bytes = column->allocated_bytes();
+    auto* value = new CacheValue(std::move(column));
+    auto* lru_handle = insert(key.encode(), value, bytes, bytes, CachePriority::NORMAL);
+    release(lru_handle);
+}
+
+} // namespace doris
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/config.h"
+#include "olap/page_cache.h"
+#include "runtime/memory/lru_cache_policy.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+
+// Caches the decoded values of data pages, it is a tier above the DataPageCache of
+// StoragePageCache and uses the same key. A hit saves the decoding of the page at the
+// cost of the memory of the decoded column, so it is disabled by default and has its
+// own capacity, see config::decoded_page_cache_limit.
+class DecodedPageCache : public LRUCachePolicy {
+public:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        explicit CacheValue(vectorized::ColumnPtr column_)
+                : LRUCacheValueBase(CachePolicy::CacheType::DECODED_PAGE_CACHE),
+                  column(std::move(column_)) {}
+
+        vectorized::ColumnPtr column;
+    };
+
+    DecodedPageCache(size_t capacity, uint32_t num_shards)
+            : LRUCachePolicy(CachePolicy::CacheType::DECODED_PAGE_CACHE, capacity,
+                             LRUCacheType::SIZE, config::decoded_page_cache_stale_sweep_time_sec,
+                             num_shards) {}
+
+    // A miss decodes the page again, usually from the data page cache.
+    double refill_cost_per_byte() override { return 0.25; }
+
+    // Returns nullptr if the cache is disabled.
+    static DecodedPageCache* instance();
+
+    // Returns nullptr if the page is not cached. The returned column is immutable
+    // and shared with the cache.
+    vectorized::ColumnPtr lookup_column(const StoragePageCache::CacheKey& key);
+
+    void insert_column(const StoragePageCache::CacheKey& key, vectorized::ColumnPtr column);
+};
+
+} // namespace doris
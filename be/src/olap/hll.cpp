@@ -17,6 +17,8 @@
 
 #include "olap/hll.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <map>
 #include <new>
@@ -142,6 +144,71 @@ void HyperLogLog::merge(const HyperLogLog& other) {
     }
 }
 
+void HyperLogLog::_prepare_registers_for_merge() {
+    switch (_type) {
+    case HLL_DATA_EMPTY:
+        _registers = new uint8_t[HLL_REGISTERS_COUNT];
+        memset(_registers, 0, HLL_REGISTERS_COUNT);
+        break;
+    case HLL_DATA_EXPLICIT:
+        _convert_explicit_to_register();
+        break;
+    default:
+        break;
+    }
+    _type = HLL_DATA_FULL;
+}
+
+bool HyperLogLog::merge_serialized(const Slice& slice) {
+    if (slice.data == nullptr || slice.size <= 0 || !is_valid(slice)) {
+        return false;
+    }
+    const uint8_t* ptr = (uint8_t*)slice.data;
+    auto type = (HllDataType)*ptr++;
+    switch (type) {
+    case HLL_DATA_EMPTY:
+        break;
+    case HLL_DATA_EXPLICIT: {
+        uint8_t num_explicits = *ptr++;
+        if (_type == HLL_DATA_EMPTY || _type == HLL_DATA_EXPLICIT) {
+            for (int i = 0; i < num_explicits; ++i) {
+                _hash_set.insert(decode_fixed64_le(ptr));
+                ptr += 8;
+            }
+            _type = HLL_DATA_EXPLICIT;
+            if (_hash_set.size() > HLL_EXPLICIT_INT64_NUM) {
+                _convert_explicit_to_register();
+                _type = HLL_DATA_FULL;
+            }
+        } else {
+            for (int i = 0; i < num_explicits; ++i) {
+                _update_registers(decode_fixed64_le(ptr));
+                ptr += 8;
+            }
+        }
+        break;
+    }
+    case HLL_DATA_SPARSE: {
+        _prepare_registers_for_merge();
+        uint32_t num_registers = decode_fixed32_le(ptr);
+        ptr += 4;
+        for (uint32_t i = 0; i < num_registers; ++i) {
+            uint16_t register_idx = decode_fixed16_le(ptr);
+            ptr += 2;
+            _registers[register_idx] = std::max(_registers[register_idx], *ptr++);
+        }
+        break;
+    }
+    case HLL_DATA_FULL:
+        _prepare_registers_for_merge();
+        _merge_registers(ptr);
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
+
 size_t HyperLogLog::max_serialized_size() const {
     switch (_type) {
     case HLL_DATA_EMPTY:
@@ -340,12 +407,17 @@ int64_t HyperLogLog::estimate_cardinality() const {
     float harmonic_mean = 0;
     int num_zero_registers = 0;
 
-    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0f, -_registers[i]);
-
-        if (_registers[i] == 0) {
-            ++num_zero_registers;
+    // 2^-r of all the register values r, instead of a powf for each register
+    static const std::array<float, 256> inverse_powers = [] {
+        std::array<float, 256> powers;
+        for (size_t i = 0; i < powers.size(); ++i) {
+            powers[i] = powf(2.0f, -static_cast<float>(i));
         }
+        return powers;
+    }();
+    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
+        harmonic_mean += inverse_powers[_registers[i]];
+        num_zero_registers += (_registers[i] == 0);
     }
 
     harmonic_mean = 1.0f / harmonic_mean;
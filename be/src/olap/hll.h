@@ -26,6 +26,8 @@
 
 #ifdef __x86_64__
 #include <immintrin.h>
+#elif defined(__aarch64__)
+#include <sse2neon.h>
 #endif
 
 #include "vec/common/hash_table/phmap_fwd_decl.h"
@@ -208,6 +210,10 @@ public:
 
     void merge(const HyperLogLog& other);
 
+    // Merge the hll serialized in `slice` into this one as `merge` does, but reads its values
+    // and registers in place instead of deserializing it first. Return false if it is invalid.
+    bool merge_serialized(const Slice& slice);
+
     // Return max size of serialized binary
     size_t max_serialized_size() const;
 
@@ -276,6 +282,9 @@ private:
 private:
     void _convert_explicit_to_register();
 
+    // make this hll a full one to merge registers into, as `merge` does before merging
+    void _prepare_registers_for_merge();
+
     // update one hash value into this registers
     void _update_registers(uint64_t hash_value) {
         // Use the lower bits to index into the number of streams and then
@@ -301,6 +310,17 @@ private:
             src += 32;
             dst += 32;
         }
+#elif defined(__SSE2__) || defined(__aarch64__)
+        int loop = HLL_REGISTERS_COUNT / 16; // 16 = 128/8
+        uint8_t* dst = _registers;
+        const uint8_t* src = other_registers;
+        for (int i = 0; i < loop; i++) {
+            __m128i xa = _mm_loadu_si128((const __m128i*)dst);
+            __m128i xb = _mm_loadu_si128((const __m128i*)src);
+            _mm_storeu_si128((__m128i*)dst, _mm_max_epu8(xa, xb));
+            src += 16;
+            dst += 16;
+        }
 #else
         for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
             _registers[i] =
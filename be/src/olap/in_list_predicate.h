@@ -407,6 +407,21 @@ private:
                         << " rowsetid=" << segid.first << " segmentid=" << segid.second
                         << "dict_info" << nested_col_ptr->dict_debug_string();
 
+                if (data_array.size() == size) {
+                    // dense dict codes, evaluate with simd bitmask
+                    const auto* __restrict codes = data_array.data();
+                    const auto* __restrict in_dict = value_in_dict_flags.data();
+                    return evaluate_dense_column_by_bitmask(size, sel, [&](uint32_t idx) {
+                        bool selected = (is_opposite != (PT == PredicateType::IN_LIST)) ==
+                                        (in_dict[codes[idx]] != 0);
+                        if constexpr (is_nullable) {
+                            return (*null_map)[idx] ? is_opposite : selected;
+                        } else {
+                            return selected;
+                        }
+                    });
+                }
+
                 for (uint16_t i = 0; i < size; i++) {
                     uint16_t idx = sel[i];
                     if constexpr (is_nullable) {
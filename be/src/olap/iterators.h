@@ -27,6 +27,7 @@
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/tablet_schema.h"
 #include "runtime/runtime_state.h"
+#include "vec/common/arena.h"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr.h"
 
@@ -44,6 +45,16 @@ namespace segment_v2 {
 struct StreamReader;
 }
 
+// Column predicates built from the runtime filters which arrive after the scan has started.
+// The scanner replaces them between two blocks and bumps `version`, then every segment
+// iterator re-runs the page pruning by zone map and bloom filter on its unread rows.
+struct LateArrivalPredicates {
+    int64_t version = 0;
+    std::vector<std::unique_ptr<ColumnPredicate>> predicates;
+    // holds the string values of the predicates
+    vectorized::Arena arena;
+};
+
 class StorageReadOptions {
 public:
     struct KeyRange {
@@ -102,6 +113,7 @@ public:
     // flag for enable topn opt
     bool use_topn_opt = false;
     std::vector<int> topn_filter_source_node_ids;
+    std::shared_ptr<LateArrivalPredicates> late_arrival_predicates;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
     bool read_orderby_key_reverse = false;
     // columns for orderby keys
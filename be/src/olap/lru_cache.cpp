@@ -502,6 +502,20 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     return {pruned_count, pruned_size};
 }
 
+PrunedInfo LRUCache::prune_usage(size_t usage) {
+    size_t freed = 0;
+    // The lists are in LRU order, stop at the first entry once enough is freed.
+    return prune_if(
+            [&](const LRUHandle* e) {
+                if (freed >= usage) {
+                    return false;
+                }
+                freed += e->total_size;
+                return true;
+            },
+            true);
+}
+
 void LRUCache::set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor) {
     _cache_value_time_extractor = cache_value_time_extractor;
 }
@@ -627,6 +641,34 @@ PrunedInfo ShardedLRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     return pruned_info;
 }
 
+PrunedInfo ShardedLRUCache::prune_usage(size_t usage) {
+    PrunedInfo pruned_info;
+    // Spread to all shards, so the oldest entries of every shard are pruned.
+    const size_t per_shard = (usage + (_num_shards - 1)) / _num_shards;
+    for (int s = 0; s < _num_shards; s++) {
+        PrunedInfo info = _shards[s]->prune_usage(per_shard);
+        pruned_info.pruned_count += info.pruned_count;
+        pruned_info.pruned_size += info.pruned_size;
+    }
+    return pruned_info;
+}
+
+uint64_t ShardedLRUCache::get_lookup_count() {
+    uint64_t total_lookup_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_lookup_count += _shards[i]->get_lookup_count();
+    }
+    return total_lookup_count;
+}
+
+uint64_t ShardedLRUCache::get_hit_count() {
+    uint64_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+    return total_hit_count;
+}
+
 int64_t ShardedLRUCache::get_usage() {
     size_t total_usage = 0;
     for (int i = 0; i < _num_shards; i++) {
@@ -225,8 +225,16 @@ public:
     // may hold lock for a long time to execute predicate.
     virtual PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false) { return {0, 0}; }
 
+    // Prune the entries not in use, in the eviction order, until `usage` of get_usage()
+    // is freed or there is no entry can be pruned.
+    virtual PrunedInfo prune_usage(size_t usage) { return {0, 0}; }
+
     virtual int64_t get_usage() = 0;
 
+    // Number of lookups and hits since the cache is created.
+    virtual uint64_t get_lookup_count() { return 0; }
+    virtual uint64_t get_hit_count() { return 0; }
+
     virtual size_t get_total_capacity() = 0;
 
 private:
@@ -341,6 +349,8 @@ public:
     void erase(const CacheKey& key, uint32_t hash);
     PrunedInfo prune();
     PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false);
+    // Prune the oldest entries until `usage` is freed.
+    PrunedInfo prune_usage(size_t usage);
 
     void set_cache_value_time_extractor(CacheValueTimeExtractor cache_value_time_extractor);
     void set_cache_value_check_timestamp(bool cache_value_check_timestamp);
@@ -401,8 +411,11 @@ public:
     virtual uint64_t new_id() override;
     PrunedInfo prune() override;
     PrunedInfo prune_if(CachePrunePredicate pred, bool lazy_mode = false) override;
+    PrunedInfo prune_usage(size_t usage) override;
     int64_t get_usage() override;
     size_t get_total_capacity() override { return _total_capacity; };
+    uint64_t get_lookup_count() override;
+    uint64_t get_hit_count() override;
 
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
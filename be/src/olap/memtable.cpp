@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -35,11 +36,16 @@
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "tablet_meta.h"
+#include "util/bit_util.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_decimal.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
 
 namespace doris {
 
@@ -71,6 +77,8 @@ MemTable::MemTable(int64_t tablet_id, const TabletSchema* tablet_schema,
     // TODO: Support ZOrderComparator in the future
     _init_columns_offset_by_slot_descs(slot_descs, tuple_desc);
     _num_columns = _tablet_schema->num_columns();
+    _sort_on_insert =
+            config::enable_memtable_sort_on_insert && _tablet_schema->num_key_columns() > 0;
     if (partial_update_info != nullptr) {
         _is_partial_update = partial_update_info->is_partial_update;
         if (_is_partial_update) {
@@ -148,7 +156,6 @@ MemTable::~MemTable() {
             }
         }
     }
-    std::for_each(_row_in_blocks.begin(), _row_in_blocks.end(), std::default_delete<RowInBlock>());
     _insert_mem_tracker->release(_mem_usage);
     _flush_mem_tracker->set_consumption(0);
     DCHECK_EQ(_insert_mem_tracker->consumption(), 0)
@@ -159,26 +166,123 @@ MemTable::~MemTable() {
     _agg_buffer_pool.clear();
     _vec_row_comparator.reset();
     _row_in_blocks.clear();
+    _row_in_block_chunks.clear();
     _agg_functions.clear();
     _input_mutable_block.clear();
     _output_mutable_block.clear();
 }
 
-int RowInBlockComparator::operator()(const RowInBlock* left, const RowInBlock* right) const {
+int RowInBlockComparator::_compare_columns(const RowInBlock* left, const RowInBlock* right) const {
     return _pblock->compare_at(left->_row_pos, right->_row_pos, _tablet_schema->num_key_columns(),
                                *_pblock, -1);
 }
 
+template <typename T>
+static uint64_t int_key_prefix(T value) {
+    // flip the sign bit, so that the signed values are ordered as unsigned
+    if constexpr (std::is_same_v<T, vectorized::Int128>) {
+        return static_cast<uint64_t>(static_cast<int64_t>(value >> 64)) ^ (1ULL << 63);
+    } else if constexpr (std::is_signed_v<T>) {
+        return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (1ULL << 63);
+    } else {
+        return static_cast<uint64_t>(value);
+    }
+}
+
+template <typename ColumnType>
+static bool fill_int_key_prefixes(const vectorized::IColumn& column, RowInBlock* const* rows,
+                                  size_t num_rows) {
+    const auto* typed_column = vectorized::check_and_get_column<ColumnType>(column);
+    if (typed_column == nullptr) {
+        return false;
+    }
+    const auto& data = typed_column->get_data();
+    for (size_t i = 0; i < num_rows; ++i) {
+        if constexpr (vectorized::IsDecimalNumber<typename ColumnType::value_type>) {
+            rows[i]->_key_prefix = int_key_prefix(data[rows[i]->_row_pos].value);
+        } else {
+            rows[i]->_key_prefix = int_key_prefix(data[rows[i]->_row_pos]);
+        }
+    }
+    return true;
+}
+
+// Fill the key prefixes of the rows by the first key column, return false if the type of the
+// column is not supported.
+static bool fill_key_prefixes(const vectorized::IColumn& column, RowInBlock* const* rows,
+                              size_t num_rows) {
+    if (const auto* nullable =
+                vectorized::check_and_get_column<vectorized::ColumnNullable>(column)) {
+        if (!fill_key_prefixes(nullable->get_nested_column(), rows, num_rows)) {
+            return false;
+        }
+        // the nulls are the smallest, so halve the prefixes of the values to make room for them
+        const auto& null_map = nullable->get_null_map_data();
+        for (size_t i = 0; i < num_rows; ++i) {
+            rows[i]->_key_prefix =
+                    null_map[rows[i]->_row_pos] ? 0 : (rows[i]->_key_prefix >> 1) + 1;
+        }
+        return true;
+    }
+    if (const auto* strings = vectorized::check_and_get_column<vectorized::ColumnString>(column)) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            StringRef value = strings->get_data_at(rows[i]->_row_pos);
+            // the missing bytes are zeros, which are ordered before any byte
+            uint64_t prefix = 0;
+            memcpy(&prefix, value.data, std::min<size_t>(value.size, sizeof(prefix)));
+            rows[i]->_key_prefix = BitUtil::big_endian(prefix);
+        }
+        return true;
+    }
+    return fill_int_key_prefixes<vectorized::ColumnInt8>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnInt16>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnInt32>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnInt64>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnInt128>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnUInt8>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnUInt32>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnUInt64>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnDecimal32>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnDecimal64>(column, rows, num_rows) ||
+           fill_int_key_prefixes<vectorized::ColumnDecimal128V3>(column, rows, num_rows);
+}
+
+RowInBlock* MemTable::_new_row_in_block(size_t row_pos) {
+    static constexpr size_t ROW_IN_BLOCK_CHUNK_SIZE = 4096;
+    if (_row_in_block_chunks.empty() ||
+        _row_in_block_chunks.back().size() == ROW_IN_BLOCK_CHUNK_SIZE) {
+        // never grows beyond the reserved size, so the rows are never moved
+        _row_in_block_chunks.emplace_back().reserve(ROW_IN_BLOCK_CHUNK_SIZE);
+    }
+    return &_row_in_block_chunks.back().emplace_back(row_pos);
+}
+
+// The rows of a block written to a single tablet, e.g. by a load into one partition and bucket,
+// are contiguous, and they are inserted as a range which copies each column at once instead of
+// gathering it row by row.
+static bool is_contiguous_rows(const std::vector<uint32_t>& row_idxs) {
+    for (size_t i = 1; i < row_idxs.size(); ++i) {
+        if (row_idxs[i] != row_idxs[i - 1] + 1) {
+            return false;
+        }
+    }
+    return !row_idxs.empty();
+}
+
 void MemTable::insert(const vectorized::Block* input_block, const std::vector<uint32_t>& row_idxs,
                       bool is_append) {
-    vectorized::Block target_block = *input_block;
-    target_block = input_block->copy_block(_column_offset);
+    vectorized::Block target_block = input_block->copy_block(_column_offset);
     if (_is_first_insertion) {
         _is_first_insertion = false;
         auto cloneBlock = target_block.clone_without_columns();
         _input_mutable_block = vectorized::MutableBlock::build_mutable_block(&cloneBlock);
         _vec_row_comparator->set_block(&_input_mutable_block);
         _output_mutable_block = vectorized::MutableBlock::build_mutable_block(&cloneBlock);
+        if (_tablet_schema->num_key_columns() > 0) {
+            // check the type of the first key column only
+            _has_key_prefix =
+                    fill_key_prefixes(*_input_mutable_block.get_column_by_position(0), nullptr, 0);
+        }
         if (_keys_type != KeysType::DUP_KEYS) {
             _init_agg_functions(&target_block);
         }
@@ -205,6 +309,8 @@ void MemTable::insert(const vectorized::Block* input_block, const std::vector<ui
         // Append the block, call insert range from
         _input_mutable_block.add_rows(&target_block, 0, target_block.rows());
         num_rows = target_block.rows();
+    } else if (is_contiguous_rows(row_idxs)) {
+        _input_mutable_block.add_rows(&target_block, row_idxs[0], num_rows);
     } else {
         _input_mutable_block.add_rows(&target_block, row_idxs.data(), row_idxs.data() + num_rows);
     }
@@ -215,7 +321,17 @@ void MemTable::insert(const vectorized::Block* input_block, const std::vector<ui
     _mem_usage += input_size;
     _insert_mem_tracker->consume(input_size);
     for (int i = 0; i < num_rows; i++) {
-        _row_in_blocks.emplace_back(new RowInBlock {cursor_in_mutableblock + i});
+        _row_in_blocks.emplace_back(_new_row_in_block(cursor_in_mutableblock + i));
+    }
+    if (_has_key_prefix && num_rows > 0) {
+        fill_key_prefixes(*_input_mutable_block.get_column_by_position(0),
+                          _row_in_blocks.data() + _row_in_blocks.size() - num_rows, num_rows);
+    }
+    if (_sort_on_insert && num_rows > 0) {
+        SCOPED_RAW_TIMER(&_stat.sort_ns);
+        size_t run_begin = _row_in_blocks.size() - num_rows;
+        _same_keys_num_in_runs += _sort_rows(run_begin, _row_in_blocks.size());
+        _sorted_run_ends.push_back(_row_in_blocks.size());
     }
 
     _stat.raw_rows += num_rows;
@@ -258,9 +374,40 @@ void MemTable::_put_into_output(vectorized::Block& in_block) {
 size_t MemTable::_sort() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
-    size_t same_keys_num = 0;
+    if (!_sorted_run_ends.empty()) {
+        return _merge_sorted_runs();
+    }
     // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks.size());
+    size_t same_keys_num = _sort_rows(_last_sorted_pos, _row_in_blocks.size());
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    // merge new rows and old rows
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
+                                                   const RowInBlock* r) -> bool {
+        auto value = (*(this->_vec_row_comparator))(l, r);
+        if (value == 0) {
+            same_keys_num++;
+            return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
+        } else {
+            return value < 0;
+        }
+    };
+    auto new_row_it = std::next(_row_in_blocks.begin(), _last_sorted_pos);
+    std::inplace_merge(_row_in_blocks.begin(), new_row_it, _row_in_blocks.end(), cmp_func);
+    _last_sorted_pos = _row_in_blocks.size();
+    return same_keys_num;
+}
+
+size_t MemTable::_sort_rows(size_t begin, size_t end) {
+    size_t same_keys_num = 0;
+    Tie tie = Tie(begin, end);
+    if (_has_key_prefix) {
+        // sort by the key prefixes first, then only the rows with the same prefix compare
+        // the columns
+        _sort_one_column(_row_in_blocks, tie, [](const RowInBlock* lhs, const RowInBlock* rhs) {
+            return lhs->_key_prefix < rhs->_key_prefix ? -1 : lhs->_key_prefix > rhs->_key_prefix;
+        });
+    }
     for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
         auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
             return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
@@ -278,21 +425,63 @@ size_t MemTable::_sort() {
                 });
         same_keys_num += iter.right() - iter.left();
     }
-    // merge new rows and old rows
+    return same_keys_num;
+}
+
+size_t MemTable::_merge_sorted_runs() {
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    size_t same_keys_num = _same_keys_num_in_runs;
     _vec_row_comparator->set_block(&_input_mutable_block);
-    auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
-                                                   const RowInBlock* r) -> bool {
-        auto value = (*(this->_vec_row_comparator))(l, r);
+    // [begin, end) of the runs, the rows sorted before are the first run
+    std::vector<std::pair<size_t, size_t>> runs;
+    runs.reserve(_sorted_run_ends.size() + 1);
+    if (_last_sorted_pos > 0) {
+        runs.emplace_back(0, _last_sorted_pos);
+    }
+    size_t begin = _last_sorted_pos;
+    for (size_t end : _sorted_run_ends) {
+        runs.emplace_back(begin, end);
+        begin = end;
+    }
+    DCHECK_EQ(begin, _row_in_blocks.size());
+
+    // a min heap of the runs by their next rows, the equal keys are ordered as in _sort
+    auto greater = [&](size_t l, size_t r) -> bool {
+        const RowInBlock* lhs = _row_in_blocks[runs[l].first];
+        const RowInBlock* rhs = _row_in_blocks[runs[r].first];
+        auto value = (*_vec_row_comparator)(lhs, rhs);
         if (value == 0) {
+            return is_dup ? lhs->_row_pos < rhs->_row_pos : lhs->_row_pos > rhs->_row_pos;
+        }
+        return value > 0;
+    };
+    std::vector<size_t> heap(runs.size());
+    std::iota(heap.begin(), heap.end(), 0);
+    std::make_heap(heap.begin(), heap.end(), greater);
+    std::vector<RowInBlock*> merged;
+    merged.reserve(_row_in_blocks.size());
+    size_t prev_run = runs.size();
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), greater);
+        size_t run = heap.back();
+        RowInBlock* row = _row_in_blocks[runs[run].first++];
+        // the same keys in one run have been counted when it was sorted
+        if (run != prev_run && !merged.empty() &&
+            (*_vec_row_comparator)(merged.back(), row) == 0) {
             same_keys_num++;
-            return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
+        }
+        merged.push_back(row);
+        prev_run = run;
+        if (runs[run].first == runs[run].second) {
+            heap.pop_back();
         } else {
-            return value < 0;
+            std::push_heap(heap.begin(), heap.end(), greater);
         }
-    };
-    auto new_row_it = std::next(_row_in_blocks.begin(), _last_sorted_pos);
-    std::inplace_merge(_row_in_blocks.begin(), new_row_it, _row_in_blocks.end(), cmp_func);
+    }
+    _row_in_blocks.swap(merged);
     _last_sorted_pos = _row_in_blocks.size();
+    _sorted_run_ends.clear();
+    _same_keys_num_in_runs = 0;
     return same_keys_num;
 }
 
@@ -52,6 +52,10 @@ struct RowInBlock {
     size_t _row_pos;
     char* _agg_mem = nullptr;
     size_t* _agg_state_offset = nullptr;
+    // The first 8 bytes of the normalized first key column, which never decreases with the key.
+    // Two rows with different prefixes are ordered by them without reading the columns, the
+    // rows with the same prefix have to compare the columns.
+    uint64_t _key_prefix = 0;
     bool _has_init_agg;
 
     RowInBlock(size_t row) : _row_pos(row), _has_init_agg(false) {}
@@ -134,9 +138,16 @@ public:
     // only first time insert block to create _input_mutable_block,
     // so can not Comparator of construct to set pblock
     void set_block(vectorized::MutableBlock* pblock) { _pblock = pblock; }
-    int operator()(const RowInBlock* left, const RowInBlock* right) const;
+    int operator()(const RowInBlock* left, const RowInBlock* right) const {
+        if (left->_key_prefix != right->_key_prefix) {
+            return left->_key_prefix < right->_key_prefix ? -1 : 1;
+        }
+        return _compare_columns(left, right);
+    }
 
 private:
+    int _compare_columns(const RowInBlock* left, const RowInBlock* right) const;
+
     const TabletSchema* _tablet_schema = nullptr;
     vectorized::MutableBlock* _pblock = nullptr; //  corresponds to Memtable::_input_mutable_block
 };
@@ -242,9 +253,19 @@ private:
     vectorized::MutableBlock _input_mutable_block;
     vectorized::MutableBlock _output_mutable_block;
     size_t _last_sorted_pos = 0;
+    // Whether each insert is sorted as a run when it arrives
+    bool _sort_on_insert = false;
+    // The ends of the sorted runs after _last_sorted_pos
+    std::vector<size_t> _sorted_run_ends;
+    // The same keys in the sorted runs, found when they were sorted
+    size_t _same_keys_num_in_runs = 0;
 
     //return number of same keys
     size_t _sort();
+    // sort the rows in [begin, end) of _row_in_blocks, return number of same keys
+    size_t _sort_rows(size_t begin, size_t end);
+    // merge the rows sorted before and the sorted runs, return number of same keys
+    size_t _merge_sorted_runs();
     void _sort_by_cluster_keys();
     void _sort_one_column(std::vector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(const RowInBlock*, const RowInBlock*)> cmp);
@@ -261,6 +282,12 @@ private:
     std::vector<size_t> _offsets_of_aggregate_states;
     size_t _total_size_of_aggregate_states;
     std::vector<RowInBlock*> _row_in_blocks;
+    // The rows are allocated in chunks, so that the rows are close to each other in memory
+    // and are released at once.
+    RowInBlock* _new_row_in_block(size_t row_pos);
+    std::vector<std::vector<RowInBlock>> _row_in_block_chunks;
+    // Whether the type of the first key column supports the key prefix
+    bool _has_key_prefix = false;
     // Memory usage without _arena.
     size_t _mem_usage;
 
@@ -20,7 +20,9 @@
 #include <gen_cpp/olap_file.pb.h>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstddef>
+#include <mutex>
 #include <ostream>
 
 #include "common/config.h"
@@ -45,10 +47,10 @@ bvar::Adder<int64_t> g_flush_task_num("memtable_flush_task_num");
 class MemtableFlushTask final : public Runnable {
 public:
     MemtableFlushTask(FlushToken* flush_token, std::unique_ptr<MemTable> memtable,
-                      int32_t segment_id, int64_t submit_task_time)
+                      std::vector<int32_t> segment_ids, int64_t submit_task_time)
             : _flush_token(flush_token),
               _memtable(std::move(memtable)),
-              _segment_id(segment_id),
+              _segment_ids(std::move(segment_ids)),
               _submit_task_time(submit_task_time) {
         g_flush_task_num << 1;
     }
@@ -56,16 +58,77 @@ public:
     ~MemtableFlushTask() override { g_flush_task_num << -1; }
 
     void run() override {
-        _flush_token->_flush_memtable(std::move(_memtable), _segment_id, _submit_task_time);
+        _flush_token->_flush_memtable(std::move(_memtable), _segment_ids, _submit_task_time);
     }
 
 private:
     FlushToken* _flush_token;
     std::unique_ptr<MemTable> _memtable;
-    int32_t _segment_id;
+    std::vector<int32_t> _segment_ids;
     int64_t _submit_task_time;
 };
 
+// The parts of a memtable flushed in parallel. The flush thread and the helper tasks submitted to
+// the flush pool claim the parts one by one, so the flush thread only waits for the parts that
+// are being flushed and never for a helper task still queued in a busy pool.
+struct ParallelFlushContext {
+    MemTable* memtable = nullptr;
+    const vectorized::Block* block = nullptr;
+    RowsetWriter* rowset_writer = nullptr;
+    std::vector<int32_t> segment_ids;
+
+    std::atomic<size_t> next_part = 0;
+    std::mutex mutex;
+    std::condition_variable cond;
+    size_t finished_parts = 0;
+    Status status;
+    int64_t flush_size = 0;
+
+    // Flush the claimed part and then the following parts until all of them are claimed.
+    // The memtable and the block may be released once the last part finishes, so they are not
+    // touched by a thread which claims nothing.
+    void flush_parts(size_t part) {
+        size_t num_parts = segment_ids.size();
+        for (; part < num_parts; part = next_part++) {
+            size_t num_rows = block->rows();
+            size_t begin = num_rows * part / num_parts;
+            size_t end = num_rows * (part + 1) / num_parts;
+            vectorized::Block part_block = block->clone_empty();
+            for (size_t i = 0; i < part_block.columns(); ++i) {
+                part_block.get_by_position(i).column =
+                        block->get_by_position(i).column->cut(begin, end - begin);
+            }
+            int64_t part_flush_size = 0;
+            Status st = rowset_writer->flush_memtable(&part_block, segment_ids[part],
+                                                      &part_flush_size);
+            std::lock_guard l(mutex);
+            flush_size += part_flush_size;
+            if (!st.ok() && status.ok()) {
+                status = st;
+            }
+            if (++finished_parts == num_parts) {
+                cond.notify_all();
+            }
+        }
+    }
+};
+
+// Split a memtable into several segments only for a duplicate keys table, whose rows are all kept
+// by the flush, so each segment allocated at submit is sure to get rows. Rows aggregated at flush
+// could leave a segment id without a segment, which the rowset writer can not skip.
+static size_t num_flush_segments(MemTable* memtable, RowsetWriter* rowset_writer) {
+    if (config::memtable_flush_max_parallel_segments <= 1 ||
+        rowset_writer->context().tablet_schema->keys_type() != KeysType::DUP_KEYS) {
+        return 1;
+    }
+    auto min_bytes = std::max<int64_t>(config::memtable_flush_parallel_segment_min_bytes, 1);
+    auto num_segments = std::min<int64_t>(
+            {config::memtable_flush_max_parallel_segments,
+             static_cast<int64_t>(memtable->memory_usage()) / min_bytes,
+             memtable->stat().raw_rows.load()});
+    return std::max<int64_t>(num_segments, 1);
+}
+
 std::ostream& operator<<(std::ostream& os, const FlushStatistic& stat) {
     os << "(flush time(ms)=" << stat.flush_time_ns / NANOS_PER_MILLIS
        << ", flush wait time(ms)=" << stat.flush_wait_time_ns / NANOS_PER_MILLIS
@@ -91,8 +154,14 @@ Status FlushToken::submit(std::unique_ptr<MemTable> mem_table) {
         return Status::OK();
     }
     int64_t submit_task_time = MonotonicNanos();
-    auto task = std::make_shared<MemtableFlushTask>(
-            this, std::move(mem_table), _rowset_writer->allocate_segment_id(), submit_task_time);
+    // the segment ids are allocated in the order of the memtables, the order of the rows
+    // which the merge-on-write relies on
+    std::vector<int32_t> segment_ids(num_flush_segments(mem_table.get(), _rowset_writer));
+    for (auto& segment_id : segment_ids) {
+        segment_id = _rowset_writer->allocate_segment_id();
+    }
+    auto task = std::make_shared<MemtableFlushTask>(this, std::move(mem_table),
+                                                    std::move(segment_ids), submit_task_time);
     Status ret = _thread_pool->submit(std::move(task));
     if (ret.ok()) {
         _stats.flush_running_count++;
@@ -131,7 +200,8 @@ Status FlushToken::wait() {
     return Status::OK();
 }
 
-Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, int64_t* flush_size) {
+Status FlushToken::_do_flush_memtable(MemTable* memtable, const std::vector<int32_t>& segment_ids,
+                                      int64_t* flush_size) {
     VLOG_CRITICAL << "begin to flush memtable for tablet: " << memtable->tablet_id()
                   << ", memsize: " << memtable->memory_usage()
                   << ", rows: " << memtable->stat().raw_rows;
@@ -142,7 +212,13 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
     {
         SCOPED_CONSUME_MEM_TRACKER(memtable->flush_mem_tracker());
         std::unique_ptr<vectorized::Block> block = memtable->to_block();
-        RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
+        if (segment_ids.size() == 1) {
+            RETURN_IF_ERROR(
+                    _rowset_writer->flush_memtable(block.get(), segment_ids[0], flush_size));
+        } else {
+            RETURN_IF_ERROR(
+                    _flush_block_in_parallel(memtable, block.get(), segment_ids, flush_size));
+        }
     }
     _memtable_stat += memtable->stat();
     DorisMetrics::instance()->memtable_flush_total->increment(1);
@@ -152,7 +228,41 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
     return Status::OK();
 }
 
-void FlushToken::_flush_memtable(std::unique_ptr<MemTable> memtable_ptr, int32_t segment_id,
+Status FlushToken::_flush_block_in_parallel(MemTable* memtable, const vectorized::Block* block,
+                                            const std::vector<int32_t>& segment_ids,
+                                            int64_t* flush_size) {
+    if (block->rows() < segment_ids.size()) {
+        return Status::InternalError("memtable of {} rows can not be flushed into {} segments",
+                                     block->rows(), segment_ids.size());
+    }
+    auto ctx = std::make_shared<ParallelFlushContext>();
+    ctx->memtable = memtable;
+    ctx->block = block;
+    ctx->rowset_writer = _rowset_writer;
+    ctx->segment_ids = segment_ids;
+    auto load_id = _rowset_writer->load_id();
+    for (size_t i = 1; i < segment_ids.size(); ++i) {
+        // the parts left to a helper which fails to submit are flushed by this thread
+        static_cast<void>(_thread_pool->submit_func([ctx, load_id]() {
+            size_t part = ctx->next_part++;
+            if (part >= ctx->segment_ids.size()) {
+                return;
+            }
+            SCOPED_ATTACH_TASK(ctx->memtable->query_thread_context());
+            signal::set_signal_task_id(load_id);
+            SCOPED_CONSUME_MEM_TRACKER(ctx->memtable->flush_mem_tracker());
+            ctx->flush_parts(part);
+        }));
+    }
+    ctx->flush_parts(ctx->next_part++);
+    std::unique_lock l(ctx->mutex);
+    ctx->cond.wait(l, [&]() { return ctx->finished_parts == ctx->segment_ids.size(); });
+    *flush_size = ctx->flush_size;
+    return ctx->status;
+}
+
+void FlushToken::_flush_memtable(std::unique_ptr<MemTable> memtable_ptr,
+                                 const std::vector<int32_t>& segment_ids,
                                  int64_t submit_task_time) {
     Defer defer {[&]() { _stats.flush_running_count--; }};
     if (_is_shutdown()) {
@@ -173,7 +283,7 @@ void FlushToken::_flush_memtable(std::unique_ptr<MemTable> memtable_ptr, int32_t
     size_t memory_usage = memtable_ptr->memory_usage();
 
     int64_t flush_size;
-    Status s = _do_flush_memtable(memtable_ptr.get(), segment_id, &flush_size);
+    Status s = _do_flush_memtable(memtable_ptr.get(), segment_ids, &flush_size);
 
     {
         std::shared_lock rdlk(_flush_status_lock);
@@ -83,10 +83,16 @@ private:
 private:
     friend class MemtableFlushTask;
 
-    void _flush_memtable(std::unique_ptr<MemTable> memtable_ptr, int32_t segment_id,
-                         int64_t submit_task_time);
+    void _flush_memtable(std::unique_ptr<MemTable> memtable_ptr,
+                         const std::vector<int32_t>& segment_ids, int64_t submit_task_time);
 
-    Status _do_flush_memtable(MemTable* memtable, int32_t segment_id, int64_t* flush_size);
+    Status _do_flush_memtable(MemTable* memtable, const std::vector<int32_t>& segment_ids,
+                              int64_t* flush_size);
+
+    // Flush the rows of the block into one segment per segment id, split by contiguous row
+    // ranges and encoded concurrently by this thread and the tasks submitted to the flush pool.
+    Status _flush_block_in_parallel(MemTable* memtable, const vectorized::Block* block,
+                                    const std::vector<int32_t>& segment_ids, int64_t* flush_size);
 
     // Records the current flush status of the tablet.
     // Note: Once its value is set to Failed, it cannot return to SUCCESS.
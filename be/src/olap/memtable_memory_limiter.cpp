@@ -19,11 +19,14 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
+
 #include "common/config.h"
 #include "olap/memtable_writer.h"
 #include "util/doris_metrics.h"
 #include "util/mem_info.h"
 #include "util/metrics.h"
+#include "util/time.h"
 
 namespace doris {
 DEFINE_GAUGE_METRIC_PROTOTYPE_5ARG(memtable_memory_limiter_mem_consumption, MetricUnit::BYTES, "",
@@ -38,6 +41,8 @@ bvar::Status<int64_t> g_memtable_flush_memory("mm_limiter_mem_flush", 0);
 bvar::Status<int64_t> g_memtable_load_memory("mm_limiter_mem_load", 0);
 bvar::Status<int64_t> g_load_hard_mem_limit("mm_limiter_limit_hard", 0);
 bvar::Status<int64_t> g_load_soft_mem_limit("mm_limiter_limit_soft", 0);
+bvar::Status<int64_t> g_memtable_mem_growth_rate("mm_limiter_mem_growth_rate", 0);
+bvar::Adder<int64_t> g_memtable_predictive_flush_num("mm_limiter_predictive_flush_num");
 
 // Calculate the total memory limit of all load tasks on this BE
 static int64_t calc_process_max_load_memory(int64_t process_mem_limit) {
@@ -74,7 +79,7 @@ Status MemTableMemoryLimiter::init(int64_t process_mem_limit) {
 
 void MemTableMemoryLimiter::register_writer(std::weak_ptr<MemTableWriter> writer) {
     std::lock_guard<std::mutex> l(_lock);
-    _writers.push_back(writer);
+    _writers.push_back(WriterMemItem {std::move(writer)});
 }
 
 int64_t MemTableMemoryLimiter::_avail_mem_lack() {
@@ -105,7 +110,7 @@ bool MemTableMemoryLimiter::_load_usage_low() {
     return _mem_tracker->consumption() <= _load_safe_mem_permit;
 }
 
-void MemTableMemoryLimiter::handle_memtable_flush() {
+void MemTableMemoryLimiter::handle_memtable_flush(int64_t* wait_time_ns) {
     // Check the soft limit.
     DCHECK(_load_soft_mem_limit > 0);
     if (!_soft_limit_reached() || _load_usage_low()) {
@@ -133,6 +138,9 @@ void MemTableMemoryLimiter::handle_memtable_flush() {
         }
     }
     g_memtable_memory_limit_waiting_threads << -1;
+    if (wait_time_ns != nullptr) {
+        *wait_time_ns += timer.elapsed_time();
+    }
     if (_soft_limit_reached()) {
         LOG(INFO) << "reached memtable memory soft limit"
                   << " (active: " << PrettyPrinter::print_bytes(_active_mem_usage)
@@ -202,9 +210,59 @@ int64_t MemTableMemoryLimiter::_flush_memtable(std::weak_ptr<MemTableWriter> wri
     return mem_usage;
 }
 
+void MemTableMemoryLimiter::_predictive_flush() {
+    if (!config::enable_memtable_predictive_flush || _load_soft_mem_limit <= 0 ||
+        _active_writers.empty()) {
+        return;
+    }
+    int64_t now = MonotonicNanos();
+    if (now - _last_predictive_flush_ns <
+        config::memtable_predictive_flush_interval_ms * NANOS_PER_MILLIS) {
+        return;
+    }
+    double horizon_s = config::memtable_predictive_flush_horizon_ms / 1000.0;
+    // the memory of the memtables being flushed is released soon, so it is not counted
+    auto predicted_mem_usage =
+            _write_mem_usage + static_cast<int64_t>(_mem_growth_rate * horizon_s);
+    int64_t need_flush = predicted_mem_usage - _load_soft_mem_limit;
+    if (need_flush <= 0) {
+        return;
+    }
+    _last_predictive_flush_ns = now;
+
+    // flush the memtables which will be the largest at the horizon first
+    std::vector<std::pair<int64_t, std::weak_ptr<MemTableWriter>>> candidates;
+    for (const auto& item : _writers) {
+        if (item.mem_size > 0) {
+            candidates.emplace_back(
+                    item.mem_size + static_cast<int64_t>(item.growth_rate * horizon_s),
+                    item.writer);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& a, const auto& b) { return a.first > b.first; });
+    int64_t mem_flushed = 0;
+    int64_t num_flushed = 0;
+    int64_t avg_mem = _active_mem_usage / _active_writers.size();
+    for (const auto& candidate : candidates) {
+        int64_t mem = _flush_memtable(candidate.second, avg_mem);
+        mem_flushed += mem;
+        num_flushed += (mem > 0);
+        if (mem_flushed >= need_flush) {
+            break;
+        }
+    }
+    g_memtable_predictive_flush_num << num_flushed;
+    LOG(INFO) << "predicted load mem " << PrettyPrinter::print_bytes(predicted_mem_usage)
+              << " reaches soft limit in " << config::memtable_predictive_flush_horizon_ms
+              << " ms, flushed " << num_flushed << " out of " << _active_writers.size()
+              << " active writers, flushed size: " << PrettyPrinter::print_bytes(mem_flushed);
+}
+
 void MemTableMemoryLimiter::refresh_mem_tracker() {
     std::lock_guard<std::mutex> l(_lock);
     _refresh_mem_tracker();
+    _predictive_flush();
     std::stringstream ss;
     Limit limit = Limit::NONE;
     if (_soft_limit_reached()) {
@@ -240,9 +298,26 @@ void MemTableMemoryLimiter::_refresh_mem_tracker() {
     _write_mem_usage = 0;
     _active_mem_usage = 0;
     _active_writers.clear();
+    _mem_growth_rate = 0;
+    // the growth rates are sampled at least 1ms apart to be meaningful
+    int64_t now = MonotonicNanos();
+    bool update_growth_rate = _last_refresh_ns > 0 && now - _last_refresh_ns >= NANOS_PER_MILLIS;
+    double elapsed_s = (now - _last_refresh_ns) / 1e9;
+    if (_last_refresh_ns == 0 || update_growth_rate) {
+        _last_refresh_ns = now;
+    }
     for (auto it = _writers.begin(); it != _writers.end();) {
-        if (auto writer = it->lock()) {
+        if (auto writer = it->writer.lock()) {
             auto active_usage = writer->active_memtable_mem_consumption();
+            if (update_growth_rate) {
+                // a memtable smaller than the last sample has been flushed and replaced by
+                // a new one, which grew from empty
+                int64_t growth = active_usage >= it->mem_size ? active_usage - it->mem_size
+                                                              : active_usage;
+                it->growth_rate = it->growth_rate * 0.8 + growth / elapsed_s * 0.2;
+                it->mem_size = active_usage;
+            }
+            _mem_growth_rate += it->growth_rate;
             _active_mem_usage += active_usage;
             if (active_usage > 0) {
                 _active_writers.push_back(writer);
@@ -260,6 +335,7 @@ void MemTableMemoryLimiter::_refresh_mem_tracker() {
     g_memtable_write_memory.set_value(_write_mem_usage);
     g_memtable_flush_memory.set_value(_flush_mem_usage);
     g_memtable_load_memory.set_value(_mem_usage);
+    g_memtable_mem_growth_rate.set_value(static_cast<int64_t>(_mem_growth_rate));
     VLOG_DEBUG << "refreshed mem_tracker, num writers: " << _writers.size();
     _mem_tracker->set_consumption(_mem_usage);
     if (!_hard_limit_reached()) {
@@ -28,7 +28,10 @@ namespace doris {
 class MemTableWriter;
 struct WriterMemItem {
     std::weak_ptr<MemTableWriter> writer;
-    int64_t mem_size;
+    // active memtable size at the last refresh
+    int64_t mem_size = 0;
+    // growth rate of the active memtable, bytes per second
+    double growth_rate = 0;
 };
 class MemTableMemoryLimiter {
 public:
@@ -39,7 +42,8 @@ public:
 
     // check if the total mem consumption exceeds limit.
     // If yes, it will flush memtable to try to reduce memory consumption.
-    void handle_memtable_flush();
+    // The time the caller is blocked by the hard limit is added to `wait_time_ns` if not null.
+    void handle_memtable_flush(int64_t* wait_time_ns = nullptr);
 
     void register_writer(std::weak_ptr<MemTableWriter> writer);
 
@@ -60,6 +64,7 @@ private:
     void _flush_active_memtables(int64_t need_flush);
     int64_t _flush_memtable(std::weak_ptr<MemTableWriter> writer_to_flush, int64_t threshold);
     void _refresh_mem_tracker();
+    void _predictive_flush();
 
     std::mutex _lock;
     std::condition_variable _hard_limit_end_cond;
@@ -67,6 +72,10 @@ private:
     int64_t _flush_mem_usage = 0;
     int64_t _write_mem_usage = 0;
     int64_t _active_mem_usage = 0;
+    // sum of the growth rates of the active memtables, bytes per second
+    double _mem_growth_rate = 0;
+    int64_t _last_refresh_ns = 0;
+    int64_t _last_predictive_flush_ns = 0;
 
     // mem tracker collection of all mem tables.
     std::shared_ptr<MemTrackerLimiter> _memtable_tracker_set;
@@ -80,7 +89,7 @@ private:
     MonotonicStopWatch _log_timer;
     static const int64_t LOG_INTERVAL = 1 * 1000 * 1000 * 1000; // 1s
 
-    std::vector<std::weak_ptr<MemTableWriter>> _writers;
+    std::vector<WriterMemItem> _writers;
     std::vector<std::weak_ptr<MemTableWriter>> _active_writers;
 };
 } // namespace doris
@@ -22,8 +22,11 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <ostream>
 #include <shared_mutex>
@@ -45,7 +48,9 @@
 #include "olap/tablet.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/thread_context.h"
 #include "util/slice.h"
+#include "util/thread.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
@@ -235,6 +240,120 @@ void Merger::vertical_split_columns(const TabletSchema& tablet_schema,
     }
 }
 
+namespace {
+
+// Reads the blocks of a column group on its own thread, so that reading and merging the input
+// rowsets overlaps with encoding and writing the output segments of a large compaction.
+class VerticalBlockReadAhead {
+public:
+    VerticalBlockReadAhead(vectorized::VerticalBlockReader* reader,
+                           const TabletSchema& tablet_schema, const std::vector<uint32_t>& columns,
+                           bool record_rowids)
+            : _reader(reader),
+              _tablet_schema(tablet_schema),
+              _columns(columns),
+              _record_rowids(record_rowids) {}
+
+    ~VerticalBlockReadAhead() { stop(); }
+
+    Status start() {
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+        return Thread::create(
+                "Compaction", "vertical_read_ahead",
+                [this, mem_tracker]() {
+                    SCOPED_ATTACH_TASK(mem_tracker);
+                    _read();
+                },
+                &_thread);
+    }
+
+    // Wait for the next block, `eof` is set with the last one
+    Status next(vectorized::Block* block, std::vector<RowLocation>* row_locations, bool* eof) {
+        std::unique_lock<std::mutex> l(_lock);
+        _cv.wait(l, [this] { return !_blocks.empty() || _finished; });
+        if (_blocks.empty()) {
+            return _status.ok() ? Status::InternalError("read ahead finished without eof")
+                                : _status;
+        }
+        auto& item = _blocks.front();
+        block->swap(item.block);
+        *row_locations = std::move(item.row_locations);
+        *eof = item.eof;
+        _blocks.pop_front();
+        _cv.notify_all();
+        return Status::OK();
+    }
+
+    // Stop reading and wait for the thread, the reader is not used after this
+    void stop() {
+        if (_thread == nullptr) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            _cancelled = true;
+            _cv.notify_all();
+        }
+        _thread->join();
+        _thread.reset();
+    }
+
+private:
+    static constexpr size_t MAX_BLOCKS = 2;
+
+    struct Item {
+        vectorized::Block block;
+        std::vector<RowLocation> row_locations;
+        bool eof = false;
+    };
+
+    void _read() {
+        Status st;
+        bool eof = false;
+        while (!eof) {
+            if (ExecEnv::GetInstance()->storage_engine().stopped()) {
+                st = Status::Error<INTERNAL_ERROR>("failed to do compaction, engine stopped");
+                break;
+            }
+            Item item {.block = _tablet_schema.create_block(_columns)};
+            st = _reader->next_block_with_aggregation(&item.block, &eof);
+            if (!st.ok()) {
+                break;
+            }
+            if (_record_rowids && item.block.rows() > 0) {
+                item.row_locations = _reader->current_block_row_locations();
+            }
+            item.eof = eof;
+            std::unique_lock<std::mutex> l(_lock);
+            _cv.wait(l, [this] { return _blocks.size() < MAX_BLOCKS || _cancelled; });
+            if (_cancelled) {
+                break;
+            }
+            _blocks.push_back(std::move(item));
+            _cv.notify_all();
+        }
+        std::lock_guard<std::mutex> l(_lock);
+        _status = st;
+        _finished = true;
+        _cv.notify_all();
+    }
+
+    vectorized::VerticalBlockReader* _reader;
+    const TabletSchema& _tablet_schema;
+    const std::vector<uint32_t>& _columns;
+    const bool _record_rowids;
+
+    scoped_refptr<Thread> _thread;
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::deque<Item> _blocks;
+    bool _cancelled = false;
+    bool _finished = false;
+    Status _status;
+};
+
+} // namespace
+
 Status Merger::vertical_compact_one_group(
         BaseTabletSPtr tablet, ReaderType reader_type, const TabletSchema& tablet_schema,
         bool is_key, const std::vector<uint32_t>& column_group,
@@ -292,14 +411,29 @@ Status Merger::vertical_compact_one_group(
         }
     }
 
+    int64_t input_bytes = 0;
+    for (const auto& rs_reader : src_rowset_readers) {
+        input_bytes += rs_reader->rowset()->data_disk_size();
+    }
+    int64_t read_ahead_min_bytes = config::vertical_compaction_read_ahead_min_input_bytes;
+    std::unique_ptr<VerticalBlockReadAhead> read_ahead;
+    if (read_ahead_min_bytes > 0 && input_bytes >= read_ahead_min_bytes) {
+        read_ahead = std::make_unique<VerticalBlockReadAhead>(
+                &reader, tablet_schema, reader_params.return_columns, reader_params.record_rowids);
+        RETURN_IF_ERROR(read_ahead->start());
+    }
+
     vectorized::Block block = tablet_schema.create_block(reader_params.return_columns);
+    std::vector<RowLocation> row_locations;
     size_t output_rows = 0;
     bool eof = false;
     while (!eof && !ExecEnv::GetInstance()->storage_engine().stopped()) {
         // Read one block from block reader
-        RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
-                                       "failed to read next block when merging rowsets of tablet " +
-                                               std::to_string(tablet->tablet_id()));
+        RETURN_NOT_OK_STATUS_WITH_WARN(
+                read_ahead != nullptr ? read_ahead->next(&block, &row_locations, &eof)
+                                      : reader.next_block_with_aggregation(&block, &eof),
+                "failed to read next block when merging rowsets of tablet " +
+                        std::to_string(tablet->tablet_id()));
         RETURN_NOT_OK_STATUS_WITH_WARN(
                 dst_rowset_writer->add_columns(&block, column_group, is_key, max_rows_per_segment),
                 "failed to write block when merging rowsets of tablet " +
@@ -308,12 +442,17 @@ Status Merger::vertical_compact_one_group(
         if (is_key && reader_params.record_rowids && block.rows() > 0) {
             std::vector<uint32_t> segment_num_rows;
             RETURN_IF_ERROR(dst_rowset_writer->get_segment_num_rows(&segment_num_rows));
-            stats_output->rowid_conversion->add(reader.current_block_row_locations(),
+            stats_output->rowid_conversion->add(read_ahead != nullptr
+                                                        ? row_locations
+                                                        : reader.current_block_row_locations(),
                                                 segment_num_rows);
         }
         output_rows += block.rows();
         block.clear_column_data();
     }
+    if (read_ahead != nullptr) {
+        read_ahead->stop();
+    }
     if (ExecEnv::GetInstance()->storage_engine().stopped()) {
         return Status::Error<INTERNAL_ERROR>("tablet {} failed to do compaction, engine stopped",
                                              tablet->tablet_id());
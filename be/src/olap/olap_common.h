@@ -272,6 +272,14 @@ class Field;
 class WrapperField;
 using KeyRange = std::pair<WrapperField*, WrapperField*>;
 
+// The pages of a column read by a reader, see `OlapReaderStatistics::column_io_stats`
+struct ColumnIOStatistics {
+    int64_t compressed_bytes_read = 0;
+    int64_t uncompressed_bytes_read = 0;
+    int64_t total_pages_num = 0;
+    int64_t cached_pages_num = 0;
+};
+
 // ReaderStatistics used to collect statistics when scan data from storage
 struct OlapReaderStatistics {
     int64_t io_ns = 0;
@@ -329,6 +337,15 @@ struct OlapReaderStatistics {
     int64_t rows_key_range_filtered = 0;
     int64_t rows_stats_filtered = 0;
     int64_t rows_stats_rp_filtered = 0;
+    // rows of the unread pages pruned by late arrival runtime filters
+    int64_t rows_late_rf_filtered = 0;
+    // rows of the unread pages pruned by the tightened topn runtime predicates
+    int64_t rows_topn_rp_filtered = 0;
+    // pages read ahead by the segment prefetcher
+    int64_t prefetch_hit_num = 0;
+    int64_t prefetch_miss_num = 0;
+    int64_t prefetch_wait_ns = 0;
+    int64_t prefetch_bytes = 0;
     int64_t rows_bf_filtered = 0;
     int64_t rows_dict_filtered = 0;
     // Including the number of rows filtered out according to the Delete information in the Tablet,
@@ -376,6 +393,10 @@ struct OlapReaderStatistics {
     int64_t collect_iterator_merge_next_timer = 0;
     int64_t collect_iterator_normal_next_timer = 0;
     int64_t delete_bitmap_get_agg_ns = 0;
+
+    // column unique id -> the pages read of the column, only filled if
+    // `config::enable_scan_io_stats`
+    std::map<int32_t, ColumnIOStatistics> column_io_stats;
 };
 
 using ColumnId = uint32_t;
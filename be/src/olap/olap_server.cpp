@@ -56,6 +56,7 @@
 #include "olap/cumulative_compaction_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
 #include "olap/data_dir.h"
+#include "olap/decoded_page_cache.h"
 #include "olap/olap_common.h"
 #include "olap/rowset/segcompaction.h"
 #include "olap/schema_change.h"
@@ -301,6 +302,10 @@ void StorageEngine::_cache_clean_callback() {
                 CacheManager::instance()->clear_once(CachePolicy::CacheType::DATA_PAGE_CACHE);
                 CacheManager::instance()->clear_once(CachePolicy::CacheType::INDEXPAGE_CACHE);
                 CacheManager::instance()->clear_once(CachePolicy::CacheType::PK_INDEX_PAGE_CACHE);
+                if (DecodedPageCache::instance() != nullptr) {
+                    CacheManager::instance()->clear_once(
+                            CachePolicy::CacheType::DECODED_PAGE_CACHE);
+                }
                 _clear_page_cache = true;
             }
         } else {
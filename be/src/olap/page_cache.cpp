@@ -19,7 +19,9 @@
 
 #include <glog/logging.h>
 
+#include <mutex>
 #include <ostream>
+#include <unordered_map>
 
 #include "runtime/exec_env.h"
 
@@ -51,6 +53,29 @@ StoragePageCache::StoragePageCache(size_t capacity, int32_t index_cache_percenta
     _pk_index_page_cache = std::make_unique<PKIndexPageCache>(pk_index_cache_capacity, num_shards);
 }
 
+uint64_t StoragePageCache::intern_file(const std::string& fname, size_t fsize) {
+    // The ids of removed files are never reused, the map is reset when it grows too large
+    // and the pages of the files dropped from it age out of the cache.
+    static constexpr size_t MAX_INTERNED_FILES = 1 << 22;
+    static std::mutex lock;
+    static std::unordered_map<std::string, uint64_t> file_ids;
+    static uint64_t next_file_id = 1;
+
+    std::string key(fname);
+    key.append((char*)&fsize, sizeof(fsize));
+    std::lock_guard l(lock);
+    auto [iter, inserted] = file_ids.try_emplace(std::move(key), next_file_id);
+    if (inserted) {
+        ++next_file_id;
+        if (file_ids.size() > MAX_INTERNED_FILES) {
+            uint64_t file_id = iter->second;
+            file_ids.clear();
+            return file_id;
+        }
+    }
+    return iter->second;
+}
+
 bool StoragePageCache::lookup(const CacheKey& key, PageCacheHandle* handle,
                               segment_v2::PageTypePB page_type) {
     auto* cache = _get_page_cache(page_type);
@@ -85,26 +85,26 @@ class StoragePageCache {
 public:
     // The unique key identifying entries in the page cache.
     // Each cached page corresponds to a specific offset within
-    // a file.
-    //
-    // TODO(zc): Now we use file name(std::string) as a part of
-    // key, which is not efficient. We should make it better later
+    // a file, the file is identified by the id from `intern_file`
+    // so the key has a fixed size and is not copied on lookup.
     struct CacheKey {
-        CacheKey(std::string fname_, size_t fsize_, int64_t offset_)
-                : fname(std::move(fname_)), fsize(fsize_), offset(offset_) {}
-        std::string fname;
-        size_t fsize;
+        CacheKey(uint64_t file_id_, int64_t offset_) : file_id(file_id_), offset(offset_) {}
+        CacheKey(const std::string& fname, size_t fsize, int64_t offset_)
+                : CacheKey(intern_file(fname, fsize), offset_) {}
+        uint64_t file_id;
         int64_t offset;
 
-        // Encode to a flat binary which can be used as LRUCache's key
-        std::string encode() const {
-            std::string key_buf(fname);
-            key_buf.append((char*)&fsize, sizeof(fsize));
-            key_buf.append((char*)&offset, sizeof(offset));
-            return key_buf;
+        // Refer to the fields as LRUCache's key
+        doris::CacheKey encode() const {
+            return {reinterpret_cast<const char*>(this), sizeof(CacheKey)};
         }
     };
 
+    // Returns the id of the file with `fname` and `fsize`, the same file always gets the
+    // same id, so a reopened segment hits the pages cached before. Called once when a
+    // segment is opened, never returns 0.
+    static uint64_t intern_file(const std::string& fname, size_t fsize);
+
     class DataPageCache : public LRUCachePolicy {
     public:
         DataPageCache(size_t capacity, uint32_t num_shards)
@@ -123,6 +123,9 @@ public:
                                  num_shards) {
             init_mem_tracker_by_allocator(lru_cache_type_string(LRUCacheType::SIZE));
         }
+
+        // Index pages are small random reads and needed by every scan of the segment.
+        double refill_cost_per_byte() override { return 2.0; }
     };
 
     class PKIndexPageCache : public LRUCachePolicy {
@@ -133,6 +136,9 @@ public:
                                  config::pk_index_page_cache_stale_sweep_time_sec, num_shards) {
             init_mem_tracker_by_allocator(lru_cache_type_string(LRUCacheType::SIZE));
         }
+
+        // A miss is a random small read (a remote GET in cloud mode) on the load path.
+        double refill_cost_per_byte() override { return 8.0; }
     };
 
     static constexpr uint32_t kDefaultNumShards = 16;
@@ -20,6 +20,7 @@
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/config.h"
+#include "common/config.h"
 #include "olap/rowset/beta_rowset.h"
 #include "pipeline/exec/olap_scan_operator.h"
 #include "vec/exec/scan/new_olap_scanner.h"
@@ -194,7 +195,10 @@ Status ParallelScannerBuilder<ParentType>::_load() {
         }
     }
 
-    _rows_per_scanner = _total_rows / _max_scanners_count;
+    // Split into more scanners than the threads running them, `ScannerContext` hands the pending
+    // scanners to the threads which finish first, so the skewed ranges are shared out.
+    size_t granules = std::max(1, config::parallel_scan_granules_per_scanner);
+    _rows_per_scanner = _total_rows / (_max_scanners_count * granules);
     _rows_per_scanner = std::max<size_t>(_rows_per_scanner, _min_rows_per_scanner);
 
     return Status::OK();
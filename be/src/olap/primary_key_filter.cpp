@@ -0,0 +1,130 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/primary_key_filter.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "common/config.h"
+#include "olap/rowset/rowset.h"
+#include "olap/rowset/segment_v2/bloom_filter.h"
+#include "util/murmur_hash3.h"
+
+namespace doris {
+
+PrimaryKeyFilter::~PrimaryKeyFilter() = default;
+
+uint64_t PrimaryKeyFilter::hash(const Slice& key) {
+    uint64_t hash_code;
+    murmur_hash3_x64_64(key.data, key.size, segment_v2::BloomFilter::DEFAULT_SEED, &hash_code);
+    return hash_code;
+}
+
+Status PrimaryKeyFilter::add_segment(const RowsetId& rowset_id, uint32_t segment_id,
+                                     const std::vector<uint64_t>& key_hashes) {
+    size_t max_keys = config::mow_primary_key_filter_max_keys;
+    std::lock_guard wlock(_lock);
+    auto it = _covered.find(rowset_id);
+    if (it != _covered.end() && (it->second.all || it->second.segment_ids.contains(segment_id))) {
+        return Status::OK();
+    }
+    size_t n = key_hashes.size();
+    if (n > max_keys) {
+        return Status::OK();
+    }
+    if (_filters.empty() || _last_num_keys + n > _last_capacity) {
+        size_t capacity = std::max(_filters.empty() ? INITIAL_CAPACITY : _last_capacity * 2, n);
+        if (_total_capacity + capacity > max_keys) {
+            _reset_unlocked();
+            capacity = std::max(INITIAL_CAPACITY, n);
+        }
+        std::unique_ptr<segment_v2::BloomFilter> filter;
+        RETURN_IF_ERROR(segment_v2::BloomFilter::create(segment_v2::BLOCK_BLOOM_FILTER, &filter));
+        RETURN_IF_ERROR(filter->init(capacity, FPP, segment_v2::HASH_MURMUR3_X64_64));
+        _filters.push_back(std::move(filter));
+        _last_capacity = capacity;
+        _last_num_keys = 0;
+        _total_capacity += capacity;
+    }
+    auto& filter = _filters.back();
+    for (uint64_t key_hash : key_hashes) {
+        filter->add_hash(key_hash);
+    }
+    _last_num_keys += n;
+    _num_keys += n;
+    _covered[rowset_id].segment_ids.insert(segment_id);
+    return Status::OK();
+}
+
+void PrimaryKeyFilter::inherit(const std::vector<RowsetSharedPtr>& inputs,
+                               const RowsetSharedPtr& output) {
+    std::lock_guard wlock(_lock);
+    for (const auto& rowset : inputs) {
+        if (!_covered_unlocked(rowset)) {
+            return;
+        }
+    }
+    _covered[output->rowset_id()].all = true;
+}
+
+bool PrimaryKeyFilter::may_skip(uint64_t key_hash, const std::vector<RowsetSharedPtr>& rowsets,
+                                std::vector<bool>* skip) const {
+    std::shared_lock rlock(_lock);
+    if (_covered.empty()) {
+        return false;
+    }
+    for (const auto& filter : _filters) {
+        if (filter->test_hash(key_hash)) {
+            return false;
+        }
+    }
+    bool skipped = false;
+    skip->assign(rowsets.size(), false);
+    for (size_t i = 0; i < rowsets.size(); ++i) {
+        if (_covered_unlocked(rowsets[i])) {
+            (*skip)[i] = true;
+            skipped = true;
+        }
+    }
+    return skipped;
+}
+
+size_t PrimaryKeyFilter::num_keys() const {
+    std::shared_lock rlock(_lock);
+    return _num_keys;
+}
+
+bool PrimaryKeyFilter::_covered_unlocked(const RowsetSharedPtr& rowset) const {
+    auto it = _covered.find(rowset->rowset_id());
+    if (it == _covered.end()) {
+        return false;
+    }
+    return it->second.all ||
+           static_cast<int64_t>(it->second.segment_ids.size()) == rowset->num_segments();
+}
+
+void PrimaryKeyFilter::_reset_unlocked() {
+    _filters.clear();
+    _covered.clear();
+    _last_capacity = 0;
+    _last_num_keys = 0;
+    _total_capacity = 0;
+    _num_keys = 0;
+}
+
+} // namespace doris
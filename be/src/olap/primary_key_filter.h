@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/rowset_fwd.h"
+#include "util/slice.h"
+
+namespace doris {
+
+namespace segment_v2 {
+class BloomFilter;
+} // namespace segment_v2
+
+// A tablet level summary of the primary keys of a merge-on-write tablet, it lets
+// `BaseTablet::lookup_row_key` skip the rowsets which can not contain a key without probing
+// the primary key index of every segment.
+//
+// The keys of a segment are added when its delete bitmap is calculated, where all of its keys
+// are iterated anyway. A rowset is covered when the keys of all of its segments are added, or
+// when it is the output of a compaction whose input rowsets are all covered. If a key is not in
+// the filter, it is not in any covered rowset.
+//
+// The keys are added into a list of block bloom filters, a new one with twice the capacity is
+// created when the last one is full, so it grows with the tablet. When the total capacity
+// exceeds `config::mow_primary_key_filter_max_keys` the filter is reset.
+class PrimaryKeyFilter {
+public:
+    PrimaryKeyFilter() = default;
+    ~PrimaryKeyFilter();
+
+    // `key` is the encoded primary key without the sequence column and the row id.
+    static uint64_t hash(const Slice& key);
+
+    Status add_segment(const RowsetId& rowset_id, uint32_t segment_id,
+                       const std::vector<uint64_t>& key_hashes);
+
+    // `output` contains no key out of `inputs`.
+    void inherit(const std::vector<RowsetSharedPtr>& inputs, const RowsetSharedPtr& output);
+
+    // Returns true if the key of `key_hash` is not in some of `rowsets`, `skip[i]` is set for
+    // the rowsets which do not contain the key.
+    bool may_skip(uint64_t key_hash, const std::vector<RowsetSharedPtr>& rowsets,
+                  std::vector<bool>* skip) const;
+
+    size_t num_keys() const;
+
+    // the capacity of the first bloom filter
+    static constexpr size_t INITIAL_CAPACITY = 8192;
+    static constexpr double FPP = 0.01;
+
+private:
+    struct CoveredSegments {
+        std::unordered_set<uint32_t> segment_ids;
+        // all segments are covered, set by `inherit`
+        bool all = false;
+    };
+
+    bool _covered_unlocked(const RowsetSharedPtr& rowset) const;
+
+    void _reset_unlocked();
+
+    mutable std::shared_mutex _lock;
+    std::vector<std::unique_ptr<segment_v2::BloomFilter>> _filters;
+    size_t _last_capacity = 0;
+    size_t _last_num_keys = 0;
+    size_t _total_capacity = 0;
+    size_t _num_keys = 0;
+    std::unordered_map<RowsetId, CoveredSegments> _covered;
+};
+
+} // namespace doris
@@ -89,9 +89,11 @@ Status PrimaryKeyIndexBuilder::finalize(segment_v2::PrimaryKeyIndexMetaPB* meta)
 }
 
 Status PrimaryKeyIndexReader::parse_index(io::FileReaderSPtr file_reader,
-                                          const segment_v2::PrimaryKeyIndexMetaPB& meta) {
+                                          const segment_v2::PrimaryKeyIndexMetaPB& meta,
+                                          uint64_t page_cache_file_id) {
     // parse primary key index
-    _index_reader.reset(new segment_v2::IndexedColumnReader(file_reader, meta.primary_key_index()));
+    _index_reader.reset(new segment_v2::IndexedColumnReader(
+            file_reader, meta.primary_key_index(), page_cache_file_id));
     _index_reader->set_is_pk_index(true);
     RETURN_IF_ERROR(_index_reader->load(!config::disable_pk_storage_page_cache, false));
 
@@ -100,11 +102,12 @@ Status PrimaryKeyIndexReader::parse_index(io::FileReaderSPtr file_reader,
 }
 
 Status PrimaryKeyIndexReader::parse_bf(io::FileReaderSPtr file_reader,
-                                       const segment_v2::PrimaryKeyIndexMetaPB& meta) {
+                                       const segment_v2::PrimaryKeyIndexMetaPB& meta,
+                                       uint64_t page_cache_file_id) {
     // parse bloom filter
     segment_v2::ColumnIndexMetaPB column_index_meta = meta.bloom_filter_index();
-    segment_v2::BloomFilterIndexReader bf_index_reader(std::move(file_reader),
-                                                       column_index_meta.bloom_filter_index());
+    segment_v2::BloomFilterIndexReader bf_index_reader(
+            std::move(file_reader), column_index_meta.bloom_filter_index(), page_cache_file_id);
     RETURN_IF_ERROR(bf_index_reader.load(!config::disable_pk_storage_page_cache, false));
     std::unique_ptr<segment_v2::BloomFilterIndexIterator> bf_iter;
     RETURN_IF_ERROR(bf_index_reader.new_iterator(&bf_iter));
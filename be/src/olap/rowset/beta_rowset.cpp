@@ -36,6 +36,7 @@
 #include "io/fs/path.h"
 #include "io/fs/remote_file_system.h"
 #include "olap/olap_common.h"
+#include "olap/block_column_predicate.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_cache.h"
@@ -125,6 +126,65 @@ Status BetaRowset::get_inverted_index_size(size_t* index_size) {
     return Status::OK();
 }
 
+Status BetaRowset::record_key_zone_maps(const std::vector<segment_v2::SegmentSharedPtr>& segments) {
+    if (_key_zone_maps_recorded.load(std::memory_order_acquire) ||
+        segments.size() != static_cast<size_t>(num_segments())) {
+        return Status::OK();
+    }
+    std::vector<std::unordered_map<int32_t, KeyZoneMap>> key_zone_maps(segments.size());
+    for (size_t seg_id = 0; seg_id < segments.size(); ++seg_id) {
+        if (segments[seg_id]->id() != seg_id) {
+            return Status::OK();
+        }
+        for (size_t cid = 0; cid < _schema->num_key_columns(); ++cid) {
+            int32_t unique_id = _schema->column(cid).unique_id();
+            segment_v2::ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(segments[seg_id]->get_column_reader(unique_id, &reader));
+            if (reader == nullptr || reader->segment_zone_map() == nullptr) {
+                continue;
+            }
+            key_zone_maps[seg_id].emplace(
+                    unique_id, KeyZoneMap {reader->get_meta_type(), reader->meta_length(),
+                                           *reader->segment_zone_map()});
+        }
+    }
+    std::lock_guard l(_key_zone_maps_lock);
+    if (!_key_zone_maps_recorded.load(std::memory_order_relaxed)) {
+        _key_zone_maps = std::move(key_zone_maps);
+        _key_zone_maps_recorded.store(true, std::memory_order_release);
+    }
+    return Status::OK();
+}
+
+bool BetaRowset::may_match_segment(
+        int64_t seg_id,
+        const std::unordered_map<int32_t, std::shared_ptr<AndBlockColumnPredicate>>&
+                col_id_to_predicates,
+        const TabletSchema& read_schema) const {
+    if (!_key_zone_maps_recorded.load(std::memory_order_acquire) ||
+        seg_id >= static_cast<int64_t>(_key_zone_maps.size())) {
+        return true;
+    }
+    const auto& zone_maps = _key_zone_maps[seg_id];
+    for (const auto& [column_id, predicates] : col_id_to_predicates) {
+        if (column_id >= static_cast<int32_t>(read_schema.num_columns()) ||
+            !read_schema.column(column_id).is_key()) {
+            continue;
+        }
+        const auto& column = read_schema.column(column_id);
+        auto iter = zone_maps.find(column.unique_id());
+        // the column may be of another type in this rowset, e.g. before a schema change
+        if (iter == zone_maps.end() || iter->second.type != column.type()) {
+            continue;
+        }
+        if (!segment_v2::ColumnReader::match_zone_map(iter->second.type, iter->second.length,
+                                                      iter->second.zone_map, predicates.get())) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void BetaRowset::clear_inverted_index_cache() {
     for (int i = 0; i < num_segments(); ++i) {
         auto seg_path = segment_file_path(i);
@@ -183,7 +243,7 @@ Status BetaRowset::load_segment(int64_t seg_id, segment_v2::SegmentSharedPtr* se
             .file_size = _rowset_meta->segment_file_size(seg_id),
     };
     auto s = segment_v2::Segment::open(fs, seg_path, seg_id, rowset_id(), _schema, reader_options,
-                                       segment);
+                                       segment, true);
     if (!s.ok()) {
         LOG(WARNING) << "failed to open segment. " << seg_path << " under rowset " << rowset_id()
                      << " : " << s.to_string();
@@ -20,9 +20,12 @@
 
 #include <stddef.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -34,6 +37,7 @@
 
 namespace doris {
 
+class AndBlockColumnPredicate;
 class BetaRowset;
 
 namespace io {
@@ -97,6 +101,19 @@ public:
 
     Status get_inverted_index_size(size_t* index_size);
 
+    // Keep the segment zone maps of the key columns of the loaded `segments`, all the segments
+    // of this rowset in order, so that the later readers prune the segments before loading them.
+    // No-op if they are kept already.
+    Status record_key_zone_maps(const std::vector<segment_v2::SegmentSharedPtr>& segments);
+
+    // Whether the predicates on the key columns may match some rows of segment `seg_id`,
+    // true if the zone maps are not recorded yet.
+    bool may_match_segment(
+            int64_t seg_id,
+            const std::unordered_map<int32_t, std::shared_ptr<AndBlockColumnPredicate>>&
+                    col_id_to_predicates,
+            const TabletSchema& read_schema) const;
+
     [[nodiscard]] virtual Status add_to_binlog() override;
 
 protected:
@@ -121,6 +138,17 @@ private:
     // Remote format: {remote_fs_root}/data/{tablet_id}
     // Local format: {local_storage_root}/data/{shard_id}/{tablet_id}/{schema_hash}
     std::string _rowset_dir;
+
+    struct KeyZoneMap {
+        FieldType type;
+        int64_t length;
+        ZoneMapPB zone_map;
+    };
+    // segment id ---> column unique id ---> segment zone map of the key column,
+    // immutable once _key_zone_maps_recorded is set
+    std::vector<std::unordered_map<int32_t, KeyZoneMap>> _key_zone_maps;
+    std::atomic<bool> _key_zone_maps_recorded {false};
+    std::mutex _key_zone_maps_lock;
 };
 
 } // namespace doris
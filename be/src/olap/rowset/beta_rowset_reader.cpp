@@ -222,6 +222,7 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
     _read_options.record_rowids = _read_context->record_rowids;
     _read_options.use_topn_opt = _read_context->use_topn_opt;
     _read_options.topn_filter_source_node_ids = _read_context->topn_filter_source_node_ids;
+    _read_options.late_arrival_predicates = _read_context->late_arrival_predicates;
     _read_options.read_orderby_key_reverse = _read_context->read_orderby_key_reverse;
     _read_options.read_orderby_key_columns = _read_context->read_orderby_key_columns;
     _read_options.io_ctx.reader_type = _read_context->reader_type;
@@ -247,20 +248,43 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
         _read_options.io_ctx.expiration_time = 0;
     }
 
+    auto [seg_start, seg_end] = _segment_offsets;
+    if (seg_start == seg_end) {
+        seg_start = 0;
+        seg_end = _rowset->num_segments();
+    }
+
+    // prune the segments by the key zone maps kept in the rowset, the segments are not loaded
+    // at all if none of them may match
+    std::vector<bool> segment_pruned(seg_end - seg_start, false);
+    if (!_read_options.col_id_to_predicates.empty()) {
+        bool all_pruned = true;
+        for (int i = seg_start; i < seg_end; i++) {
+            if (_rowset->may_match_segment(i, _read_options.col_id_to_predicates,
+                                           *_read_options.tablet_schema)) {
+                all_pruned = false;
+            } else {
+                segment_pruned[i - seg_start] = true;
+                _stats->filtered_segment_number++;
+            }
+        }
+        if (all_pruned && seg_end > seg_start) {
+            return Status::OK();
+        }
+    }
+
     // load segments
     bool should_use_cache = use_cache || _read_context->reader_type == ReaderType::READER_QUERY;
     RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(_rowset, &_segment_cache_handle,
                                                              should_use_cache));
-
-    // create iterator for each segment
     auto& segments = _segment_cache_handle.get_segments();
-    auto [seg_start, seg_end] = _segment_offsets;
-    if (seg_start == seg_end) {
-        seg_start = 0;
-        seg_end = segments.size();
-    }
+    RETURN_IF_ERROR(_rowset->record_key_zone_maps(segments));
 
+    // create iterator for each segment
     for (int i = seg_start; i < seg_end; i++) {
+        if (segment_pruned[i - seg_start]) {
+            continue;
+        }
         auto& seg_ptr = segments[i];
         std::unique_ptr<RowwiseIterator> iter;
         Status status;
@@ -146,6 +146,14 @@ void RowsetMeta::set_tablet_schema(const TabletSchemaPB& tablet_schema) {
     _schema = pair.second;
 }
 
+void RowsetMeta::share_tablet_schema(const RowsetMeta& other) {
+    if (_handle) {
+        TabletSchemaCache::instance()->release(_handle);
+    }
+    _handle = other._handle ? TabletSchemaCache::instance()->ref(other._handle) : nullptr;
+    _schema = other._schema;
+}
+
 bool RowsetMeta::_deserialize_from_pb(const std::string& value) {
     RowsetMetaPB rowset_meta_pb;
     if (!rowset_meta_pb.ParseFromString(value)) {
@@ -309,6 +309,9 @@ public:
 
     void set_tablet_schema(const TabletSchemaSPtr& tablet_schema);
     void set_tablet_schema(const TabletSchemaPB& tablet_schema);
+    // Use the schema of `other`, which is known to be the same schema, without serializing it
+    // to look it up in the TabletSchemaCache again.
+    void share_tablet_schema(const RowsetMeta& other);
 
     const TabletSchemaSPtr& tablet_schema() const { return _schema; }
 
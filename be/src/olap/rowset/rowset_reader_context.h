@@ -31,6 +31,7 @@ class RowCursor;
 class DeleteBitmap;
 class DeleteHandler;
 class TabletSchema;
+struct LateArrivalPredicates;
 
 struct RowsetReaderContext {
     ReaderType reader_type = ReaderType::READER_QUERY;
@@ -39,6 +40,7 @@ struct RowsetReaderContext {
     // flag for enable topn opt
     bool use_topn_opt = false;
     std::vector<int> topn_filter_source_node_ids;
+    std::shared_ptr<LateArrivalPredicates> late_arrival_predicates;
     // whether rowset should return ordered rows.
     bool need_ordered_result = true;
     // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -0,0 +1,410 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "olap/types.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/frame_of_reference_coding.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// ALP (Adaptive Lossless floating-Point, SIGMOD 2024) coding of FLOAT and DOUBLE pages.
+// Most of the floating-point values in tables, like metrics and prices, are decimals with few
+// significant digits. Such a value v is stored as the integer n = round(v * 10^e / 10^f), and
+// restored as n * 10^f / 10^e. The exponent e and the factor f of a page are chosen by sampling
+// its values, the integers are stored by the frame-of-reference coding of ForEncoder, and the
+// values not restored exactly are stored as they are, as exceptions. A page which is not
+// smaller this way is stored plain.
+//
+// It is registered as the FOR_ENCODING of FLOAT and DOUBLE.
+//
+// The page format:
+//   Header: 8 bit Mode (ALP or PLAIN), 32 bit ValuesNum
+//   ALP:    8 bit Exponent, 8 bit Factor, 32 bit ExceptionsNum, 32 bit IntegersSize,
+//           the integers by ForEncoder<int64_t>, in which an exception takes the integer of
+//           the value before it, the 32 bit positions of the exceptions, the exceptions
+//   PLAIN:  the values
+namespace alp {
+
+static constexpr uint8_t MODE_ALP = 0;
+static constexpr uint8_t MODE_PLAIN = 1;
+static constexpr size_t HEADER_SIZE = 5;
+static constexpr size_t ALP_HEADER_SIZE = HEADER_SIZE + 10;
+// the values sampled to choose the exponent and the factor of a page
+static constexpr size_t SAMPLE_SIZE = 256;
+// adding and subtracting 2^52 + 2^51 rounds a double below 2^51 to the nearest integer
+static constexpr double ROUND_MAGIC = 6755399441055744.0;
+static constexpr double MAX_INTEGER = 2251799813685248.0;
+
+static constexpr double POW10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,
+                                   1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+static constexpr double INV_POW10[] = {1e0,   1e-1,  1e-2,  1e-3,  1e-4,  1e-5,  1e-6,
+                                       1e-7,  1e-8,  1e-9,  1e-10, 1e-11, 1e-12, 1e-13,
+                                       1e-14, 1e-15, 1e-16, 1e-17, 1e-18};
+
+template <typename T>
+constexpr uint8_t max_exponent() {
+    return std::is_same_v<T, float> ? 10 : 18;
+}
+
+template <typename T>
+inline T decode(int64_t integer, uint8_t exponent, uint8_t factor) {
+    return static_cast<T>(static_cast<double>(integer) * POW10[factor] * INV_POW10[exponent]);
+}
+
+// Whether `value` is restored exactly from its integer `*integer`.
+template <typename T>
+inline bool encode(T value, uint8_t exponent, uint8_t factor, int64_t* integer) {
+    double scaled = static_cast<double>(value) * POW10[exponent] * INV_POW10[factor];
+    // also false for NaN
+    if (!(std::abs(scaled) < MAX_INTEGER)) {
+        return false;
+    }
+    *integer = static_cast<int64_t>(scaled + ROUND_MAGIC - ROUND_MAGIC);
+    T restored = decode<T>(*integer, exponent, factor);
+    // -0.0 is not restored from 0
+    return memcmp(&restored, &value, sizeof(T)) == 0;
+}
+
+} // namespace alp
+
+template <FieldType Type>
+class AlpPageBuilder : public PageBuilder {
+public:
+    explicit AlpPageBuilder(const PageBuilderOptions& options) : _options(options) { reset(); }
+
+    bool is_page_full() override {
+        return _values.size() * sizeof(CppType) >= _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        if (is_page_full()) {
+            *count = 0;
+            return Status::OK();
+        }
+        const auto* values = reinterpret_cast<const CppType*>(vals);
+        _values.insert(_values.end(), values, values + *count);
+        return Status::OK();
+    }
+
+    OwnedSlice finish() override {
+        _buffer.clear();
+        if (_values.empty() || !_encode_alp()) {
+            _encode_plain();
+        }
+        return _buffer.build();
+    }
+
+    void reset() override {
+        _values.clear();
+        _values.reserve(_options.data_page_size / sizeof(CppType) + 1);
+        _buffer.clear();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    uint64_t size() const override { return _values.size() * sizeof(CppType); }
+
+    Status get_first_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.front(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        if (_values.empty()) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        memcpy(value, &_values.back(), sizeof(CppType));
+        return Status::OK();
+    }
+
+    // The exponent and the factor with the smallest estimated size of the sampled values.
+    static void choose_exponent_and_factor(const CppType* values, size_t num_values,
+                                           uint8_t* exponent, uint8_t* factor) {
+        size_t step = std::max<size_t>(num_values / alp::SAMPLE_SIZE, 1);
+        uint64_t best_bits = std::numeric_limits<uint64_t>::max();
+        *exponent = 0;
+        *factor = 0;
+        for (uint8_t e = 0; e <= alp::max_exponent<CppType>(); ++e) {
+            for (uint8_t f = 0; f <= e; ++f) {
+                int64_t min = std::numeric_limits<int64_t>::max();
+                int64_t max = std::numeric_limits<int64_t>::min();
+                uint64_t num_sampled = 0;
+                uint64_t num_exceptions = 0;
+                for (size_t i = 0; i < num_values; i += step, ++num_sampled) {
+                    int64_t integer = 0;
+                    if (alp::encode(values[i], e, f, &integer)) {
+                        min = std::min(min, integer);
+                        max = std::max(max, integer);
+                    } else {
+                        ++num_exceptions;
+                    }
+                }
+                uint64_t width = min > max ? 0 : bits(static_cast<uint64_t>(max - min));
+                uint64_t total_bits = num_sampled * width +
+                                      num_exceptions * (sizeof(uint32_t) + sizeof(CppType)) * 8;
+                if (total_bits < best_bits) {
+                    best_bits = total_bits;
+                    *exponent = e;
+                    *factor = f;
+                }
+            }
+        }
+    }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+    static_assert(std::is_floating_point_v<CppType>);
+
+    bool _encode_alp() {
+        uint8_t exponent = 0;
+        uint8_t factor = 0;
+        choose_exponent_and_factor(_values.data(), _values.size(), &exponent, &factor);
+
+        size_t num_values = _values.size();
+        _integers.resize(num_values);
+        _exception_positions.clear();
+        int64_t last_integer = 0;
+        for (size_t i = 0; i < num_values; ++i) {
+            if (alp::encode(_values[i], exponent, factor, &_integers[i])) {
+                last_integer = _integers[i];
+            } else {
+                // not to widen the frame of the exception
+                _integers[i] = last_integer;
+                _exception_positions.push_back(static_cast<uint32_t>(i));
+            }
+        }
+        faststring integers_buf;
+        ForEncoder<int64_t> encoder(&integers_buf);
+        encoder.put_batch(_integers.data(), num_values);
+        encoder.flush();
+
+        size_t num_exceptions = _exception_positions.size();
+        size_t alp_size = alp::ALP_HEADER_SIZE + integers_buf.size() +
+                          num_exceptions * (sizeof(uint32_t) + sizeof(CppType));
+        if (alp_size >= alp::HEADER_SIZE + num_values * sizeof(CppType)) {
+            return false;
+        }
+        _buffer.reserve(alp_size);
+        _put_header(alp::MODE_ALP);
+        _buffer.push_back(exponent);
+        _buffer.push_back(factor);
+        put_fixed32_le(&_buffer, static_cast<uint32_t>(num_exceptions));
+        put_fixed32_le(&_buffer, static_cast<uint32_t>(integers_buf.size()));
+        _buffer.append(integers_buf.data(), integers_buf.size());
+        for (uint32_t position : _exception_positions) {
+            put_fixed32_le(&_buffer, position);
+        }
+        for (uint32_t position : _exception_positions) {
+            _buffer.append(&_values[position], sizeof(CppType));
+        }
+        return true;
+    }
+
+    void _encode_plain() {
+        _put_header(alp::MODE_PLAIN);
+        _buffer.append(_values.data(), _values.size() * sizeof(CppType));
+    }
+
+    void _put_header(uint8_t mode) {
+        _buffer.push_back(mode);
+        put_fixed32_le(&_buffer, static_cast<uint32_t>(_values.size()));
+    }
+
+    PageBuilderOptions _options;
+    std::vector<CppType> _values;
+    std::vector<int64_t> _integers;
+    std::vector<uint32_t> _exception_positions;
+    faststring _buffer;
+};
+
+template <FieldType Type>
+class AlpPageDecoder : public PageDecoder {
+public:
+    AlpPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        if (_data.size < alp::HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for the header of alp page: {}",
+                                      _data.size);
+        }
+        auto mode = static_cast<uint8_t>(_data.data[0]);
+        _num_elements = decode_fixed32_le(reinterpret_cast<const uint8_t*>(_data.data + 1));
+        if (mode == alp::MODE_PLAIN) {
+            if (_data.size != alp::HEADER_SIZE + _num_elements * sizeof(CppType)) {
+                return Status::Corruption("unexpected size of plain alp page: {}", _data.size);
+            }
+            _values_data = _data.data + alp::HEADER_SIZE;
+        } else if (mode == alp::MODE_ALP) {
+            RETURN_IF_ERROR(_decode_alp());
+            _values_data = reinterpret_cast<const char*>(_values.data());
+        } else {
+            return Status::Corruption("unknown mode of alp page: {}", mode);
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    template <bool forward_index = true>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _num_elements)) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, _num_elements - _cur_index);
+        dst->insert_many_fix_len_data(_values_data + _cur_index * sizeof(CppType), max_fetch);
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        }
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<>(n, dst);
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        return next_batch<false>(n, dst);
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0)) {
+            return Status::OK();
+        }
+        _buffer.resize(*n);
+        size_t read_count = 0;
+        for (size_t i = 0; i < *n; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= _num_elements)) {
+                break;
+            }
+            memcpy(&_buffer[read_count++], _values_data + ord * sizeof(CppType), sizeof(CppType));
+        }
+        if (LIKELY(read_count > 0)) {
+            dst->insert_many_fix_len_data(reinterpret_cast<const char*>(_buffer.data()),
+                                          read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _num_elements; }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    using CppType = typename TypeTraits<Type>::CppType;
+
+    Status _decode_alp() {
+        if (_data.size < alp::ALP_HEADER_SIZE) {
+            return Status::Corruption("not enough bytes for the header of alp page: {}",
+                                      _data.size);
+        }
+        const auto* header = reinterpret_cast<const uint8_t*>(_data.data + alp::HEADER_SIZE);
+        uint8_t exponent = header[0];
+        uint8_t factor = header[1];
+        uint32_t num_exceptions = decode_fixed32_le(header + 2);
+        uint32_t integers_size = decode_fixed32_le(header + 6);
+        if (exponent > alp::max_exponent<CppType>() || factor > exponent ||
+            num_exceptions > _num_elements ||
+            _data.size != alp::ALP_HEADER_SIZE + integers_size +
+                                  num_exceptions * (sizeof(uint32_t) + sizeof(CppType))) {
+            return Status::Corruption("the header of alp page maybe broken");
+        }
+
+        const auto* integers_data = header + 10;
+        ForDecoder<int64_t> decoder(integers_data, integers_size);
+        if (!decoder.init() || decoder.count() != _num_elements) {
+            return Status::Corruption("the integers of alp page maybe broken");
+        }
+        _integers.resize(_num_elements);
+        if (_num_elements > 0 && !decoder.get_batch(_integers.data(), _num_elements)) {
+            return Status::Corruption("the integers of alp page maybe broken");
+        }
+
+        // the same as alp::decode, in a loop the compiler vectorizes
+        _values.resize(_num_elements);
+        const double factor_pow10 = alp::POW10[factor];
+        const double exponent_inv_pow10 = alp::INV_POW10[exponent];
+        const int64_t* __restrict integers = _integers.data();
+        CppType* __restrict values = _values.data();
+        for (size_t i = 0; i < _num_elements; ++i) {
+            values[i] = static_cast<CppType>(static_cast<double>(integers[i]) * factor_pow10 *
+                                             exponent_inv_pow10);
+        }
+
+        const uint8_t* positions = integers_data + integers_size;
+        const uint8_t* exceptions = positions + num_exceptions * sizeof(uint32_t);
+        for (uint32_t i = 0; i < num_exceptions; ++i) {
+            uint32_t position = decode_fixed32_le(positions + i * sizeof(uint32_t));
+            if (position >= _num_elements) {
+                return Status::Corruption("the exceptions of alp page maybe broken");
+            }
+            memcpy(&values[position], exceptions + i * sizeof(CppType), sizeof(CppType));
+        }
+        return Status::OK();
+    }
+
+    Slice _data;
+    bool _parsed = false;
+    size_t _num_elements = 0;
+    size_t _cur_index = 0;
+    // the values of the page, in `_values` or in `_data` if the page is plain
+    const char* _values_data = nullptr;
+    std::vector<int64_t> _integers;
+    std::vector<CppType> _values;
+    std::vector<CppType> _buffer;
+};
+
+} // namespace segment_v2
+} // namespace doris
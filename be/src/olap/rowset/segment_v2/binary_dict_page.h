@@ -54,9 +54,10 @@ enum { BINARY_DICT_PAGE_HEADER_SIZE = 4 };
 // Either header + embedded codeword page, which can be encoded with any
 //        int PageBuilder, when mode_ = DICT_ENCODING.
 // Or     header + embedded BinaryPlainPage, when mode_ = PLAIN_ENCODING.
+// Or     header + embedded FsstPage, when mode_ = FOR_ENCODING.
 // Data pages start with mode_ = DICT_ENCODING, when the size of dictionary
 // page go beyond the option_->dict_page_size, the subsequent data pages will switch
-// to string plain page automatically.
+// to string plain page automatically, or to FSST page if config::enable_fsst_string_page.
 class BinaryDictPageBuilder : public PageBuilder {
 public:
     BinaryDictPageBuilder(const PageBuilderOptions& options);
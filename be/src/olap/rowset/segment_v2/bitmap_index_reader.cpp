@@ -45,8 +45,10 @@ Status BitmapIndexReader::_load(bool use_page_cache, bool kept_in_memory,
     const IndexedColumnMetaPB& bitmap_meta = index_meta->bitmap_column();
     _has_null = index_meta->has_null();
 
-    _dict_column_reader.reset(new IndexedColumnReader(_file_reader, dict_meta));
-    _bitmap_column_reader.reset(new IndexedColumnReader(_file_reader, bitmap_meta));
+    _dict_column_reader.reset(
+            new IndexedColumnReader(_file_reader, dict_meta, _page_cache_file_id));
+    _bitmap_column_reader.reset(
+            new IndexedColumnReader(_file_reader, bitmap_meta, _page_cache_file_id));
     RETURN_IF_ERROR(_dict_column_reader->load(use_page_cache, kept_in_memory));
     RETURN_IF_ERROR(_bitmap_column_reader->load(use_page_cache, kept_in_memory));
     return Status::OK();
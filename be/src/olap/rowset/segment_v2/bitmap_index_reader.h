@@ -43,8 +43,10 @@ class BitmapIndexPB;
 
 class BitmapIndexReader {
 public:
-    explicit BitmapIndexReader(io::FileReaderSPtr file_reader, const BitmapIndexPB& index_meta)
+    explicit BitmapIndexReader(io::FileReaderSPtr file_reader, const BitmapIndexPB& index_meta,
+                               uint64_t page_cache_file_id = 0)
             : _file_reader(std::move(file_reader)),
+              _page_cache_file_id(page_cache_file_id),
               _type_info(get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_VARCHAR>()) {
         _index_meta.reset(new BitmapIndexPB(index_meta));
     }
@@ -65,6 +67,7 @@ private:
     friend class BitmapIndexIterator;
 
     io::FileReaderSPtr _file_reader;
+    uint64_t _page_cache_file_id;
     const TypeInfo* _type_info = nullptr;
     bool _has_null = false;
     DorisCallOnce<Status> _load_once;
@@ -40,7 +40,8 @@ Status BloomFilterIndexReader::load(bool use_page_cache, bool kept_in_memory) {
 Status BloomFilterIndexReader::_load(bool use_page_cache, bool kept_in_memory) {
     const IndexedColumnMetaPB& bf_index_meta = _bloom_filter_index_meta->bloom_filter();
 
-    _bloom_filter_reader.reset(new IndexedColumnReader(_file_reader, bf_index_meta));
+    _bloom_filter_reader.reset(
+            new IndexedColumnReader(_file_reader, bf_index_meta, _page_cache_file_id));
     RETURN_IF_ERROR(_bloom_filter_reader->load(use_page_cache, kept_in_memory));
     return Status::OK();
 }
@@ -41,8 +41,10 @@ class BloomFilterIndexPB;
 class BloomFilterIndexReader {
 public:
     explicit BloomFilterIndexReader(io::FileReaderSPtr file_reader,
-                                    const BloomFilterIndexPB& bloom_filter_index_meta)
+                                    const BloomFilterIndexPB& bloom_filter_index_meta,
+                                    uint64_t page_cache_file_id = 0)
             : _file_reader(std::move(file_reader)),
+              _page_cache_file_id(page_cache_file_id),
               _type_info(get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_VARCHAR>()) {
         _bloom_filter_index_meta.reset(new BloomFilterIndexPB(bloom_filter_index_meta));
     }
@@ -63,6 +65,7 @@ private:
     friend class BloomFilterIndexIterator;
 
     io::FileReaderSPtr _file_reader;
+    uint64_t _page_cache_file_id;
     DorisCallOnce<Status> _load_once;
     const TypeInfo* _type_info = nullptr;
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta = nullptr;
@@ -33,6 +33,7 @@
 #include "olap/column_predicate.h"
 #include "olap/comparison_predicate.h"
 #include "olap/decimal12.h"
+#include "olap/decoded_page_cache.h"
 #include "olap/inverted_index_parser.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
@@ -41,6 +42,7 @@
 #include "olap/rowset/segment_v2/bitmap_index_reader.h"
 #include "olap/rowset/segment_v2/bloom_filter.h"
 #include "olap/rowset/segment_v2/bloom_filter_index_reader.h"
+#include "olap/rowset/segment_v2/decoded_page_decoder.h"
 #include "olap/rowset/segment_v2/encoding_info.h" // for EncodingInfo
 #include "olap/rowset/segment_v2/inverted_index_file_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_reader.h"
@@ -221,21 +223,25 @@ Status ColumnReader::init(const ColumnMetaPB* meta) {
         auto& index_meta = meta->indexes(i);
         switch (index_meta.type()) {
         case ORDINAL_INDEX:
-            _ordinal_index.reset(
-                    new OrdinalIndexReader(_file_reader, _num_rows, index_meta.ordinal_index()));
+            _ordinal_index.reset(new OrdinalIndexReader(_file_reader, _num_rows,
+                                                        index_meta.ordinal_index(),
+                                                        _opts.page_cache_file_id));
             break;
         case ZONE_MAP_INDEX:
             _segment_zone_map =
                     std::make_unique<ZoneMapPB>(index_meta.zone_map_index().segment_zone_map());
             _zone_map_index.reset(new ZoneMapIndexReader(
-                    _file_reader, index_meta.zone_map_index().page_zone_maps()));
+                    _file_reader, index_meta.zone_map_index().page_zone_maps(),
+                    _opts.page_cache_file_id));
             break;
         case BITMAP_INDEX:
-            _bitmap_index.reset(new BitmapIndexReader(_file_reader, index_meta.bitmap_index()));
+            _bitmap_index.reset(new BitmapIndexReader(_file_reader, index_meta.bitmap_index(),
+                                                      _opts.page_cache_file_id));
             break;
         case BLOOM_FILTER_INDEX:
-            _bloom_filter_index.reset(
-                    new BloomFilterIndexReader(_file_reader, index_meta.bloom_filter_index()));
+            _bloom_filter_index.reset(new BloomFilterIndexReader(_file_reader,
+                                                                 index_meta.bloom_filter_index(),
+                                                                 _opts.page_cache_file_id));
             break;
         default:
             return Status::Corruption("Bad file {}: invalid column index type {}",
@@ -280,10 +286,12 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
             .kept_in_memory = _opts.kept_in_memory,
             .type = iter_opts.type,
             .file_reader = iter_opts.file_reader,
+            .page_cache_file_id = _opts.page_cache_file_id,
             .page_pointer = pp,
             .codec = codec,
             .stats = iter_opts.stats,
             .encoding_info = _encoding_info,
+            .column_unique_id = iter_opts.column_unique_id,
             .io_ctx = iter_opts.io_ctx,
     };
     // index page should not pre decode
@@ -346,13 +354,16 @@ bool ColumnReader::match_condition(const AndBlockColumnPredicate* col_predicates
     if (_zone_map_index == nullptr) {
         return true;
     }
-    FieldType type = _type_info->type();
-    std::unique_ptr<WrapperField> min_value(WrapperField::create_by_type(type, _meta_length));
-    std::unique_ptr<WrapperField> max_value(WrapperField::create_by_type(type, _meta_length));
-    RETURN_FALSE_IF_ERROR(_parse_zone_map(*_segment_zone_map, min_value.get(), max_value.get()));
+    return match_zone_map(_type_info->type(), _meta_length, *_segment_zone_map, col_predicates);
+}
+
+bool ColumnReader::match_zone_map(FieldType type, int64_t length, const ZoneMapPB& zone_map,
+                                  const AndBlockColumnPredicate* col_predicates) {
+    std::unique_ptr<WrapperField> min_value(WrapperField::create_by_type(type, length));
+    std::unique_ptr<WrapperField> max_value(WrapperField::create_by_type(type, length));
+    RETURN_FALSE_IF_ERROR(_parse_zone_map(zone_map, min_value.get(), max_value.get()));
 
-    return _zone_map_match_condition(*_segment_zone_map, min_value.get(), max_value.get(),
-                                     col_predicates);
+    return _zone_map_match_condition(zone_map, min_value.get(), max_value.get(), col_predicates);
 }
 
 bool ColumnReader::prune_predicates_by_zone_map(std::vector<ColumnPredicate*>& predicates,
@@ -381,7 +392,7 @@ bool ColumnReader::prune_predicates_by_zone_map(std::vector<ColumnPredicate*>& p
 }
 
 Status ColumnReader::_parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
-                                     WrapperField* max_value_container) const {
+                                     WrapperField* max_value_container) {
     // min value and max value are valid if has_not_null is true
     if (zone_map.has_not_null()) {
         RETURN_IF_ERROR(min_value_container->from_string(zone_map.min()));
@@ -418,7 +429,7 @@ Status ColumnReader::_parse_zone_map_skip_null(const ZoneMapPB& zone_map,
 bool ColumnReader::_zone_map_match_condition(const ZoneMapPB& zone_map,
                                              WrapperField* min_value_container,
                                              WrapperField* max_value_container,
-                                             const AndBlockColumnPredicate* col_predicates) const {
+                                             const AndBlockColumnPredicate* col_predicates) {
     if (!zone_map.has_not_null() && !zone_map.has_null()) {
         return false; // no data in this zone
     }
@@ -1270,6 +1281,16 @@ Status FileColumnIterator::_read_data_page(const OrdinalPageIndexIterator& iter)
             dict_page_decoder->set_dict_decoder(_dict_decoder.get(), _dict_word_info.get());
         }
     }
+
+    // must be after the dictionary is set, the wrapped decoder is not a BinaryDictPageDecoder.
+    auto* decoded_page_cache = DecodedPageCache::instance();
+    if (decoded_page_cache != nullptr && _opts.use_page_cache &&
+        _reader->page_cache_file_id() != 0) {
+        StoragePageCache::CacheKey key(_reader->page_cache_file_id(), iter.page().offset);
+        auto column = decoded_page_cache->lookup_column(key);
+        _page.data_decoder = std::make_unique<DecodedPageDecoder>(
+                std::move(_page.data_decoder), std::move(column), decoded_page_cache, key);
+    }
     return Status::OK();
 }
 
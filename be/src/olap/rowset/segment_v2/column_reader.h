@@ -83,6 +83,8 @@ struct ColumnReaderOptions {
     bool verify_checksum = true;
     // for in memory olap table, use DURABLE CachePriority in page cache
     bool kept_in_memory = false;
+    // id of the segment file in page cache, see StoragePageCache::intern_file
+    uint64_t page_cache_file_id = 0;
 };
 
 struct ColumnIteratorOptions {
@@ -95,6 +97,8 @@ struct ColumnIteratorOptions {
     io::FileReader* file_reader = nullptr; // Ref
     // reader statistics
     OlapReaderStatistics* stats = nullptr; // Ref
+    // unique id of the column to count its pages in `stats->column_io_stats`, -1 for none
+    int32_t column_unique_id = -1;
     io::IOContext io_ctx;
 
     void sanity_check() const {
@@ -150,6 +154,18 @@ public:
     // Return true if segment zone map is absent or `cond' could be satisfied, false otherwise.
     bool match_condition(const AndBlockColumnPredicate* col_predicates) const;
 
+    // The same check as match_condition() by a segment zone map kept out of the reader,
+    // `type` and `length` are the meta type and length of the column.
+    static bool match_zone_map(FieldType type, int64_t length, const ZoneMapPB& zone_map,
+                               const AndBlockColumnPredicate* col_predicates);
+
+    // nullptr if the column has no zone map
+    const ZoneMapPB* segment_zone_map() const {
+        return _zone_map_index != nullptr ? _segment_zone_map.get() : nullptr;
+    }
+
+    int64_t meta_length() const { return _meta_length; }
+
     Status next_batch_of_zone_map(size_t* n, vectorized::MutableColumnPtr& dst) const;
 
     // get row ranges with zone map
@@ -165,6 +181,9 @@ public:
 
     PagePointer get_dict_page_pointer() const { return _meta_dict_page; }
 
+    // 0 if the pages of this column are not keyed by an interned file id.
+    uint64_t page_cache_file_id() const { return _opts.page_cache_file_id; }
+
     bool is_empty() const { return _num_rows == 0; }
 
     bool prune_predicates_by_zone_map(std::vector<ColumnPredicate*>& predicates,
@@ -209,12 +228,13 @@ private:
             const TabletIndex* index_meta);
     [[nodiscard]] Status _load_bloom_filter_index(bool use_page_cache, bool kept_in_memory);
 
-    bool _zone_map_match_condition(const ZoneMapPB& zone_map, WrapperField* min_value_container,
-                                   WrapperField* max_value_container,
-                                   const AndBlockColumnPredicate* col_predicates) const;
+    static bool _zone_map_match_condition(const ZoneMapPB& zone_map,
+                                          WrapperField* min_value_container,
+                                          WrapperField* max_value_container,
+                                          const AndBlockColumnPredicate* col_predicates);
 
-    Status _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
-                           WrapperField* max_value_container) const;
+    static Status _parse_zone_map(const ZoneMapPB& zone_map, WrapperField* min_value_container,
+                                  WrapperField* max_value_container);
 
     Status _parse_zone_map_skip_null(const ZoneMapPB& zone_map, WrapperField* min_value_container,
                                      WrapperField* max_value_container) const;
@@ -363,6 +383,8 @@ public:
 
     ParsedPage* get_current_page() { return &_page; }
 
+    ColumnReader* get_reader() const { return _reader; }
+
     bool is_nullable() { return _reader->is_nullable(); }
 
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
@@ -442,6 +442,30 @@ ScalarColumnWriter::ScalarColumnWriter(const ColumnWriterOptions& opts,
     DCHECK(file_writer != nullptr);
 }
 
+// The types whose FOR_ENCODING is the frame-of-reference coding of integers.
+static bool is_delta_bitpacked_type(FieldType type) {
+    switch (type) {
+    case FieldType::OLAP_FIELD_TYPE_TINYINT:
+    case FieldType::OLAP_FIELD_TYPE_SMALLINT:
+    case FieldType::OLAP_FIELD_TYPE_INT:
+    case FieldType::OLAP_FIELD_TYPE_BIGINT:
+    case FieldType::OLAP_FIELD_TYPE_LARGEINT:
+    case FieldType::OLAP_FIELD_TYPE_DATE:
+    case FieldType::OLAP_FIELD_TYPE_DATEV2:
+    case FieldType::OLAP_FIELD_TYPE_DATETIME:
+    case FieldType::OLAP_FIELD_TYPE_DATETIMEV2:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_time_type(FieldType type) {
+    return type == FieldType::OLAP_FIELD_TYPE_DATE || type == FieldType::OLAP_FIELD_TYPE_DATEV2 ||
+           type == FieldType::OLAP_FIELD_TYPE_DATETIME ||
+           type == FieldType::OLAP_FIELD_TYPE_DATETIMEV2;
+}
+
 ScalarColumnWriter::~ScalarColumnWriter() {
     // delete all pages
     _pages.clear();
@@ -452,6 +476,11 @@ Status ScalarColumnWriter::init() {
 
     PageBuilder* page_builder = nullptr;
 
+    if (_opts.meta->encoding() == DEFAULT_ENCODING && config::enable_delta_bitpacked_encoding &&
+        is_delta_bitpacked_type(get_field()->type()) &&
+        (_opts.is_sort_key || is_time_type(get_field()->type()))) {
+        _opts.meta->set_encoding(FOR_ENCODING);
+    }
     RETURN_IF_ERROR(
             EncodingInfo::get(get_field()->type_info(), _opts.meta->encoding(), &_encoding_info));
     _opts.meta->set_encoding(_encoding_info->encoding());
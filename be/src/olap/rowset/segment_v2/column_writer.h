@@ -56,6 +56,8 @@ struct ColumnWriterOptions {
     // store compressed page only when space saving is above the threshold.
     // space saving = 1 - compressed_size / uncompressed_size
     double compression_min_space_saving = 0.1;
+    // the rows are sorted by the column, like the key columns
+    bool is_sort_key = false;
     bool need_zone_map = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
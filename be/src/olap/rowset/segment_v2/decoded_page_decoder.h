@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/decoded_page_cache.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// Wraps the decoder of a data page and serves reads from the decoded values of the
+// page held by DecodedPageCache. The positions are the same as the wrapped decoder,
+// i.e. the index of the non-null values of the page.
+//
+// If the page is not cached, the whole page is decoded into the cache at the first read,
+// but only for numeric and string columns. Reads into other column types, e.g. the
+// predicate columns or the dictionary columns of low cardinality optimization, fall back
+// to the wrapped decoder.
+class DecodedPageDecoder : public PageDecoder {
+public:
+    DecodedPageDecoder(std::unique_ptr<PageDecoder> decoder, vectorized::ColumnPtr column,
+                       DecodedPageCache* cache, const StoragePageCache::CacheKey& key)
+            : _decoder(std::move(decoder)),
+              _column(std::move(column)),
+              _cache(cache),
+              _key(key),
+              _cur_index(_decoder->current_index()) {}
+
+    // The wrapped decoder is already initialized.
+    Status init() override { return Status::OK(); }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK_LE(pos, count());
+        _cur_index = pos;
+        _decoder_synced = false;
+        return Status::OK();
+    }
+
+    Status seek_at_or_after_value(const void* value, bool* exact_match) override {
+        RETURN_IF_ERROR(_sync_decoder());
+        Status st = _decoder->seek_at_or_after_value(value, exact_match);
+        _cur_index = _decoder->current_index();
+        return st;
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        bool from_cache = false;
+        RETURN_IF_ERROR(_can_read_from_cache(dst, &from_cache));
+        if (from_cache) {
+            *n = std::min(*n, count() - _cur_index);
+            _insert_range(dst, _cur_index, *n);
+            _cur_index += *n;
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_sync_decoder());
+        RETURN_IF_ERROR(_decoder->next_batch(n, dst));
+        _cur_index = _decoder->current_index();
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        bool from_cache = false;
+        RETURN_IF_ERROR(_can_read_from_cache(dst, &from_cache));
+        if (!from_cache) {
+            // read_by_rowids does not move the cursor, no need to update _cur_index.
+            RETURN_IF_ERROR(_sync_decoder());
+            return _decoder->read_by_rowids(rowids, page_first_ordinal, n, dst);
+        }
+        size_t read_count = 0;
+        _indices.resize(*n);
+        for (size_t i = 0; i < *n; ++i) {
+            ordinal_t ord = rowids[i] - page_first_ordinal;
+            if (UNLIKELY(ord >= count())) {
+                break;
+            }
+            _indices[read_count++] = ord;
+        }
+        if (LIKELY(read_count > 0)) {
+            _flat_column(dst)->insert_indices_from(*_column, _indices.data(),
+                                                   _indices.data() + read_count);
+            _fill_null_map(dst, read_count);
+        }
+        *n = read_count;
+        return Status::OK();
+    }
+
+    Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        bool from_cache = false;
+        RETURN_IF_ERROR(_can_read_from_cache(dst, &from_cache));
+        if (from_cache) {
+            *n = std::min(*n, count() - _cur_index);
+            _insert_range(dst, _cur_index, *n);
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(_sync_decoder());
+        return _decoder->peek_next_batch(n, dst);
+    }
+
+    size_t count() const override { return _column ? _column->size() : _decoder->count(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+private:
+    // The values are inserted into the nested column of a nullable column, same as the
+    // insert_many_* of ColumnNullable do for the page decoders.
+    static vectorized::IColumn* _flat_column(vectorized::MutableColumnPtr& dst) {
+        if (dst->is_nullable()) {
+            return &assert_cast<vectorized::ColumnNullable&>(*dst).get_nested_column();
+        }
+        return dst.get();
+    }
+
+    static void _fill_null_map(vectorized::MutableColumnPtr& dst, size_t num) {
+        if (dst->is_nullable()) {
+            assert_cast<vectorized::ColumnNullable&>(*dst).get_null_map_column().insert_many_vals(
+                    0, num);
+        }
+    }
+
+    void _insert_range(vectorized::MutableColumnPtr& dst, size_t start, size_t length) {
+        if (length > 0) {
+            _flat_column(dst)->insert_range_from(*_column, start, length);
+            _fill_null_map(dst, length);
+        }
+    }
+
+    Status _can_read_from_cache(vectorized::MutableColumnPtr& dst, bool* from_cache) {
+        auto* flat = _flat_column(dst);
+        if (_column == nullptr && !_fill_tried) {
+            _fill_tried = true;
+            if (flat->is_numeric() || flat->is_column_string()) {
+                RETURN_IF_ERROR(_fill_cache(*flat));
+            }
+        }
+        *from_cache = _column != nullptr && typeid(*flat) == typeid(*_column);
+        return Status::OK();
+    }
+
+    Status _fill_cache(const vectorized::IColumn& flat) {
+        auto column = flat.clone_empty();
+        size_t num = _decoder->count();
+        column->reserve(num);
+        RETURN_IF_ERROR(_decoder->seek_to_position_in_page(0));
+        _decoder_synced = false;
+        RETURN_IF_ERROR(_decoder->next_batch(&num, column));
+        if (num != _decoder->count()) {
+            return Status::OK();
+        }
+        _column = std::move(column);
+        _cache->insert_column(_key, _column);
+        return Status::OK();
+    }
+
+    Status _sync_decoder() {
+        if (!_decoder_synced) {
+            RETURN_IF_ERROR(_decoder->seek_to_position_in_page(_cur_index));
+            _decoder_synced = true;
+        }
+        return Status::OK();
+    }
+
+    std::unique_ptr<PageDecoder> _decoder;
+    // nullptr if the page is not cached yet.
+    vectorized::ColumnPtr _column;
+    DecodedPageCache* _cache = nullptr;
+    StoragePageCache::CacheKey _key;
+    size_t _cur_index = 0;
+    // Whether the position of _decoder equals to _cur_index.
+    bool _decoder_synced = true;
+    bool _fill_tried = false;
+    std::vector<uint32_t> _indices;
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -24,13 +24,16 @@
 #include <unordered_map>
 #include <utility>
 
+#include "common/config.h"
 #include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/alp_page.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
 #include "olap/rowset/segment_v2/binary_plain_page.h"
 #include "olap/rowset/segment_v2/binary_prefix_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page.h"
 #include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
 #include "olap/rowset/segment_v2/frame_of_reference_page.h"
+#include "olap/rowset/segment_v2/fsst_page.h"
 #include "olap/rowset/segment_v2/plain_page.h"
 #include "olap/rowset/segment_v2/rle_page.h"
 #include "olap/types.h"
@@ -171,6 +174,35 @@ struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
     }
 };
 
+// ALP, the frame-of-reference coding of the decimal digits of floating point values
+template <FieldType type, typename CppType>
+struct TypeEncodingTraits<type, FOR_ENCODING, CppType,
+                          typename std::enable_if<std::is_floating_point<CppType>::value>::type> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new AlpPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new AlpPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
+// FSST, the symbol table compression of strings
+template <FieldType type>
+struct TypeEncodingTraits<type, FOR_ENCODING, Slice> {
+    static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
+        *builder = new FsstPageBuilder<type>(opts);
+        return Status::OK();
+    }
+    static Status create_page_decoder(const Slice& data, const PageDecoderOptions& opts,
+                                      PageDecoder** decoder) {
+        *decoder = new FsstPageDecoder<type>(data, opts);
+        return Status::OK();
+    }
+};
+
 template <FieldType type>
 struct TypeEncodingTraits<type, PREFIX_ENCODING, Slice> {
     static Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) {
@@ -197,6 +229,11 @@ public:
     ~EncodingInfoResolver();
 
     EncodingTypePB get_default_encoding(FieldType type, bool optimize_value_seek) const {
+        if (!optimize_value_seek && config::enable_alp_float_encoding &&
+            (type == FieldType::OLAP_FIELD_TYPE_FLOAT ||
+             type == FieldType::OLAP_FIELD_TYPE_DOUBLE)) {
+            return FOR_ENCODING;
+        }
         auto& encoding_map =
                 optimize_value_seek ? _value_seek_encoding_map : _default_encoding_type_map;
         auto it = encoding_map.find(type);
@@ -264,9 +301,11 @@ EncodingInfoResolver::EncodingInfoResolver() {
 
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_FLOAT, FOR_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, BIT_SHUFFLE>();
     _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, PLAIN_ENCODING>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_DOUBLE, FOR_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_CHAR, PLAIN_ENCODING>();
@@ -275,10 +314,12 @@ EncodingInfoResolver::EncodingInfoResolver() {
     _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, PREFIX_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_VARCHAR, FOR_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_STRING, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_STRING, PLAIN_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_STRING, PREFIX_ENCODING, true>();
+    _add_map<FieldType::OLAP_FIELD_TYPE_STRING, FOR_ENCODING>();
 
     _add_map<FieldType::OLAP_FIELD_TYPE_JSONB, DICT_ENCODING>();
     _add_map<FieldType::OLAP_FIELD_TYPE_JSONB, PLAIN_ENCODING>();
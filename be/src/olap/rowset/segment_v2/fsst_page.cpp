@@ -0,0 +1,243 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <parallel_hashmap/phmap.h>
+
+#include <algorithm>
+#include <functional>
+#include <tuple>
+#include <utility>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+
+namespace doris {
+namespace segment_v2 {
+
+// the bytes of the strings sampled to build the symbol table
+static constexpr size_t SAMPLE_BYTES = 16 * 1024;
+static constexpr size_t GENERATIONS = 5;
+// the token of an escaped byte b is ESCAPED_TOKEN + b
+static constexpr uint32_t ESCAPED_TOKEN = 256;
+
+void FsstSymbolTable::clear() {
+    _num_symbols = 0;
+    for (auto& codes : _codes_by_byte) {
+        codes.clear();
+    }
+}
+
+void FsstSymbolTable::_index() {
+    for (auto& codes : _codes_by_byte) {
+        codes.clear();
+    }
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        _codes_by_byte[_symbols[code] & 0xFF].push_back(code);
+    }
+    for (auto& codes : _codes_by_byte) {
+        std::stable_sort(codes.begin(), codes.end(),
+                         [&](uint8_t l, uint8_t r) { return _lengths[l] > _lengths[r]; });
+    }
+}
+
+void FsstSymbolTable::build(const std::vector<Slice>& strings) {
+    clear();
+    size_t total_bytes = 0;
+    for (const auto& value : strings) {
+        total_bytes += value.size;
+    }
+    size_t stride = std::max<size_t>(1, (total_bytes + SAMPLE_BYTES - 1) / SAMPLE_BYTES);
+    std::vector<Slice> sample;
+    for (size_t i = 0; i < strings.size(); i += stride) {
+        sample.push_back(strings[i]);
+    }
+
+    // tokens are the codes of the symbols, or ESCAPED_TOKEN + the escaped bytes
+    std::vector<uint32_t> counts(ESCAPED_TOKEN + 256);
+    phmap::flat_hash_map<uint32_t, uint32_t> pair_counts;
+    phmap::flat_hash_map<std::pair<uint64_t, uint8_t>, uint64_t> gains;
+    auto symbol_of = [&](uint32_t token, uint64_t* symbol) -> uint8_t {
+        if (token >= ESCAPED_TOKEN) {
+            *symbol = token - ESCAPED_TOKEN;
+            return 1;
+        }
+        *symbol = _symbols[token];
+        return _lengths[token];
+    };
+    for (size_t generation = 0; generation < GENERATIONS; ++generation) {
+        std::fill(counts.begin(), counts.end(), 0);
+        pair_counts.clear();
+        for (const auto& value : sample) {
+            const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+            size_t pos = 0;
+            uint32_t prev = UINT32_MAX;
+            while (pos < value.size) {
+                uint8_t code = _find(data + pos, value.size - pos);
+                uint32_t token;
+                if (code == ESCAPE) {
+                    token = ESCAPED_TOKEN + data[pos];
+                    pos += 1;
+                } else {
+                    token = code;
+                    pos += _lengths[code];
+                }
+                ++counts[token];
+                if (prev != UINT32_MAX) {
+                    ++pair_counts[prev << 9 | token];
+                }
+                prev = token;
+            }
+        }
+
+        // the gain of a candidate is the bytes it covers in the sample
+        gains.clear();
+        for (uint32_t token = 0; token < counts.size(); ++token) {
+            if (counts[token] > 0) {
+                uint64_t symbol;
+                uint8_t length = symbol_of(token, &symbol);
+                gains[{symbol, length}] += uint64_t(counts[token]) * length;
+            }
+        }
+        for (const auto& [tokens, count] : pair_counts) {
+            uint64_t first;
+            uint64_t second;
+            uint8_t first_length = symbol_of(tokens >> 9, &first);
+            uint8_t second_length = symbol_of(tokens & 0x1FF, &second);
+            if (first_length == MAX_SYMBOL_LENGTH) {
+                continue;
+            }
+            uint8_t length = std::min<size_t>(first_length + second_length, MAX_SYMBOL_LENGTH);
+            uint64_t symbol = first | (second << (8 * first_length));
+            if (length < MAX_SYMBOL_LENGTH) {
+                symbol &= (uint64_t(1) << (8 * length)) - 1;
+            }
+            gains[{symbol, length}] += uint64_t(count) * length;
+        }
+
+        // keep the candidates of the most gains, the order of the equal ones is fixed so the
+        // same strings always get the same table
+        std::vector<std::tuple<uint64_t, uint8_t, uint64_t>> candidates;
+        candidates.reserve(gains.size());
+        for (const auto& [symbol, gain] : gains) {
+            candidates.emplace_back(gain, symbol.second, symbol.first);
+        }
+        size_t num_symbols = std::min(candidates.size(), MAX_SYMBOLS);
+        std::partial_sort(candidates.begin(), candidates.begin() + num_symbols, candidates.end(),
+                          std::greater<>());
+        _num_symbols = num_symbols;
+        for (size_t code = 0; code < num_symbols; ++code) {
+            _lengths[code] = std::get<1>(candidates[code]);
+            _symbols[code] = std::get<2>(candidates[code]);
+        }
+        _index();
+    }
+}
+
+void FsstSymbolTable::serialize(faststring* buffer) const {
+    buffer->push_back(static_cast<uint8_t>(_num_symbols));
+    buffer->append(_lengths, _num_symbols);
+    for (size_t code = 0; code < _num_symbols; ++code) {
+        buffer->append(&_symbols[code], _lengths[code]);
+    }
+}
+
+Status FsstSymbolTable::deserialize(Slice* data) {
+    clear();
+    if (data->size < 1) {
+        return Status::Corruption("not enough bytes for the symbol table of fsst page");
+    }
+    size_t num_symbols = static_cast<uint8_t>(data->data[0]);
+    if (num_symbols > MAX_SYMBOLS || data->size < 1 + num_symbols) {
+        return Status::Corruption("the symbol table of fsst page maybe broken");
+    }
+    memcpy(_lengths, data->data + 1, num_symbols);
+    data->remove_prefix(1 + num_symbols);
+    for (size_t code = 0; code < num_symbols; ++code) {
+        if (_lengths[code] == 0 || _lengths[code] > MAX_SYMBOL_LENGTH ||
+            data->size < _lengths[code]) {
+            return Status::Corruption("the symbol table of fsst page maybe broken");
+        }
+        _symbols[code] = 0;
+        memcpy(&_symbols[code], data->data, _lengths[code]);
+        data->remove_prefix(_lengths[code]);
+    }
+    _num_symbols = num_symbols;
+    _index();
+    return Status::OK();
+}
+
+void FsstSymbolTable::compress(const Slice& value, faststring* out) const {
+    if (_num_symbols == 0) {
+        out->append(value.data, value.size);
+        return;
+    }
+    const auto* data = reinterpret_cast<const uint8_t*>(value.data);
+    size_t pos = 0;
+    while (pos < value.size) {
+        uint8_t code = _find(data + pos, value.size - pos);
+        out->push_back(code);
+        if (code == ESCAPE) {
+            out->push_back(data[pos]);
+            pos += 1;
+        } else {
+            pos += _lengths[code];
+        }
+    }
+}
+
+char* FsstSymbolTable::decompress(const uint8_t* begin, const uint8_t* end, char* out) const {
+    if (_num_symbols == 0) {
+        memcpy(out, begin, end - begin);
+        return out + (end - begin);
+    }
+    while (begin < end) {
+        uint8_t code = *begin++;
+        if (PREDICT_TRUE(code != ESCAPE)) {
+            // write all the 8 bytes, the padding is overwritten by the next symbol
+            memcpy(out, &_symbols[code], MAX_SYMBOL_LENGTH);
+            out += _lengths[code];
+        } else if (begin < end) {
+            *out++ = static_cast<char>(*begin++);
+        }
+    }
+    return out;
+}
+
+size_t FsstSymbolTable::decompress_prefix(const uint8_t* begin, const uint8_t* end, size_t limit,
+                                          char* out) const {
+    if (_num_symbols == 0) {
+        size_t size = std::min<size_t>(limit, end - begin);
+        memcpy(out, begin, size);
+        return size;
+    }
+    char* start = out;
+    while (begin < end && static_cast<size_t>(out - start) < limit) {
+        uint8_t code = *begin++;
+        if (PREDICT_TRUE(code != ESCAPE)) {
+            memcpy(out, &_symbols[code], MAX_SYMBOL_LENGTH);
+            out += _lengths[code];
+        } else if (begin < end) {
+            *out++ = static_cast<char>(*begin++);
+        }
+    }
+    return out - start;
+}
+
+} // namespace segment_v2
+} // namespace doris
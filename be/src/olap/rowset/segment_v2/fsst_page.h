@@ -0,0 +1,380 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "common/status.h"
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/page_builder.h"
+#include "olap/rowset/segment_v2/page_decoder.h"
+#include "util/coding.h"
+#include "util/faststring.h"
+#include "util/slice.h"
+#include "vec/columns/column.h"
+
+namespace doris {
+namespace segment_v2 {
+
+// FSST (Fast Static Symbol Table, VLDB 2020) coding of string pages. The symbol table of a page
+// holds up to 255 symbols of 1 to 8 bytes, and a string is compressed to the codes of the
+// longest symbols it starts with, a byte not covered by any symbol is escaped by the code 255.
+// Unlike the page codecs, every string is compressed alone, so a string is decompressed without
+// the others of its page, and the strings equal to a value are found by comparing the compressed
+// bytes, since the same string is always compressed to the same codes.
+//
+// It is registered as the FOR_ENCODING of VARCHAR and STRING, and also compresses the data
+// pages of BinaryDictPage after its dictionary is full.
+//
+// The page format:
+//   32 bit ValuesNum, 8 bit SymbolsNum, the 8 bit lengths of the symbols, the symbols,
+//   (ValuesNum + 1) 32 bit offsets of the compressed strings, the compressed strings
+// A page with no symbols, e.g. which is not smaller compressed, holds the strings as they are.
+class FsstSymbolTable {
+public:
+    static constexpr uint8_t ESCAPE = 255;
+    static constexpr size_t MAX_SYMBOLS = 255;
+    static constexpr size_t MAX_SYMBOL_LENGTH = 8;
+
+    FsstSymbolTable() { clear(); }
+
+    // Choose the symbols for `strings` by the generations of FSST on a sample of them: every
+    // generation compresses the sample by the symbols of the last one, and keeps the symbols
+    // and the concatenations of two adjacent symbols which cover the most bytes.
+    void build(const std::vector<Slice>& strings);
+
+    void clear();
+
+    size_t size() const { return _num_symbols; }
+
+    void serialize(faststring* buffer) const;
+
+    // Parse the symbol table at the beginning of `data` and skip it.
+    Status deserialize(Slice* data);
+
+    // Append the compressed `value` to `out`.
+    void compress(const Slice& value, faststring* out) const;
+
+    // Decompress [begin, end) to `out`, which must have MAX_SYMBOL_LENGTH * (end - begin)
+    // bytes. Return the end of the decompressed string.
+    char* decompress(const uint8_t* begin, const uint8_t* end, char* out) const;
+
+    // Decompress [begin, end) only until `limit` bytes are decompressed, `out` must have
+    // `limit + MAX_SYMBOL_LENGTH` bytes. Return the bytes decompressed, at least
+    // min(limit, the size of the string).
+    size_t decompress_prefix(const uint8_t* begin, const uint8_t* end, size_t limit,
+                             char* out) const;
+
+private:
+    // the code of the longest symbol `data` starts with, ESCAPE if none
+    uint8_t _find(const uint8_t* data, size_t size) const {
+        for (uint8_t code : _codes_by_byte[data[0]]) {
+            size_t length = _lengths[code];
+            if (length <= size && memcmp(data, &_symbols[code], length) == 0) {
+                return code;
+            }
+        }
+        return ESCAPE;
+    }
+
+    void _index();
+
+    // the bytes of a symbol, padded by zero to 8 bytes
+    uint64_t _symbols[MAX_SYMBOLS];
+    uint8_t _lengths[MAX_SYMBOLS];
+    size_t _num_symbols;
+    // the codes of the symbols starting with each byte, the longest first
+    std::vector<uint8_t> _codes_by_byte[256];
+};
+
+template <FieldType Type>
+class FsstPageBuilder : public PageBuilder {
+public:
+    explicit FsstPageBuilder(const PageBuilderOptions& options) : _options(options) { reset(); }
+
+    // the size of a page is counted before compression, like the page codecs
+    bool is_page_full() override {
+        return _options.data_page_size != 0 && _size_estimate > _options.data_page_size;
+    }
+
+    Status add(const uint8_t* vals, size_t* count) override {
+        DCHECK(!_finished);
+        size_t i = 0;
+        const auto* src = reinterpret_cast<const Slice*>(vals);
+        for (; i < *count && !is_page_full(); ++i, ++src) {
+            _offsets.push_back(_raw.size());
+            _raw.append(src->data, src->size);
+            _size_estimate += src->size + sizeof(uint32_t);
+        }
+        *count = i;
+        return Status::OK();
+    }
+
+    OwnedSlice finish() override {
+        DCHECK(!_finished);
+        _finished = true;
+        size_t num_values = _offsets.size();
+        _offsets.push_back(_raw.size());
+        std::vector<Slice> values(num_values);
+        for (size_t i = 0; i < num_values; ++i) {
+            values[i] = Slice(_raw.data() + _offsets[i], _offsets[i + 1] - _offsets[i]);
+        }
+        if (num_values > 0) {
+            _first_value.assign_copy(reinterpret_cast<const uint8_t*>(values[0].data),
+                                     values[0].size);
+            _last_value.assign_copy(reinterpret_cast<const uint8_t*>(values.back().data),
+                                    values.back().size);
+        }
+
+        _table.build(values);
+        faststring compressed;
+        std::vector<uint32_t> compressed_offsets(num_values + 1, 0);
+        for (size_t i = 0; i < num_values; ++i) {
+            _table.compress(values[i], &compressed);
+            compressed_offsets[i + 1] = compressed.size();
+        }
+        const faststring* strings = &compressed;
+        const std::vector<uint32_t>* offsets = &compressed_offsets;
+        if (compressed.size() >= _raw.size()) {
+            _table.clear();
+            strings = &_raw;
+            offsets = &_offsets;
+        }
+
+        put_fixed32_le(&_buffer, num_values);
+        _table.serialize(&_buffer);
+        for (uint32_t offset : *offsets) {
+            put_fixed32_le(&_buffer, offset);
+        }
+        _buffer.append(strings->data(), strings->size());
+        return _buffer.build();
+    }
+
+    void reset() override {
+        _finished = false;
+        _raw.clear();
+        _offsets.clear();
+        _buffer.clear();
+        _size_estimate = sizeof(uint32_t);
+    }
+
+    size_t count() const override { return _finished ? _offsets.size() - 1 : _offsets.size(); }
+
+    uint64_t size() const override { return _size_estimate; }
+
+    Status get_first_value(void* value) const override {
+        DCHECK(_finished);
+        if (count() == 0) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_first_value);
+        return Status::OK();
+    }
+
+    Status get_last_value(void* value) const override {
+        DCHECK(_finished);
+        if (count() == 0) {
+            return Status::Error<ErrorCode::ENTRY_NOT_FOUND>("page is empty");
+        }
+        *reinterpret_cast<Slice*>(value) = Slice(_last_value);
+        return Status::OK();
+    }
+
+private:
+    PageBuilderOptions _options;
+    bool _finished = false;
+    size_t _size_estimate = 0;
+    // the strings added, and their offsets in `_raw`
+    faststring _raw;
+    std::vector<uint32_t> _offsets;
+    FsstSymbolTable _table;
+    faststring _first_value;
+    faststring _last_value;
+    faststring _buffer;
+};
+
+template <FieldType Type>
+class FsstPageDecoder : public PageDecoder {
+public:
+    FsstPageDecoder(Slice data, const PageDecoderOptions& options) : _data(data) {}
+
+    Status init() override {
+        CHECK(!_parsed);
+        Slice data = _data;
+        if (data.size < sizeof(uint32_t)) {
+            return Status::Corruption("not enough bytes for the header of fsst page: {}",
+                                      data.size);
+        }
+        _num_elements = decode_fixed32_le(reinterpret_cast<const uint8_t*>(data.data));
+        data.remove_prefix(sizeof(uint32_t));
+        RETURN_IF_ERROR(_table.deserialize(&data));
+        size_t offsets_size = (_num_elements + 1) * sizeof(uint32_t);
+        if (data.size < offsets_size) {
+            return Status::Corruption("not enough bytes for the offsets of fsst page: {}",
+                                      data.size);
+        }
+        _offsets = reinterpret_cast<const uint8_t*>(data.data);
+        data.remove_prefix(offsets_size);
+        _strings = reinterpret_cast<const uint8_t*>(data.data);
+        if (_offset(0) != 0 || _offset(_num_elements) != data.size) {
+            return Status::Corruption("the offsets of fsst page maybe broken");
+        }
+        for (size_t i = 0; i < _num_elements; ++i) {
+            if (_offset(i) > _offset(i + 1)) {
+                return Status::Corruption("the offsets of fsst page maybe broken");
+            }
+        }
+        _parsed = true;
+        return Status::OK();
+    }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        DCHECK(_parsed) << "Must call init() firstly";
+        DCHECK_LE(pos, _num_elements);
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _num_elements)) {
+            *n = 0;
+            return Status::OK();
+        }
+        size_t max_fetch = std::min(*n, _num_elements - _cur_index);
+        _reserve((_offset(_cur_index + max_fetch) - _offset(_cur_index)) *
+                 FsstSymbolTable::MAX_SYMBOL_LENGTH);
+        _buffer_offsets.resize(max_fetch + 1);
+        _buffer_offsets[0] = 0;
+        char* out = _buffer.data();
+        for (size_t i = 0; i < max_fetch; ++i) {
+            out = _decompress(_cur_index + i, out);
+            _buffer_offsets[i + 1] = out - _buffer.data();
+        }
+        dst->insert_many_continuous_binary_data(_buffer.data(), _buffer_offsets.data(), max_fetch);
+        _cur_index += max_fetch;
+        *n = max_fetch;
+        return Status::OK();
+    }
+
+    // Only the strings read are decompressed.
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        DCHECK(_parsed);
+        size_t read_count = 0;
+        size_t compressed_size = 0;
+        for (; read_count < *n; ++read_count) {
+            ordinal_t ord = rowids[read_count] - page_first_ordinal;
+            if (PREDICT_FALSE(ord >= _num_elements)) {
+                break;
+            }
+            compressed_size += _offset(ord + 1) - _offset(ord);
+        }
+        if (read_count == 0) {
+            *n = 0;
+            return Status::OK();
+        }
+        _reserve(compressed_size * FsstSymbolTable::MAX_SYMBOL_LENGTH);
+        _buffer_offsets.resize(read_count + 1);
+        _buffer_offsets[0] = 0;
+        char* out = _buffer.data();
+        for (size_t i = 0; i < read_count; ++i) {
+            out = _decompress(rowids[i] - page_first_ordinal, out);
+            _buffer_offsets[i + 1] = out - _buffer.data();
+        }
+        dst->insert_many_continuous_binary_data(_buffer.data(), _buffer_offsets.data(),
+                                                read_count);
+        *n = read_count;
+        return Status::OK();
+    }
+
+    size_t count() const override {
+        DCHECK(_parsed);
+        return _num_elements;
+    }
+
+    size_t current_index() const override {
+        DCHECK(_parsed);
+        return _cur_index;
+    }
+
+    // Set `matches[i]` to whether the string at `begin + i` equals `value`, by comparing the
+    // compressed strings, none of them is decompressed.
+    void match_equal(const Slice& value, size_t begin, size_t n, uint8_t* matches) {
+        DCHECK(_parsed);
+        DCHECK_LE(begin + n, _num_elements);
+        _value_buffer.clear();
+        _table.compress(value, &_value_buffer);
+        for (size_t i = 0; i < n; ++i) {
+            uint32_t start = _offset(begin + i);
+            uint32_t size = _offset(begin + i + 1) - start;
+            matches[i] = size == _value_buffer.size() &&
+                         memcmp(_strings + start, _value_buffer.data(), size) == 0;
+        }
+    }
+
+    // Set `matches[i]` to whether the string at `begin + i` starts with `prefix`, i.e. LIKE
+    // 'prefix%'. Only the symbols covering the prefix of a string are decompressed.
+    void match_prefix(const Slice& prefix, size_t begin, size_t n, uint8_t* matches) {
+        DCHECK(_parsed);
+        DCHECK_LE(begin + n, _num_elements);
+        _reserve(prefix.size + FsstSymbolTable::MAX_SYMBOL_LENGTH);
+        for (size_t i = 0; i < n; ++i) {
+            size_t size = _table.decompress_prefix(_strings + _offset(begin + i),
+                                                   _strings + _offset(begin + i + 1),
+                                                   prefix.size, _buffer.data());
+            matches[i] = size >= prefix.size && memcmp(_buffer.data(), prefix.data,
+                                                       prefix.size) == 0;
+        }
+    }
+
+private:
+    uint32_t _offset(size_t idx) const { return decode_fixed32_le(_offsets + idx * 4); }
+
+    char* _decompress(size_t idx, char* out) const {
+        return _table.decompress(_strings + _offset(idx), _strings + _offset(idx + 1), out);
+    }
+
+    void _reserve(size_t size) {
+        if (_buffer.size() < size) {
+            _buffer.resize(size);
+        }
+    }
+
+    Slice _data;
+    bool _parsed = false;
+    size_t _num_elements = 0;
+    size_t _cur_index = 0;
+    FsstSymbolTable _table;
+    const uint8_t* _offsets = nullptr;
+    const uint8_t* _strings = nullptr;
+    // the decompressed strings of a batch
+    std::vector<char> _buffer;
+    std::vector<uint32_t> _buffer_offsets;
+    faststring _value_buffer;
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -117,6 +117,7 @@ Status IndexedColumnReader::read_page(const PagePointer& pp, PageHandle* handle,
             .pre_decode = pre_decode,
             .type = type,
             .file_reader = _file_reader.get(),
+            .page_cache_file_id = _page_cache_file_id,
             .page_pointer = pp,
             .codec = codec,
             .stats = &tmp_stats,
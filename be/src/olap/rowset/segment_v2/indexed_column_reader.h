@@ -48,8 +48,11 @@ class EncodingInfo;
 // thread-safe reader for IndexedColumn (see comments of `IndexedColumnWriter` to understand what IndexedColumn is)
 class IndexedColumnReader {
 public:
-    explicit IndexedColumnReader(io::FileReaderSPtr file_reader, const IndexedColumnMetaPB& meta)
-            : _file_reader(std::move(file_reader)), _meta(meta) {}
+    explicit IndexedColumnReader(io::FileReaderSPtr file_reader, const IndexedColumnMetaPB& meta,
+                                 uint64_t page_cache_file_id = 0)
+            : _file_reader(std::move(file_reader)),
+              _page_cache_file_id(page_cache_file_id),
+              _meta(meta) {}
 
     Status load(bool use_page_cache, bool kept_in_memory);
 
@@ -73,6 +76,7 @@ private:
     friend class IndexedColumnIterator;
 
     io::FileReaderSPtr _file_reader;
+    uint64_t _page_cache_file_id;
     IndexedColumnMetaPB _meta;
 
     bool _use_page_cache;
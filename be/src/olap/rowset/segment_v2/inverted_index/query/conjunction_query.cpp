@@ -93,12 +93,24 @@ void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
     // can get a term of all docid
     auto func = [&roaring](const TermIterator& term_docs, bool first) {
         roaring::Roaring result;
+        // the docs after the last doc of the current result can not match, so the rest of the
+        // posting list is not decoded
+        uint32_t max_doc = first ? UINT32_MAX : roaring.maximum();
         DocRange doc_range;
         while (term_docs.readRange(&doc_range)) {
             if (doc_range.type_ == DocRangeType::kMany) {
+                if (doc_range.doc_many_size_ == 0) {
+                    continue;
+                }
                 result.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
+                if ((*doc_range.doc_many)[doc_range.doc_many_size_ - 1] >= max_doc) {
+                    break;
+                }
             } else {
                 result.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
+                if (doc_range.doc_range.second > max_doc) {
+                    break;
+                }
             }
         }
         if (first) {
@@ -108,16 +120,19 @@ void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
         }
     };
 
-    // fill the bitmap for the first time
+    // fill the bitmap for the first time, the terms are intersected from the rarest one
     func(_lead1, true);
 
     // the second inverted list may be empty
-    if (!_lead2.isEmpty()) {
+    if (!_lead2.isEmpty() && !roaring.isEmpty()) {
         func(_lead2, false);
     }
 
     // The inverted index iterators contained in the _others array must not be empty
     for (auto& other : _others) {
+        if (roaring.isEmpty()) {
+            break;
+        }
         func(other, false);
     }
 }
@@ -117,6 +117,9 @@ private:
                                  config::inverted_index_cache_stale_sweep_time_sec, num_shards,
                                  element_count_capacity, cache_value_time_extractor,
                                  cache_value_check_timestamp, true) {}
+
+        // A miss opens the index files and loads the searcher.
+        double refill_cost_per_byte() override { return 4.0; }
     };
     // Insert a cache entry by key.
     // And the cache entry will be returned in handle.
@@ -352,6 +352,21 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, RuntimeState* run
         std::unique_ptr<lucene::search::Query> query;
         query_info.field_name = std::wstring(column_name.begin(), column_name.end());
 
+        // MATCH_ALL and MATCH_ANY ignore the order and the duplicates of the terms, so their
+        // terms are canonicalized to share the cache entries, and one term matches the same
+        // rows in both of them.
+        auto cache_query_type = query_type;
+        bool is_term_set_query = query_type == InvertedIndexQueryType::MATCH_ALL_QUERY ||
+                                 query_type == InvertedIndexQueryType::MATCH_ANY_QUERY;
+        if (is_term_set_query) {
+            std::sort(query_info.terms.begin(), query_info.terms.end());
+            query_info.terms.erase(std::unique(query_info.terms.begin(), query_info.terms.end()),
+                                   query_info.terms.end());
+            if (query_info.terms.size() == 1) {
+                cache_query_type = InvertedIndexQueryType::MATCH_ALL_QUERY;
+            }
+        }
+
         if (query_type == InvertedIndexQueryType::MATCH_PHRASE_QUERY ||
             query_type == InvertedIndexQueryType::MATCH_PHRASE_PREFIX_QUERY ||
             query_type == InvertedIndexQueryType::MATCH_PHRASE_EDGE_QUERY ||
@@ -362,7 +377,7 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, RuntimeState* run
             if (query_type == InvertedIndexQueryType::MATCH_PHRASE_QUERY) {
                 str_tokens += " " + std::to_string(query_info.slop);
             }
-            cache_key = {index_file_key, column_name, query_type, str_tokens};
+            cache_key = {index_file_key, column_name, cache_query_type, str_tokens};
         }
         auto* cache = InvertedIndexQueryCache::instance();
         InvertedIndexQueryCacheHandle cache_handler;
@@ -373,6 +388,13 @@ Status FullTextIndexReader::query(OlapReaderStatistics* stats, RuntimeState* run
             return Status::OK();
         }
         stats->inverted_index_query_cache_miss++;
+        if (is_term_set_query && query_info.terms.size() > 1 &&
+            combine_cached_term_bitmaps(cache, index_file_key, column_name, query_type,
+                                        query_info.terms, &term_match_bitmap)) {
+            cache->insert(cache_key, term_match_bitmap, &cache_handler);
+            bit_map = term_match_bitmap;
+            return Status::OK();
+        }
         FulltextIndexSearcherPtr* searcher_ptr = nullptr;
 
         InvertedIndexCacheHandle inverted_index_cache_handle;
@@ -415,6 +437,41 @@ Status FullTextIndexReader::match_index_search(
     return Status::OK();
 }
 
+bool FullTextIndexReader::combine_cached_term_bitmaps(InvertedIndexQueryCache* cache,
+                                                      const std::string& index_file_key,
+                                                      const std::string& column_name,
+                                                      InvertedIndexQueryType query_type,
+                                                      const std::vector<std::string>& terms,
+                                                      std::shared_ptr<roaring::Roaring>* bit_map) {
+    std::vector<InvertedIndexQueryCacheHandle> handles(terms.size());
+    std::vector<const roaring::Roaring*> term_bitmaps;
+    for (size_t i = 0; i < terms.size(); ++i) {
+        InvertedIndexQueryCache::CacheKey term_key {
+                index_file_key, column_name, InvertedIndexQueryType::MATCH_ALL_QUERY, terms[i]};
+        if (!cache->lookup(term_key, &handles[i])) {
+            return false;
+        }
+        term_bitmaps.push_back(handles[i].get_bitmap().get());
+    }
+    if (query_type == InvertedIndexQueryType::MATCH_ALL_QUERY) {
+        // intersect from the rarest term, so the intermediate result stays small
+        std::sort(term_bitmaps.begin(), term_bitmaps.end(),
+                  [](const auto* lhs, const auto* rhs) {
+                      return lhs->cardinality() < rhs->cardinality();
+                  });
+        auto result = std::make_shared<roaring::Roaring>(*term_bitmaps[0]);
+        for (size_t i = 1; i < term_bitmaps.size() && !result->isEmpty(); ++i) {
+            *result &= *term_bitmaps[i];
+        }
+        *bit_map = std::move(result);
+    } else {
+        *bit_map = std::make_shared<roaring::Roaring>(
+                roaring::Roaring::fastunion(term_bitmaps.size(), term_bitmaps.data()));
+    }
+    (*bit_map)->runOptimize();
+    return true;
+}
+
 InvertedIndexReaderType FullTextIndexReader::type() {
     return InvertedIndexReaderType::FULLTEXT;
 }
@@ -186,6 +186,15 @@ private:
                               const InvertedIndexQueryInfo& query_info,
                               const FulltextIndexSearcherPtr& index_searcher,
                               const std::shared_ptr<roaring::Roaring>& term_match_bitmap);
+
+    // Combine the cached results of the single terms of a MATCH_ALL or MATCH_ANY query instead
+    // of searching the index, return false if any of them is not cached.
+    bool combine_cached_term_bitmaps(InvertedIndexQueryCache* cache,
+                                     const std::string& index_file_key,
+                                     const std::string& column_name,
+                                     InvertedIndexQueryType query_type,
+                                     const std::vector<std::string>& terms,
+                                     std::shared_ptr<roaring::Roaring>* bit_map);
 };
 
 class StringTypeInvertedIndexReader : public InvertedIndexReader {
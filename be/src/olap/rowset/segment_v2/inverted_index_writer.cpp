@@ -427,6 +427,7 @@ public:
             }
         } else if constexpr (field_is_numeric_type(field_type)) {
             size_t start_off = 0;
+            std::string new_value;
             for (int i = 0; i < count; ++i) {
                 auto array_elem_size = offsets[i + 1] - offsets[i];
                 for (size_t j = start_off; j < start_off + array_elem_size; ++j) {
@@ -434,11 +435,7 @@ public:
                         continue;
                     }
                     const CppType* p = &reinterpret_cast<const CppType*>(value_ptr)[j];
-                    std::string new_value;
-                    size_t value_length = sizeof(CppType);
-
-                    _value_key_coder->full_encode_ascending(p, &new_value);
-                    _bkd_writer->add((const uint8_t*)new_value.c_str(), value_length, _rid);
+                    add_bkd_point(*p, &new_value);
                 }
                 start_off += array_elem_size;
                 _row_ids_seen_for_bkd++;
@@ -475,6 +472,7 @@ public:
                 values++;
             }
         } else if constexpr (field_is_numeric_type(field_type)) {
+            std::string new_value;
             for (int i = 0; i < count; ++i) {
                 auto* item_data_ptr = const_cast<CollectionValue*>(values)->mutable_data();
 
@@ -483,11 +481,7 @@ public:
                     if (values->is_null_at(j)) {
                         // bkd do not index null values, so we do nothing here.
                     } else {
-                        std::string new_value;
-                        size_t value_length = sizeof(CppType);
-
-                        _value_key_coder->full_encode_ascending(p, &new_value);
-                        _bkd_writer->add((const uint8_t*)new_value.c_str(), value_length, _rid);
+                        add_bkd_point(*p, &new_value);
                     }
                     item_data_ptr = (uint8_t*)item_data_ptr + field_size;
                 }
@@ -501,21 +495,21 @@ public:
 
     void add_numeric_values(const void* values, size_t count) {
         auto p = reinterpret_cast<const CppType*>(values);
+        // the encoding buffer is shared by the whole batch instead of allocated per value
+        std::string new_value;
         for (size_t i = 0; i < count; ++i) {
-            add_value(*p);
+            add_bkd_point(*p, &new_value);
             p++;
             _row_ids_seen_for_bkd++;
+            _rid++;
         }
     }
 
-    void add_value(const CppType& value) {
-        std::string new_value;
-        size_t value_length = sizeof(CppType);
-
-        _value_key_coder->full_encode_ascending(&value, &new_value);
-        _bkd_writer->add((const uint8_t*)new_value.c_str(), value_length, _rid);
-
-        _rid++;
+    // Add a point of the current row to the bkd writer, `new_value` is the encoding buffer.
+    void add_bkd_point(const CppType& value, std::string* new_value) {
+        new_value->clear();
+        _value_key_coder->full_encode_ascending(&value, new_value);
+        _bkd_writer->add((const uint8_t*)new_value->c_str(), sizeof(CppType), _rid);
     }
 
     int64_t size() const override {
@@ -91,6 +91,7 @@ Status OrdinalIndexReader::_load(bool use_page_cache, bool kept_in_memory,
             .kept_in_memory = kept_in_memory,
             .type = INDEX_PAGE,
             .file_reader = _file_reader.get(),
+            .page_cache_file_id = _page_cache_file_id,
             .page_pointer = PagePointer(index_meta->root_page().root_page()),
             // ordinal index page uses NO_COMPRESSION right now
             .codec = nullptr,
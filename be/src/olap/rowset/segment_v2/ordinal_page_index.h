@@ -67,8 +67,10 @@ class OrdinalPageIndexIterator;
 class OrdinalIndexReader {
 public:
     explicit OrdinalIndexReader(io::FileReaderSPtr file_reader, ordinal_t num_values,
-                                const OrdinalIndexPB& meta_pb)
-            : _file_reader(std::move(file_reader)), _num_values(num_values) {
+                                const OrdinalIndexPB& meta_pb, uint64_t page_cache_file_id = 0)
+            : _file_reader(std::move(file_reader)),
+              _page_cache_file_id(page_cache_file_id),
+              _num_values(num_values) {
         _meta_pb.reset(new OrdinalIndexPB(meta_pb));
     }
 
@@ -98,6 +100,7 @@ private:
     friend OrdinalPageIndexIterator;
 
     io::FileReaderSPtr _file_reader;
+    uint64_t _page_cache_file_id;
     DorisCallOnce<Status> _load_once;
 
     std::unique_ptr<OrdinalIndexPB> _meta_pb;
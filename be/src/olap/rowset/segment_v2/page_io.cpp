@@ -115,15 +115,27 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                                         Slice* body, PageFooterPB* footer) {
     opts.sanity_check();
     opts.stats->total_pages_num++;
+    ColumnIOStatistics* column_stats = nullptr;
+    if (opts.column_unique_id >= 0) {
+        column_stats = &opts.stats->column_io_stats[opts.column_unique_id];
+        column_stats->total_pages_num++;
+    }
 
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
-    StoragePageCache::CacheKey cache_key(opts.file_reader->path().native(),
-                                         opts.file_reader->size(), opts.page_pointer.offset);
+    uint64_t file_id = opts.page_cache_file_id;
+    if (file_id == 0 && opts.use_page_cache && cache) {
+        file_id = StoragePageCache::intern_file(opts.file_reader->path().native(),
+                                                opts.file_reader->size());
+    }
+    StoragePageCache::CacheKey cache_key(file_id, opts.page_pointer.offset);
     if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
+        if (column_stats != nullptr) {
+            column_stats->cached_pages_num++;
+        }
         // parse body and footer
         Slice page_slice = handle->data();
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -160,6 +172,9 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                                                   &opts.io_ctx));
         DCHECK_EQ(bytes_read, page_size);
         opts.stats->compressed_bytes_read += page_size;
+        if (column_stats != nullptr) {
+            column_stats->compressed_bytes_read += page_size;
+        }
     }
 
     if (opts.verify_checksum) {
@@ -209,8 +224,14 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         page = std::move(decompressed_page);
         page_slice = Slice(page->data(), footer->uncompressed_size() + footer_size + 4);
         opts.stats->uncompressed_bytes_read += page_slice.size;
+        if (column_stats != nullptr) {
+            column_stats->uncompressed_bytes_read += page_slice.size;
+        }
     } else {
         opts.stats->uncompressed_bytes_read += body_size;
+        if (column_stats != nullptr) {
+            column_stats->uncompressed_bytes_read += body_size;
+        }
     }
 
     if (opts.pre_decode && opts.encoding_info) {
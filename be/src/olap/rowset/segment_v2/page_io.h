@@ -57,6 +57,8 @@ struct PageReadOptions {
     PageTypePB type;
     // block to read page
     io::FileReader* file_reader = nullptr;
+    // id of `file_reader` in page cache, interned by `file_reader` if it is 0
+    uint64_t page_cache_file_id = 0;
     // location of the page
     PagePointer page_pointer;
     // decompressor for page body (null means page body is not compressed)
@@ -65,6 +67,9 @@ struct PageReadOptions {
     OlapReaderStatistics* stats = nullptr;
 
     const EncodingInfo* encoding_info = nullptr;
+    // unique id of the column of the page, its pages read are counted in
+    // `stats->column_io_stats` if it is not -1
+    int32_t column_unique_id = -1;
 
     const io::IOContext& io_ctx;
 
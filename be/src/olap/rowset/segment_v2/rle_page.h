@@ -217,13 +217,17 @@ public:
 
         size_t to_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
         size_t remaining = to_fetch;
-        bool result = false;
-        CppType value;
+        // decode whole runs into a buffer and append them at once, instead of a value a time
+        CppType values[DECODE_BATCH_SIZE];
         while (remaining > 0) {
-            result = _rle_decoder.Get(&value);
-            DCHECK(result);
-            dst->insert_data((char*)(&value), SIZE_OF_TYPE);
-            remaining--;
+            size_t decoded =
+                    _rle_decoder.get_values(values, std::min(remaining, DECODE_BATCH_SIZE));
+            if (UNLIKELY(decoded == 0)) {
+                return Status::Corruption("rle page has less values than expected, {} remaining",
+                                          remaining);
+            }
+            dst->insert_many_fix_len_data((const char*)values, decoded);
+            remaining -= decoded;
         }
 
         _cur_index += to_fetch;
@@ -270,6 +274,7 @@ public:
 private:
     typedef typename TypeTraits<Type>::CppType CppType;
     enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
+    static constexpr size_t DECODE_BATCH_SIZE = 1024;
 
     Slice _data;
     PageDecoderOptions _options;
@@ -24,6 +24,8 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <utility>
 
 #include "common/logging.h"
@@ -35,6 +37,7 @@
 #include "olap/column_predicate.h"
 #include "olap/iterators.h"
 #include "olap/olap_common.h"
+#include "olap/page_cache.h"
 #include "olap/primary_key_index.h"
 #include "olap/rowset/rowset_reader_context.h"
 #include "olap/rowset/segment_v2/column_reader.h"
@@ -47,6 +50,7 @@
 #include "olap/rowset/segment_v2/segment_iterator.h"
 #include "olap/rowset/segment_v2/segment_writer.h" // k_segment_magic_length
 #include "olap/schema.h"
+#include "olap/segment_loader.h"
 #include "olap/short_key_index.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
@@ -79,13 +83,13 @@ class InvertedIndexIterator;
 Status Segment::open(io::FileSystemSPtr fs, const std::string& path, uint32_t segment_id,
                      RowsetId rowset_id, TabletSchemaSPtr tablet_schema,
                      const io::FileReaderOptions& reader_options,
-                     std::shared_ptr<Segment>* output) {
+                     std::shared_ptr<Segment>* output, bool use_footer_cache) {
     io::FileReaderSPtr file_reader;
     RETURN_IF_ERROR(fs->open_file(path, &file_reader, &reader_options));
     std::shared_ptr<Segment> segment(new Segment(segment_id, rowset_id, std::move(tablet_schema)));
     segment->_fs = std::move(fs);
     segment->_file_reader = std::move(file_reader);
-    RETURN_IF_ERROR(segment->_open());
+    RETURN_IF_ERROR(segment->_open(use_footer_cache));
     *output = std::move(segment);
     return Status::OK();
 }
@@ -102,9 +106,12 @@ Segment::~Segment() {
     g_total_segment_num << -1;
 }
 
-Status Segment::_open() {
+Status Segment::_open(bool use_footer_cache) {
+    _page_cache_file_id =
+            StoragePageCache::intern_file(_file_reader->path().native(), _file_reader->size());
     SegmentFooterPB footer;
-    RETURN_IF_ERROR(_parse_footer(&footer));
+    RETURN_IF_ERROR(_parse_footer(&footer, use_footer_cache));
+    _num_rows = footer.num_rows();
     RETURN_IF_ERROR(_create_column_readers(footer));
     _pk_index_meta.reset(footer.has_primary_key_index_meta()
                                  ? new PrimaryKeyIndexMetaPB(footer.primary_key_index_meta())
@@ -112,7 +119,6 @@ Status Segment::_open() {
     // delete_bitmap_calculator_test.cpp
     // DCHECK(footer.has_short_key_index_page());
     _sk_index_page = footer.short_key_index_page();
-    _num_rows = footer.num_rows();
     return Status::OK();
 }
 
@@ -146,9 +152,7 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             const auto* node = _sub_column_tree.find_exact(*col.path_info_ptr());
             reader = node != nullptr ? node->data.reader.get() : nullptr;
         } else {
-            reader = _column_readers.contains(col.unique_id())
-                             ? _column_readers[col.unique_id()].get()
-                             : nullptr;
+            RETURN_IF_ERROR(_get_column_reader(col.unique_id(), &reader));
         }
         if (!reader || !reader->has_zone_map()) {
             continue;
@@ -177,10 +181,12 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader(uid, &reader));
+            if (reader != nullptr &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -203,10 +209,20 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         !read_options.column_predicates.empty()) {
         auto pruned_predicates = read_options.column_predicates;
         auto pruned = false;
-        for (auto& it : _column_readers) {
-            const auto uid = it.first;
-            const auto column_id = read_options.tablet_schema->field_index(uid);
-            if (it.second->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
+        // only the readers of the predicate columns are needed, the others are not created
+        std::set<int32_t> predicate_column_ids;
+        for (const auto* pred : read_options.column_predicates) {
+            predicate_column_ids.insert(pred->column_id());
+        }
+        for (const auto column_id : predicate_column_ids) {
+            const auto& col = read_options.tablet_schema->column(column_id);
+            if (read_options.tablet_schema->field_index(col.unique_id()) != column_id) {
+                continue;
+            }
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader(col.unique_id(), &reader));
+            if (reader != nullptr &&
+                reader->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
                 pruned = true;
             }
         }
@@ -231,7 +247,19 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
     return iter->get()->init(read_options);
 }
 
-Status Segment::_parse_footer(SegmentFooterPB* footer) {
+Status Segment::_parse_footer(SegmentFooterPB* footer, bool use_footer_cache) {
+    auto* footer_cache = use_footer_cache && SegmentLoader::instance() != nullptr
+                                 ? SegmentLoader::instance()->footer_cache()
+                                 : nullptr;
+    SegmentCache::CacheKey cache_key(_rowset_id, _segment_id);
+    if (footer_cache != nullptr) {
+        std::string footer_buf;
+        // the footer was verified by its checksum before it is cached
+        if (footer_cache->lookup(cache_key, &footer_buf) && footer->ParseFromString(footer_buf)) {
+            return Status::OK();
+        }
+    }
+
     // Footer := SegmentFooterPB, FooterPBSize(4), FooterPBChecksum(4), MagicNumber(4)
     auto file_size = _file_reader->size();
     if (file_size < 12) {
@@ -279,6 +307,9 @@ Status Segment::_parse_footer(SegmentFooterPB* footer) {
         return Status::Corruption("Bad segment file {}: failed to parse SegmentFooterPB",
                                   _file_reader->path().native());
     }
+    if (footer_cache != nullptr) {
+        footer_cache->insert(cache_key, footer_buf);
+    }
     return Status::OK();
 }
 
@@ -288,7 +319,8 @@ Status Segment::_load_pk_bloom_filter() {
     DCHECK(_pk_index_reader != nullptr);
     auto status = [this]() {
         return _load_pk_bf_once.call([this] {
-            RETURN_IF_ERROR(_pk_index_reader->parse_bf(_file_reader, *_pk_index_meta));
+            RETURN_IF_ERROR(_pk_index_reader->parse_bf(_file_reader, *_pk_index_meta,
+                                                       _page_cache_file_id));
             _meta_mem_usage += _pk_index_reader->get_bf_memory_size();
             return Status::OK();
         });
@@ -324,7 +356,8 @@ Status Segment::_load_index_impl() {
     return _load_index_once.call([this] {
         if (_tablet_schema->keys_type() == UNIQUE_KEYS && _pk_index_meta != nullptr) {
             _pk_index_reader.reset(new PrimaryKeyIndexReader());
-            RETURN_IF_ERROR(_pk_index_reader->parse_index(_file_reader, *_pk_index_meta));
+            RETURN_IF_ERROR(_pk_index_reader->parse_index(_file_reader, *_pk_index_meta,
+                                                          _page_cache_file_id));
             _meta_mem_usage += _pk_index_reader->get_memory_size();
             return Status::OK();
         } else {
@@ -334,6 +367,7 @@ Status Segment::_load_index_impl() {
                     .use_page_cache = true,
                     .type = INDEX_PAGE,
                     .file_reader = _file_reader.get(),
+                    .page_cache_file_id = _page_cache_file_id,
                     .page_pointer = PagePointer(_sk_index_page),
                     // short key index page uses NO_COMPRESSION for now
                     .codec = nullptr,
@@ -400,14 +434,8 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
         if (iter == column_id_to_footer_ordinal.end()) {
             continue;
         }
-
-        ColumnReaderOptions opts {
-                .kept_in_memory = _tablet_schema->is_in_memory(),
-        };
-        std::unique_ptr<ColumnReader> reader;
-        RETURN_IF_ERROR(ColumnReader::create(opts, footer.columns(iter->second), footer.num_rows(),
-                                             _file_reader, &reader));
-        _column_readers.emplace(column.unique_id(), std::move(reader));
+        // the reader is created by _get_column_reader() on the first access
+        _column_metas.emplace(column.unique_id(), footer.columns(iter->second));
         _meta_mem_usage += config::estimated_mem_per_column_reader;
     }
 
@@ -426,6 +454,7 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
         const ColumnMetaPB& column_pb = footer.columns(iter->second);
         ColumnReaderOptions opts;
         opts.kept_in_memory = _tablet_schema->is_in_memory();
+        opts.page_cache_file_id = _page_cache_file_id;
         std::unique_ptr<ColumnReader> reader;
         RETURN_IF_ERROR(
                 ColumnReader::create(opts, column_pb, footer.num_rows(), _file_reader, &reader));
@@ -583,55 +612,88 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     if (tablet_column.has_path_info() || tablet_column.is_variant_type()) {
         return new_column_iterator_with_path(tablet_column, iter, opt);
     }
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column.unique_id(), &reader));
     // init default iterator
-    if (_column_readers.count(tablet_column.unique_id()) < 1) {
+    if (reader == nullptr) {
         RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
         return Status::OK();
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(tablet_column.unique_id())->new_iterator(&it));
+    RETURN_IF_ERROR(reader->new_iterator(&it));
     iter->reset(it);
 
-    if (config::enable_column_type_check &&
-        tablet_column.type() != _column_readers.at(tablet_column.unique_id())->get_meta_type()) {
+    if (config::enable_column_type_check && tablet_column.type() != reader->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
                      << " column schema name: " << tablet_column.name()
                      << " column schema type: " << int(tablet_column.type())
-                     << " column reader meta type"
-                     << int(_column_readers.at(tablet_column.unique_id())->get_meta_type());
+                     << " column reader meta type" << int(reader->get_meta_type());
         return Status::InternalError("different type between schema and column reader");
     }
     return Status::OK();
 }
 
 Status Segment::new_column_iterator(int32_t unique_id, std::unique_ptr<ColumnIterator>* iter) {
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(unique_id, &reader));
+    if (reader == nullptr) {
+        return Status::InternalError("no column reader of column {} in segment {} of rowset {}",
+                                     unique_id, _segment_id, _rowset_id.to_string());
+    }
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it));
+    RETURN_IF_ERROR(reader->new_iterator(&it));
     iter->reset(it);
     return Status::OK();
 }
 
-ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
+Status Segment::_get_column_reader(const TabletColumn& col, ColumnReader** reader) {
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
         auto node =
                 col.has_path_info() ? _sub_column_tree.find_exact(*col.path_info_ptr()) : nullptr;
-        if (node != nullptr) {
-            return node->data.reader.get();
+        *reader = node != nullptr ? node->data.reader.get() : nullptr;
+        return Status::OK();
+    }
+    return _get_column_reader(col.unique_id(), reader);
+}
+
+Status Segment::_get_column_reader(int32_t unique_id, ColumnReader** reader) {
+    {
+        std::shared_lock rlock(_column_readers_lock);
+        auto iter = _column_readers.find(unique_id);
+        if (iter != _column_readers.end()) {
+            *reader = iter->second.get();
+            return Status::OK();
+        }
+        if (!_column_metas.contains(unique_id)) {
+            *reader = nullptr;
+            return Status::OK();
         }
-        return nullptr;
     }
-    auto col_unique_id = col.unique_id();
-    if (_column_readers.count(col_unique_id) > 0) {
-        return _column_readers[col_unique_id].get();
+    std::lock_guard wlock(_column_readers_lock);
+    auto iter = _column_readers.find(unique_id);
+    if (iter == _column_readers.end()) {
+        auto meta_iter = _column_metas.find(unique_id);
+        DCHECK(meta_iter != _column_metas.end());
+        ColumnReaderOptions opts {
+                .kept_in_memory = _tablet_schema->is_in_memory(),
+                .page_cache_file_id = _page_cache_file_id,
+        };
+        std::unique_ptr<ColumnReader> column_reader;
+        RETURN_IF_ERROR(ColumnReader::create(opts, meta_iter->second, _num_rows, _file_reader,
+                                             &column_reader));
+        iter = _column_readers.emplace(unique_id, std::move(column_reader)).first;
+        _column_metas.erase(meta_iter);
     }
-    return nullptr;
+    *reader = iter->second.get();
+    return Status::OK();
 }
 
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, &reader));
     if (reader != nullptr && reader->has_bitmap_index()) {
         BitmapIndexIterator* it;
         RETURN_IF_ERROR(reader->new_bitmap_index_iterator(&it));
@@ -645,7 +707,8 @@ Status Segment::new_inverted_index_iterator(const TabletColumn& tablet_column,
                                             const TabletIndex* index_meta,
                                             const StorageReadOptions& read_options,
                                             std::unique_ptr<InvertedIndexIterator>* iter) {
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, &reader));
     if (reader != nullptr && index_meta) {
         if (_inverted_index_file_reader == nullptr) {
             RETURN_IF_ERROR(
@@ -659,7 +722,8 @@ Status Segment::new_inverted_index_iterator(const TabletColumn& tablet_column,
 }
 
 Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, bool with_rowid,
-                               RowLocation* row_location) {
+                               RowLocation* row_location,
+                               std::unique_ptr<IndexedColumnIterator>* index_iterator) {
     RETURN_IF_ERROR(load_pk_index_and_bf());
     bool has_seq_col = _tablet_schema->has_sequence_col();
     bool has_rowid = !_tablet_schema->cluster_key_idxes().empty();
@@ -678,16 +742,22 @@ Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, bool with_ro
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator));
-    auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
+    std::unique_ptr<segment_v2::IndexedColumnIterator> local_index_iterator;
+    if (index_iterator == nullptr) {
+        index_iterator = &local_index_iterator;
+    }
+    if (*index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(index_iterator));
+    }
+    auto* iter = index_iterator->get();
+    auto st = iter->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
     }
     if (st.is<ErrorCode::ENTRY_NOT_FOUND>() || (!has_seq_col && !has_rowid && !exact_match)) {
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
-    row_location->row_id = index_iterator->get_current_ordinal();
+    row_location->row_id = iter->get_current_ordinal();
     row_location->segment_id = _segment_id;
     row_location->rowset_id = _rowset_id;
 
@@ -696,7 +766,7 @@ Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, bool with_ro
             _pk_index_reader->type_info()->type(), 1, 0);
     auto index_column = index_type->create_column();
     size_t num_read = num_to_read;
-    RETURN_IF_ERROR(index_iterator->next_batch(&num_read, index_column));
+    RETURN_IF_ERROR(iter->next_batch(&num_read, index_column));
     DCHECK(num_to_read == num_read);
 
     Slice sought_key = Slice(index_column->get_data_at(0).data, index_column->get_data_at(0).size);
@@ -789,10 +859,11 @@ bool Segment::same_with_storage_type(int32_t cid, const Schema& schema,
     return same;
 }
 
-Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescriptor* slot,
-                                       uint32_t row_id, vectorized::MutableColumnPtr& result,
-                                       OlapReaderStatistics& stats,
-                                       std::unique_ptr<ColumnIterator>& iterator_hint) {
+Status Segment::seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                        const uint32_t* row_ids, size_t num_rows,
+                                        vectorized::MutableColumnPtr& result,
+                                        OlapReaderStatistics& stats,
+                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
     StorageReadOptions storage_read_opt;
     storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
     segment_v2::ColumnIteratorOptions opt {
@@ -801,7 +872,6 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             .stats = &stats,
             .io_ctx = io::IOContext {.reader_type = ReaderType::READER_QUERY},
     };
-    std::vector<segment_v2::rowid_t> single_row_loc {row_id};
     if (!slot->column_paths().empty()) {
         vectorized::PathInDataPtr path = std::make_shared<vectorized::PathInData>(
                 schema.column_by_uid(slot->col_unique_id()).name_lower_case(),
@@ -816,13 +886,13 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             RETURN_IF_ERROR(new_column_iterator(column, &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(
-                iterator_hint->read_by_rowids(single_row_loc.data(), 1, file_storage_column));
-        // iterator_hint.reset(nullptr);
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, file_storage_column));
         // Get it's inner field, for JSONB case
         vectorized::Field field = remove_nullable(storage_type)->get_default();
-        file_storage_column->get(0, field);
-        result->insert(field);
+        for (size_t i = 0; i < num_rows; ++i) {
+            file_storage_column->get(i, field);
+            result->insert(field);
+        }
     } else {
         int index = (slot->col_unique_id() >= 0) ? schema.field_index(slot->col_unique_id())
                                                  : schema.field_index(slot->col_name());
@@ -838,7 +908,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                     new_column_iterator(schema.column(index), &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(iterator_hint->read_by_rowids(single_row_loc.data(), 1, result));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, result));
     }
     return Status::OK();
 }
@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <map>
 #include <memory> // for unique_ptr
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -64,6 +65,7 @@ struct RowLocation;
 namespace segment_v2 {
 
 class BitmapIndexIterator;
+class IndexedColumnIterator;
 class Segment;
 class InvertedIndexIterator;
 class InvertedIndexFileReader;
@@ -82,7 +84,7 @@ public:
     static Status open(io::FileSystemSPtr fs, const std::string& path, uint32_t segment_id,
                        RowsetId rowset_id, TabletSchemaSPtr tablet_schema,
                        const io::FileReaderOptions& reader_options,
-                       std::shared_ptr<Segment>* output);
+                       std::shared_ptr<Segment>* output, bool use_footer_cache = false);
     ~Segment();
 
     Status new_iterator(SchemaSPtr schema, const StorageReadOptions& read_options,
@@ -104,6 +106,11 @@ public:
 
     Status new_column_iterator(int32_t unique_id, std::unique_ptr<ColumnIterator>* iter);
 
+    // Set `reader` to nullptr if this segment has no data of the column.
+    Status get_column_reader(int32_t unique_id, ColumnReader** reader) {
+        return _get_column_reader(unique_id, reader);
+    }
+
     Status new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                      std::unique_ptr<BitmapIndexIterator>* iter);
 
@@ -122,14 +129,20 @@ public:
         return _pk_index_reader.get();
     }
 
+    // If `index_iterator` is given, the iterator of the primary key index is kept in it and
+    // reused by the next lookups, which saves reloading the data page for the sorted keys.
     Status lookup_row_key(const Slice& key, bool with_seq_col, bool with_rowid,
-                          RowLocation* row_location);
+                          RowLocation* row_location,
+                          std::unique_ptr<IndexedColumnIterator>* index_iterator = nullptr);
 
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
-    Status seek_and_read_by_rowid(const TabletSchema& schema, SlotDescriptor* slot, uint32_t row_id,
-                                  vectorized::MutableColumnPtr& result, OlapReaderStatistics& stats,
-                                  std::unique_ptr<ColumnIterator>& iterator_hint);
+    // Reads `num_rows` rows of `slot` into `result`, `row_ids` must be sorted and unique.
+    Status seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                   const uint32_t* row_ids, size_t num_rows,
+                                   vectorized::MutableColumnPtr& result,
+                                   OlapReaderStatistics& stats,
+                                   std::unique_ptr<ColumnIterator>& iterator_hint);
 
     Status load_index();
 
@@ -191,11 +204,16 @@ private:
     DISALLOW_COPY_AND_ASSIGN(Segment);
     Segment(uint32_t segment_id, RowsetId rowset_id, TabletSchemaSPtr tablet_schema);
     // open segment file and read the minimum amount of necessary information (footer)
-    Status _open();
-    Status _parse_footer(SegmentFooterPB* footer);
+    Status _open(bool use_footer_cache);
+    // The footer is taken from the SegmentFooterCache if `use_footer_cache`, only the segments of
+    // a built rowset may use it, the segments of a rowset being written may still be renamed.
+    Status _parse_footer(SegmentFooterPB* footer, bool use_footer_cache);
     Status _create_column_readers(const SegmentFooterPB& footer);
     Status _load_pk_bloom_filter();
-    ColumnReader* _get_column_reader(const TabletColumn& col);
+    // Set `reader` to nullptr if this segment has no data of the column.
+    Status _get_column_reader(const TabletColumn& col, ColumnReader** reader);
+    // The ColumnReader of a column is created on the first access.
+    Status _get_column_reader(int32_t unique_id, ColumnReader** reader);
 
     // Get Iterator which will read variant root column and extract with paths and types info
     Status _new_iterator_with_variant_root(const TabletColumn& tablet_column,
@@ -210,6 +228,8 @@ private:
     friend class SegmentIterator;
     io::FileSystemSPtr _fs;
     io::FileReaderSPtr _file_reader;
+    // id of the file in StoragePageCache, interned once when the segment is opened
+    uint64_t _page_cache_file_id = 0;
     uint32_t _segment_id;
     uint32_t _num_rows;
 
@@ -231,6 +251,11 @@ private:
     // This means that this segment has no data for that column, which may be added
     // after this segment is generated.
     std::map<int32_t, std::unique_ptr<ColumnReader>> _column_readers;
+    // map column unique id ---> meta of the column whose ColumnReader is not created yet,
+    // a query usually reads a few columns of a wide table.
+    std::map<int32_t, ColumnMetaPB> _column_metas;
+    // protects _column_readers and _column_metas
+    std::shared_mutex _column_readers_lock;
 
     // Init from ColumnMetaPB in SegmentFooterPB
     // map column unique id ---> it's inner data type
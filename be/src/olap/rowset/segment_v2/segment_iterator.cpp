@@ -39,6 +39,7 @@
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "io/fs/file_reader.h"
+#include "io/fs/local_file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
 #include "olap/column_predicate.h"
@@ -55,6 +56,7 @@
 #include "olap/rowset/segment_v2/inverted_index_reader.h"
 #include "olap/rowset/segment_v2/row_ranges.h"
 #include "olap/rowset/segment_v2/segment.h"
+#include "olap/rowset/segment_v2/segment_prefetcher.h"
 #include "olap/schema.h"
 #include "olap/short_key_index.h"
 #include "olap/tablet_schema.h"
@@ -283,6 +285,15 @@ Status SegmentIterator::_init_impl(const StorageReadOptions& opts) {
     _inited = true;
     _file_reader = _segment->_file_reader;
     _opts = opts;
+    if (config::segment_prefetch_pages_ahead > 0 && _opts.stats != nullptr &&
+        _opts.io_ctx.reader_type == ReaderType::READER_QUERY &&
+        dynamic_cast<io::LocalFileReader*>(_segment->_file_reader.get()) == nullptr) {
+        auto prefetcher = std::make_shared<SegmentPrefetcher>(
+                _segment->_file_reader, _opts.io_ctx, _opts.stats,
+                config::segment_prefetch_pages_ahead, config::segment_prefetch_merge_gap_bytes);
+        _prefetcher = prefetcher.get();
+        _file_reader = std::move(prefetcher);
+    }
     _col_predicates.clear();
 
     for (const auto& predicate : opts.column_predicates) {
@@ -475,6 +486,7 @@ Status SegmentIterator::_prepare_seek(const StorageReadOptions::KeyRange& key_ra
                     .use_page_cache = _opts.use_page_cache,
                     .file_reader = _file_reader.get(),
                     .stats = _opts.stats,
+                    .column_unique_id = _column_io_stats_id(cid),
                     .io_ctx = _opts.io_ctx,
             };
             RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
@@ -603,10 +615,14 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
         if (_opts.use_topn_opt) {
             SCOPED_RAW_TIMER(&_opts.stats->block_conditions_filtered_zonemap_ns);
             auto* query_ctx = _opts.runtime_state->get_query_ctx();
-            for (int id : _opts.topn_filter_source_node_ids) {
+            _topn_predicate_versions.resize(_opts.topn_filter_source_node_ids.size(), 0);
+            for (size_t i = 0; i < _opts.topn_filter_source_node_ids.size(); ++i) {
+                int id = _opts.topn_filter_source_node_ids[i];
                 if (!query_ctx->get_runtime_predicate(id).need_update()) {
                     continue;
                 }
+                // read before the predicate, a newer bound is applied again by the next batch
+                _topn_predicate_versions[i] = query_ctx->get_runtime_predicate(id).version();
 
                 std::shared_ptr<doris::ColumnPredicate> runtime_predicate =
                         query_ctx->get_runtime_predicate(id).get_predicate();
@@ -660,6 +676,121 @@ Status SegmentIterator::_get_row_ranges_from_conditions(RowRanges* condition_row
     return Status::OK();
 }
 
+Status SegmentIterator::_prefetch_pages() {
+    if (_prefetcher == nullptr || _opts.read_orderby_key_reverse || _row_bitmap.isEmpty()) {
+        return Status::OK();
+    }
+    std::vector<std::pair<uint32_t, ColumnReader*>> columns;
+    for (auto cid : _schema->column_ids()) {
+        auto* iter = dynamic_cast<FileColumnIterator*>(_column_iterators[cid].get());
+        if (iter != nullptr) {
+            columns.emplace_back(cid, iter->get_reader());
+        }
+    }
+    return _prefetcher->prefetch(columns, _row_bitmap, _next_unread_rowid);
+}
+
+Status SegmentIterator::_prune_by_late_arrival_predicates() {
+    const auto& late_predicates = _opts.late_arrival_predicates;
+    if (late_predicates == nullptr ||
+        late_predicates->version == _late_arrival_predicates_version) {
+        return Status::OK();
+    }
+    _late_arrival_predicates_version = late_predicates->version;
+    // the backward range iterator can not be restarted from the middle
+    if (_opts.read_orderby_key_reverse || _row_bitmap.isEmpty() ||
+        !config::enable_late_arrival_runtime_filter_page_pruning) {
+        return Status::OK();
+    }
+
+    SCOPED_RAW_TIMER(&_opts.stats->block_conditions_filtered_zonemap_ns);
+    RowRanges late_row_ranges = RowRanges::create_single(num_rows());
+    bool pruned = false;
+    for (const auto& predicate : late_predicates->predicates) {
+        auto cid = predicate->column_id();
+        if (cid >= _column_iterators.size() || _column_iterators[cid] == nullptr ||
+            !_segment->can_apply_predicate_safely(cid, predicate.get(), *_schema,
+                                                  _opts.io_ctx.reader_type)) {
+            continue;
+        }
+        AndBlockColumnPredicate and_predicate;
+        and_predicate.add_column_predicate(
+                SingleColumnBlockPredicate::create_unique(predicate.get()));
+        if (predicate->support_zonemap()) {
+            RowRanges column_row_ranges = RowRanges::create_single(num_rows());
+            RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(
+                    &and_predicate, nullptr, &column_row_ranges));
+            RowRanges::ranges_intersection(late_row_ranges, column_row_ranges, &late_row_ranges);
+            pruned = true;
+        }
+        if (predicate->can_do_bloom_filter(false)) {
+            RowRanges column_bf_row_ranges = RowRanges::create_single(num_rows());
+            RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_bloom_filter(
+                    &and_predicate, &column_bf_row_ranges));
+            RowRanges::ranges_intersection(late_row_ranges, column_bf_row_ranges,
+                                           &late_row_ranges);
+            pruned = true;
+        }
+    }
+    if (pruned) {
+        _restart_from_unread_rows(late_row_ranges, &_opts.stats->rows_late_rf_filtered);
+    }
+    return Status::OK();
+}
+
+Status SegmentIterator::_prune_by_topn_predicates() {
+    if (!_opts.use_topn_opt || _opts.read_orderby_key_reverse || _row_bitmap.isEmpty() ||
+        !config::enable_topn_runtime_predicate_page_pruning) {
+        return Status::OK();
+    }
+    auto* query_ctx = _opts.runtime_state->get_query_ctx();
+    _topn_predicate_versions.resize(_opts.topn_filter_source_node_ids.size(), 0);
+    RowRanges topn_row_ranges = RowRanges::create_single(num_rows());
+    bool pruned = false;
+    for (size_t i = 0; i < _opts.topn_filter_source_node_ids.size(); ++i) {
+        auto& runtime_predicate =
+                query_ctx->get_runtime_predicate(_opts.topn_filter_source_node_ids[i]);
+        // the version is polled without the lock, the bound rarely changes near the end
+        int64_t version = runtime_predicate.version();
+        if (version == _topn_predicate_versions[i] || !runtime_predicate.need_update()) {
+            continue;
+        }
+        _topn_predicate_versions[i] = version;
+        std::shared_ptr<ColumnPredicate> predicate = runtime_predicate.get_predicate();
+        auto cid = predicate->column_id();
+        if (cid >= _column_iterators.size() || _column_iterators[cid] == nullptr ||
+            !_segment->can_apply_predicate_safely(cid, predicate.get(), *_schema,
+                                                  _opts.io_ctx.reader_type)) {
+            continue;
+        }
+        SCOPED_RAW_TIMER(&_opts.stats->block_conditions_filtered_zonemap_ns);
+        AndBlockColumnPredicate and_predicate;
+        and_predicate.add_column_predicate(
+                SingleColumnBlockPredicate::create_unique(predicate.get()));
+        RowRanges column_row_ranges = RowRanges::create_single(num_rows());
+        RETURN_IF_ERROR(_column_iterators[cid]->get_row_ranges_by_zone_map(
+                &and_predicate, nullptr, &column_row_ranges));
+        RowRanges::ranges_intersection(topn_row_ranges, column_row_ranges, &topn_row_ranges);
+        pruned = true;
+    }
+    if (pruned) {
+        _restart_from_unread_rows(topn_row_ranges, &_opts.stats->rows_topn_rp_filtered);
+    }
+    return Status::OK();
+}
+
+void SegmentIterator::_restart_from_unread_rows(const RowRanges& row_ranges,
+                                                int64_t* filtered_rows) {
+    roaring::Roaring unread_rows = _row_bitmap;
+    unread_rows.removeRange(0, _next_unread_rowid);
+    size_t pre_size = unread_rows.cardinality();
+    unread_rows &= RowRanges::ranges_to_roaring(row_ranges);
+    *filtered_rows += (pre_size - unread_rows.cardinality());
+    _range_iter.reset();
+    _row_bitmap = std::move(unread_rows);
+    _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
+}
+
 // filter rows by evaluating column predicates using bitmap indexes.
 // upon return, predicates that've been evaluated by bitmap indexes are removed from _col_predicates.
 Status SegmentIterator::_apply_bitmap_index() {
@@ -1330,6 +1461,7 @@ Status SegmentIterator::_init_return_column_iterators() {
                     .is_predicate_column = tmp_is_pred_column[cid],
                     .file_reader = _file_reader.get(),
                     .stats = _opts.stats,
+                    .column_unique_id = _column_io_stats_id(cid),
                     .io_ctx = _opts.io_ctx,
             };
             RETURN_IF_ERROR(_column_iterators[cid]->init(iter_opts));
@@ -1806,6 +1938,13 @@ bool SegmentIterator::_has_char_type(const Field& column_desc) {
     }
 };
 
+int32_t SegmentIterator::_column_io_stats_id(ColumnId cid) const {
+    if (!config::enable_scan_io_stats) {
+        return -1;
+    }
+    return _opts.tablet_schema->column(cid).unique_id();
+}
+
 void SegmentIterator::_vec_init_char_column_id() {
     for (size_t i = 0; i < _schema->num_column_ids(); i++) {
         auto cid = _schema->column_id(i);
@@ -1944,6 +2083,9 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     SCOPED_RAW_TIMER(&_opts.stats->first_read_ns);
 
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
+    if (nrows_read > 0) {
+        _next_unread_rowid = _block_rowids[nrows_read - 1] + 1;
+    }
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
 
@@ -2297,6 +2439,9 @@ Status SegmentIterator::_next_batch_internal(vectorized::Block* block) {
             }
         }
     }
+    RETURN_IF_ERROR(_prune_by_late_arrival_predicates());
+    RETURN_IF_ERROR(_prune_by_topn_predicates());
+    RETURN_IF_ERROR(_prefetch_pages());
     RETURN_IF_ERROR(_init_current_block(block, _current_return_columns));
     _converted_column_ids.assign(_schema->columns().size(), 0);
 
@@ -2735,7 +2880,11 @@ void SegmentIterator::_calculate_pred_in_remaining_conjunct_root(
 
 bool SegmentIterator::_no_need_read_key_data(ColumnId cid, vectorized::MutableColumnPtr& column,
                                              size_t nrows_read) {
-    if (_opts.tablet_schema->keys_type() != KeysType::DUP_KEYS) {
+    // the rows deleted in a merge-on-write table are already removed from `_row_bitmap`, so the
+    // keys are not needed to count its rows either
+    if (_opts.tablet_schema->keys_type() != KeysType::DUP_KEYS &&
+        !(_opts.tablet_schema->keys_type() == KeysType::UNIQUE_KEYS &&
+          _opts.enable_unique_key_merge_on_write)) {
         return false;
     }
 
@@ -69,6 +69,7 @@ class BitmapIndexIterator;
 class ColumnIterator;
 class InvertedIndexIterator;
 class RowRanges;
+class SegmentPrefetcher;
 
 struct ColumnPredicateInfo {
     ColumnPredicateInfo() = default;
@@ -180,6 +181,14 @@ private:
     // calculate row ranges that satisfy requested column conditions using various column index
     [[nodiscard]] Status _get_row_ranges_by_column_conditions();
     [[nodiscard]] Status _get_row_ranges_from_conditions(RowRanges* condition_row_ranges);
+    // prune the unread rows by the predicates of the late arrival runtime filters
+    [[nodiscard]] Status _prune_by_late_arrival_predicates();
+    // prune the unread rows by zone map when a topn runtime predicate has been tightened
+    [[nodiscard]] Status _prune_by_topn_predicates();
+    // keeps the unread rows in `row_ranges` and restarts the range iterator from them
+    void _restart_from_unread_rows(const RowRanges& row_ranges, int64_t* filtered_rows);
+    // issue the async reads of the pages to read next, only when `_prefetcher` is set
+    [[nodiscard]] Status _prefetch_pages();
     [[nodiscard]] Status _apply_bitmap_index();
     [[nodiscard]] Status _apply_inverted_index();
     [[nodiscard]] Status _apply_inverted_index_on_column_predicate(
@@ -207,6 +216,8 @@ private:
     // so segment iterator need to shrink char column before output it. only use in vec query engine.
     void _vec_init_char_column_id();
     bool _has_char_type(const Field& column_desc);
+    // unique id of `cid` to count its pages in `column_io_stats`, -1 if it is not counted
+    int32_t _column_io_stats_id(ColumnId cid) const;
 
     uint32_t segment_id() const { return _segment->id(); }
     uint32_t num_rows() const { return _segment->num_rows(); }
@@ -407,6 +418,11 @@ private:
     std::unique_ptr<BitmapRangeIterator> _range_iter;
     // the next rowid to read
     rowid_t _cur_rowid;
+    // all rows before it have been read by `_range_iter`, only maintained in forward reading
+    rowid_t _next_unread_rowid = 0;
+    int64_t _late_arrival_predicates_version = 0;
+    // the versions of the topn runtime predicates applied, by topn_filter_source_node_ids
+    std::vector<int64_t> _topn_predicate_versions;
     // members related to lazy materialization read
     // --------------------------------------------
     // whether lazy materialization read should be used.
@@ -473,6 +489,8 @@ private:
     vectorized::MutableColumns _short_key;
 
     io::FileReaderSPtr _file_reader;
+    // not null if the pages are read ahead, it is owned by `_file_reader`
+    SegmentPrefetcher* _prefetcher = nullptr;
 
     // char_type or array<char> type columns cid
     std::vector<size_t> _char_type_idx;
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/segment_prefetcher.h"
+
+#include <roaring/roaring.hh>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "olap/olap_common.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/ordinal_page_index.h"
+#include "runtime/exec_env.h"
+#include "util/runtime_profile.h"
+#include "util/threadpool.h"
+
+namespace doris::segment_v2 {
+
+SegmentPrefetcher::SegmentPrefetcher(io::FileReaderSPtr reader, const io::IOContext& io_ctx,
+                                     OlapReaderStatistics* stats, size_t pages_ahead,
+                                     size_t merge_gap_bytes)
+        : _reader(std::move(reader)),
+          _stats(stats),
+          _pages_ahead(pages_ahead),
+          _merge_gap_bytes(merge_gap_bytes) {
+    _async_io_ctx.reader_type = io_ctx.reader_type;
+    _async_io_ctx.is_disposable = io_ctx.is_disposable;
+    _async_io_ctx.read_file_cache = io_ctx.read_file_cache;
+}
+
+Status SegmentPrefetcher::prefetch(const std::vector<std::pair<uint32_t, ColumnReader*>>& columns,
+                                   const roaring::Roaring& row_bitmap,
+                                   rowid_t first_unread_rowid) {
+    // the rows of these pages have been read, they hit the page cache or are skipped
+    for (auto it = _requests.begin(); it != _requests.end();) {
+        auto cur = it++;
+        RequestSPtr request = cur->second;
+        for (auto& piece : request->pieces) {
+            if (!piece.consumed && piece.last_ordinal < first_unread_rowid) {
+                _consume(cur, &piece);
+            }
+        }
+    }
+
+    std::vector<Piece> pieces;
+    for (const auto& [column_id, column_reader] : columns) {
+        RETURN_IF_ERROR(_plan_column(column_id, column_reader, row_bitmap, first_unread_rowid,
+                                     &pieces));
+    }
+    std::sort(pieces.begin(), pieces.end(), [](const Piece& lhs, const Piece& rhs) {
+        return lhs.page.offset < rhs.page.offset;
+    });
+
+    // merge the pages close to each other, the pages of different columns included
+    size_t i = 0;
+    while (i < pieces.size()) {
+        uint64_t offset = pieces[i].page.offset;
+        uint64_t end = offset + pieces[i].page.size;
+        size_t j = i + 1;
+        while (j < pieces.size()) {
+            uint64_t next_offset = pieces[j].page.offset;
+            uint64_t next_end = next_offset + pieces[j].page.size;
+            if (next_offset < end || next_offset - end > _merge_gap_bytes ||
+                next_end - offset > MAX_REQUEST_BYTES || _overlapped(end, next_end)) {
+                break;
+            }
+            end = next_end;
+            ++j;
+        }
+        if (!_overlapped(offset, end)) {
+            _submit(offset, end, std::vector<Piece>(pieces.begin() + i, pieces.begin() + j));
+        }
+        i = j;
+    }
+    return Status::OK();
+}
+
+Status SegmentPrefetcher::_plan_column(uint32_t column_id, ColumnReader* column_reader,
+                                       const roaring::Roaring& row_bitmap,
+                                       rowid_t first_unread_rowid, std::vector<Piece>* pieces) {
+    auto& column = _columns[column_id];
+    if (column.pending_pages >= _pages_ahead) {
+        return Status::OK();
+    }
+    ordinal_t from = std::max<ordinal_t>(column.next_ordinal, first_unread_rowid);
+    if (from >= column_reader->num_rows()) {
+        return Status::OK();
+    }
+    OrdinalPageIndexIterator page_iter;
+    RETURN_IF_ERROR(column_reader->seek_at_or_before(from, &page_iter));
+
+    size_t max_pages = _pages_ahead - column.pending_pages;
+    // do not walk too far through the pages without any row to read
+    size_t max_scanned_pages = max_pages * 4;
+    size_t num_pages = 0;
+    for (size_t scanned = 0;
+         page_iter.valid() && num_pages < max_pages && scanned < max_scanned_pages;
+         ++scanned, page_iter.next()) {
+        ordinal_t first = std::max(from, page_iter.first_ordinal());
+        ordinal_t last = page_iter.last_ordinal();
+        column.next_ordinal = last + 1;
+        uint64_t rows_before = first == 0 ? 0 : row_bitmap.rank(first - 1);
+        if (row_bitmap.rank(last) > rows_before) {
+            pieces->push_back({column_id, page_iter.page(), last});
+            ++num_pages;
+        }
+    }
+    return Status::OK();
+}
+
+bool SegmentPrefetcher::_overlapped(uint64_t offset, uint64_t end) const {
+    auto it = _requests.upper_bound(offset);
+    return (it != _requests.end() && it->first < end) ||
+           (it != _requests.begin() && std::prev(it)->second->end() > offset);
+}
+
+void SegmentPrefetcher::_submit(uint64_t offset, uint64_t end, std::vector<Piece> pieces) {
+    for (const auto& piece : pieces) {
+        _columns[piece.column_id].pending_pages++;
+    }
+    auto request = std::make_shared<Request>(offset, end - offset, std::move(pieces));
+    _requests.emplace(offset, request);
+    _stats->prefetch_bytes += request->size;
+    auto task = [reader = _reader, io_ctx = _async_io_ctx, request]() {
+        size_t bytes_read = 0;
+        Status st = reader->read_at(request->offset, Slice(request->buf.get(), request->size),
+                                    &bytes_read, &io_ctx);
+        if (st.ok() && bytes_read != request->size) {
+            st = Status::InternalError("prefetch short read, offset={}, size={}, read={}",
+                                       request->offset, request->size, bytes_read);
+        }
+        std::lock_guard l(request->lock);
+        request->status = std::move(st);
+        request->done = true;
+        request->done_cv.notify_all();
+    };
+    Status st = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool()->submit_func(
+            std::move(task));
+    if (!st.ok()) {
+        std::lock_guard l(request->lock);
+        request->status = std::move(st);
+        request->done = true;
+    }
+}
+
+void SegmentPrefetcher::_consume(RequestIter it, Piece* piece) {
+    piece->consumed = true;
+    auto& column = _columns[piece->column_id];
+    column.pending_pages -= std::min<size_t>(column.pending_pages, 1);
+    if (--it->second->num_unconsumed == 0) {
+        _requests.erase(it);
+    }
+}
+
+Status SegmentPrefetcher::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                                       const io::IOContext* io_ctx) {
+    RequestSPtr request;
+    auto it = _requests.upper_bound(offset);
+    if (it != _requests.begin()) {
+        --it;
+        if (offset + result.size <= it->second->end()) {
+            request = it->second;
+        }
+    }
+    if (request == nullptr) {
+        _stats->prefetch_miss_num++;
+        return _reader->read_at(offset, result, bytes_read, io_ctx);
+    }
+
+    for (auto& piece : request->pieces) {
+        if (!piece.consumed && piece.page.offset >= offset &&
+            piece.page.offset < offset + result.size) {
+            _consume(it, &piece);
+        }
+    }
+
+    {
+        std::unique_lock l(request->lock);
+        if (!request->done) {
+            SCOPED_RAW_TIMER(&_stats->prefetch_wait_ns);
+            request->done_cv.wait(l, [&request]() { return request->done; });
+        }
+    }
+    if (!request->status.ok()) {
+        LOG(INFO) << "prefetch failed, read it again, file=" << path().native()
+                  << ", status=" << request->status;
+        _stats->prefetch_miss_num++;
+        return _reader->read_at(offset, result, bytes_read, io_ctx);
+    }
+    memcpy(result.data, request->buf.get() + (offset - request->offset), result.size);
+    *bytes_read = result.size;
+    _stats->prefetch_hit_num++;
+    return Status::OK();
+}
+
+} // namespace doris::segment_v2
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "io/fs/file_reader.h"
+#include "io/io_common.h"
+#include "olap/rowset/segment_v2/common.h"
+#include "olap/rowset/segment_v2/page_pointer.h"
+
+namespace roaring {
+class Roaring;
+} // namespace roaring
+
+namespace doris {
+
+struct OlapReaderStatistics;
+
+namespace segment_v2 {
+
+class ColumnReader;
+
+// Reads the data pages of a segment ahead of the column iterators.
+//
+// The segment iterator calls `prefetch` with all projected columns before reading a batch,
+// the pages that cover the rows still to be read are planned together, at most `pages_ahead`
+// unread pages per column. Like MergeRangeFileReader, pages of different columns whose
+// offsets are at most `merge_gap_bytes` apart are merged into one read, which is issued to
+// the prefetch thread pool. The column iterators read through this reader, a read covered by
+// a prefetched range waits for the async read and copies its piece from the shared buffer,
+// other reads go to the underlying reader.
+//
+// Not thread safe, it is only used by the thread of the segment iterator.
+class SegmentPrefetcher final : public io::FileReader {
+public:
+    SegmentPrefetcher(io::FileReaderSPtr reader, const io::IOContext& io_ctx,
+                      OlapReaderStatistics* stats, size_t pages_ahead, size_t merge_gap_bytes);
+
+    ~SegmentPrefetcher() override = default;
+
+    // The underlying reader is shared by the segment, it is not closed here.
+    Status close() override { return Status::OK(); }
+
+    const io::Path& path() const override { return _reader->path(); }
+
+    size_t size() const override { return _reader->size(); }
+
+    bool closed() const override { return _reader->closed(); }
+
+    // Issues async reads for the pages of `columns` (column id -> reader) which contain rows
+    // of `row_bitmap` at or after `first_unread_rowid`.
+    Status prefetch(const std::vector<std::pair<uint32_t, ColumnReader*>>& columns,
+                    const roaring::Roaring& row_bitmap, rowid_t first_unread_rowid);
+
+    // Max bytes of a merged read.
+    static constexpr size_t MAX_REQUEST_BYTES = 4 * 1024 * 1024;
+
+protected:
+    Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
+                        const io::IOContext* io_ctx) override;
+
+private:
+    // A page planned to be read ahead.
+    struct Piece {
+        uint32_t column_id;
+        PagePointer page;
+        // the last ordinal of the page
+        ordinal_t last_ordinal;
+        // read by the column iterator, or skipped
+        bool consumed = false;
+    };
+
+    struct Request {
+        Request(uint64_t offset_, uint64_t size_, std::vector<Piece> pieces_)
+                : offset(offset_),
+                  size(size_),
+                  pieces(std::move(pieces_)),
+                  num_unconsumed(pieces.size()),
+                  buf(new char[size_]) {}
+
+        uint64_t end() const { return offset + size; }
+
+        const uint64_t offset;
+        const uint64_t size;
+        std::vector<Piece> pieces;
+        size_t num_unconsumed;
+        std::unique_ptr<char[]> buf;
+
+        std::mutex lock;
+        std::condition_variable done_cv;
+        bool done = false;
+        Status status;
+    };
+    using RequestSPtr = std::shared_ptr<Request>;
+    using RequestIter = std::map<uint64_t, RequestSPtr>::iterator;
+
+    struct ColumnState {
+        // the first ordinal which has not been considered for prefetching
+        ordinal_t next_ordinal = 0;
+        // pages prefetched but not consumed yet
+        size_t pending_pages = 0;
+    };
+
+    // Collects the pages of a column to read ahead into `pieces`.
+    Status _plan_column(uint32_t column_id, ColumnReader* column_reader,
+                        const roaring::Roaring& row_bitmap, rowid_t first_unread_rowid,
+                        std::vector<Piece>* pieces);
+
+    // Whether [offset, end) overlaps any request.
+    bool _overlapped(uint64_t offset, uint64_t end) const;
+
+    void _submit(uint64_t offset, uint64_t end, std::vector<Piece> pieces);
+
+    // Marks the piece consumed, `it` is erased when all of its pieces are consumed.
+    void _consume(RequestIter it, Piece* piece);
+
+    io::FileReaderSPtr _reader;
+    // The async reads may outlive the scan, so they do not report to the query's stats.
+    io::IOContext _async_io_ctx;
+    OlapReaderStatistics* _stats = nullptr;
+    const size_t _pages_ahead;
+    const size_t _merge_gap_bytes;
+
+    // offset -> request, requests never overlap
+    std::map<uint64_t, RequestSPtr> _requests;
+    std::unordered_map<uint32_t, ColumnState> _columns;
+};
+
+} // namespace segment_v2
+} // namespace doris
@@ -62,6 +62,7 @@
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/string_util.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/schema_util.h"
@@ -207,6 +208,7 @@ Status SegmentWriter::init(const std::vector<uint32_t>& col_ids, bool has_key) {
         // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
         // except for columns whose type don't support zone map.
         opts.need_zone_map = column.is_key() || _tablet_schema->keys_type() != KeysType::AGG_KEYS;
+        opts.is_sort_key = column.is_key();
         opts.need_bloom_filter = column.is_bf_column();
         auto* tablet_index = _tablet_schema->get_ngram_bf_index(column.unique_id());
         if (tablet_index) {
@@ -271,6 +273,11 @@ Status SegmentWriter::init(const std::vector<uint32_t>& col_ids, bool has_key) {
         if (column.is_row_store_column()) {
             // smaller page size for row store column
             opts.data_page_size = config::row_column_page_size;
+            CompressionTypePB compression;
+            if (!config::row_column_compression.empty() &&
+                CompressionTypePB_Parse(to_upper(config::row_column_compression), &compression)) {
+                opts.meta->set_compression(compression);
+            }
         }
         std::unique_ptr<ColumnWriter> writer;
         RETURN_IF_ERROR(ColumnWriter::create(opts, &column, _file_writer, &writer));
@@ -149,7 +149,7 @@ Status ZoneMapIndexReader::load(bool use_page_cache, bool kept_in_memory) {
 
 Status ZoneMapIndexReader::_load(bool use_page_cache, bool kept_in_memory,
                                  std::unique_ptr<IndexedColumnMetaPB> page_zone_maps_meta) {
-    IndexedColumnReader reader(_file_reader, *page_zone_maps_meta);
+    IndexedColumnReader reader(_file_reader, *page_zone_maps_meta, _page_cache_file_id);
     RETURN_IF_ERROR(reader.load(use_page_cache, kept_in_memory));
     IndexedColumnIterator iter(&reader);
 
@@ -146,8 +146,9 @@ private:
 class ZoneMapIndexReader {
 public:
     explicit ZoneMapIndexReader(io::FileReaderSPtr file_reader,
-                                const IndexedColumnMetaPB& page_zone_maps)
-            : _file_reader(std::move(file_reader)) {
+                                const IndexedColumnMetaPB& page_zone_maps,
+                                uint64_t page_cache_file_id = 0)
+            : _file_reader(std::move(file_reader)), _page_cache_file_id(page_cache_file_id) {
         _page_zone_maps_meta.reset(new IndexedColumnMetaPB(page_zone_maps));
     }
 
@@ -165,6 +166,7 @@ private:
     DorisCallOnce<Status> _load_once;
     // TODO: yyq, we shoud remove file_reader from here.
     io::FileReaderSPtr _file_reader;
+    uint64_t _page_cache_file_id;
     std::unique_ptr<IndexedColumnMetaPB> _page_zone_maps_meta;
     std::vector<ZoneMapPB> _page_zone_maps;
 };
@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/scan_io_stats.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris {
+
+ScanIOStats* ScanIOStats::instance() {
+    static ScanIOStats instance;
+    return &instance;
+}
+
+void ScanIOStats::record(int64_t tablet_id, const OlapReaderStatistics& stats,
+                         int64_t compressed_bytes_read, int64_t raw_rows_read,
+                         int64_t rows_returned, int64_t rowsets_read) {
+    auto& shard = _shards[static_cast<uint64_t>(tablet_id) % kNumShards];
+    size_t max_tablets = std::max<int32_t>(config::scan_io_stats_max_tablets, kNumShards);
+    int64_t now = UnixMillis();
+    std::lock_guard lock(shard.mtx);
+    auto it = shard.tablets.find(tablet_id);
+    if (it == shard.tablets.end()) {
+        if (shard.tablets.size() >= max_tablets / kNumShards) {
+            auto oldest = std::min_element(shard.tablets.begin(), shard.tablets.end(),
+                                           [](const auto& a, const auto& b) {
+                                               return a.second.last_scan_time_ms <
+                                                      b.second.last_scan_time_ms;
+                                           });
+            shard.tablets.erase(oldest);
+        }
+        it = shard.tablets.emplace(tablet_id, TabletStats {}).first;
+    }
+    auto& tablet = it->second;
+    tablet.scan_count++;
+    tablet.rows_returned += rows_returned;
+    tablet.raw_rows_read += raw_rows_read;
+    tablet.rowsets_read += rowsets_read;
+    tablet.compressed_bytes_read += compressed_bytes_read;
+    tablet.uncompressed_bytes_read += stats.uncompressed_bytes_read;
+    tablet.total_pages_num += stats.total_pages_num;
+    tablet.cached_pages_num += stats.cached_pages_num;
+    tablet.file_cache_local_bytes += stats.file_cache_stats.bytes_read_from_local;
+    tablet.file_cache_remote_bytes += stats.file_cache_stats.bytes_read_from_remote;
+    tablet.last_scan_time_ms = now;
+    for (const auto& [unique_id, column_stats] : stats.column_io_stats) {
+        auto& column = tablet.columns[unique_id];
+        column.compressed_bytes_read += column_stats.compressed_bytes_read;
+        column.uncompressed_bytes_read += column_stats.uncompressed_bytes_read;
+        column.total_pages_num += column_stats.total_pages_num;
+        column.cached_pages_num += column_stats.cached_pages_num;
+    }
+}
+
+std::vector<std::pair<int64_t, ScanIOStats::TabletStats>> ScanIOStats::top_tablets(
+        size_t limit) const {
+    std::vector<std::pair<int64_t, TabletStats>> tablets;
+    for (const auto& shard : _shards) {
+        std::lock_guard lock(shard.mtx);
+        tablets.insert(tablets.end(), shard.tablets.begin(), shard.tablets.end());
+    }
+    auto more_bytes = [](const auto& a, const auto& b) {
+        return a.second.compressed_bytes_read > b.second.compressed_bytes_read;
+    };
+    if (limit > 0 && limit < tablets.size()) {
+        std::partial_sort(tablets.begin(), tablets.begin() + limit, tablets.end(), more_bytes);
+        tablets.resize(limit);
+    } else {
+        std::sort(tablets.begin(), tablets.end(), more_bytes);
+    }
+    return tablets;
+}
+
+bool ScanIOStats::get(int64_t tablet_id, TabletStats* stats) const {
+    const auto& shard = _shards[static_cast<uint64_t>(tablet_id) % kNumShards];
+    std::lock_guard lock(shard.mtx);
+    auto it = shard.tablets.find(tablet_id);
+    if (it == shard.tablets.end()) {
+        return false;
+    }
+    *stats = it->second;
+    return true;
+}
+
+void ScanIOStats::reset() {
+    for (auto& shard : _shards) {
+        std::lock_guard lock(shard.mtx);
+        shard.tablets.clear();
+    }
+}
+
+std::string ScanIOStats::to_json(size_t limit) const {
+    return to_json(top_tablets(limit));
+}
+
+static double ratio(int64_t a, int64_t b) {
+    return b == 0 ? 0 : static_cast<double>(a) / static_cast<double>(b);
+}
+
+std::string ScanIOStats::to_json(const std::vector<std::pair<int64_t, TabletStats>>& tablets) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartArray();
+    for (const auto& [tablet_id, tablet] : tablets) {
+        writer.StartObject();
+        writer.Key("tablet_id");
+        writer.Int64(tablet_id);
+        writer.Key("scan_count");
+        writer.Int64(tablet.scan_count);
+        writer.Key("rows_returned");
+        writer.Int64(tablet.rows_returned);
+        writer.Key("raw_rows_read");
+        writer.Int64(tablet.raw_rows_read);
+        // rows read per row returned
+        writer.Key("read_amplification");
+        writer.Double(ratio(tablet.raw_rows_read, tablet.rows_returned));
+        writer.Key("rowsets_per_scan");
+        writer.Double(ratio(tablet.rowsets_read, tablet.scan_count));
+        writer.Key("compressed_bytes_read");
+        writer.Int64(tablet.compressed_bytes_read);
+        writer.Key("uncompressed_bytes_read");
+        writer.Int64(tablet.uncompressed_bytes_read);
+        writer.Key("total_pages_num");
+        writer.Int64(tablet.total_pages_num);
+        writer.Key("page_cache_hit_rate");
+        writer.Double(ratio(tablet.cached_pages_num, tablet.total_pages_num));
+        writer.Key("file_cache_local_bytes");
+        writer.Int64(tablet.file_cache_local_bytes);
+        writer.Key("file_cache_remote_bytes");
+        writer.Int64(tablet.file_cache_remote_bytes);
+        writer.Key("file_cache_hit_rate");
+        writer.Double(ratio(tablet.file_cache_local_bytes,
+                            tablet.file_cache_local_bytes + tablet.file_cache_remote_bytes));
+        writer.Key("last_scan_time_ms");
+        writer.Int64(tablet.last_scan_time_ms);
+        writer.Key("columns");
+        writer.StartArray();
+        for (const auto& [unique_id, column] : tablet.columns) {
+            writer.StartObject();
+            writer.Key("column_unique_id");
+            writer.Int(unique_id);
+            writer.Key("compressed_bytes_read");
+            writer.Int64(column.compressed_bytes_read);
+            writer.Key("uncompressed_bytes_read");
+            writer.Int64(column.uncompressed_bytes_read);
+            writer.Key("total_pages_num");
+            writer.Int64(column.total_pages_num);
+            writer.Key("page_cache_hit_rate");
+            writer.Double(ratio(column.cached_pages_num, column.total_pages_num));
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    return buffer.GetString();
+}
+
+} // namespace doris
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "olap/olap_common.h"
+
+namespace doris {
+
+// Aggregates the storage reads of the finished scans per tablet and column, to find the hot
+// tablets and columns and how much of what they read the scans returned, see
+// `/api/scan_io_stats`. The scanners record their `OlapReaderStatistics` when they close.
+class ScanIOStats {
+public:
+    struct TabletStats {
+        int64_t scan_count = 0;
+        // rows returned by the scanners, after the conjuncts
+        int64_t rows_returned = 0;
+        int64_t raw_rows_read = 0;
+        // rowsets merged by the readers
+        int64_t rowsets_read = 0;
+        int64_t compressed_bytes_read = 0;
+        int64_t uncompressed_bytes_read = 0;
+        int64_t total_pages_num = 0;
+        int64_t cached_pages_num = 0;
+        int64_t file_cache_local_bytes = 0;
+        int64_t file_cache_remote_bytes = 0;
+        int64_t last_scan_time_ms = 0;
+        // column unique id -> pages read
+        std::map<int32_t, ColumnIOStatistics> columns;
+    };
+
+    static ScanIOStats* instance();
+
+    // `compressed_bytes_read` and `raw_rows_read` are passed separately, the scanner resets them
+    // in `stats` when it updates the realtime counters.
+    void record(int64_t tablet_id, const OlapReaderStatistics& stats,
+                int64_t compressed_bytes_read, int64_t raw_rows_read, int64_t rows_returned,
+                int64_t rowsets_read);
+
+    // The `limit` tablets with the most compressed bytes read, all of them if `limit` is 0.
+    std::vector<std::pair<int64_t, TabletStats>> top_tablets(size_t limit) const;
+
+    bool get(int64_t tablet_id, TabletStats* stats) const;
+
+    void reset();
+
+    std::string to_json(size_t limit) const;
+
+    static std::string to_json(const std::vector<std::pair<int64_t, TabletStats>>& tablets);
+
+private:
+    static constexpr size_t kNumShards = 16;
+
+    struct Shard {
+        mutable std::mutex mtx;
+        std::unordered_map<int64_t, TabletStats> tablets;
+    };
+
+    Shard _shards[kNumShards];
+};
+
+} // namespace doris
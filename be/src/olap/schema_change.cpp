@@ -18,6 +18,8 @@
 #include "olap/schema_change.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <exception>
 #include <map>
 #include <memory>
@@ -68,8 +70,10 @@
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "util/debug_points.h"
 #include "util/defer_op.h"
+#include "util/thread.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -247,6 +251,115 @@ private:
     RowRefComparator _cmp;
 };
 
+// Reads the blocks of the ref rowset on another thread, so that reading the old data overlaps
+// the conversion, sorting and writing of the new data. At most MAX_BLOCKS blocks are read ahead.
+// The blocks are read in place if enable_schema_change_read_ahead is off.
+class RefBlockReadAhead {
+public:
+    RefBlockReadAhead(RowsetReaderSharedPtr rowset_reader, const TabletSchema& tablet_schema)
+            : _rowset_reader(std::move(rowset_reader)), _tablet_schema(tablet_schema) {}
+
+    ~RefBlockReadAhead() { _stop(); }
+
+    Status start() {
+        if (!config::enable_schema_change_read_ahead) {
+            return Status::OK();
+        }
+        auto mem_tracker = thread_context()->thread_mem_tracker_mgr->limiter_mem_tracker();
+        return Thread::create(
+                "SchemaChange", "sc_read_ahead",
+                [this, mem_tracker]() {
+                    SCOPED_ATTACH_TASK(mem_tracker);
+                    _read();
+                },
+                &_thread);
+    }
+
+    // Read the next block, `eof` is set with the last one, which may be empty
+    Status next(vectorized::Block* block, bool* eof) {
+        if (_thread == nullptr) {
+            return _read_block(block, eof);
+        }
+        std::unique_lock<std::mutex> l(_lock);
+        _cv.wait(l, [this] { return !_blocks.empty() || _finished; });
+        if (_blocks.empty()) {
+            return _status.ok() ? Status::InternalError("read ahead finished without eof")
+                                : _status;
+        }
+        block->swap(_blocks.front().block);
+        *eof = _blocks.front().eof;
+        _blocks.pop_front();
+        _cv.notify_all();
+        return Status::OK();
+    }
+
+private:
+    static constexpr size_t MAX_BLOCKS = 2;
+
+    struct Item {
+        vectorized::Block block;
+        bool eof = false;
+    };
+
+    Status _read_block(vectorized::Block* block, bool* eof) {
+        *eof = false;
+        auto st = _rowset_reader->next_block(block);
+        if (st.is<ErrorCode::END_OF_FILE>()) {
+            *eof = true;
+            return Status::OK();
+        }
+        return st;
+    }
+
+    void _read() {
+        Status st;
+        bool eof = false;
+        while (!eof) {
+            Item item {.block = _tablet_schema.create_block()};
+            st = _read_block(&item.block, &eof);
+            if (!st.ok()) {
+                break;
+            }
+            item.eof = eof;
+            std::unique_lock<std::mutex> l(_lock);
+            _cv.wait(l, [this] { return _blocks.size() < MAX_BLOCKS || _cancelled; });
+            if (_cancelled) {
+                break;
+            }
+            _blocks.push_back(std::move(item));
+            _cv.notify_all();
+        }
+        std::lock_guard<std::mutex> l(_lock);
+        _status = st;
+        _finished = true;
+        _cv.notify_all();
+    }
+
+    void _stop() {
+        if (_thread == nullptr) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> l(_lock);
+            _cancelled = true;
+            _cv.notify_all();
+        }
+        _thread->join();
+        _thread.reset();
+    }
+
+    RowsetReaderSharedPtr _rowset_reader;
+    const TabletSchema& _tablet_schema;
+
+    scoped_refptr<Thread> _thread;
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::deque<Item> _blocks;
+    bool _cancelled = false;
+    bool _finished = false;
+    Status _status;
+};
+
 BlockChanger::BlockChanger(TabletSchemaSPtr tablet_schema, DescriptorTbl desc_tbl)
         : _desc_tbl(std::move(desc_tbl)) {
     _schema_mapping.resize(tablet_schema->num_columns());
@@ -477,22 +590,16 @@ Status VSchemaChangeDirectly::_inner_process(RowsetReaderSharedPtr rowset_reader
                                              RowsetWriter* rowset_writer, BaseTabletSPtr new_tablet,
                                              TabletSchemaSPtr base_tablet_schema,
                                              TabletSchemaSPtr new_tablet_schema) {
+    RefBlockReadAhead read_ahead(rowset_reader, *base_tablet_schema);
+    RETURN_IF_ERROR(read_ahead.start());
     bool eof = false;
     do {
         auto new_block = vectorized::Block::create_unique(new_tablet_schema->create_block());
         auto ref_block = vectorized::Block::create_unique(base_tablet_schema->create_block());
 
-        auto st = rowset_reader->next_block(ref_block.get());
-        if (!st) {
-            if (st.is<ErrorCode::END_OF_FILE>()) {
-                if (ref_block->rows() == 0) {
-                    break;
-                } else {
-                    eof = true;
-                }
-            } else {
-                return st;
-            }
+        RETURN_IF_ERROR(read_ahead.next(ref_block.get(), &eof));
+        if (eof && ref_block->rows() == 0) {
+            break;
         }
 
         RETURN_IF_ERROR(_changer.change_block(ref_block.get(), new_block.get()));
@@ -547,20 +654,14 @@ Status VBaseSchemaChangeWithSorting::_inner_process(RowsetReaderSharedPtr rowset
 
     auto new_block = vectorized::Block::create_unique(new_tablet_schema->create_block());
 
+    RefBlockReadAhead read_ahead(rowset_reader, *base_tablet_schema);
+    RETURN_IF_ERROR(read_ahead.start());
     bool eof = false;
     do {
         auto ref_block = vectorized::Block::create_unique(base_tablet_schema->create_block());
-        auto st = rowset_reader->next_block(ref_block.get());
-        if (!st) {
-            if (st.is<ErrorCode::END_OF_FILE>()) {
-                if (ref_block->rows() == 0) {
-                    break;
-                } else {
-                    eof = true;
-                }
-            } else {
-                return st;
-            }
+        RETURN_IF_ERROR(read_ahead.next(ref_block.get(), &eof));
+        if (eof && ref_block->rows() == 0) {
+            break;
         }
 
         RETURN_IF_ERROR(_changer.change_block(ref_block.get(), new_block.get()));
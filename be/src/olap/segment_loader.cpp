@@ -49,6 +49,28 @@ void SegmentCache::erase(const SegmentCache::CacheKey& key) {
     LRUCachePolicy::erase(key.encode());
 }
 
+bool SegmentFooterCache::lookup(const SegmentCache::CacheKey& key, std::string* footer) {
+    auto* lru_handle = LRUCachePolicy::lookup(key.encode());
+    if (lru_handle == nullptr) {
+        return false;
+    }
+    *footer = ((CacheValue*)LRUCachePolicy::value(lru_handle))->footer;
+    LRUCachePolicy::release(lru_handle);
+    return true;
+}
+
+void SegmentFooterCache::insert(const SegmentCache::CacheKey& key, const std::string& footer) {
+    auto* cache_value = new CacheValue();
+    cache_value->footer = footer;
+    auto* lru_handle = LRUCachePolicy::insert(key.encode(), cache_value, footer.size(),
+                                              footer.size(), CachePriority::NORMAL);
+    LRUCachePolicy::release(lru_handle);
+}
+
+void SegmentFooterCache::erase(const SegmentCache::CacheKey& key) {
+    LRUCachePolicy::erase(key.encode());
+}
+
 Status SegmentLoader::load_segments(const BetaRowsetSharedPtr& rowset,
                                     SegmentCacheHandle* cache_handle, bool use_cache) {
     if (cache_handle->is_inited()) {
@@ -81,6 +103,9 @@ void SegmentLoader::erase_segment(const SegmentCache::CacheKey& key) {
 void SegmentLoader::erase_segments(const RowsetId& rowset_id, int64_t num_segments) {
     for (int64_t i = 0; i < num_segments; i++) {
         erase_segment(SegmentCache::CacheKey(rowset_id, i));
+        if (_footer_cache != nullptr) {
+            _footer_cache->erase(SegmentCache::CacheKey(rowset_id, i));
+        }
     }
 }
 
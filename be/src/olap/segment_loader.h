@@ -32,6 +32,7 @@
 #include "common/status.h"
 #include "olap/lru_cache.h"
 #include "olap/olap_common.h" // for rowset id
+#include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/segment.h"
 #include "runtime/memory/lru_cache_policy.h"
 #include "util/time.h"
@@ -84,6 +85,9 @@ public:
             : LRUCachePolicy(CachePolicy::CacheType::SEGMENT_CACHE, capacity, LRUCacheType::SIZE,
                              config::tablet_rowset_stale_sweep_time_sec) {}
 
+    // A miss opens the segment, reads and parses the footer.
+    double refill_cost_per_byte() override { return 8.0; }
+
     // Lookup the given segment in the cache.
     // If the segment is found, the cache entry will be written into handle.
     // Return true if entry is found, otherwise return false.
@@ -97,6 +101,33 @@ public:
     void erase(const SegmentCache::CacheKey& key);
 };
 
+// The serialized footers of the segments, so that reopening a segment evicted from the
+// SegmentCache, e.g. for the first query after a compaction, does not read its footer again.
+// A serialized footer is much smaller than the opened segment with its column readers.
+class SegmentFooterCache : public LRUCachePolicy {
+public:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        CacheValue() : LRUCacheValueBase(CachePolicy::CacheType::SEGMENT_FOOTER_CACHE) {}
+
+        std::string footer;
+    };
+
+    SegmentFooterCache(size_t capacity)
+            : LRUCachePolicy(CachePolicy::CacheType::SEGMENT_FOOTER_CACHE, capacity,
+                             LRUCacheType::SIZE, config::tablet_rowset_stale_sweep_time_sec) {}
+
+    // A miss reads the tail of the segment file.
+    double refill_cost_per_byte() override { return 8.0; }
+
+    // Return true and copy the serialized footer if the segment is found.
+    bool lookup(const SegmentCache::CacheKey& key, std::string* footer);
+
+    void insert(const SegmentCache::CacheKey& key, const std::string& footer);
+
+    void erase(const SegmentCache::CacheKey& key);
+};
+
 class SegmentLoader {
 public:
     static SegmentLoader* instance();
@@ -109,7 +140,12 @@ public:
     // After the estimation of segment memory usage is provided later, it is recommended
     // to use Memory as the capacity limit of the cache.
 
-    SegmentLoader(size_t capacity) { _segment_cache = std::make_unique<SegmentCache>(capacity); }
+    SegmentLoader(size_t capacity, size_t footer_cache_capacity = 0) {
+        _segment_cache = std::make_unique<SegmentCache>(capacity);
+        if (footer_cache_capacity > 0) {
+            _footer_cache = std::make_unique<SegmentFooterCache>(footer_cache_capacity);
+        }
+    }
 
     // Load segments of "rowset", return the "cache_handle" which contains segments.
     // If use_cache is true, it will be loaded from _cache.
@@ -120,9 +156,13 @@ public:
 
     void erase_segments(const RowsetId& rowset_id, int64_t num_segments);
 
+    // nullptr if the footer cache is disabled
+    SegmentFooterCache* footer_cache() { return _footer_cache.get(); }
+
 private:
     SegmentLoader();
     std::unique_ptr<SegmentCache> _segment_cache;
+    std::unique_ptr<SegmentFooterCache> _footer_cache;
 };
 
 // A handle for a single rowset from segment lru cache.
@@ -146,6 +186,15 @@ public:
 
     std::vector<segment_v2::SegmentSharedPtr>& get_segments() { return segments; }
 
+    // The primary key index iterator of each segment, kept by the caller looking up many keys
+    // in these segments, see Segment::lookup_row_key().
+    std::unique_ptr<segment_v2::IndexedColumnIterator>* pk_index_iterator(size_t segment_idx) {
+        if (pk_index_iterators.size() < segments.size()) {
+            pk_index_iterators.resize(segments.size());
+        }
+        return &pk_index_iterators[segment_idx];
+    }
+
     [[nodiscard]] bool is_inited() const { return _init; }
 
     void set_inited() {
@@ -155,6 +204,8 @@ public:
 
 private:
     std::vector<segment_v2::SegmentSharedPtr> segments;
+    // destroyed before the segments
+    std::vector<std::unique_ptr<segment_v2::IndexedColumnIterator>> pk_index_iterators;
     bool _init {false};
 
     // Don't allow copy and assign
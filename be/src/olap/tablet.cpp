@@ -928,6 +928,23 @@ bool Tablet::can_do_compaction(size_t path_hash, CompactionType compaction_type)
     return true;
 }
 
+double Tablet::update_query_heat(int64_t now_ms) {
+    // the weight of the latest sample
+    static constexpr double QUERY_HEAT_ALPHA = 0.3;
+    if (query_scan_count == nullptr) {
+        return 0;
+    }
+    int64_t scan_count = query_scan_count->value();
+    if (_query_heat_update_ms > 0 && now_ms > _query_heat_update_ms) {
+        double scans_per_second = static_cast<double>(scan_count - _query_heat_scan_count) *
+                                  1000 / static_cast<double>(now_ms - _query_heat_update_ms);
+        _query_heat = QUERY_HEAT_ALPHA * scans_per_second + (1 - QUERY_HEAT_ALPHA) * _query_heat;
+    }
+    _query_heat_scan_count = scan_count;
+    _query_heat_update_ms = now_ms;
+    return _query_heat;
+}
+
 uint32_t Tablet::calc_compaction_score(
         CompactionType compaction_type,
         std::shared_ptr<CumulativeCompactionPolicy> cumulative_compaction_policy) {
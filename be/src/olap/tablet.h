@@ -224,6 +224,10 @@ public:
         _last_base_compaction_failure_millis = millis;
     }
 
+    // Update and return the exponentially weighted moving average of the query scans per second
+    // on this tablet, only called by the compaction producer thread.
+    double update_query_heat(int64_t now_ms);
+
     int64_t last_full_compaction_failure_time() { return _last_full_compaction_failure_millis; }
     void set_last_full_compaction_failure_time(int64_t millis) {
         _last_full_compaction_failure_millis = millis;
@@ -541,6 +545,10 @@ private:
 
     // if this tablet is broken, set to true. default is false
     std::atomic<bool> _is_bad;
+    // for update_query_heat()
+    double _query_heat = 0;
+    int64_t _query_heat_scan_count = 0;
+    int64_t _query_heat_update_ms = 0;
     // timestamp of last cumu compaction failure
     std::atomic<int64_t> _last_cumu_compaction_failure_millis;
     // timestamp of last base compaction failure
@@ -28,6 +28,7 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cmath>
 #include <list>
 #include <mutex>
 #include <ostream>
@@ -726,6 +727,8 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(
             compaction_type == CompactionType::BASE_COMPACTION ? "base" : "cumulative";
     uint32_t highest_score = 0;
     uint32_t compaction_score = 0;
+    double highest_priority = 0;
+    double query_heat_weight = config::compaction_query_heat_weight;
     TabletSharedPtr best_tablet;
     auto handler = [&](const TabletSharedPtr& tablet_ptr) {
         if (config::enable_skip_tablet_compaction &&
@@ -775,8 +778,21 @@ TabletSharedPtr TabletManager::find_best_tablet_to_compaction(
         if (current_compaction_score < 5) {
             tablet_ptr->set_skip_compaction(true, compaction_type, UnixSeconds());
         }
-        if (current_compaction_score > highest_score) {
-            highest_score = current_compaction_score;
+        // the same compaction removes more read amplification on a tablet read by more queries
+        double priority = current_compaction_score;
+        if (query_heat_weight > 0) {
+            double query_heat = tablet_ptr->update_query_heat(now_ms);
+            auto keys_type = tablet_ptr->keys_type();
+            if (keys_type == KeysType::AGG_KEYS ||
+                (keys_type == KeysType::UNIQUE_KEYS &&
+                 !tablet_ptr->enable_unique_key_merge_on_write())) {
+                query_heat *= std::max(config::compaction_merge_on_read_heat_factor, 1.0);
+            }
+            priority *= 1 + query_heat_weight * std::log2(1 + query_heat);
+        }
+        highest_score = std::max(highest_score, current_compaction_score);
+        if (priority > highest_priority) {
+            highest_priority = priority;
             compaction_score = current_compaction_score;
             best_tablet = tablet_ptr;
         }
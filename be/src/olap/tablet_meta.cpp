@@ -984,14 +984,13 @@ DeleteBitmap DeleteBitmap::snapshot() const {
 }
 
 DeleteBitmap DeleteBitmap::snapshot(Version version) const {
-    // Take snapshot first, then remove keys greater than given version.
-    DeleteBitmap snapshot = this->snapshot();
-    auto it = snapshot.delete_bitmap.begin();
-    while (it != snapshot.delete_bitmap.end()) {
-        if (std::get<2>(it->first) > version) {
-            it = snapshot.delete_bitmap.erase(it);
-        } else {
-            it++;
+    // Only copy the bitmaps not greater than the given version, the later ones may be many
+    // and large on a tablet with frequent loads.
+    DeleteBitmap snapshot(_tablet_id);
+    std::shared_lock l(lock);
+    for (const auto& [k, bm] : delete_bitmap) {
+        if (std::get<2>(k) <= version) {
+            snapshot.delete_bitmap.emplace_hint(snapshot.delete_bitmap.end(), k, bm);
         }
     }
     return snapshot;
@@ -1011,13 +1010,21 @@ int DeleteBitmap::remove(const BitmapKey& bmk, uint32_t row_id) {
 }
 
 void DeleteBitmap::remove(const BitmapKey& start, const BitmapKey& end) {
-    std::lock_guard l(lock);
-    for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end();) {
-        auto& [k, _] = *it;
-        if (k >= end) {
-            break;
+    {
+        std::lock_guard l(lock);
+        for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end();) {
+            auto& [k, _] = *it;
+            if (k >= end) {
+                break;
+            }
+            it = delete_bitmap.erase(it);
         }
-        it = delete_bitmap.erase(it);
+    }
+    std::lock_guard l(_agg_versions_lock);
+    auto it = _agg_versions.lower_bound({std::get<0>(start), std::get<1>(start)});
+    while (it != _agg_versions.end() &&
+           it->first < std::make_pair(std::get<0>(end), std::get<1>(end))) {
+        it = _agg_versions.erase(it);
     }
 }
 
@@ -1134,9 +1141,33 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
     //        of cache entries in some cases?
     if (val == nullptr) { // Renew if needed, put a new Value to cache
         val = new AggCache::Value();
+        const auto& [rowset_id, segment_id, version] = bmk;
+        // Start from the aggregation of an earlier version if it is still cached, so that only
+        // the bitmaps of the new versions are merged when the read version moves forward.
+        Version start_version = 0;
+        Version cached_version = 0;
+        {
+            std::lock_guard l(_agg_versions_lock);
+            auto it = _agg_versions.find({rowset_id, segment_id});
+            if (it != _agg_versions.end() && it->second < version) {
+                cached_version = it->second;
+            }
+        }
+        if (cached_version > 0) {
+            std::string cached_key_str =
+                    agg_cache_key(_tablet_id, {rowset_id, segment_id, cached_version});
+            Cache::Handle* cached_handle = _agg_cache->repr()->lookup(CacheKey(cached_key_str));
+            if (cached_handle != nullptr) {
+                val->bitmap = reinterpret_cast<AggCache::Value*>(
+                                      _agg_cache->repr()->value(cached_handle))
+                                      ->bitmap;
+                _agg_cache->repr()->release(cached_handle);
+                start_version = cached_version + 1;
+            }
+        }
         {
             std::shared_lock l(lock);
-            DeleteBitmap::BitmapKey start {std::get<0>(bmk), std::get<1>(bmk), 0};
+            DeleteBitmap::BitmapKey start {rowset_id, segment_id, start_version};
             for (auto it = delete_bitmap.lower_bound(start); it != delete_bitmap.end(); ++it) {
                 auto& [k, bm] = *it;
                 if (std::get<0>(k) != std::get<0>(bmk) || std::get<1>(k) != std::get<1>(bmk) ||
@@ -1148,6 +1179,9 @@ std::shared_ptr<roaring::Roaring> DeleteBitmap::get_agg(const BitmapKey& bmk) co
         }
         size_t charge = val->bitmap.getSizeInBytes() + sizeof(AggCache::Value);
         handle = _agg_cache->repr()->insert(key, val, charge, charge, CachePriority::NORMAL);
+        std::lock_guard l(_agg_versions_lock);
+        auto& latest_version = _agg_versions[{rowset_id, segment_id}];
+        latest_version = std::max(latest_version, version);
     }
 
     // It is natural for the cache to reclaim the underlying memory
@@ -546,6 +546,10 @@ public:
 private:
     mutable std::shared_ptr<AggCache> _agg_cache;
     int64_t _tablet_id;
+    // The latest version aggregated in _agg_cache of each segment, get_agg() of a later version
+    // starts from it and only merges the bitmaps after it.
+    mutable std::mutex _agg_versions_lock;
+    mutable std::map<std::pair<RowsetId, SegmentId>, Version> _agg_versions;
 };
 
 static const std::string SEQUENCE_COL = "__DORIS_SEQUENCE_COL__";
@@ -28,6 +28,9 @@
 #include <ostream>
 #include <shared_mutex>
 
+#include "cloud/cloud_storage_engine.h"
+#include "cloud/cloud_tablet_hotspot.h"
+#include "cloud/config.h"
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
 #include "common/logging.h"
@@ -48,6 +51,7 @@
 #include "olap/tablet.h"
 #include "olap/tablet_meta.h"
 #include "olap/tablet_schema.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_predicate.h"
 #include "runtime/runtime_state.h"
@@ -235,6 +239,7 @@ Status TabletReader::_capture_rs_readers(const ReaderParams& read_params) {
     _reader_context.need_ordered_result = need_ordered_result;
     _reader_context.use_topn_opt = read_params.use_topn_opt;
     _reader_context.topn_filter_source_node_ids = read_params.topn_filter_source_node_ids;
+    _reader_context.late_arrival_predicates = read_params.late_arrival_predicates;
     _reader_context.read_orderby_key_reverse = read_params.read_orderby_key_reverse;
     _reader_context.read_orderby_key_limit = read_params.read_orderby_key_limit;
     _reader_context.filter_block_conjuncts = read_params.filter_block_conjuncts;
@@ -263,6 +268,11 @@ Status TabletReader::_capture_rs_readers(const ReaderParams& read_params) {
     _reader_context.output_columns = &read_params.output_columns;
     _reader_context.push_down_agg_type_opt = read_params.push_down_agg_type_opt;
     _reader_context.ttl_seconds = _tablet->ttl_seconds();
+    if (config::is_cloud_mode() && read_params.reader_type == ReaderType::READER_QUERY) {
+        // the hot tablets are kept longer in the file cache
+        auto& hotspot = ExecEnv::GetInstance()->storage_engine().to_cloud().tablet_hotspot();
+        _reader_context.ttl_seconds = hotspot.file_cache_ttl_seconds(*_tablet);
+    }
 
     return Status::OK();
 }
@@ -162,6 +162,7 @@ public:
         // flag for enable topn opt
         bool use_topn_opt = false;
         std::vector<int> topn_filter_source_node_ids;
+        std::shared_ptr<LateArrivalPredicates> late_arrival_predicates;
         // used for special optimization for query : ORDER BY key LIMIT n
         bool read_orderby_key = false;
         // used for special optimization for query : ORDER BY key DESC LIMIT n
@@ -49,6 +49,10 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
     return std::make_pair(lru_handle, tablet_schema_ptr);
 }
 
+Cache::Handle* TabletSchemaCache::ref(Cache::Handle* handle) {
+    return lookup(reinterpret_cast<LRUHandle*>(handle)->key());
+}
+
 void TabletSchemaCache::release(Cache::Handle* lru_handle) {
     LRUCachePolicy::release(lru_handle);
 }
@@ -40,6 +40,10 @@ public:
 
     std::pair<Cache::Handle*, TabletSchemaSPtr> insert(const std::string& key);
 
+    // Another reference to the entry of `handle`, without the serialized schema to look it up.
+    // nullptr if the entry has been evicted.
+    Cache::Handle* ref(Cache::Handle* handle);
+
     void release(Cache::Handle*);
 
 private:
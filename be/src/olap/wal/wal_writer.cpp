@@ -17,19 +17,119 @@
 
 #include "olap/wal/wal_writer.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+
 #include "common/config.h"
+#include "io/fs/err_utils.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
 #include "io/fs/path.h"
 #include "olap/storage_engine.h"
 #include "olap/wal/wal_manager.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 
 namespace doris {
 
 const char* k_wal_magic = "WAL1";
 const uint32_t k_wal_magic_length = 4;
 
+namespace {
+
+// Syncs the closed wal files of concurrent loads in groups. The first waiting writer becomes the
+// leader, it starts the writeback of all the waiting files at once, waits for each of them and
+// syncs their directories once, instead of one directory sync per file.
+class WalGroupSyncer {
+public:
+    Status sync(const std::string& file_name) {
+        Request request {file_name};
+        std::unique_lock l(_mutex);
+        _pending.push_back(&request);
+        while (!request.done) {
+            if (_syncing) {
+                _cond.wait(l);
+                continue;
+            }
+            _syncing = true;
+            std::vector<Request*> requests;
+            requests.swap(_pending);
+            l.unlock();
+            _sync(requests);
+            l.lock();
+            for (auto* r : requests) {
+                r->done = true;
+            }
+            _syncing = false;
+            _cond.notify_all();
+        }
+        return request.status;
+    }
+
+private:
+    struct Request {
+        std::string file_name;
+        Status status;
+        bool done = false;
+    };
+
+    static Status _sync_file(const std::string& file_name, bool is_dir, bool wait) {
+        int fd = ::open(file_name.c_str(), (is_dir ? O_DIRECTORY : 0) | O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            return io::localfs_error(errno, fmt::format("failed to open {}", file_name));
+        }
+        Defer defer {[fd] { ::close(fd); }};
+#if defined(__linux__)
+        if (!wait) {
+            // only starts the writeback, so that the files are written to the disk in parallel
+            if (sync_file_range(fd, 0, 0, SYNC_FILE_RANGE_WRITE) < 0) {
+                return io::localfs_error(errno, fmt::format("failed to write back {}", file_name));
+            }
+            return Status::OK();
+        }
+#endif
+        if (wait && 0 != ::fdatasync(fd)) {
+            return io::localfs_error(errno, fmt::format("failed to sync {}", file_name));
+        }
+        return Status::OK();
+    }
+
+    static void _sync(const std::vector<Request*>& requests) {
+        for (auto* r : requests) {
+            r->status = _sync_file(r->file_name, false, false);
+        }
+        std::map<std::string, Status> dirs;
+        for (auto* r : requests) {
+            if (r->status.ok()) {
+                r->status = _sync_file(r->file_name, false, true);
+            }
+            dirs.emplace(io::Path(r->file_name).parent_path().native(), Status::OK());
+        }
+        for (auto& [dir, status] : dirs) {
+            status = _sync_file(dir, true, true);
+        }
+        for (auto* r : requests) {
+            const auto& dir_status = dirs[io::Path(r->file_name).parent_path().native()];
+            if (r->status.ok() && !dir_status.ok()) {
+                r->status = dir_status;
+            }
+        }
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    bool _syncing = false;
+    std::vector<Request*> _pending;
+};
+
+WalGroupSyncer s_group_syncer;
+
+} // namespace
+
 WalWriter::WalWriter(const std::string& file_name) : _file_name(file_name) {}
 
 WalWriter::~WalWriter() {}
@@ -42,7 +142,11 @@ Status WalWriter::init() {
     if (!exists) {
         RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(parent_path));
     }
-    RETURN_IF_ERROR(io::global_local_filesystem()->create_file(_file_name, &_file_writer));
+    // the file is synced by the group syncer when it is finalized
+    _group_sync = config::group_commit_wal_group_sync;
+    io::FileWriterOptions opts {.sync_file_data = !_group_sync};
+    RETURN_IF_ERROR(
+            io::global_local_filesystem()->create_file(_file_name, &_file_writer, &opts));
     LOG(INFO) << "create wal " << _file_name;
     return Status::OK();
 }
@@ -54,6 +158,11 @@ Status WalWriter::finalize() {
     auto st = _file_writer->close();
     if (!st.ok()) {
         LOG(WARNING) << "fail to close wal " << _file_name;
+    } else if (_group_sync) {
+        st = s_group_syncer.sync(_file_name);
+        if (!st.ok()) {
+            LOG(WARNING) << "fail to sync wal " << _file_name << ", st=" << st;
+        }
     }
     return Status::OK();
 }
@@ -62,24 +171,27 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
     if (!_file_writer) {
         return Status::InternalError("wal writer is null,fail to write file={}", _file_name);
     }
+    // the blocks are serialized into one buffer in place, and written by one append
     size_t total_size = 0;
+    for (const auto& block : blocks) {
+        total_size += LENGTH_SIZE + block->ByteSizeLong() + CHECKSUM_SIZE;
+    }
+    _buffer.resize(total_size);
     size_t offset = 0;
     for (const auto& block : blocks) {
-        uint8_t len_buf[sizeof(uint64_t)];
-        uint64_t block_length = block->ByteSizeLong();
-        total_size += LENGTH_SIZE + block_length + CHECKSUM_SIZE;
-        encode_fixed64_le(len_buf, block_length);
-        RETURN_IF_ERROR(_file_writer->append({len_buf, sizeof(uint64_t)}));
+        // the size is cached by ByteSizeLong() above
+        uint64_t block_length = block->GetCachedSize();
+        encode_fixed64_le(_buffer.data() + offset, block_length);
         offset += LENGTH_SIZE;
 
-        std::string content = block->SerializeAsString();
-        RETURN_IF_ERROR(_file_writer->append(content));
+        uint8_t* content = _buffer.data() + offset;
+        if (block->SerializeWithCachedSizesToArray(content) != content + block_length) {
+            return Status::InternalError("failed to serialize block to wal {}", _file_name);
+        }
         offset += block_length;
 
-        uint8_t checksum_buf[sizeof(uint32_t)];
-        uint32_t checksum = crc32c::Value(content.data(), block_length);
-        encode_fixed32_le(checksum_buf, checksum);
-        RETURN_IF_ERROR(_file_writer->append({checksum_buf, sizeof(uint32_t)}));
+        uint32_t checksum = crc32c::Value(reinterpret_cast<const char*>(content), block_length);
+        encode_fixed32_le(_buffer.data() + offset, checksum);
         offset += CHECKSUM_SIZE;
     }
     if (offset != total_size) {
@@ -87,7 +199,7 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
                 "failed to write block to wal expected= " + std::to_string(total_size) +
                 ",actually=" + std::to_string(offset));
     }
-    return Status::OK();
+    return _file_writer->append({_buffer.data(), total_size});
 }
 
 Status WalWriter::append_header(std::string col_ids) {
@@ -48,6 +48,10 @@ public:
 private:
     std::string _file_name;
     io::FileWriterPtr _file_writer;
+    // sync the file with the other wal files when it is finalized, instead of on its close
+    bool _group_sync = false;
+    // reused to serialize the appended blocks
+    std::vector<uint8_t> _buffer;
 };
 
 } // namespace doris
\ No newline at end of file
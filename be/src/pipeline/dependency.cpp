@@ -26,6 +26,10 @@
 #include "pipeline/pipeline_task.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "util/doris_metrics.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/exprs/vexpr_context.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
@@ -49,10 +53,17 @@ void Dependency::_add_block_task(PipelineTask* task) {
     _blocked_task.push_back(task);
 }
 
+LatencyHistogramMetric* Dependency::_block_latency_metric(const std::string& name) {
+    return DorisMetrics::instance()->dependency_block_latency_us->get(name);
+}
+
 void Dependency::set_ready() {
     if (_ready) {
         return;
     }
+    if (_watcher.is_running()) {
+        _block_latency->add(_watcher.elapsed_time() / 1000);
+    }
     _watcher.stop();
     std::vector<PipelineTask*> local_block_task {};
     {
@@ -64,7 +75,7 @@ void Dependency::set_ready() {
         local_block_task.swap(_blocked_task);
     }
     for (auto* task : local_block_task) {
-        task->wake_up();
+        task->wake_up(this);
     }
 }
 
@@ -183,6 +194,11 @@ Status AggSharedState::reset_hash_table() {
                                 mapped = nullptr;
                             }
                         });
+                        if (hash_table.has_null_key_data()) {
+                            static_cast<void>(_destroy_agg_status(
+                                    hash_table.template get_null_key_data<
+                                            vectorized::AggregateDataPtr>()));
+                        }
 
                         aggregate_data_container.reset(new vectorized::AggregateDataContainer(
                                 sizeof(typename HashTableType::key_type),
@@ -244,6 +260,91 @@ void PartitionedAggSharedState::close() {
     spill_partitions.clear();
 }
 
+size_t AnalyticSharedState::spillable_bytes(const vectorized::Block& block) const {
+    size_t bytes = 0;
+    for (size_t i = 0; i < block.columns(); ++i) {
+        if (!is_key_column(i)) {
+            bytes += block.get_by_position(i).column->allocated_bytes();
+        }
+    }
+    return bytes;
+}
+
+void AnalyticSharedState::close() {
+    bool false_close = false;
+    if (!is_closed.compare_exchange_strong(false_close, true)) {
+        return;
+    }
+    for (auto& stream : spill_streams) {
+        (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+    }
+    spill_streams.clear();
+}
+
+Status SetSharedState::get_spill_key_block(int child_id, vectorized::Block* block,
+                                           vectorized::Block* key_block) {
+    const auto& exprs = child_exprs_lists[child_id];
+    for (size_t i = 0; i < exprs.size(); ++i) {
+        int result_col_id = -1;
+        RETURN_IF_ERROR(exprs[i]->execute(block, &result_col_id));
+        auto column_with_type = block->get_by_position(result_col_id);
+        column_with_type.column = column_with_type.column->convert_to_full_column_if_const();
+        if (build_not_ignore_null[i]) {
+            column_with_type.column = make_nullable(column_with_type.column);
+            column_with_type.type = make_nullable(column_with_type.type);
+        }
+        key_block->insert(std::move(column_with_type));
+    }
+    return Status::OK();
+}
+
+Status SetSharedState::spill_key_block(
+        RuntimeState* state, int child_id, const vectorized::Block& key_block,
+        const std::function<Status(vectorized::SpillStreamSPtr&)>& create_stream) {
+    const auto rows = key_block.rows();
+    if (rows == 0) {
+        return Status::OK();
+    }
+    std::vector<uint64_t> hashes(rows, 0);
+    for (size_t i = 0; i < key_block.columns(); ++i) {
+        key_block.get_by_position(i).column->update_hashes_with_value(hashes.data());
+    }
+    std::vector<std::vector<uint32_t>> partition_indexes(spill_partition_count);
+    for (uint32_t row = 0; row < rows; ++row) {
+        partition_indexes[hashes[row] % spill_partition_count].emplace_back(row);
+    }
+
+    auto& streams = spilled_streams[child_id];
+    for (size_t i = 0; i < spill_partition_count; ++i) {
+        const auto& indexes = partition_indexes[i];
+        if (indexes.empty()) {
+            continue;
+        }
+        auto partition_block = vectorized::MutableBlock::create_unique(key_block.clone_empty());
+        partition_block->add_rows(&key_block, indexes.data(), indexes.data() + indexes.size());
+        if (!streams[i]) {
+            RETURN_IF_ERROR(create_stream(streams[i]));
+        }
+        RETURN_IF_ERROR(streams[i]->spill_block(state, partition_block->to_block(), false));
+    }
+    return Status::OK();
+}
+
+void SetSharedState::close() {
+    bool false_close = false;
+    if (!is_closed.compare_exchange_strong(false_close, true)) {
+        return;
+    }
+    for (auto& streams : spilled_streams) {
+        for (auto& stream : streams) {
+            if (stream) {
+                (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+            }
+        }
+    }
+    spilled_streams.clear();
+}
+
 void SpillSortSharedState::close() {
     // need to use CAS instead of only `if (!is_closed)` statement,
     // to avoid concurrent entry of close() both pass the if statement
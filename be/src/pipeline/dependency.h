@@ -19,7 +19,9 @@
 
 #include <sqltypes.h>
 
+#include <algorithm>
 #include <atomic>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -43,6 +45,10 @@
 #include "vec/exec/vset_operation_node.h"
 #include "vec/spill/spill_stream.h"
 
+namespace doris {
+class LatencyHistogramMetric;
+} // namespace doris
+
 namespace doris::pipeline {
 
 class Dependency;
@@ -92,13 +98,15 @@ public:
               _node_id(node_id),
               _name(std::move(name)),
               _is_write_dependency(false),
-              _ready(false) {}
+              _ready(false),
+              _block_latency(_block_latency_metric(_name)) {}
     Dependency(int id, int node_id, std::string name, bool ready)
             : _id(id),
               _node_id(node_id),
               _name(std::move(name)),
               _is_write_dependency(true),
-              _ready(ready) {}
+              _ready(ready),
+              _block_latency(_block_latency_metric(_name)) {}
     virtual ~Dependency() = default;
 
     bool is_write_dependency() const { return _is_write_dependency; }
@@ -161,6 +169,7 @@ public:
 
 protected:
     void _add_block_task(PipelineTask* task);
+    static LatencyHistogramMetric* _block_latency_metric(const std::string& name);
 
     const int _id;
     const int _node_id;
@@ -170,6 +179,8 @@ protected:
 
     BasicSharedState* _shared_state = nullptr;
     MonotonicStopWatch _watcher;
+    // the time of every block, in microseconds
+    LatencyHistogramMetric* const _block_latency;
 
     std::mutex _task_lock;
     std::vector<PipelineTask*> _blocked_task;
@@ -287,6 +298,30 @@ private:
     const IRuntimeFilter* _runtime_filter = nullptr;
 };
 
+// Merges the first phase aggregation of all instances of a fragment on this BE by key before it
+// is sent. At eos every sink partitions its groups by the hash of the keys into one list of
+// serialized blocks per instance and releases its hash table, then the source of every instance
+// merges the blocks of its partition. A group is owned by one instance, so the BE sends one
+// partial result per group instead of one per instance.
+struct AggLocalMergeState {
+    explicit AggLocalMergeState(size_t num_instances_)
+            : num_instances(num_instances_),
+              blocks(num_instances_ * num_instances_),
+              sink_deps(num_instances_, nullptr) {}
+
+    // Returns true if it is the last sink to finish.
+    bool sink_finished() {
+        return num_finished_sinks.fetch_add(1, std::memory_order_acq_rel) + 1 == num_instances;
+    }
+
+    const size_t num_instances;
+    // blocks[owner * num_instances + sink], only written by `sink` before it finishes
+    std::vector<std::vector<vectorized::Block>> blocks;
+    // the dependency of the sink of every instance, the last sink sets all of them ready to read
+    std::vector<Dependency*> sink_deps;
+    std::atomic<size_t> num_finished_sinks = 0;
+};
+
 struct AggSharedState : public BasicSharedState {
     ENABLE_FACTORY_CREATOR(AggSharedState)
 public:
@@ -337,6 +372,10 @@ public:
     MemoryRecord mem_usage_record;
     bool enable_spill = false;
 
+    // not null if the groups are merged with the other instances, see AggLocalMergeState
+    std::shared_ptr<AggLocalMergeState> local_merge_state;
+    size_t local_merge_idx = 0;
+
 private:
     void _close_with_serialized_key() {
         std::visit(vectorized::Overload {[&](std::monostate& arg) -> void {
@@ -489,11 +528,24 @@ public:
     pipeline::MultiCastDataStreamer multi_cast_data_streamer;
 };
 
-struct AnalyticSharedState : public BasicSharedState {
+struct AnalyticSharedState : public BasicSharedState,
+                             public std::enable_shared_from_this<AnalyticSharedState> {
     ENABLE_FACTORY_CREATOR(AnalyticSharedState)
 
 public:
     AnalyticSharedState() = default;
+    ~AnalyticSharedState() override { close(); }
+
+    // Whether the window evaluation reads the column at `idx` of the input blocks.
+    bool is_key_column(int64_t idx) const {
+        return std::find(partition_by_column_idxs.begin(), partition_by_column_idxs.end(), idx) !=
+                       partition_by_column_idxs.end() ||
+               std::find(ordey_by_column_idxs.begin(), ordey_by_column_idxs.end(), idx) !=
+                       ordey_by_column_idxs.end();
+    }
+    // The bytes of the columns of `block` which can be spilled.
+    size_t spillable_bytes(const vectorized::Block& block) const;
+    void close();
 
     int64_t current_row_position = 0;
     vectorized::BlockRowPos partition_by_end;
@@ -511,6 +563,22 @@ public:
     // TODO: maybe global?
     std::vector<int64_t> partition_by_column_idxs;
     std::vector<int64_t> ordey_by_column_idxs;
+
+    // Spill of the buffered partitions. The window evaluation only reads the partition by and
+    // order by columns of the input blocks, the other columns are only output. When the memory
+    // is revoked, those columns of the blocks not output yet are written to a spill stream and
+    // replaced by constant columns, and they are read back when their block is output.
+    // Every revoke spills the blocks after the last spilled one into a new stream, so the
+    // streams hold the spilled blocks in the order they are output.
+    std::vector<uint8_t> spilled_blocks;
+    std::deque<vectorized::SpillStreamSPtr> spill_streams;
+    size_t next_block_to_spill = 0;
+    // The number of blocks output by the source.
+    size_t output_block_count = 0;
+    // The spillable bytes of the blocks neither output nor spilled.
+    std::atomic<int64_t> unspilled_bytes = 0;
+    Status spill_status;
+    std::atomic_bool is_closed = false;
 };
 
 struct JoinSharedState : public BasicSharedState {
@@ -538,6 +606,9 @@ struct HashJoinSharedState : public JoinSharedState {
     const std::vector<TupleDescriptor*> build_side_child_desc;
     size_t build_exprs_size = 0;
     std::shared_ptr<vectorized::Block> build_block;
+    // the dictionary encoded columns of build_block by their positions, see
+    // HashJoinBuildSinkLocalState::_dict_encode_build_block
+    vectorized::DictEncodedStringColumns build_dict_columns;
     std::shared_ptr<std::vector<uint32_t>> build_indexes_null;
     bool probe_ignore_null = false;
 };
@@ -583,9 +654,12 @@ public:
     ~AsyncWriterDependency() override = default;
 };
 
-struct SetSharedState : public BasicSharedState {
+struct SetSharedState : public BasicSharedState,
+                        public std::enable_shared_from_this<SetSharedState> {
     ENABLE_FACTORY_CREATOR(SetSharedState)
 public:
+    ~SetSharedState() override { close(); }
+
     /// default init
     vectorized::Block build_block; // build to source
     //record element size in hashtable
@@ -615,6 +689,28 @@ public:
 
     std::atomic<bool> ready_for_read = false;
 
+    /// spill
+    // When the build sink is asked to revoke memory before its hash table is built, the key
+    // columns of all children are partitioned by hash into `spill_partition_count` streams,
+    // ([child][partition]), and the source builds and probes the hash table partition by
+    // partition.
+    bool is_spilled = false;
+    size_t spill_partition_count = 0;
+    std::vector<std::vector<vectorized::SpillStreamSPtr>> spilled_streams;
+    Status spill_status;
+    std::atomic_bool is_closed = false;
+
+    // Evaluates the result exprs of child `child_id` on `block` into `key_block`, the key
+    // columns are nullable if the hash table does not ignore null.
+    Status get_spill_key_block(int child_id, vectorized::Block* block,
+                               vectorized::Block* key_block);
+    // Appends the rows of `key_block` to the streams of their partitions, `create_stream` is
+    // called for the partitions without a stream.
+    Status spill_key_block(
+            RuntimeState* state, int child_id, const vectorized::Block& key_block,
+            const std::function<Status(vectorized::SpillStreamSPtr&)>& create_stream);
+    void close();
+
     /// called in setup_local_state
     void hash_table_init() {
         using namespace vectorized;
@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "runtime/primitive_type.h"
 #include "vec/common/hash_table/hash.h"
@@ -71,6 +72,20 @@ Status AggSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
     _hash_table_input_counter = ADD_COUNTER(Base::profile(), "HashTableInputCount", TUnit::UNIT);
     _max_row_size_counter = ADD_COUNTER(Base::profile(), "MaxRowSizeInBytes", TUnit::UNIT);
 
+    auto& p = Base::_parent->template cast<AggSinkOperatorX>();
+    if (p._enable_local_merge && state->task_num() > 1) {
+        if (info.task_idx >= state->task_num()) {
+            return Status::InternalError("invalid task idx {} of {} tasks for local merge",
+                                         info.task_idx, state->task_num());
+        }
+        std::call_once(p._local_merge_once, [&]() {
+            p._local_merge_state = std::make_shared<AggLocalMergeState>(state->task_num());
+        });
+        Base::_shared_state->local_merge_state = p._local_merge_state;
+        Base::_shared_state->local_merge_idx = info.task_idx;
+        p._local_merge_state->sink_deps[info.task_idx] = Base::_dependency;
+        _local_merge_partition_timer = ADD_TIMER(Base::profile(), "LocalMergePartitionTime");
+    }
     return Status::OK();
 }
 
@@ -227,6 +242,11 @@ void AggSinkLocalState::_update_memusage_with_serialized_key() {
                            Base::_mem_tracker->consume(
                                    data.get_buffer_size_in_bytes() -
                                    Base::_shared_state->mem_usage_record.used_in_state);
+                           Base::_mem_sites.consume(MemSite::ARENA, arena_memory_usage);
+                           Base::_mem_sites.consume(
+                                   MemSite::HASH_TABLE,
+                                   data.get_buffer_size_in_bytes() -
+                                           Base::_shared_state->mem_usage_record.used_in_state);
                            _serialize_key_arena_memory_usage->add(arena_memory_usage);
                            COUNTER_UPDATE(
                                    _hash_table_memory_usage,
@@ -403,6 +423,7 @@ void AggSinkLocalState::_update_memusage_without_key() {
     auto arena_memory_usage =
             _agg_arena_pool->size() - Base::_shared_state->mem_usage_record.used_in_arena;
     Base::_mem_tracker->consume(arena_memory_usage);
+    Base::_mem_sites.consume(MemSite::ARENA, arena_memory_usage);
     _serialize_key_arena_memory_usage->add(arena_memory_usage);
     Base::_shared_state->mem_usage_record.used_in_arena = _agg_arena_pool->size();
 }
@@ -617,6 +638,8 @@ Status AggSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* state) {
 
     _is_merge = std::any_of(agg_functions.cbegin(), agg_functions.cend(),
                             [](const auto& e) { return e.nodes[0].agg_expr.is_merge_agg; });
+    _enable_local_merge = config::enable_agg_local_merge && _is_first_phase && !_is_merge &&
+                          !_needs_finalize && !_probe_expr_ctxs.empty() && _limit == -1;
 
     return Status::OK();
 }
@@ -645,31 +668,9 @@ Status AggSinkOperatorX::prepare(RuntimeState* state) {
                 intermediate_slot_desc, output_slot_desc));
     }
 
-    _offsets_of_aggregate_states.resize(_aggregate_evaluators.size());
-
-    for (size_t i = 0; i < _aggregate_evaluators.size(); ++i) {
-        _offsets_of_aggregate_states[i] = _total_size_of_aggregate_states;
-
-        const auto& agg_function = _aggregate_evaluators[i]->function();
-        // aggreate states are aligned based on maximum requirement
-        _align_aggregate_states = std::max(_align_aggregate_states, agg_function->align_of_data());
-        _total_size_of_aggregate_states += agg_function->size_of_data();
-
-        // If not the last aggregate_state, we need pad it so that next aggregate_state will be aligned.
-        if (i + 1 < _aggregate_evaluators.size()) {
-            size_t alignment_of_next_state =
-                    _aggregate_evaluators[i + 1]->function()->align_of_data();
-            if ((alignment_of_next_state & (alignment_of_next_state - 1)) != 0) {
-                return Status::RuntimeError("Logical error: align_of_data is not 2^N");
-            }
-
-            /// Extend total_size to next alignment requirement
-            /// Add padding by rounding up 'total_size_of_aggregate_states' to be a multiplier of alignment_of_next_state.
-            _total_size_of_aggregate_states =
-                    (_total_size_of_aggregate_states + alignment_of_next_state - 1) /
-                    alignment_of_next_state * alignment_of_next_state;
-        }
-    }
+    RETURN_IF_ERROR(vectorized::AggFnEvaluator::calc_state_layout(
+            _aggregate_evaluators, &_offsets_of_aggregate_states,
+            &_total_size_of_aggregate_states, &_align_aggregate_states));
     // check output type
     if (_needs_finalize) {
         RETURN_IF_ERROR(vectorized::AggFnEvaluator::check_agg_fn_output(
@@ -699,7 +700,11 @@ Status AggSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in_
         local_state._executor->update_memusage(&local_state);
     }
     if (eos) {
-        local_state._dependency->set_ready_to_read();
+        if (local_state._shared_state->local_merge_state) {
+            RETURN_IF_ERROR(local_state._partition_for_local_merge(state));
+        } else {
+            local_state._dependency->set_ready_to_read();
+        }
     }
     return Status::OK();
 }
@@ -709,6 +714,98 @@ size_t AggSinkOperatorX::get_revocable_mem_size(RuntimeState* state) const {
     return local_state._memory_usage();
 }
 
+Status AggSinkLocalState::_partition_for_local_merge(RuntimeState* state) {
+    SCOPED_TIMER(_local_merge_partition_timer);
+    auto& shared_state = *Base::_shared_state;
+    auto& merge_state = *shared_state.local_merge_state;
+    const size_t num_instances = merge_state.num_instances;
+    const size_t batch_size = state->batch_size();
+    RETURN_IF_ERROR(std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> Status {
+                        return Status::InternalError("uninited hash table");
+                    },
+                    [&](auto& agg_method) -> Status {
+                        auto& hash_table = *agg_method.hash_table;
+                        using KeyType = typename std::decay_t<decltype(hash_table)>::key_type;
+                        std::vector<std::vector<KeyType>> keys(num_instances);
+                        std::vector<std::vector<vectorized::AggregateDataPtr>> values(
+                                num_instances);
+
+                        auto to_block = [&](size_t owner, vectorized::AggregateDataPtr null_data) {
+                            vectorized::MutableColumns key_columns;
+                            for (const auto& ctx : shared_state.probe_expr_ctxs) {
+                                key_columns.emplace_back(ctx->root()->data_type()->create_column());
+                            }
+                            agg_method.insert_keys_into_columns(keys[owner], key_columns,
+                                                                keys[owner].size());
+                            if (null_data) {
+                                // only one key of group by support wrap null key
+                                DCHECK(key_columns.size() == 1);
+                                DCHECK(key_columns[0]->is_nullable());
+                                key_columns[0]->insert_data(nullptr, 0);
+                                values[owner].emplace_back(null_data);
+                            }
+
+                            vectorized::ColumnsWithTypeAndName columns;
+                            for (size_t i = 0; i < key_columns.size(); ++i) {
+                                const auto& root = shared_state.probe_expr_ctxs[i]->root();
+                                columns.emplace_back(std::move(key_columns[i]), root->data_type(),
+                                                     root->expr_name());
+                            }
+                            for (size_t i = 0; i < shared_state.aggregate_evaluators.size(); ++i) {
+                                const auto& function =
+                                        shared_state.aggregate_evaluators[i]->function();
+                                auto column = function->create_serialize_column();
+                                function->serialize_to_column(
+                                        values[owner], shared_state.offsets_of_aggregate_states[i],
+                                        column, values[owner].size());
+                                columns.emplace_back(std::move(column),
+                                                     function->get_serialized_type(), "");
+                            }
+                            merge_state.blocks[owner * num_instances + shared_state.local_merge_idx]
+                                    .emplace_back(columns);
+                            keys[owner].clear();
+                            values[owner].clear();
+                        };
+
+                        shared_state.aggregate_data_container->init_once();
+                        auto& iter = shared_state.aggregate_data_container->iterator;
+                        for (; iter != shared_state.aggregate_data_container->end(); ++iter) {
+                            const auto& key = iter.template get_key<KeyType>();
+                            // the high bits, the hash table of the owner indexes by the low bits
+                            auto hash = static_cast<uint32_t>(hash_table.hash(key));
+                            size_t owner = (static_cast<uint64_t>(hash) * num_instances) >> 32;
+                            keys[owner].emplace_back(key);
+                            values[owner].emplace_back(iter.get_aggregate_data());
+                            if (keys[owner].size() >= batch_size) {
+                                to_block(owner, nullptr);
+                            }
+                        }
+                        // the null key is owned by the first instance
+                        for (size_t owner = 0; owner < num_instances; ++owner) {
+                            vectorized::AggregateDataPtr null_data = nullptr;
+                            if (owner == 0 && hash_table.has_null_key_data()) {
+                                null_data = hash_table.template get_null_key_data<
+                                        vectorized::AggregateDataPtr>();
+                            }
+                            if (!keys[owner].empty() || null_data) {
+                                to_block(owner, null_data);
+                            }
+                        }
+                        return Status::OK();
+                    }},
+            _agg_data->method_variant));
+
+    RETURN_IF_ERROR(Base::_parent->template cast<AggSinkOperatorX>().reset_hash_table(state));
+    if (merge_state.sink_finished()) {
+        for (auto* dep : merge_state.sink_deps) {
+            dep->set_ready_to_read();
+        }
+    }
+    return Status::OK();
+}
+
 Status AggSinkOperatorX::reset_hash_table(RuntimeState* state) {
     auto& local_state = get_local_state(state);
     auto& ss = *local_state.Base::_shared_state;
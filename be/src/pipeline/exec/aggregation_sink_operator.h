@@ -19,6 +19,9 @@
 
 #include <stdint.h>
 
+#include <memory>
+#include <mutex>
+
 #include "pipeline/exec/operator.h"
 #include "runtime/block_spill_manager.h"
 #include "runtime/exec_env.h"
@@ -94,6 +97,10 @@ protected:
     Status _create_agg_status(vectorized::AggregateDataPtr data);
     size_t _memory_usage() const;
 
+    // Serializes the groups into the blocks of their owners and releases the hash table,
+    // see AggLocalMergeState.
+    Status _partition_for_local_merge(RuntimeState* state);
+
     RuntimeProfile::Counter* _hash_table_compute_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_emplace_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_input_counter = nullptr;
@@ -104,6 +111,7 @@ protected:
     RuntimeProfile::Counter* _serialize_data_timer = nullptr;
     RuntimeProfile::Counter* _deserialize_data_timer = nullptr;
     RuntimeProfile::Counter* _max_row_size_counter = nullptr;
+    RuntimeProfile::Counter* _local_merge_partition_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _serialize_key_arena_memory_usage = nullptr;
 
@@ -148,6 +156,11 @@ public:
         return _is_colocate ? DataDistribution(ExchangeType::BUCKET_HASH_SHUFFLE, _partition_exprs)
                             : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
     }
+    // The result of the first phase is merged again by key, so one key could be aggregated
+    // by several tasks.
+    bool could_split_hash_partition() const override {
+        return _is_first_phase && !_is_merge && !_needs_finalize;
+    }
     size_t get_revocable_mem_size(RuntimeState* state) const;
 
     vectorized::AggregatedDataVariants* get_agg_data(RuntimeState* state) {
@@ -196,6 +209,12 @@ protected:
     const bool _is_colocate;
 
     RowDescriptor _agg_fn_output_row_descriptor;
+
+    // Whether the first phase results of the instances on this BE are merged before they are
+    // sent, see AggLocalMergeState. The state is shared by all instances.
+    bool _enable_local_merge = false;
+    std::once_flag _local_merge_once;
+    std::shared_ptr<AggLocalMergeState> _local_merge_state;
 };
 
 } // namespace doris::pipeline
@@ -45,6 +45,7 @@ Status AggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _insert_keys_to_column_timer = ADD_TIMER(profile(), "InsertKeysToColumnTime");
     _serialize_data_timer = ADD_TIMER(profile(), "SerializeDataTime");
     _hash_table_size_counter = ADD_COUNTER(profile(), "HashTableSize", TUnit::UNIT);
+    _local_merge_timer = ADD_TIMER(profile(), "LocalMergeTime");
 
     _merge_timer = ADD_TIMER(Base::profile(), "MergeTime");
     _deserialize_data_timer = ADD_TIMER(Base::profile(), "DeserializeAndMergeTime");
@@ -106,6 +107,9 @@ Status AggLocalState::_destroy_agg_status(vectorized::AggregateDataPtr data) {
 
 Status AggLocalState::_serialize_with_serialized_key_result(RuntimeState* state,
                                                             vectorized::Block* block, bool* eos) {
+    if (_shared_state->local_merge_state && !_local_merged) {
+        RETURN_IF_ERROR(_merge_local_partition());
+    }
     SCOPED_TIMER(_serialize_result_timer);
     auto& shared_state = *_shared_state;
     int key_size = _shared_state->probe_expr_ctxs.size();
@@ -223,6 +227,22 @@ Status AggLocalState::_serialize_with_serialized_key_result(RuntimeState* state,
     return Status::OK();
 }
 
+Status AggLocalState::_merge_local_partition() {
+    SCOPED_TIMER(_local_merge_timer);
+    _local_merged = true;
+    auto& merge_state = *_shared_state->local_merge_state;
+    const size_t num_instances = merge_state.num_instances;
+    const size_t owner = _shared_state->local_merge_idx;
+    for (size_t sink = 0; sink < num_instances; ++sink) {
+        auto& blocks = merge_state.blocks[owner * num_instances + sink];
+        for (auto& block : blocks) {
+            RETURN_IF_ERROR(merge_with_serialized_key_helper<false>(&block));
+        }
+        std::vector<vectorized::Block>().swap(blocks);
+    }
+    return Status::OK();
+}
+
 Status AggLocalState::_get_with_serialized_key_result(RuntimeState* state, vectorized::Block* block,
                                                       bool* eos) {
     auto& shared_state = *_shared_state;
@@ -51,6 +51,8 @@ protected:
                                            bool* eos);
     Status _serialize_with_serialized_key_result(RuntimeState* state, vectorized::Block* block,
                                                  bool* eos);
+    // Merges the groups this instance owns from all instances, see AggLocalMergeState.
+    Status _merge_local_partition();
     Status _create_agg_status(vectorized::AggregateDataPtr data);
     Status _destroy_agg_status(vectorized::AggregateDataPtr data);
     void _make_nullable_output_key(vectorized::Block* block) {
@@ -78,6 +80,7 @@ protected:
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
     RuntimeProfile::Counter* _serialize_data_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_size_counter = nullptr;
+    RuntimeProfile::Counter* _local_merge_timer = nullptr;
 
     RuntimeProfile::Counter* _hash_table_compute_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_emplace_timer = nullptr;
@@ -96,6 +99,7 @@ protected:
 
     bool _should_limit_output = false;
     bool _reach_limit = false;
+    bool _local_merged = false;
 };
 
 class AggSourceOperatorX : public OperatorX<AggLocalState> {
@@ -18,14 +18,20 @@
 
 #include "analytic_sink_operator.h"
 
+#include <limits>
 #include <string>
 
+#include "common/config.h"
+#include "common/exception.h"
 #include "pipeline/exec/operator.h"
+#include "runtime/exec_env.h"
+#include "vec/columns/column_const.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 
 Status AnalyticSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<AnalyticSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _blocks_memory_usage =
@@ -35,7 +41,7 @@ Status AnalyticSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo& inf
 }
 
 Status AnalyticSinkLocalState::open(RuntimeState* state) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<AnalyticSharedState>::open(state));
+    RETURN_IF_ERROR(Base::open(state));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
     auto& p = _parent->cast<AnalyticSinkOperatorX>();
@@ -70,6 +76,129 @@ Status AnalyticSinkLocalState::open(RuntimeState* state) {
     return Status::OK();
 }
 
+Status AnalyticSinkLocalState::close(RuntimeState* state, Status exec_status) {
+    if (_closed) {
+        return Status::OK();
+    }
+    dec_running_big_mem_op_num(state);
+    return Base::close(state, exec_status);
+}
+
+Status AnalyticSinkLocalState::revoke_memory(RuntimeState* state) {
+    auto& shared_state = *_shared_state;
+    RETURN_IF_ERROR(shared_state.spill_status);
+    const size_t block_num = shared_state.input_blocks.size();
+    // the blocks output have been moved out
+    const size_t spill_start =
+            std::max(shared_state.next_block_to_spill, shared_state.output_block_count);
+    if (spill_start >= block_num || shared_state.unspilled_bytes <= 0) {
+        return Status::OK();
+    }
+    if (shared_state.next_block_to_spill == 0) {
+        profile()->add_info_string("Spilled", "true");
+    }
+    VLOG_DEBUG << "query " << print_id(state->query_id()) << " analytic node " << _parent->id()
+               << " revoke_memory, blocks: [" << spill_start << ", " << block_num << ")";
+
+    vectorized::SpillStreamSPtr spill_stream;
+    RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            state, spill_stream, print_id(state->query_id()), "analytic", _parent->id(),
+            std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(), profile()));
+    RETURN_IF_ERROR(spill_stream->prepare_spill());
+    spill_stream->set_write_counters(Base::_spill_serialize_block_timer, Base::_spill_block_count,
+                                     Base::_spill_data_size, Base::_spill_write_disk_timer,
+                                     Base::_spill_write_wait_io_timer);
+    shared_state.spill_streams.emplace_back(spill_stream);
+    shared_state.next_block_to_spill = block_num;
+    shared_state.spilled_blocks.resize(block_num, 0);
+
+    auto execution_context = state->get_task_execution_context();
+    /// Resources in shared state will be released when the operator is closed,
+    /// but there may be asynchronous spilling tasks at this time, which can lead to conflicts.
+    /// So, we need hold the pointer of shared state.
+    std::weak_ptr<AnalyticSharedState> shared_state_holder = _shared_state->shared_from_this();
+
+    auto query_id = state->query_id();
+    auto mem_tracker = state->get_query_ctx()->query_mem_tracker;
+
+    MonotonicStopWatch submit_timer;
+    submit_timer.start();
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _dependency->block();
+    auto status = spill_io_pool->submit_func(
+            [this, state, query_id, mem_tracker, shared_state_holder, execution_context,
+             submit_timer, spill_stream, spill_start, block_num] {
+                SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
+                std::shared_ptr<TaskExecutionContext> execution_context_lock;
+                auto shared_state_sptr = shared_state_holder.lock();
+                if (shared_state_sptr) {
+                    execution_context_lock = execution_context.lock();
+                }
+                if (!shared_state_sptr || !execution_context_lock) {
+                    LOG(INFO) << "query " << print_id(query_id)
+                              << " execution_context released, maybe query was cancelled.";
+                    return;
+                }
+
+                _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
+                SCOPED_TIMER(Base::_spill_timer);
+                auto st = [&]() -> Status {
+                    RETURN_IF_CATCH_EXCEPTION({
+                        for (size_t i = spill_start; i < block_num && !state->is_cancelled();
+                             ++i) {
+                            RETURN_IF_ERROR(_spill_block(state, spill_stream, i));
+                        }
+                    });
+                    return spill_stream->spill_eof();
+                }();
+                if (!st.ok()) {
+                    LOG(WARNING) << "query " << print_id(query_id) << " analytic node "
+                                 << _parent->id() << " revoke memory error: " << st;
+                    shared_state_sptr->spill_status = std::move(st);
+                }
+                _dependency->set_ready();
+            });
+    if (!status.ok()) {
+        _dependency->set_ready();
+    }
+    return status;
+}
+
+Status AnalyticSinkLocalState::_spill_block(RuntimeState* state,
+                                            const vectorized::SpillStreamSPtr& spill_stream,
+                                            size_t block_index) {
+    auto& shared_state = *_shared_state;
+    auto& block = shared_state.input_blocks[block_index];
+    const auto rows = block.rows();
+    const auto bytes = shared_state.spillable_bytes(block);
+    vectorized::Block spill_block;
+    for (size_t i = 0; i < block.columns(); ++i) {
+        if (!shared_state.is_key_column(i)) {
+            spill_block.insert(block.get_by_position(i));
+        }
+    }
+    if (rows == 0 || spill_block.columns() == 0) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(spill_stream->spill_block(state, spill_block, false));
+
+    // keep the rows of the block for the positions of the window evaluation
+    for (size_t i = 0; i < block.columns(); ++i) {
+        if (!shared_state.is_key_column(i)) {
+            auto& column = block.get_by_position(i).column;
+            column = vectorized::ColumnConst::create(column->clone_resized(1), rows);
+        }
+    }
+    shared_state.spilled_blocks[block_index] = 1;
+    shared_state.unspilled_bytes -= bytes;
+    const int64_t freed_bytes = bytes - shared_state.spillable_bytes(block);
+    mem_tracker()->consume(-freed_bytes);
+    mem_sites()->consume(MemSite::BLOCK, -freed_bytes);
+    _blocks_memory_usage->add(-freed_bytes);
+    return Status::OK();
+}
+
 bool AnalyticSinkLocalState::_whether_need_next_partition(
         vectorized::BlockRowPos& found_partition_end) {
     auto& shared_state = *_shared_state;
@@ -225,6 +354,7 @@ Status AnalyticSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* state)
     RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(analytic_node.order_by_exprs,
                                                          _order_by_eq_expr_ctxs));
     _agg_functions_size = agg_size;
+    _enable_spill = state->enable_force_spill() || config::enable_analytic_spill;
     return Status::OK();
 }
 
@@ -261,7 +391,11 @@ Status AnalyticSinkOperatorX::open(RuntimeState* state) {
 Status AnalyticSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* input_block,
                                    bool eos) {
     auto& local_state = get_local_state(state);
+    if (_enable_spill) {
+        local_state.inc_running_big_mem_op_num(state);
+    }
     SCOPED_TIMER(local_state.exec_time_counter());
+    RETURN_IF_ERROR(local_state._shared_state->spill_status);
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)input_block->rows());
     local_state._shared_state->input_eos = eos;
     if (local_state._shared_state->input_eos && input_block->rows() == 0) {
@@ -312,7 +446,10 @@ Status AnalyticSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block
     }
 
     local_state.mem_tracker()->consume(input_block->allocated_bytes());
+    local_state.mem_sites()->consume(MemSite::BLOCK, input_block->allocated_bytes());
     local_state._blocks_memory_usage->add(input_block->allocated_bytes());
+    local_state._shared_state->unspilled_bytes +=
+            local_state._shared_state->spillable_bytes(*input_block);
 
     //TODO: if need improvement, the is a tips to maintain a free queue,
     //so the memory could reuse, no need to new/delete again;
@@ -325,6 +462,21 @@ Status AnalyticSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block
     return Status::OK();
 }
 
+size_t AnalyticSinkOperatorX::revocable_mem_size(RuntimeState* state) const {
+    if (!_enable_spill) {
+        return 0;
+    }
+    auto& local_state = get_local_state(state);
+    return std::max<int64_t>(local_state._shared_state->unspilled_bytes, 0);
+}
+
+Status AnalyticSinkOperatorX::revoke_memory(RuntimeState* state) {
+    if (!_enable_spill) {
+        return Status::OK();
+    }
+    return get_local_state(state).revoke_memory(state);
+}
+
 Status AnalyticSinkOperatorX::_insert_range_column(vectorized::Block* block,
                                                    const vectorized::VExprContextSPtr& expr,
                                                    vectorized::IColumn* dst_column, size_t length) {
@@ -28,15 +28,20 @@ namespace doris {
 namespace pipeline {
 class AnalyticSinkOperatorX;
 
-class AnalyticSinkLocalState : public PipelineXSinkLocalState<AnalyticSharedState> {
+class AnalyticSinkLocalState : public PipelineXSpillSinkLocalState<AnalyticSharedState> {
     ENABLE_FACTORY_CREATOR(AnalyticSinkLocalState);
 
 public:
+    using Base = PipelineXSpillSinkLocalState<AnalyticSharedState>;
     AnalyticSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state)
-            : PipelineXSinkLocalState<AnalyticSharedState>(parent, state) {}
+            : Base(parent, state) {}
 
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
     Status open(RuntimeState* state) override;
+    Status close(RuntimeState* state, Status exec_status) override;
+
+    // Spills the columns only output of the buffered blocks, see AnalyticSharedState.
+    Status revoke_memory(RuntimeState* state);
 
 private:
     friend class AnalyticSinkOperatorX;
@@ -58,6 +63,9 @@ private:
                                                      bool need_check_first = false);
     bool _whether_need_next_partition(vectorized::BlockRowPos& found_partition_end);
 
+    Status _spill_block(RuntimeState* state, const vectorized::SpillStreamSPtr& spill_stream,
+                        size_t block_index);
+
     RuntimeProfile::Counter* _evaluation_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _blocks_memory_usage = nullptr;
 
@@ -79,6 +87,11 @@ public:
     Status open(RuntimeState* state) override;
 
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos) override;
+
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state) override;
+
     DataDistribution required_data_distribution() const override {
         if (_partition_by_eq_expr_ctxs.empty()) {
             return {ExchangeType::PASSTHROUGH};
@@ -105,6 +118,7 @@ private:
     const TTupleId _buffered_tuple_id;
 
     std::vector<size_t> _num_agg_input;
+    bool _enable_spill = false;
     const bool _is_colocate;
     const std::vector<TExpr> _partition_exprs;
 };
@@ -19,13 +19,16 @@
 
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
+#include "runtime/exec_env.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 
 AnalyticLocalState::AnalyticLocalState(RuntimeState* state, OperatorXBase* parent)
-        : PipelineXLocalState<AnalyticSharedState>(state, parent),
+        : Base(state, parent),
           _output_block_index(0),
           _window_end_position(0),
           _next_partition(false),
@@ -157,7 +160,7 @@ bool AnalyticLocalState::_whether_need_next_partition(
 }
 
 Status AnalyticLocalState::init(RuntimeState* state, LocalStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXLocalState<AnalyticSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _blocks_memory_usage =
@@ -167,7 +170,7 @@ Status AnalyticLocalState::init(RuntimeState* state, LocalStateInfo& info) {
 }
 
 Status AnalyticLocalState::open(RuntimeState* state) {
-    RETURN_IF_ERROR(PipelineXLocalState<AnalyticSharedState>::open(state));
+    RETURN_IF_ERROR(Base::open(state));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
     _agg_arena_pool = std::make_unique<vectorized::Arena>();
@@ -232,6 +235,7 @@ Status AnalyticLocalState::open(RuntimeState* state) {
 
             _executor.get_next = std::bind<Status>(&AnalyticLocalState::_get_next_for_rows, this,
                                                    std::placeholders::_1);
+            _init_segment_trees();
         }
     }
     _executor.insert_result =
@@ -244,6 +248,29 @@ Status AnalyticLocalState::open(RuntimeState* state) {
     return Status::OK();
 }
 
+void AnalyticLocalState::_init_segment_trees() {
+    auto& p = _parent->cast<AnalyticSourceOperatorX>();
+    _segment_trees.resize(_agg_functions_size);
+    const int64_t min_frame_rows = config::analytic_segment_tree_min_frame_rows;
+    if (min_frame_rows <= 0 || !p._has_window_end) {
+        return;
+    }
+    // [unbounded preceding, current row] keeps adding up the rows, see _get_next_for_rows
+    if (!p._has_window_start &&
+        p._window.window_end.type == TAnalyticWindowBoundaryType::CURRENT_ROW) {
+        return;
+    }
+    if (p._has_window_start && _rows_end_offset - _rows_start_offset + 1 < min_frame_rows) {
+        return;
+    }
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        if (vectorized::WindowSegmentTree::is_supported(*_agg_functions[i]->function())) {
+            _segment_trees[i] = std::make_unique<vectorized::WindowSegmentTree>(
+                    _agg_functions[i]->function().get());
+        }
+    }
+}
+
 void AnalyticLocalState::_reset_agg_status() {
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         _agg_functions[i]->reset(
@@ -290,11 +317,20 @@ void AnalyticLocalState::_execute_for_win_func(int64_t partition_start, int64_t
         for (int j = 0; j < _shared_state->agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_shared_state->agg_input_columns[i][j].get());
         }
-        _agg_functions[i]->function()->add_range_single_place(
-                partition_start, partition_end, frame_start, frame_end,
-                _fn_place_ptr +
-                        _parent->cast<AnalyticSourceOperatorX>()._offsets_of_aggregate_states[i],
-                agg_columns.data(), nullptr);
+        auto* place = _fn_place_ptr +
+                      _parent->cast<AnalyticSourceOperatorX>()._offsets_of_aggregate_states[i];
+        if (!_segment_trees.empty() && _segment_trees[i] != nullptr) {
+            // the whole partition has been buffered when its rows are evaluated
+            auto& tree = _segment_trees[i];
+            if (!tree->is_built_for(partition_start, partition_end)) {
+                tree->build(partition_start, partition_end, agg_columns.data());
+            }
+            tree->aggregate(frame_start, frame_end, place, agg_columns.data(), nullptr);
+        } else {
+            _agg_functions[i]->function()->add_range_single_place(
+                    partition_start, partition_end, frame_start, frame_end, place,
+                    agg_columns.data(), nullptr);
+        }
 
         // If the end is not greater than the start, the current window should be empty.
         _current_window_empty =
@@ -443,10 +479,58 @@ bool AnalyticLocalState::init_next_partition(vectorized::BlockRowPos found_parti
     return false;
 }
 
+Status AnalyticLocalState::_recover_spilled_block() {
+    SCOPED_TIMER(_spill_recover_time);
+    auto& shared_state = *_shared_state;
+    auto& block = shared_state.input_blocks[_output_block_index];
+    vectorized::Block spilled_block;
+    bool eos = true;
+    while (eos) {
+        DCHECK(!shared_state.spill_streams.empty());
+        if (shared_state.spill_streams.empty()) {
+            return Status::InternalError("spilled block {} of analytic node {} is lost",
+                                         _output_block_index, _parent->node_id());
+        }
+        auto& spill_stream = shared_state.spill_streams.front();
+        spill_stream->set_read_counters(_spill_read_data_time, _spill_deserialize_time,
+                                        _spill_read_bytes, _spill_read_wait_io_timer);
+        RETURN_IF_ERROR(spill_stream->read_next_block_sync(&spilled_block, &eos));
+        if (eos) {
+            (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+            shared_state.spill_streams.pop_front();
+        }
+    }
+
+    const auto bytes = block.allocated_bytes();
+    size_t spilled_column = 0;
+    for (size_t i = 0; i < block.columns(); ++i) {
+        if (!shared_state.is_key_column(i)) {
+            DCHECK_LT(spilled_column, spilled_block.columns());
+            block.get_by_position(i).column =
+                    spilled_block.get_by_position(spilled_column++).column;
+        }
+    }
+    DCHECK_EQ(spilled_column, spilled_block.columns());
+    const int64_t recovered_bytes = block.allocated_bytes() - bytes;
+    _blocks_memory_usage->add(recovered_bytes);
+    mem_tracker()->consume(recovered_bytes);
+    mem_sites()->consume(MemSite::BLOCK, recovered_bytes);
+    return Status::OK();
+}
+
 Status AnalyticLocalState::output_current_block(vectorized::Block* block) {
+    auto& shared_state = *_shared_state;
+    if (_output_block_index < shared_state.spilled_blocks.size() &&
+        shared_state.spilled_blocks[_output_block_index]) {
+        RETURN_IF_ERROR(_recover_spilled_block());
+    } else {
+        shared_state.unspilled_bytes -=
+                shared_state.spillable_bytes(shared_state.input_blocks[_output_block_index]);
+    }
     block->swap(std::move(_shared_state->input_blocks[_output_block_index]));
     _blocks_memory_usage->add(-block->allocated_bytes());
     mem_tracker()->consume(-block->allocated_bytes());
+    mem_sites()->consume(MemSite::BLOCK, -block->allocated_bytes());
     if (_shared_state->origin_cols.size() < block->columns()) {
         block->erase_not_in(_shared_state->origin_cols);
     }
@@ -464,6 +548,7 @@ Status AnalyticLocalState::output_current_block(vectorized::Block* block) {
     }
 
     _output_block_index++;
+    shared_state.output_block_count = _output_block_index;
     _window_end_position = 0;
 
     return Status::OK();
@@ -560,11 +645,13 @@ Status AnalyticLocalState::close(RuntimeState* state) {
     }
 
     _destroy_agg_status();
+    _segment_trees.clear();
     _agg_arena_pool = nullptr;
 
     std::vector<vectorized::MutableColumnPtr> tmp_result_window_columns;
     _result_window_columns.swap(tmp_result_window_columns);
-    return PipelineXLocalState<AnalyticSharedState>::close(state);
+    _shared_state->close();
+    return Base::close(state);
 }
 
 Status AnalyticSourceOperatorX::prepare(RuntimeState* state) {
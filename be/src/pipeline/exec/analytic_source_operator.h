@@ -21,6 +21,7 @@
 
 #include "common/status.h"
 #include "operator.h"
+#include "vec/exec/window_segment_tree.h"
 
 namespace doris {
 class RuntimeState;
@@ -28,9 +29,10 @@ class RuntimeState;
 namespace pipeline {
 
 class AnalyticSourceOperatorX;
-class AnalyticLocalState final : public PipelineXLocalState<AnalyticSharedState> {
+class AnalyticLocalState final : public PipelineXSpillLocalState<AnalyticSharedState> {
 public:
     ENABLE_FACTORY_CREATOR(AnalyticLocalState);
+    using Base = PipelineXSpillLocalState<AnalyticSharedState>;
     AnalyticLocalState(RuntimeState* state, OperatorXBase* parent);
 
     Status init(RuntimeState* state, LocalStateInfo& info) override;
@@ -70,6 +72,13 @@ private:
                                                      bool need_check_first = false);
     bool _whether_need_next_partition(vectorized::BlockRowPos& found_partition_end);
 
+    // Reads the spilled columns of the block to output back, see AnalyticSharedState.
+    Status _recover_spilled_block();
+
+    // Creates the segment trees of the functions whose sliding ROWS frames are wide enough,
+    // see config::analytic_segment_tree_min_frame_rows.
+    void _init_segment_trees();
+
     void _reset_agg_status();
     void _create_agg_status();
     void _destroy_agg_status();
@@ -93,6 +102,8 @@ private:
     vectorized::BlockRowPos _partition_by_start;
     std::unique_ptr<vectorized::Arena> _agg_arena_pool;
     std::vector<vectorized::AggFnEvaluator*> _agg_functions;
+    // null for the functions which add the rows of every frame
+    std::vector<std::unique_ptr<vectorized::WindowSegmentTree>> _segment_trees;
 
     RuntimeProfile::Counter* _evaluation_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _blocks_memory_usage = nullptr;
@@ -26,6 +26,8 @@
 #include <google/protobuf/stubs/callback.h>
 #include <stddef.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <exception>
@@ -40,6 +42,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "service/backend_options.h"
+#include "util/doris_metrics.h"
 #include "util/proto_util.h"
 #include "util/time.h"
 #include "vec/sink/vdata_stream_sender.h"
@@ -58,6 +61,12 @@ BroadcastPBlockHolder::~BroadcastPBlockHolder() {
     // is a unique ptr.
 }
 
+butil::IOBuf BroadcastPBlockHolder::detach_column_values() {
+    std::lock_guard l(_column_values_lock);
+    ::doris::detach_column_values(_pblock.get(), &_column_values);
+    return _column_values;
+}
+
 void BroadcastPBlockHolderQueue::push(std::shared_ptr<BroadcastPBlockHolder> holder) {
     std::unique_lock l(_holders_lock);
     holder->set_parent_creator(shared_from_this());
@@ -93,7 +102,13 @@ ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_
           _sender_id(send_id),
           _be_number(be_number),
           _state(state),
-          _context(state->get_query_ctx()) {}
+          _context(state->get_query_ctx()) {
+    // the packages which need the http rpc can not be batched
+    _batch_rpc_by_host =
+            config::exchange_sink_batch_rpc_by_host && !config::transfer_large_data_by_brpc;
+    _send_block_by_attachment = config::exchange_sink_send_block_by_attachment &&
+                                !config::transfer_large_data_by_brpc;
+}
 
 ExchangeSinkBuffer::~ExchangeSinkBuffer() = default;
 
@@ -122,7 +137,8 @@ void ExchangeSinkBuffer::_set_ready_to_finish(bool all_done) {
     }
 }
 
-void ExchangeSinkBuffer::register_sink(TUniqueId fragment_instance_id) {
+void ExchangeSinkBuffer::register_sink(TUniqueId fragment_instance_id,
+                                       const TNetworkAddress& brpc_dest_addr) {
     if (_is_finishing) {
         return;
     }
@@ -144,7 +160,25 @@ void ExchangeSinkBuffer::register_sink(TUniqueId fragment_instance_id) {
     _instance_to_rpc_ctx[low_id] = {};
     _instance_to_receiver_eof[low_id] = false;
     _instance_to_rpc_time[low_id] = 0;
+    _instance_to_rpc_bytes[low_id] = 0;
+    if (config::enable_exchange_adaptive_compression) {
+        _instance_to_compression_selector[low_id] =
+                std::make_unique<vectorized::ExchangeCompressionSelector>(
+                        _state->fragement_transmission_compression_type(),
+                        config::exchange_adaptive_compression_probe_interval);
+    }
     _construct_request(low_id, finst_id);
+    std::string dest_host = fmt::format("{}:{}", brpc_dest_addr.hostname, brpc_dest_addr.port);
+    _instance_to_rpc_latency[low_id] =
+            DorisMetrics::instance()->exchange_rpc_latency_us->get(dest_host);
+    if (_batch_rpc_by_host) {
+        auto& host = _host_rpc_ctxs[dest_host];
+        if (host == nullptr) {
+            host = std::make_unique<HostRpcContext>();
+        }
+        host->instances.push_back(low_id);
+        _instance_to_host[low_id] = host.get();
+    }
 }
 
 Status ExchangeSinkBuffer::add_block(TransmitInfo&& request) {
@@ -171,7 +205,8 @@ Status ExchangeSinkBuffer::add_block(TransmitInfo&& request) {
         }
     }
     if (send_now) {
-        RETURN_IF_ERROR(_send_rpc(ins_id));
+        RETURN_IF_ERROR(_batch_rpc_by_host ? _send_host_rpc(_instance_to_host[ins_id])
+                                           : _send_rpc(ins_id));
     }
 
     return Status::OK();
@@ -197,7 +232,8 @@ Status ExchangeSinkBuffer::add_block(BroadcastTransmitInfo&& request) {
         _instance_to_broadcast_package_queue[ins_id].emplace(request);
     }
     if (send_now) {
-        RETURN_IF_ERROR(_send_rpc(ins_id));
+        RETURN_IF_ERROR(_batch_rpc_by_host ? _send_host_rpc(_instance_to_host[ins_id])
+                                           : _send_rpc(ins_id));
     }
 
     return Status::OK();
@@ -227,10 +263,15 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
         if (request.block) {
             brpc_request->set_allocated_block(request.block.get());
         }
+        _instance_to_rpc_bytes[id] = request.block ? request.block->ByteSizeLong() : 0;
         if (!request.exec_status.ok()) {
             request.exec_status.to_protobuf(brpc_request->mutable_exec_status());
         }
         auto send_callback = request.channel->get_send_callback(id, request.eos);
+        if (request.block) {
+            _append_column_values(request.block.get(), nullptr,
+                                  &send_callback->cntl_->request_attachment());
+        }
 
         _instance_to_rpc_ctx[id]._send_callback = send_callback;
         _instance_to_rpc_ctx[id].is_cancelled = false;
@@ -262,6 +303,7 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
             }
             // attach task for memory tracker and query id when core
             SCOPED_ATTACH_TASK(_state);
+            _record_rpc_latency(id, start_rpc_time);
             set_rpc_time(id, start_rpc_time, result.receive_time());
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
@@ -306,7 +348,14 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
         if (request.block_holder->get_block()) {
             brpc_request->set_allocated_block(request.block_holder->get_block());
         }
+        _instance_to_rpc_bytes[id] = request.block_holder->get_block()
+                                             ? request.block_holder->get_block()->ByteSizeLong()
+                                             : 0;
         auto send_callback = request.channel->get_send_callback(id, request.eos);
+        if (request.block_holder->get_block()) {
+            _append_column_values(request.block_holder->get_block(), request.block_holder.get(),
+                                  &send_callback->cntl_->request_attachment());
+        }
 
         ExchangeRpcContext rpc_ctx;
         rpc_ctx._send_callback = send_callback;
@@ -340,6 +389,7 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
             }
             // attach task for memory tracker and query id when core
             SCOPED_ATTACH_TASK(_state);
+            _record_rpc_latency(id, start_rpc_time);
             set_rpc_time(id, start_rpc_time, result.receive_time());
             Status s(Status::create(result.status()));
             if (s.is<ErrorCode::END_OF_FILE>()) {
@@ -379,6 +429,239 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
     return Status::OK();
 }
 
+Status ExchangeSinkBuffer::_send_host_rpc(HostRpcContext* host) {
+    std::unique_lock<std::mutex> host_lock(host->lock);
+    if (host->in_flight) {
+        // the queued packages are sent when the rpc in flight is done
+        return Status::OK();
+    }
+    if (_is_finishing) {
+        for (auto id : host->instances) {
+            std::unique_lock<std::mutex> lock(*_instance_to_package_queue_mutex[id]);
+            if (!_rpc_channel_is_idle[id]) {
+                _rpc_channel_is_idle[id] = true;
+                _set_ready_to_finish(_busy_channels.fetch_sub(1) == 1);
+            }
+        }
+        return Status::OK();
+    }
+
+    std::vector<BatchedPackage> packages;
+    int64_t batch_bytes = 0;
+    for (auto id : host->instances) {
+        if (batch_bytes >= config::exchange_sink_batch_rpc_max_bytes) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock(*_instance_to_package_queue_mutex[id]);
+        if (_instance_to_receiver_eof[id]) {
+            continue;
+        }
+        auto& q = _instance_to_package_queue[id];
+        auto& broadcast_q = _instance_to_broadcast_package_queue[id];
+        BatchedPackage package;
+        if (!q.empty()) {
+            auto& request = q.front();
+            package.channel = request.channel;
+            package.eos = request.eos;
+            package.block = std::move(request.block);
+            package.exec_status = request.exec_status;
+            q.pop();
+            _total_queue_size--;
+            if (_queue_dependency && _total_queue_size <= _queue_capacity) {
+                _queue_dependency->set_ready();
+            }
+        } else if (!broadcast_q.empty()) {
+            auto& request = broadcast_q.front();
+            package.channel = request.channel;
+            package.eos = request.eos;
+            package.block_holder = request.block_holder;
+            broadcast_q.pop();
+        } else {
+            continue;
+        }
+        package.id = id;
+        package.packet_seq = _instance_to_seq[id]++;
+        if (package.get_block() != nullptr) {
+            batch_bytes += package.get_block()->ByteSizeLong();
+        }
+        packages.push_back(std::move(package));
+    }
+    if (packages.empty()) {
+        return Status::OK();
+    }
+    for (const auto& package : packages) {
+        // the packages share the time of the rpc
+        _instance_to_rpc_bytes[package.id] = batch_bytes;
+    }
+    host->in_flight = true;
+    host_lock.unlock();
+
+    // the requests after the first one are carried by the attachment
+    butil::IOBuf attachment;
+    Status st;
+    for (size_t i = 0; i < packages.size(); ++i) {
+        auto& package = packages[i];
+        auto& brpc_request = _instance_to_request[package.id];
+        brpc_request->set_eos(package.eos);
+        brpc_request->set_packet_seq(package.packet_seq);
+        if (package.get_block() != nullptr) {
+            brpc_request->set_allocated_block(package.get_block());
+        }
+        if (!package.exec_status.ok()) {
+            package.exec_status.to_protobuf(brpc_request->mutable_exec_status());
+        }
+        // the column values follow the request of the block
+        butil::IOBuf column_values;
+        if (package.get_block() != nullptr) {
+            _append_column_values(package.get_block(), package.block_holder.get(),
+                                  &column_values);
+        }
+        if (i > 0) {
+            if (st.ok()) {
+                st = append_message_to_attachment(*brpc_request, &attachment);
+            }
+            if (package.get_block() != nullptr) {
+                static_cast<void>(brpc_request->release_block());
+            }
+        }
+        attachment.append(column_values);
+    }
+
+    std::vector<std::pair<InstanceLoId, bool>> batched;
+    for (const auto& package : packages) {
+        batched.emplace_back(package.id, package.eos);
+    }
+    auto& first = packages[0];
+    auto& brpc_request = _instance_to_request[first.id];
+    if (!st.ok()) {
+        if (first.get_block() != nullptr) {
+            static_cast<void>(brpc_request->release_block());
+        }
+        for (const auto& [id, _] : batched) {
+            _failed(id, st.to_string());
+        }
+        _host_rpc_done(host);
+        return st;
+    }
+
+    auto send_callback = first.channel->get_send_callback(first.id, first.eos);
+    _instance_to_rpc_ctx[first.id]._send_callback = send_callback;
+    _instance_to_rpc_ctx[first.id].is_cancelled = false;
+
+    send_callback->cntl_->set_timeout_ms(first.channel->_brpc_timeout_ms);
+    if (config::exchange_sink_ignore_eovercrowded) {
+        send_callback->cntl_->ignore_eovercrowded();
+    }
+    send_callback->cntl_->request_attachment().swap(attachment);
+    send_callback->addFailedHandler([&, weak_task_ctx = weak_task_exec_ctx(), host, batched](
+                                            const InstanceLoId& /*id*/, const std::string& err) {
+        auto task_lock = weak_task_ctx.lock();
+        if (task_lock == nullptr) {
+            // This means ExchangeSinkBuffer Ojbect already destroyed, not need run failed any more.
+            return;
+        }
+        // attach task for memory tracker and query id when core
+        SCOPED_ATTACH_TASK(_state);
+        for (const auto& [id, _] : batched) {
+            _failed(id, err);
+        }
+        _host_rpc_done(host);
+    });
+    send_callback->start_rpc_time = GetCurrentTimeNanos();
+    send_callback->addSuccessHandler([&, weak_task_ctx = weak_task_exec_ctx(), host, batched,
+                                      cntl = send_callback->cntl_.get()](
+                                             const InstanceLoId& /*id*/, const bool& /*eos*/,
+                                             const PTransmitDataResult& result,
+                                             const int64_t& start_rpc_time) {
+        auto task_lock = weak_task_ctx.lock();
+        if (task_lock == nullptr) {
+            // This means ExchangeSinkBuffer Ojbect already destroyed, not need run failed any more.
+            return;
+        }
+        // attach task for memory tracker and query id when core
+        SCOPED_ATTACH_TASK(_state);
+        _record_rpc_latency(batched.front().first, start_rpc_time);
+        std::vector<PTransmitDataResult> results;
+        Status st = extract_messages_from_attachment(&cntl->response_attachment(), &results);
+        if (st.ok() && results.size() + 1 != batched.size()) {
+            st = Status::InternalError("expect {} batched results, but got {}",
+                                       batched.size() - 1, results.size());
+        }
+        if (!st.ok()) {
+            for (const auto& [id, _] : batched) {
+                _failed(id, fmt::format("exchange req success but results are invalid: {}",
+                                        st.to_string()));
+            }
+            _host_rpc_done(host);
+            return;
+        }
+        for (size_t i = 0; i < batched.size(); ++i) {
+            const auto& [id, eos] = batched[i];
+            const auto& package_result = i == 0 ? result : results[i - 1];
+            set_rpc_time(id, start_rpc_time, package_result.receive_time());
+            Status s(Status::create(package_result.status()));
+            if (s.is<ErrorCode::END_OF_FILE>()) {
+                _set_receiver_eof(id);
+            } else if (!s.ok()) {
+                _failed(id,
+                        fmt::format("exchange req success but status isn't ok: {}", s.to_string()));
+            } else if (eos) {
+                _ended(id);
+            } else {
+                _finish_batched_package(id);
+            }
+        }
+        _host_rpc_done(host);
+    });
+    {
+        auto send_remote_block_closure =
+                AutoReleaseClosure<PTransmitDataParams,
+                                   pipeline::ExchangeSendCallback<PTransmitDataResult>>::
+                        create_unique(brpc_request, send_callback);
+        transmit_blockv2(*first.channel->_brpc_stub, std::move(send_remote_block_closure));
+    }
+    if (first.get_block() != nullptr) {
+        static_cast<void>(brpc_request->release_block());
+    }
+    _batched_rpc_packages += packages.size() - 1;
+    return Status::OK();
+}
+
+void ExchangeSinkBuffer::_host_rpc_done(HostRpcContext* host) {
+    {
+        std::unique_lock<std::mutex> host_lock(host->lock);
+        host->in_flight = false;
+    }
+    static_cast<void>(_send_host_rpc(host));
+}
+
+void ExchangeSinkBuffer::_finish_batched_package(InstanceLoId id) {
+    std::unique_lock<std::mutex> lock(*_instance_to_package_queue_mutex[id]);
+    if (!_rpc_channel_is_idle[id] && _instance_to_package_queue[id].empty() &&
+        _instance_to_broadcast_package_queue[id].empty()) {
+        _rpc_channel_is_idle[id] = true;
+        _set_ready_to_finish(_busy_channels.fetch_sub(1) == 1);
+    }
+}
+
+void ExchangeSinkBuffer::_append_column_values(PBlock* block,
+                                               vectorized::BroadcastPBlockHolder* holder,
+                                               butil::IOBuf* attachment) {
+    if (!_send_block_by_attachment) {
+        return;
+    }
+    butil::IOBuf column_values;
+    if (holder != nullptr) {
+        // the block is shared by the channels, its column values are detached only once
+        column_values = holder->detach_column_values();
+    } else {
+        detach_column_values(block, &column_values);
+    }
+    if (column_values_in_attachment(*block)) {
+        append_frame_to_attachment(column_values, attachment);
+    }
+}
+
 void ExchangeSinkBuffer::_construct_request(InstanceLoId id, PUniqueId finst_id) {
     _instance_to_request[id] = std::make_shared<PTransmitDataParams>();
     _instance_to_request[id]->mutable_finst_id()->CopyFrom(finst_id);
@@ -453,6 +736,13 @@ int64_t ExchangeSinkBuffer::get_sum_rpc_time() {
     return sum_time;
 }
 
+void ExchangeSinkBuffer::_record_rpc_latency(InstanceLoId id, int64_t start_rpc_time) {
+    auto it = _instance_to_rpc_latency.find(id);
+    if (it != _instance_to_rpc_latency.end()) {
+        it->second->add(std::max<int64_t>(GetCurrentTimeNanos() - start_rpc_time, 0) / 1000);
+    }
+}
+
 void ExchangeSinkBuffer::set_rpc_time(InstanceLoId id, int64_t start_rpc_time,
                                       int64_t receive_rpc_time) {
     _rpc_count++;
@@ -460,6 +750,9 @@ void ExchangeSinkBuffer::set_rpc_time(InstanceLoId id, int64_t start_rpc_time,
     DCHECK(_instance_to_rpc_time.find(id) != _instance_to_rpc_time.end());
     if (rpc_spend_time > 0) {
         _instance_to_rpc_time[id] += rpc_spend_time;
+        if (auto* selector = compression_selector(id)) {
+            selector->update_network(_instance_to_rpc_bytes[id], rpc_spend_time);
+        }
     }
 }
 
@@ -479,6 +772,27 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     int64_t sum_time = get_sum_rpc_time();
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
+
+    if (_batch_rpc_by_host) {
+        auto* batched_packages = ADD_COUNTER(profile, "BatchedRpcPackages", TUnit::UNIT);
+        batched_packages->set(_batched_rpc_packages.load());
+    }
+
+    if (!_instance_to_compression_selector.empty()) {
+        using Selector = vectorized::ExchangeCompressionSelector;
+        std::array<int64_t, Selector::CANDIDATES.size()> num_blocks {};
+        for (auto& [_, selector] : _instance_to_compression_selector) {
+            for (size_t i = 0; i < Selector::CANDIDATES.size(); ++i) {
+                num_blocks[i] += selector->num_blocks(i);
+            }
+        }
+        static constexpr std::array<const char*, Selector::CANDIDATES.size()> counter_names = {
+                "AdaptiveCompressionNoneBlocks", "AdaptiveCompressionLz4Blocks",
+                "AdaptiveCompressionZstdBlocks"};
+        for (size_t i = 0; i < Selector::CANDIDATES.size(); ++i) {
+            ADD_COUNTER(profile, counter_names[i], TUnit::UNIT)->set(num_blocks[i]);
+        }
+    }
 }
 
 } // namespace pipeline
@@ -19,6 +19,7 @@
 
 #include <brpc/controller.h>
 #include <gen_cpp/data.pb.h>
+#include <gen_cpp/Types_types.h>
 #include <gen_cpp/internal_service.pb.h>
 #include <gen_cpp/types.pb.h>
 #include <parallel_hashmap/phmap.h>
@@ -31,6 +32,7 @@
 #include <queue>
 #include <stack>
 #include <string>
+#include <vector>
 
 #include "common/global_types.h"
 #include "common/status.h"
@@ -38,8 +40,10 @@
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 #include "util/ref_count_closure.h"
+#include "vec/sink/exchange_compression_selector.h"
 
 namespace doris {
+class LatencyHistogramMetric;
 class PTransmitDataParams;
 class TUniqueId;
 
@@ -80,9 +84,15 @@ public:
 
     PBlock* get_block() { return _pblock.get(); }
 
+    // Moves the column values of the block to an IOBuf shared by the attachments of all the
+    // channels, see config::exchange_sink_send_block_by_attachment.
+    butil::IOBuf detach_column_values();
+
 private:
     friend class BroadcastPBlockHolderQueue;
     std::unique_ptr<PBlock> _pblock;
+    std::mutex _column_values_lock;
+    butil::IOBuf _column_values;
     std::weak_ptr<BroadcastPBlockHolderQueue> _parent_creator;
     void set_parent_creator(std::shared_ptr<BroadcastPBlockHolderQueue> parent_creator) {
         _parent_creator = parent_creator;
@@ -197,7 +207,7 @@ public:
     ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_id, int send_id, int be_number,
                        RuntimeState* state);
     ~ExchangeSinkBuffer();
-    void register_sink(TUniqueId);
+    void register_sink(TUniqueId, const TNetworkAddress& brpc_dest_addr);
 
     Status add_block(TransmitInfo&& request);
     Status add_block(BroadcastTransmitInfo&& request);
@@ -206,6 +216,13 @@ public:
     void set_rpc_time(InstanceLoId id, int64_t start_rpc_time, int64_t receive_rpc_time);
     void update_profile(RuntimeProfile* profile);
 
+    // The codec selector of the blocks sent to the instance, nullptr unless
+    // config::enable_exchange_adaptive_compression is on.
+    vectorized::ExchangeCompressionSelector* compression_selector(InstanceLoId id) {
+        auto it = _instance_to_compression_selector.find(id);
+        return it == _instance_to_compression_selector.end() ? nullptr : it->second.get();
+    }
+
     void set_dependency(std::shared_ptr<Dependency> queue_dependency,
                         std::shared_ptr<Dependency> finish_dependency) {
         _queue_dependency = queue_dependency;
@@ -248,6 +265,41 @@ private:
     phmap::flat_hash_map<InstanceLoId, int64_t> _instance_to_rpc_time;
     phmap::flat_hash_map<InstanceLoId, ExchangeRpcContext> _instance_to_rpc_ctx;
 
+    // The instances on the same destination host share one rpc in flight, which carries the
+    // first package of every instance with packages queued, see
+    // config::exchange_sink_batch_rpc_by_host. Every instance still waits for the result of
+    // its package before sending the next one.
+    struct HostRpcContext {
+        std::mutex lock;
+        std::vector<InstanceLoId> instances;
+        bool in_flight = false;
+    };
+    struct BatchedPackage {
+        InstanceLoId id;
+        vectorized::PipChannel* channel = nullptr;
+        bool eos = false;
+        PackageSeq packet_seq = 0;
+        std::unique_ptr<PBlock> block;
+        std::shared_ptr<vectorized::BroadcastPBlockHolder> block_holder;
+        Status exec_status;
+
+        PBlock* get_block() const {
+            return block_holder != nullptr ? block_holder->get_block() : block.get();
+        }
+    };
+    bool _batch_rpc_by_host = false;
+    // the column values of the blocks are sent by the attachment without being copied
+    bool _send_block_by_attachment = false;
+    phmap::flat_hash_map<std::string, std::unique_ptr<HostRpcContext>> _host_rpc_ctxs;
+    phmap::flat_hash_map<InstanceLoId, HostRpcContext*> _instance_to_host;
+    std::atomic<int64_t> _batched_rpc_packages = 0;
+    // the bytes of the rpc in flight of each instance, to measure the network throughput
+    phmap::flat_hash_map<InstanceLoId, size_t> _instance_to_rpc_bytes;
+    phmap::flat_hash_map<InstanceLoId, std::unique_ptr<vectorized::ExchangeCompressionSelector>>
+            _instance_to_compression_selector;
+    // the rpc latency histogram of the destination host of each instance
+    phmap::flat_hash_map<InstanceLoId, LatencyHistogramMetric*> _instance_to_rpc_latency;
+
     std::atomic<bool> _is_finishing;
     PUniqueId _query_id;
     PlanNodeId _dest_node_id;
@@ -259,12 +311,21 @@ private:
     QueryContext* _context = nullptr;
 
     Status _send_rpc(InstanceLoId);
+    Status _send_host_rpc(HostRpcContext* host);
+    void _host_rpc_done(HostRpcContext* host);
+    // the package of the instance is done, it stays busy if it has more packages
+    void _finish_batched_package(InstanceLoId id);
+    // Appends the column values of the block, which belongs to `holder` if it is broadcasted,
+    // to the attachment.
+    void _append_column_values(PBlock* block, vectorized::BroadcastPBlockHolder* holder,
+                               butil::IOBuf* attachment);
     // must hold the _instance_to_package_queue_mutex[id] mutex to opera
     void _construct_request(InstanceLoId id, PUniqueId);
     inline void _ended(InstanceLoId id);
     inline void _failed(InstanceLoId id, const std::string& err);
     inline void _set_receiver_eof(InstanceLoId id);
     inline bool _is_receiver_eof(InstanceLoId id);
+    void _record_rpc_latency(InstanceLoId id, int64_t start_rpc_time);
     void get_max_min_rpc_time(int64_t* max_time, int64_t* min_time);
     int64_t get_sum_rpc_time();
 
@@ -363,9 +363,12 @@ Status ExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block* block
         if (local_state.only_local_exchange) {
             if (!block->empty()) {
                 Status status;
-                for (auto* channel : local_state.channels) {
+                const size_t num_channels = local_state.channels.size();
+                for (size_t i = 0; i < num_channels; ++i) {
+                    auto* channel = local_state.channels[i];
                     if (!channel->is_receiver_eof()) {
-                        status = channel->send_local_block(block);
+                        // the last channel takes the block, the others get a copy of it
+                        status = channel->send_local_block(block, i == num_channels - 1);
                         HANDLE_CHANNEL_STATUS(state, channel, status);
                     }
                 }
@@ -375,6 +378,7 @@ Status ExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block* block
             RETURN_IF_ERROR(local_state.get_next_available_buffer(&block_holder));
             {
                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
+                SCOPED_CONSUME_MEM_SITE(local_state._mem_sites, MemSite::EXCHANGE_BUFFER);
                 bool serialized = false;
                 RETURN_IF_ERROR(local_state._serializer.next_serialized_block(
                         block, block_holder->get_block(), local_state.channels.size(), &serialized,
@@ -395,6 +399,8 @@ Status ExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block* block
                                 status = channel->send_local_block(&cur_block);
                             } else {
                                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
+                                SCOPED_CONSUME_MEM_SITE(local_state._mem_sites,
+                                                        MemSite::EXCHANGE_BUFFER);
                                 status = channel->send_broadcast_block(block_holder, eos);
                             }
                             HANDLE_CHANNEL_STATUS(state, channel, status);
@@ -413,11 +419,12 @@ Status ExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block* block
         if (!current_channel->is_receiver_eof()) {
             // 2. serialize, send and rollover block
             if (current_channel->is_local()) {
-                auto status = current_channel->send_local_block(block);
+                auto status = current_channel->send_local_block(block, true);
                 HANDLE_CHANNEL_STATUS(state, current_channel, status);
             } else {
                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
-                RETURN_IF_ERROR(local_state._serializer.serialize_block(
+                SCOPED_CONSUME_MEM_SITE(local_state._mem_sites, MemSite::EXCHANGE_BUFFER);
+                RETURN_IF_ERROR(current_channel->serialize_block(
                         block, current_channel->ch_cur_pb_block()));
                 auto status =
                         current_channel->send_remote_block(current_channel->ch_cur_pb_block(), eos);
@@ -495,20 +502,22 @@ Status ExchangeSinkOperatorX::sink(RuntimeState* state, vectorized::Block* block
         vectorized::PipChannel* current_channel =
                 local_state.channels[local_state.current_channel_idx];
         if (!current_channel->is_receiver_eof()) {
+            // the local channel takes the columns of the block
+            _data_processed += block->bytes();
             // 2. serialize, send and rollover block
             if (current_channel->is_local()) {
-                auto status = current_channel->send_local_block(block);
+                auto status = current_channel->send_local_block(block, true);
                 HANDLE_CHANNEL_STATUS(state, current_channel, status);
             } else {
                 SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
-                RETURN_IF_ERROR(local_state._serializer.serialize_block(
+                SCOPED_CONSUME_MEM_SITE(local_state._mem_sites, MemSite::EXCHANGE_BUFFER);
+                RETURN_IF_ERROR(current_channel->serialize_block(
                         block, current_channel->ch_cur_pb_block()));
                 auto status =
                         current_channel->send_remote_block(current_channel->ch_cur_pb_block(), eos);
                 HANDLE_CHANNEL_STATUS(state, current_channel, status);
                 current_channel->ch_roll_pb_block();
             }
-            _data_processed += block->bytes();
         }
 
         if (_writer_count < local_state.channels.size()) {
@@ -88,6 +88,8 @@ Status ExchangeLocalState::open(RuntimeState* state) {
 
     RETURN_IF_ERROR(_parent->cast<ExchangeSourceOperatorX>()._vsort_exec_exprs.clone(
             state, vsort_exec_exprs));
+    capture_writer =
+            FragmentCapture::create_writer(state, "exchange", _parent->node_id(), profile());
     return Status::OK();
 }
 
@@ -154,6 +156,9 @@ Status ExchangeSourceOperatorX::get_block(RuntimeState* state, vectorized::Block
         return Status::OK();
     }
     auto status = local_state.stream_recvr->get_next(block, eos);
+    if (status.ok() && local_state.capture_writer != nullptr) {
+        local_state.capture_writer->write(state, *block);
+    }
     RETURN_IF_ERROR(doris::vectorized::VExprContext::filter_block(local_state.conjuncts(), block,
                                                                   block->columns()));
     // In vsortrunmerger, it will set eos=true, and block not empty
@@ -196,6 +201,9 @@ Status ExchangeLocalState::close(RuntimeState* state) {
     if (stream_recvr != nullptr) {
         stream_recvr->close();
     }
+    if (capture_writer != nullptr) {
+        capture_writer->close();
+    }
     if (_parent->cast<ExchangeSourceOperatorX>()._is_merging) {
         vsort_exec_exprs.close(state);
     }
@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #include "operator.h"
+#include "pipeline/fragment_capture.h"
 
 namespace doris {
 class ExecNode;
@@ -59,6 +60,9 @@ public:
     std::vector<std::shared_ptr<Dependency>> deps;
 
     std::vector<RuntimeProfile::Counter*> metrics;
+
+    // the blocks received, if the fragment is captured
+    std::unique_ptr<FragmentCaptureWriter> capture_writer;
 };
 
 class ExchangeSourceOperatorX final : public OperatorX<ExchangeLocalState> {
@@ -289,10 +289,7 @@ Status GroupCommitBlockSinkOperatorX::sink(RuntimeState* state, vectorized::Bloc
         local_state._partitions.assign(rows, nullptr);
         local_state._filter_bitmap.Reset(rows);
 
-        for (int index = 0; index < rows; index++) {
-            local_state._vpartition->find_partition(block.get(), index,
-                                                    local_state._partitions[index]);
-        }
+        local_state._vpartition->find_partitions(block.get(), rows, local_state._partitions);
         for (int row_index = 0; row_index < rows; row_index++) {
             if (local_state._partitions[row_index] == nullptr) [[unlikely]] {
                 local_state._filter_bitmap.Set(row_index, true);
@@ -19,9 +19,11 @@
 
 #include <string>
 
+#include "common/config.h"
 #include "exprs/bloom_filter_func.h"
 #include "pipeline/exec/hashjoin_probe_operator.h"
 #include "pipeline/exec/operator.h"
+#include "vec/columns/column_const.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/exec/join/vhash_join_node.h"
 #include "vec/utils/template_helpers.hpp"
@@ -76,6 +78,8 @@ Status HashJoinBuildSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
             ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "BuildBlocks", TUnit::BYTES, "MemoryUsage", 1);
     _hash_table_memory_usage =
             ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "HashTable", TUnit::BYTES, "MemoryUsage", 1);
+    _build_dict_encoded_saved_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(
+            profile(), "BuildBlocksDictEncodedSaved", TUnit::BYTES, "MemoryUsage", 1);
     _build_arena_memory_usage =
             profile()->AddHighWaterMarkCounter("BuildKeyArena", TUnit::BYTES, "MemoryUsage", 1);
 
@@ -127,7 +131,7 @@ Status HashJoinBuildSinkLocalState::close(RuntimeState* state, Status exec_statu
     {
         SCOPED_TIMER(_runtime_filter_init_timer);
         if (_should_build_hash_table) {
-            RETURN_IF_ERROR(_runtime_filter_slots->init_filters(state, hash_table_size));
+            RETURN_IF_ERROR(_runtime_filter_slots->init_filters(state, hash_table_size, block));
         }
         RETURN_IF_ERROR(_runtime_filter_slots->ignore_filters(state));
     }
@@ -237,6 +241,45 @@ Status HashJoinBuildSinkLocalState::_extract_join_column(
     return Status::OK();
 }
 
+// The string columns of the build block that are not read by the join keys are only needed to
+// output the matched rows, so they are kept encoded by a dictionary and decoded when gathered.
+void HashJoinBuildSinkLocalState::_dict_encode_build_block() {
+    auto& block = *_shared_state->build_block;
+    std::vector<bool> is_key_column(block.columns(), false);
+    std::vector<int> key_column_ids(_build_col_ids);
+    for (const auto& ctx : _build_expr_ctxs) {
+        if (!ctx->root()->collect_read_column_ids(&key_column_ids)) {
+            return;
+        }
+    }
+    for (auto id : key_column_ids) {
+        if (id < 0) {
+            return;
+        }
+        if (id < is_key_column.size()) {
+            is_key_column[id] = true;
+        }
+    }
+
+    const auto rows = block.rows();
+    _shared_state->build_dict_columns.resize(block.columns());
+    for (size_t i = 0; i < block.columns(); ++i) {
+        auto& column = block.get_by_position(i).column;
+        if (is_key_column[i] || is_column_const(*column)) {
+            continue;
+        }
+        auto encoded = vectorized::DictEncodedStringColumn::encode(*column);
+        if (encoded == nullptr) {
+            continue;
+        }
+        COUNTER_UPDATE(_build_dict_encoded_saved_bytes,
+                       column->allocated_bytes() - encoded->allocated_bytes());
+        // keep a placeholder so that the block still has its rows
+        column = vectorized::ColumnConst::create(column->clone_resized(1), rows);
+        _shared_state->build_dict_columns[i] = std::move(encoded);
+    }
+}
+
 Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
                                                         vectorized::Block& block) {
     auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
@@ -276,6 +319,15 @@ Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
     // Get the key column that needs to be built
     Status st = _extract_join_column(block, null_map_val, raw_ptrs, _build_col_ids);
 
+    // The other instances of a shared broadcast join wait for the hash table, so it can be
+    // built by as many threads.
+    int build_parallelism = 1;
+    if (p._shared_hashtable_controller && _should_build_hash_table &&
+        config::broadcast_join_parallel_build_min_rows > 0 &&
+        rows >= config::broadcast_join_parallel_build_min_rows) {
+        build_parallelism = std::max(state->query_parallel_instance_num(), 1);
+    }
+
     st = std::visit(
             vectorized::Overload {
                     [&](std::monostate& arg, auto join_op, auto has_null_value,
@@ -293,7 +345,7 @@ Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
                         vectorized::ProcessHashTableBuild<HashTableCtxType,
                                                           HashJoinBuildSinkLocalState>
                                 hash_table_build_process(rows, raw_ptrs, this, state->batch_size(),
-                                                         state);
+                                                         state, build_parallelism);
                         auto old_hash_table_size = arg.hash_table->get_byte_size();
                         auto old_key_size = arg.serialized_keys_size(true);
                         auto st = hash_table_build_process.template run<
@@ -307,6 +359,9 @@ Status HashJoinBuildSinkLocalState::process_build_block(RuntimeState* state,
                         _mem_tracker->consume(arg.hash_table->get_byte_size() -
                                               old_hash_table_size);
                         _mem_tracker->consume(arg.serialized_keys_size(true) - old_key_size);
+                        _mem_sites.consume(MemSite::HASH_TABLE,
+                                           arg.hash_table->get_byte_size() - old_hash_table_size +
+                                                   arg.serialized_keys_size(true) - old_key_size);
                         return st;
                     }},
             *_shared_state->hash_table_variants, _shared_state->join_op_variants,
@@ -536,6 +591,7 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
             }
 
             local_state._mem_tracker->consume(in_block->bytes());
+            local_state._mem_sites.consume(MemSite::BLOCK, in_block->bytes());
             COUNTER_UPDATE(local_state._build_blocks_memory_usage, in_block->bytes());
             local_state._build_blocks.emplace_back(std::move(*in_block));
         }
@@ -566,6 +622,9 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                 local_state._finish_dependency));
         RETURN_IF_ERROR(
                 local_state.process_build_block(state, (*local_state._shared_state->build_block)));
+        if (config::enable_hash_join_build_dict_encoding) {
+            local_state._dict_encode_build_block();
+        }
         if (_shared_hashtable_controller) {
             _shared_hash_table_context->status = Status::OK();
             // arena will be shared with other instances.
@@ -575,6 +634,8 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
             _shared_hash_table_context->short_circuit_for_null_in_probe_side =
                     local_state._shared_state->_has_null_in_build_side;
             _shared_hash_table_context->block = local_state._shared_state->build_block;
+            _shared_hash_table_context->build_dict_columns =
+                    local_state._shared_state->build_dict_columns;
             _shared_hash_table_context->build_indexes_null =
                     local_state._shared_state->build_indexes_null;
             local_state._runtime_filter_slots->copy_to_shared_context(_shared_hash_table_context);
@@ -611,6 +672,8 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                         _shared_hash_table_context->hash_table_variants));
 
         local_state._shared_state->build_block = _shared_hash_table_context->block;
+        local_state._shared_state->build_dict_columns =
+                _shared_hash_table_context->build_dict_columns;
         local_state._shared_state->build_indexes_null =
                 _shared_hash_table_context->build_indexes_null;
     }
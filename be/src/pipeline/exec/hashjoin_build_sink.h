@@ -61,6 +61,7 @@ protected:
     Status _do_evaluate(vectorized::Block& block, vectorized::VExprContextSPtrs& exprs,
                         RuntimeProfile::Counter& expr_call_timer, std::vector<int>& res_col_ids);
     std::vector<uint16_t> _convert_block_to_null(vectorized::Block& block);
+    void _dict_encode_build_block();
     Status _extract_join_column(vectorized::Block& block,
                                 vectorized::ColumnUInt8::MutablePtr& null_map,
                                 vectorized::ColumnRawPtrs& raw_ptrs,
@@ -104,6 +105,7 @@ protected:
     RuntimeProfile::Counter* _allocate_resource_timer = nullptr;
 
     RuntimeProfile::Counter* _build_blocks_memory_usage = nullptr;
+    RuntimeProfile::Counter* _build_dict_encoded_saved_bytes = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _build_arena_memory_usage = nullptr;
 };
@@ -444,8 +444,13 @@ Status HashJoinProbeLocalState::filter_data_and_build_output(RuntimeState* state
     }
     {
         SCOPED_TIMER(_join_filter_timer);
-        RETURN_IF_ERROR(vectorized::VExprContext::filter_block(_conjuncts, temp_block,
-                                                               temp_block->columns()));
+        // with projections, the temp block becomes the origin block of the projections
+        if (!_projections.empty()) {
+            RETURN_IF_ERROR(p.filter_projection_input(_conjuncts, temp_block));
+        } else {
+            RETURN_IF_ERROR(vectorized::VExprContext::filter_block(_conjuncts, temp_block,
+                                                                   temp_block->columns()));
+        }
     }
 
     RETURN_IF_ERROR_OR_CATCH_EXCEPTION(_build_output_block(temp_block, output_block, false));
@@ -76,6 +76,9 @@ public:
     const std::shared_ptr<vectorized::Block>& build_block() const {
         return _shared_state->build_block;
     }
+    const vectorized::DictEncodedStringColumns& build_dict_columns() const {
+        return _shared_state->build_dict_columns;
+    }
     bool empty_right_table_shortcut() const {
         // !Base::_projections.empty() means nereids planner
         return _shared_state->empty_right_table_need_probe_dispose && !Base::_projections.empty();
@@ -17,7 +17,9 @@
 
 #include "pipeline/exec/jdbc_scan_operator.h"
 
+#include "common/config.h"
 #include "common/object_pool.h"
+#include "runtime/descriptors.h"
 #include "vec/exec/scan/new_jdbc_scanner.h"
 
 namespace doris::pipeline {
@@ -29,11 +31,19 @@ std::string JDBCScanLocalState::name_suffix() const {
 
 Status JDBCScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* scanners) {
     auto& p = _parent->cast<JDBCScanOperatorX>();
-    std::unique_ptr<vectorized::NewJdbcScanner> scanner = vectorized::NewJdbcScanner::create_unique(
-            state(), this, p._limit_per_scanner, p._tuple_id, p._query_string, p._table_type,
-            _scanner_profile.get());
-    RETURN_IF_ERROR(scanner->prepare(state(), _conjuncts));
-    scanners->push_back(std::move(scanner));
+    // a limited scan reads a few rows, it's not worth more connections
+    int split_num = p._limit_per_scanner < 0 ? config::jdbc_scan_split_num : 1;
+    auto queries = vectorized::NewJdbcScanner::split_query_string(
+            p._query_string, p._table_type, state()->desc_tbl().get_tuple_descriptor(p._tuple_id),
+            split_num);
+    for (const auto& query : queries) {
+        std::unique_ptr<vectorized::NewJdbcScanner> scanner =
+                vectorized::NewJdbcScanner::create_unique(state(), this, p._limit_per_scanner,
+                                                          p._tuple_id, query, p._table_type,
+                                                          _scanner_profile.get());
+        RETURN_IF_ERROR(scanner->prepare(state(), _conjuncts));
+        scanners->push_back(std::move(scanner));
+    }
     return Status::OK();
 }
 
@@ -17,6 +17,7 @@
 
 #include "multi_cast_data_streamer.h"
 
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/multi_cast_data_stream_source.h"
 #include "runtime/runtime_state.h"
@@ -42,8 +43,15 @@ void MultiCastDataStreamer::pull(int sender_idx, doris::vectorized::Block* block
             _multi_cast_blocks.pop_front();
         } else {
             pos_to_pull->_used_count--;
-            pos_to_pull->_block->create_same_struct_block(0)->swap(*block);
-            (void)vectorized::MutableBlock(block).merge(*pos_to_pull->_block);
+            if (config::enable_multi_cast_share_columns) {
+                // the columns are immutable once pushed, a consumer mutating a column gets its
+                // own copy by the COW of the columns
+                vectorized::Block(pos_to_pull->_block->get_columns_with_type_and_name())
+                        .swap(*block);
+            } else {
+                pos_to_pull->_block->create_same_struct_block(0)->swap(*block);
+                (void)vectorized::MutableBlock(block).merge(*pos_to_pull->_block);
+            }
             pos_to_pull++;
         }
     }
@@ -102,6 +102,14 @@ Status OlapScanLocalState::_init_profile() {
     _stats_filtered_counter = ADD_COUNTER(_segment_profile, "RowsStatsFiltered", TUnit::UNIT);
     _stats_rp_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsZonemapRuntimePredicateFiltered", TUnit::UNIT);
+    _late_rf_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsLateRuntimeFilterFiltered", TUnit::UNIT);
+    _topn_rp_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsTopNRuntimePredicateFiltered", TUnit::UNIT);
+    _prefetch_hit_counter = ADD_COUNTER(_segment_profile, "PrefetchHitCount", TUnit::UNIT);
+    _prefetch_miss_counter = ADD_COUNTER(_segment_profile, "PrefetchMissCount", TUnit::UNIT);
+    _prefetch_wait_timer = ADD_TIMER(_segment_profile, "PrefetchWaitTime");
+    _prefetch_bytes_counter = ADD_COUNTER(_segment_profile, "PrefetchBytes", TUnit::BYTES);
     _bf_filtered_counter = ADD_COUNTER(_segment_profile, "RowsBloomFilterFiltered", TUnit::UNIT);
     _dict_filtered_counter = ADD_COUNTER(_segment_profile, "RowsDictFiltered", TUnit::UNIT);
     _del_filtered_counter = ADD_COUNTER(_scanner_profile, "RowsDelFiltered", TUnit::UNIT);
@@ -282,6 +290,10 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
         std::vector<std::function<Status()>> tasks;
         tasks.reserve(_scan_ranges.size());
         for (auto&& [tablet, version] : tablets) {
+            // most tablets are up to date, only the stale ones need a bthread to sync
+            if (static_cast<CloudTablet*>(tablet.get())->rowsets_synced(version)) {
+                continue;
+            }
             tasks.emplace_back([tablet, version]() {
                 return std::dynamic_pointer_cast<CloudTablet>(tablet)->sync_rowsets(version);
             });
@@ -127,6 +127,12 @@ private:
 
     RuntimeProfile::Counter* _stats_filtered_counter = nullptr;
     RuntimeProfile::Counter* _stats_rp_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _late_rf_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _topn_rp_filtered_counter = nullptr;
+    RuntimeProfile::Counter* _prefetch_hit_counter = nullptr;
+    RuntimeProfile::Counter* _prefetch_miss_counter = nullptr;
+    RuntimeProfile::Counter* _prefetch_wait_timer = nullptr;
+    RuntimeProfile::Counter* _prefetch_bytes_counter = nullptr;
     RuntimeProfile::Counter* _bf_filtered_counter = nullptr;
     RuntimeProfile::Counter* _dict_filtered_counter = nullptr;
     RuntimeProfile::Counter* _del_filtered_counter = nullptr;
@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "exec/exec_node.h"
@@ -206,13 +207,42 @@ Status OperatorXBase::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+static std::vector<int> find_projection_sources(const vectorized::VExprContextSPtrs& projections) {
+    std::vector<int> sources(projections.size());
+    std::unordered_map<std::string, int> first_projections;
+    for (int i = 0; i < projections.size(); ++i) {
+        sources[i] = i;
+        auto fingerprint = projections[i]->root()->fingerprint();
+        if (!fingerprint.empty()) {
+            sources[i] = first_projections.emplace(std::move(fingerprint), i).first->second;
+        }
+    }
+    return sources;
+}
+
 Status OperatorXBase::open(RuntimeState* state) {
     for (auto& conjunct : _conjuncts) {
         RETURN_IF_ERROR(conjunct->open(state));
     }
     RETURN_IF_ERROR(vectorized::VExpr::open(_projections, state));
+    _projection_sources = find_projection_sources(_projections);
+    _intermediate_projection_sources.clear();
     for (auto& projections : _intermediate_projections) {
         RETURN_IF_ERROR(vectorized::VExpr::open(projections, state));
+        _intermediate_projection_sources.push_back(find_projection_sources(projections));
+    }
+    _projection_read_columns_known = false;
+    _projection_read_columns.clear();
+    const auto& first_projections =
+            _intermediate_projections.empty() ? _projections : _intermediate_projections[0];
+    if (!first_projections.empty()) {
+        std::vector<int> column_ids;
+        _projection_read_columns_known = std::all_of(
+                first_projections.begin(), first_projections.end(),
+                [&](const auto& ctx) { return ctx->root()->collect_read_column_ids(&column_ids); });
+        _projection_read_columns_known &= std::none_of(column_ids.begin(), column_ids.end(),
+                                                        [](int id) { return id < 0; });
+        _projection_read_columns.assign(column_ids.begin(), column_ids.end());
     }
     if (_child_x && !is_source()) {
         RETURN_IF_ERROR(_child_x->open(state));
@@ -247,9 +277,17 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     vectorized::Block input_block = *origin_block;
 
     std::vector<int> result_column_ids;
-    for (const auto& projections : _intermediate_projections) {
+    for (size_t level = 0; level < _intermediate_projections.size(); ++level) {
+        const auto& projections = _intermediate_projections[level];
+        const auto* sources = level < _intermediate_projection_sources.size()
+                                      ? &_intermediate_projection_sources[level]
+                                      : nullptr;
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
+            if (sources != nullptr && (*sources)[i] != i) {
+                result_column_ids[i] = result_column_ids[(*sources)[i]];
+                continue;
+            }
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
         }
         input_block.shuffle_columns(result_column_ids);
@@ -281,9 +319,15 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     if (rows != 0) {
         auto& mutable_columns = mutable_block.mutable_columns();
         DCHECK(mutable_columns.size() == local_state->_projections.size());
+        std::vector<int> projected_column_ids(mutable_columns.size(), -1);
         for (int i = 0; i < mutable_columns.size(); ++i) {
-            auto result_column_id = -1;
-            RETURN_IF_ERROR(local_state->_projections[i]->execute(&input_block, &result_column_id));
+            auto& result_column_id = projected_column_ids[i];
+            if (i < _projection_sources.size() && _projection_sources[i] != i) {
+                result_column_id = projected_column_ids[_projection_sources[i]];
+            } else {
+                RETURN_IF_ERROR(
+                        local_state->_projections[i]->execute(&input_block, &result_column_id));
+            }
             auto column_ptr = input_block.get_by_position(result_column_id)
                                       .column->convert_to_full_column_if_const();
             insert_column_datas(mutable_columns[i], column_ptr, rows);
@@ -295,9 +339,19 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     return Status::OK();
 }
 
+Status OperatorXBase::filter_projection_input(const vectorized::VExprContextSPtrs& conjuncts,
+                                              vectorized::Block* block) const {
+    if (!_output_row_descriptor || !_projection_read_columns_known) {
+        return vectorized::VExprContext::filter_block(conjuncts, block, block->columns());
+    }
+    return vectorized::VExprContext::filter_block_columns(conjuncts, block,
+                                                          _projection_read_columns);
+}
+
 Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::Block* block,
                                                bool* eos) {
     auto local_state = state->get_local_state(operator_id());
+    ScopedPerfEvents perf_events(local_state->perf_event_counters());
     if (_output_row_descriptor) {
         local_state->clear_origin_block();
         auto status = get_block(state, &local_state->_origin_block, eos);
@@ -444,7 +498,9 @@ Status PipelineXLocalState<SharedStateArg>::init(RuntimeState* state, LocalState
     _open_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "OpenTime", 1);
     _close_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "CloseTime", 1);
     _exec_timer = ADD_TIMER_WITH_LEVEL(_runtime_profile, "ExecTime", 1);
+    _perf_event_counters.init(_runtime_profile.get(), config::pipeline_perf_events_profile_level);
     _mem_tracker = std::make_unique<MemTracker>("PipelineXLocalState:" + _runtime_profile->name());
+    _mem_sites.init(_mem_tracker->label());
     _memory_used_counter = ADD_LABEL_COUNTER_WITH_LEVEL(_runtime_profile, "MemoryUsage", 1);
     _peak_memory_usage_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakMemoryUsage", TUnit::BYTES, "MemoryUsage", 1);
@@ -485,6 +541,7 @@ Status PipelineXLocalState<SharedStateArg>::close(RuntimeState* state) {
     }
     if (_peak_memory_usage_counter) {
         _peak_memory_usage_counter->set(_mem_tracker->peak_consumption());
+        _mem_sites.update_profile(_runtime_profile.get(), "PeakMemoryUsage");
     }
     _closed = true;
     return Status::OK();
@@ -518,8 +575,10 @@ Status PipelineXSinkLocalState<SharedState>::init(RuntimeState* state, LocalSink
     _open_timer = ADD_TIMER_WITH_LEVEL(_profile, "OpenTime", 1);
     _close_timer = ADD_TIMER_WITH_LEVEL(_profile, "CloseTime", 1);
     _exec_timer = ADD_TIMER_WITH_LEVEL(_profile, "ExecTime", 1);
+    _perf_event_counters.init(_profile, config::pipeline_perf_events_profile_level);
     info.parent_profile->add_child(_profile, true, nullptr);
     _mem_tracker = std::make_unique<MemTracker>(_parent->get_name());
+    _mem_sites.init(_mem_tracker->label());
     _memory_used_counter = ADD_LABEL_COUNTER_WITH_LEVEL(_profile, "MemoryUsage", 1);
     _peak_memory_usage_counter =
             _profile->AddHighWaterMarkCounter("PeakMemoryUsage", TUnit::BYTES, "MemoryUsage", 1);
@@ -536,6 +595,7 @@ Status PipelineXSinkLocalState<SharedState>::close(RuntimeState* state, Status e
     }
     if (_peak_memory_usage_counter) {
         _peak_memory_usage_counter->set(_mem_tracker->peak_consumption());
+        _mem_sites.update_profile(_profile, "PeakMemoryUsage");
     }
     _closed = true;
     return Status::OK();
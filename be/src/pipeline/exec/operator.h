@@ -32,8 +32,10 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/local_exchange/local_exchanger.h"
+#include "runtime/memory/mem_site_tracker.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
+#include "util/thread_perf_events.h"
 #include "vec/core/block.h"
 #include "vec/runtime/vdata_stream_recvr.h"
 #include "vec/sink/vresult_sink.h"
@@ -174,9 +176,11 @@ public:
     RuntimeProfile* profile() { return _runtime_profile.get(); }
 
     MemTracker* mem_tracker() { return _mem_tracker.get(); }
+    MemSiteTracker* mem_sites() { return &_mem_sites; }
     RuntimeProfile::Counter* rows_returned_counter() { return _rows_returned_counter; }
     RuntimeProfile::Counter* blocks_returned_counter() { return _blocks_returned_counter; }
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
+    PerfEventCounters* perf_event_counters() { return &_perf_event_counters; }
     OperatorXBase* parent() { return _parent; }
     RuntimeState* state() { return _state; }
     vectorized::VExprContextSPtrs& conjuncts() { return _conjuncts; }
@@ -207,6 +211,8 @@ protected:
     // Record this node memory size. it is expected that artificial guarantees are accurate,
     // which will providea reference for operator memory.
     std::unique_ptr<MemTracker> _mem_tracker;
+    // `_mem_tracker` split by the data structures holding the memory
+    MemSiteTracker _mem_sites;
 
     std::shared_ptr<QueryStatistics> _query_statistics = nullptr;
 
@@ -216,6 +222,7 @@ protected:
     RuntimeProfile::Counter* _memory_used_counter = nullptr;
     RuntimeProfile::Counter* _projection_timer = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
+    PerfEventCounters _perf_event_counters;
     // Account for peak memory used by this node
     RuntimeProfile::Counter* _peak_memory_usage_counter = nullptr;
     RuntimeProfile::Counter* _init_timer = nullptr;
@@ -352,12 +359,14 @@ public:
     RuntimeState* state() { return _state; }
     RuntimeProfile* profile() { return _profile; }
     MemTracker* mem_tracker() { return _mem_tracker.get(); }
+    MemSiteTracker* mem_sites() { return &_mem_sites; }
     [[nodiscard]] RuntimeProfile* faker_runtime_profile() const {
         return _faker_runtime_profile.get();
     }
 
     RuntimeProfile::Counter* rows_input_counter() { return _rows_input_counter; }
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
+    PerfEventCounters* perf_event_counters() { return &_perf_event_counters; }
     virtual std::vector<Dependency*> dependencies() const { return {nullptr}; }
 
     // override in exchange sink , AsyncWriterSink
@@ -370,6 +379,8 @@ protected:
     RuntimeState* _state = nullptr;
     RuntimeProfile* _profile = nullptr;
     std::unique_ptr<MemTracker> _mem_tracker;
+    // `_mem_tracker` split by the data structures holding the memory
+    MemSiteTracker _mem_sites;
     // Set to true after close() has been called. subclasses should check and set this in
     // close().
     bool _closed = false;
@@ -387,6 +398,7 @@ protected:
     RuntimeProfile::Counter* _wait_for_dependency_timer = nullptr;
     RuntimeProfile::Counter* _wait_for_finish_dependency_timer = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
+    PerfEventCounters _perf_event_counters;
     RuntimeProfile::Counter* _memory_used_counter = nullptr;
     RuntimeProfile::Counter* _peak_memory_usage_counter = nullptr;
 
@@ -489,6 +501,10 @@ public:
 
     [[nodiscard]] virtual bool is_shuffled_hash_join() const { return false; }
 
+    // Whether the rows of one hash partition could be processed by several tasks, so a hot
+    // partition of the local shuffle could be split across them.
+    [[nodiscard]] virtual bool could_split_hash_partition() const { return false; }
+
     Status close(RuntimeState* state) override {
         return Status::InternalError("Should not reach here!");
     }
@@ -689,6 +705,10 @@ public:
 
     [[nodiscard]] virtual bool is_shuffled_hash_join() const { return false; }
 
+    // Whether the rows of one hash partition could be processed by several tasks, so a hot
+    // partition of the local shuffle could be split across them.
+    [[nodiscard]] virtual bool could_split_hash_partition() const { return false; }
+
     Status close(RuntimeState* state) override;
 
     [[nodiscard]] virtual const RowDescriptor& intermediate_row_desc() const {
@@ -761,6 +781,10 @@ public:
     /// Only use in vectorized exec engine try to do projections to trans _row_desc -> _output_row_desc
     Status do_projections(RuntimeState* state, vectorized::Block* origin_block,
                           vectorized::Block* output_block) const;
+    // Filters the block by the conjuncts. If the block is the input of the projections, the
+    // columns that the projections never read are not filtered.
+    Status filter_projection_input(const vectorized::VExprContextSPtrs& conjuncts,
+                                   vectorized::Block* block) const;
     void set_parallel_tasks(int parallel_tasks) { _parallel_tasks = parallel_tasks; }
     int parallel_tasks() const { return _parallel_tasks; }
 
@@ -785,6 +809,14 @@ protected:
     std::vector<RowDescriptor> _intermediate_output_row_descriptor;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // For each projection, the index of the first projection in the same list with the same
+    // result, the repeated projections reuse its column instead of being evaluated again.
+    std::vector<int> _projection_sources;
+    std::vector<std::vector<int>> _intermediate_projection_sources;
+    // The columns of the origin block read by the first level of the projections, only valid if
+    // `_projection_read_columns_known` is true.
+    std::vector<uint32_t> _projection_read_columns;
+    bool _projection_read_columns_known = false;
 
     /// Resource information sent from the frontend.
     const TBackendResourceProfile _resource_profile;
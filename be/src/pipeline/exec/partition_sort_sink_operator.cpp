@@ -17,6 +17,7 @@
 
 #include "partition_sort_sink_operator.h"
 
+#include "common/config.h"
 #include "common/status.h"
 #include "partition_sort_source_operator.h"
 #include "vec/common/hash_table/hash.h"
@@ -50,6 +51,52 @@ Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     return Status::OK();
 }
 
+Status PartitionSortSinkLocalState::close(RuntimeState* state, Status exec_status) {
+    if (_closed) {
+        return Status::OK();
+    }
+    dec_running_big_mem_op_num(state);
+    return PipelineXSinkLocalState<PartitionSortNodeSharedState>::close(state, exec_status);
+}
+
+size_t PartitionSortSinkLocalState::_buffered_bytes() const {
+    size_t bytes = 0;
+    for (const auto* place : _value_places) {
+        for (const auto& block : place->_blocks) {
+            bytes += block->allocated_bytes();
+        }
+    }
+    return bytes;
+}
+
+Status PartitionSortSinkLocalState::_revoke_memory(RuntimeState* state) {
+    VLOG_DEBUG << "query " << print_id(state->query_id()) << " partition sort node "
+               << _parent->node_id() << " revoke_memory, partitions: " << _num_partition
+               << ", bytes: " << _buffered_bytes();
+    profile()->add_info_string("PassThroughAfterRevoke", "true");
+    _pass_through_all_rows = true;
+    {
+        std::lock_guard<std::mutex> lock(_shared_state->buffer_mutex);
+        for (auto* place : _value_places) {
+            for (auto& block : place->_blocks) {
+                if (block->rows() > 0) {
+                    COUNTER_UPDATE(_passthrough_rows_counter, (int64_t)block->rows());
+                    _shared_state->blocks_buffer.push(std::move(*block));
+                }
+            }
+            place->_blocks.clear();
+            place->_partition_topn_sorter.reset();
+        }
+        _dependency->set_ready_to_read();
+    }
+    // the places are owned by the object pool, they will not be sorted anymore
+    _value_places.clear();
+    _partitioned_data.reset(nullptr);
+    _agg_arena_pool.reset(nullptr);
+    COUNTER_SET(_hash_table_size_counter, int64_t(_num_partition));
+    return Status::OK();
+}
+
 PartitionSortSinkOperatorX::PartitionSortSinkOperatorX(ObjectPool* pool, int operator_id,
                                                        const TPlanNode& tnode,
                                                        const DescriptorTbl& descs)
@@ -77,6 +124,9 @@ Status PartitionSortSinkOperatorX::init(const TPlanNode& tnode, RuntimeState* st
         RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(
                 tnode.partition_sort_node.partition_exprs, _partition_expr_ctxs));
     }
+    _enable_revoke_memory = _topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL &&
+                            (state->enable_force_spill() ||
+                             config::enable_partition_topn_revoke_memory);
 
     return Status::OK();
 }
@@ -96,12 +146,17 @@ Status PartitionSortSinkOperatorX::open(RuntimeState* state) {
 Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block* input_block,
                                         bool eos) {
     auto& local_state = get_local_state(state);
+    if (_enable_revoke_memory) {
+        local_state.inc_running_big_mem_op_num(state);
+    }
     auto current_rows = input_block->rows();
     SCOPED_TIMER(local_state.exec_time_counter());
     if (current_rows > 0) {
         COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)input_block->rows());
         local_state.child_input_rows = local_state.child_input_rows + current_rows;
-        if (UNLIKELY(_partition_exprs_num == 0)) {
+        if (UNLIKELY(local_state._pass_through_all_rows)) {
+            _pass_through_block(input_block, local_state);
+        } else if (UNLIKELY(_partition_exprs_num == 0)) {
             if (UNLIKELY(local_state._value_places.empty())) {
                 local_state._value_places.push_back(_pool->add(new vectorized::PartitionBlocks(
                         local_state._partition_sort_info, local_state._value_places.empty())));
@@ -113,14 +168,7 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
             if (_topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL &&
                 local_state._num_partition > config::partition_topn_partition_threshold &&
                 local_state.child_input_rows < 10000 * local_state._num_partition) {
-                {
-                    COUNTER_UPDATE(local_state._passthrough_rows_counter,
-                                   (int64_t)input_block->rows());
-                    std::lock_guard<std::mutex> lock(local_state._shared_state->buffer_mutex);
-                    local_state._shared_state->blocks_buffer.push(std::move(*input_block));
-                    // buffer have data, source could read this.
-                    local_state._dependency->set_ready_to_read();
-                }
+                _pass_through_block(input_block, local_state);
             } else {
                 RETURN_IF_ERROR(_split_block_by_partition(input_block, local_state, eos));
                 RETURN_IF_CANCELLED(state);
@@ -158,6 +206,33 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
     return Status::OK();
 }
 
+size_t PartitionSortSinkOperatorX::revocable_mem_size(RuntimeState* state) const {
+    if (!_enable_revoke_memory) {
+        return 0;
+    }
+    auto& local_state = get_local_state(state);
+    if (local_state._pass_through_all_rows) {
+        return 0;
+    }
+    return local_state._buffered_bytes();
+}
+
+Status PartitionSortSinkOperatorX::revoke_memory(RuntimeState* state) {
+    if (revocable_mem_size(state) == 0) {
+        return Status::OK();
+    }
+    return get_local_state(state)._revoke_memory(state);
+}
+
+void PartitionSortSinkOperatorX::_pass_through_block(vectorized::Block* input_block,
+                                                     PartitionSortSinkLocalState& local_state) {
+    COUNTER_UPDATE(local_state._passthrough_rows_counter, (int64_t)input_block->rows());
+    std::lock_guard<std::mutex> lock(local_state._shared_state->buffer_mutex);
+    local_state._shared_state->blocks_buffer.push(std::move(*input_block));
+    // buffer have data, source could read this.
+    local_state._dependency->set_ready_to_read();
+}
+
 Status PartitionSortSinkOperatorX::_split_block_by_partition(
         vectorized::Block* input_block, PartitionSortSinkLocalState& local_state, bool eos) {
     for (int i = 0; i < _partition_exprs_num; ++i) {
@@ -35,10 +35,15 @@ public:
             : PipelineXSinkLocalState<PartitionSortNodeSharedState>(parent, state) {}
 
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
+    Status close(RuntimeState* state, Status exec_status) override;
 
 private:
     friend class PartitionSortSinkOperatorX;
 
+    // Moves the buffered rows to the source and passes through the rows after.
+    Status _revoke_memory(RuntimeState* state);
+    size_t _buffered_bytes() const;
+
     // Expressions and parameters used for build _sort_description
     vectorized::VSortExecExprs _vsort_exec_exprs;
     vectorized::VExprContextSPtrs _partition_expr_ctxs;
@@ -50,6 +55,8 @@ private:
     std::unique_ptr<vectorized::Arena> _agg_arena_pool;
     int _partition_exprs_num = 0;
     std::shared_ptr<vectorized::PartitionSortInfo> _partition_sort_info = nullptr;
+    // all rows are passed through since the memory is revoked
+    bool _pass_through_all_rows = false;
 
     RuntimeProfile::Counter* _build_timer = nullptr;
     RuntimeProfile::Counter* _emplace_key_timer = nullptr;
@@ -73,6 +80,11 @@ public:
     Status prepare(RuntimeState* state) override;
     Status open(RuntimeState* state) override;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos) override;
+
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state) override;
+
     DataDistribution required_data_distribution() const override {
         if (_topn_phase == TPartTopNPhase::TWO_PHASE_GLOBAL) {
             return DataSinkOperatorX<PartitionSortSinkLocalState>::required_data_distribution();
@@ -96,7 +108,12 @@ private:
     vectorized::VSortExecExprs _vsort_exec_exprs;
     std::vector<bool> _is_asc_order;
     std::vector<bool> _nulls_first;
+    // The rows are only filtered ahead of the analytic operator except the global phase of
+    // the two phase partition topn, so they can be passed through when the memory is revoked.
+    bool _enable_revoke_memory = false;
 
+    void _pass_through_block(vectorized::Block* input_block,
+                             PartitionSortSinkLocalState& local_state);
     Status _split_block_by_partition(vectorized::Block* input_block,
                                      PartitionSortSinkLocalState& local_state, bool eos);
     Status _emplace_into_hash_table(const vectorized::ColumnRawPtrs& key_columns,
@@ -17,12 +17,20 @@
 
 #include "partitioned_hash_join_probe_operator.h"
 
+#include <limits>
+#include <numeric>
+
+#include "common/config.h"
+#include "common/exception.h"
 #include "pipeline/pipeline_task.h"
 #include "util/mem_info.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 
+// The repartitioned rows of a new partition are spilled when they reach it.
+static constexpr size_t REPARTITION_SPILL_BATCH_BYTES = 8 * 1024 * 1024;
+
 PartitionedHashJoinProbeLocalState::PartitionedHashJoinProbeLocalState(RuntimeState* state,
                                                                        OperatorXBase* parent)
         : PipelineXSpillLocalState(state, parent),
@@ -38,6 +46,9 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
     _partitioner = std::make_unique<PartitionerType>(p._partition_count);
     RETURN_IF_ERROR(_partitioner->init(p._probe_exprs));
     RETURN_IF_ERROR(_partitioner->prepare(state, p._child_x->row_desc()));
+    _total_partition_count = p._partition_count;
+    _partition_levels.resize(p._partition_count, 0);
+    _repartition_counts.push_back(p._partition_count);
 
     _spill_and_partition_label = ADD_LABEL_COUNTER(profile(), "Partition");
     _partition_timer = ADD_CHILD_TIMER(profile(), "PartitionTime", "Partition");
@@ -56,6 +67,10 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
     _recovery_probe_blocks =
             ADD_CHILD_COUNTER(profile(), "RecoveryProbeBlocks", TUnit::UNIT, "Spill");
     _recovery_probe_timer = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "RecoveryProbeTime", "Spill", 1);
+    _repartition_timer = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillRepartitionTime", "Spill", 1);
+    _repartition_count =
+            ADD_CHILD_COUNTER(profile(), "SpillRepartitionCount", TUnit::UNIT, "Spill");
+    _build_chunk_count = ADD_CHILD_COUNTER(profile(), "SpillBuildChunkCount", TUnit::UNIT, "Spill");
 
     _spill_serialize_block_timer =
             ADD_CHILD_TIMER_WITH_LEVEL(Base::profile(), "SpillSerializeBlockTime", "Spill", 1);
@@ -341,6 +356,11 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
         return Status::OK();
     }
 
+    // the loaded chunk has not been probed yet
+    if (_build_chunk_pending) {
+        return Status::OK();
+    }
+
     auto& mutable_block = _shared_state->partitioned_build_blocks[partition_index];
     if (!mutable_block) {
         ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spilled_stream);
@@ -348,6 +368,17 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
         return Status::OK();
     }
 
+    // Still too large after repartitioning, usually because of one heavy key. An inner join
+    // can be done chunk by chunk of the build side, if the probe side can be read again.
+    size_t chunk_bytes = 0;
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    const auto max_bytes = static_cast<size_t>(config::spill_hash_join_partition_max_bytes);
+    const auto& probe_block = _partitioned_blocks[partition_index];
+    if (p._join_op == TJoinOp::INNER_JOIN && _build_bytes(partition_index) > max_bytes &&
+        _probe_blocks[partition_index].empty() && (!probe_block || probe_block->empty())) {
+        chunk_bytes = max_bytes;
+    }
+
     auto execution_context = state->get_task_execution_context();
     /// Resources in shared state will be released when the operator is closed,
     /// but there may be asynchronous spilling tasks at this time, which can lead to conflicts.
@@ -363,7 +394,7 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
 
     auto read_func = [this, query_id, mem_tracker, state, spilled_stream = spilled_stream,
                       &mutable_block, shared_state_holder, execution_context, submit_timer,
-                      partition_index] {
+                      partition_index, chunk_bytes] {
         SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
         std::shared_ptr<TaskExecutionContext> execution_context_lock;
         auto shared_state_sptr = shared_state_holder.lock();
@@ -415,6 +446,19 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
                     break;
                 }
             }
+
+            if (chunk_bytes > 0 && !eos && mutable_block->allocated_bytes() >= chunk_bytes) {
+                _build_chunk_pending = true;
+                break;
+            }
+        }
+
+        if (chunk_bytes > 0) {
+            COUNTER_UPDATE(_build_chunk_count, 1);
+        }
+        if (_build_chunk_pending) {
+            _dependency->set_ready();
+            return;
         }
 
         VLOG_DEBUG << "query: " << print_id(state->query_id())
@@ -491,7 +535,10 @@ Status PartitionedHashJoinProbeLocalState::recovery_probe_blocks_from_disk(Runti
             blocks.emplace_back(std::move(block));
         }
 
-        if (eos) {
+        if (eos && _build_chunk_pending) {
+            // read again for the next chunk of the build side
+            _chunked_probe_stream = std::move(spilled_stream);
+        } else if (eos) {
             VLOG_DEBUG << "query: " << print_id(query_id)
                        << ", recovery probe data done: " << spilled_stream->get_spill_dir();
             ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spilled_stream);
@@ -513,6 +560,266 @@ Status PartitionedHashJoinProbeLocalState::recovery_probe_blocks_from_disk(Runti
     return st;
 }
 
+bool PartitionedHashJoinProbeLocalState::need_to_repartition(uint32_t partition_index) const {
+    const auto level = _partition_levels[partition_index];
+    const auto fanout = config::spill_hash_join_repartition_fanout;
+    if (!_shared_state->spilled_streams[partition_index] ||
+        !_shared_state->partitioned_build_blocks[partition_index] ||
+        level >= config::spill_hash_join_max_repartition_depth || fanout < 2) {
+        return false;
+    }
+    // the partition count of the next level must fit the partitioner
+    if (_repartition_counts.size() == level + 1 &&
+        _repartition_counts[level] * fanout > std::numeric_limits<int32_t>::max()) {
+        return false;
+    }
+    return _build_bytes(partition_index) >
+           static_cast<size_t>(config::spill_hash_join_partition_max_bytes);
+}
+
+size_t PartitionedHashJoinProbeLocalState::_build_bytes(uint32_t partition_index) const {
+    size_t bytes = 0;
+    if (const auto& spilled_stream = _shared_state->spilled_streams[partition_index]) {
+        bytes += spilled_stream->get_spilled_block_bytes();
+    }
+    if (const auto& mutable_block = _shared_state->partitioned_build_blocks[partition_index]) {
+        bytes += mutable_block->allocated_bytes();
+    }
+    return bytes;
+}
+
+Status PartitionedHashJoinProbeLocalState::_get_repartitioner(RuntimeState* state, uint32_t level,
+                                                              bool build_side,
+                                                              PartitionerType** partitioner) {
+    DCHECK_GT(level, 0);
+    if (_repartition_counts.size() == level) {
+        _repartition_counts.push_back(_repartition_counts.back() *
+                                      config::spill_hash_join_repartition_fanout);
+        _build_repartitioners.resize(level + 1);
+        _probe_repartitioners.resize(level + 1);
+    }
+    auto& holder = build_side ? _build_repartitioners[level] : _probe_repartitioners[level];
+    if (!holder) {
+        auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+        auto new_partitioner = std::make_unique<PartitionerType>(_repartition_counts[level]);
+        RETURN_IF_ERROR(new_partitioner->init(build_side ? p._build_exprs : p._probe_exprs));
+        RETURN_IF_ERROR(new_partitioner->prepare(state, build_side
+                                                                ? p._build_side_child->row_desc()
+                                                                : p._child_x->row_desc()));
+        RETURN_IF_ERROR(new_partitioner->open(state));
+        holder = std::move(new_partitioner);
+    }
+    *partitioner = holder.get();
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::_repartition_rows(
+        RuntimeState* state, PartitionerType* partitioner, uint32_t level, bool build_side,
+        std::vector<vectorized::Block> blocks, const vectorized::SpillStreamSPtr& stream,
+        uint32_t first_partition, std::vector<vectorized::SpillStreamSPtr>& streams,
+        std::vector<size_t>* partition_rows) {
+    // the rows of a partition of the previous level share the channel id modulo its count
+    const auto divisor = _repartition_counts[level - 1];
+    const auto fanout = _repartition_counts[level] / divisor;
+    std::vector<std::unique_ptr<vectorized::MutableBlock>> partitioned_blocks(fanout);
+    std::vector<std::vector<uint32_t>> partition_indexes(fanout);
+
+    auto spill = [&](size_t i) -> Status {
+        auto& partitioned_block = partitioned_blocks[i];
+        if (!partitioned_block || partitioned_block->empty()) {
+            return Status::OK();
+        }
+        auto& spilling_stream = streams[first_partition + i];
+        if (!spilling_stream) {
+            RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                    state, spilling_stream, print_id(state->query_id()),
+                    build_side ? "hash_build_sink" : "hash_probe", _parent->id(),
+                    std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+                    _runtime_profile.get()));
+            RETURN_IF_ERROR(spilling_stream->prepare_spill());
+            spilling_stream->set_write_counters(_spill_serialize_block_timer, _spill_block_count,
+                                                _spill_data_size, _spill_write_disk_timer,
+                                                _spill_write_wait_io_timer);
+        }
+        auto block = partitioned_block->to_block();
+        partitioned_block.reset();
+        return spilling_stream->spill_block(state, block, false);
+    };
+
+    auto partition_block = [&](vectorized::Block& block) -> Status {
+        const auto rows = block.rows();
+        if (rows == 0) {
+            return Status::OK();
+        }
+        RETURN_IF_ERROR(partitioner->do_partitioning(state, &block, _mem_tracker.get()));
+        const auto* channel_ids = partitioner->get_channel_ids().get<uint32_t>();
+        for (auto& indexes : partition_indexes) {
+            indexes.clear();
+        }
+        for (uint32_t i = 0; i != rows; ++i) {
+            partition_indexes[channel_ids[i] / divisor].emplace_back(i);
+        }
+        for (size_t i = 0; i != fanout; ++i) {
+            const auto count = partition_indexes[i].size();
+            if (count == 0) {
+                continue;
+            }
+            (*partition_rows)[i] += count;
+            if (!partitioned_blocks[i]) {
+                partitioned_blocks[i] =
+                        vectorized::MutableBlock::create_unique(block.clone_empty());
+            }
+            partitioned_blocks[i]->add_rows(&block, partition_indexes[i].data(),
+                                            partition_indexes[i].data() + count);
+            if (partitioned_blocks[i]->allocated_bytes() >= REPARTITION_SPILL_BATCH_BYTES) {
+                RETURN_IF_ERROR(spill(i));
+            }
+        }
+        return Status::OK();
+    };
+
+    for (auto& block : blocks) {
+        RETURN_IF_ERROR(partition_block(block));
+    }
+    blocks.clear();
+    bool eos = !stream;
+    while (!eos && !state->is_cancelled()) {
+        vectorized::Block block;
+        RETURN_IF_ERROR(stream->read_next_block_sync(&block, &eos));
+        RETURN_IF_ERROR(partition_block(block));
+    }
+    // the new partitions are read from disk only, so they can be read again for chunks
+    for (size_t i = 0; i != fanout; ++i) {
+        RETURN_IF_ERROR(spill(i));
+    }
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::repartition(RuntimeState* state,
+                                                       uint32_t partition_index) {
+    const uint32_t level = _partition_levels[partition_index] + 1;
+    PartitionerType* build_partitioner = nullptr;
+    PartitionerType* probe_partitioner = nullptr;
+    RETURN_IF_ERROR(_get_repartitioner(state, level, true, &build_partitioner));
+    RETURN_IF_ERROR(_get_repartitioner(state, level, false, &probe_partitioner));
+
+    const auto fanout = _repartition_counts[level] / _repartition_counts[level - 1];
+    const uint32_t first_partition = _total_partition_count;
+    _total_partition_count += fanout;
+    _shared_state->partitioned_build_blocks.resize(_total_partition_count);
+    _shared_state->spilled_streams.resize(_total_partition_count);
+    _partitioned_blocks.resize(_total_partition_count);
+    _probe_spilling_streams.resize(_total_partition_count);
+    _partition_levels.resize(_total_partition_count, level);
+
+    // take all rows of both sides of the partition
+    auto& build_mutable_block = _shared_state->partitioned_build_blocks[partition_index];
+    std::vector<vectorized::Block> build_blocks;
+    build_blocks.emplace_back(build_mutable_block->to_block());
+    build_mutable_block.reset();
+    // the recovery of the new partitions merges the spilled blocks into them
+    for (uint32_t i = first_partition; i != _total_partition_count; ++i) {
+        _shared_state->partitioned_build_blocks[i] =
+                vectorized::MutableBlock::create_unique(build_blocks[0].clone_empty());
+    }
+    auto build_stream = std::move(_shared_state->spilled_streams[partition_index]);
+
+    auto probe_blocks = std::move(_probe_blocks[partition_index]);
+    _probe_blocks.erase(partition_index);
+    auto& probe_mutable_block = _partitioned_blocks[partition_index];
+    if (probe_mutable_block && !probe_mutable_block->empty()) {
+        probe_blocks.emplace_back(probe_mutable_block->to_block());
+    }
+    probe_mutable_block.reset();
+    auto probe_stream = std::move(_probe_spilling_streams[partition_index]);
+
+    auto execution_context = state->get_task_execution_context();
+    /// Resources in shared state will be released when the operator is closed,
+    /// but there may be asynchronous spilling tasks at this time, which can lead to conflicts.
+    /// So, we need hold the pointer of shared state.
+    std::weak_ptr<PartitionedHashJoinSharedState> shared_state_holder =
+            _shared_state->shared_from_this();
+
+    auto query_id = state->query_id();
+    auto mem_tracker = state->get_query_ctx()->query_mem_tracker;
+
+    MonotonicStopWatch submit_timer;
+    submit_timer.start();
+
+    auto repartition_func = [this, query_id, mem_tracker, state, shared_state_holder,
+                             execution_context, submit_timer, level, fanout, first_partition,
+                             build_partitioner, probe_partitioner,
+                             build_blocks = std::move(build_blocks), build_stream,
+                             probe_blocks = std::move(probe_blocks), probe_stream]() mutable {
+        SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
+        std::shared_ptr<TaskExecutionContext> execution_context_lock;
+        auto shared_state_sptr = shared_state_holder.lock();
+        if (shared_state_sptr) {
+            execution_context_lock = execution_context.lock();
+        }
+        if (!shared_state_sptr || !execution_context_lock) {
+            LOG(INFO) << "query: " << print_id(query_id)
+                      << " execution_context released, maybe query was cancelled.";
+            return;
+        }
+
+        _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
+        SCOPED_TIMER(_repartition_timer);
+        Defer defer([this] { --_spilling_task_count; });
+
+        std::vector<size_t> build_rows(fanout, 0);
+        std::vector<size_t> probe_rows(fanout, 0);
+        auto st = [&]() -> Status {
+            RETURN_IF_CATCH_EXCEPTION({
+                RETURN_IF_ERROR(_repartition_rows(state, build_partitioner, level, true,
+                                                  std::move(build_blocks), build_stream,
+                                                  first_partition,
+                                                  shared_state_sptr->spilled_streams,
+                                                  &build_rows));
+                RETURN_IF_ERROR(_repartition_rows(state, probe_partitioner, level, false,
+                                                  std::move(probe_blocks), probe_stream,
+                                                  first_partition, _probe_spilling_streams,
+                                                  &probe_rows));
+            });
+            return Status::OK();
+        }();
+        for (const auto& stream : {build_stream, probe_stream}) {
+            if (stream) {
+                ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+            }
+        }
+
+        if (!st.ok()) {
+            std::unique_lock<std::mutex> lock(_spill_lock);
+            _spill_status_ok = false;
+            _spill_status = std::move(st);
+        } else {
+            // all rows share one hash, likely one key, splitting them again does not help
+            const auto total_rows = std::accumulate(build_rows.begin(), build_rows.end(), 0UL);
+            for (size_t i = 0; i != fanout; ++i) {
+                if (total_rows > 0 && build_rows[i] == total_rows) {
+                    _partition_levels[first_partition + i] = std::max<uint32_t>(
+                            level, config::spill_hash_join_max_repartition_depth);
+                }
+            }
+            COUNTER_UPDATE(_repartition_count, 1);
+            VLOG_DEBUG << "query: " << print_id(query_id) << ", node: " << _parent->node_id()
+                       << ", repartitioned " << total_rows << " build rows into partitions from "
+                       << first_partition << ", level: " << level;
+        }
+        _dependency->set_ready();
+    };
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _dependency->block();
+    ++_spilling_task_count;
+    auto st = spill_io_pool->submit_func(repartition_func);
+    if (!st.ok()) {
+        --_spilling_task_count;
+    }
+    return st;
+}
+
 PartitionedHashJoinProbeOperatorX::PartitionedHashJoinProbeOperatorX(ObjectPool* pool,
                                                                      const TPlanNode& tnode,
                                                                      int operator_id,
@@ -536,6 +843,7 @@ Status PartitionedHashJoinProbeOperatorX::init(const TPlanNode& tnode, RuntimeSt
 
     for (auto& conjunct : tnode.hash_join_node.eq_join_conjuncts) {
         _probe_exprs.emplace_back(conjunct.left);
+        _build_exprs.emplace_back(conjunct.right);
     }
 
     return Status::OK();
@@ -675,6 +983,10 @@ Status PartitionedHashJoinProbeOperatorX::_setup_internal_operators(
     if (partitioned_block && partitioned_block->rows() > 0) {
         block = partitioned_block->to_block();
         partitioned_block.reset();
+        // the next chunk of the build side is merged into it
+        if (local_state._build_chunk_pending) {
+            partitioned_block = vectorized::MutableBlock::create_unique(block.clone_empty());
+        }
     }
     RETURN_IF_ERROR(_inner_sink_operator->sink(local_state._runtime_state.get(), &block, true));
     VLOG_DEBUG << "query: " << print_id(state->query_id())
@@ -705,6 +1017,10 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
     auto& probe_blocks = local_state._probe_blocks[partition_index];
     if (local_state._need_to_setup_internal_operators) {
         *eos = false;
+        if (local_state.need_to_repartition(partition_index)) {
+            // the partition is left empty and goes through the steps below
+            return local_state.repartition(state, partition_index);
+        }
         bool has_data = false;
         RETURN_IF_ERROR(local_state.recovery_build_blocks_from_disk(
                 state, local_state._partition_cursor, has_data));
@@ -749,12 +1065,21 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
                                                 &in_mem_eos));
 
     *eos = false;
-    if (in_mem_eos) {
+    if (in_mem_eos && local_state._build_chunk_pending) {
+        // probe the next chunk of the build side with the whole probe side again
+        local_state._build_chunk_pending = false;
+        auto& probe_stream = local_state._probe_spilling_streams[partition_index];
+        probe_stream = std::move(local_state._chunked_probe_stream);
+        if (probe_stream) {
+            probe_stream->seek_for_read(0);
+        }
+        local_state._need_to_setup_internal_operators = true;
+    } else if (in_mem_eos) {
         VLOG_DEBUG << "query: " << print_id(state->query_id()) << ", node: " << node_id()
                    << ", task: " << state->task_id()
                    << ", partition: " << local_state._partition_cursor;
         local_state._partition_cursor++;
-        if (local_state._partition_cursor == _partition_count) {
+        if (local_state._partition_cursor == local_state._total_partition_count) {
             *eos = true;
         } else {
             RETURN_IF_ERROR(local_state.finish_spilling(local_state._partition_cursor));
@@ -788,7 +1113,7 @@ size_t PartitionedHashJoinProbeOperatorX::revocable_mem_size(RuntimeState* state
 
     auto& partitioned_build_blocks = local_state._shared_state->partitioned_build_blocks;
     auto& probe_blocks = local_state._probe_blocks;
-    for (uint32_t i = spilling_start; i < _partition_count; ++i) {
+    for (uint32_t i = spilling_start; i < local_state._total_partition_count; ++i) {
         auto& build_block = partitioned_build_blocks[i];
         if (build_block) {
             auto block_bytes = build_block->allocated_bytes();
@@ -818,8 +1143,9 @@ Status PartitionedHashJoinProbeOperatorX::_revoke_memory(RuntimeState* state, bo
     uint32_t spilling_start = local_state._child_eos ? local_state._partition_cursor + 1 : 0;
     DCHECK_GE(spilling_start, local_state._partition_cursor);
 
-    if (_partition_count > spilling_start) {
-        local_state._spilling_task_count = (_partition_count - spilling_start) * 2;
+    const auto partition_count = local_state._total_partition_count;
+    if (partition_count > spilling_start) {
+        local_state._spilling_task_count = (partition_count - spilling_start) * 2;
     } else {
         return Status::OK();
     }
@@ -827,7 +1153,7 @@ Status PartitionedHashJoinProbeOperatorX::_revoke_memory(RuntimeState* state, bo
     VLOG_DEBUG << "query: " << print_id(state->query_id()) << ", hash probe node: " << id()
                << ", task: " << state->task_id()
                << ", revoke memory, spill task count: " << local_state._spilling_task_count;
-    for (uint32_t i = spilling_start; i < _partition_count; ++i) {
+    for (uint32_t i = spilling_start; i < partition_count; ++i) {
         RETURN_IF_ERROR(local_state.spill_build_block(state, i));
         RETURN_IF_ERROR(local_state.spill_probe_blocks(state, i));
     }
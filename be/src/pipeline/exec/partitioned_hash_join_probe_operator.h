@@ -57,6 +57,14 @@ public:
 
     Status finish_spilling(uint32_t partition_index);
 
+    // Whether the build side of the spilled partition is too large to be reloaded at once and
+    // it can be split further.
+    bool need_to_repartition(uint32_t partition_index) const;
+
+    // Moves the rows of both sides of the partition into new partitions appended after the
+    // existing ones, by the next digits of the hash. The partition is left empty.
+    Status repartition(RuntimeState* state, uint32_t partition_index);
+
     void update_build_profile(RuntimeProfile* child_profile);
     void update_probe_profile(RuntimeProfile* child_profile);
 
@@ -66,6 +74,21 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    // In memory bytes of the build side of the partition, the spilled blocks included.
+    size_t _build_bytes(uint32_t partition_index) const;
+
+    // The partitioner of a side for the rows repartitioned to `level`, created on first use.
+    Status _get_repartitioner(RuntimeState* state, uint32_t level, bool build_side,
+                              PartitionerType** partitioner);
+
+    // Partitions the rows of `blocks` and then of `stream` by `partitioner` into the
+    // partitions starting from `first_partition`, and spills them into `streams`.
+    Status _repartition_rows(RuntimeState* state, PartitionerType* partitioner, uint32_t level,
+                             bool build_side, std::vector<vectorized::Block> blocks,
+                             const vectorized::SpillStreamSPtr& stream, uint32_t first_partition,
+                             std::vector<vectorized::SpillStreamSPtr>& streams,
+                             std::vector<size_t>* partition_rows);
+
     std::shared_ptr<BasicSharedState> _in_mem_shared_state_sptr;
     uint32_t _partition_cursor {0};
 
@@ -84,6 +107,23 @@ private:
     std::vector<vectorized::SpillStreamSPtr> _probe_spilling_streams;
 
     std::unique_ptr<PartitionerType> _partitioner;
+
+    // The partitions appended by repartitioning follow the ones of the operator.
+    uint32_t _total_partition_count {0};
+    // how many times the rows of each partition have been repartitioned
+    std::vector<uint32_t> _partition_levels;
+    // the partitioners of each repartition level and their partition counts, the partition
+    // of a row at level l is `channel id / partition count of level l - 1`
+    std::vector<std::unique_ptr<PartitionerType>> _build_repartitioners;
+    std::vector<std::unique_ptr<PartitionerType>> _probe_repartitioners;
+    std::vector<uint64_t> _repartition_counts;
+
+    // A chunk of the build side of the current partition is loaded and more remain on disk.
+    // The whole probe side is probed against every chunk, it is kept in
+    // `_chunked_probe_stream` after it has been read through and read again for the next chunk.
+    bool _build_chunk_pending {false};
+    vectorized::SpillStreamSPtr _chunked_probe_stream;
+
     std::unique_ptr<RuntimeState> _runtime_state;
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
 
@@ -104,6 +144,9 @@ private:
     RuntimeProfile::Counter* _recovery_probe_rows = nullptr;
     RuntimeProfile::Counter* _recovery_probe_blocks = nullptr;
     RuntimeProfile::Counter* _recovery_probe_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_timer = nullptr;
+    RuntimeProfile::Counter* _repartition_count = nullptr;
+    RuntimeProfile::Counter* _build_chunk_count = nullptr;
 
     RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
     RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
@@ -203,6 +246,8 @@ private:
 
     // probe expr
     std::vector<TExpr> _probe_exprs;
+    // build expr, for repartitioning the spilled build blocks
+    std::vector<TExpr> _build_exprs;
 
     const std::vector<TExpr> _distribution_partition_exprs;
 
@@ -122,6 +122,7 @@ Status ScanLocalState<Derived>::open(RuntimeState* state) {
         DCHECK(!_eos && _num_scanners->value() > 0);
         RETURN_IF_ERROR(_scanner_ctx->init());
     }
+    _capture_writer = FragmentCapture::create_writer(state, "scan", _parent->node_id(), profile());
     _opened = true;
     return status;
 }
@@ -1414,6 +1415,9 @@ Status ScanLocalState<Derived>::close(RuntimeState* state) {
         _scanner_ctx->stop_scanners(state);
     }
     std::list<std::shared_ptr<vectorized::ScannerDelegate>> {}.swap(_scanners);
+    if (_capture_writer != nullptr) {
+        _capture_writer->close();
+    }
     COUNTER_SET(_wait_for_dependency_timer, _scan_dependency->watcher_elapse_time());
     COUNTER_SET(_wait_for_rf_timer, rf_time);
 
@@ -1425,6 +1429,12 @@ Status ScanOperatorX<LocalStateType>::get_block(RuntimeState* state, vectorized:
                                                 bool* eos) {
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
+    // runs after the temporary columns below are dropped
+    Defer capture_block {[&]() {
+        if (local_state._capture_writer != nullptr) {
+            local_state._capture_writer->write(state, *block);
+        }
+    }};
     // in inverted index apply logic, in order to optimize query performance,
     // we built some temporary columns into block, these columns only used in scan node level,
     // remove them when query leave scan node to avoid other nodes use block->columns() to make a wrong decision
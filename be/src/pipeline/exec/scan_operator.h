@@ -25,6 +25,7 @@
 #include "common/status.h"
 #include "operator.h"
 #include "pipeline/dependency.h"
+#include "pipeline/fragment_capture.h"
 #include "runtime/descriptors.h"
 #include "vec/exec/scan/vscan_node.h"
 
@@ -364,6 +365,9 @@ protected:
 
     // ScanLocalState owns the ownership of scanner, scanner context only has its weakptr
     std::list<std::shared_ptr<vectorized::ScannerDelegate>> _scanners;
+
+    // the blocks returned, if the fragment is captured
+    std::unique_ptr<FragmentCaptureWriter> _capture_writer;
 };
 
 template <typename LocalStateType>
@@ -75,6 +75,18 @@ Status SetProbeSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized
     COUNTER_UPDATE(local_state.rows_input_counter(), (int64_t)in_block->rows());
 
     auto probe_rows = in_block->rows();
+    if (local_state._shared_state->is_spilled) {
+        // the rows are probed partition by partition in the source
+        RETURN_IF_ERROR(local_state._shared_state->spill_status);
+        if (probe_rows > 0) {
+            RETURN_IF_ERROR(local_state._mutable_block.merge(*in_block));
+        }
+        if (eos) {
+            return local_state._spill_child_rows(state, _cur_child_id, true);
+        }
+        return Status::OK();
+    }
+
     if (probe_rows > 0) {
         RETURN_IF_ERROR(_extract_probe_column(local_state, *in_block, local_state._probe_columns,
                                               _cur_child_id));
@@ -99,6 +111,23 @@ Status SetProbeSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized
     return Status::OK();
 }
 
+template <bool is_intersect>
+size_t SetProbeSinkOperatorX<is_intersect>::revocable_mem_size(RuntimeState* state) const {
+    auto& local_state = get_local_state(state);
+    if (!local_state._shared_state->is_spilled || !local_state._shared_state->spill_status.ok()) {
+        return 0;
+    }
+    return local_state._mutable_block.allocated_bytes();
+}
+
+template <bool is_intersect>
+Status SetProbeSinkOperatorX<is_intersect>::revoke_memory(RuntimeState* state) {
+    if (revocable_mem_size(state) == 0) {
+        return Status::OK();
+    }
+    return get_local_state(state)._spill_child_rows(state, _cur_child_id, false);
+}
+
 template <bool is_intersect>
 Status SetProbeSinkLocalState<is_intersect>::init(RuntimeState* state, LocalSinkStateInfo& info) {
     RETURN_IF_ERROR(Base::init(state, info));
@@ -170,23 +199,8 @@ Status SetProbeSinkOperatorX<is_intersect>::_extract_probe_column(
 template <bool is_intersect>
 void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
         SetProbeSinkLocalState<is_intersect>& local_state) {
-    auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
-    auto& hash_table_variants = local_state._shared_state->hash_table_variants;
-
     if (_cur_child_id != (local_state._shared_state->child_quantity - 1)) {
-        _refresh_hash_table(local_state);
-        if constexpr (is_intersect) {
-            valid_element_in_hash_tbl = 0;
-        } else {
-            std::visit(
-                    [&](auto&& arg) {
-                        using HashTableCtxType = std::decay_t<decltype(arg)>;
-                        if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
-                            valid_element_in_hash_tbl = arg.hash_table->size();
-                        }
-                    },
-                    *hash_table_variants);
-        }
+        refresh_set_hash_table<is_intersect>(local_state._shared_state);
         local_state._probe_columns.resize(
                 local_state._shared_state->child_exprs_lists[_cur_child_id + 1].size());
         local_state._shared_state->probe_finished_children_dependency[_cur_child_id + 1]
@@ -197,10 +211,9 @@ void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
 }
 
 template <bool is_intersect>
-void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
-        SetProbeSinkLocalState<is_intersect>& local_state) {
-    auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
-    auto& hash_table_variants = local_state._shared_state->hash_table_variants;
+void refresh_set_hash_table(SetSharedState* shared_state) {
+    auto& valid_element_in_hash_tbl = shared_state->valid_element_in_hash_tbl;
+    auto& hash_table_variants = shared_state->hash_table_variants;
     std::visit(
             [&](auto&& arg) {
                 using HashTableCtxType = std::decay_t<decltype(arg)>;
@@ -245,6 +258,11 @@ void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
                     if (is_intersect || is_need_shrink) {
                         arg.hash_table = std::move(tmp_hash_table);
                     }
+                    if constexpr (is_intersect) {
+                        valid_element_in_hash_tbl = 0;
+                    } else {
+                        valid_element_in_hash_tbl = arg.hash_table->size();
+                    }
                 } else {
                     LOG(FATAL) << "FATAL: uninited hash table";
                     __builtin_unreachable();
@@ -257,5 +275,7 @@ template class SetProbeSinkLocalState<true>;
 template class SetProbeSinkLocalState<false>;
 template class SetProbeSinkOperatorX<true>;
 template class SetProbeSinkOperatorX<false>;
+template void refresh_set_hash_table<true>(SetSharedState* shared_state);
+template void refresh_set_hash_table<false>(SetSharedState* shared_state);
 
 } // namespace doris::pipeline
@@ -21,6 +21,7 @@
 
 #include "common/status.h"
 #include "operator.h"
+#include "pipeline/exec/set_sink_operator.h"
 
 namespace doris {
 class RuntimeState;
@@ -37,10 +38,10 @@ template <bool is_intersect>
 class SetProbeSinkOperatorX;
 
 template <bool is_intersect>
-class SetProbeSinkLocalState final : public PipelineXSinkLocalState<SetSharedState> {
+class SetProbeSinkLocalState final : public SetSpillSinkLocalState {
 public:
     ENABLE_FACTORY_CREATOR(SetProbeSinkLocalState);
-    using Base = PipelineXSinkLocalState<SetSharedState>;
+    using Base = SetSpillSinkLocalState;
     using Parent = SetProbeSinkOperatorX<is_intersect>;
 
     SetProbeSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state)
@@ -93,6 +94,12 @@ public:
     Status open(RuntimeState* state) override;
 
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos) override;
+
+    // The probe side is spilled only if the build side has been spilled.
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state) override;
+
     DataDistribution required_data_distribution() const override {
         return _is_colocate ? DataDistribution(ExchangeType::BUCKET_HASH_SHUFFLE, _partition_exprs)
                             : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
@@ -105,7 +112,6 @@ private:
     Status _extract_probe_column(SetProbeSinkLocalState<is_intersect>& local_state,
                                  vectorized::Block& block, vectorized::ColumnRawPtrs& raw_ptrs,
                                  int child_id);
-    void _refresh_hash_table(SetProbeSinkLocalState<is_intersect>& local_state);
     const int _cur_child_id;
     // every child has its result expr list
     vectorized::VExprContextSPtrs _child_exprs;
@@ -114,5 +120,11 @@ private:
     using OperatorBase::_child_x;
 };
 
+// Rebuilds the hash table after a child is probed: only the visited keys are kept for
+// intersect, the visited keys are removed for except if the table should be shrunk. The
+// count of the valid elements is reset for the next child.
+template <bool is_intersect>
+void refresh_set_hash_table(SetSharedState* shared_state);
+
 } // namespace pipeline
 } // namespace doris
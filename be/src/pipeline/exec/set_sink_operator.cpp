@@ -17,14 +17,140 @@
 
 #include "set_sink_operator.h"
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 
+#include "common/config.h"
+#include "common/exception.h"
 #include "pipeline/exec/operator.h"
+#include "runtime/exec_env.h"
 #include "vec/common/hash_table/hash_table_set_build.h"
 #include "vec/core/materialize_block.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 
+Status SetSpillSinkLocalState::close(RuntimeState* state, Status exec_status) {
+    if (_closed) {
+        return Status::OK();
+    }
+    dec_running_big_mem_op_num(state);
+    return Base::close(state, exec_status);
+}
+
+Status SetSpillSinkLocalState::_spill_child_rows(RuntimeState* state, int child_id, bool eos) {
+    auto& shared_state = *_shared_state;
+    RETURN_IF_ERROR(shared_state.spill_status);
+    if (!shared_state.is_spilled) {
+        shared_state.is_spilled = true;
+        shared_state.spill_partition_count =
+                std::max(config::set_operation_spill_partition_count, 1);
+        shared_state.spilled_streams.resize(
+                shared_state.child_quantity,
+                std::vector<vectorized::SpillStreamSPtr>(shared_state.spill_partition_count));
+    }
+    profile()->add_info_string("Spilled", "true");
+
+    auto block = _mutable_block.to_block();
+    _mutable_block.clear();
+    if (block.rows() == 0 && !eos) {
+        return Status::OK();
+    }
+    VLOG_DEBUG << "query " << print_id(state->query_id()) << " set node " << _parent->node_id()
+               << " child " << child_id << " spill rows: " << block.rows() << ", eos: " << eos;
+
+    auto execution_context = state->get_task_execution_context();
+    /// Resources in shared state will be released when the operator is closed,
+    /// but there may be asynchronous spilling tasks at this time, which can lead to conflicts.
+    /// So, we need hold the pointer of shared state.
+    std::weak_ptr<SetSharedState> shared_state_holder = _shared_state->shared_from_this();
+
+    auto query_id = state->query_id();
+    auto mem_tracker = state->get_query_ctx()->query_mem_tracker;
+
+    MonotonicStopWatch submit_timer;
+    submit_timer.start();
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _dependency->block();
+    auto status = spill_io_pool->submit_func([this, state, query_id, mem_tracker,
+                                              shared_state_holder, execution_context, submit_timer,
+                                              child_id, eos, block = std::move(block)]() mutable {
+        SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
+        std::shared_ptr<TaskExecutionContext> execution_context_lock;
+        auto shared_state_sptr = shared_state_holder.lock();
+        if (shared_state_sptr) {
+            execution_context_lock = execution_context.lock();
+        }
+        if (!shared_state_sptr || !execution_context_lock) {
+            LOG(INFO) << "query " << print_id(query_id)
+                      << " execution_context released, maybe query was cancelled.";
+            return;
+        }
+
+        _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
+        SCOPED_TIMER(Base::_spill_timer);
+        auto st = [&]() -> Status {
+            if (block.rows() > 0) {
+                RETURN_IF_CATCH_EXCEPTION({
+                    vectorized::Block key_block;
+                    RETURN_IF_ERROR(
+                            shared_state_sptr->get_spill_key_block(child_id, &block, &key_block));
+                    block.clear();
+                    RETURN_IF_ERROR(shared_state_sptr->spill_key_block(
+                            state, child_id, key_block,
+                            [&](vectorized::SpillStreamSPtr& spill_stream) {
+                                return _create_spill_stream(state, spill_stream);
+                            }));
+                });
+            }
+            if (eos) {
+                for (auto& spill_stream : shared_state_sptr->spilled_streams[child_id]) {
+                    if (spill_stream) {
+                        RETURN_IF_ERROR(spill_stream->spill_eof());
+                    }
+                }
+            }
+            return Status::OK();
+        }();
+        if (!st.ok()) {
+            LOG(WARNING) << "query " << print_id(query_id) << " set node " << _parent->node_id()
+                         << " child " << child_id << " spill error: " << st;
+            shared_state_sptr->spill_status = std::move(st);
+        }
+        // the error is reported by the next child or the source
+        if (eos) {
+            _finish_child(child_id);
+        }
+        _dependency->set_ready();
+    });
+    if (!status.ok()) {
+        _dependency->set_ready();
+    }
+    return status;
+}
+
+Status SetSpillSinkLocalState::_create_spill_stream(RuntimeState* state,
+                                                    vectorized::SpillStreamSPtr& spill_stream) {
+    RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            state, spill_stream, print_id(state->query_id()), "set_operation", _parent->id(),
+            std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(), profile()));
+    RETURN_IF_ERROR(spill_stream->prepare_spill());
+    spill_stream->set_write_counters(Base::_spill_serialize_block_timer, Base::_spill_block_count,
+                                     Base::_spill_data_size, Base::_spill_write_disk_timer,
+                                     Base::_spill_write_wait_io_timer);
+    return Status::OK();
+}
+
+void SetSpillSinkLocalState::_finish_child(int child_id) {
+    if (child_id + 1 < _shared_state->child_quantity) {
+        _shared_state->probe_finished_children_dependency[child_id + 1]->set_ready();
+    } else {
+        _dependency->set_ready_to_read();
+    }
+}
+
 template <bool is_intersect>
 Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Block* in_block,
                                             bool eos) {
@@ -38,6 +164,9 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
     auto& build_block = local_state._shared_state->build_block;
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
 
+    if (_enable_spill) {
+        local_state.inc_running_big_mem_op_num(state);
+    }
     if (in_block->rows() != 0) {
         RETURN_IF_ERROR(local_state._mutable_block.merge(*in_block));
 
@@ -47,6 +176,14 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
         }
     }
 
+    if (local_state._shared_state->is_spilled) {
+        // the hash table is built partition by partition in the source
+        if (eos) {
+            return local_state._spill_child_rows(state, _cur_child_id, true);
+        }
+        return Status::OK();
+    }
+
     if (eos || local_state._mutable_block.allocated_bytes() >= BUILD_BLOCK_MAX_SIZE) {
         build_block = local_state._mutable_block.to_block();
         RETURN_IF_ERROR(_process_build_block(local_state, build_block, state));
@@ -75,6 +212,28 @@ Status SetSinkOperatorX<is_intersect>::sink(RuntimeState* state, vectorized::Blo
     return Status::OK();
 }
 
+template <bool is_intersect>
+size_t SetSinkOperatorX<is_intersect>::revocable_mem_size(RuntimeState* state) const {
+    if (!_enable_spill) {
+        return 0;
+    }
+    auto& local_state = get_local_state(state);
+    // the rows in the hash table can not be spilled
+    if (!local_state._shared_state->spill_status.ok() ||
+        local_state._shared_state->build_block.rows() > 0) {
+        return 0;
+    }
+    return local_state._mutable_block.allocated_bytes();
+}
+
+template <bool is_intersect>
+Status SetSinkOperatorX<is_intersect>::revoke_memory(RuntimeState* state) {
+    if (revocable_mem_size(state) == 0) {
+        return Status::OK();
+    }
+    return get_local_state(state)._spill_child_rows(state, _cur_child_id, false);
+}
+
 template <bool is_intersect>
 Status SetSinkOperatorX<is_intersect>::_process_build_block(
         SetSinkLocalState<is_intersect>& local_state, vectorized::Block& block,
@@ -130,7 +289,7 @@ Status SetSinkOperatorX<is_intersect>::_extract_build_column(
 
 template <bool is_intersect>
 Status SetSinkLocalState<is_intersect>::init(RuntimeState* state, LocalSinkStateInfo& info) {
-    RETURN_IF_ERROR(PipelineXSinkLocalState<SetSharedState>::init(state, info));
+    RETURN_IF_ERROR(Base::init(state, info));
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _build_timer = ADD_TIMER(_profile, "BuildTime");
@@ -155,7 +314,7 @@ template <bool is_intersect>
 Status SetSinkLocalState<is_intersect>::open(RuntimeState* state) {
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_open_timer);
-    RETURN_IF_ERROR(PipelineXSinkLocalState<SetSharedState>::open(state));
+    RETURN_IF_ERROR(Base::open(state));
 
     auto& parent = _parent->cast<Parent>();
     DCHECK(parent._cur_child_id == 0);
@@ -189,6 +348,7 @@ Status SetSinkOperatorX<is_intersect>::init(const TPlanNode& tnode, RuntimeState
 
     const auto& texpr = (*result_texpr_lists)[_cur_child_id];
     RETURN_IF_ERROR(vectorized::VExpr::create_expr_trees(texpr, _child_exprs));
+    _enable_spill = state->enable_force_spill() || config::enable_set_operation_spill;
 
     return Status::OK();
 }
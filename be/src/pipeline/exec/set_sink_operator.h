@@ -34,11 +34,34 @@ namespace pipeline {
 template <bool is_intersect>
 class SetSinkOperatorX;
 
+// The spill shared by the sinks of all children of a set operation, see SetSharedState.
+class SetSpillSinkLocalState : public PipelineXSpillSinkLocalState<SetSharedState> {
+public:
+    using Base = PipelineXSpillSinkLocalState<SetSharedState>;
+
+    SetSpillSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state)
+            : Base(parent, state) {}
+
+    Status close(RuntimeState* state, Status exec_status) override;
+
+protected:
+    // Spills the rows of `_mutable_block` of child `child_id` asynchronously, the set
+    // operation turns to the spilled mode on the first call. When `eos`, the streams of the
+    // child are closed and the next child (or the source) is woken up.
+    Status _spill_child_rows(RuntimeState* state, int child_id, bool eos);
+
+    vectorized::MutableBlock _mutable_block;
+
+private:
+    Status _create_spill_stream(RuntimeState* state, vectorized::SpillStreamSPtr& spill_stream);
+    void _finish_child(int child_id);
+};
+
 template <bool is_intersect>
-class SetSinkLocalState final : public PipelineXSinkLocalState<SetSharedState> {
+class SetSinkLocalState final : public SetSpillSinkLocalState {
 public:
     ENABLE_FACTORY_CREATOR(SetSinkLocalState);
-    using Base = PipelineXSinkLocalState<SetSharedState>;
+    using Base = SetSpillSinkLocalState;
     using Parent = SetSinkOperatorX<is_intersect>;
 
     SetSinkLocalState(DataSinkOperatorXBase* parent, RuntimeState* state) : Base(parent, state) {}
@@ -52,7 +75,6 @@ private:
     friend struct vectorized::HashTableBuild;
 
     RuntimeProfile::Counter* _build_timer; // time to build hash table
-    vectorized::MutableBlock _mutable_block;
     // every child has its result expr list
     vectorized::VExprContextSPtrs _child_exprs;
     vectorized::Arena _arena;
@@ -91,6 +113,11 @@ public:
     Status open(RuntimeState* state) override;
 
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos) override;
+
+    size_t revocable_mem_size(RuntimeState* state) const override;
+
+    Status revoke_memory(RuntimeState* state) override;
+
     DataDistribution required_data_distribution() const override {
         return _is_colocate ? DataDistribution(ExchangeType::BUCKET_HASH_SHUFFLE, _partition_exprs)
                             : DataDistribution(ExchangeType::HASH_SHUFFLE, _partition_exprs);
@@ -111,6 +138,7 @@ private:
     vectorized::VExprContextSPtrs _child_exprs;
     const bool _is_colocate;
     const std::vector<TExpr> _partition_exprs;
+    bool _enable_spill = false;
     using OperatorBase::_child_x;
 };
 
@@ -17,10 +17,18 @@
 
 #include "set_source_operator.h"
 
+#include <limits>
 #include <memory>
 
+#include "common/exception.h"
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/set_probe_sink_operator.h"
+#include "runtime/exec_env.h"
+#include "util/defer_op.h"
+#include "vec/common/hash_table/hash_table_set_build.h"
+#include "vec/common/hash_table/hash_table_set_probe.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 
@@ -62,12 +70,190 @@ Status SetSourceLocalState<is_intersect>::open(RuntimeState* state) {
     return Status::OK();
 }
 
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::close(RuntimeState* state) {
+    if (_closed) {
+        return Status::OK();
+    }
+    _shared_state->close();
+    return Base::close(state);
+}
+
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::_recover_spilled_partition(RuntimeState* state) {
+    _need_to_recover = false;
+    VLOG_DEBUG << "query " << print_id(state->query_id()) << " set node " << _parent->node_id()
+               << " recover partition " << _partition_cursor;
+
+    auto execution_context = state->get_task_execution_context();
+    /// Resources in shared state will be released when the operator is closed,
+    /// but there may be asynchronous spilling tasks at this time, which can lead to conflicts.
+    /// So, we need hold the pointer of shared state.
+    std::weak_ptr<SetSharedState> shared_state_holder = _shared_state->shared_from_this();
+
+    auto query_id = state->query_id();
+    auto mem_tracker = state->get_query_ctx()->query_mem_tracker;
+
+    MonotonicStopWatch submit_timer;
+    submit_timer.start();
+
+    auto* spill_io_pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    _dependency->block();
+    auto status = spill_io_pool->submit_func([this, state, query_id, mem_tracker,
+                                              shared_state_holder, execution_context,
+                                              submit_timer, partition = _partition_cursor] {
+        SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
+        std::shared_ptr<TaskExecutionContext> execution_context_lock;
+        auto shared_state_sptr = shared_state_holder.lock();
+        if (shared_state_sptr) {
+            execution_context_lock = execution_context.lock();
+        }
+        if (!shared_state_sptr || !execution_context_lock) {
+            LOG(INFO) << "query " << print_id(query_id)
+                      << " execution_context released, maybe query was cancelled.";
+            return;
+        }
+
+        _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
+        SCOPED_TIMER(_spill_recover_time);
+        auto st = [&]() -> Status {
+            RETURN_IF_CATCH_EXCEPTION(
+                    { RETURN_IF_ERROR(_build_and_probe_partition(state, partition)); });
+            return Status::OK();
+        }();
+        if (!st.ok()) {
+            LOG(WARNING) << "query " << print_id(query_id) << " set node " << _parent->node_id()
+                         << " recover partition " << partition << " error: " << st;
+            shared_state_sptr->spill_status = std::move(st);
+        }
+        _dependency->set_ready();
+    });
+    if (!status.ok()) {
+        _dependency->set_ready();
+    }
+    return status;
+}
+
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::_build_and_probe_partition(RuntimeState* state,
+                                                                     size_t partition) {
+    auto& shared_state = *_shared_state;
+    shared_state.hash_table_variants = std::make_unique<vectorized::SetHashTableVariants>();
+    shared_state.hash_table_init();
+    _arena = std::make_unique<vectorized::Arena>();
+
+    vectorized::MutableBlock build_block;
+    RETURN_IF_ERROR(_read_spilled_stream(
+            shared_state.spilled_streams[0][partition],
+            [&](vectorized::Block& block) { return build_block.merge(std::move(block)); }));
+    shared_state.build_block = build_block.to_block();
+    const auto rows = shared_state.build_block.rows();
+    if (rows > std::numeric_limits<uint32_t>::max()) {
+        return Status::NotSupported(
+                "set operator do not support build table rows over:" +
+                std::to_string(std::numeric_limits<uint32_t>::max()));
+    }
+    // the spilled block holds the key columns only
+    shared_state.build_col_idx.clear();
+    vectorized::ColumnRawPtrs raw_ptrs(shared_state.build_block.columns());
+    for (int i = 0; i < shared_state.build_block.columns(); ++i) {
+        shared_state.build_col_idx.insert({i, i});
+        raw_ptrs[i] = shared_state.build_block.get_by_position(i).column.get();
+    }
+
+    RETURN_IF_ERROR(std::visit(
+            [&](auto&& arg) -> Status {
+                using HashTableCtxType = std::decay_t<decltype(arg)>;
+                if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
+                    if (rows > 0) {
+                        vectorized::HashTableBuild<HashTableCtxType, is_intersect>
+                                hash_table_build_process(this, rows, raw_ptrs, state);
+                        RETURN_IF_ERROR(hash_table_build_process(arg, *_arena));
+                    }
+                    shared_state.valid_element_in_hash_tbl =
+                            is_intersect ? 0 : arg.hash_table->size();
+                    return Status::OK();
+                } else {
+                    LOG(FATAL) << "FATAL: uninited hash table";
+                    __builtin_unreachable();
+                }
+            },
+            *shared_state.hash_table_variants));
+
+    for (int child_id = 1; child_id < shared_state.child_quantity; ++child_id) {
+        auto& spill_stream = shared_state.spilled_streams[child_id][partition];
+        if (rows == 0) {
+            // nothing to output from this partition
+            RETURN_IF_ERROR(_read_spilled_stream(spill_stream, nullptr));
+            continue;
+        }
+        RETURN_IF_ERROR(
+                _read_spilled_stream(spill_stream, [&](vectorized::Block& block) -> Status {
+                    _probe_columns.resize(block.columns());
+                    for (int i = 0; i < block.columns(); ++i) {
+                        _probe_columns[i] = block.get_by_position(i).column.get();
+                    }
+                    return std::visit(
+                            [&](auto&& arg) -> Status {
+                                using HashTableCtxType = std::decay_t<decltype(arg)>;
+                                if constexpr (!std::is_same_v<HashTableCtxType,
+                                                              std::monostate>) {
+                                    vectorized::HashTableProbe<HashTableCtxType, is_intersect>
+                                            process_hashtable_ctx(this, block.rows());
+                                    return process_hashtable_ctx.mark_data_in_hashtable(arg);
+                                } else {
+                                    LOG(FATAL) << "FATAL: uninited hash table";
+                                    __builtin_unreachable();
+                                }
+                            },
+                            *shared_state.hash_table_variants);
+                }));
+        if (child_id != shared_state.child_quantity - 1) {
+            refresh_set_hash_table<is_intersect>(&shared_state);
+        }
+    }
+    return Status::OK();
+}
+
+template <bool is_intersect>
+Status SetSourceLocalState<is_intersect>::_read_spilled_stream(
+        vectorized::SpillStreamSPtr& spill_stream,
+        const std::function<Status(vectorized::Block&)>& callback) {
+    if (!spill_stream) {
+        return Status::OK();
+    }
+    Defer defer {[&]() {
+        (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spill_stream);
+        spill_stream.reset();
+    }};
+    if (!callback) {
+        return Status::OK();
+    }
+    spill_stream->set_read_counters(_spill_read_data_time, _spill_deserialize_time,
+                                    _spill_read_bytes, _spill_read_wait_io_timer);
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        RETURN_IF_ERROR(spill_stream->read_next_block_sync(&block, &eos));
+        if (block.rows() > 0) {
+            RETURN_IF_ERROR(callback(block));
+        }
+    }
+    return Status::OK();
+}
+
 template <bool is_intersect>
 Status SetSourceOperatorX<is_intersect>::get_block(RuntimeState* state, vectorized::Block* block,
                                                    bool* eos) {
     RETURN_IF_CANCELLED(state);
     auto& local_state = get_local_state(state);
     SCOPED_TIMER(local_state.exec_time_counter());
+    auto& shared_state = *local_state._shared_state;
+    RETURN_IF_ERROR(shared_state.spill_status);
+    if (shared_state.is_spilled && local_state._need_to_recover) {
+        *eos = false;
+        return local_state._recover_spilled_partition(state);
+    }
     _create_mutable_cols(local_state, block);
     auto st = std::visit(
             [&](auto&& arg) -> Status {
@@ -82,6 +268,11 @@ Status SetSourceOperatorX<is_intersect>::get_block(RuntimeState* state, vectoriz
             },
             *local_state._shared_state->hash_table_variants);
     RETURN_IF_ERROR(st);
+    if (shared_state.is_spilled && *eos &&
+        ++local_state._partition_cursor < shared_state.spill_partition_count) {
+        *eos = false;
+        local_state._need_to_recover = true;
+    }
     RETURN_IF_ERROR(vectorized::VExprContext::filter_block(local_state._conjuncts, block,
                                                            block->columns()));
     local_state.reached_limit(block, eos);
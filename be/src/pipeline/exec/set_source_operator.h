@@ -19,33 +19,59 @@
 
 #include <stdint.h>
 
+#include <functional>
+
 #include "common/status.h"
 #include "operator.h"
 
 namespace doris {
 class RuntimeState;
 
+namespace vectorized {
+template <class HashTableContext, bool is_intersected>
+struct HashTableProbe;
+} // namespace vectorized
+
 namespace pipeline {
 
 template <bool is_intersect>
 class SetSourceOperatorX;
 
 template <bool is_intersect>
-class SetSourceLocalState final : public PipelineXLocalState<SetSharedState> {
+class SetSourceLocalState final : public PipelineXSpillLocalState<SetSharedState> {
 public:
     ENABLE_FACTORY_CREATOR(SetSourceLocalState);
-    using Base = PipelineXLocalState<SetSharedState>;
+    using Base = PipelineXSpillLocalState<SetSharedState>;
     using Parent = SetSourceOperatorX<is_intersect>;
     SetSourceLocalState(RuntimeState* state, OperatorXBase* parent) : Base(state, parent) {};
     Status init(RuntimeState* state, LocalStateInfo& infos) override;
     Status open(RuntimeState* state) override;
+    Status close(RuntimeState* state) override;
+    int64_t* valid_element_in_hash_tbl() { return &_shared_state->valid_element_in_hash_tbl; }
 
 private:
     friend class SetSourceOperatorX<is_intersect>;
     friend class OperatorX<SetSourceLocalState<is_intersect>>;
+    template <class HashTableContext, bool is_intersected>
+    friend struct vectorized::HashTableProbe;
+
+    // Builds the hash table of the partition `_partition_cursor` from the spilled rows of
+    // the first child and probes it with the other children asynchronously.
+    Status _recover_spilled_partition(RuntimeState* state);
+    Status _build_and_probe_partition(RuntimeState* state, size_t partition);
+    // Calls `callback` with the blocks of `spill_stream`, which is deleted after read.
+    Status _read_spilled_stream(vectorized::SpillStreamSPtr& spill_stream,
+                                const std::function<Status(vectorized::Block&)>& callback);
+
     std::vector<vectorized::MutableColumnPtr> _mutable_cols;
     //record build column type
     vectorized::DataTypes _left_table_data_types;
+
+    /// spill
+    bool _need_to_recover = true;
+    size_t _partition_cursor = 0;
+    std::unique_ptr<vectorized::Arena> _arena;
+    vectorized::ColumnRawPtrs _probe_columns;
 };
 
 template <bool is_intersect>
@@ -156,6 +156,8 @@ Status SortSinkOperatorX::sink(doris::RuntimeState* state, vectorized::Block* in
         COUNTER_UPDATE(local_state._sort_blocks_memory_usage, (int64_t)in_block->bytes());
         RETURN_IF_ERROR(local_state._shared_state->sorter->append_block(in_block));
         local_state._mem_tracker->set_consumption(local_state._shared_state->sorter->data_size());
+        local_state._mem_sites.set_consumption(MemSite::SORT,
+                                               local_state._shared_state->sorter->data_size());
         RETURN_IF_CANCELLED(state);
 
         if (_use_topn_opt) {
@@ -19,10 +19,12 @@
 
 #include <gen_cpp/Metrics_types.h>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 
 namespace doris {
@@ -112,6 +114,8 @@ Status StreamingAggLocalState::init(RuntimeState* state, LocalStateInfo& info) {
     _serialize_result_timer = ADD_TIMER(profile(), "SerializeResultTime");
     _hash_table_iterate_timer = ADD_TIMER(profile(), "HashTableIterateTime");
     _insert_keys_to_column_timer = ADD_TIMER(profile(), "InsertKeysToColumnTime");
+    _passthrough_switch_counter = ADD_COUNTER(profile(), "SwitchToPassthroughCount", TUnit::UNIT);
+    _aggregation_switch_counter = ADD_COUNTER(profile(), "SwitchToAggregationCount", TUnit::UNIT);
 
     return Status::OK();
 }
@@ -361,6 +365,7 @@ Status StreamingAggLocalState::_merge_without_key(vectorized::Block* block) {
 void StreamingAggLocalState::_update_memusage_without_key() {
     auto arena_memory_usage = _agg_arena_pool->size() - _mem_usage_record.used_in_arena;
     Base::_mem_tracker->consume(arena_memory_usage);
+    Base::_mem_sites.consume(MemSite::ARENA, arena_memory_usage);
     _serialize_key_arena_memory_usage->add(arena_memory_usage);
     _mem_usage_record.used_in_arena = _agg_arena_pool->size();
 }
@@ -387,6 +392,10 @@ void StreamingAggLocalState::_update_memusage_with_serialized_key() {
                         Base::_mem_tracker->consume(arena_memory_usage);
                         Base::_mem_tracker->consume(data.get_buffer_size_in_bytes() -
                                                     _mem_usage_record.used_in_state);
+                        Base::_mem_sites.consume(MemSite::ARENA, arena_memory_usage);
+                        Base::_mem_sites.consume(MemSite::HASH_TABLE,
+                                                 data.get_buffer_size_in_bytes() -
+                                                         _mem_usage_record.used_in_state);
                         _serialize_key_arena_memory_usage->add(arena_memory_usage);
                         COUNTER_UPDATE(
                                 _hash_table_memory_usage,
@@ -585,6 +594,71 @@ bool StreamingAggLocalState::_should_expand_preagg_hash_tables() {
             _agg_data->method_variant);
 }
 
+double StreamingAggLocalState::_current_min_reduction() {
+    return std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> double {
+                        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                        return 0;
+                    },
+                    [&](auto& agg_method) -> double {
+                        auto ht_mem = agg_method.hash_table->get_buffer_size_in_bytes();
+                        int cache_level = 0;
+                        while (cache_level + 1 < STREAMING_HT_MIN_REDUCTION_SIZE &&
+                               ht_mem >= STREAMING_HT_MIN_REDUCTION[cache_level + 1].min_ht_mem) {
+                            ++cache_level;
+                        }
+                        return STREAMING_HT_MIN_REDUCTION[cache_level].streaming_ht_min_reduction;
+                    }},
+            _agg_data->method_variant);
+}
+
+void StreamingAggLocalState::_update_reduction_window(size_t rows) {
+    const auto window_rows = config::streaming_agg_reduction_window_rows;
+    if (window_rows <= 0) {
+        return;
+    }
+    _window_rows += rows;
+    if (_window_rows < window_rows) {
+        return;
+    }
+    size_t groups = _get_hash_table_size();
+    size_t new_groups = groups - std::min(groups, _window_start_groups);
+    double reduction = static_cast<double>(_window_rows) / std::max<size_t>(new_groups, 1);
+    _window_rows = 0;
+    _window_start_groups = groups;
+    // the hash table in the L2 cache is always cheap to aggregate into
+    double min_reduction = _current_min_reduction();
+    if (min_reduction > 0 && reduction < min_reduction) {
+        _adaptive_passthrough = true;
+        COUNTER_UPDATE(_passthrough_switch_counter, 1);
+    }
+}
+
+bool StreamingAggLocalState::_block_reduces(const vectorized::ColumnRawPtrs& key_columns,
+                                            size_t rows) {
+    if (rows == 0) {
+        return false;
+    }
+    size_t distinct = std::visit(
+            vectorized::Overload {
+                    [&](std::monostate& arg) -> size_t {
+                        throw doris::Exception(ErrorCode::INTERNAL_ERROR, "uninited hash table");
+                        return 0;
+                    },
+                    [&](auto& agg_method) -> size_t {
+                        SCOPED_TIMER(_hash_table_compute_timer);
+                        agg_method.init_serialized_keys(key_columns, rows);
+                        std::vector<size_t> hashes(agg_method.hash_values.begin(),
+                                                   agg_method.hash_values.begin() + rows);
+                        std::sort(hashes.begin(), hashes.end());
+                        return std::unique(hashes.begin(), hashes.end()) - hashes.begin();
+                    }},
+            _agg_data->method_variant);
+    // the reduction within one block underestimates the reduction of a window
+    return static_cast<double>(rows) / distinct >= std::max(_current_min_reduction(), 1.1);
+}
+
 size_t StreamingAggLocalState::_memory_usage() const {
     size_t usage = 0;
     if (_agg_arena_pool) {
@@ -638,6 +712,20 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
     // to avoid wasting memory.
     // But for fixed hash map, it never need to expand
     bool ret_flag = false;
+    if (_adaptive_passthrough) {
+        // probe one block per window whether the input starts to cluster, e.g. sorted input
+        _window_rows += rows;
+        if (_window_rows >= config::streaming_agg_reduction_window_rows) {
+            _window_rows = 0;
+            if (_block_reduces(key_columns, rows)) {
+                _adaptive_passthrough = false;
+                // the hash table may grow again
+                _should_expand_hash_table = true;
+                _window_start_groups = _get_hash_table_size();
+                COUNTER_UPDATE(_aggregation_switch_counter, 1);
+            }
+        }
+    }
     const auto spill_streaming_agg_mem_limit =
             _parent->cast<StreamingAggOperatorX>()._spill_streaming_agg_mem_limit;
     const bool used_too_much_memory =
@@ -653,8 +741,9 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                         /// If too much memory is used during the pre-aggregation stage,
                         /// it is better to output the data directly without performing further aggregation.
                         // do not try to do agg, just init and serialize directly return the out_block
-                        if (used_too_much_memory || (hash_tbl.add_elem_size_overflow(rows) &&
-                                                     !_should_expand_preagg_hash_tables())) {
+                        if (used_too_much_memory || _adaptive_passthrough ||
+                            (hash_tbl.add_elem_size_overflow(rows) &&
+                             !_should_expand_preagg_hash_tables())) {
                             SCOPED_TIMER(_streaming_agg_timer);
                             ret_flag = true;
 
@@ -683,6 +772,9 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                                 data_types.emplace_back(data_type);
                             }
 
+                            // the states serialized here are temporary, free their memory
+                            // after each block instead of growing the arena
+                            auto arena_checkpoint = _agg_arena_pool->checkpoint();
                             for (int i = 0; i != _aggregate_evaluators.size(); ++i) {
                                 SCOPED_TIMER(_serialize_data_timer);
                                 RETURN_IF_ERROR(
@@ -690,6 +782,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                                                 in_block, value_columns[i], rows,
                                                 _agg_arena_pool.get()));
                             }
+                            _agg_arena_pool->rewind(arena_checkpoint);
 
                             if (!mem_reuse) {
                                 vectorized::ColumnsWithTypeAndName columns_with_schema;
@@ -724,6 +817,7 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                     in_block, p._offsets_of_aggregate_states[i], _places.data(),
                     _agg_arena_pool.get(), _should_expand_hash_table));
         }
+        _update_reduction_window(rows);
     }
 
     return Status::OK();
@@ -1202,31 +1296,9 @@ Status StreamingAggOperatorX::prepare(RuntimeState* state) {
                 state, _child_x->row_desc(), intermediate_slot_desc, output_slot_desc));
     }
 
-    _offsets_of_aggregate_states.resize(_aggregate_evaluators.size());
-
-    for (size_t i = 0; i < _aggregate_evaluators.size(); ++i) {
-        _offsets_of_aggregate_states[i] = _total_size_of_aggregate_states;
-
-        const auto& agg_function = _aggregate_evaluators[i]->function();
-        // aggreate states are aligned based on maximum requirement
-        _align_aggregate_states = std::max(_align_aggregate_states, agg_function->align_of_data());
-        _total_size_of_aggregate_states += agg_function->size_of_data();
-
-        // If not the last aggregate_state, we need pad it so that next aggregate_state will be aligned.
-        if (i + 1 < _aggregate_evaluators.size()) {
-            size_t alignment_of_next_state =
-                    _aggregate_evaluators[i + 1]->function()->align_of_data();
-            if ((alignment_of_next_state & (alignment_of_next_state - 1)) != 0) {
-                return Status::RuntimeError("Logical error: align_of_data is not 2^N");
-            }
-
-            /// Extend total_size to next alignment requirement
-            /// Add padding by rounding up 'total_size_of_aggregate_states' to be a multiplier of alignment_of_next_state.
-            _total_size_of_aggregate_states =
-                    (_total_size_of_aggregate_states + alignment_of_next_state - 1) /
-                    alignment_of_next_state * alignment_of_next_state;
-        }
-    }
+    RETURN_IF_ERROR(vectorized::AggFnEvaluator::calc_state_layout(
+            _aggregate_evaluators, &_offsets_of_aggregate_states,
+            &_total_size_of_aggregate_states, &_align_aggregate_states));
     // check output type
     if (_needs_finalize) {
         RETURN_IF_ERROR(vectorized::AggFnEvaluator::check_agg_fn_output(
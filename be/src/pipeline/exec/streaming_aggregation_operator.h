@@ -56,6 +56,14 @@ private:
     Status _pre_agg_with_serialized_key(doris::vectorized::Block* in_block,
                                         doris::vectorized::Block* out_block);
     bool _should_expand_preagg_hash_tables();
+    // The minimum reduction factor to keep aggregating with the current hash table size.
+    double _current_min_reduction();
+    // Updates the reduction of the current window after aggregating `rows` rows, switches to
+    // passing the rows through if the window does not reduce the input enough.
+    void _update_reduction_window(size_t rows);
+    // Whether the distinct keys of a passed through block show enough reduction to aggregate
+    // again.
+    bool _block_reduces(const vectorized::ColumnRawPtrs& key_columns, size_t rows);
     void _make_nullable_output_key(vectorized::Block* block);
     Status _execute_without_key(vectorized::Block* block);
     Status _merge_without_key(vectorized::Block* block);
@@ -107,6 +115,13 @@ private:
 
     bool _should_expand_hash_table = true;
     int64_t _cur_num_rows_returned = 0;
+    // Passing the rows through because the last window of `streaming_agg_reduction_window_rows`
+    // rows did not reduce. The groups and the rows of the current window.
+    bool _adaptive_passthrough = false;
+    size_t _window_start_groups = 0;
+    size_t _window_rows = 0;
+    RuntimeProfile::Counter* _passthrough_switch_counter = nullptr;
+    RuntimeProfile::Counter* _aggregation_switch_counter = nullptr;
     std::unique_ptr<vectorized::Arena> _agg_arena_pool = nullptr;
     vectorized::AggregatedDataVariantsUPtr _agg_data = nullptr;
     std::vector<vectorized::AggFnEvaluator*> _aggregate_evaluators;
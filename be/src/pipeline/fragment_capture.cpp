@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "pipeline/fragment_capture.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/PaloInternalService_types.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "common/config.h"
+#include "io/fs/file_reader.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "runtime/exec_env.h"
+#include "runtime/runtime_state.h"
+#include "util/thrift_util.h"
+#include "util/uid_util.h"
+#include "vec/core/block.h"
+#include "vec/spill/spill_reader.h"
+#include "vec/spill/spill_stream_manager.h"
+#include "vec/spill/spill_writer.h"
+
+namespace doris::pipeline {
+
+bool FragmentCapture::enabled(const TUniqueId& query_id) {
+    return !config::fragment_capture_query_id.empty() &&
+           config::fragment_capture_query_id == print_id(query_id);
+}
+
+bool FragmentCapture::sampled(int64_t index, double ratio) {
+    ratio = std::clamp(ratio, 0.0, 1.0);
+    return std::floor(static_cast<double>(index + 1) * ratio) >
+           std::floor(static_cast<double>(index) * ratio);
+}
+
+Status FragmentCapture::_fragment_dir(const TUniqueId& query_id, int32_t fragment_id,
+                                      vectorized::SpillDataDir** data_dir, std::string* dir) {
+    auto* spill_stream_mgr = ExecEnv::GetInstance()->spill_stream_mgr();
+    *data_dir = spill_stream_mgr == nullptr ? nullptr
+                                            : spill_stream_mgr->get_capture_data_dir(query_id);
+    if (*data_dir == nullptr) {
+        return Status::InternalError("no spill data dir to capture the fragment");
+    }
+    *dir = fmt::format("{}/{}/{}/{}", (*data_dir)->path(), CAPTURE_DIR_PREFIX, print_id(query_id),
+                       fragment_id);
+    return io::global_local_filesystem()->create_directory(*dir);
+}
+
+Status FragmentCapture::capture_params(const TPipelineFragmentParams& params) {
+    vectorized::SpillDataDir* data_dir = nullptr;
+    std::string dir;
+    RETURN_IF_ERROR(_fragment_dir(params.query_id, params.fragment_id, &data_dir, &dir));
+    ThriftSerializer serializer(false, 4096);
+    std::string buff;
+    RETURN_IF_ERROR(serializer.serialize(const_cast<TPipelineFragmentParams*>(&params), &buff));
+    io::FileWriterPtr file_writer;
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_file(
+            fmt::format("{}/{}", dir, PARAMS_FILE), &file_writer));
+    RETURN_IF_ERROR(file_writer->append(buff));
+    RETURN_IF_ERROR(file_writer->close());
+    LOG(INFO) << "captured the params of query " << print_id(params.query_id) << " fragment "
+              << params.fragment_id << " to " << dir;
+    return Status::OK();
+}
+
+std::unique_ptr<FragmentCaptureWriter> FragmentCapture::create_writer(
+        RuntimeState* state, const std::string& operator_name, int node_id,
+        RuntimeProfile* profile) {
+    if (!enabled(state->query_id())) {
+        return nullptr;
+    }
+    vectorized::SpillDataDir* data_dir = nullptr;
+    std::string dir;
+    Status st = _fragment_dir(state->query_id(), state->fragment_id(), &data_dir, &dir);
+    std::unique_ptr<FragmentCaptureWriter> writer;
+    if (st.ok()) {
+        writer = std::make_unique<FragmentCaptureWriter>(
+                data_dir, fmt::format("{}/{}-{}-{}", dir, operator_name, node_id, state->task_id()),
+                profile);
+        st = writer->open();
+    }
+    if (!st.ok()) {
+        LOG(WARNING) << "failed to capture " << operator_name << " " << node_id << " of query "
+                     << print_id(state->query_id()) << ": " << st;
+        return nullptr;
+    }
+    return writer;
+}
+
+Status FragmentCapture::read_params(const std::string& fragment_dir,
+                                    TPipelineFragmentParams* params) {
+    io::FileReaderSPtr file_reader;
+    RETURN_IF_ERROR(io::global_local_filesystem()->open_file(
+            fmt::format("{}/{}", fragment_dir, PARAMS_FILE), &file_reader));
+    std::string buff(file_reader->size(), '\0');
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(0, Slice(buff.data(), buff.size()), &bytes_read));
+    auto len = static_cast<uint32_t>(bytes_read);
+    return deserialize_thrift_msg(reinterpret_cast<const uint8_t*>(buff.data()), &len, false,
+                                  params);
+}
+
+Status FragmentCapture::list_streams(const std::string& fragment_dir,
+                                     std::vector<std::string>* streams) {
+    std::vector<io::FileInfo> files;
+    bool exists = false;
+    RETURN_IF_ERROR(io::global_local_filesystem()->list(fragment_dir, false, &files, &exists));
+    if (!exists) {
+        return Status::NotFound("no capture in {}", fragment_dir);
+    }
+    for (const auto& file : files) {
+        if (!file.is_file) {
+            streams->push_back(fmt::format("{}/{}", fragment_dir, file.file_name));
+        }
+    }
+    std::sort(streams->begin(), streams->end());
+    return Status::OK();
+}
+
+FragmentCaptureWriter::FragmentCaptureWriter(vectorized::SpillDataDir* data_dir, std::string dir,
+                                             RuntimeProfile* profile)
+        : _data_dir(data_dir), _dir(std::move(dir)) {
+    _serialize_timer = ADD_TIMER(profile, "CaptureSerializeTime");
+    _write_timer = ADD_TIMER(profile, "CaptureWriteTime");
+    _captured_blocks = ADD_COUNTER(profile, "CapturedBlocks", TUnit::UNIT);
+    _captured_bytes = ADD_COUNTER(profile, "CapturedBytes", TUnit::BYTES);
+}
+
+FragmentCaptureWriter::~FragmentCaptureWriter() {
+    close();
+}
+
+Status FragmentCaptureWriter::open() {
+    RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(_dir));
+    // the blocks are not split, a replay gets the same blocks
+    _writer = std::make_unique<vectorized::SpillWriter>(0, std::numeric_limits<int32_t>::max(),
+                                                        _data_dir, _dir);
+    _writer->set_counters(_serialize_timer, _captured_blocks, _captured_bytes, _write_timer);
+    return _writer->open();
+}
+
+void FragmentCaptureWriter::write(RuntimeState* state, const vectorized::Block& block) {
+    if (_writer == nullptr || block.rows() == 0 ||
+        !FragmentCapture::sampled(_num_blocks++, config::fragment_capture_sample_ratio)) {
+        return;
+    }
+    size_t written_bytes = 0;
+    Status st = _writer->write(state, block, written_bytes);
+    if (!st.ok()) {
+        _abort(st);
+    }
+}
+
+void FragmentCaptureWriter::close() {
+    if (_writer == nullptr) {
+        return;
+    }
+    Status st = _writer->close();
+    if (!st.ok()) {
+        _abort(st);
+        return;
+    }
+    // the captures are kept, unlike the spilled data they are not in the spill data usage
+    _data_dir->update_spill_data_usage(-static_cast<int64_t>(_writer->get_written_bytes()));
+    _writer.reset();
+}
+
+void FragmentCaptureWriter::_abort(const Status& status) {
+    LOG(WARNING) << "failed to capture " << _dir << ": " << status;
+    static_cast<void>(_writer->close());
+    _data_dir->update_spill_data_usage(-static_cast<int64_t>(_writer->get_written_bytes()));
+    _writer.reset();
+    static_cast<void>(io::global_local_filesystem()->delete_directory(_dir));
+}
+
+FragmentCaptureReader::FragmentCaptureReader(const std::string& stream_dir)
+        : _reader(std::make_unique<vectorized::SpillReader>(0, stream_dir + "/0")) {
+    _reader->set_counters(ADD_TIMER(&_profile, "ReadTime"),
+                          ADD_TIMER(&_profile, "DeserializeTime"),
+                          ADD_COUNTER(&_profile, "ReadBytes", TUnit::BYTES));
+}
+
+FragmentCaptureReader::~FragmentCaptureReader() = default;
+
+Status FragmentCaptureReader::open() {
+    return _reader->open();
+}
+
+Status FragmentCaptureReader::read(vectorized::Block* block, bool* eos) {
+    return _reader->read(block, eos);
+}
+
+void FragmentCaptureReader::rewind() {
+    _reader->seek(0);
+}
+
+size_t FragmentCaptureReader::num_blocks() const {
+    return _reader->block_count();
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+class RuntimeState;
+class TPipelineFragmentParams;
+
+namespace vectorized {
+class Block;
+class SpillDataDir;
+class SpillReader;
+class SpillWriter;
+} // namespace vectorized
+
+namespace pipeline {
+
+class FragmentCaptureWriter;
+
+// Captures the inputs of the fragments of the query `config::fragment_capture_query_id`, the
+// blocks received by the exchanges and produced by the scans, with the TPipelineFragmentParams,
+// so a slow fragment can be replayed and profiled offline with the production data, see
+// be/test/tools/fragment_replay_tool.cpp. The captures of a fragment are in one spill data dir:
+//
+//   capture/<query id>/<fragment id>/params                        the serialized params
+//   capture/<query id>/<fragment id>/<operator>-<node id>-<task id>/0  the blocks, in the
+//                                                                      spill file format
+//
+// Capturing is best effort, a failure to capture is logged and never fails the query.
+class FragmentCapture {
+public:
+    static constexpr const char* CAPTURE_DIR_PREFIX = "capture";
+    static constexpr const char* PARAMS_FILE = "params";
+
+    static bool enabled(const TUniqueId& query_id);
+
+    static Status capture_params(const TPipelineFragmentParams& params);
+
+    // The writer of the blocks of the operator `node_id` of the task of `state`, nullptr if
+    // its query is not captured.
+    static std::unique_ptr<FragmentCaptureWriter> create_writer(RuntimeState* state,
+                                                                const std::string& operator_name,
+                                                                int node_id,
+                                                                RuntimeProfile* profile);
+
+    static Status read_params(const std::string& fragment_dir, TPipelineFragmentParams* params);
+
+    // The dirs of the captured streams of blocks under `fragment_dir`.
+    static Status list_streams(const std::string& fragment_dir, std::vector<std::string>* streams);
+
+    // Whether the block `index` of a stream is captured with `ratio` of the blocks sampled.
+    // The sampled blocks are evenly spaced, so the captures of the same data are the same.
+    static bool sampled(int64_t index, double ratio);
+
+private:
+    static Status _fragment_dir(const TUniqueId& query_id, int32_t fragment_id,
+                                vectorized::SpillDataDir** data_dir, std::string* dir);
+};
+
+class FragmentCaptureWriter {
+public:
+    FragmentCaptureWriter(vectorized::SpillDataDir* data_dir, std::string dir,
+                          RuntimeProfile* profile);
+    ~FragmentCaptureWriter();
+
+    Status open();
+
+    // Captures `block` if it is sampled.
+    void write(RuntimeState* state, const vectorized::Block& block);
+
+    void close();
+
+private:
+    // Drops the capture after a failure.
+    void _abort(const Status& status);
+
+    vectorized::SpillDataDir* _data_dir = nullptr;
+    const std::string _dir;
+    std::unique_ptr<vectorized::SpillWriter> _writer;
+    int64_t _num_blocks = 0;
+
+    RuntimeProfile::Counter* _serialize_timer = nullptr;
+    RuntimeProfile::Counter* _write_timer = nullptr;
+    RuntimeProfile::Counter* _captured_blocks = nullptr;
+    RuntimeProfile::Counter* _captured_bytes = nullptr;
+};
+
+// Reads a stream of blocks captured by FragmentCaptureWriter.
+class FragmentCaptureReader {
+public:
+    explicit FragmentCaptureReader(const std::string& stream_dir);
+    ~FragmentCaptureReader();
+
+    Status open();
+
+    Status read(vectorized::Block* block, bool* eos);
+
+    // The next read starts from the first block again.
+    void rewind();
+
+    size_t num_blocks() const;
+
+    RuntimeProfile* profile() { return &_profile; }
+
+private:
+    RuntimeProfile _profile {"FragmentCaptureReader"};
+    std::unique_ptr<vectorized::SpillReader> _reader;
+};
+
+} // namespace pipeline
+} // namespace doris
@@ -27,6 +27,10 @@ Status LocalExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     SCOPED_TIMER(_init_timer);
     _compute_hash_value_timer = ADD_TIMER(profile(), "ComputeHashValueTime");
     _distribute_timer = ADD_TIMER(profile(), "DistributeDataTime");
+    _broadcast_bytes_saved_counter = ADD_COUNTER(profile(), "BroadcastBytesSaved", TUnit::BYTES);
+    _skew_rebalanced_rows_counter = ADD_COUNTER(profile(), "SkewRebalancedRows", TUnit::UNIT);
+    _skew_scaled_partitions_counter =
+            ADD_COUNTER(profile(), "SkewScaledPartitions", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -55,8 +55,14 @@ private:
     // Used by shuffle exchanger
     RuntimeProfile::Counter* _compute_hash_value_timer = nullptr;
     RuntimeProfile::Counter* _distribute_timer = nullptr;
+    // Bytes of the block copies avoided by sharing a broadcast block between channels.
+    RuntimeProfile::Counter* _broadcast_bytes_saved_counter = nullptr;
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
     std::vector<uint32_t> _partition_rows_histogram;
+    // Channel of every partition of the current block, used if hot partitions are split.
+    std::vector<int> _partition_channel_ids;
+    RuntimeProfile::Counter* _skew_rebalanced_rows_counter = nullptr;
+    RuntimeProfile::Counter* _skew_scaled_partitions_counter = nullptr;
 
     // Used by random passthrough exchanger
     int _channel_id = 0;
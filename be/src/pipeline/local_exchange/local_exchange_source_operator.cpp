@@ -40,7 +40,8 @@ Status LocalExchangeSourceLocalState::open(RuntimeState* state) {
     _get_block_failed_counter =
             ADD_COUNTER_WITH_LEVEL(profile(), "GetBlockFailedTime", TUnit::UNIT, 1);
     if (_exchanger->get_type() == ExchangeType::HASH_SHUFFLE ||
-        _exchanger->get_type() == ExchangeType::BUCKET_HASH_SHUFFLE) {
+        _exchanger->get_type() == ExchangeType::BUCKET_HASH_SHUFFLE ||
+        _exchanger->get_type() == ExchangeType::BROADCAST) {
         _copy_data_timer = ADD_TIMER(profile(), "CopyDataTime");
     }
 
@@ -116,6 +116,9 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     if (get_type() == ExchangeType::HASH_SHUFFLE) {
         const auto& map = local_state._parent->cast<LocalExchangeSinkOperatorX>()
                                   ._shuffle_idx_to_instance_idx;
+        if (_rebalancer) {
+            _assign_partition_channels(local_state, new_block_wrapper->data_block.bytes());
+        }
         new_block_wrapper->ref(map.size());
         for (const auto& it : map) {
             DCHECK(it.second >= 0 && it.second < _num_partitions)
@@ -123,10 +126,12 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
             uint32_t start = local_state._partition_rows_histogram[it.first];
             uint32_t size = local_state._partition_rows_histogram[it.first + 1] - start;
             if (size > 0) {
+                const int channel_id =
+                        _rebalancer ? local_state._partition_channel_ids[it.first] : it.second;
                 local_state._shared_state->add_mem_usage(
-                        it.second, new_block_wrapper->data_block.allocated_bytes(), false);
-                data_queue[it.second].enqueue({new_block_wrapper, {row_idx, start, size}});
-                local_state._shared_state->set_ready_to_read(it.second);
+                        channel_id, new_block_wrapper->data_block.allocated_bytes(), false);
+                data_queue[channel_id].enqueue({new_block_wrapper, {row_idx, start, size}});
+                local_state._shared_state->set_ready_to_read(channel_id);
             } else {
                 new_block_wrapper->unref(local_state._shared_state);
             }
@@ -166,6 +171,38 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
     return Status::OK();
 }
 
+void ShuffleExchanger::_assign_partition_channels(LocalExchangeSinkLocalState& local_state,
+                                                  size_t bytes) {
+    const auto& histogram = local_state._partition_rows_histogram;
+    auto& channel_ids = local_state._partition_channel_ids;
+    channel_ids.resize(_num_partitions);
+    int64_t rebalanced_rows = 0;
+    int64_t scaled_partitions = 0;
+    {
+        std::lock_guard<std::mutex> l(_rebalance_lock);
+        _rebalancer->rebalance();
+        for (int i = 0; i < _num_partitions; i++) {
+            const uint32_t rows = histogram[i + 1] - histogram[i];
+            if (rows == 0) {
+                continue;
+            }
+            _rebalancer->add_partition_row_count(i, rows);
+            // All rows of a partition in one block go to the same task, the tasks of a hot
+            // partition take its blocks in turn.
+            channel_ids[i] = _rebalancer->get_task_id(i, _partition_task_indexes[i]++);
+            if (channel_ids[i] != i) {
+                rebalanced_rows += rows;
+            }
+        }
+        _rebalancer->add_data_processed(bytes);
+        for (int i = 0; i < _num_partitions; i++) {
+            scaled_partitions += _rebalancer->get_partition_task_count(i) > 1;
+        }
+    }
+    COUNTER_UPDATE(local_state._skew_rebalanced_rows_counter, rebalanced_rows);
+    COUNTER_SET(local_state._skew_scaled_partitions_counter, scaled_partitions);
+}
+
 Status PassthroughExchanger::sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                                   LocalExchangeSinkLocalState& local_state) {
     vectorized::Block new_block;
@@ -244,10 +281,26 @@ Status PassToOneExchanger::get_block(RuntimeState* state, vectorized::Block* blo
 
 Status BroadcastExchanger::sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                                 LocalExchangeSinkLocalState& local_state) {
+    if (in_block->rows() == 0) {
+        return Status::OK();
+    }
+    vectorized::Block data_block;
+    std::shared_ptr<ShuffleBlockWrapper> new_block_wrapper;
+    if (_free_blocks.try_dequeue(data_block)) {
+        new_block_wrapper = ShuffleBlockWrapper::create_shared(std::move(data_block));
+    } else {
+        new_block_wrapper = ShuffleBlockWrapper::create_shared(in_block->clone_empty());
+    }
+    new_block_wrapper->data_block.swap(*in_block);
+
+    const auto allocated_bytes = new_block_wrapper->data_block.allocated_bytes();
+    local_state._shared_state->add_total_mem_usage(allocated_bytes);
+    COUNTER_UPDATE(local_state._broadcast_bytes_saved_counter,
+                   (int64_t)allocated_bytes * (_num_partitions - 1));
+    new_block_wrapper->ref(_num_partitions);
     for (size_t i = 0; i < _num_partitions; i++) {
-        auto mutable_block = vectorized::MutableBlock::create_unique(in_block->clone_empty());
-        mutable_block->add_rows(in_block, 0, in_block->rows());
-        _data_queue[i].enqueue(mutable_block->to_block());
+        local_state._shared_state->add_mem_usage(i, allocated_bytes, false);
+        _data_queue[i].enqueue(new_block_wrapper);
         local_state._shared_state->set_ready_to_read(i);
     }
 
@@ -256,15 +309,27 @@ Status BroadcastExchanger::sink(RuntimeState* state, vectorized::Block* in_block
 
 Status BroadcastExchanger::get_block(RuntimeState* state, vectorized::Block* block, bool* eos,
                                      LocalExchangeSourceLocalState& local_state) {
-    vectorized::Block next_block;
+    std::shared_ptr<ShuffleBlockWrapper> block_wrapper;
+    auto get_data = [&]() {
+        SCOPED_TIMER(local_state._copy_data_timer);
+        // The block is shared by all the channels, its columns must not be handed to
+        // the downstream operators which may mutate them, so copy the rows out.
+        auto mutable_block = vectorized::VectorizedUtils::build_mutable_mem_reuse_block(
+                block, block_wrapper->data_block);
+        mutable_block.add_rows(&block_wrapper->data_block, 0, block_wrapper->data_block.rows());
+        local_state._shared_state->sub_mem_usage(
+                local_state._channel_id, block_wrapper->data_block.allocated_bytes(), false);
+        block_wrapper->unref(local_state._shared_state);
+    };
+
     if (_running_sink_operators == 0) {
-        if (_data_queue[local_state._channel_id].try_dequeue(next_block)) {
-            *block = std::move(next_block);
+        if (_data_queue[local_state._channel_id].try_dequeue(block_wrapper)) {
+            get_data();
         } else {
             *eos = true;
         }
-    } else if (_data_queue[local_state._channel_id].try_dequeue(next_block)) {
-        *block = std::move(next_block);
+    } else if (_data_queue[local_state._channel_id].try_dequeue(block_wrapper)) {
+        get_data();
     } else {
         COUNTER_UPDATE(local_state._get_block_failed_counter, 1);
         local_state._dependency->block();
@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <mutex>
+
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "vec/exec/skewed_partition_rebalancer.h"
 
 namespace doris::pipeline {
 
@@ -94,9 +98,20 @@ class ShuffleExchanger : public Exchanger {
 
 public:
     ENABLE_FACTORY_CREATOR(ShuffleExchanger);
-    ShuffleExchanger(int running_sink_operators, int num_partitions, int free_block_limit)
+    // If `split_hot_partitions` is true, the downstream operator allows one partition to be
+    // processed by several tasks, so a hot partition is split to the idle tasks by a
+    // SkewedPartitionRebalancer.
+    ShuffleExchanger(int running_sink_operators, int num_partitions, int free_block_limit,
+                     bool split_hot_partitions = false)
             : Exchanger(running_sink_operators, num_partitions, free_block_limit) {
         _data_queue.resize(num_partitions);
+        if (split_hot_partitions) {
+            _rebalancer = std::make_unique<vectorized::SkewedPartitionRebalancer>(
+                    num_partitions, num_partitions, 1,
+                    config::local_exchange_skew_rebalance_min_partition_data_processed_threshold,
+                    config::local_exchange_skew_rebalance_min_data_processed_threshold);
+            _partition_task_indexes.resize(num_partitions, 0);
+        }
     }
     ~ShuffleExchanger() override = default;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
@@ -117,9 +132,18 @@ protected:
                        vectorized::Block* block, bool eos,
                        LocalExchangeSinkLocalState& local_state);
 
+    // Feeds the rows of the current block to the rebalancer and picks the channel of every
+    // partition, the result is stored in `local_state._partition_channel_ids`.
+    void _assign_partition_channels(LocalExchangeSinkLocalState& local_state, size_t bytes);
+
     std::vector<moodycamel::ConcurrentQueue<PartitionedBlock>> _data_queue;
 
     const bool _ignore_source_data_distribution = false;
+
+    // Shared by all sinks, so guarded by `_rebalance_lock`.
+    std::unique_ptr<vectorized::SkewedPartitionRebalancer> _rebalancer;
+    std::vector<int64_t> _partition_task_indexes;
+    std::mutex _rebalance_lock;
 };
 
 class BucketShuffleExchanger final : public ShuffleExchanger {
@@ -170,6 +194,9 @@ private:
     std::vector<moodycamel::ConcurrentQueue<vectorized::Block>> _data_queue;
 };
 
+// Every sink block is shared by all the channels instead of being copied for each of them,
+// a channel copies the rows out when it reads the block and the block goes back to
+// `_free_blocks` after all the channels have read it.
 class BroadcastExchanger final : public Exchanger {
 public:
     ENABLE_FACTORY_CREATOR(BroadcastExchanger);
@@ -186,7 +213,7 @@ public:
     ExchangeType get_type() const override { return ExchangeType::BROADCAST; }
 
 private:
-    std::vector<moodycamel::ConcurrentQueue<vectorized::Block>> _data_queue;
+    std::vector<moodycamel::ConcurrentQueue<std::shared_ptr<ShuffleBlockWrapper>>> _data_queue;
 };
 
 //The code in AdaptivePassthroughExchanger is essentially
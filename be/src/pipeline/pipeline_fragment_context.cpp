@@ -91,8 +91,10 @@
 #include "pipeline/exec/table_function_operator.h"
 #include "pipeline/exec/union_sink_operator.h"
 #include "pipeline/exec/union_source_operator.h"
+#include "pipeline/fragment_capture.h"
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
+#include "pipeline/plan_regression_detector.h"
 #include "pipeline/task_scheduler.h"
 #include "pipeline_task.h"
 #include "runtime/exec_env.h"
@@ -182,6 +184,11 @@ void PipelineFragmentContext::cancel(const Status reason) {
         }
     }
     _query_ctx->cancel(reason, _fragment_id);
+    if (config::enable_mem_site_tracking && !reason.is<ErrorCode::LIMIT_REACH>()) {
+        LOG(INFO) << "memory of the cancelled fragment by data structure, query_id "
+                  << print_id(_query_id) << ", fragment_id " << _fragment_id << ":\n"
+                  << _mem_site_string();
+    }
     if (reason.is<ErrorCode::LIMIT_REACH>()) {
         _is_report_on_cancel = false;
     } else {
@@ -274,13 +281,11 @@ Status PipelineFragmentContext::prepare(const doris::TPipelineFragmentParams& re
         _runtime_state->set_load_job_id(request.load_job_id);
     }
 
-    if (request.is_simplified_param) {
-        _desc_tbl = _query_ctx->desc_tbl;
-    } else {
-        DCHECK(request.__isset.desc_tbl);
-        RETURN_IF_ERROR(
-                DescriptorTbl::create(_runtime_state->obj_pool(), request.desc_tbl, &_desc_tbl));
-    }
+    // The descriptor table is the same for all the fragments of a query, it has been created by
+    // the query context from the first fragment request, and the operators are built with it
+    // too, so it is not created again from the request.
+    DCHECK(request.is_simplified_param || request.__isset.desc_tbl);
+    _desc_tbl = _query_ctx->desc_tbl;
     _runtime_state->set_desc_tbl(_desc_tbl);
     _runtime_state->set_num_per_fragment_instances(request.num_senders);
     _runtime_state->set_load_stream_per_node(request.load_stream_per_node);
@@ -335,6 +340,14 @@ Status PipelineFragmentContext::prepare(const doris::TPipelineFragmentParams& re
     // 5. Build pipeline tasks and initialize local state.
     RETURN_IF_ERROR(_build_pipeline_tasks(request));
 
+    if (config::enable_plan_regression_detector) {
+        _plan_fingerprint = PlanRegressionDetector::fingerprint(request, *_desc_tbl);
+    }
+    if (FragmentCapture::enabled(_query_id)) {
+        WARN_IF_ERROR(FragmentCapture::capture_params(request),
+                      "failed to capture the params of the fragment");
+    }
+
     _init_next_report_time();
 
     _prepared = true;
@@ -702,14 +715,20 @@ Status PipelineFragmentContext::_add_local_exchange_impl(
     // 2. Create and initialize LocalExchangeSharedState.
     auto shared_state = LocalExchangeSharedState::create_shared(_num_instances);
     switch (data_distribution.distribution_type) {
-    case ExchangeType::HASH_SHUFFLE:
+    case ExchangeType::HASH_SHUFFLE: {
+        const bool split_hot_partitions =
+                config::enable_local_exchange_skew_rebalance && !is_shuffled_hash_join &&
+                (operator_xs.size() > idx ? operator_xs[idx]->could_split_hash_partition()
+                                          : cur_pipe->sink_x()->could_split_hash_partition());
         shared_state->exchanger = ShuffleExchanger::create_unique(
                 std::max(cur_pipe->num_tasks(), _num_instances),
                 is_shuffled_hash_join ? _total_instances : _num_instances,
                 _runtime_state->query_options().__isset.local_exchange_free_blocks_limit
                         ? _runtime_state->query_options().local_exchange_free_blocks_limit
-                        : 0);
+                        : 0,
+                split_hot_partitions);
         break;
+    }
     case ExchangeType::BUCKET_HASH_SHUFFLE:
         shared_state->exchanger = BucketShuffleExchanger::create_unique(
                 std::max(cur_pipe->num_tasks(), _num_instances), _num_instances, num_buckets,
@@ -1509,6 +1528,7 @@ void PipelineFragmentContext::_close_fragment_instance() {
     Defer defer_op {[&]() { _is_fragment_instance_closed = true; }};
     _runtime_profile->total_time_counter()->update(_fragment_watcher.elapsed_time());
     static_cast<void>(send_report(true));
+    _check_plan_regression();
     // Print profile content in info log is a tempoeray solution for stream load.
     // Since stream load does not have someting like coordinator on FE, so
     // backend can not report profile to FE, ant its profile can not be shown
@@ -1614,6 +1634,41 @@ std::string PipelineFragmentContext::debug_string() {
     return fmt::to_string(debug_string_buffer);
 }
 
+std::string PipelineFragmentContext::_mem_site_string() {
+    fmt::memory_buffer buffer;
+    for (size_t j = 0; j < _tasks.size(); j++) {
+        for (size_t i = 0; i < _tasks[j].size(); i++) {
+            auto sites = _tasks[j][i]->mem_site_string();
+            if (!sites.empty()) {
+                fmt::format_to(buffer, "Instance {} Task {}:\n{}", j, i, sites);
+            }
+        }
+    }
+    return fmt::to_string(buffer);
+}
+
+void PipelineFragmentContext::_check_plan_regression() {
+    if (_plan_fingerprint == 0 || !config::enable_plan_regression_detector) {
+        return;
+    }
+    {
+        // only the successful executions make the baselines
+        std::lock_guard<std::mutex> l(_status_lock);
+        if (!_query_ctx->exec_status().ok()) {
+            return;
+        }
+    }
+    auto summary = PlanRegressionDetector::summarize(_runtime_state->pipeline_id_to_profile(),
+                                                     _fragment_watcher.elapsed_time());
+    auto deviations = PlanRegressionDetector::instance()->check(_plan_fingerprint, summary);
+    if (!deviations.empty()) {
+        LOG(WARNING) << fmt::format(
+                "query {} fragment {} deviates from the baseline of its plan {:x}: {}",
+                print_id(_query_id), _fragment_id, _plan_fingerprint,
+                fmt::join(deviations, "; "));
+    }
+}
+
 std::vector<std::shared_ptr<TRuntimeProfileTree>>
 PipelineFragmentContext::collect_realtime_profile_x() const {
     std::vector<std::shared_ptr<TRuntimeProfileTree>> res;
@@ -103,6 +103,16 @@ public:
 
     [[nodiscard]] int get_fragment_id() const { return _fragment_id; }
 
+    // Bind the fragment to `numa_node` if it is not bound yet. Returns the numa node
+    // that the fragment is bound to.
+    int bind_numa_node(int numa_node) {
+        int expected = -1;
+        if (_numa_node.compare_exchange_strong(expected, numa_node)) {
+            return numa_node;
+        }
+        return expected;
+    }
+
     void close_a_pipeline();
 
     Status send_report(bool);
@@ -148,6 +158,11 @@ public:
     }
 
 private:
+    // The memory of the running tasks as a tree of instance, task, operator and data structure.
+    std::string _mem_site_string();
+    // Compares the execution with the baseline of the plan, see PlanRegressionDetector.
+    void _check_plan_regression();
+
     Status _build_pipelines(ObjectPool* pool, const doris::TPipelineFragmentParams& request,
                             const DescriptorTbl& descs, OperatorXPtr* root, PipelinePtr cur_pipe);
     Status _create_tree_helper(ObjectPool* pool, const std::vector<TPlanNode>& tnodes,
@@ -205,6 +220,8 @@ private:
     ExecEnv* _exec_env = nullptr;
 
     std::atomic_bool _prepared = false;
+    // The numa node the tasks of this fragment are scheduled on, -1 means not bound.
+    std::atomic_int _numa_node = -1;
     bool _submitted = false;
 
     std::mutex _status_lock;
@@ -228,6 +245,8 @@ private:
 
     MonotonicStopWatch _fragment_watcher;
     RuntimeProfile::Counter* _prepare_timer = nullptr;
+    // 0 if the plan regression detector is disabled
+    uint64_t _plan_fingerprint = 0;
 
     std::function<void(RuntimeState*, Status*)> _call_back;
     bool _is_fragment_instance_closed = false;
@@ -22,9 +22,11 @@
 #include <glog/logging.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <ostream>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/exec/scan_operator.h"
@@ -32,6 +34,7 @@
 #include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/task_queue.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
 #include "util/container_util.hpp"
@@ -166,7 +169,22 @@ void PipelineTask::_init_profile() {
     _block_counts = ADD_COUNTER(_task_profile, "NumBlockedTimes", TUnit::UNIT);
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
+    _perf_event_counters.init(_task_profile.get(), config::pipeline_perf_events_profile_level);
+    _time_slice_counter = ADD_TIMER(_task_profile, "TimeSlice");
+    COUNTER_SET(_time_slice_counter, _time_slice_ns);
+    _avg_block_latency_counter = ADD_TIMER(_task_profile, "AvgBlockLatency");
+    _memory_reserve_failed_counter =
+            ADD_COUNTER(_task_profile, "MemoryReserveFailedTimes", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
+    _core_affinity_hit_times = ADD_COUNTER(_task_profile, "CoreAffinityHitTimes", TUnit::UNIT);
+    _task_profile->add_derived_counter(
+            "CoreAffinityHitPercent", TUnit::UNIT,
+            [this]() -> int64_t {
+                int64_t hits = _core_affinity_hit_times->value();
+                int64_t total = hits + _core_change_times->value();
+                return total == 0 ? 0 : hits * 100 / total;
+            },
+            "");
 }
 
 void PipelineTask::_fresh_profile_counter() {
@@ -207,10 +225,16 @@ Status PipelineTask::execute(bool* eos) {
         return Status::OK();
     }
     int64_t time_spent = 0;
+    int64_t num_blocks = 0;
+    MonotonicStopWatch exec_watcher;
+    exec_watcher.start();
 
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
+    // the events of the whole time slice, the operators count their own parts of it
+    ScopedPerfEvents perf_events(&_perf_event_counters, true);
     Defer defer {[&]() {
+        time_spent = exec_watcher.elapsed_time();
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
         }
@@ -246,24 +270,46 @@ Status PipelineTask::execute(bool* eos) {
             break;
         }
 
-        if (time_spent > THREAD_TIME_SLICE) {
+        if (exec_watcher.elapsed_time() > _time_slice_ns) {
             COUNTER_UPDATE(_yield_counts, 1);
+            _update_time_slice(exec_watcher.elapsed_time(), num_blocks);
             break;
         }
         _block->clear_column_data(_root->row_desc().num_materialized_slots());
         auto* block = _block.get();
 
         auto sink_revocable_mem_size = _sink->revocable_mem_size(_state);
+        _update_revocable_mem_size(sink_revocable_mem_size);
         if (should_revoke_memory(_state, sink_revocable_mem_size)) {
             RETURN_IF_ERROR(_sink->revoke_memory(_state));
             continue;
         }
 
+        // A sink holding revocable memory grows by about one block each time, reserve it
+        // first and spill if the workload group can not grant it.
+        int64_t reserved_bytes = 0;
+        if (config::enable_query_memory_reservation && sink_revocable_mem_size > 0 &&
+            _last_sink_block_bytes > 0) {
+            if (_state->get_query_ctx()->try_reserve_memory(_last_sink_block_bytes)) {
+                reserved_bytes = _last_sink_block_bytes;
+            } else if (sink_revocable_mem_size >= _state->min_revocable_mem()) {
+                COUNTER_UPDATE(_memory_reserve_failed_counter, 1);
+                RETURN_IF_ERROR(_sink->revoke_memory(_state));
+                continue;
+            }
+        }
+        Defer release_reserved_memory {[&]() {
+            if (reserved_bytes > 0) {
+                _state->get_query_ctx()->release_reserved_memory(reserved_bytes);
+            }
+        }};
+
         *eos = _eos;
         // Pull block from operator chain
         if (!_dry_run) {
             SCOPED_TIMER(_get_block_timer);
             _get_block_counter->update(1);
+            num_blocks++;
             try {
                 RETURN_IF_ERROR(_root->get_block_after_projects(_state, block, eos));
             } catch (const Exception& e) {
@@ -277,8 +323,13 @@ Status PipelineTask::execute(bool* eos) {
 
         if (_block->rows() != 0 || *eos) {
             SCOPED_TIMER(_sink_timer);
+            _last_sink_block_bytes = block->allocated_bytes();
             Status status = Status::OK();
-            status = _sink->sink(_state, block, *eos);
+            {
+                ScopedPerfEvents sink_perf_events(
+                        _state->get_sink_local_state()->perf_event_counters());
+                status = _sink->sink(_state, block, *eos);
+            }
             if (!status.is<ErrorCode::END_OF_FILE>()) {
                 RETURN_IF_ERROR(status);
             }
@@ -294,6 +345,34 @@ Status PipelineTask::execute(bool* eos) {
     return Status::OK();
 }
 
+void PipelineTask::_update_time_slice(int64_t time_spent, int64_t num_blocks) {
+    if (!config::enable_pipeline_task_adaptive_time_slice || _task_queue == nullptr) {
+        return;
+    }
+    const int64_t min_slice = config::pipeline_task_min_time_slice_ms * 1000L * 1000L;
+    const int64_t max_slice =
+            std::max<int64_t>(config::pipeline_task_max_time_slice_ms * 1000L * 1000L, min_slice);
+    int64_t block_latency = time_spent / std::max<int64_t>(num_blocks, 1);
+    _avg_block_latency_ns = _avg_block_latency_ns == 0
+                                    ? block_latency
+                                    : (_avg_block_latency_ns * 3 + block_latency) / 4;
+
+    int64_t slice = 0;
+    size_t queued = _task_queue->runnable_task_size(_core_id);
+    if (queued == 0) {
+        // Nobody is waiting for this core, yield less to save the rescheduling cost.
+        slice = _time_slice_ns * 2;
+    } else {
+        // Share the default slice with the waiting tasks, but still finish a few blocks
+        // per slice, otherwise tasks with expensive blocks yield after every block.
+        slice = std::max<int64_t>(THREAD_TIME_SLICE / (queued + 1),
+                                  _avg_block_latency_ns * MIN_BLOCKS_PER_TIME_SLICE);
+    }
+    _time_slice_ns = std::clamp(slice, min_slice, max_slice);
+    COUNTER_SET(_time_slice_counter, _time_slice_ns);
+    COUNTER_SET(_avg_block_latency_counter, _avg_block_latency_ns);
+}
+
 bool PipelineTask::should_revoke_memory(RuntimeState* state, int64_t revocable_mem_bytes) {
     auto* query_ctx = state->get_query_ctx();
     auto wg = query_ctx->workload_group();
@@ -303,6 +382,12 @@ bool PipelineTask::should_revoke_memory(RuntimeState* state, int64_t revocable_m
     }
     const auto min_revocable_mem_bytes = state->min_revocable_mem();
 
+    if (query_ctx->need_to_revoke_memory() && revocable_mem_bytes >= min_revocable_mem_bytes) {
+        LOG_EVERY_N(INFO, 10) << "revoke memory, picked by workload group, query: "
+                              << print_id(state->query_id());
+        return true;
+    }
+
     if (UNLIKELY(state->enable_force_spill())) {
         if (revocable_mem_bytes >= min_revocable_mem_bytes) {
             LOG_ONCE(INFO) << "spill force, query: " << print_id(state->query_id());
@@ -348,6 +433,14 @@ bool PipelineTask::should_revoke_memory(RuntimeState* state, int64_t revocable_m
     }
 }
 
+void PipelineTask::_update_revocable_mem_size(int64_t revocable_mem_size) {
+    if (revocable_mem_size != _reported_revocable_mem_size) {
+        _state->get_query_ctx()->update_revocable_mem_size(revocable_mem_size -
+                                                           _reported_revocable_mem_size);
+        _reported_revocable_mem_size = revocable_mem_size;
+    }
+}
+
 void PipelineTask::finalize() {
     std::unique_lock<std::mutex> lc(_release_lock);
     _finished = true;
@@ -366,6 +459,7 @@ Status PipelineTask::close(Status exec_status) {
     Status s;
     {
         SCOPED_RAW_TIMER(&close_ns);
+        _update_revocable_mem_size(0);
         s = _sink->close(_state, exec_status);
         for (auto& op : _operators) {
             auto tem = op->close(_state);
@@ -386,6 +480,25 @@ Status PipelineTask::close_sink(Status exec_status) {
     return _sink->close(_state, exec_status);
 }
 
+std::string PipelineTask::mem_site_string() {
+    std::unique_lock<std::mutex> lc(_release_lock);
+    if (!_opened || _finished) {
+        return "";
+    }
+    fmt::memory_buffer buffer;
+    auto append = [&](const std::string& name, const MemSiteTracker* mem_sites) {
+        auto sites = mem_sites->debug_string();
+        if (!sites.empty()) {
+            fmt::format_to(buffer, "  {}: {}\n", name, sites);
+        }
+    };
+    for (auto& op : _operators) {
+        append(op->get_name(), _state->get_local_state(op->operator_id())->mem_sites());
+    }
+    append(_sink->get_name(), _state->get_sink_local_state()->mem_sites());
+    return fmt::to_string(buffer);
+}
+
 std::string PipelineTask::debug_string() {
     std::unique_lock<std::mutex> lc(_release_lock);
     fmt::memory_buffer debug_string_buffer;
@@ -440,11 +553,40 @@ std::string PipelineTask::debug_string() {
     return fmt::to_string(debug_string_buffer);
 }
 
-void PipelineTask::wake_up() {
+void PipelineTask::wake_up(Dependency* dep) {
     // call by dependency
+    if (ExecEnv::GetInstance()->pipeline_tracer_context()->enabled()) [[unlikely]] {
+        _waker = dep;
+        _wake_up_time_us = MonotonicMicros();
+#ifndef __APPLE__
+        _waker_core_id = sched_getcpu();
+#endif
+    }
     static_cast<void>(get_task_queue()->push_back(this));
 }
 
+void PipelineTask::begin_schedule_record(ScheduleRecord* record) {
+    record->task_uid = reinterpret_cast<uintptr_t>(this);
+    record->runnable_time = _runnable_time_us;
+    record->last_end_time = _last_end_time_us;
+    if (_waker != nullptr) {
+        record->woken_by = _waker->name();
+        record->wake_up_time = _wake_up_time_us;
+        record->waker_core_id = _waker_core_id;
+        // a task yielding its time slice is not woken up by a dependency
+        _waker = nullptr;
+    }
+    // set again if the task gets blocked by this execution
+    _blocked_dep = nullptr;
+}
+
+void PipelineTask::end_schedule_record(ScheduleRecord* record, bool eos) {
+    if (!eos && _blocked_dep != nullptr) {
+        record->blocked_by = _blocked_dep->name();
+    }
+    _last_end_time_us = record->end_time;
+}
+
 QueryContext* PipelineTask::query_context() {
     return _fragment_context->get_query_ctx();
 }
@@ -27,8 +27,11 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "pipeline/pipeline_tracing.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/thread_perf_events.h"
+#include "util/time.h"
 #include "vec/core/block.h"
 #include "vec/sink/vresult_sink.h"
 
@@ -89,6 +92,8 @@ public:
                 COUNTER_UPDATE(_core_change_times, 1);
             }
             _previous_schedule_id = id;
+        } else {
+            COUNTER_UPDATE(_core_affinity_hit_times, 1);
         }
     }
 
@@ -98,6 +103,10 @@ public:
 
     std::string debug_string();
 
+    // The memory of each operator split by the data structures holding it, one line for each
+    // operator, see `MemSiteTracker`. Empty if the sites are not tracked.
+    std::string mem_site_string();
+
     bool is_pending_finish() { return _finish_blocked_dependency() != nullptr; }
 
     std::shared_ptr<BasicSharedState> get_source_shared_state() {
@@ -132,7 +141,13 @@ public:
         return _op_shared_states[id].get();
     }
 
-    void wake_up();
+    // Called by `dep` when it gets ready.
+    void wake_up(Dependency* dep);
+
+    // Fill the scheduling states of the task into the tracing record of an execution, before
+    // and after the execution.
+    void begin_schedule_record(ScheduleRecord* record);
+    void end_schedule_record(ScheduleRecord* record, bool eos);
 
     DataSinkOperatorXPtr sink() const { return _sink; }
 
@@ -164,6 +179,8 @@ public:
     TaskQueue* get_task_queue() { return _task_queue; }
 
     static constexpr auto THREAD_TIME_SLICE = 100'000'000ULL;
+    // A task with an adaptive time slice processes at least so many blocks before yielding.
+    static constexpr auto MIN_BLOCKS_PER_TIME_SLICE = 4;
 
     // 1 used for update priority queue
     // note(wb) an ugly implementation, need refactor later
@@ -179,6 +196,18 @@ public:
     void set_core_id(int core_id) { this->_core_id = core_id; }
     int get_core_id() const { return this->_core_id; }
 
+    // 1.4 numa node the task prefers to run on, -1 means not bound yet
+    void set_numa_node(int numa_node) { this->_numa_node = numa_node; }
+    int get_numa_node() const { return this->_numa_node; }
+
+    // 1.5 intrusive link used by the inbox of WorkStealingTaskQueue
+    void set_next_in_queue(PipelineTask* next) { this->_next_in_queue = next; }
+    PipelineTask* next_in_queue() const { return this->_next_in_queue; }
+
+    // 1.6 index of the workload group queue in WorkloadGroupFairTaskQueue
+    void set_group_queue_idx(int idx) { this->_group_queue_idx = idx; }
+    int get_group_queue_idx() const { return this->_group_queue_idx; }
+
     bool has_dependency() {
         _blocked_dep = _execution_dep->is_blocked_by(this);
         if (_blocked_dep != nullptr) {
@@ -193,6 +222,7 @@ public:
     void put_in_runnable_queue() {
         _schedule_time++;
         _wait_worker_watcher.start();
+        _runnable_time_us = MonotonicMicros();
     }
 
     void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
@@ -277,9 +307,14 @@ private:
     }
 
     Status _extract_dependencies();
+    // Adjust the time slice by the observed block latency and the queue depth of the core,
+    // called when the task yields.
+    void _update_time_slice(int64_t time_spent, int64_t num_blocks);
     void _init_profile();
     void _fresh_profile_counter();
     Status _open();
+    // Reports the change of the revocable memory of the sink to the query.
+    void _update_revocable_mem_size(int64_t revocable_mem_size);
 
     uint32_t _index;
     PipelinePtr _pipeline;
@@ -303,11 +338,21 @@ private:
     // 3 update task statistics(update _queue_level/_core_id)
     int _queue_level = 0;
     int _core_id = 0;
+    int _numa_node = -1;
+    PipelineTask* _next_in_queue = nullptr;
+    int _group_queue_idx = -1;
+    // The task yields after running for so long, see _update_time_slice.
+    int64_t _time_slice_ns = THREAD_TIME_SLICE;
+    int64_t _avg_block_latency_ns = 0;
+    int64_t _reported_revocable_mem_size = 0;
+    // the bytes to reserve before the sink grows next time
+    int64_t _last_sink_block_bytes = 0;
     Status _open_status = Status::OK();
 
     RuntimeProfile* _parent_profile = nullptr;
     std::unique_ptr<RuntimeProfile> _task_profile;
     RuntimeProfile::Counter* _task_cpu_timer = nullptr;
+    PerfEventCounters _perf_event_counters;
     RuntimeProfile::Counter* _prepare_timer = nullptr;
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _exec_timer = nullptr;
@@ -321,7 +366,12 @@ private:
     RuntimeProfile::Counter* _wait_worker_timer = nullptr;
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
+    RuntimeProfile::Counter* _time_slice_counter = nullptr;
+    RuntimeProfile::Counter* _avg_block_latency_counter = nullptr;
+    RuntimeProfile::Counter* _memory_reserve_failed_counter = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
+    // The task runs on the same core as the last time.
+    RuntimeProfile::Counter* _core_affinity_hit_times = nullptr;
 
     MonotonicStopWatch _pipeline_task_watcher;
 
@@ -348,6 +398,15 @@ private:
 
     Dependency* _execution_dep = nullptr;
 
+    // For the pipeline tracing, see `TaskScheduler::_do_work`. The time the task was put in the
+    // runnable queue, the dependency which woke it up last, when and on which core.
+    uint64_t _runnable_time_us = 0;
+    Dependency* _waker = nullptr;
+    uint64_t _wake_up_time_us = 0;
+    uint32_t _waker_core_id = 0;
+    // the end of the last execution
+    uint64_t _last_end_time_us = 0;
+
     std::atomic<bool> _finished {false};
     std::mutex _release_lock;
 
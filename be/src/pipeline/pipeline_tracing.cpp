@@ -19,13 +19,17 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
 #include <boost/algorithm/string/predicate.hpp>
 #include <chrono>
 #include <cstdint>
 #include <mutex>
+#include <set>
 #include <string>
+#include <unordered_map>
 
 #include "common/config.h"
 #include "common/exception.h"
@@ -82,6 +86,17 @@ Status PipelineTracerContext::change_record_params(
         }
     }
 
+    if (auto it = params.find("format"); it != params.end()) {
+        if (boost::iequals(it->second, "text")) {
+            _dump_format = DumpFormat::Text;
+            effective = true;
+        } else if (boost::iequals(it->second, "chrome") ||
+                   boost::iequals(it->second, "perfetto")) {
+            _dump_format = DumpFormat::Chrome;
+            effective = true;
+        }
+    }
+
     if (auto it = params.find("dump_interval"); it != params.end()) {
         _dump_interval_s = std::stoll(it->second); // s as unit
         effective = true;
@@ -95,29 +110,20 @@ Status PipelineTracerContext::change_record_params(
 void PipelineTracerContext::_dump_query(TUniqueId query_id) {
     //TODO: when dump, now could append records but can't add new query. try use better grained locks.
     std::unique_lock<std::mutex> l(_data_lock); // can't rehash
-    auto path = _log_dir / fmt::format("query{}", to_string(query_id));
-    int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
-                    S_ISGID | S_ISUID | S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP | S_IWOTH | S_IROTH);
-    if (fd < 0) [[unlikely]] {
-        throw Exception(Status::Error<ErrorCode::CREATE_FILE_ERROR>(
-                "create tracing log file {} failed", path.c_str()));
-    }
-    auto writer = io::LocalFileWriter {path, fd};
+    auto path = _log_dir / fmt::format("query{}{}", to_string(query_id),
+                                       _dump_format == DumpFormat::Chrome ? ".json" : "");
 
+    std::vector<std::pair<ScheduleRecord, uint64_t>> records;
+    uint64_t v = 0;
+    {
+        std::unique_lock<std::mutex> l(_tg_lock);
+        v = _id_to_workload_group.at(query_id);
+    }
     ScheduleRecord record;
     while (_datas[query_id].try_dequeue(record)) {
-        uint64_t v = 0;
-        {
-            std::unique_lock<std::mutex> l(_tg_lock);
-            v = _id_to_workload_group.at(query_id);
-        }
-        auto tmp_str = record.to_string(v);
-        auto text = Slice {tmp_str};
-        THROW_IF_ERROR(writer.appendv(&text, 1));
+        records.emplace_back(std::move(record), v);
     }
-
-    THROW_IF_ERROR(writer.finalize());
-    THROW_IF_ERROR(writer.close());
+    _write_records(path, records);
 
     _last_dump_time = MonotonicSeconds();
 
@@ -132,8 +138,169 @@ void PipelineTracerContext::_dump_timeslice() {
     std::unique_lock<std::mutex> l(_data_lock); // can't rehash
 
     //TODO: if long time, per timeslice per file
-    auto path = _log_dir /
-                fmt::format("until{}", std::chrono::steady_clock::now().time_since_epoch().count());
+    auto path = _log_dir / fmt::format("until{}{}",
+                                       std::chrono::steady_clock::now().time_since_epoch().count(),
+                                       _dump_format == DumpFormat::Chrome ? ".json" : "");
+
+    // dump all query traces in this time window to one file.
+    std::vector<std::pair<ScheduleRecord, uint64_t>> records;
+    for (auto& [query_id, trace] : _datas) {
+        size_t begin = records.size();
+        ScheduleRecord record;
+        while (trace.try_dequeue(record)) {
+            records.emplace_back(std::move(record), 0);
+        }
+        if (records.size() > begin) {
+            std::unique_lock<std::mutex> l(_tg_lock);
+            uint64_t v = _id_to_workload_group.at(query_id);
+            for (size_t i = begin; i < records.size(); ++i) {
+                records[i].second = v;
+            }
+        }
+    }
+    _write_records(path, records);
+
+    _last_dump_time = MonotonicSeconds();
+
+    _datas.clear();
+    _id_to_workload_group.clear();
+}
+
+// Writes the records as chrome trace events. Each core has a lane of the task executions on it,
+// and each task has a lane of its states: blocked on a dependency, runnable in the queue, and
+// running. A flow arrow goes from where a dependency got ready to the execution it woke up.
+static std::string to_chrome_trace(
+        const std::vector<std::pair<ScheduleRecord, uint64_t>>& records) {
+    constexpr int CORES_PID = 1;
+    constexpr int TASKS_PID = 2;
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    // the caller writes the other fields of the event and ends it
+    auto begin_event = [&](const std::string& name, const char* phase, int pid, uint64_t tid,
+                           uint64_t ts) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str(), static_cast<rapidjson::SizeType>(name.size()));
+        writer.Key("ph");
+        writer.String(phase);
+        writer.Key("pid");
+        writer.Int(pid);
+        writer.Key("tid");
+        writer.Uint64(tid);
+        writer.Key("ts");
+        writer.Uint64(ts);
+    };
+    auto complete_event = [&](const std::string& name, int pid, uint64_t tid, uint64_t ts,
+                              uint64_t end) {
+        begin_event(name, "X", pid, tid, ts);
+        writer.Key("dur");
+        writer.Uint64(end - ts);
+        writer.EndObject();
+    };
+    auto name_event = [&](const char* type, int pid, uint64_t tid, const std::string& name) {
+        begin_event(type, "M", pid, tid, 0);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str(), static_cast<rapidjson::SizeType>(name.size()));
+        writer.EndObject();
+        writer.EndObject();
+    };
+
+    writer.StartObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    name_event("process_name", CORES_PID, 0, "Cores");
+    name_event("process_name", TASKS_PID, 0, "Tasks");
+
+    std::set<uint32_t> cores;
+    // task uid -> lane
+    std::unordered_map<uint64_t, uint64_t> task_lanes;
+    uint64_t flow_id = 0;
+    for (const auto& [record, workload_group] : records) {
+        cores.insert(record.core_id);
+        auto [lane_it, new_lane] = task_lanes.emplace(record.task_uid, task_lanes.size() + 1);
+        uint64_t task_lane = lane_it->second;
+        if (new_lane) {
+            name_event("thread_name", TASKS_PID, task_lane,
+                       fmt::format("{} {}", doris::to_string(record.query_id), record.task_id));
+        }
+
+        begin_event(record.task_id, "X", CORES_PID, record.core_id, record.start_time);
+        writer.Key("dur");
+        writer.Uint64(record.end_time - record.start_time);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("query_id");
+        writer.String(doris::to_string(record.query_id).c_str());
+        writer.Key("thread_id");
+        writer.Uint64(record.thread_id);
+        writer.Key("workload_group");
+        writer.Uint64(workload_group);
+        if (record.runnable_time > 0 && record.runnable_time <= record.start_time) {
+            writer.Key("queue_wait_us");
+            writer.Uint64(record.start_time - record.runnable_time);
+        }
+        if (!record.woken_by.empty()) {
+            writer.Key("woken_by");
+            writer.String(record.woken_by.c_str());
+        }
+        if (!record.blocked_by.empty()) {
+            writer.Key("blocked_by");
+            writer.String(record.blocked_by.c_str());
+        }
+        writer.EndObject();
+        writer.EndObject();
+
+        if (record.last_end_time > 0 && !record.woken_by.empty() &&
+            record.wake_up_time >= record.last_end_time) {
+            complete_event("blocked on " + record.woken_by, TASKS_PID, task_lane,
+                           record.last_end_time, record.wake_up_time);
+        }
+        if (record.runnable_time > 0 && record.runnable_time <= record.start_time) {
+            complete_event("runnable", TASKS_PID, task_lane, record.runnable_time,
+                           record.start_time);
+        }
+        complete_event("running", TASKS_PID, task_lane, record.start_time, record.end_time);
+
+        if (!record.woken_by.empty()) {
+            cores.insert(record.waker_core_id);
+            begin_event("ready: " + record.woken_by, "i", CORES_PID, record.waker_core_id,
+                        record.wake_up_time);
+            writer.Key("s");
+            writer.String("t");
+            writer.EndObject();
+            ++flow_id;
+            begin_event("wake up", "s", CORES_PID, record.waker_core_id, record.wake_up_time);
+            writer.Key("id");
+            writer.Uint64(flow_id);
+            writer.Key("cat");
+            writer.String("wake_up");
+            writer.EndObject();
+            begin_event("wake up", "f", CORES_PID, record.core_id, record.start_time);
+            writer.Key("id");
+            writer.Uint64(flow_id);
+            writer.Key("cat");
+            writer.String("wake_up");
+            writer.Key("bp");
+            writer.String("e");
+            writer.EndObject();
+        }
+    }
+    for (uint32_t core : cores) {
+        name_event("thread_name", CORES_PID, core, fmt::format("core {}", core));
+    }
+    writer.EndArray();
+    writer.Key("displayTimeUnit");
+    writer.String("ms");
+    writer.EndObject();
+    return {buffer.GetString(), buffer.GetSize()};
+}
+
+void PipelineTracerContext::_write_records(
+        const std::filesystem::path& path,
+        const std::vector<std::pair<ScheduleRecord, uint64_t>>& records) {
     int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC,
                     S_ISGID | S_ISUID | S_IWUSR | S_IRUSR | S_IWGRP | S_IRGRP | S_IWOTH | S_IROTH);
     if (fd < 0) [[unlikely]] {
@@ -142,26 +309,19 @@ void PipelineTracerContext::_dump_timeslice() {
     }
     auto writer = io::LocalFileWriter {path, fd};
 
-    // dump all query traces in this time window to one file.
-    for (auto& [query_id, trace] : _datas) {
-        ScheduleRecord record;
-        while (trace.try_dequeue(record)) {
-            uint64_t v = 0;
-            {
-                std::unique_lock<std::mutex> l(_tg_lock);
-                v = _id_to_workload_group.at(query_id);
-            }
+    if (_dump_format == DumpFormat::Chrome) {
+        auto tmp_str = to_chrome_trace(records);
+        auto text = Slice {tmp_str};
+        THROW_IF_ERROR(writer.appendv(&text, 1));
+    } else {
+        for (const auto& [record, v] : records) {
             auto tmp_str = record.to_string(v);
             auto text = Slice {tmp_str};
             THROW_IF_ERROR(writer.appendv(&text, 1));
         }
     }
+
     THROW_IF_ERROR(writer.finalize());
     THROW_IF_ERROR(writer.close());
-
-    _last_dump_time = MonotonicSeconds();
-
-    _datas.clear();
-    _id_to_workload_group.clear();
 }
 } // namespace doris::pipeline
@@ -24,6 +24,8 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
@@ -40,6 +42,20 @@ struct ScheduleRecord {
     uint64_t start_time;
     uint64_t end_time;
 
+    // Below are only in the chrome trace format, the times are in microseconds too.
+    // identifies the task among the records
+    uint64_t task_uid = 0;
+    // when the task was put in the runnable queue before this execution
+    uint64_t runnable_time = 0;
+    // the end of the last execution of the task, 0 for the first one
+    uint64_t last_end_time = 0;
+    // the dependency which woke the task up after the last execution, when and on which core
+    std::string woken_by;
+    uint64_t wake_up_time = 0;
+    uint32_t waker_core_id = 0;
+    // the dependency the task got blocked on by this execution, empty if it yielded or finished
+    std::string blocked_by;
+
     bool operator<(const ScheduleRecord& rhs) const { return start_time < rhs.start_time; }
     std::string to_string(uint64_t append_value) const {
         return fmt::format("{}|{}|{}|{}|{}|{}|{}\n", doris::to_string(query_id), task_id, core_id,
@@ -58,6 +74,10 @@ public:
         PerQuery, // record per query. one query one file.
         Periodic  // record per times. one timeslice one file.
     };
+    enum class DumpFormat {
+        Text,  // one line per record
+        Chrome // chrome trace event json, which perfetto and chrome://tracing open
+    };
     void record(ScheduleRecord record); // record one schedule record
     void end_query(TUniqueId query_id,
                    uint64_t workload_group); // tell context this query is end. may leads to dump.
@@ -69,6 +89,9 @@ private:
     // dump data to disk. one query or all.
     void _dump_query(TUniqueId query_id);
     void _dump_timeslice();
+    // write the records with the workload groups of their queries to a new file `path`
+    void _write_records(const std::filesystem::path& path,
+                        const std::vector<std::pair<ScheduleRecord, uint64_t>>& records);
 
     std::filesystem::path _log_dir = fmt::format("{}/pipe_tracing", getenv("LOG_DIR"));
 
@@ -79,6 +102,7 @@ private:
             _id_to_workload_group; // save query's workload group number
 
     RecordType _dump_type = RecordType::None;
+    DumpFormat _dump_format = DumpFormat::Text;
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "pipeline/plan_regression_detector.h"
+
+#include <bvar/bvar.h>
+#include <fmt/format.h>
+#include <gen_cpp/DataSinks_types.h>
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gen_cpp/Planner_types.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "runtime/descriptors.h"
+#include "util/hash_util.hpp"
+#include "util/runtime_profile.h"
+
+namespace doris::pipeline {
+
+bvar::Adder<int64_t> g_plan_regression_count("plan_regression_count");
+
+namespace {
+
+// the weight of the latest execution in the baselines
+constexpr double kBaselineAlpha = 0.2;
+// the rows and the spilled bytes below these are too few to tell a regression
+constexpr int64_t kMinRows = 100000;
+constexpr int64_t kMinSpilledBytes = 64L * 1024 * 1024;
+
+template <typename T>
+void hash_value(const T& value, uint64_t* hash) {
+    *hash = HashUtil::hash64(&value, sizeof(value), *hash);
+}
+
+void hash_string(const std::string& value, uint64_t* hash) {
+    *hash = HashUtil::hash64(value.data(), static_cast<int32_t>(value.size()), *hash);
+}
+
+int64_t counter_value(RuntimeProfile* profile, const std::string& name) {
+    auto* counter = profile->get_counter(name);
+    return counter == nullptr ? 0 : counter->value();
+}
+
+// An operator profile is the one with the node id as its metadata.
+bool is_operator_profile(RuntimeProfile* profile) {
+    return profile->is_set_metadata();
+}
+
+// Sums the counters of `name` in the profile and its children, except those of the other
+// operators, e.g. of the runtime filters of a scan.
+int64_t sum_operator_counter(RuntimeProfile* profile, const std::string& name) {
+    int64_t sum = counter_value(profile, name);
+    std::vector<RuntimeProfile*> children;
+    profile->get_children(&children);
+    for (auto* child : children) {
+        if (!is_operator_profile(child)) {
+            sum += sum_operator_counter(child, name);
+        }
+    }
+    return sum;
+}
+
+void summarize_profile(RuntimeProfile* profile,
+                       PlanRegressionDetector::FragmentSummary* summary) {
+    if (is_operator_profile(profile)) {
+        auto& op = summary->operators[profile->name()];
+        int64_t rows = profile->get_counter("RowsProduced") != nullptr
+                               ? counter_value(profile, "RowsProduced")
+                               : counter_value(profile, "InputRows");
+        op.rows += rows;
+        op.max_instance_rows = std::max(op.max_instance_rows, rows);
+        ++op.num_instances;
+        op.exec_time_ns += counter_value(profile, "ExecTime");
+        op.spilled_bytes += sum_operator_counter(profile, "SpillWriteDataSize");
+        op.runtime_filter_filtered_rows += sum_operator_counter(profile, "expr_filtered_rows");
+    }
+    std::vector<RuntimeProfile*> children;
+    profile->get_children(&children);
+    for (auto* child : children) {
+        summarize_profile(child, summary);
+    }
+}
+
+// Whether `value` is more than `ratio` above `baseline`, and by at least `min_diff`.
+bool above(double value, double baseline, double ratio, double min_diff) {
+    return value > baseline * (1 + ratio) && value - baseline >= min_diff;
+}
+
+void roll(double* avg, double value, double alpha) {
+    *avg += alpha * (value - *avg);
+}
+
+} // namespace
+
+PlanRegressionDetector* PlanRegressionDetector::instance() {
+    static PlanRegressionDetector instance;
+    return &instance;
+}
+
+uint64_t PlanRegressionDetector::fingerprint(const TPipelineFragmentParams& params,
+                                             const DescriptorTbl& desc_tbl) {
+    uint64_t hash = 0;
+    hash_value(params.fragment_id, &hash);
+    for (const auto& node : params.fragment.plan.nodes) {
+        hash_value(node.node_type, &hash);
+        hash_value(node.node_id, &hash);
+        hash_value(node.num_children, &hash);
+        hash_value(node.limit >= 0, &hash);
+        for (auto tuple_id : node.row_tuples) {
+            const auto* tuple = desc_tbl.get_tuple_descriptor(tuple_id);
+            if (tuple != nullptr && tuple->table_desc() != nullptr) {
+                hash_value(tuple->table_desc()->table_id(), &hash);
+            }
+        }
+        for (const auto& conjunct : node.conjuncts) {
+            for (const auto& expr_node : conjunct.nodes) {
+                hash_value(expr_node.node_type, &hash);
+                if (expr_node.__isset.fn) {
+                    hash_string(expr_node.fn.name.function_name, &hash);
+                }
+            }
+        }
+    }
+    if (params.fragment.__isset.output_sink) {
+        hash_value(params.fragment.output_sink.type, &hash);
+    }
+    // 0 stands for no fingerprint
+    return std::max<uint64_t>(hash, 1);
+}
+
+PlanRegressionDetector::FragmentSummary PlanRegressionDetector::summarize(
+        const std::vector<std::shared_ptr<RuntimeProfile>>& pipeline_profiles,
+        int64_t exec_time_ns) {
+    FragmentSummary summary;
+    summary.exec_time_ns = exec_time_ns;
+    for (const auto& profile : pipeline_profiles) {
+        summarize_profile(profile.get(), &summary);
+    }
+    return summary;
+}
+
+void PlanRegressionDetector::_compare(const std::string& name, const OperatorSummary& op,
+                                      const OperatorBaseline& baseline,
+                                      std::vector<std::string>* deviations) {
+    double ratio = config::plan_regression_ratio;
+    double min_time_ns = config::plan_regression_min_time_ms * 1000000.0;
+    if (above(op.exec_time_ns, baseline.exec_time_ns, ratio, min_time_ns)) {
+        deviations->push_back(fmt::format("{} exec time {}ms, baseline {:.0f}ms", name,
+                                          op.exec_time_ns / 1000000,
+                                          baseline.exec_time_ns / 1000000));
+    }
+    if (above(op.rows, baseline.rows, ratio, kMinRows) ||
+        above(baseline.rows, op.rows, ratio, kMinRows)) {
+        deviations->push_back(
+                fmt::format("{} rows {}, baseline {:.0f}", name, op.rows, baseline.rows));
+    }
+    if (above(op.spilled_bytes, baseline.spilled_bytes, ratio, kMinSpilledBytes)) {
+        deviations->push_back(fmt::format("{} spilled {} bytes, baseline {:.0f}", name,
+                                          op.spilled_bytes, baseline.spilled_bytes));
+    }
+    if (above(baseline.runtime_filter_filtered_rows, op.runtime_filter_filtered_rows, ratio,
+              kMinRows)) {
+        deviations->push_back(fmt::format("{} runtime filters filtered {} rows, baseline {:.0f}",
+                                          name, op.runtime_filter_filtered_rows,
+                                          baseline.runtime_filter_filtered_rows));
+    }
+    if (op.rows >= kMinRows && op.skew() >= 2 && above(op.skew(), baseline.skew, ratio, 0)) {
+        deviations->push_back(fmt::format("{} skew {:.2f} of {} instances, baseline {:.2f}", name,
+                                          op.skew(), op.num_instances, baseline.skew));
+    }
+}
+
+void PlanRegressionDetector::_roll(const FragmentSummary& summary, Baseline* baseline) {
+    // the first execution is the baseline
+    double alpha = baseline->samples == 0 ? 1 : kBaselineAlpha;
+    roll(&baseline->exec_time_ns, summary.exec_time_ns, alpha);
+    for (const auto& [name, op] : summary.operators) {
+        auto [it, inserted] = baseline->operators.try_emplace(name);
+        auto& op_baseline = it->second;
+        double op_alpha = inserted ? 1 : alpha;
+        roll(&op_baseline.rows, op.rows, op_alpha);
+        roll(&op_baseline.exec_time_ns, op.exec_time_ns, op_alpha);
+        roll(&op_baseline.spilled_bytes, op.spilled_bytes, op_alpha);
+        roll(&op_baseline.runtime_filter_filtered_rows, op.runtime_filter_filtered_rows,
+             op_alpha);
+        roll(&op_baseline.skew, op.skew(), op_alpha);
+    }
+    ++baseline->samples;
+}
+
+std::vector<std::string> PlanRegressionDetector::check(uint64_t fingerprint,
+                                                       const FragmentSummary& summary) {
+    std::vector<std::string> deviations;
+    std::lock_guard l(_lock);
+    auto [it, inserted] = _baselines.try_emplace(fingerprint);
+    auto& baseline = it->second;
+    if (inserted) {
+        _lru.push_front(fingerprint);
+        baseline.lru_pos = _lru.begin();
+        auto max_fingerprints = static_cast<size_t>(
+                std::max<int32_t>(config::plan_baseline_max_fingerprints, 1));
+        while (_baselines.size() > max_fingerprints) {
+            _baselines.erase(_lru.back());
+            _lru.pop_back();
+        }
+    } else {
+        _lru.splice(_lru.begin(), _lru, baseline.lru_pos);
+    }
+
+    if (baseline.samples >= config::plan_baseline_min_samples) {
+        if (above(summary.exec_time_ns, baseline.exec_time_ns, config::plan_regression_ratio,
+                  config::plan_regression_min_time_ms * 1000000.0)) {
+            deviations.push_back(fmt::format("fragment exec time {}ms, baseline {:.0f}ms",
+                                             summary.exec_time_ns / 1000000,
+                                             baseline.exec_time_ns / 1000000));
+        }
+        for (const auto& [name, op] : summary.operators) {
+            auto op_baseline = baseline.operators.find(name);
+            if (op_baseline != baseline.operators.end()) {
+                _compare(name, op, op_baseline->second, &deviations);
+            }
+        }
+        if (!deviations.empty()) {
+            g_plan_regression_count << 1;
+        }
+    }
+    _roll(summary, &baseline);
+    return deviations;
+}
+
+size_t PlanRegressionDetector::size() const {
+    std::lock_guard l(_lock);
+    return _baselines.size();
+}
+
+void PlanRegressionDetector::clear() {
+    std::lock_guard l(_lock);
+    _baselines.clear();
+    _lru.clear();
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace doris {
+class DescriptorTbl;
+class RuntimeProfile;
+class TPipelineFragmentParams;
+
+namespace pipeline {
+
+// Keeps rolling baselines of the fragments of the repeated queries, keyed by a fingerprint of
+// their plans, and reports the executions deviating from their baselines by more than
+// `config::plan_regression_ratio`, e.g. a runtime filter which stopped pruning, or a join whose
+// input became skewed after the data grew.
+class PlanRegressionDetector {
+public:
+    struct OperatorSummary {
+        int64_t rows = 0;
+        int64_t exec_time_ns = 0;
+        int64_t spilled_bytes = 0;
+        int64_t runtime_filter_filtered_rows = 0;
+        // the rows of the instance with the most, to find the skew
+        int64_t max_instance_rows = 0;
+        int64_t num_instances = 0;
+
+        // The rows of the largest instance to the average, 1 if not skewed.
+        double skew() const {
+            return rows > 0 ? static_cast<double>(max_instance_rows) * num_instances / rows : 1;
+        }
+    };
+
+    struct FragmentSummary {
+        int64_t exec_time_ns = 0;
+        // by the name of the operator profile, e.g. "HASH_JOIN_OPERATOR (id=3)"
+        std::map<std::string, OperatorSummary> operators;
+    };
+
+    static PlanRegressionDetector* instance();
+
+    // The fingerprint of the plan of a fragment: its plan nodes, the tables they read and the
+    // shapes of their conjuncts, without the literals, so the executions of a dashboard query
+    // with different parameters share a baseline.
+    static uint64_t fingerprint(const TPipelineFragmentParams& params,
+                                const DescriptorTbl& desc_tbl);
+
+    // Sums the operators of all the instances of a fragment from its pipeline profiles.
+    static FragmentSummary summarize(
+            const std::vector<std::shared_ptr<RuntimeProfile>>& pipeline_profiles,
+            int64_t exec_time_ns);
+
+    // Compares `summary` with the baseline of `fingerprint`, then rolls it into the baseline.
+    // Returns the deviations, none until the baseline has `config::plan_baseline_min_samples`.
+    std::vector<std::string> check(uint64_t fingerprint, const FragmentSummary& summary);
+
+    size_t size() const;
+    void clear();
+
+private:
+    // the exponential moving averages of the executions
+    struct OperatorBaseline {
+        double rows = 0;
+        double exec_time_ns = 0;
+        double spilled_bytes = 0;
+        double runtime_filter_filtered_rows = 0;
+        double skew = 1;
+    };
+
+    struct Baseline {
+        int64_t samples = 0;
+        double exec_time_ns = 0;
+        std::map<std::string, OperatorBaseline> operators;
+        std::list<uint64_t>::iterator lru_pos;
+    };
+
+    static void _compare(const std::string& name, const OperatorSummary& op,
+                         const OperatorBaseline& baseline, std::vector<std::string>* deviations);
+    static void _roll(const FragmentSummary& summary, Baseline* baseline);
+
+    mutable std::mutex _lock;
+    std::unordered_map<uint64_t, Baseline> _baselines;
+    // the fingerprints, the most recently executed first
+    std::list<uint64_t> _lru;
+};
+
+} // namespace pipeline
+} // namespace doris
@@ -17,14 +17,21 @@
 
 #include "task_queue.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
 
+#include "common/config.h"
 #include "common/logging.h"
+#include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/pipeline_task.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
+#include "util/stopwatch.hpp"
 
 namespace doris::pipeline {
 
@@ -82,9 +89,9 @@ PipelineTask* PriorityTaskQueue::_try_take_unprotected(bool is_steal) {
     return task;
 }
 
-int PriorityTaskQueue::_compute_level(uint64_t runtime) {
+int PriorityTaskQueue::compute_level(uint64_t runtime) {
     for (int i = 0; i < SUB_QUEUE_LEVEL - 1; ++i) {
-        if (runtime <= _queue_level_limit[i]) {
+        if (runtime <= QUEUE_LEVEL_LIMIT[i]) {
             return i;
         }
     }
@@ -116,7 +123,7 @@ Status PriorityTaskQueue::push(PipelineTask* task) {
     if (_closed) {
         return Status::InternalError("WorkTaskQueue closed");
     }
-    auto level = _compute_level(task->get_runtime_ns());
+    auto level = compute_level(task->get_runtime_ns());
     std::unique_lock<std::mutex> lock(_work_size_mutex);
 
     // update empty queue's  runtime, to avoid too high priority
@@ -138,8 +145,46 @@ int PriorityTaskQueue::task_size() {
 
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
-MultiCoreTaskQueue::MultiCoreTaskQueue(size_t core_size) : TaskQueue(core_size), _closed(false) {
+MultiCoreTaskQueue::MultiCoreTaskQueue(size_t core_size, const std::string& name)
+        : TaskQueue(core_size), _closed(false) {
     _prio_task_queue_list = std::make_unique<PriorityTaskQueue[]>(core_size);
+    _init_numa_topology();
+    for (int i = 0; i < num_numa_nodes(); ++i) {
+        auto prefix = name.empty() ? std::string("pipeline_task_queue") : name;
+        _numa_local_steal_counters.emplace_back(std::make_unique<bvar::Adder<int64_t>>(
+                prefix, fmt::format("numa_node_{}_local_steal", i)));
+        _numa_remote_steal_counters.emplace_back(std::make_unique<bvar::Adder<int64_t>>(
+                prefix, fmt::format("numa_node_{}_remote_steal", i)));
+    }
+}
+
+void MultiCoreTaskQueue::_init_numa_topology() {
+    _core_to_numa_node.resize(_core_size, 0);
+    _core_idx_in_numa_node.resize(_core_size, 0);
+    if (config::enable_pipeline_task_numa_aware_schedule &&
+        CpuInfo::get_max_num_numa_nodes() > 1) {
+        // Worker i is bound to cpu core (i % max_num_cores), see TaskScheduler::_do_work.
+        std::vector<int> os_node_to_node(CpuInfo::get_max_num_numa_nodes(), -1);
+        for (size_t i = 0; i < _core_size; ++i) {
+            int os_node = CpuInfo::get_numa_node_of_core(i % CpuInfo::get_max_num_cores());
+            if (os_node_to_node[os_node] == -1) {
+                os_node_to_node[os_node] = _numa_node_to_cores.size();
+                _numa_node_to_cores.emplace_back();
+            }
+            _core_to_numa_node[i] = os_node_to_node[os_node];
+        }
+    } else {
+        _numa_node_to_cores.emplace_back();
+    }
+    for (size_t i = 0; i < _core_size; ++i) {
+        auto& cores = _numa_node_to_cores[_core_to_numa_node[i]];
+        _core_idx_in_numa_node[i] = cores.size();
+        cores.push_back(i);
+    }
+    _next_core_of_numa_node = std::make_unique<std::atomic<size_t>[]>(num_numa_nodes());
+    for (int i = 0; i < num_numa_nodes(); ++i) {
+        _next_core_of_numa_node[i] = 0;
+    }
 }
 
 void MultiCoreTaskQueue::close() {
@@ -151,17 +196,29 @@ void MultiCoreTaskQueue::close() {
 
 PipelineTask* MultiCoreTaskQueue::take(size_t core_id) {
     PipelineTask* task = nullptr;
+    const int64_t cross_numa_idle_ns =
+            config::pipeline_task_cross_numa_steal_idle_ms * 1000L * 1000L;
+    MonotonicStopWatch idle_watcher;
+    idle_watcher.start();
     while (!_closed) {
         task = _prio_task_queue_list[core_id].try_take(false);
         if (task) {
             task->set_core_id(core_id);
             break;
         }
-        task = _steal_take(core_id);
+        const int64_t idle_ns = idle_watcher.elapsed_time();
+        const bool allow_cross_numa = num_numa_nodes() == 1 || idle_ns >= cross_numa_idle_ns;
+        task = _steal_take(core_id, allow_cross_numa);
         if (task) {
             break;
         }
-        task = _prio_task_queue_list[core_id].take(WAIT_CORE_TASK_TIMEOUT_MS /* timeout_ms */);
+        uint32_t timeout_ms = WAIT_CORE_TASK_TIMEOUT_MS;
+        if (!allow_cross_numa) {
+            // Wake up in time to steal from other numa nodes.
+            timeout_ms = std::max<int64_t>(
+                    1, std::min<int64_t>(timeout_ms, (cross_numa_idle_ns - idle_ns) / 1000000));
+        }
+        task = _prio_task_queue_list[core_id].take(timeout_ms);
         if (task) {
             task->set_core_id(core_id);
             break;
@@ -173,13 +230,40 @@ PipelineTask* MultiCoreTaskQueue::take(size_t core_id) {
     return task;
 }
 
-PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id) {
+PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id, bool allow_cross_numa) {
     DCHECK(core_id < _core_size);
-    size_t next_id = core_id;
-    for (size_t i = 1; i < _core_size; ++i) {
-        ++next_id;
-        if (next_id == _core_size) {
-            next_id = 0;
+    const int local_node = _core_to_numa_node[core_id];
+    auto task = _steal_take_from_node(core_id, local_node);
+    if (task) {
+        *_numa_local_steal_counters[local_node] << 1;
+        return task;
+    }
+    if (!allow_cross_numa) {
+        return nullptr;
+    }
+    for (int i = 1; i < num_numa_nodes(); ++i) {
+        task = _steal_take_from_node(core_id, (local_node + i) % num_numa_nodes());
+        if (task) {
+            *_numa_remote_steal_counters[local_node] << 1;
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTask* MultiCoreTaskQueue::_steal_take_from_node(size_t core_id, int numa_node) {
+    const auto& cores = _numa_node_to_cores[numa_node];
+    // Start from the neighbour of `core_id` so that thieves of a node spread out.
+    size_t next_idx = numa_node == _core_to_numa_node[core_id] ? _core_idx_in_numa_node[core_id]
+                                                                : core_id % cores.size();
+    for (size_t i = 0; i < cores.size(); ++i) {
+        ++next_idx;
+        if (next_idx == cores.size()) {
+            next_idx = 0;
+        }
+        size_t next_id = cores[next_idx];
+        if (next_id == core_id) {
+            continue;
         }
         DCHECK(next_id < _core_size);
         auto task = _prio_task_queue_list[next_id].try_take(true);
@@ -191,10 +275,43 @@ PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id) {
     return nullptr;
 }
 
+int MultiCoreTaskQueue::_numa_node_of_task(PipelineTask* task) {
+    int numa_node = task->get_numa_node();
+    if (numa_node < 0) {
+        // All tasks of a fragment share one numa node, so that the hash tables built by
+        // one task are probed by the tasks on the same node.
+        numa_node = task->fragment_context()->bind_numa_node(_next_numa_node.fetch_add(1) %
+                                                             num_numa_nodes());
+        task->set_numa_node(numa_node);
+    }
+    return numa_node % num_numa_nodes();
+}
+
+size_t MultiCoreTaskQueue::_affinity_core(size_t core_id) {
+    const int threshold = config::pipeline_task_core_affinity_queue_threshold;
+    const size_t queued = _prio_task_queue_list[core_id].approximate_task_size();
+    if (threshold < 0 || queued <= static_cast<size_t>(threshold)) {
+        return core_id;
+    }
+    const auto& cores = _numa_node_to_cores[_core_to_numa_node[core_id]];
+    size_t candidate = cores[_next_core.fetch_add(1) % cores.size()];
+    return _prio_task_queue_list[candidate].approximate_task_size() < queued ? candidate
+                                                                             : core_id;
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTask* task) {
     int core_id = task->get_previous_core_id();
-    if (core_id < 0) {
-        core_id = _next_core.fetch_add(1) % _core_size;
+    if (core_id >= 0) {
+        // Keep the task on the core that last ran it for cache locality.
+        core_id = _affinity_core(core_id);
+    } else {
+        if (num_numa_nodes() == 1) {
+            core_id = _next_core.fetch_add(1) % _core_size;
+        } else {
+            int numa_node = _numa_node_of_task(task);
+            const auto& cores = _numa_node_to_cores[numa_node];
+            core_id = cores[_next_core_of_numa_node[numa_node].fetch_add(1) % cores.size()];
+        }
     }
     return push_back(task, core_id);
 }
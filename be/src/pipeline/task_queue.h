@@ -16,6 +16,7 @@
 // under the License.
 #pragma once
 
+#include <bvar/bvar.h>
 #include <glog/logging.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -27,6 +28,8 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "pipeline_task.h"
@@ -50,6 +53,9 @@ public:
 
     virtual void update_statistics(PipelineTask* task, int64_t time_spent) {}
 
+    // Approximate number of runnable tasks waiting for the core, used as a load hint.
+    virtual size_t runnable_task_size(size_t core_id) const { return 0; }
+
     int cores() const { return _core_size; }
 
 protected:
@@ -105,14 +111,22 @@ public:
 
     int task_size();
 
-private:
-    PipelineTask* _try_take_unprotected(bool is_steal);
+    // Lock free and may be stale, only used as a load hint.
+    size_t approximate_task_size() const {
+        return _total_task_size.load(std::memory_order_relaxed);
+    }
+
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
+
+    static int compute_level(uint64_t real_runtime);
+
+private:
+    PipelineTask* _try_take_unprotected(bool is_steal);
     SubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
     // 1s, 3s, 10s, 60s, 300s
-    uint64_t _queue_level_limit[SUB_QUEUE_LEVEL - 1] = {1000000000, 3000000000, 10000000000,
-                                                        60000000000, 300000000000};
+    static constexpr uint64_t QUEUE_LEVEL_LIMIT[SUB_QUEUE_LEVEL - 1] = {
+            1000000000, 3000000000, 10000000000, 60000000000, 300000000000};
     std::mutex _work_size_mutex;
     std::condition_variable _wait_task;
     std::atomic<size_t> _total_task_size = 0;
@@ -121,14 +135,15 @@ private:
     // used to adjust vruntime of a queue when it's not empty
     // protected by lock _work_size_mutex
     uint64_t _queue_level_min_vruntime = 0;
-
-    int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// Workers are grouped by the NUMA node of the core they are running on. A worker steals
+// tasks from the workers of its own node first, and only steals from other nodes after
+// it has been idle for `pipeline_task_cross_numa_steal_idle_ms`. Without NUMA awareness
+// all workers belong to a single node.
 class MultiCoreTaskQueue : public TaskQueue {
 public:
-    explicit MultiCoreTaskQueue(size_t core_size);
+    explicit MultiCoreTaskQueue(size_t core_size, const std::string& name = "");
 
     ~MultiCoreTaskQueue() override;
 
@@ -144,12 +159,51 @@ public:
 
     void update_statistics(PipelineTask* task, int64_t time_spent) override;
 
+    size_t runnable_task_size(size_t core_id) const override {
+        return _prio_task_queue_list[core_id].approximate_task_size();
+    }
+
+    int num_numa_nodes() const { return _numa_node_to_cores.size(); }
+
+    int numa_node_of_core(size_t core_id) const { return _core_to_numa_node[core_id]; }
+
+    int64_t local_steal_count(int numa_node) const {
+        return _numa_local_steal_counters[numa_node]->get_value();
+    }
+
+    int64_t remote_steal_count(int numa_node) const {
+        return _numa_remote_steal_counters[numa_node]->get_value();
+    }
+
 private:
-    PipelineTask* _steal_take(size_t core_id);
+    void _init_numa_topology();
+
+    int _numa_node_of_task(PipelineTask* task);
+
+    PipelineTask* _steal_take(size_t core_id, bool allow_cross_numa);
+
+    PipelineTask* _steal_take_from_node(size_t core_id, int numa_node);
+
+    // Returns the core to resubmit a task last ran on `core_id`, which is `core_id` itself
+    // unless it is overloaded and a core of the same numa node has fewer tasks.
+    size_t _affinity_core(size_t core_id);
 
     std::unique_ptr<PriorityTaskQueue[]> _prio_task_queue_list;
     std::atomic<size_t> _next_core = 0;
     std::atomic<bool> _closed;
+
+    // core id -> numa node, numa node -> core ids. Numa nodes without any worker are
+    // dropped, so numa node ids here are dense and may differ from the os ids.
+    std::vector<int> _core_to_numa_node;
+    std::vector<std::vector<size_t>> _numa_node_to_cores;
+    // The index of a core in `_numa_node_to_cores[_core_to_numa_node[core]]`.
+    std::vector<size_t> _core_idx_in_numa_node;
+    std::unique_ptr<std::atomic<size_t>[]> _next_core_of_numa_node;
+    std::atomic<size_t> _next_numa_node = 0;
+
+    // Steal counters of each numa node, counted on the node of the thief.
+    std::vector<std::unique_ptr<bvar::Adder<int64_t>>> _numa_local_steal_counters;
+    std::vector<std::unique_ptr<bvar::Adder<int64_t>>> _numa_remote_steal_counters;
 };
 
 } // namespace doris::pipeline
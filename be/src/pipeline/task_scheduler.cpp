@@ -21,6 +21,7 @@
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/types.pb.h>
 #include <glog/logging.h>
+#include <pthread.h>
 #include <sched.h>
 
 // IWYU pragma: no_include <bits/chrono.h>
@@ -31,12 +32,15 @@
 #include <thread>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
 #include "pipeline/task_queue.h"
+#include "pipeline/work_stealing_task_queue.h"
 #include "pipeline_fragment_context.h"
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
+#include "util/cpu_info.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -66,6 +70,14 @@ Status TaskScheduler::start() {
     return Status::OK();
 }
 
+std::shared_ptr<TaskQueue> TaskScheduler::create_task_queue(size_t core_size,
+                                                            const std::string& name) {
+    if (config::pipeline_task_queue_type == "work_stealing") {
+        return std::make_shared<WorkStealingTaskQueue>(core_size);
+    }
+    return std::make_shared<MultiCoreTaskQueue>(core_size, name);
+}
+
 Status TaskScheduler::schedule_task(PipelineTask* task) {
     return _task_queue->push_back(task);
     // TODO control num of task
@@ -94,7 +106,29 @@ void _close_task(PipelineTask* task, Status exec_status) {
     task->fragment_context()->close_a_pipeline();
 }
 
+// Bind the executor thread to the cpu cores of its numa node, keep consistent with
+// MultiCoreTaskQueue::_init_numa_topology.
+static void _bind_to_numa_node(size_t index) {
+#ifndef __APPLE__
+    int numa_node = CpuInfo::get_numa_node_of_core(index % CpuInfo::get_max_num_cores());
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    for (int core : CpuInfo::get_cores_of_numa_node(numa_node)) {
+        CPU_SET(core, &cpuset);
+    }
+    int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+    if (ret != 0) {
+        LOG(WARNING) << "failed to bind pipeline executor " << index << " to numa node "
+                     << numa_node << ", errno=" << ret;
+    }
+#endif
+}
+
 void TaskScheduler::_do_work(size_t index) {
+    if (config::enable_pipeline_task_numa_aware_schedule &&
+        CpuInfo::get_max_num_numa_nodes() > 1) {
+        _bind_to_numa_node(index);
+    }
     while (_markers[index]) {
         auto* task = _task_queue->take(index);
         if (!task) {
@@ -143,13 +177,15 @@ void TaskScheduler::_do_work(size_t index) {
 #endif
                 std::thread::id tid = std::this_thread::get_id();
                 uint64_t thread_id = *reinterpret_cast<uint64_t*>(&tid);
-                uint64_t start_time = MonotonicMicros();
+                ScheduleRecord record {query_id, task_name, core_id, thread_id};
+                task->begin_schedule_record(&record);
+                record.start_time = MonotonicMicros();
 
                 status = task->execute(&eos);
 
-                uint64_t end_time = MonotonicMicros();
-                ExecEnv::GetInstance()->pipeline_tracer_context()->record(
-                        {query_id, task_name, core_id, thread_id, start_time, end_time});
+                record.end_time = MonotonicMicros();
+                task->end_schedule_record(&record, eos);
+                ExecEnv::GetInstance()->pipeline_tracer_context()->record(std::move(record));
             } else {
                 status = task->execute(&eos);
             }
@@ -24,6 +24,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -63,6 +64,9 @@ public:
 
     TaskQueue* task_queue() const { return _task_queue.get(); }
 
+    // Create the task queue configured by `pipeline_task_queue_type`.
+    static std::shared_ptr<TaskQueue> create_task_queue(size_t core_size, const std::string& name);
+
 private:
     std::unique_ptr<ThreadPool> _fix_thread_pool;
     std::shared_ptr<TaskQueue> _task_queue;
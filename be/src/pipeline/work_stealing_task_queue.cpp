@@ -0,0 +1,355 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/work_stealing_task_queue.h"
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include <climits>
+// IWYU pragma: no_include <bits/chrono.h>
+#include <chrono> // IWYU pragma: keep
+
+#include "common/logging.h"
+#include "pipeline/pipeline_task.h"
+
+namespace doris::pipeline {
+
+// The queue and the core that the current worker thread takes tasks for. Tasks pushed
+// by the owner of a core go to its deques directly, others go to the inbox.
+static thread_local const WorkStealingTaskQueue* tls_task_queue = nullptr;
+static thread_local size_t tls_core_id = 0;
+
+////////////////////  WorkStealingDeque ////////////////////
+
+WorkStealingDeque::WorkStealingDeque(int64_t capacity) {
+    DCHECK(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    _arrays.emplace_back(std::make_unique<Array>(capacity));
+    _array.store(_arrays.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() = default;
+
+void WorkStealingDeque::push(PipelineTask* task) {
+    int64_t b = _bottom.load(std::memory_order_relaxed);
+    int64_t t = _top.load(std::memory_order_acquire);
+    Array* array = _array.load(std::memory_order_relaxed);
+    if (b - t > array->capacity - 1) {
+        array = _grow(array, b, t);
+    }
+    array->put(b, task);
+    std::atomic_thread_fence(std::memory_order_release);
+    _bottom.store(b + 1, std::memory_order_relaxed);
+}
+
+PipelineTask* WorkStealingDeque::steal() {
+    int64_t t = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = _bottom.load(std::memory_order_acquire);
+    if (t >= b) {
+        return nullptr;
+    }
+    Array* array = _array.load(std::memory_order_acquire);
+    PipelineTask* task = array->get(t);
+    if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return task;
+}
+
+WorkStealingDeque::Array* WorkStealingDeque::_grow(Array* array, int64_t bottom, int64_t top) {
+    auto new_array = std::make_unique<Array>(array->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i) {
+        new_array->put(i, array->get(i));
+    }
+    Array* res = new_array.get();
+    _arrays.emplace_back(std::move(new_array));
+    _array.store(res, std::memory_order_release);
+    return res;
+}
+
+////////////////////  EventCount ////////////////////
+
+void EventCount::wait(Key key, uint32_t timeout_ms) {
+#ifdef __linux__
+    struct timespec ts;
+    ts.tv_sec = timeout_ms / 1000;
+    ts.tv_nsec = (timeout_ms % 1000) * 1000000L;
+    // Returns immediately if the epoch has been changed since `prepare_wait`.
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch), FUTEX_WAIT_PRIVATE, key, &ts,
+            nullptr, 0);
+#else
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                     [&] { return _epoch.load(std::memory_order_acquire) != key; });
+    }
+#endif
+    _waiters.fetch_sub(1, std::memory_order_seq_cst);
+}
+
+void EventCount::notify(bool all) {
+    // Pairs with the seq_cst increment in `prepare_wait`, either the waiter sees the pushed
+    // task in its re-check or we see the waiter here.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (_waiters.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+#ifdef __linux__
+    _epoch.fetch_add(1, std::memory_order_release);
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_epoch), FUTEX_WAKE_PRIVATE,
+            all ? INT_MAX : 1, nullptr, nullptr, 0);
+#else
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _epoch.fetch_add(1, std::memory_order_release);
+    }
+    if (all) {
+        _cv.notify_all();
+    } else {
+        _cv.notify_one();
+    }
+#endif
+}
+
+////////////////////  WorkStealingTaskQueue ////////////////////
+
+WorkStealingTaskQueue::CoreQueue::CoreQueue() {
+    double factor = 1;
+    for (int i = SUB_QUEUE_LEVEL - 1; i >= 0; i--) {
+        runtime[i] = 0;
+        level_factor[i] = factor;
+        factor *= PriorityTaskQueue::LEVEL_QUEUE_TIME_FACTOR;
+    }
+}
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(size_t core_size)
+        : TaskQueue(core_size), _closed(false) {
+    _core_queues = std::make_unique<CoreQueue[]>(core_size);
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() = default;
+
+void WorkStealingTaskQueue::close() {
+    _closed = true;
+    _event_count.notify(true);
+}
+
+PipelineTask* WorkStealingTaskQueue::take(size_t core_id) {
+    DCHECK(core_id < _core_size);
+    tls_task_queue = this;
+    tls_core_id = core_id;
+    PipelineTask* task = nullptr;
+    while (!_closed) {
+        task = _take_local(core_id);
+        if (task) {
+            break;
+        }
+        task = _steal_take(core_id);
+        if (task) {
+            break;
+        }
+        auto key = _event_count.prepare_wait();
+        if (_closed || _has_task()) {
+            _event_count.cancel_wait();
+            continue;
+        }
+        _event_count.wait(key, WAIT_CORE_TASK_TIMEOUT_MS);
+    }
+    if (task) {
+        task->pop_out_runnable_queue();
+    }
+    return task;
+}
+
+Status WorkStealingTaskQueue::push_back(PipelineTask* task) {
+    int core_id = task->get_previous_core_id();
+    if (core_id < 0) {
+        core_id = _next_core.fetch_add(1) % _core_size;
+    }
+    return push_back(task, core_id);
+}
+
+Status WorkStealingTaskQueue::push_back(PipelineTask* task, size_t core_id) {
+    DCHECK(core_id < _core_size);
+    if (_closed) {
+        return Status::InternalError("WorkStealingTaskQueue closed");
+    }
+    task->put_in_runnable_queue();
+    if (tls_task_queue == this && tls_core_id == core_id) {
+        _push_to_deque(task, core_id);
+    } else {
+        auto& inbox = _core_queues[core_id].inbox;
+        PipelineTask* head = inbox.load(std::memory_order_relaxed);
+        do {
+            task->set_next_in_queue(head);
+        } while (!inbox.compare_exchange_weak(head, task, std::memory_order_release,
+                                              std::memory_order_relaxed));
+    }
+    _event_count.notify();
+    return Status::OK();
+}
+
+void WorkStealingTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
+    task->inc_runtime_ns(time_spent);
+    _core_queues[task->get_core_id()].runtime[task->get_queue_level()].fetch_add(
+            time_spent, std::memory_order_relaxed);
+}
+
+size_t WorkStealingTaskQueue::runnable_task_size(size_t core_id) const {
+    const auto& queue = _core_queues[core_id];
+    size_t size = queue.inbox.load(std::memory_order_relaxed) != nullptr ? 1 : 0;
+    for (int level = 0; level < SUB_QUEUE_LEVEL; ++level) {
+        size += queue.sub_queues[level].size();
+    }
+    return size;
+}
+
+void WorkStealingTaskQueue::_push_to_deque(PipelineTask* task, size_t core_id) {
+    auto& queue = _core_queues[core_id];
+    auto level = PriorityTaskQueue::compute_level(task->get_runtime_ns());
+    // update empty queue's runtime, to avoid too high priority
+    if (queue.sub_queues[level].empty() && queue.min_vruntime > queue.get_vruntime(level)) {
+        queue.runtime[level].store(uint64_t(queue.min_vruntime * queue.level_factor[level]),
+                                   std::memory_order_relaxed);
+    }
+    queue.sub_queues[level].push(task);
+}
+
+PipelineTask* WorkStealingTaskQueue::_grab_inbox(size_t core_id) {
+    auto& inbox = _core_queues[core_id].inbox;
+    if (inbox.load(std::memory_order_relaxed) == nullptr) {
+        return nullptr;
+    }
+    PipelineTask* head = inbox.exchange(nullptr, std::memory_order_acquire);
+    // The inbox is a stack, reverse it to keep the push order.
+    PipelineTask* reversed = nullptr;
+    while (head) {
+        PipelineTask* next = head->next_in_queue();
+        head->set_next_in_queue(reversed);
+        reversed = head;
+        head = next;
+    }
+    return reversed;
+}
+
+void WorkStealingTaskQueue::_push_list_to_deque(PipelineTask* list, size_t core_id) {
+    while (list) {
+        PipelineTask* next = list->next_in_queue();
+        list->set_next_in_queue(nullptr);
+        _push_to_deque(list, core_id);
+        list = next;
+    }
+}
+
+PipelineTask* WorkStealingTaskQueue::_take_local(size_t core_id) {
+    _push_list_to_deque(_grab_inbox(core_id), core_id);
+    auto& queue = _core_queues[core_id];
+    while (true) {
+        double min_vruntime = 0;
+        int level = -1;
+        for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
+            if (!queue.sub_queues[i].empty()) {
+                double cur_queue_vruntime = queue.get_vruntime(i);
+                if (level == -1 || cur_queue_vruntime < min_vruntime) {
+                    level = i;
+                    min_vruntime = cur_queue_vruntime;
+                }
+            }
+        }
+        if (level == -1) {
+            return nullptr;
+        }
+        queue.min_vruntime = uint64_t(min_vruntime);
+        // May lose the race with a thief, then pick again.
+        auto* task = queue.sub_queues[level].steal();
+        if (task) {
+            task->update_queue_level(level);
+            task->set_core_id(core_id);
+            return task;
+        }
+    }
+}
+
+PipelineTask* WorkStealingTaskQueue::_steal_take(size_t core_id) {
+    size_t next_id = core_id;
+    for (size_t i = 1; i < _core_size; ++i) {
+        ++next_id;
+        if (next_id == _core_size) {
+            next_id = 0;
+        }
+        auto& victim = _core_queues[next_id];
+        for (int level = 0; level < SUB_QUEUE_LEVEL; ++level) {
+            while (!victim.sub_queues[level].empty()) {
+                auto* task = victim.sub_queues[level].steal();
+                if (task) {
+                    task->update_queue_level(level);
+                    task->set_core_id(next_id);
+                    return task;
+                }
+            }
+        }
+    }
+    // The victims are busy and have not moved their inbox into the deques yet.
+    next_id = core_id;
+    for (size_t i = 1; i < _core_size; ++i) {
+        ++next_id;
+        if (next_id == _core_size) {
+            next_id = 0;
+        }
+        auto* task = _steal_from_inbox(next_id, core_id);
+        if (task) {
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTask* WorkStealingTaskQueue::_steal_from_inbox(size_t victim_id, size_t core_id) {
+    PipelineTask* task = _grab_inbox(victim_id);
+    if (task == nullptr) {
+        return nullptr;
+    }
+    // Run the oldest one and keep the others in our own deques.
+    _push_list_to_deque(task->next_in_queue(), core_id);
+    task->set_next_in_queue(nullptr);
+    task->update_queue_level(PriorityTaskQueue::compute_level(task->get_runtime_ns()));
+    task->set_core_id(core_id);
+    return task;
+}
+
+bool WorkStealingTaskQueue::_has_task() const {
+    for (size_t i = 0; i < _core_size; ++i) {
+        const auto& queue = _core_queues[i];
+        if (queue.inbox.load(std::memory_order_relaxed) != nullptr) {
+            return true;
+        }
+        for (int level = 0; level < SUB_QUEUE_LEVEL; ++level) {
+            if (!queue.sub_queues[level].empty()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifndef __linux__
+#include <condition_variable>
+#include <mutex>
+#endif
+
+#include "common/status.h"
+#include "pipeline/task_queue.h"
+
+namespace doris::pipeline {
+
+class PipelineTask;
+
+// A Chase-Lev style deque. Only the owner thread pushes at the bottom, every thread
+// (the owner included) takes from the top with a CAS, so tasks are taken in FIFO order
+// which keeps the multilevel feedback semantics of the sub queues.
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(int64_t capacity = 1024);
+
+    ~WorkStealingDeque();
+
+    // Only called by the owner thread.
+    void push(PipelineTask* task);
+
+    // Called by any thread. Returns nullptr if the deque is empty or a concurrent take wins.
+    PipelineTask* steal();
+
+    int64_t size() const {
+        int64_t b = _bottom.load(std::memory_order_relaxed);
+        int64_t t = _top.load(std::memory_order_relaxed);
+        return b > t ? b - t : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Array {
+        explicit Array(int64_t capacity_)
+                : capacity(capacity_),
+                  mask(capacity_ - 1),
+                  buffer(std::make_unique<std::atomic<PipelineTask*>[]>(capacity_)) {}
+
+        PipelineTask* get(int64_t i) const {
+            return buffer[i & mask].load(std::memory_order_relaxed);
+        }
+        void put(int64_t i, PipelineTask* task) {
+            buffer[i & mask].store(task, std::memory_order_relaxed);
+        }
+
+        const int64_t capacity;
+        const int64_t mask;
+        std::unique_ptr<std::atomic<PipelineTask*>[]> buffer;
+    };
+
+    Array* _grow(Array* array, int64_t bottom, int64_t top);
+
+    alignas(64) std::atomic<int64_t> _top {0};
+    alignas(64) std::atomic<int64_t> _bottom {0};
+    std::atomic<Array*> _array;
+    // Owns the current and the retired arrays, thieves may still read a retired array
+    // after a grow, so all of them are freed with the deque.
+    std::vector<std::unique_ptr<Array>> _arrays;
+};
+
+// Lets idle workers park without a mutex on the push path. A waiter takes a key by
+// `prepare_wait`, re-checks the queues and then `wait`s on the key. `notify` only
+// touches the futex when there are waiters.
+class EventCount {
+public:
+    using Key = uint32_t;
+
+    Key prepare_wait() {
+        _waiters.fetch_add(1, std::memory_order_seq_cst);
+        return _epoch.load(std::memory_order_acquire);
+    }
+
+    void cancel_wait() { _waiters.fetch_sub(1, std::memory_order_seq_cst); }
+
+    void wait(Key key, uint32_t timeout_ms);
+
+    void notify(bool all = false);
+
+private:
+    std::atomic<uint32_t> _epoch {0};
+    std::atomic<int32_t> _waiters {0};
+#ifndef __linux__
+    std::mutex _mutex;
+    std::condition_variable _cv;
+#endif
+};
+
+// A lock-free alternative of MultiCoreTaskQueue. Each core owns a WorkStealingDeque for
+// every level of the multilevel feedback queue, and a lock-free inbox that other threads
+// push into. The owner moves the inbox into its deques when it takes tasks, thieves steal
+// from the deques of other cores or grab their whole inbox.
+class WorkStealingTaskQueue : public TaskQueue {
+public:
+    explicit WorkStealingTaskQueue(size_t core_size);
+
+    ~WorkStealingTaskQueue() override;
+
+    void close() override;
+
+    PipelineTask* take(size_t core_id) override;
+
+    Status push_back(PipelineTask* task) override;
+
+    Status push_back(PipelineTask* task, size_t core_id) override;
+
+    void update_statistics(PipelineTask* task, int64_t time_spent) override;
+
+    size_t runnable_task_size(size_t core_id) const override;
+
+private:
+    static constexpr size_t SUB_QUEUE_LEVEL = PriorityTaskQueue::SUB_QUEUE_LEVEL;
+
+    struct alignas(64) CoreQueue {
+        CoreQueue();
+
+        double get_vruntime(int level) const {
+            return runtime[level].load(std::memory_order_relaxed) / level_factor[level];
+        }
+
+        WorkStealingDeque sub_queues[SUB_QUEUE_LEVEL];
+        std::atomic<uint64_t> runtime[SUB_QUEUE_LEVEL];
+        double level_factor[SUB_QUEUE_LEVEL];
+        // Intrusive stack of tasks pushed by other threads, linked by `next_in_queue`.
+        std::atomic<PipelineTask*> inbox {nullptr};
+        // Only accessed by the owner.
+        uint64_t min_vruntime = 0;
+    };
+
+    // Only called by the owner of `core_id`.
+    void _push_to_deque(PipelineTask* task, size_t core_id);
+    void _push_list_to_deque(PipelineTask* list, size_t core_id);
+    PipelineTask* _take_local(size_t core_id);
+
+    // Takes all tasks in the inbox of `core_id`, returns them as a list in push order.
+    PipelineTask* _grab_inbox(size_t core_id);
+
+    PipelineTask* _steal_take(size_t core_id);
+    PipelineTask* _steal_from_inbox(size_t victim_id, size_t core_id);
+
+    bool _has_task() const;
+
+    std::unique_ptr<CoreQueue[]> _core_queues;
+    EventCount _event_count;
+    std::atomic<size_t> _next_core = 0;
+    std::atomic<bool> _closed;
+};
+
+} // namespace doris::pipeline
@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/workload_group_fair_task_queue.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "common/logging.h"
+#include "pipeline/pipeline_task.h"
+#include "runtime/query_context.h"
+#include "runtime/workload_group/workload_group.h"
+
+namespace doris::pipeline {
+
+// Same as the default cpu share of a workload group.
+static constexpr uint64_t DEFAULT_CPU_SHARE = 1024;
+// Tasks of queries without a workload group.
+static constexpr uint64_t WITHOUT_GROUP_ID = std::numeric_limits<uint64_t>::max();
+
+WorkloadGroupFairTaskQueue::GroupQueue::GroupQueue(uint64_t group_id_, size_t core_size)
+        : group_id(group_id_), cpu_share(DEFAULT_CPU_SHARE) {
+    prio_task_queue_list = std::make_unique<PriorityTaskQueue[]>(core_size);
+}
+
+WorkloadGroupFairTaskQueue::WorkloadGroupFairTaskQueue(size_t core_size)
+        : TaskQueue(core_size), _closed(false) {
+    _groups = std::make_unique<std::atomic<GroupQueue*>[]>(MAX_GROUP_NUM);
+    for (size_t i = 0; i < MAX_GROUP_NUM; ++i) {
+        _groups[i] = nullptr;
+    }
+}
+
+WorkloadGroupFairTaskQueue::~WorkloadGroupFairTaskQueue() = default;
+
+void WorkloadGroupFairTaskQueue::close() {
+    _closed = true;
+    size_t num_groups = _num_groups.load();
+    for (size_t i = 0; i < num_groups; ++i) {
+        auto* group = _groups[i].load();
+        for (size_t j = 0; j < _core_size; ++j) {
+            group->prio_task_queue_list[j].close();
+        }
+    }
+    _event_count.notify(true);
+}
+
+WorkloadGroupFairTaskQueue::GroupQueue* WorkloadGroupFairTaskQueue::_group_queue_of_task(
+        PipelineTask* task) {
+    auto wg = task->query_context()->workload_group();
+    int idx = task->get_group_queue_idx();
+    if (idx < 0) {
+        uint64_t group_id = wg ? wg->id() : WITHOUT_GROUP_ID;
+        std::lock_guard<std::mutex> l(_group_lock);
+        size_t num_groups = _num_groups.load();
+        for (size_t i = 0; i < num_groups; ++i) {
+            if (_groups[i].load()->group_id == group_id) {
+                idx = i;
+                break;
+            }
+        }
+        if (idx < 0) {
+            if (num_groups == MAX_GROUP_NUM) {
+                // Should not happen, the number of workload groups is limited by FE.
+                LOG(WARNING) << "too many workload groups in task queue, group " << group_id
+                             << " shares the queue of the tasks without group";
+                idx = 0;
+            } else {
+                _group_holder.emplace_back(std::make_unique<GroupQueue>(group_id, _core_size));
+                _groups[num_groups] = _group_holder.back().get();
+                idx = num_groups;
+                _num_groups = num_groups + 1;
+            }
+        }
+        task->set_group_queue_idx(idx);
+    }
+    auto* group = _groups[idx].load();
+    if (wg && wg->id() == group->group_id) {
+        // cpu share may be changed by FE at any time.
+        group->cpu_share = std::max<uint64_t>(wg->cpu_share(), 1);
+    }
+    return group;
+}
+
+Status WorkloadGroupFairTaskQueue::push_back(PipelineTask* task) {
+    int core_id = task->get_previous_core_id();
+    if (core_id < 0) {
+        core_id = _next_core.fetch_add(1) % _core_size;
+    }
+    return push_back(task, core_id);
+}
+
+Status WorkloadGroupFairTaskQueue::push_back(PipelineTask* task, size_t core_id) {
+    DCHECK(core_id < _core_size);
+    if (_closed) {
+        return Status::InternalError("WorkloadGroupFairTaskQueue closed");
+    }
+    auto* group = _group_queue_of_task(task);
+    task->put_in_runnable_queue();
+    if (group->task_size.fetch_add(1) == 0) {
+        // The group becomes runnable, do not let it make up the time when it was idle.
+        uint64_t min_vruntime = _min_vruntime.load(std::memory_order_relaxed);
+        if (group->vruntime.load(std::memory_order_relaxed) < min_vruntime) {
+            group->vruntime.store(min_vruntime, std::memory_order_relaxed);
+        }
+    }
+    auto st = group->prio_task_queue_list[core_id].push(task);
+    if (!st.ok()) {
+        group->task_size--;
+        return st;
+    }
+    _total_task_size++;
+    _event_count.notify();
+    return Status::OK();
+}
+
+PipelineTask* WorkloadGroupFairTaskQueue::take(size_t core_id) {
+    PipelineTask* task = nullptr;
+    while (!_closed) {
+        task = _try_take(core_id);
+        if (task) {
+            break;
+        }
+        auto key = _event_count.prepare_wait();
+        if (_closed || _total_task_size.load() > 0) {
+            _event_count.cancel_wait();
+            continue;
+        }
+        _event_count.wait(key, WAIT_CORE_TASK_TIMEOUT_MS);
+    }
+    if (task) {
+        task->pop_out_runnable_queue();
+    }
+    return task;
+}
+
+PipelineTask* WorkloadGroupFairTaskQueue::_try_take(size_t core_id) {
+    if (_total_task_size.load() <= 0) {
+        return nullptr;
+    }
+    // Runnable groups ordered by vruntime, the first one that gives a task wins.
+    std::vector<std::pair<uint64_t, GroupQueue*>> candidates;
+    size_t num_groups = _num_groups.load();
+    for (size_t i = 0; i < num_groups; ++i) {
+        auto* group = _groups[i].load();
+        if (group->task_size.load(std::memory_order_relaxed) > 0) {
+            candidates.emplace_back(group->vruntime.load(std::memory_order_relaxed), group);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& l, const auto& r) { return l.first < r.first; });
+    for (auto& [vruntime, group] : candidates) {
+        auto* task = _try_take_from_group(group, core_id);
+        if (task) {
+            group->task_size--;
+            _total_task_size--;
+            if (vruntime > _min_vruntime.load(std::memory_order_relaxed)) {
+                _min_vruntime.store(vruntime, std::memory_order_relaxed);
+            }
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTask* WorkloadGroupFairTaskQueue::_try_take_from_group(GroupQueue* group,
+                                                               size_t core_id) {
+    auto* task = group->prio_task_queue_list[core_id].try_take(false);
+    if (task) {
+        task->set_core_id(core_id);
+        return task;
+    }
+    size_t next_id = core_id;
+    for (size_t i = 1; i < _core_size; ++i) {
+        ++next_id;
+        if (next_id == _core_size) {
+            next_id = 0;
+        }
+        task = group->prio_task_queue_list[next_id].try_take(true);
+        if (task) {
+            task->set_core_id(next_id);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkloadGroupFairTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
+    task->inc_runtime_ns(time_spent);
+    DCHECK(task->get_group_queue_idx() >= 0);
+    auto* group = _groups[task->get_group_queue_idx()].load();
+    group->prio_task_queue_list[task->get_core_id()].inc_sub_queue_runtime(
+            task->get_queue_level(), time_spent);
+    group->vruntime.fetch_add(time_spent * DEFAULT_CPU_SHARE / group->cpu_share.load(),
+                              std::memory_order_relaxed);
+}
+
+} // namespace doris::pipeline
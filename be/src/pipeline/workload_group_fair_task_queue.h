@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "common/status.h"
+#include "pipeline/task_queue.h"
+#include "pipeline/work_stealing_task_queue.h"
+
+namespace doris::pipeline {
+
+class PipelineTask;
+
+// A task queue shared by all workload groups. Every workload group has its own per core
+// multilevel feedback queues, and the workers pick a group by weighted fair queueing:
+// the group with the smallest virtual runtime runs next, where the virtual runtime of a
+// group grows by `time_spent * default_cpu_share / cpu_share` in `update_statistics`.
+// A group with a larger cpu share is therefore scheduled proportionally more often.
+class WorkloadGroupFairTaskQueue : public TaskQueue {
+public:
+    explicit WorkloadGroupFairTaskQueue(size_t core_size);
+
+    ~WorkloadGroupFairTaskQueue() override;
+
+    void close() override;
+
+    PipelineTask* take(size_t core_id) override;
+
+    Status push_back(PipelineTask* task) override;
+
+    Status push_back(PipelineTask* task, size_t core_id) override;
+
+    void update_statistics(PipelineTask* task, int64_t time_spent) override;
+
+    // All workers serve all groups, so the depth is averaged over the cores.
+    size_t runnable_task_size(size_t core_id) const override {
+        return std::max<int64_t>(_total_task_size.load(std::memory_order_relaxed), 0) /
+               _core_size;
+    }
+
+    static constexpr size_t MAX_GROUP_NUM = 1024;
+
+private:
+    struct GroupQueue {
+        GroupQueue(uint64_t group_id, size_t core_size);
+
+        const uint64_t group_id;
+        std::atomic<uint64_t> cpu_share;
+        // Weighted runtime of the group in ns, see the comment of the class.
+        std::atomic<uint64_t> vruntime = 0;
+        std::atomic<int64_t> task_size = 0;
+        std::unique_ptr<PriorityTaskQueue[]> prio_task_queue_list;
+    };
+
+    // Returns the queue of the workload group of `task`, creates it if absent.
+    GroupQueue* _group_queue_of_task(PipelineTask* task);
+
+    PipelineTask* _try_take(size_t core_id);
+
+    PipelineTask* _try_take_from_group(GroupQueue* group, size_t core_id);
+
+    // Groups are never freed before the queue, so workers can read them without a lock.
+    std::unique_ptr<std::atomic<GroupQueue*>[]> _groups;
+    std::atomic<size_t> _num_groups = 0;
+    std::vector<std::unique_ptr<GroupQueue>> _group_holder;
+    std::mutex _group_lock;
+
+    // The vruntime of the group picked last time. A group that becomes runnable again
+    // starts from here, so it can not monopolize the workers with the time saved when idle.
+    std::atomic<uint64_t> _min_vruntime = 0;
+
+    EventCount _event_count;
+    std::atomic<int64_t> _total_task_size = 0;
+    std::atomic<size_t> _next_core = 0;
+    std::atomic<bool> _closed;
+};
+
+} // namespace doris::pipeline
@@ -45,7 +45,9 @@ void PartitionRowBatch::set_row_batch(const PCacheValue& value) {
     }
     SAFE_DELETE(_cache_value);
     _cache_value = new PCacheValue(value);
-    _data_size += _cache_value->data_size();
+    // the size of the replaced data is not kept, a partition refreshed on every load would
+    // otherwise look larger and larger and get the whole node pruned early
+    _data_size = _cache_value->data_size();
     _cache_stat.update();
     LOG(INFO) << "finish set row batch, row num:" << _cache_value->rows_size()
               << ", data size:" << _data_size;
@@ -318,6 +320,7 @@ void ResultNode::clear() {
         SAFE_DELETE(*it);
         it = _partition_list.erase(it);
     }
+    _partition_map.clear();
     _data_size = 0;
 }
 
@@ -42,6 +42,7 @@ class VDataStreamMgr;
 class ScannerScheduler;
 class SpillStreamManager;
 class DeltaWriterV2Pool;
+class IcebergPositionDeleteCache;
 } // namespace vectorized
 namespace pipeline {
 class TaskScheduler;
@@ -96,6 +97,7 @@ class TabletSchemaCache;
 class UserFunctionCache;
 class SchemaCache;
 class StoragePageCache;
+class DecodedPageCache;
 class SegmentLoader;
 class LookupConnectionCache;
 class RowCache;
@@ -196,6 +198,7 @@ public:
     ThreadPool* s3_file_upload_thread_pool() { return _s3_file_upload_thread_pool.get(); }
     ThreadPool* send_report_thread_pool() { return _send_report_thread_pool.get(); }
     ThreadPool* join_node_thread_pool() { return _join_node_thread_pool.get(); }
+    ThreadPool* sort_thread_pool() { return _sort_thread_pool.get(); }
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
 
     Status init_pipeline_task_scheduler();
@@ -280,6 +283,10 @@ public:
     TabletSchemaCache* get_tablet_schema_cache() { return _tablet_schema_cache; }
     SchemaCache* schema_cache() { return _schema_cache; }
     StoragePageCache* get_storage_page_cache() { return _storage_page_cache; }
+    DecodedPageCache* get_decoded_page_cache() { return _decoded_page_cache; }
+    vectorized::IcebergPositionDeleteCache* get_iceberg_position_delete_cache() {
+        return _iceberg_position_delete_cache;
+    }
     SegmentLoader* segment_loader() { return _segment_loader; }
     LookupConnectionCache* get_lookup_connection_cache() { return _lookup_connection_cache; }
     RowCache* get_row_cache() { return _row_cache; }
@@ -366,6 +373,8 @@ private:
     std::unique_ptr<ThreadPool> _send_report_thread_pool;
     // Pool used by join node to build hash table
     std::unique_ptr<ThreadPool> _join_node_thread_pool;
+    // Pool used by the sorters to sort sub-runs in parallel
+    std::unique_ptr<ThreadPool> _sort_thread_pool;
     // Pool to use a new thread to release object
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
 
@@ -414,6 +423,10 @@ private:
     std::unique_ptr<BaseStorageEngine> _storage_engine;
     SchemaCache* _schema_cache = nullptr;
     StoragePageCache* _storage_page_cache = nullptr;
+    // nullptr if config::decoded_page_cache_limit is 0
+    DecodedPageCache* _decoded_page_cache = nullptr;
+    // nullptr if config::iceberg_position_delete_cache_limit is 0
+    vectorized::IcebergPositionDeleteCache* _iceberg_position_delete_cache = nullptr;
     SegmentLoader* _segment_loader = nullptr;
     LookupConnectionCache* _lookup_connection_cache = nullptr;
     RowCache* _row_cache = nullptr;
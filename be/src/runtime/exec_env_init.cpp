@@ -44,6 +44,7 @@
 #include "io/cache/block_file_cache_factory.h"
 #include "io/cache/fs_file_cache_storage.h"
 #include "io/fs/file_meta_cache.h"
+#include "olap/decoded_page_cache.h"
 #include "olap/memtable_memory_limiter.h"
 #include "olap/olap_define.h"
 #include "olap/options.h"
@@ -57,6 +58,7 @@
 #include "pipeline/pipeline_tracing.h"
 #include "pipeline/task_queue.h"
 #include "pipeline/task_scheduler.h"
+#include "pipeline/workload_group_fair_task_queue.h"
 #include "runtime/block_spill_manager.h"
 #include "runtime/broker_mgr.h"
 #include "runtime/cache/result_cache.h"
@@ -100,6 +102,7 @@
 #include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/timezone_utils.h"
+#include "vec/exec/format/table/iceberg_position_delete_cache.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 #include "vec/runtime/vdata_stream_mgr.h"
 #include "vec/sink/delta_writer_v2_pool.h"
@@ -230,6 +233,10 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(std::numeric_limits<int>::max())
                               .set_max_queue_size(config::fragment_pool_queue_size)
                               .build(&_join_node_thread_pool));
+    static_cast<void>(ThreadPoolBuilder("SortThreadPool")
+                              .set_min_threads(1)
+                              .set_max_threads(CpuInfo::num_cores())
+                              .build(&_sort_thread_pool));
     static_cast<void>(ThreadPoolBuilder("LazyReleaseMemoryThreadPool")
                               .set_min_threads(1)
                               .set_max_threads(1)
@@ -343,7 +350,13 @@ Status ExecEnv::init_pipeline_task_scheduler() {
 
     LOG_INFO("pipeline executors_size set ").tag("size", executors_size);
     // TODO pipeline workload group combie two blocked schedulers.
-    auto t_queue = std::make_shared<pipeline::MultiCoreTaskQueue>(executors_size);
+    std::shared_ptr<pipeline::TaskQueue> t_queue;
+    if (config::enable_workload_group_fair_task_queue) {
+        // Shared by all workload groups, see WorkloadGroup::upsert_task_scheduler.
+        t_queue = std::make_shared<pipeline::WorkloadGroupFairTaskQueue>(executors_size);
+    } else {
+        t_queue = pipeline::TaskScheduler::create_task_queue(executors_size, "PipeNoGSchePool");
+    }
     _without_group_task_scheduler =
             new pipeline::TaskScheduler(this, t_queue, "PipeNoGSchePool", nullptr);
     RETURN_IF_ERROR(_without_group_task_scheduler->start());
@@ -458,6 +471,27 @@ Status ExecEnv::_init_mem_env() {
               << PrettyPrinter::print(storage_cache_limit, TUnit::BYTES)
               << ", origin config value: " << config::storage_page_cache_limit;
 
+    int64_t decoded_page_cache_limit =
+            ParseUtil::parse_mem_spec(config::decoded_page_cache_limit, MemInfo::mem_limit(),
+                                      MemInfo::physical_mem(), &is_percent);
+    if (decoded_page_cache_limit > 0) {
+        _decoded_page_cache = new DecodedPageCache(decoded_page_cache_limit, num_shards);
+        LOG(INFO) << "Decoded page cache memory limit: "
+                  << PrettyPrinter::print(decoded_page_cache_limit, TUnit::BYTES)
+                  << ", origin config value: " << config::decoded_page_cache_limit;
+    }
+
+    int64_t iceberg_position_delete_cache_limit = ParseUtil::parse_mem_spec(
+            config::iceberg_position_delete_cache_limit, MemInfo::mem_limit(),
+            MemInfo::physical_mem(), &is_percent);
+    if (iceberg_position_delete_cache_limit > 0) {
+        _iceberg_position_delete_cache = new vectorized::IcebergPositionDeleteCache(
+                iceberg_position_delete_cache_limit, num_shards);
+        LOG(INFO) << "Iceberg position delete cache memory limit: "
+                  << PrettyPrinter::print(iceberg_position_delete_cache_limit, TUnit::BYTES)
+                  << ", origin config value: " << config::iceberg_position_delete_cache_limit;
+    }
+
     // Init row cache
     int64_t row_cache_mem_limit =
             ParseUtil::parse_mem_spec(config::row_cache_mem_limit, MemInfo::mem_limit(),
@@ -494,10 +528,14 @@ Status ExecEnv::_init_mem_env() {
             min(segment_cache_mem_limit, segment_cache_capacity *
                                                  config::estimated_num_columns_per_segment *
                                                  config::estimated_mem_per_column_reader);
-    _segment_loader = new SegmentLoader(min_segment_cache_mem_limit);
+    int64_t segment_footer_cache_mem_limit =
+            MemInfo::mem_limit() / 100 * config::segment_footer_cache_memory_percentage;
+    _segment_loader = new SegmentLoader(min_segment_cache_mem_limit,
+                                        std::max<int64_t>(segment_footer_cache_mem_limit, 0));
     LOG(INFO) << "segment_cache_capacity <= fd_number * 2 / 5, fd_number: " << fd_number
               << " segment_cache_capacity: " << segment_cache_capacity
-              << " min_segment_cache_mem_limit " << min_segment_cache_mem_limit;
+              << " min_segment_cache_mem_limit " << min_segment_cache_mem_limit
+              << " segment_footer_cache_mem_limit " << segment_footer_cache_mem_limit;
 
     _schema_cache = new SchemaCache(config::schema_cache_capacity);
 
@@ -638,6 +676,7 @@ void ExecEnv::destroy() {
     SAFE_SHUTDOWN(_buffered_reader_prefetch_thread_pool);
     SAFE_SHUTDOWN(_s3_file_upload_thread_pool);
     SAFE_SHUTDOWN(_join_node_thread_pool);
+    SAFE_SHUTDOWN(_sort_thread_pool);
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
     SAFE_SHUTDOWN(_send_report_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
@@ -662,6 +701,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_scanner_scheduler);
     // _storage_page_cache must be destoried before _cache_manager
     SAFE_DELETE(_storage_page_cache);
+    SAFE_DELETE(_decoded_page_cache);
+    SAFE_DELETE(_iceberg_position_delete_cache);
 
     SAFE_DELETE(_small_file_mgr);
     SAFE_DELETE(_broker_mgr);
@@ -683,6 +724,7 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_runtime_filter_timer_queue);
     // TODO(zhiqiang): Maybe we should call shutdown before release thread pool?
     _join_node_thread_pool.reset(nullptr);
+    _sort_thread_pool.reset(nullptr);
     _lazy_release_obj_pool.reset(nullptr);
     _send_report_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
@@ -20,6 +20,7 @@
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
@@ -147,6 +148,9 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
     }
     if (_block_queue.empty() && _need_commit && _load_ids.empty()) {
         *eos = true;
+        if (_eos_time == std::chrono::steady_clock::time_point {}) {
+            _eos_time = std::chrono::steady_clock::now();
+        }
     } else {
         *eos = false;
     }
@@ -301,11 +305,14 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                << ", txn_id=" << txn_id << ", instance_id=" << print_id(instance_id)
                << ", is_pipeline=" << is_pipeline;
     {
+        std::unique_lock l(_lock);
+        int64_t group_commit_interval_ms = result.group_commit_interval_ms;
+        int64_t group_commit_data_bytes = result.group_commit_data_bytes;
+        _adapt_commit_condition(&group_commit_interval_ms, &group_commit_data_bytes);
         auto load_block_queue = std::make_shared<LoadBlockQueue>(
                 instance_id, label, txn_id, schema_version, _all_block_queues_bytes,
-                result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
-                result.group_commit_data_bytes);
-        std::unique_lock l(_lock);
+                result.wait_internal_group_commit_finish, group_commit_interval_ms,
+                group_commit_data_bytes);
         //create wal
         if (!is_pipeline) {
             RETURN_IF_ERROR(load_block_queue->create_wal(
@@ -405,6 +412,9 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
         }
         _load_block_queues.erase(instance_id);
     }
+    if (load_block_queue != nullptr && status.ok() && st.ok() && result_status.ok()) {
+        _update_commit_stats(*load_block_queue);
+    }
     // status: exec_plan_fragment result
     // st: commit txn rpc status
     // result_status: commit txn result
@@ -449,6 +459,43 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
     return st;
 }
 
+void GroupCommitTable::_adapt_commit_condition(int64_t* interval_ms, int64_t* data_bytes) {
+    int64_t target_latency_ms = config::group_commit_target_latency_ms;
+    if (target_latency_ms <= 0) {
+        return;
+    }
+    // A row waits in the queue for up to the interval and then for the commit. A sparse table
+    // commits soon after its rows arrive, and a busy table uses all the latency budget to commit
+    // fewer versions, by the interval instead of the data size.
+    *interval_ms = std::max(target_latency_ms - _commit_cost_ms, MIN_ADAPTIVE_INTERVAL_MS);
+    auto expected_bytes = static_cast<int64_t>(_data_bytes_per_ms * *interval_ms);
+    *data_bytes = std::max(*data_bytes,
+                           std::min<int64_t>(expected_bytes, config::group_commit_queue_mem_limit));
+}
+
+void GroupCommitTable::_update_commit_stats(const LoadBlockQueue& load_block_queue) {
+    auto eos_time = load_block_queue.eos_time();
+    if (eos_time == std::chrono::steady_clock::time_point {}) {
+        return;
+    }
+    int64_t commit_cost_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::steady_clock::now() - eos_time)
+                                     .count();
+    int64_t duration_ms = std::max<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                                    eos_time - load_block_queue.start_time())
+                                                    .count(),
+                                            1);
+    double data_bytes_per_ms = static_cast<double>(load_block_queue.data_bytes()) / duration_ms;
+    std::lock_guard<std::mutex> l(_lock);
+    if (_commit_cost_ms == 0 && _data_bytes_per_ms == 0) {
+        _commit_cost_ms = commit_cost_ms;
+        _data_bytes_per_ms = data_bytes_per_ms;
+    } else {
+        _commit_cost_ms = (_commit_cost_ms * 4 + commit_cost_ms) / 5;
+        _data_bytes_per_ms = _data_bytes_per_ms * 0.8 + data_bytes_per_ms * 0.2;
+    }
+}
+
 Status GroupCommitTable::_exec_plan_fragment(int64_t db_id, int64_t table_id,
                                              const std::string& label, int64_t txn_id,
                                              bool is_pipeline,
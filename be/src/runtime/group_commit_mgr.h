@@ -66,6 +66,10 @@ public:
     void remove_load_id(const UniqueId& load_id);
     void cancel(const Status& st);
     bool need_commit() { return _need_commit; }
+    std::chrono::steady_clock::time_point start_time() const { return _start_time; }
+    // the time when all the blocks were read, the default time point if not yet
+    std::chrono::steady_clock::time_point eos_time() const { return _eos_time; }
+    int64_t data_bytes() const { return _data_bytes; }
 
     Status create_wal(int64_t db_id, int64_t tb_id, int64_t wal_id, const std::string& import_label,
                       WalManager* wal_manager, std::vector<TSlotDescriptor>& slot_desc,
@@ -105,6 +109,7 @@ private:
     // commit by time interval, can be changed by 'ALTER TABLE my_table SET ("group_commit_interval_ms"="1000");'
     int64_t _group_commit_interval_ms;
     std::chrono::steady_clock::time_point _start_time;
+    std::chrono::steady_clock::time_point _eos_time;
     // commit by data size
     int64_t _group_commit_data_bytes;
     int64_t _data_bytes = 0;
@@ -144,6 +149,9 @@ private:
     Status _finish_group_commit_load(int64_t db_id, int64_t table_id, const std::string& label,
                                      int64_t txn_id, const TUniqueId& instance_id, Status& status,
                                      RuntimeState* state);
+    // adapt the commit condition to config::group_commit_target_latency_ms, must hold _lock
+    void _adapt_commit_condition(int64_t* interval_ms, int64_t* data_bytes);
+    void _update_commit_stats(const LoadBlockQueue& load_block_queue);
 
     ExecEnv* _exec_env = nullptr;
     ThreadPool* _thread_pool = nullptr;
@@ -158,6 +166,12 @@ private:
     // fragment_instance_id to load_block_queue
     std::unordered_map<UniqueId, std::shared_ptr<LoadBlockQueue>> _load_block_queues;
     bool _is_creating_plan_fragment = false;
+
+    // moving averages over the finished group commits, for the target latency
+    // time from all the blocks being read to the commit finishing, including the publish and wal
+    int64_t _commit_cost_ms = 0;
+    double _data_bytes_per_ms = 0;
+    static constexpr int64_t MIN_ADAPTIVE_INTERVAL_MS = 10;
 };
 
 class GroupCommitMgr {
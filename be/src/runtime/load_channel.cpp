@@ -86,6 +86,7 @@ void LoadChannel::_init_profile() {
     _add_batch_timer = ADD_TIMER(_self_profile, "AddBatchTime");
     _handle_eos_timer = ADD_CHILD_TIMER(_self_profile, "HandleEosTime", "AddBatchTime");
     _add_batch_times = ADD_COUNTER(_self_profile, "AddBatchTimes", TUnit::UNIT);
+    _mem_limit_wait_timer = ADD_TIMER(_self_profile, "MemLimitWaitTime");
 }
 
 Status LoadChannel::open(const PTabletWriterOpenRequest& params) {
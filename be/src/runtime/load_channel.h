@@ -77,6 +77,7 @@ public:
 
     RuntimeProfile::Counter* get_mgr_add_batch_timer() { return _mgr_add_batch_timer; }
     RuntimeProfile::Counter* get_handle_mem_limit_timer() { return _handle_mem_limit_timer; }
+    RuntimeProfile::Counter* get_mem_limit_wait_timer() { return _mem_limit_wait_timer; }
 
 protected:
     Status _get_tablets_channel(std::shared_ptr<BaseTabletsChannel>& channel, bool& is_finished,
@@ -101,6 +102,8 @@ private:
     RuntimeProfile::Counter* _add_batch_times = nullptr;
     RuntimeProfile::Counter* _mgr_add_batch_timer = nullptr;
     RuntimeProfile::Counter* _handle_mem_limit_timer = nullptr;
+    // time the writers are blocked by the memtable memory hard limit
+    RuntimeProfile::Counter* _mem_limit_wait_timer = nullptr;
     RuntimeProfile::Counter* _handle_eos_timer = nullptr;
 
     // lock protect the tablets channel map
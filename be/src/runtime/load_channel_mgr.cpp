@@ -154,7 +154,9 @@ Status LoadChannelMgr::add_batch(const PTabletWriterAddBlockRequest& request,
         // If this is a high priority load task, do not handle this.
         // because this may block for a while, which may lead to rpc timeout.
         SCOPED_TIMER(channel->get_handle_mem_limit_timer());
-        ExecEnv::GetInstance()->memtable_memory_limiter()->handle_memtable_flush();
+        int64_t wait_time_ns = 0;
+        ExecEnv::GetInstance()->memtable_memory_limiter()->handle_memtable_flush(&wait_time_ns);
+        COUNTER_UPDATE(channel->get_mem_limit_wait_timer(), wait_time_ns);
     }
 
     // 3. add batch to load channel
@@ -17,6 +17,10 @@
 
 #include "runtime/memory/cache_manager.h"
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
 #include "runtime/memory/cache_policy.h"
 #include "util/runtime_profile.h"
 
@@ -56,6 +60,94 @@ int64_t CacheManager::for_each_cache_prune_all(RuntimeProfile* profile) {
     return 0;
 }
 
+// Used if a cache does not know its hit ratio.
+static constexpr double DEFAULT_HIT_RATIO = 0.5;
+// A cache without hits is still not free to refill, the entries may be used later.
+static constexpr double MIN_HIT_RATIO = 0.01;
+
+int64_t CacheManager::for_each_cache_prune_by_cost(int64_t bytes, RuntimeProfile* profile) {
+    if (bytes <= 0 || !need_prune(&_last_prune_by_cost_timestamp, "by cost")) {
+        return 0;
+    }
+    std::lock_guard<std::mutex> l(_caches_lock);
+    std::vector<CachePolicy*> caches;
+    std::vector<int64_t> consumptions;
+    std::vector<double> costs;
+    for (const auto& pair : _caches) {
+        auto* cache_policy = pair.second;
+        if (!cache_policy->enable_prune()) {
+            continue;
+        }
+        double hit_ratio = cache_policy->recent_hit_ratio();
+        int64_t consumption = cache_policy->mem_consumption();
+        if (consumption <= 0) {
+            continue;
+        }
+        if (hit_ratio < 0) {
+            hit_ratio = DEFAULT_HIT_RATIO;
+        }
+        caches.push_back(cache_policy);
+        consumptions.push_back(consumption);
+        costs.push_back(cache_policy->refill_cost_per_byte() * std::max(hit_ratio, MIN_HIT_RATIO));
+        LOG(INFO) << fmt::format(
+                "[MemoryGC] {} consumption {}, refill cost per byte {}, recent hit ratio {}",
+                CachePolicy::type_string(cache_policy->type()), consumption,
+                cache_policy->refill_cost_per_byte(), hit_ratio);
+    }
+
+    std::vector<int64_t> prune_bytes = split_prune_bytes(bytes, consumptions, costs);
+    int64_t freed_size = 0;
+    for (size_t i = 0; i < caches.size(); ++i) {
+        if (prune_bytes[i] <= 0) {
+            continue;
+        }
+        int64_t freed = caches[i]->prune_bytes(prune_bytes[i]);
+        freed_size += freed;
+        if (freed != 0 && profile) {
+            profile->add_child(caches[i]->profile(), true, nullptr);
+        }
+    }
+    return freed_size;
+}
+
+std::vector<int64_t> CacheManager::split_prune_bytes(int64_t bytes,
+                                                     const std::vector<int64_t>& consumptions,
+                                                     const std::vector<double>& costs) {
+    DCHECK_EQ(consumptions.size(), costs.size());
+    const size_t num = consumptions.size();
+    std::vector<int64_t> result(num, 0);
+    std::vector<size_t> order(num);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t l, size_t r) { return costs[l] < costs[r]; });
+
+    double weight_sum = 0;
+    for (size_t i = 0; i < num; ++i) {
+        weight_sum += consumptions[i] / costs[i];
+    }
+    // The cheapest caches are pruned entirely while their cost is not more than lambda.
+    int64_t pruned_entirely = 0;
+    size_t first = 0;
+    for (; first < num; ++first) {
+        size_t i = order[first];
+        double lambda = (bytes - pruned_entirely) / weight_sum;
+        if (costs[i] > lambda) {
+            break;
+        }
+        result[i] = consumptions[i];
+        pruned_entirely += consumptions[i];
+        weight_sum -= consumptions[i] / costs[i];
+    }
+    if (first < num && bytes > pruned_entirely) {
+        double lambda = (bytes - pruned_entirely) / weight_sum;
+        for (size_t j = first; j < num; ++j) {
+            size_t i = order[j];
+            result[i] = std::min(consumptions[i],
+                                 (int64_t)std::llround(lambda * consumptions[i] / costs[i]));
+        }
+    }
+    return result;
+}
+
 void CacheManager::clear_once(CachePolicy::CacheType type) {
     std::lock_guard<std::mutex> l(_caches_lock);
     _caches[type]->prune_all(true); // will print log
@@ -19,6 +19,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "runtime/exec_env.h"
 #include "runtime/memory/cache_policy.h"
@@ -66,6 +67,17 @@ public:
 
     int64_t for_each_cache_prune_all(RuntimeProfile* profile = nullptr);
 
+    // Prune about `bytes` from all the caches, a cache with a lower expected refill cost,
+    // i.e. refill_cost_per_byte * recent_hit_ratio, gives more, see split_prune_bytes.
+    int64_t for_each_cache_prune_by_cost(int64_t bytes, RuntimeProfile* profile = nullptr);
+
+    // Returns the bytes to prune of each cache. Cache i gives
+    // min(consumptions[i], lambda * consumptions[i] / costs[i]), where lambda makes the sum
+    // equal to `bytes`, so the caches cheaper than lambda are pruned entirely.
+    static std::vector<int64_t> split_prune_bytes(int64_t bytes,
+                                                  const std::vector<int64_t>& consumptions,
+                                                  const std::vector<double>& costs);
+
     void clear_once(CachePolicy::CacheType type);
 
     bool need_prune(int64_t* last_timestamp, const std::string& type) {
@@ -87,6 +99,7 @@ private:
     std::unordered_map<CachePolicy::CacheType, CachePolicy*> _caches;
     int64_t _last_prune_stale_timestamp = 0;
     int64_t _last_prune_all_timestamp = 0;
+    int64_t _last_prune_by_cost_timestamp = 0;
 };
 
 } // namespace doris
@@ -47,6 +47,9 @@ public:
         CREATE_TABLET_RR_IDX_CACHE = 15,
         CLOUD_TABLET_CACHE = 16,
         CLOUD_TXN_DELETE_BITMAP_CACHE = 17,
+        DECODED_PAGE_CACHE = 18,
+        ICEBERG_POSITION_DELETE_CACHE = 19,
+        SEGMENT_FOOTER_CACHE = 20,
     };
 
     static std::string type_string(CacheType type) {
@@ -87,6 +90,12 @@ public:
             return "CloudTabletCache";
         case CacheType::CLOUD_TXN_DELETE_BITMAP_CACHE:
             return "CloudTxnDeleteBitmapCache";
+        case CacheType::DECODED_PAGE_CACHE:
+            return "DecodedPageCache";
+        case CacheType::ICEBERG_POSITION_DELETE_CACHE:
+            return "IcebergPositionDeleteCache";
+        case CacheType::SEGMENT_FOOTER_CACHE:
+            return "SegmentFooterCache";
         default:
             LOG(FATAL) << "not match type of cache policy :" << static_cast<int>(type);
         }
@@ -99,6 +108,15 @@ public:
 
     virtual void prune_stale() = 0;
     virtual void prune_all(bool force) = 0;
+    // Prune about `bytes` of memory in the eviction order, returns the freed bytes.
+    virtual int64_t prune_bytes(int64_t bytes) = 0;
+
+    // Estimated cost to refill one byte after it is pruned, relative to reading it from
+    // the local disk. Caches refilled by remote or random small reads should return more.
+    virtual double refill_cost_per_byte() { return 1.0; }
+    // Hit ratio of the lookups since the last call, negative if unknown.
+    // Only called by CacheManager with the lock of caches held.
+    virtual double recent_hit_ratio() { return -1; }
 
     CacheType type() { return _type; }
     void init_mem_tracker(const std::string& type_name) {
@@ -134,6 +152,7 @@ protected:
                 std::make_unique<RuntimeProfile>(fmt::format("Cache type={}", type_string(_type)));
         _prune_stale_number_counter = ADD_COUNTER(_profile, "PruneStaleNumber", TUnit::UNIT);
         _prune_all_number_counter = ADD_COUNTER(_profile, "PruneAllNumber", TUnit::UNIT);
+        _prune_bytes_number_counter = ADD_COUNTER(_profile, "PruneBytesNumber", TUnit::UNIT);
         _freed_memory_counter = ADD_COUNTER(_profile, "FreedMemory", TUnit::BYTES);
         _freed_entrys_counter = ADD_COUNTER(_profile, "FreedEntrys", TUnit::UNIT);
         _cost_timer = ADD_TIMER(_profile, "CostTime");
@@ -147,6 +166,7 @@ protected:
     std::unique_ptr<RuntimeProfile> _profile;
     RuntimeProfile::Counter* _prune_stale_number_counter = nullptr;
     RuntimeProfile::Counter* _prune_all_number_counter = nullptr;
+    RuntimeProfile::Counter* _prune_bytes_number_counter = nullptr;
     // Reset before each gc
     RuntimeProfile::Counter* _freed_memory_counter = nullptr;
     RuntimeProfile::Counter* _freed_entrys_counter = nullptr;
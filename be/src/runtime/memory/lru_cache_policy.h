@@ -19,12 +19,17 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <memory>
+#include <string>
 
+#include "common/config.h"
+#include "olap/clock_cache.h"
 #include "olap/lru_cache.h"
 #include "runtime/memory/cache_policy.h"
 #include "runtime/memory/lru_cache_value_base.h"
 #include "runtime/thread_context.h"
+#include "util/string_util.h"
 #include "util/time.h"
 
 namespace doris {
@@ -38,9 +43,15 @@ public:
                    bool enable_prune = true)
             : CachePolicy(type, stale_sweep_time_s, enable_prune), _lru_cache_type(lru_cache_type) {
         if (check_capacity(capacity, num_shards)) {
-            _cache = std::shared_ptr<ShardedLRUCache>(
-                    new ShardedLRUCache(type_string(type), capacity, lru_cache_type, num_shards,
-                                        element_count_capacity));
+            if (use_clock_cache(type)) {
+                _cache = std::shared_ptr<ShardedClockCache>(
+                        new ShardedClockCache(type_string(type), capacity, lru_cache_type,
+                                              num_shards, element_count_capacity));
+            } else {
+                _cache = std::shared_ptr<ShardedLRUCache>(
+                        new ShardedLRUCache(type_string(type), capacity, lru_cache_type,
+                                            num_shards, element_count_capacity));
+            }
         } else {
             CHECK(ExecEnv::GetInstance()->get_dummy_lru_cache());
             _cache = ExecEnv::GetInstance()->get_dummy_lru_cache();
@@ -48,6 +59,8 @@ public:
         init_mem_tracker(lru_cache_type_string(_lru_cache_type));
     }
 
+    // The eviction by the timestamp of cache value needs the access order of LRU,
+    // so it always uses ShardedLRUCache.
     LRUCachePolicy(CacheType type, size_t capacity, LRUCacheType lru_cache_type,
                    uint32_t stale_sweep_time_s, uint32_t num_shards,
                    uint32_t element_count_capacity,
@@ -80,6 +93,17 @@ public:
         return true;
     }
 
+    // Whether the cache of `type` is listed in config::clock_cache_types.
+    static bool use_clock_cache(CacheType type) {
+        for (auto name : split(config::clock_cache_types, ",")) {
+            name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+            if (name == type_string(type)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     static std::string lru_cache_type_string(LRUCacheType type) {
         switch (type) {
         case LRUCacheType::SIZE:
@@ -188,6 +212,44 @@ public:
         }
     }
 
+    int64_t prune_bytes(int64_t bytes) override {
+        COUNTER_SET(_freed_entrys_counter, (int64_t)0);
+        COUNTER_SET(_freed_memory_counter, (int64_t)0);
+        if (_cache == ExecEnv::GetInstance()->get_dummy_lru_cache() || bytes <= 0) {
+            return 0;
+        }
+        COUNTER_SET(_cost_timer, (int64_t)0);
+        SCOPED_TIMER(_cost_timer);
+        int64_t consumption = mem_consumption();
+        if (consumption <= 0) {
+            return 0;
+        }
+        // The usage of LRUCacheType::NUMBER is not in bytes, so convert by the ratio.
+        auto usage = (size_t)((double)_cache->get_usage() * std::min(bytes, consumption) /
+                              consumption);
+        PrunedInfo pruned_info = _cache->prune_usage(usage);
+        int64_t freed = std::max<int64_t>(consumption - mem_consumption(), 0);
+        COUNTER_SET(_freed_entrys_counter, pruned_info.pruned_count);
+        COUNTER_SET(_freed_memory_counter, freed);
+        COUNTER_UPDATE(_prune_bytes_number_counter, 1);
+        LOG(INFO) << fmt::format(
+                "[MemoryGC] {} prune bytes {}, freed {} entries, {} bytes, {} times prune",
+                type_string(_type), bytes, pruned_info.pruned_count, freed,
+                _prune_bytes_number_counter->value());
+        return freed;
+    }
+
+    double recent_hit_ratio() override {
+        uint64_t lookup_count = _cache->get_lookup_count();
+        uint64_t hit_count = _cache->get_hit_count();
+        uint64_t lookups = lookup_count - _last_lookup_count;
+        uint64_t hits = hit_count - _last_hit_count;
+        _last_lookup_count = lookup_count;
+        _last_hit_count = hit_count;
+        // No lookup recently, the cache is cold.
+        return lookups == 0 ? 0 : (double)hits / lookups;
+    }
+
 private:
     // LRUCacheType::SIZE equal to total_size.
     size_t _get_bytes_with_handle(const CacheKey& key, size_t charge, size_t bytes) {
@@ -203,6 +265,9 @@ private:
     // compatible with ShardedLRUCache usage, but will not actually cache.
     std::shared_ptr<Cache> _cache;
     LRUCacheType _lru_cache_type;
+
+    uint64_t _last_lookup_count = 0;
+    uint64_t _last_hit_count = 0;
 };
 
 } // namespace doris
@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/mem_site_tracker.h"
+
+#include <fmt/format.h>
+
+#include "common/config.h"
+#include "util/pretty_printer.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+const char* mem_site_name(MemSite site) {
+    switch (site) {
+    case MemSite::HASH_TABLE:
+        return "HashTable";
+    case MemSite::ARENA:
+        return "Arena";
+    case MemSite::BLOCK:
+        return "Block";
+    case MemSite::EXCHANGE_BUFFER:
+        return "ExchangeBuffer";
+    case MemSite::SORT:
+        return "Sort";
+    default:
+        return "Unknown";
+    }
+}
+
+void MemSiteTracker::init(const std::string& label) {
+    _enabled = config::enable_mem_site_tracking;
+    if (!_enabled) {
+        return;
+    }
+    for (size_t i = 0; i < _trackers.size(); ++i) {
+        _trackers[i] = std::make_unique<MemTracker>(
+                fmt::format("{}:{}", label, mem_site_name(static_cast<MemSite>(i))));
+    }
+}
+
+void MemSiteTracker::update_profile(RuntimeProfile* profile,
+                                    const std::string& parent_counter_name) const {
+    if (!_enabled) {
+        return;
+    }
+    for (size_t i = 0; i < _trackers.size(); ++i) {
+        if (_trackers[i]->peak_consumption() == 0) {
+            continue;
+        }
+        auto* counter = profile->AddHighWaterMarkCounter(
+                fmt::format("{}PeakMemory", mem_site_name(static_cast<MemSite>(i))),
+                TUnit::BYTES, parent_counter_name, 1);
+        counter->set(_trackers[i]->peak_consumption());
+    }
+}
+
+std::string MemSiteTracker::debug_string() const {
+    if (!_enabled) {
+        return "";
+    }
+    fmt::memory_buffer buffer;
+    for (size_t i = 0; i < _trackers.size(); ++i) {
+        if (_trackers[i]->peak_consumption() == 0) {
+            continue;
+        }
+        fmt::format_to(buffer, "{}{}: current {}, peak {}", buffer.size() == 0 ? "" : ", ",
+                       mem_site_name(static_cast<MemSite>(i)),
+                       PrettyPrinter::print_bytes(_trackers[i]->consumption()),
+                       PrettyPrinter::print_bytes(_trackers[i]->peak_consumption()));
+    }
+    return fmt::to_string(buffer);
+}
+
+} // namespace doris
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "runtime/memory/mem_tracker.h"
+#include "runtime/thread_context.h"
+
+namespace doris {
+
+class RuntimeProfile;
+
+// The data structures which hold the memory of an operator.
+enum class MemSite : uint8_t {
+    HASH_TABLE = 0,
+    // the agg states and the serialized keys
+    ARENA,
+    // the blocks buffered or copied by the operator
+    BLOCK,
+    // the blocks waiting to be sent or received by an exchange
+    EXCHANGE_BUFFER,
+    SORT,
+    NUM_SITES,
+};
+
+const char* mem_site_name(MemSite site);
+
+// Splits the memory of an operator by the data structures holding it, to tell where the memory of
+// a query went, e.g. when it exceeds its limit. An operator counts the memory of a site by
+// `consume`, next to its own `_mem_tracker`, or tags all the allocations of a code segment by
+// SCOPED_CONSUME_MEM_SITE. The nested scopes count the allocations into all of their sites.
+//
+// Nothing is tracked unless `config::enable_mem_site_tracking` when `init` is called.
+class MemSiteTracker {
+public:
+    void init(const std::string& label);
+
+    bool enabled() const { return _enabled; }
+
+    void consume(MemSite site, int64_t bytes) {
+        if (_enabled) {
+            _trackers[static_cast<size_t>(site)]->consume(bytes);
+        }
+    }
+
+    void set_consumption(MemSite site, int64_t bytes) {
+        if (_enabled) {
+            _trackers[static_cast<size_t>(site)]->set_consumption(bytes);
+        }
+    }
+
+    // nullptr if not enabled
+    MemTracker* tracker(MemSite site) const {
+        return _enabled ? _trackers[static_cast<size_t>(site)].get() : nullptr;
+    }
+
+    // Add the peak of each site used to `profile`, as the children of `parent_counter_name`.
+    void update_profile(RuntimeProfile* profile, const std::string& parent_counter_name) const;
+
+    // The current and the peak memory of each site used, empty if none.
+    std::string debug_string() const;
+
+private:
+    bool _enabled = false;
+    std::array<std::unique_ptr<MemTracker>, static_cast<size_t>(MemSite::NUM_SITES)> _trackers;
+};
+
+// Count all the allocations of the code segment into the site of `mem_sites`.
+#define SCOPED_CONSUME_MEM_SITE(mem_sites, site) \
+    SCOPED_CONSUME_MEM_TRACKER((mem_sites).tracker(site))
+
+} // namespace doris
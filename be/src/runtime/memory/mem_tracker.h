@@ -69,12 +69,29 @@ public:
     public:
         MemCounter() : _current_value(0), _peak_value(0) {}
 
-        void add(int64_t delta) {
+        // The adds to a sharded counter go to the shard of the thread first, and are moved to
+        // the total only when the shard holds at least SHARD_BATCH_BYTES, so that the threads of
+        // a big query do not bounce one cache line. The peak is updated when a shard is moved.
+        explicit MemCounter(bool sharded) : MemCounter() {
+            if (sharded) {
+                _shards = std::make_unique<Shard[]>(SHARD_NUM);
+            }
+        }
+
+        // Returns true if the total is updated.
+        bool add(int64_t delta) {
+            if (_shards != nullptr && !_move_from_shard(&delta)) {
+                return false;
+            }
             auto value = _current_value.fetch_add(delta, std::memory_order_relaxed) + delta;
             update_peak(value);
+            return true;
         }
 
         void add_no_update_peak(int64_t delta) {
+            if (_shards != nullptr && !_move_from_shard(&delta)) {
+                return;
+            }
             _current_value.fetch_add(delta, std::memory_order_relaxed);
         }
 
@@ -92,9 +109,14 @@ public:
             return true;
         }
 
-        void sub(int64_t delta) { _current_value.fetch_sub(delta, std::memory_order_relaxed); }
+        void sub(int64_t delta) { add_no_update_peak(-delta); }
 
         void set(int64_t v) {
+            if (_shards != nullptr) {
+                for (size_t i = 0; i < SHARD_NUM; ++i) {
+                    _shards[i].value.store(0, std::memory_order_relaxed);
+                }
+            }
             _current_value.store(v, std::memory_order_relaxed);
             update_peak(v);
         }
@@ -106,12 +128,55 @@ public:
             }
         }
 
-        int64_t current_value() const { return _current_value.load(std::memory_order_relaxed); }
+        // Exact, it reads all the shards of a sharded counter.
+        int64_t current_value() const {
+            auto value = _current_value.load(std::memory_order_relaxed);
+            if (_shards != nullptr) {
+                for (size_t i = 0; i < SHARD_NUM; ++i) {
+                    value += _shards[i].value.load(std::memory_order_relaxed);
+                }
+            }
+            return value;
+        }
+        // Misses at most max_pending_value() bytes that are still in the shards.
+        int64_t approximate_value() const {
+            return _current_value.load(std::memory_order_relaxed);
+        }
+        int64_t max_pending_value() const {
+            return _shards != nullptr ? SHARD_NUM * SHARD_BATCH_BYTES : 0;
+        }
         int64_t peak_value() const { return _peak_value.load(std::memory_order_relaxed); }
 
     private:
+        static constexpr size_t SHARD_NUM = 32;
+        static constexpr int64_t SHARD_BATCH_BYTES = 2L * 1024 * 1024;
+
+        struct alignas(CACHE_LINE_SIZE) Shard {
+            std::atomic<int64_t> value = 0;
+        };
+
+        static size_t _shard_index() {
+            static std::atomic<size_t> next_index = 0;
+            static thread_local size_t index =
+                    next_index.fetch_add(1, std::memory_order_relaxed) % SHARD_NUM;
+            return index;
+        }
+
+        // Adds `*delta` to the shard of the thread. Returns true if the shard is taken, then
+        // `*delta` is set to the bytes that should be added to the total.
+        bool _move_from_shard(int64_t* delta) {
+            auto& shard = _shards[_shard_index()].value;
+            auto pending = shard.fetch_add(*delta, std::memory_order_relaxed) + *delta;
+            if (pending < SHARD_BATCH_BYTES && pending > -SHARD_BATCH_BYTES) {
+                return false;
+            }
+            *delta = shard.exchange(0, std::memory_order_relaxed);
+            return true;
+        }
+
         std::atomic<int64_t> _current_value;
         std::atomic<int64_t> _peak_value;
+        std::unique_ptr<Shard[]> _shards;
     };
 
     // Creates and adds the tracker to the mem_tracker_pool.
@@ -138,10 +203,9 @@ public:
         if (UNLIKELY(bytes == 0)) {
             return;
         }
-        _consumption->add(bytes);
-        if (_query_statistics) {
+        if (_consumption->add(bytes) && _query_statistics) {
             _query_statistics->set_max_peak_memory_bytes(_consumption->peak_value());
-            _query_statistics->set_current_used_memory_bytes(_consumption->current_value());
+            _query_statistics->set_current_used_memory_bytes(_consumption->approximate_value());
         }
     }
 
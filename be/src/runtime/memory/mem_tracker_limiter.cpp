@@ -65,7 +65,8 @@ static RuntimeProfile::Counter* previously_canceling_tasks_counter =
 
 MemTrackerLimiter::MemTrackerLimiter(Type type, const std::string& label, int64_t byte_limit) {
     DCHECK_GE(byte_limit, -1);
-    _consumption = std::make_shared<MemCounter>();
+    // the trackers of the queries and loads are consumed by many threads at the same time
+    _consumption = std::make_shared<MemCounter>(type == Type::QUERY || type == Type::LOAD);
     _type = type;
     _label = label;
     _limit = byte_limit;
@@ -306,7 +306,10 @@ inline Status MemTrackerLimiter::check_limit(int64_t bytes) {
     if (bytes <= 0 || (is_overcommit_tracker() && config::enable_query_memory_overcommit)) {
         return Status::OK();
     }
-    if (_limit > 0 && _consumption->current_value() + bytes > _limit) {
+    // the exact consumption reads all the shards, it is only needed near the limit
+    if (_limit > 0 &&
+        _consumption->approximate_value() + _consumption->max_pending_value() + bytes > _limit &&
+        _consumption->current_value() + bytes > _limit) {
         return Status::MemoryLimitExceeded(fmt::format(
                 "failed alloc size {}, {}", print_bytes(bytes), tracker_limit_exceeded_str()));
     }
@@ -127,6 +127,7 @@ QueryContext::~QueryContext() {
     uint64_t group_id = 0;
     if (_workload_group) {
         group_id = _workload_group->id(); // before remove
+        _workload_group->release_reserved_memory(_reserved_memory);
         _workload_group->remove_mem_tracker_limiter(query_mem_tracker);
         _workload_group->remove_query(_query_id);
     }
@@ -323,6 +324,26 @@ Status QueryContext::set_workload_group(WorkloadGroupPtr& tg) {
     return Status::OK();
 }
 
+bool QueryContext::try_reserve_memory(int64_t bytes) {
+    if (_workload_group == nullptr || bytes <= 0) {
+        return true;
+    }
+    if (_workload_group->try_reserve_memory(bytes)) {
+        _reserved_memory.fetch_add(bytes, std::memory_order_relaxed);
+        return true;
+    }
+    _workload_group->revoke_memory_of_queries(bytes);
+    return false;
+}
+
+void QueryContext::release_reserved_memory(int64_t bytes) {
+    if (_workload_group == nullptr || bytes <= 0) {
+        return;
+    }
+    _reserved_memory.fetch_sub(bytes, std::memory_order_relaxed);
+    _workload_group->release_reserved_memory(bytes);
+}
+
 void QueryContext::add_fragment_profile_x(
         int fragment_id, const std::vector<std::shared_ptr<TRuntimeProfileTree>>& pipeline_profiles,
         std::shared_ptr<TRuntimeProfileTree> load_channel_profile) {
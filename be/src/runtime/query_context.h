@@ -255,6 +255,35 @@ public:
         return _running_big_mem_op_num.load(std::memory_order_relaxed);
     }
 
+    // Reserves memory from the workload group before an operator grows, see
+    // WorkloadGroup::try_reserve_memory. When it fails, the queries of the group with the
+    // largest revocable memory are asked to revoke.
+    bool try_reserve_memory(int64_t bytes);
+    void release_reserved_memory(int64_t bytes);
+
+    // The revocable memory of the sinks of all pipeline tasks, which are updated by the tasks.
+    void update_revocable_mem_size(int64_t delta) {
+        _revocable_mem_size.fetch_add(delta, std::memory_order_relaxed);
+    }
+    int64_t revocable_mem_size() const {
+        return _revocable_mem_size.load(std::memory_order_relaxed);
+    }
+
+    // The time the scan tasks of this query have run on the scan threads, which ranks the
+    // queries sharing the scan thread pools.
+    void update_scan_task_time(int64_t ns) {
+        _scan_task_time_ns.fetch_add(ns, std::memory_order_relaxed);
+    }
+    int64_t scan_task_time() const { return _scan_task_time_ns.load(std::memory_order_relaxed); }
+
+    // Set by the workload group when it picks this query to revoke memory, all sinks of the
+    // query revoke their revocable memory until it is cleared.
+    void request_revoke_memory() { _revoke_requested.store(true, std::memory_order_relaxed); }
+    void clear_revoke_request() { _revoke_requested.store(false, std::memory_order_relaxed); }
+    bool need_to_revoke_memory() const {
+        return _revoke_requested.load(std::memory_order_relaxed);
+    }
+
     void set_weighted_mem(int64_t weighted_limit, int64_t weighted_consumption) {
         std::lock_guard<std::mutex> l(_weighted_mem_lock);
         _weighted_consumption = weighted_consumption;
@@ -300,6 +329,10 @@ private:
     bool _is_pipeline = false;
     bool _is_nereids = false;
     std::atomic<int> _running_big_mem_op_num = 0;
+    std::atomic<int64_t> _reserved_memory = 0;
+    std::atomic<int64_t> _revocable_mem_size = 0;
+    std::atomic<int64_t> _scan_task_time_ns = 0;
+    std::atomic<bool> _revoke_requested = false;
 
     // A token used to submit olap scanner to the "_limited_scan_thread_pool",
     // This thread pool token is created from "_limited_scan_thread_pool" from exec env.
@@ -187,7 +187,7 @@ Status KafkaDataConsumer::assign_topic_partitions(
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
+Status KafkaDataConsumer::group_consume(BlockingQueue<KafkaMessageBatch*>* queue,
                                         int64_t max_running_time_ms) {
     static constexpr int MAX_RETRY_TIMES_FOR_TRANSPORT_FAILURE = 3;
     int64_t left_time = max_running_time_ms;
@@ -196,11 +196,29 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
 
     int64_t received_rows = 0;
     int64_t put_rows = 0;
+    int64_t put_batches = 0;
     int32_t retry_times = 0;
     Status st = Status::OK();
     MonotonicStopWatch consumer_watch;
     MonotonicStopWatch watch;
     watch.start();
+    size_t batch_size = std::max(1, config::routine_load_consume_batch_size);
+    auto batch = std::make_unique<KafkaMessageBatch>();
+    // put the msgs consumed so far to the queue, false if the queue is shutdown
+    auto flush_batch = [&]() {
+        if (batch->msgs.empty()) {
+            return true;
+        }
+        size_t num = batch->msgs.size();
+        if (!queue->blocking_put(batch.get())) {
+            return false;
+        }
+        batch.release(); // release the ownership, batch will be deleted after being processed
+        batch = std::make_unique<KafkaMessageBatch>();
+        put_rows += num;
+        ++put_batches;
+        return true;
+    };
     while (true) {
         {
             std::unique_lock<std::mutex> l(_lock);
@@ -214,10 +232,16 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
         }
 
         bool done = false;
-        // consume 1 message at a time
+        // wait for the first msg of a batch, then only take the msgs already fetched by
+        // librdkafka, so a batch never holds back the msgs in it.
+        int timeout_ms = batch->msgs.empty() ? 1000 : 0;
         consumer_watch.start();
-        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(1000 /* timeout, ms */));
+        std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(timeout_ms));
         consumer_watch.stop();
+        if (msg->err() != RdKafka::ERR_NO_ERROR && !flush_batch()) {
+            // queue is shutdown
+            break;
+        }
         switch (msg->err()) {
         case RdKafka::ERR_NO_ERROR:
             if (_consuming_partition_ids.count(msg->partition()) <= 0) {
@@ -227,19 +251,20 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
                 // ignore msg with length 0.
                 // put empty msg into queue will cause the load process shutting down.
                 break;
-            } else if (!queue->blocking_put(msg.get())) {
+            }
+            batch->msgs.push_back(std::move(msg));
+            ++received_rows;
+            if (batch->msgs.size() >= batch_size && !flush_batch()) {
                 // queue is shutdown
                 done = true;
-            } else {
-                ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
             }
-            ++received_rows;
             break;
         case RdKafka::ERR__TIMED_OUT:
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
-            LOG(INFO) << "kafka consume timeout: " << _id;
+            if (timeout_ms > 0) {
+                LOG(INFO) << "kafka consume timeout: " << _id;
+            }
             break;
         case RdKafka::ERR__TRANSPORT:
             LOG(INFO) << "kafka consume Disconnected: " << _id
@@ -270,12 +295,15 @@ Status KafkaDataConsumer::group_consume(BlockingQueue<RdKafka::Message*>* queue,
             break;
         }
     }
+    // the msgs consumed are handed to the group even if the time is up
+    static_cast<void>(flush_batch());
 
     LOG(INFO) << "kafka consumer done: " << _id << ", grp: " << _grp_id
               << ". cancelled: " << _cancelled << ", left time(ms): " << left_time
               << ", total cost(ms): " << watch.elapsed_time() / 1000 / 1000
               << ", consume cost(ms): " << consumer_watch.elapsed_time() / 1000 / 1000
-              << ", received rows: " << received_rows << ", put rows: " << put_rows;
+              << ", received rows: " << received_rows << ", put rows: " << put_rows
+              << ", put batches: " << put_batches;
 
     return st;
 }
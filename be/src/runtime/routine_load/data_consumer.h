@@ -39,6 +39,11 @@ namespace doris {
 template <typename T>
 class BlockingQueue;
 
+// The kafka msgs a consumer hands to its group at once, in the order of consuming.
+struct KafkaMessageBatch {
+    std::vector<std::unique_ptr<RdKafka::Message>> msgs;
+};
+
 class DataConsumer {
 public:
     DataConsumer()
@@ -144,8 +149,8 @@ public:
                                    const std::string& topic,
                                    std::shared_ptr<StreamLoadContext> ctx);
 
-    // start the consumer and put msgs to queue
-    Status group_consume(BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put batches of msgs to queue
+    Status group_consume(BlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms);
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids);
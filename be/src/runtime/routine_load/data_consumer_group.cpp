@@ -23,11 +23,13 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/logging.h"
 #include "librdkafka/rdkafkacpp.h"
 #include "runtime/routine_load/data_consumer.h"
 #include "runtime/stream_load/stream_load_context.h"
+#include "util/slice.h"
 #include "util/stopwatch.hpp"
 
 namespace doris {
@@ -60,10 +62,10 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
-        if (_queue.blocking_get(&msg)) {
-            delete msg;
-            msg = nullptr;
+        KafkaMessageBatch* batch;
+        if (_queue.blocking_get(&batch)) {
+            delete batch;
+            batch = nullptr;
         } else {
             break;
         }
@@ -112,13 +114,9 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
     // copy one
     std::map<int32_t, int64_t> cmt_offset = ctx->kafka_info->cmt_offset;
 
-    //improve performance
-    Status (io::KafkaConsumerPipe::*append_data)(const char* data, size_t size);
-    if (ctx->format == TFileFormatType::FORMAT_JSON) {
-        append_data = &io::KafkaConsumerPipe::append_json;
-    } else {
-        append_data = &io::KafkaConsumerPipe::append_with_line_delimiter;
-    }
+    // a json msg is parsed alone, the lines of the csv msgs of a batch are appended at once
+    bool is_json = ctx->format == TFileFormatType::FORMAT_JSON;
+    std::vector<Slice> lines;
 
     MonotonicStopWatch watch;
     watch.start();
@@ -155,25 +153,47 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
             return Status::OK();
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        KafkaMessageBatch* batch;
+        bool res = _queue.blocking_get(&batch);
         if (res) {
-            // conf has to be deleted finally
-            Defer delete_msg {[msg]() { delete msg; }};
-            VLOG_NOTICE << "get kafka message"
-                        << ", partition: " << msg->partition() << ", offset: " << msg->offset()
-                        << ", len: " << msg->len();
-
-            Status st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
-                                                         static_cast<size_t>(msg->len()));
+            // batch has to be deleted finally
+            Defer delete_batch {[batch]() { delete batch; }};
+            // the msgs of the batch over the limits are dropped, and consumed by the next task
+            int64_t num = 0;
+            int64_t bytes = 0;
+            lines.clear();
+            Status st = Status::OK();
+            auto batch_rows = static_cast<int64_t>(batch->msgs.size());
+            for (; num < batch_rows && num < left_rows && bytes < left_bytes; ++num) {
+                const auto& msg = batch->msgs[num];
+                VLOG_NOTICE << "get kafka message"
+                            << ", partition: " << msg->partition() << ", offset: " << msg->offset()
+                            << ", len: " << msg->len();
+                if (is_json) {
+                    st = kafka_pipe->append_json(static_cast<const char*>(msg->payload()),
+                                                 static_cast<size_t>(msg->len()));
+                    if (!st.ok()) {
+                        break;
+                    }
+                } else {
+                    lines.emplace_back(static_cast<const char*>(msg->payload()),
+                                       static_cast<size_t>(msg->len()));
+                }
+                bytes += msg->len();
+            }
+            if (st.ok() && !is_json) {
+                st = kafka_pipe->append_lines(lines);
+            }
             if (st.ok()) {
-                left_rows--;
-                left_bytes -= msg->len();
-                cmt_offset[msg->partition()] = msg->offset();
-                VLOG_NOTICE << "consume partition[" << msg->partition() << " - " << msg->offset()
-                            << "]";
+                left_rows -= num;
+                left_bytes -= bytes;
+                for (int64_t i = 0; i < num; ++i) {
+                    const auto& msg = batch->msgs[i];
+                    cmt_offset[msg->partition()] = msg->offset();
+                }
+                VLOG_NOTICE << "consume " << num << " msgs of a batch";
             } else {
-                // failed to append this msg, we must stop
+                // failed to append the msgs, we must stop
                 LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id;
                 eos = true;
                 {
@@ -195,7 +215,7 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
 }
 
 void KafkaDataConsumerGroup::actual_consume(std::shared_ptr<DataConsumer> consumer,
-                                            BlockingQueue<RdKafka::Message*>* queue,
+                                            BlockingQueue<KafkaMessageBatch*>* queue,
                                             int64_t max_running_time_ms, ConsumeFinishCallback cb) {
     Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(
             queue, max_running_time_ms);
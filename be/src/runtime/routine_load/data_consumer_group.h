@@ -19,11 +19,13 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/kafka_consumer_pipe.h"
 #include "runtime/routine_load/data_consumer.h"
@@ -84,7 +86,10 @@ protected:
 // for kafka
 class KafkaDataConsumerGroup : public DataConsumerGroup {
 public:
-    KafkaDataConsumerGroup(size_t consumer_num) : DataConsumerGroup(consumer_num), _queue(500) {}
+    // the queue holds about 500 msgs
+    KafkaDataConsumerGroup(size_t consumer_num)
+            : DataConsumerGroup(consumer_num),
+              _queue(std::max(2, 500 / std::max(1, config::routine_load_consume_batch_size))) {}
 
     virtual ~KafkaDataConsumerGroup();
 
@@ -96,12 +101,12 @@ public:
 private:
     // start a single consumer
     void actual_consume(std::shared_ptr<DataConsumer> consumer,
-                        BlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
+                        BlockingQueue<KafkaMessageBatch*>* queue, int64_t max_running_time_ms,
                         ConsumeFinishCallback cb);
 
 private:
-    // blocking queue to receive msgs from all consumers
-    BlockingQueue<RdKafka::Message*> _queue;
+    // blocking queue to receive batches of msgs from all consumers
+    BlockingQueue<KafkaMessageBatch*> _queue;
 };
 
 } // end namespace doris
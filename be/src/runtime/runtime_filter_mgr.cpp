@@ -26,10 +26,12 @@
 #include <gen_cpp/types.pb.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "exprs/bloom_filter_func.h"
@@ -248,6 +250,7 @@ Status RuntimeFilterMergeControllerEntity::_init_with_desc(
     auto filter_id = runtime_filter_desc->filter_id;
     RETURN_IF_ERROR(cnt_val->filter->init_with_desc(&cnt_val->runtime_filter_desc, query_options,
                                                     -1, false));
+    RETURN_IF_ERROR(_init_merge_lanes(cnt_val.get(), query_options));
     _filter_map.emplace(filter_id, cnt_val);
     return Status::OK();
 }
@@ -267,12 +270,35 @@ Status RuntimeFilterMergeControllerEntity::_init_with_desc(
             new IRuntimeFilter(_state, &_state->get_query_ctx()->obj_pool, runtime_filter_desc));
     auto filter_id = runtime_filter_desc->filter_id;
     RETURN_IF_ERROR(cnt_val->filter->init_with_desc(&cnt_val->runtime_filter_desc, query_options));
+    RETURN_IF_ERROR(_init_merge_lanes(cnt_val.get(), query_options));
 
     std::unique_lock<std::shared_mutex> guard(_filter_map_mutex);
     _filter_map.emplace(filter_id, cnt_val);
     return Status::OK();
 }
 
+Status RuntimeFilterMergeControllerEntity::_init_merge_lanes(RuntimeFilterCntlVal* cnt_val,
+                                                             const TQueryOptions* query_options) {
+    // only the first filter of a broadcast join is merged
+    const int num_lanes =
+            cnt_val->runtime_filter_desc.is_broadcast_join
+                    ? 1
+                    : std::max(1, std::min(config::runtime_filter_merge_lanes,
+                                           cnt_val->producer_size));
+    cnt_val->lanes.push_back(cnt_val->filter);
+    for (int i = 1; i < num_lanes; ++i) {
+        auto* lane = cnt_val->pool->add(new IRuntimeFilter(
+                _state, &_state->get_query_ctx()->obj_pool, &cnt_val->runtime_filter_desc));
+        RETURN_IF_ERROR(lane->init_with_desc(&cnt_val->runtime_filter_desc, query_options));
+        cnt_val->lanes.push_back(lane);
+    }
+    for (int i = 0; i < num_lanes; ++i) {
+        cnt_val->lane_mutexes.push_back(std::make_unique<std::mutex>());
+    }
+    cnt_val->lane_used.assign(num_lanes, false);
+    return Status::OK();
+}
+
 Status RuntimeFilterMergeControllerEntity::init(UniqueId query_id,
                                                 const TRuntimeFilterParams& runtime_filter_params,
                                                 const TQueryOptions& query_options) {
@@ -400,28 +426,68 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
         }
     }
     cnt_val = iter->second.cnt_val;
+    size_t lane_idx = 0;
     {
         std::lock_guard<std::mutex> l(*iter->second.mutex);
         // Skip the other broadcast join runtime filter
         if (cnt_val->arrive_id.size() == 1 && cnt_val->runtime_filter_desc.is_broadcast_join) {
             return Status::OK();
         }
-        MergeRuntimeFilterParams params(request, attach_data);
-        ObjectPool* pool = cnt_val->pool.get();
-        RuntimeFilterWrapperHolder holder;
-        RETURN_IF_ERROR(IRuntimeFilter::create_wrapper(&params, pool, holder.getHandle()));
-
-        RETURN_IF_ERROR(cnt_val->filter->merge_from(holder.getHandle()->get()));
-        cnt_val->arrive_id.insert(UniqueId(request->fragment_instance_id()));
-        merged_size = cnt_val->arrive_id.size();
+        if (!cnt_val->arrive_id.insert(UniqueId(request->fragment_instance_id())).second) {
+            // merging the same filter again changes nothing
+            return Status::OK();
+        }
+        if (cnt_val->arrive_id.size() == 1) {
+            cnt_val->first_arrive_ms = start_merge;
+        }
+        lane_idx = (cnt_val->arrive_id.size() - 1) % cnt_val->lanes.size();
+    }
+
+    // The filters are deserialized and merged out of the lock of the filter, into the lane which
+    // is not being merged into by another rpc if there is one.
+    MergeRuntimeFilterParams params(request, attach_data);
+    RuntimeFilterWrapperHolder holder;
+    RETURN_IF_ERROR(
+            IRuntimeFilter::create_wrapper(&params, cnt_val->pool.get(), holder.getHandle()));
+    {
+        const auto& lane_mutexes = cnt_val->lane_mutexes;
+        std::unique_lock<std::mutex> lane_lock(*lane_mutexes[lane_idx], std::try_to_lock);
+        for (size_t i = 1; !lane_lock.owns_lock() && i < lane_mutexes.size(); ++i) {
+            const size_t idx = (lane_idx + i) % lane_mutexes.size();
+            lane_lock = std::unique_lock<std::mutex>(*lane_mutexes[idx], std::try_to_lock);
+            if (lane_lock.owns_lock()) {
+                lane_idx = idx;
+            }
+        }
+        if (!lane_lock.owns_lock()) {
+            lane_lock = std::unique_lock<std::mutex>(*lane_mutexes[lane_idx]);
+        }
+        RETURN_IF_ERROR(cnt_val->lanes[lane_idx]->merge_from(holder.getHandle()->get()));
+        cnt_val->lane_used[lane_idx] = true;
+    }
+
+    {
+        std::lock_guard<std::mutex> l(*iter->second.mutex);
+        merged_size = ++cnt_val->merged_size;
         // TODO: avoid log when we had acquired a lock
         VLOG_ROW << "merge size:" << merged_size << ":" << cnt_val->producer_size;
         DCHECK_LE(merged_size, cnt_val->producer_size);
-        cnt_val->merge_time += (MonotonicMillis() - start_merge);
-        merge_time = cnt_val->merge_time;
     }
 
     if (merged_size == cnt_val->producer_size) {
+        // all the other rpcs are done with the lanes
+        for (size_t i = 1; i < cnt_val->lanes.size(); ++i) {
+            if (cnt_val->lane_used[i]) {
+                RETURN_IF_ERROR(cnt_val->filter->merge_from(cnt_val->lanes[i]));
+            }
+        }
+        if (config::runtime_filter_bloom_filter_fold_max_fill > 0) {
+            cnt_val->filter->fold_bloom_filter(config::runtime_filter_bloom_filter_fold_max_fill);
+        }
+        // the time the filters are waited for and merged at this node
+        cnt_val->merge_time = MonotonicMillis() - cnt_val->first_arrive_ms;
+        merge_time = cnt_val->merge_time;
+
         if (opt_remote_rf) {
             DCHECK_GT(cnt_val->targetv2_info.size(), 0);
             // Optimize merging phase iff:
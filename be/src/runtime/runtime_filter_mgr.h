@@ -62,6 +62,8 @@ struct LocalMergeFilters {
     int merge_time = 0;
     int merge_size_times = 0;
     uint64_t local_merged_size = 0;
+    // when the first producer filter is merged, to show how long the last one waits for them
+    int64_t first_merge_ms = 0;
     std::vector<IRuntimeFilter*> filters;
 };
 
@@ -174,6 +176,14 @@ public:
         std::vector<doris::TRuntimeFilterTargetParams> target_info;
         std::vector<doris::TRuntimeFilterTargetParamsV2> targetv2_info;
         IRuntimeFilter* filter = nullptr;
+        // The arriving filters are merged into these filters in parallel, `filter` is the first
+        // of them, and the others are merged into `filter` when all the filters arrived.
+        std::vector<IRuntimeFilter*> lanes;
+        std::vector<std::unique_ptr<std::mutex>> lane_mutexes;
+        std::vector<bool> lane_used;
+        // the number of the arrived filters which are merged into a lane
+        int merged_size = 0;
+        int64_t first_arrive_ms = 0;
         std::unordered_set<UniqueId> arrive_id;
         std::vector<PNetworkAddress> source_addrs;
         std::shared_ptr<ObjectPool> pool;
@@ -190,6 +200,9 @@ private:
                            const std::vector<doris::TRuntimeFilterTargetParamsV2>* target_info,
                            const int producer_size);
 
+    // Adds the lanes of `cnt_val` besides its filter, which is initialized already.
+    Status _init_merge_lanes(RuntimeFilterCntlVal* cnt_val, const TQueryOptions* query_options);
+
     UniqueId _query_id;
     // protect _filter_map
     std::shared_mutex _filter_map_mutex;
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -76,6 +77,10 @@ public:
 
     Status update(const Field& value);
 
+    // Bumped every time the predicate is tightened, readers can poll it without the lock to
+    // find out whether the bound they have applied is stale.
+    int64_t version() const { return _version.load(std::memory_order_acquire); }
+
     bool has_value() const {
         std::shared_lock<std::shared_mutex> rlock(_rwlock);
         return _has_value;
@@ -107,6 +112,7 @@ private:
     bool _inited = false;
     std::string _col_name;
     bool _has_value = false;
+    std::atomic<int64_t> _version = 0;
 
     template <PrimitiveType type>
     static std::string get_normal_value(const Field& field) {
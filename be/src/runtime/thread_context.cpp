@@ -17,12 +17,23 @@
 
 #include "runtime/thread_context.h"
 
+#include "common/config.h"
 #include "common/signal_handler.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
+#include "runtime/workload_group/workload_group.h"
+#include "util/continuous_cpu_profiler.h"
 
 namespace doris {
 class MemTracker;
 
+// tag the cpu samples of the thread, see ContinuousCpuProfiler
+static void set_cpu_profile_tags(const TUniqueId& query_id, uint64_t workload_group_id) {
+    cpu_profiler::t_query_id_hi = query_id.hi;
+    cpu_profiler::t_query_id_lo = query_id.lo;
+    cpu_profiler::t_workload_group_id = workload_group_id;
+}
+
 QueryThreadContext ThreadContext::query_thread_context() {
     DCHECK(doris::pthread_context_ptr_init);
     ORPHAN_TRACKER_CHECK();
@@ -33,6 +44,7 @@ AttachTask::AttachTask(const std::shared_ptr<MemTrackerLimiter>& mem_tracker,
                        const TUniqueId& task_id) {
     ThreadLocalHandle::create_thread_local_if_not_exits();
     signal::set_signal_task_id(task_id);
+    set_cpu_profile_tags(task_id, 0);
     thread_context()->attach_task(task_id, mem_tracker);
 }
 
@@ -46,17 +58,26 @@ AttachTask::AttachTask(RuntimeState* runtime_state) {
     ThreadLocalHandle::create_thread_local_if_not_exits();
     signal::set_signal_task_id(runtime_state->query_id());
     signal::set_signal_is_nereids(runtime_state->is_nereids());
+    uint64_t workload_group_id = 0;
+    if (config::continuous_cpu_profile_frequency > 0 && runtime_state->get_query_ctx()) {
+        if (auto workload_group = runtime_state->get_query_ctx()->workload_group()) {
+            workload_group_id = workload_group->id();
+        }
+    }
+    set_cpu_profile_tags(runtime_state->query_id(), workload_group_id);
     thread_context()->attach_task(runtime_state->query_id(), runtime_state->query_mem_tracker());
 }
 
 AttachTask::AttachTask(const QueryThreadContext& query_thread_context) {
     ThreadLocalHandle::create_thread_local_if_not_exits();
     signal::set_signal_task_id(query_thread_context.query_id);
+    set_cpu_profile_tags(query_thread_context.query_id, 0);
     thread_context()->attach_task(query_thread_context.query_id,
                                   query_thread_context.query_mem_tracker);
 }
 
 AttachTask::~AttachTask() {
+    set_cpu_profile_tags(TUniqueId(), 0);
     thread_context()->detach_task();
     ThreadLocalHandle::del_thread_local_if_count_is_zero();
 }
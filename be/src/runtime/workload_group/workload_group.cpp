@@ -20,6 +20,7 @@
 #include <fmt/format.h>
 #include <gen_cpp/PaloInternalService_types.h>
 
+#include <algorithm>
 #include <charconv>
 #include <map>
 #include <mutex>
@@ -31,10 +32,12 @@
 #include "pipeline/task_scheduler.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/query_context.h"
 #include "util/mem_info.h"
 #include "util/parse_util.h"
 #include "util/runtime_profile.h"
 #include "util/threadpool.h"
+#include "util/uid_util.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 
 namespace doris {
@@ -122,6 +125,54 @@ void WorkloadGroup::set_weighted_memory_used(int64_t wg_total_mem_used, double r
     _weighted_mem_used.store(int64_t(wg_total_mem_used * ratio), std::memory_order_relaxed);
 }
 
+bool WorkloadGroup::try_reserve_memory(int64_t bytes) {
+    const int64_t memory_limit = this->memory_limit();
+    if (memory_limit <= 0) {
+        return true;
+    }
+    const auto limit = int64_t((double)memory_limit *
+                               _spill_high_watermark.load(std::memory_order_relaxed) / 100);
+    const auto weighted_mem_used = _weighted_mem_used.load(std::memory_order_relaxed);
+    auto reserved = _reserved_memory.load(std::memory_order_relaxed);
+    do {
+        if (weighted_mem_used + reserved + bytes > limit) {
+            return false;
+        }
+    } while (!_reserved_memory.compare_exchange_weak(reserved, reserved + bytes,
+                                                       std::memory_order_relaxed));
+    return true;
+}
+
+void WorkloadGroup::revoke_memory_of_queries(int64_t bytes) {
+    std::vector<std::pair<int64_t, std::shared_ptr<QueryContext>>> candidates;
+    for (const auto& [query_id, query_ctx_ptr] : queries()) {
+        auto query_ctx = query_ctx_ptr.lock();
+        if (query_ctx == nullptr || query_ctx->is_cancelled()) {
+            continue;
+        }
+        auto revocable_mem = query_ctx->revocable_mem_size();
+        if (revocable_mem > 0) {
+            candidates.emplace_back(revocable_mem, std::move(query_ctx));
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    int64_t revoked = 0;
+    for (auto& [revocable_mem, query_ctx] : candidates) {
+        if (revoked >= bytes) {
+            break;
+        }
+        if (!query_ctx->need_to_revoke_memory()) {
+            VLOG_DEBUG << "workload group " << _name << " asks query "
+                       << print_id(query_ctx->query_id()) << " to revoke "
+                       << PrettyPrinter::print_bytes(revocable_mem);
+            query_ctx->request_revoke_memory();
+        }
+        revoked += revocable_mem;
+    }
+}
+
 void WorkloadGroup::add_mem_tracker_limiter(std::shared_ptr<MemTrackerLimiter> mem_tracker_ptr) {
     auto group_num = mem_tracker_ptr->group_num();
     std::lock_guard<std::mutex> l(_mem_tracker_limiter_pool[group_num].group_lock);
@@ -372,12 +423,14 @@ void WorkloadGroup::upsert_task_scheduler(WorkloadGroupInfo* tg_info, ExecEnv* e
 
     CgroupCpuCtl* cg_cpu_ctl_ptr = _cgroup_cpu_ctl.get();
 
-    if (_task_sched == nullptr) {
+    // With the fair task queue, queries of the group run in the shared pipeline task scheduler.
+    if (_task_sched == nullptr && !config::enable_workload_group_fair_task_queue) {
         int32_t executors_size = config::pipeline_executor_size;
         if (executors_size <= 0) {
             executors_size = CpuInfo::num_cores();
         }
-        auto task_queue = std::make_shared<pipeline::MultiCoreTaskQueue>(executors_size);
+        auto task_queue =
+                pipeline::TaskScheduler::create_task_queue(executors_size, "Pipe_" + tg_name);
         std::unique_ptr<pipeline::TaskScheduler> pipeline_task_scheduler =
                 std::make_unique<pipeline::TaskScheduler>(exec_env, std::move(task_queue),
                                                           "Pipe_" + tg_name, cg_cpu_ctl_ptr);
@@ -88,7 +88,8 @@ public:
     void set_weighted_memory_used(int64_t wg_total_mem_used, double ratio);
 
     void check_mem_used(bool* is_low_wartermark, bool* is_high_wartermark) const {
-        auto weighted_mem_used = _weighted_mem_used.load(std::memory_order_relaxed);
+        auto weighted_mem_used = _weighted_mem_used.load(std::memory_order_relaxed) +
+                                 _reserved_memory.load(std::memory_order_relaxed);
         *is_low_wartermark =
                 (weighted_mem_used > ((double)_memory_limit *
                                       _spill_low_watermark.load(std::memory_order_relaxed) / 100));
@@ -97,6 +98,21 @@ public:
                                       _spill_high_watermark.load(std::memory_order_relaxed) / 100));
     }
 
+    // Reserves `bytes` for an operator which is about to grow, it fails if the weighted memory
+    // used plus all reservations would exceed the high watermark of the group. The reservation
+    // is released by `release_reserved_memory` once the memory is consumed or not needed.
+    bool try_reserve_memory(int64_t bytes);
+
+    void release_reserved_memory(int64_t bytes) {
+        _reserved_memory.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    int64_t reserved_memory() const { return _reserved_memory.load(std::memory_order_relaxed); }
+
+    // Asks the queries with the largest revocable memory to revoke at least `bytes`, they
+    // spill before the others.
+    void revoke_memory_of_queries(int64_t bytes);
+
     std::string debug_string() const;
 
     void check_and_update(const WorkloadGroupInfo& tg_info);
@@ -168,6 +184,7 @@ private:
     int64_t _version;
     int64_t _memory_limit;                      // bytes
     std::atomic_int64_t _weighted_mem_used = 0; // bytes
+    std::atomic_int64_t _reserved_memory = 0;   // bytes
     bool _enable_memory_overcommit;
     std::atomic<uint64_t> _cpu_share;
     std::vector<TrackerLimiterGroup> _mem_tracker_limiter_pool;
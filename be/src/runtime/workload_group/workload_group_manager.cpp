@@ -21,6 +21,7 @@
 #include <mutex>
 #include <unordered_map>
 
+#include "common/config.h"
 #include "pipeline/task_scheduler.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/workload_group/workload_group.h"
@@ -219,6 +220,21 @@ void WorkloadGroupMgr::refresh_wg_memory_info() {
         wg_mem_info.is_low_wartermark = (wg_mem_info.weighted_mem_used >
                                          ((double)wg_mem_limit * spill_low_water_mark / 100));
 
+        // arbitrate the revoking of the group again, the queries asked last time may have
+        // spilled or finished
+        if (config::enable_query_memory_reservation && wg_mem_limit > 0) {
+            for (const auto& [query_id, query_ctx_ptr] : all_wg_queries[wg.first]) {
+                if (auto query_ctx = query_ctx_ptr.lock()) {
+                    query_ctx->clear_revoke_request();
+                }
+            }
+            auto wg_high_limit = int64_t((double)wg_mem_limit * spill_high_water_mark / 100);
+            auto wg_mem_demand = wg_mem_info.weighted_mem_used + wg.second->reserved_memory();
+            if (wg_mem_demand > wg_high_limit) {
+                wg.second->revoke_memory_of_queries(wg_mem_demand - wg_high_limit);
+            }
+        }
+
         // calculate query weighted memory limit of task group
         const auto& wg_queries = all_wg_queries[wg.first];
         auto wg_query_count = wg_queries.size();
@@ -61,6 +61,9 @@ public:
             const arrow::flight::sql::StatementQueryTicket& command) {
         ARROW_ASSIGN_OR_RAISE(auto pair, decode_ticket(command.statement_handle));
         const std::string& sql = pair.first;
+        // The id in the ticket is the fragment instance id of a result sink. A parallel result
+        // sink has an endpoint for each of its instances, and every endpoint reads the result
+        // buffer of its own instance, so the clients can fetch them in parallel.
         const std::string query_id = pair.second;
         TUniqueId queryid;
         parse_id(query_id, &queryid);
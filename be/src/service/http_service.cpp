@@ -52,6 +52,7 @@
 #include "http/action/report_action.h"
 #include "http/action/reset_rpc_channel_action.h"
 #include "http/action/restore_tablet_action.h"
+#include "http/action/scan_io_stats_action.h"
 #include "http/action/snapshot_action.h"
 #include "http/action/stream_load.h"
 #include "http/action/stream_load_2pc.h"
@@ -165,6 +166,12 @@ Status HttpService::start() {
             _pool.add(new TabletsInfoAction(_env, TPrivilegeHier::GLOBAL, TPrivilegeType::ADMIN));
     _ev_http_server->register_handler(HttpMethod::GET, "/tablets_json", tablets_info_action);
 
+    // Register scan io stats action
+    ScanIOStatsAction* scan_io_stats_action =
+            _pool.add(new ScanIOStatsAction(_env, TPrivilegeHier::GLOBAL, TPrivilegeType::ADMIN));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/scan_io_stats",
+                                      scan_io_stats_action);
+
     // register pprof actions
     static_cast<void>(PprofActions::setup(_env, _ev_http_server.get(), _pool));
 
@@ -43,6 +43,7 @@
 #include <vec/exec/vjdbc_connector.h>
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <filesystem>
 #include <memory>
@@ -184,6 +185,63 @@ private:
     google::protobuf::Closure* _done = nullptr;
 };
 
+// Runs the done of a transmit_block rpc which carries the packages of several instances, after
+// the done of every package has been run. The results of the packages after the first one are
+// returned in the response attachment, see append_message_to_attachment.
+class TransmitBlockBatchClosure {
+public:
+    TransmitBlockBatchClosure(brpc::Controller* cntl, google::protobuf::Closure* done,
+                              std::vector<PTransmitDataParams> requests)
+            : _cntl(cntl),
+              _done(done),
+              _requests(std::move(requests)),
+              _results(_requests.size()),
+              _num_pending(_requests.size() + 1) {
+        for (size_t i = 0; i <= _requests.size(); ++i) {
+            _sub_closures.push_back(std::make_unique<SubClosure>(this));
+        }
+    }
+
+    const PTransmitDataParams* request(size_t i) const { return &_requests[i]; }
+    PTransmitDataResult* result(size_t i) { return &_results[i]; }
+    // the done of the first package is 0
+    google::protobuf::Closure* sub_closure(size_t i) { return _sub_closures[i].get(); }
+
+private:
+    class SubClosure : public google::protobuf::Closure {
+    public:
+        explicit SubClosure(TransmitBlockBatchClosure* parent) : _parent(parent) {}
+        void Run() override { _parent->_sub_closure_done(); }
+
+    private:
+        TransmitBlockBatchClosure* _parent;
+    };
+
+    void _sub_closure_done() {
+        if (_num_pending.fetch_sub(1) != 1) {
+            return;
+        }
+        _cntl->response_attachment().clear();
+        for (const auto& result : _results) {
+            Status st = append_message_to_attachment(result, &_cntl->response_attachment());
+            if (!st.ok()) {
+                LOG(WARNING) << "failed to return the results of batched transmit_block: " << st;
+                _cntl->SetFailed(st.to_string());
+                break;
+            }
+        }
+        _done->Run();
+        delete this;
+    }
+
+    brpc::Controller* _cntl;
+    google::protobuf::Closure* _done;
+    std::vector<PTransmitDataParams> _requests;
+    std::vector<PTransmitDataResult> _results;
+    std::vector<std::unique_ptr<SubClosure>> _sub_closures;
+    std::atomic<size_t> _num_pending;
+};
+
 PInternalService::PInternalService(ExecEnv* exec_env)
         : _exec_env(exec_env),
           _heavy_work_pool(config::brpc_heavy_work_pool_threads != -1
@@ -1501,6 +1559,33 @@ void PInternalService::transmit_block(google::protobuf::RpcController* controlle
     int64_t receive_time = GetCurrentTimeNanos();
     response->set_receive_time(receive_time);
 
+    auto* cntl = static_cast<brpc::Controller*>(controller);
+    if (!cntl->request_attachment().empty()) {
+        // the column values of the blocks and the packages of other instances on this host
+        // are carried by the attachment
+        std::vector<PTransmitDataParams> requests;
+        Status st = extract_transmit_requests_from_attachment(
+                &cntl->request_attachment(), const_cast<PTransmitDataParams*>(request),
+                &requests);
+        if (!st.ok()) {
+            st.to_protobuf(response->mutable_status());
+            done->Run();
+            return;
+        }
+        if (!requests.empty()) {
+            size_t num_requests = requests.size();
+            auto* batch_closure = new TransmitBlockBatchClosure(cntl, done, std::move(requests));
+            _transmit_block(controller, request, response, batch_closure->sub_closure(0),
+                            Status::OK());
+            for (size_t i = 0; i < num_requests; ++i) {
+                batch_closure->result(i)->set_receive_time(receive_time);
+                _transmit_block(controller, batch_closure->request(i), batch_closure->result(i),
+                                batch_closure->sub_closure(i + 1), Status::OK());
+            }
+            return;
+        }
+    }
+
     // under high concurrency, thread pool will have a lot of lock contention.
     // May offer failed to the thread pool, so that we should avoid using thread
     // pool here.
@@ -24,7 +24,9 @@
 #include <gen_cpp/internal_service.pb.h>
 #include <stdlib.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <unordered_map>
 #include <vector>
 
@@ -35,6 +37,7 @@
 #include "olap/lru_cache.h"
 #include "olap/olap_tuple.h"
 #include "olap/row_cursor.h"
+#include "olap/schema.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
 #include "olap/tablet_schema.h"
@@ -44,6 +47,8 @@
 #include "util/key_util.h"
 #include "util/runtime_profile.h"
 #include "util/thrift_util.h"
+#include "vec/columns/column_string.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/serde/data_type_serde.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -270,13 +275,27 @@ Status PointQueryExecutor::_init_keys(const PTabletKeyLookupRequest* request) {
         }
     }
     _row_read_ctxs.resize(olap_tuples.size());
+    // the schema of the cursors is built once and shared by all the keys, like the scan keys of
+    // TabletReader, a multi-key lookup builds only one schema
+    const TabletSchemaSPtr tablet_schema = _tablet->tablet_schema();
+    std::shared_ptr<Schema> key_schema;
+    if (!olap_tuples.empty() && olap_tuples[0].size() <= tablet_schema->num_columns()) {
+        std::vector<uint32_t> columns(olap_tuples[0].size());
+        std::iota(columns.begin(), columns.end(), 0);
+        key_schema = std::make_shared<Schema>(tablet_schema->columns(), columns);
+    }
     // get row cursor and encode keys
     for (size_t i = 0; i < olap_tuples.size(); ++i) {
         RowCursor cursor;
-        RETURN_IF_ERROR(cursor.init_scan_key(_tablet->tablet_schema(), olap_tuples[i].values()));
+        if (key_schema != nullptr && olap_tuples[i].size() == olap_tuples[0].size()) {
+            RETURN_IF_ERROR(
+                    cursor.init_scan_key(tablet_schema, olap_tuples[i].values(), key_schema));
+        } else {
+            RETURN_IF_ERROR(cursor.init_scan_key(tablet_schema, olap_tuples[i].values()));
+        }
         RETURN_IF_ERROR(cursor.from_tuple(olap_tuples[i]));
         encode_key_with_padding<RowCursor, true>(&_row_read_ctxs[i]._primary_key, cursor,
-                                                 _tablet->tablet_schema()->num_key_columns(), true);
+                                                 tablet_schema->num_key_columns(), true);
     }
     return Status::OK();
 }
@@ -295,7 +314,14 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
-    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+    // lookup the keys in their order, so that the primary key index of each segment is walked
+    // forward and the index pages loaded for a key are reused by the following keys
+    std::vector<size_t> key_order(_row_read_ctxs.size());
+    std::iota(key_order.begin(), key_order.end(), 0);
+    std::sort(key_order.begin(), key_order.end(), [this](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._primary_key < _row_read_ctxs[rhs]._primary_key;
+    });
+    for (size_t i : key_order) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
             RowCache::CacheHandle cache_handle;
@@ -329,6 +355,8 @@ Status PointQueryExecutor::_lookup_row_key() {
 Status PointQueryExecutor::_lookup_row_data() {
     // 3. get values
     SCOPED_TIMER(&_profile_metrics.lookup_data_ns);
+    std::vector<std::string> values(_row_read_ctxs.size());
+    RETURN_IF_ERROR(_read_rows_by_segment(values));
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         if (_row_read_ctxs[i]._cached_row_data.valid()) {
             vectorized::JsonbSerializeUtil::jsonb_to_block(
@@ -341,21 +369,75 @@ Status PointQueryExecutor::_lookup_row_data() {
         if (!_row_read_ctxs[i]._row_location.has_value()) {
             continue;
         }
-        std::string value;
-        RETURN_IF_ERROR(_tablet->lookup_row_data(
-                _row_read_ctxs[i]._primary_key, _row_read_ctxs[i]._row_location.value(),
-                *(_row_read_ctxs[i]._rowset_ptr), _reusable->tuple_desc(),
-                _profile_metrics.read_stats, value,
-                !config::disable_storage_row_cache /*whether write row cache*/));
         // serilize value to block, currently only jsonb row formt
         vectorized::JsonbSerializeUtil::jsonb_to_block(
-                _reusable->get_data_type_serdes(), value.data(), value.size(),
+                _reusable->get_data_type_serdes(), values[i].data(), values[i].size(),
                 _reusable->get_col_uid_to_idx(), *_result_block,
                 _reusable->get_col_default_values());
     }
     return Status::OK();
 }
 
+Status PointQueryExecutor::_read_rows_by_segment(std::vector<std::string>& values) {
+    // the rows missing in the row cache, ordered by their locations
+    std::vector<size_t> rows_to_read;
+    for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
+        if (!_row_read_ctxs[i]._cached_row_data.valid() &&
+            _row_read_ctxs[i]._row_location.has_value()) {
+            rows_to_read.push_back(i);
+        }
+    }
+    std::sort(rows_to_read.begin(), rows_to_read.end(), [this](size_t lhs, size_t rhs) {
+        return _row_read_ctxs[lhs]._row_location.value() <
+               _row_read_ctxs[rhs]._row_location.value();
+    });
+
+    // each segment reads all its rows in one pass over the row store column
+    size_t begin = 0;
+    while (begin < rows_to_read.size()) {
+        const auto& ctx = _row_read_ctxs[rows_to_read[begin]];
+        const RowLocation& location = ctx._row_location.value();
+        std::vector<uint32_t> rowids;
+        // the position of each row in `rowids`, a key may be queried more than once
+        std::vector<size_t> positions;
+        size_t end = begin;
+        for (; end < rows_to_read.size(); ++end) {
+            const RowLocation& row_location =
+                    _row_read_ctxs[rows_to_read[end]]._row_location.value();
+            if (row_location.rowset_id != location.rowset_id ||
+                row_location.segment_id != location.segment_id) {
+                break;
+            }
+            if (rowids.empty() || rowids.back() != row_location.row_id) {
+                rowids.push_back(row_location.row_id);
+            }
+            positions.push_back(rowids.size() - 1);
+        }
+
+        vectorized::MutableColumnPtr column = vectorized::ColumnString::create();
+        RETURN_IF_ERROR(BaseTablet::lookup_rows_data(*(ctx._rowset_ptr), location.segment_id,
+                                                     rowids, _profile_metrics.read_stats,
+                                                     column));
+        if (column->size() != rowids.size()) {
+            return Status::InternalError("read {} rows from segment {} of rowset {}, expect {}",
+                                         column->size(), location.segment_id,
+                                         location.rowset_id.to_string(), rowids.size());
+        }
+        const auto* string_column = assert_cast<const vectorized::ColumnString*>(column.get());
+        for (size_t i = begin; i < end; ++i) {
+            StringRef value = string_column->get_data_at(positions[i - begin]);
+            values[rows_to_read[i]] = value.to_string();
+            if (!config::disable_storage_row_cache) {
+                RowCache::instance()->insert(
+                        {_tablet->tablet_id(), _row_read_ctxs[rows_to_read[i]]._primary_key},
+                        Slice {value.data, value.size});
+            }
+        }
+        begin = end;
+    }
+    return Status::OK();
+}
+
 template <typename MysqlWriter>
 Status _serialize_block(MysqlWriter& mysql_writer, vectorized::Block& block,
                         PTabletKeyLookupResponse* response) {
@@ -285,6 +285,8 @@ private:
     Status _lookup_row_key();
 
     Status _lookup_row_data();
+    // Read the rows missing in the row cache into `values`, grouped by the segments.
+    Status _read_rows_by_segment(std::vector<std::string>& values);
 
     Status _output_data();
 
@@ -22,6 +22,9 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/array/data.h>
+#include <arrow/array/util.h>
+#include <arrow/buffer.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
@@ -66,18 +69,59 @@ class Array;
 
 namespace doris {
 
+namespace {
+
+// An arrow buffer over the memory of a column, which shares the ownership of the column.
+class ColumnBuffer final : public arrow::Buffer {
+public:
+    ColumnBuffer(vectorized::ColumnPtr column, const char* data, int64_t size)
+            : arrow::Buffer(reinterpret_cast<const uint8_t*>(data), size),
+              _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
+// Whether the values of the column of `type_idx` are laid out as the values of `arrow_type`.
+bool has_arrow_layout(vectorized::TypeIndex type_idx, arrow::Type::type arrow_type) {
+    switch (type_idx) {
+    case vectorized::TypeIndex::Int8:
+        return arrow_type == arrow::Type::INT8;
+    case vectorized::TypeIndex::Int16:
+        return arrow_type == arrow::Type::INT16;
+    case vectorized::TypeIndex::Int32:
+        return arrow_type == arrow::Type::INT32;
+    case vectorized::TypeIndex::Int64:
+        return arrow_type == arrow::Type::INT64;
+    case vectorized::TypeIndex::Float32:
+        return arrow_type == arrow::Type::FLOAT;
+    case vectorized::TypeIndex::Float64:
+        return arrow_type == arrow::Type::DOUBLE;
+    case vectorized::TypeIndex::Decimal128V2:
+    case vectorized::TypeIndex::Decimal128V3:
+        // both are the unscaled int128, as arrow::Decimal128
+        return arrow_type == arrow::Type::DECIMAL128;
+    default:
+        return false;
+    }
+}
+
+} // namespace
+
 // Convert Block to an Arrow::Array
 // We should keep this function to keep compatible with arrow's type visitor
 // Now we inherit TypeVisitor to use default Visit implementation
 class FromBlockConverter : public arrow::TypeVisitor {
 public:
     FromBlockConverter(const vectorized::Block& block, const std::shared_ptr<arrow::Schema>& schema,
-                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj)
+                       arrow::MemoryPool* pool, const cctz::time_zone& timezone_obj,
+                       bool zero_copy)
             : _block(block),
               _schema(schema),
               _pool(pool),
               _cur_field_idx(-1),
-              _timezone_obj(timezone_obj) {}
+              _timezone_obj(timezone_obj),
+              _zero_copy(zero_copy) {}
 
     ~FromBlockConverter() override = default;
 
@@ -326,6 +370,13 @@ public:
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    // Wraps the values of `column` as an arrow buffer if they have the arrow layout, only the
+    // validity bitmap is built from the null map. `*array` is left null for the other columns.
+    arrow::Status _wrap_column(const vectorized::ColumnPtr& column,
+                               const vectorized::DataTypePtr& type,
+                               const std::shared_ptr<arrow::DataType>& arrow_type,
+                               std::shared_ptr<arrow::Array>* array);
+
     template <typename T>
     arrow::Status _visit(const T& type) {
         auto& builder = assert_cast<arrow::NumericBuilder<T>&>(*_cur_builder);
@@ -361,10 +412,43 @@ private:
     arrow::ArrayBuilder* _cur_builder = nullptr;
 
     const cctz::time_zone& _timezone_obj;
+    const bool _zero_copy;
 
     std::vector<std::shared_ptr<arrow::Array>> _arrays;
 };
 
+arrow::Status FromBlockConverter::_wrap_column(const vectorized::ColumnPtr& column,
+                                               const vectorized::DataTypePtr& type,
+                                               const std::shared_ptr<arrow::DataType>& arrow_type,
+                                               std::shared_ptr<arrow::Array>* array) {
+    if (!has_arrow_layout(vectorized::remove_nullable(type)->get_type_id(), arrow_type->id())) {
+        return arrow::Status::OK();
+    }
+    const auto rows = static_cast<int64_t>(column->size());
+    const vectorized::IColumn* values = column.get();
+    std::shared_ptr<arrow::Buffer> validity;
+    int64_t null_count = 0;
+    if (const auto* nullable = vectorized::check_and_get_column<vectorized::ColumnNullable>(
+                column.get())) {
+        values = &nullable->get_nested_column();
+        const auto& null_map = nullable->get_null_map_data();
+        null_count = std::count(null_map.begin(), null_map.end(), 1);
+        if (null_count > 0) {
+            // the null map has a byte per row, arrow has a bit
+            ARROW_ASSIGN_OR_RAISE(validity, arrow::AllocateEmptyBitmap(rows, _pool));
+            auto* bits = validity->mutable_data();
+            for (int64_t i = 0; i < rows; ++i) {
+                bits[i >> 3] |= static_cast<uint8_t>(!null_map[i]) << (i & 7);
+            }
+        }
+    }
+    const auto raw = values->get_raw_data();
+    auto buffer = std::make_shared<ColumnBuffer>(column, raw.data, raw.size);
+    *array = arrow::MakeArray(
+            arrow::ArrayData::Make(arrow_type, rows, {validity, buffer}, null_count));
+    return arrow::Status::OK();
+}
+
 Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     size_t num_fields = _schema->num_fields();
     if (_block.columns() != num_fields) {
@@ -379,6 +463,17 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
         _cur_rows = _block.rows();
         _cur_col = _block.get_by_position(idx).column;
         _cur_type = _block.get_by_position(idx).type;
+        if (_zero_copy) {
+            auto column = _cur_col->convert_to_full_column_if_const();
+            auto arrow_st = _wrap_column(column, _cur_type, _schema->field(idx)->type(),
+                                         &_arrays[_cur_field_idx]);
+            if (!arrow_st.ok()) {
+                return to_doris_status(arrow_st);
+            }
+            if (_arrays[_cur_field_idx] != nullptr) {
+                continue;
+            }
+        }
         std::unique_ptr<arrow::ArrayBuilder> builder;
         auto arrow_st = arrow::MakeBuilder(_pool, _schema->field(idx)->type(), &builder);
         if (!arrow_st.ok()) {
@@ -406,8 +501,8 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj) {
-    FromBlockConverter converter(block, schema, pool, timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool zero_copy) {
+    FromBlockConverter converter(block, schema, pool, timezone_obj, zero_copy);
     return converter.convert(result);
 }
 
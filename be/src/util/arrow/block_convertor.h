@@ -38,9 +38,12 @@ class Schema;
 
 namespace doris {
 
+// With `zero_copy`, the fixed width numeric and decimal columns whose values are laid out as
+// arrow's are not copied: the arrays of `result` share the ownership of the columns and read
+// their memory. So the caller must not mutate these columns of `block` while `result` is alive.
 Status convert_to_arrow_batch(const vectorized::Block& block,
                               const std::shared_ptr<arrow::Schema>& schema, arrow::MemoryPool* pool,
                               std::shared_ptr<arrow::RecordBatch>* result,
-                              const cctz::time_zone& timezone_obj);
+                              const cctz::time_zone& timezone_obj, bool zero_copy = false);
 
 } // namespace doris
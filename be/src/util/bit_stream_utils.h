@@ -102,6 +102,12 @@ public:
     template <typename T>
     bool GetValue(int num_bits, T* v);
 
+    // Gets the next 'batch_size' values from the buffer. The values after the next byte
+    // boundary are unpacked 32 at a time by BitPacking. Returns false if there are not
+    // enough bytes left, the values read so far are unspecified then.
+    template <typename T>
+    bool GetBatch(int num_bits, T* v, int batch_size);
+
     // Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T needs to be a
     // little-endian native type and big enough to store 'num_bytes'. The value is assumed
     // to be byte-aligned so the stream will be advanced to the start of the next byte
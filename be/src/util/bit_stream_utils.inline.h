@@ -21,6 +21,7 @@
 #pragma once
 
 #include <algorithm>
+#include <type_traits>
 
 #include "glog/logging.h"
 #include "util/alignment.h"
@@ -135,6 +136,39 @@ bool BitReader::GetValue(int num_bits, T* v) {
     return true;
 }
 
+template <typename T>
+bool BitReader::GetBatch(int num_bits, T* v, int batch_size) {
+    DCHECK_LE(num_bits, sizeof(T) * 8);
+    if (PREDICT_FALSE(position() + static_cast<int64_t>(num_bits) * batch_size >
+                      static_cast<int64_t>(max_bytes_) * 8)) {
+        return false;
+    }
+    int i = 0;
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        using UT = std::make_unsigned_t<T>;
+        // at most 7 values are read one by one to reach a byte boundary
+        for (; i < batch_size && (bit_offset_ & 7) != 0 && num_bits != 0; ++i) {
+            GetValue(num_bits, v + i);
+        }
+        const int num_unpack = (batch_size - i) / 32 * 32;
+        if (num_unpack > 0) {
+            const int pos = byte_offset_ + bit_offset_ / 8;
+            const auto [end, num_read] =
+                    BitPacking::UnpackValues(num_bits, buffer_ + pos, max_bytes_ - pos,
+                                             num_unpack, reinterpret_cast<UT*>(v + i));
+            DCHECK_EQ(num_read, num_unpack);
+            i += num_unpack;
+            byte_offset_ = static_cast<int>(end - buffer_);
+            bit_offset_ = 0;
+            BufferValues();
+        }
+    }
+    for (; i < batch_size; ++i) {
+        GetValue(num_bits, v + i);
+    }
+    return true;
+}
+
 inline void BitReader::Rewind(int num_bits) {
     bit_offset_ -= num_bits;
     if (bit_offset_ >= 0) {
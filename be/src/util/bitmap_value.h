@@ -931,10 +931,23 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // the 32-bit bitmaps of the same high bytes are or-ed at once, roaring ors their
+        // containers lazily and repairs the cardinalities only once at the end.
+        phmap::btree_map<uint32_t, std::vector<const roaring::Roaring*>> groups;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                groups[map_entry.first].push_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [key, bitmaps] : groups) {
+            if (bitmaps.size() == 1) {
+                ans.roarings.emplace_hint(ans.roarings.end(), key, *bitmaps[0]);
+            } else {
+                ans.roarings.emplace_hint(ans.roarings.end(), key,
+                                          roaring::Roaring::fastunion(bitmaps.size(),
+                                                                      bitmaps.data()));
+            }
         }
         return ans;
     }
@@ -1619,7 +1632,14 @@ public:
             }
         }
 
-        if (!bitmaps.empty()) {
+        if (!bitmaps.empty() && _type == BITMAP) {
+            // the current bitmap joins the many-way union as one more input, so it is neither
+            // copied when shared nor or-ed with the union afterwards.
+            bitmaps.push_back(_bitmap.get());
+            _bitmap = std::make_shared<detail::Roaring64Map>(
+                    detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+            _is_shared = false;
+        } else if (!bitmaps.empty()) {
             _prepare_bitmap_for_write();
             switch (_type) {
             case EMPTY:
@@ -1630,7 +1650,6 @@ public:
                 _bitmap->add(_sv);
                 break;
             case BITMAP:
-                *_bitmap |= detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
                 break;
             case SET: {
                 *_bitmap = detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data());
@@ -0,0 +1,383 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#include "util/continuous_cpu_profiler.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+#include <fmt/format.h>
+#include <limits.h>
+#include <signal.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <map>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "common/phdr_cache.h"
+#include "common/stack_trace.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+#include "vec/common/demangle.h"
+
+#if defined(__ELF__) && !defined(__FreeBSD__)
+#include "common/symbol_index.h"
+#endif
+
+namespace doris {
+
+namespace {
+
+struct SampleHeader {
+    uint64_t query_id_hi;
+    uint64_t query_id_lo;
+    uint64_t workload_group_id;
+    uint64_t num_frames;
+};
+
+struct Sample {
+    SampleHeader header;
+    uintptr_t frames[StackTrace::capacity];
+};
+
+// a write of a sample to the pipe is atomic
+static_assert(sizeof(Sample) <= PIPE_BUF);
+
+#ifndef __APPLE__
+std::atomic<int> s_write_fd = -1;
+bool s_with_stacks = false;
+
+void* interrupted_address(const ucontext_t& context) {
+#if defined(__x86_64__) && defined(__linux__)
+    return reinterpret_cast<void*>(context.uc_mcontext.gregs[REG_RIP]);
+#elif defined(__aarch64__) && defined(__linux__)
+    return reinterpret_cast<void*>(context.uc_mcontext.pc);
+#else
+    return nullptr;
+#endif
+}
+
+// Async signal safe, the unwinding of `StackTrace` is only with the phdr cache.
+void on_cpu_sample(int, siginfo_t*, void* context) {
+    int saved_errno = errno;
+    int fd = s_write_fd.load(std::memory_order_relaxed);
+    if (fd >= 0) {
+        Sample sample;
+        sample.header.query_id_hi = cpu_profiler::t_query_id_hi;
+        sample.header.query_id_lo = cpu_profiler::t_query_id_lo;
+        sample.header.workload_group_id = cpu_profiler::t_workload_group_id;
+        size_t num_frames = 0;
+        const auto& ucontext = *reinterpret_cast<const ucontext_t*>(context);
+        if (s_with_stacks) {
+            StackTrace stack_trace(ucontext);
+            const auto& frames = stack_trace.getFramePointers();
+            for (size_t i = stack_trace.getOffset(); i < stack_trace.getSize(); ++i) {
+                sample.frames[num_frames++] = reinterpret_cast<uintptr_t>(frames[i]);
+            }
+        } else if (void* address = interrupted_address(ucontext); address != nullptr) {
+            sample.frames[num_frames++] = reinterpret_cast<uintptr_t>(address);
+        }
+        sample.header.num_frames = num_frames;
+        // the sample is dropped if the pipe is full
+        [[maybe_unused]] auto size = ::write(
+                fd, &sample, sizeof(SampleHeader) + num_frames * sizeof(uintptr_t));
+    }
+    errno = saved_errno;
+}
+
+// The signal of the samples, not SIGPROF which the on-demand profiling of gperftools takes.
+int sample_signal() {
+    return SIGRTMIN + 5;
+}
+#endif
+
+} // namespace
+
+size_t ContinuousCpuProfiler::StackKeyHash::operator()(const StackKey& key) const {
+    size_t seed = std::hash<TUniqueId>()(key.query_id);
+    seed = HashUtil::hash64(&key.workload_group_id, sizeof(key.workload_group_id), seed);
+    return HashUtil::hash64(key.frames.data(), key.frames.size() * sizeof(uintptr_t), seed);
+}
+
+Status ContinuousCpuProfiler::start() {
+#ifdef __APPLE__
+    return Status::NotSupported("continuous cpu profiling is not supported on macos");
+#else
+    if (_started) {
+        return Status::OK();
+    }
+    if (config::continuous_cpu_profile_frequency <= 0) {
+        return Status::InvalidArgument("continuous_cpu_profile_frequency is {}",
+                                       config::continuous_cpu_profile_frequency);
+    }
+    if (pipe2(_pipe, O_CLOEXEC | O_NONBLOCK) != 0) {
+        return Status::InternalError("failed to create the pipe of cpu samples, errno={}", errno);
+    }
+    // hold the samples of about a second of 32 busy cores, fine if the kernel limits it
+    static_cast<void>(fcntl(_pipe[1], F_SETPIPE_SZ, 1 << 20));
+
+    if (config::continuous_cpu_profile_with_stacks) {
+        updatePHDRCache();
+    }
+    s_with_stacks = config::continuous_cpu_profile_with_stacks && hasPHDRCache();
+    s_write_fd = _pipe[1];
+    _current.start_time = MonotonicSeconds();
+
+    struct sigaction action {};
+    action.sa_sigaction = on_cpu_sample;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(sample_signal(), &action, nullptr) != 0) {
+        stop();
+        return Status::InternalError("failed to install the cpu sample handler, errno={}", errno);
+    }
+
+    static_assert(sizeof(timer_t) <= sizeof(_timer));
+    timer_t timer;
+    struct sigevent event {};
+    event.sigev_notify = SIGEV_SIGNAL;
+    event.sigev_signo = sample_signal();
+    if (timer_create(CLOCK_PROCESS_CPUTIME_ID, &event, &timer) != 0) {
+        stop();
+        return Status::InternalError("failed to create the cpu sample timer, errno={}", errno);
+    }
+    memcpy(&_timer, &timer, sizeof(timer));
+    _started = true;
+
+    int64_t interval_ns = 1000000000L / config::continuous_cpu_profile_frequency;
+    struct itimerspec spec {};
+    spec.it_interval.tv_sec = interval_ns / 1000000000L;
+    spec.it_interval.tv_nsec = interval_ns % 1000000000L;
+    spec.it_value = spec.it_interval;
+    if (timer_settime(timer, 0, &spec, nullptr) != 0) {
+        stop();
+        return Status::InternalError("failed to start the cpu sample timer, errno={}", errno);
+    }
+    LOG(INFO) << "continuous cpu profiler started, frequency="
+              << config::continuous_cpu_profile_frequency << ", with_stacks=" << s_with_stacks;
+    return Status::OK();
+#endif
+}
+
+void ContinuousCpuProfiler::stop() {
+#ifndef __APPLE__
+    if (_started) {
+        timer_t timer;
+        memcpy(&timer, &_timer, sizeof(timer));
+        timer_delete(timer);
+        _started = false;
+    }
+    // the signals still pending are ignored
+    signal(sample_signal(), SIG_IGN);
+    s_write_fd = -1;
+    for (int& fd : _pipe) {
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+    }
+#endif
+}
+
+void ContinuousCpuProfiler::collect() {
+    if (_pipe[0] < 0) {
+        return;
+    }
+    char buffer[64 * 1024];
+    while (true) {
+        ssize_t n = ::read(_pipe[0], buffer, sizeof(buffer));
+        if (n <= 0) {
+            break;
+        }
+        _pending.append(buffer, n);
+        size_t offset = 0;
+        while (_pending.size() - offset >= sizeof(SampleHeader)) {
+            SampleHeader header;
+            memcpy(&header, _pending.data() + offset, sizeof(header));
+            size_t size = sizeof(SampleHeader) + header.num_frames * sizeof(uintptr_t);
+            if (_pending.size() - offset < size) {
+                break;
+            }
+            uintptr_t frames[StackTrace::capacity];
+            memcpy(frames, _pending.data() + offset + sizeof(SampleHeader),
+                   header.num_frames * sizeof(uintptr_t));
+            TUniqueId query_id;
+            query_id.__set_hi(header.query_id_hi);
+            query_id.__set_lo(header.query_id_lo);
+            _aggregate(query_id, header.workload_group_id, frames, header.num_frames);
+            offset += size;
+        }
+        _pending.erase(0, offset);
+    }
+}
+
+void ContinuousCpuProfiler::_aggregate(const TUniqueId& query_id, uint64_t workload_group_id,
+                                       const uintptr_t* frames, size_t num_frames) {
+    StackKey key {query_id, workload_group_id, {frames, frames + num_frames}};
+    std::lock_guard l(_lock);
+    _current.query_samples[query_id]++;
+    _current.workload_group_samples[workload_group_id]++;
+    auto it = _current.stacks.find(key);
+    if (it != _current.stacks.end()) {
+        it->second++;
+    } else if (_current.stacks.size() < config::continuous_cpu_profile_max_stacks) {
+        _current.stacks.emplace(std::move(key), 1);
+    } else {
+        _current.dropped_samples++;
+    }
+}
+
+void ContinuousCpuProfiler::rotate_if_needed() {
+    int64_t now = MonotonicSeconds();
+    std::lock_guard l(_lock);
+    if (now - _current.start_time >= config::continuous_cpu_profile_window_seconds) {
+        _previous = std::move(_current);
+        _current = Window();
+        _current.start_time = now;
+    }
+}
+
+void ContinuousCpuProfiler::reset() {
+    std::lock_guard l(_lock);
+    _previous = Window();
+    _current = Window();
+    _current.start_time = MonotonicSeconds();
+}
+
+std::string ContinuousCpuProfiler::folded_stacks(const TUniqueId* query_id,
+                                                 const uint64_t* workload_group_id) {
+    std::vector<std::pair<StackKey, uint64_t>> stacks;
+    uint64_t dropped_samples = 0;
+    {
+        std::lock_guard l(_lock);
+        for (const auto* window : {&_previous, &_current}) {
+            for (const auto& [key, samples] : window->stacks) {
+                if ((query_id == nullptr || key.query_id == *query_id) &&
+                    (workload_group_id == nullptr || key.workload_group_id == *workload_group_id)) {
+                    stacks.emplace_back(key, samples);
+                }
+            }
+            dropped_samples += window->dropped_samples;
+        }
+    }
+
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    auto symbol_index = SymbolIndex::instance();
+#endif
+    std::unordered_map<uintptr_t, std::string> symbols;
+    auto symbolize = [&](uintptr_t address) -> const std::string& {
+        auto [it, inserted] = symbols.try_emplace(address);
+        if (inserted) {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+            if (const auto* symbol = symbol_index->findSymbol(reinterpret_cast<void*>(address))) {
+                it->second = demangle(symbol->name);
+            }
+#endif
+            if (it->second.empty()) {
+                it->second = fmt::format("{:#x}", address);
+            }
+            // ';' separates the frames and ' ' the count in the folded format
+            std::replace(it->second.begin(), it->second.end(), ';', ':');
+        }
+        return it->second;
+    };
+
+    // different addresses of the same functions fold into one line
+    std::map<std::string, uint64_t> folded;
+    for (const auto& [key, samples] : stacks) {
+        std::string line = fmt::format("workload_group_{};query_{}", key.workload_group_id,
+                                       print_id(key.query_id));
+        for (auto it = key.frames.rbegin(); it != key.frames.rend(); ++it) {
+            line += ';';
+            line += symbolize(*it);
+        }
+        folded[line] += samples;
+    }
+    if (dropped_samples > 0 && query_id == nullptr && workload_group_id == nullptr) {
+        folded["[dropped]"] += dropped_samples;
+    }
+
+    std::string result;
+    for (const auto& [line, samples] : folded) {
+        result += fmt::format("{} {}\n", line, samples);
+    }
+    return result;
+}
+
+std::string ContinuousCpuProfiler::top_json() {
+    std::unordered_map<TUniqueId, uint64_t> query_samples;
+    std::unordered_map<uint64_t, uint64_t> workload_group_samples;
+    uint64_t total_samples = 0;
+    {
+        std::lock_guard l(_lock);
+        for (const auto* window : {&_previous, &_current}) {
+            for (const auto& [query_id, samples] : window->query_samples) {
+                query_samples[query_id] += samples;
+                total_samples += samples;
+            }
+            for (const auto& [workload_group_id, samples] : window->workload_group_samples) {
+                workload_group_samples[workload_group_id] += samples;
+            }
+        }
+    }
+    auto by_samples = [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; };
+    std::vector<std::pair<TUniqueId, uint64_t>> queries(query_samples.begin(),
+                                                        query_samples.end());
+    std::sort(queries.begin(), queries.end(), by_samples);
+    std::vector<std::pair<uint64_t, uint64_t>> workload_groups(workload_group_samples.begin(),
+                                                               workload_group_samples.end());
+    std::sort(workload_groups.begin(), workload_groups.end(), by_samples);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("frequency");
+    writer.Int(config::continuous_cpu_profile_frequency);
+    writer.Key("total_samples");
+    writer.Uint64(total_samples);
+    writer.Key("queries");
+    writer.StartArray();
+    for (const auto& [query_id, samples] : queries) {
+        writer.StartObject();
+        writer.Key("query_id");
+        writer.String(print_id(query_id).c_str());
+        writer.Key("samples");
+        writer.Uint64(samples);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key("workload_groups");
+    writer.StartArray();
+    for (const auto& [workload_group_id, samples] : workload_groups) {
+        writer.StartObject();
+        writer.Key("workload_group_id");
+        writer.Uint64(workload_group_id);
+        writer.Key("samples");
+        writer.Uint64(samples);
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+} // namespace doris
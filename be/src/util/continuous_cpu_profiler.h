@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+#include "util/hash_util.hpp" // IWYU pragma: keep
+
+namespace doris {
+
+namespace cpu_profiler {
+// The query and the workload group the current thread works for, which tag its cpu samples.
+// Set by attaching the thread to a query, see `ThreadContext::attach_task`.
+inline thread_local uint64_t t_query_id_hi = 0;
+inline thread_local uint64_t t_query_id_lo = 0;
+inline thread_local uint64_t t_workload_group_id = 0;
+} // namespace cpu_profiler
+
+// Samples the call stacks of the threads burning cpu, `config::continuous_cpu_profile_frequency`
+// times per second of the process cpu time, and keeps the sample counts of each call stack per
+// query and workload group of the last two windows of `continuous_cpu_profile_window_seconds`,
+// so that the cpu of a hot BE can be attributed to the queries and the workload groups at any
+// time, e.g. as a flame graph.
+//
+// A process cpu time timer signals the thread on cpu, whose handler only writes the tags and
+// the frames of the sample to a pipe, and the collecting thread aggregates them.
+class ContinuousCpuProfiler {
+public:
+    static ContinuousCpuProfiler* instance() {
+        static ContinuousCpuProfiler profiler;
+        return &profiler;
+    }
+
+    Status start();
+    void stop();
+    bool started() const { return _started; }
+
+    // Aggregate the samples written since the last call, called by the collecting thread.
+    void collect();
+    // Start a new window if the current one is old enough.
+    void rotate_if_needed();
+
+    // The samples in the folded format of flame graphs, one line of "frame;frame;... count"
+    // per call stack, the outermost frame first. Only the samples of `query_id` or
+    // `workload_group_id` if they are set.
+    std::string folded_stacks(const TUniqueId* query_id, const uint64_t* workload_group_id);
+
+    // The sample counts of each query and each workload group in json.
+    std::string top_json();
+
+    // Drop all the aggregated samples.
+    void reset();
+
+private:
+    struct StackKey {
+        TUniqueId query_id;
+        uint64_t workload_group_id;
+        std::vector<uintptr_t> frames;
+
+        bool operator==(const StackKey& rhs) const {
+            return query_id == rhs.query_id && workload_group_id == rhs.workload_group_id &&
+                   frames == rhs.frames;
+        }
+    };
+    struct StackKeyHash {
+        size_t operator()(const StackKey& key) const;
+    };
+
+    // the aggregated samples of a window
+    struct Window {
+        int64_t start_time = 0;
+        std::unordered_map<StackKey, uint64_t, StackKeyHash> stacks;
+        std::unordered_map<TUniqueId, uint64_t> query_samples;
+        std::unordered_map<uint64_t, uint64_t> workload_group_samples;
+        // the samples of the call stacks dropped for `config::continuous_cpu_profile_max_stacks`
+        uint64_t dropped_samples = 0;
+    };
+
+    void _aggregate(const TUniqueId& query_id, uint64_t workload_group_id,
+                    const uintptr_t* frames, size_t num_frames);
+
+    std::atomic<bool> _started = false;
+    void* _timer = nullptr;
+    int _pipe[2] = {-1, -1};
+    // the bytes read from the pipe but not aggregated yet, a part of a sample
+    std::string _pending;
+
+    std::mutex _lock;
+    Window _current;
+    Window _previous;
+};
+
+} // namespace doris
@@ -187,6 +187,16 @@ DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(num_io_bytes_read_total, MetricUnit::OPERAT
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(num_io_bytes_read_from_cache, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(num_io_bytes_read_from_remote, MetricUnit::OPERATIONS);
 
+DEFINE_SUMMARY_METRIC_PROTOTYPE_5ARG(local_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                     file_read_latency_us, Labels({{"type", "local"}}));
+DEFINE_SUMMARY_METRIC_PROTOTYPE_5ARG(s3_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                     file_read_latency_us, Labels({{"type", "s3"}}));
+DEFINE_SUMMARY_METRIC_PROTOTYPE_5ARG(hdfs_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                     file_read_latency_us, Labels({{"type", "hdfs"}}));
+DEFINE_SUMMARY_METRIC_PROTOTYPE_5ARG(broker_file_read_latency_us, MetricUnit::MICROSECONDS, "",
+                                     file_read_latency_us, Labels({{"type", "broker"}}));
+DEFINE_SUMMARY_METRIC_PROTOTYPE_2ARG(file_cache_lookup_latency_us, MetricUnit::MICROSECONDS);
+
 const std::string DorisMetrics::_s_registry_name = "doris_be";
 const std::string DorisMetrics::_s_hook_name = "doris_metrics";
 
@@ -306,6 +316,18 @@ DorisMetrics::DorisMetrics() : _metric_registry(_s_registry_name) {
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_server_metric_entity, num_io_bytes_read_total);
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_server_metric_entity, num_io_bytes_read_from_cache);
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_server_metric_entity, num_io_bytes_read_from_remote);
+
+    LATENCY_HISTOGRAM_METRIC_REGISTER(_server_metric_entity, local_file_read_latency_us);
+    LATENCY_HISTOGRAM_METRIC_REGISTER(_server_metric_entity, s3_file_read_latency_us);
+    LATENCY_HISTOGRAM_METRIC_REGISTER(_server_metric_entity, hdfs_file_read_latency_us);
+    LATENCY_HISTOGRAM_METRIC_REGISTER(_server_metric_entity, broker_file_read_latency_us);
+    LATENCY_HISTOGRAM_METRIC_REGISTER(_server_metric_entity, file_cache_lookup_latency_us);
+    dependency_block_latency_us = std::make_unique<LatencyHistogramFamily>(
+            _server_metric_entity.get(), "dependency_block_latency_us", "dependency");
+    exchange_rpc_latency_us = std::make_unique<LatencyHistogramFamily>(
+            _server_metric_entity.get(), "exchange_rpc_latency_us", "host");
+    meta_service_rpc_latency_us = std::make_unique<LatencyHistogramFamily>(
+            _server_metric_entity.get(), "meta_service_rpc_latency_us", "op");
 }
 
 void DorisMetrics::initialize(bool init_system_metrics, const std::set<std::string>& disk_devices,
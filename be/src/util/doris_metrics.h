@@ -230,6 +230,19 @@ public:
     IntAtomicCounter* num_io_bytes_read_from_cache = nullptr;
     IntAtomicCounter* num_io_bytes_read_from_remote = nullptr;
 
+    // The tail latencies, in microseconds
+    LatencyHistogramMetric* local_file_read_latency_us = nullptr;
+    LatencyHistogramMetric* s3_file_read_latency_us = nullptr;
+    LatencyHistogramMetric* hdfs_file_read_latency_us = nullptr;
+    LatencyHistogramMetric* broker_file_read_latency_us = nullptr;
+    LatencyHistogramMetric* file_cache_lookup_latency_us = nullptr;
+    // how long a pipeline task is blocked by a dependency, by the name of the dependency
+    std::unique_ptr<LatencyHistogramFamily> dependency_block_latency_us;
+    // the round trip of the exchange rpcs, by the destination host
+    std::unique_ptr<LatencyHistogramFamily> exchange_rpc_latency_us;
+    // the rpcs to the meta service in the cloud mode, by the operation
+    std::unique_ptr<LatencyHistogramFamily> meta_service_rpc_latency_us;
+
     static DorisMetrics* instance() {
         static DorisMetrics instance;
         return &instance;
@@ -25,7 +25,9 @@
 #include <iostream>
 #include <iterator>
 #include <limits>
+#include <type_traits>
 
+#include "common/config.h"
 #include "util/bit_util.h"
 #include "util/coding.h"
 
@@ -144,13 +146,8 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
     }
 
     // 2. save min value.
-    if (sizeof(T) == 16) {
-        put_fixed128_le(_buffer, min);
-    } else if (sizeof(T) == 8) {
-        put_fixed64_le(_buffer, min);
-    } else {
-        put_fixed32_le(_buffer, min);
-    }
+    put_fixed(min);
+    bool is_min_delta = false;
 
     // 3.1 save original value.
     if (is_keep_original_value) {
@@ -169,6 +166,23 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
             for (uint8_t i = 1; i < _buffered_values_num; ++i) {
                 delta_values[i] = input[i] - input[i - 1];
             }
+            if (config::enable_delta_bitpacked_encoding && _buffered_values_num > 1) {
+                T min_delta = *std::min_element(delta_values + 1,
+                                                delta_values + _buffered_values_num);
+                T max_delta = *std::max_element(delta_values + 1,
+                                                delta_values + _buffered_values_num);
+                uint8_t min_delta_bit_width = bits(static_cast<T>(max_delta - min_delta));
+                // worth the bytes of MinDelta
+                if (static_cast<size_t>(bit_width - min_delta_bit_width) * _buffered_values_num >
+                    sizeof(T) * 8) {
+                    bit_width = min_delta_bit_width;
+                    is_min_delta = true;
+                    put_fixed(min_delta);
+                    for (uint8_t i = 1; i < _buffered_values_num; ++i) {
+                        delta_values[i] = delta_values[i] - min_delta;
+                    }
+                }
+            }
         } else {
             bit_width = bits(static_cast<T>(max - min));
             for (uint8_t i = 0; i < _buffered_values_num; ++i) {
@@ -186,6 +200,8 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
     uint8_t storage_format = 0;
     if (is_keep_original_value) {
         storage_format = 2;
+    } else if (is_min_delta) {
+        storage_format = 3;
     } else if (is_ascending) {
         storage_format = 1;
     }
@@ -195,6 +211,17 @@ void ForEncoder<T>::bit_packing_one_frame_value(const T* input) {
     _buffered_values_num = 0;
 }
 
+template <typename T>
+void ForEncoder<T>::put_fixed(T value) {
+    if (sizeof(T) == 16) {
+        put_fixed128_le(_buffer, value);
+    } else if (sizeof(T) == 8) {
+        put_fixed64_le(_buffer, value);
+    } else {
+        put_fixed32_le(_buffer, value);
+    }
+}
+
 template <typename T>
 uint32_t ForEncoder<T>::flush() {
     if (_buffered_values_num != 0) {
@@ -253,12 +280,14 @@ bool ForDecoder<T>::init() {
         bit_width_offset += 2;
 
         _frame_offsets.push_back(frame_start_offset);
+        // MinValue, and MinDelta of StorageFormat 3
+        uint32_t fixed_values = order_flag == 3 ? 2 : 1;
         if (sizeof(T) == 16) {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 16;
+            frame_start_offset += bit_width * _max_frame_size / 8 + 16 * fixed_values;
         } else if (sizeof(T) == 8) {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 8;
+            frame_start_offset += bit_width * _max_frame_size / 8 + 8 * fixed_values;
         } else {
-            frame_start_offset += bit_width * _max_frame_size / 8 + 4;
+            frame_start_offset += bit_width * _max_frame_size / 8 + 4 * fixed_values;
         }
     }
 
@@ -276,6 +305,24 @@ bool ForDecoder<T>::init() {
 // param[out] output: the original integer data list
 template <typename T>
 void ForDecoder<T>::bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
+    if constexpr (std::is_integral_v<T> && sizeof(T) <= 8) {
+        if (bit_width == 0) {
+            std::fill(output, output + in_num, 0);
+            return;
+        }
+        // Read a value at once from the 8 bytes holding it, as a big endian word. At most 7 bytes
+        // after the frame are read, which are in the footer of 2 bytes per frame + 5 bytes.
+        if (bit_width <= 57) {
+            for (uint32_t i = 0; i < in_num; ++i) {
+                uint32_t bit_offset = i * bit_width;
+                uint64_t word;
+                memcpy(&word, input + bit_offset / 8, sizeof(word));
+                word = BitUtil::byte_swap(word);
+                output[i] = static_cast<T>((word << (bit_offset % 8)) >> (64 - bit_width));
+            }
+            return;
+        }
+    }
     unsigned char in_mask = 0x80;
     int bit_index = 0;
     while (in_num > 0) {
@@ -322,6 +369,23 @@ void ForDecoder<T>::decode_current_frame(T* output) {
     bool is_original_value = _storage_formats[_current_decoded_frame] == 2;
     if (is_original_value) {
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
+    } else if (_storage_formats[_current_decoded_frame] == 3) {
+        T min_delta = 0;
+        if (sizeof(T) == 16) {
+            min_delta = decode_fixed128_le(_buffer + delta_offset);
+            delta_offset += 16;
+        } else if (sizeof(T) == 8) {
+            min_delta = decode_fixed64_le(_buffer + delta_offset);
+            delta_offset += 8;
+        } else {
+            min_delta = decode_fixed32_le(_buffer + delta_offset);
+            delta_offset += 4;
+        }
+        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
+        output[0] = min;
+        for (uint8_t i = 1; i < current_frame_size; i++) {
+            output[i] = output[i] + output[i - 1] + min_delta;
+        }
     } else {
         bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
         std::vector<T> delta_values(current_frame_size);
@@ -75,6 +75,12 @@ uint8_t bits(const T v) {
 // (3) if the StorageFormat == 2:  When overflow occurs when using (1) or (2) and save original values:
 //      MinValue, (Value[i]) * FrameValueNum
 //
+// (4) if the StorageFormat == 3: When input data order is ascending, and the deltas from the
+//     smallest delta need fewer bits, e.g. timestamps of a fixed interval, the BitPackingFrame is:
+//      MinValue, MinDelta, (Value[i] - Value[i - 1] - MinDelta) * FrameValueNum
+//     It is only written if config::enable_delta_bitpacked_encoding, the versions without it
+//     can't read it.
+//
 // len(MinValue) can be 32(uint32_t), 64(uint64_t), 128(uint128_t)
 //
 // The OrderFlag is 1 represents ascending order, 0 represents  not ascending order
@@ -108,6 +114,8 @@ private:
 
     void bit_packing_one_frame_value(const T* input);
 
+    void put_fixed(T value);
+
     const T* copy_value(const T* val, size_t count);
 
     const T numeric_limits_max();
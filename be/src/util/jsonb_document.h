@@ -988,7 +988,8 @@ private:
 
         while (pch < fence) {
             JsonbKeyValue* pkey = (JsonbKeyValue*)(pch);
-            if (klen == pkey->klen() && strncmp(key, pkey->getKeyStr(), klen) == 0) {
+            // memcmp compares word by word, strncmp byte by byte since it stops at a NUL
+            if (klen == pkey->klen() && memcmp(key, pkey->getKeyStr(), klen) == 0) {
                 return iterator(pkey);
             }
             pch += pkey->numPackedBytes();
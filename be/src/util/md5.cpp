@@ -28,7 +28,7 @@ void Md5Digest::update(const void* data, size_t length) {
 }
 
 void Md5Digest::digest() {
-    unsigned char buf[MD5_DIGEST_LENGTH];
+    unsigned char* buf = _raw;
     MD5_Final(buf, &_md5_ctx);
 
     char hex_buf[2 * MD5_DIGEST_LENGTH];
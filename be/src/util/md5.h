@@ -32,10 +32,13 @@ public:
     void digest();
 
     const std::string& hex() const { return _hex; }
+    // the raw MD5_DIGEST_LENGTH bytes of the digest
+    const unsigned char* raw() const { return _raw; }
 
 private:
     MD5_CTX _md5_ctx;
     std::string _hex;
+    unsigned char _raw[MD5_DIGEST_LENGTH];
 };
 
 } // namespace doris
@@ -196,6 +196,15 @@ bool MemInfo::process_full_gc() {
                 ss.str());
     }};
 
+    if (config::enable_cache_prune_by_cost) {
+        // Prune the caches that are cheap to refill first, only prune all if not enough.
+        freed_mem += CacheManager::instance()->for_each_cache_prune_by_cost(
+                _s_process_full_gc_size, profile.get());
+        if (freed_mem > _s_process_full_gc_size) {
+            notify_je_purge_dirty_pages();
+            return true;
+        }
+    }
     freed_mem += CacheManager::instance()->for_each_cache_prune_all(profile.get());
     notify_je_purge_dirty_pages();
     if (freed_mem > _s_process_full_gc_size) {
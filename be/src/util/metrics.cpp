@@ -17,11 +17,14 @@
 
 #include "util/metrics.h"
 
+#include <fmt/format.h>
 #include <glog/logging.h>
 #include <rapidjson/encodings.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
+#include <cmath>
 #include <initializer_list>
 
 #include "common/config.h"
@@ -213,6 +216,86 @@ rj::Value HistogramMetric::to_json_value(rj::Document::AllocatorType& allocator)
     return json_value;
 }
 
+const std::vector<std::pair<std::string, double>> LatencyHistogramMetric::_s_output_percentiles =
+        {{"0.5", 50.0}, {"0.99", 99.0}, {"0.999", 99.9}};
+
+void LatencyHistogramMetric::clear() {
+    for (auto& bucket : _buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    _num.store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogramMetric::bucket_upper_bound(size_t index) {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    int shift = static_cast<int>(index / kSubBuckets) - 1;
+    uint64_t lower = (kSubBuckets + index % kSubBuckets) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+uint64_t LatencyHistogramMetric::percentile(double p) const {
+    // count the buckets rather than use `_num`, which the concurrent `add` may have bumped
+    // before the bucket
+    uint64_t counts[kNumBuckets];
+    uint64_t total = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        counts[i] = _buckets[i].load(std::memory_order_relaxed);
+        total += counts[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    auto rank = static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * total));
+    rank = std::max<uint64_t>(rank, 1);
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        seen += counts[i];
+        if (seen >= rank) {
+            // the max is exact, and tighter than the bound of the last bucket
+            return std::min(bucket_upper_bound(i), max());
+        }
+    }
+    return max();
+}
+
+std::string LatencyHistogramMetric::to_string() const {
+    return fmt::format("count={}, sum={}, p50={}, p99={}, p999={}, max={}", num(), sum(),
+                       percentile(50), percentile(99), percentile(99.9), max());
+}
+
+std::string LatencyHistogramMetric::to_prometheus(const std::string& display_name,
+                                                  const Labels& entity_labels,
+                                                  const Labels& metric_labels) const {
+    std::stringstream ss;
+    for (const auto& [quantile, p] : _s_output_percentiles) {
+        auto quantile_label = Labels({{"quantile", quantile}});
+        ss << display_name << labels_to_string({&entity_labels, &metric_labels, &quantile_label})
+           << " " << percentile(p) << "\n";
+    }
+    ss << display_name << "_sum" << labels_to_string({&entity_labels, &metric_labels}) << " "
+       << sum() << "\n";
+    ss << display_name << "_count" << labels_to_string({&entity_labels, &metric_labels}) << " "
+       << num() << "\n";
+    ss << display_name << "_max" << labels_to_string({&entity_labels, &metric_labels}) << " "
+       << max() << "\n";
+    return ss.str();
+}
+
+rj::Value LatencyHistogramMetric::to_json_value(rj::Document::AllocatorType& allocator) const {
+    rj::Value json_value(rj::kObjectType);
+    json_value.AddMember("total_count", rj::Value(num()), allocator);
+    json_value.AddMember("total_sum", rj::Value(sum()), allocator);
+    json_value.AddMember("p50", rj::Value(percentile(50)), allocator);
+    json_value.AddMember("p99", rj::Value(percentile(99)), allocator);
+    json_value.AddMember("p999", rj::Value(percentile(99.9)), allocator);
+    json_value.AddMember("max", rj::Value(max()), allocator);
+    return json_value;
+}
+
 std::string MetricPrototype::simple_name() const {
     return group_name.empty() ? name : group_name;
 }
@@ -270,6 +353,40 @@ void MetricEntity::trigger_hook_unlocked(bool force) const {
     }
 }
 
+LatencyHistogramMetric* LatencyHistogramFamily::get(const std::string& label_value) {
+    {
+        std::shared_lock l(_lock);
+        auto it = _metrics.find(label_value);
+        if (it != _metrics.end()) {
+            return it->second;
+        }
+        if (_other != nullptr) {
+            return _other;
+        }
+    }
+    std::lock_guard l(_lock);
+    auto it = _metrics.find(label_value);
+    if (it != _metrics.end()) {
+        return it->second;
+    }
+    if (_other != nullptr) {
+        return _other;
+    }
+    bool overflow = _metrics.size() >= _max_labels;
+    const std::string& value = overflow ? "other" : label_value;
+    auto& prototype = _prototypes.emplace_back(std::make_unique<MetricPrototype>(
+            MetricType::SUMMARY, MetricUnit::MICROSECONDS, _name + "_" + value, "", _name,
+            Labels({{_label_key, value}})));
+    auto* metric = (LatencyHistogramMetric*)_entity->register_metric<LatencyHistogramMetric>(
+            prototype.get());
+    if (overflow) {
+        _other = metric;
+    } else {
+        _metrics.emplace(label_value, metric);
+    }
+    return metric;
+}
+
 MetricRegistry::~MetricRegistry() {}
 
 std::shared_ptr<MetricEntity> MetricRegistry::register_entity(const std::string& name,
@@ -27,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -35,6 +36,7 @@
 
 #include "util/core_local.h"
 #include "util/histogram.h"
+#include "util/time.h"
 
 namespace doris {
 
@@ -205,6 +207,81 @@ protected:
     HistogramStat _stats;
 };
 
+// A lock-free log-linear histogram of latencies, for the tail percentiles like p99 and p999.
+// Like the HdrHistogram, every power of two range is split into `kSubBuckets` linear buckets,
+// so a percentile is off by less than 1/kSubBuckets of its value, and `add` is only a few
+// relaxed atomic adds, cheap enough for the paths run per block or per rpc.
+class LatencyHistogramMetric : public Metric {
+public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr uint64_t kSubBuckets = 1 << kSubBucketBits;
+    static constexpr size_t kNumBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+    LatencyHistogramMetric() = default;
+    ~LatencyHistogramMetric() override = default;
+
+    LatencyHistogramMetric(const LatencyHistogramMetric&) = delete;
+    LatencyHistogramMetric& operator=(const LatencyHistogramMetric&) = delete;
+
+    void add(uint64_t value) {
+        _buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        _num.fetch_add(1, std::memory_order_relaxed);
+        _sum.fetch_add(value, std::memory_order_relaxed);
+        uint64_t max = _max.load(std::memory_order_relaxed);
+        while (value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+        }
+    }
+    void clear();
+
+    uint64_t num() const { return _num.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return _sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return _max.load(std::memory_order_relaxed); }
+    // The upper bound of the bucket of the `p` percentile, p in (0, 100], 0 if empty.
+    uint64_t percentile(double p) const;
+
+    static size_t bucket_index(uint64_t value) {
+        if (value < kSubBuckets) {
+            return value;
+        }
+        int exp = 63 - __builtin_clzll(value);
+        uint64_t sub = (value >> (exp - kSubBucketBits)) & (kSubBuckets - 1);
+        return (exp - kSubBucketBits + 1) * kSubBuckets + sub;
+    }
+    static uint64_t bucket_upper_bound(size_t index);
+
+    std::string to_string() const override;
+    std::string to_prometheus(const std::string& display_name, const Labels& entity_labels,
+                              const Labels& metric_labels) const override;
+    rj::Value to_json_value(rj::Document::AllocatorType& allocator) const override;
+
+private:
+    static const std::vector<std::pair<std::string, double>> _s_output_percentiles;
+
+    std::atomic<uint64_t> _buckets[kNumBuckets] {};
+    std::atomic<uint64_t> _num = 0;
+    std::atomic<uint64_t> _sum = 0;
+    std::atomic<uint64_t> _max = 0;
+};
+
+// Adds the time of its scope in microseconds to the histogram, nothing if it is nullptr.
+class ScopedLatencyTimer {
+public:
+    explicit ScopedLatencyTimer(LatencyHistogramMetric* metric)
+            : _metric(metric), _start_us(metric != nullptr ? MonotonicMicros() : 0) {}
+    ~ScopedLatencyTimer() {
+        if (_metric != nullptr) {
+            _metric->add(MonotonicMicros() - _start_us);
+        }
+    }
+
+    ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+    ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+
+private:
+    LatencyHistogramMetric* _metric;
+    int64_t _start_us;
+};
+
 template <typename T>
 class AtomicCounter : public AtomicMetric<T> {
 public:
@@ -296,6 +373,12 @@ public:
 #define DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(name, unit) \
     DEFINE_METRIC_PROTOTYPE(name, MetricType::HISTOGRAM, unit, "", "", Labels(), false)
 
+#define DEFINE_SUMMARY_METRIC_PROTOTYPE_2ARG(name, unit) \
+    DEFINE_METRIC_PROTOTYPE(name, MetricType::SUMMARY, unit, "", "", Labels(), false)
+
+#define DEFINE_SUMMARY_METRIC_PROTOTYPE_5ARG(name, unit, desc, group, labels) \
+    DEFINE_METRIC_PROTOTYPE(name, MetricType::SUMMARY, unit, desc, #group, labels, false)
+
 #define INT_COUNTER_METRIC_REGISTER(entity, metric) \
     metric = (IntCounter*)(entity->register_metric<IntCounter>(&METRIC_##metric))
 
@@ -314,6 +397,10 @@ public:
 #define HISTOGRAM_METRIC_REGISTER(entity, metric) \
     metric = (HistogramMetric*)(entity->register_metric<HistogramMetric>(&METRIC_##metric))
 
+#define LATENCY_HISTOGRAM_METRIC_REGISTER(entity, metric) \
+    metric = (LatencyHistogramMetric*)(entity->register_metric<LatencyHistogramMetric>( \
+            &METRIC_##metric))
+
 #define METRIC_DEREGISTER(entity, metric) entity->deregister_metric(&METRIC_##metric)
 
 // For 'metrics' in MetricEntity.
@@ -381,6 +468,36 @@ private:
     std::map<std::string, std::function<void()>> _hooks;
 };
 
+// The latency histograms of a metric split by a label, e.g. the destination of the rpcs. The
+// histogram of a label value is registered at its first `get`. Beyond `max_labels` values, the
+// new values share the label value "other", so a label of unbounded values can not grow the
+// metrics forever.
+class LatencyHistogramFamily {
+public:
+    LatencyHistogramFamily(MetricEntity* entity, std::string name, std::string label_key,
+                           size_t max_labels = 256)
+            : _entity(entity),
+              _name(std::move(name)),
+              _label_key(std::move(label_key)),
+              _max_labels(max_labels) {}
+
+    // Never nullptr, the histograms live as long as the entity.
+    LatencyHistogramMetric* get(const std::string& label_value);
+
+private:
+    MetricEntity* _entity;
+    const std::string _name;
+    const std::string _label_key;
+    const size_t _max_labels;
+
+    std::shared_mutex _lock;
+    std::unordered_map<std::string, LatencyHistogramMetric*> _metrics;
+    // shared by the label values beyond `max_labels`
+    LatencyHistogramMetric* _other = nullptr;
+    // the entity refers to the prototypes, which must outlive it
+    std::vector<std::unique_ptr<MetricPrototype>> _prototypes;
+};
+
 struct MetricEntityHash {
     size_t operator()(const std::shared_ptr<MetricEntity> metric_entity) const {
         return std::hash<std::string>()(metric_entity->name());
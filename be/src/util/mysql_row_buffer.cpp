@@ -475,6 +475,12 @@ int MysqlRowBuffer<is_binary_format>::push_string(const char* str, int64_t lengt
     return 0;
 }
 
+template <bool is_binary_format>
+int MysqlRowBuffer<is_binary_format>::push_encoded(const char* data, int64_t length) {
+    DCHECK(!is_binary_format && !_dynamic_mode);
+    return append(data, length);
+}
+
 template <bool is_binary_format>
 int MysqlRowBuffer<is_binary_format>::push_null() {
     if (_dynamic_mode) {
@@ -82,6 +82,8 @@ public:
     int push_ipv6(const IPv6Value& ipv6_val);
     int push_string(const char* str, int64_t length);
     int push_null();
+    // Appends cells already encoded by the text protocol, with their lengths or null flags.
+    int push_encoded(const char* data, int64_t length);
 
     template <typename DateType>
     int push_vec_datetime(DateType& data);
@@ -18,8 +18,12 @@
 #pragma once
 
 #include <brpc/http_method.h>
+#include <butil/iobuf.h>
 #include <gen_cpp/internal_service.pb.h>
 
+#include <string>
+#include <vector>
+
 #include "common/config.h"
 #include "common/status.h"
 #include "network_util.h"
@@ -153,4 +157,100 @@ Status attachment_extract_request(const Params* brpc_request, brpc::Controller*
     return Status::OK();
 }
 
+// The exchange sink may send the packages of several instances on the same host by one
+// transmit_block rpc. The requests after the first one are appended to the request attachment,
+// and their results to the response attachment. The column values of a block may be carried
+// by the attachment too, right after the request of the block, so that they are not copied
+// when the request is serialized, see column_values_in_attachment.
+// Every message or column values in the attachment is a frame prefixed by its size.
+inline void append_frame_to_attachment(const butil::IOBuf& frame, butil::IOBuf* attachment) {
+    int64_t size = frame.size();
+    attachment->append(&size, sizeof(size));
+    attachment->append(frame);
+}
+
+inline Status cut_frame_from_attachment(butil::IOBuf* attachment, butil::IOBuf* frame) {
+    int64_t size = 0;
+    if (attachment->cutn(&size, sizeof(size)) != sizeof(size) || size < 0 ||
+        attachment->cutn(frame, size) != static_cast<size_t>(size)) {
+        return Status::Corruption("truncated frame in attachment");
+    }
+    return Status::OK();
+}
+
+template <typename Message>
+Status append_message_to_attachment(const Message& message, butil::IOBuf* attachment) {
+    std::string str;
+    if (!message.SerializeToString(&str)) {
+        return Status::InternalError("failed to serialize {} to attachment",
+                                     message.GetTypeName());
+    }
+    int64_t size = str.size();
+    attachment->append(&size, sizeof(size));
+    attachment->append(str);
+    return Status::OK();
+}
+
+template <typename Message>
+Status cut_message_from_attachment(butil::IOBuf* attachment, Message* message) {
+    butil::IOBuf frame;
+    RETURN_IF_ERROR(cut_frame_from_attachment(attachment, &frame));
+    butil::IOBufAsZeroCopyInputStream stream(frame);
+    if (!message->ParseFromZeroCopyStream(&stream)) {
+        return Status::Corruption("failed to parse {} from attachment", message->GetTypeName());
+    }
+    return Status::OK();
+}
+
+template <typename Message>
+Status extract_messages_from_attachment(butil::IOBuf* attachment,
+                                        std::vector<Message>* messages) {
+    while (!attachment->empty()) {
+        RETURN_IF_ERROR(cut_message_from_attachment(attachment, &messages->emplace_back()));
+    }
+    return Status::OK();
+}
+
+// A block always has column values if it has columns, so the one without them has its column
+// values carried by the attachment.
+inline bool column_values_in_attachment(const PBlock& block) {
+    return block.column_metas_size() > 0 && !block.has_column_values();
+}
+
+// Moves the column values of the block to `values` without copying them.
+inline void detach_column_values(PBlock* block, butil::IOBuf* values) {
+    if (block->column_metas_size() == 0 || !block->has_column_values()) {
+        return;
+    }
+    auto* column_values = new std::string(std::move(*block->mutable_column_values()));
+    block->clear_column_values();
+    values->append_user_data(column_values->data(), column_values->size(),
+                             [column_values](void*) { delete column_values; });
+}
+
+inline Status extract_column_values_from_attachment(butil::IOBuf* attachment,
+                                                    PTransmitDataParams* request) {
+    if (!request->has_block() || !column_values_in_attachment(request->block())) {
+        return Status::OK();
+    }
+    butil::IOBuf frame;
+    RETURN_IF_ERROR(cut_frame_from_attachment(attachment, &frame));
+    // Block::deserialize needs the column values in one piece
+    frame.copy_to(request->mutable_block()->mutable_column_values());
+    return Status::OK();
+}
+
+// Extracts the column values of `first` and the requests batched after it.
+inline Status extract_transmit_requests_from_attachment(
+        butil::IOBuf* attachment, PTransmitDataParams* first,
+        std::vector<PTransmitDataParams>* others) {
+    RETURN_IF_ERROR(extract_column_values_from_attachment(attachment, first));
+    while (!attachment->empty()) {
+        auto& request = others->emplace_back();
+        RETURN_IF_ERROR(cut_message_from_attachment(attachment, &request));
+        RETURN_IF_ERROR(extract_column_values_from_attachment(attachment, &request));
+    }
+    return Status::OK();
+}
+
 } // namespace doris
@@ -55,6 +55,32 @@ inline uint32_t bytes32_mask_to_bits32_mask(const bool* data) {
     return bytes32_mask_to_bits32_mask(reinterpret_cast<const uint8_t*>(data));
 }
 
+/// Transform the 64 bytes equal to `byte` to a 64-bit mask
+inline uint64_t bytes64_mask_of_byte(const uint8_t* data, uint8_t byte) {
+#ifdef __AVX2__
+    auto byte32 = _mm256_set1_epi8(static_cast<char>(byte));
+    auto mask_of = [&](const uint8_t* p) {
+        return static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)), byte32))));
+    };
+    return mask_of(data) | (mask_of(data + 32) << 32);
+#elif defined(__SSE2__) || defined(__aarch64__)
+    auto byte16 = _mm_set1_epi8(static_cast<char>(byte));
+    auto mask_of = [&](const uint8_t* p) {
+        return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), byte16))));
+    };
+    return mask_of(data) | (mask_of(data + 16) << 16) | (mask_of(data + 32) << 32) |
+           (mask_of(data + 48) << 48);
+#else
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < 64; ++i) {
+        mask |= static_cast<uint64_t>(byte == data[i]) << i;
+    }
+    return mask;
+#endif
+}
+
 inline size_t count_zero_num(const int8_t* __restrict data, size_t size) {
     size_t num = 0;
     const int8_t* end = data + size;
@@ -54,6 +54,8 @@ public:
         }
     }
 
+    bool is_running() const { return _running; }
+
     // Restarts the timer. Returns the elapsed time until this point.
     uint64_t reset() {
         uint64_t ret = elapsed_time();
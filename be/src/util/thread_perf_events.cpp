@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#include "util/thread_perf_events.h"
+
+#include <errno.h>
+#ifndef __APPLE__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+#include <string.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "common/config.h"
+#include "common/logging.h"
+
+namespace doris {
+
+// the events of the nested scopes of the innermost `ScopedPerfEvents` of the thread
+static thread_local ThreadPerfEvents::Values t_nested_values {};
+
+#ifndef __APPLE__
+static bool init_event_attr(perf_event_attr* attr, ThreadPerfEvents::Event event) {
+    memset(attr, 0, sizeof(perf_event_attr));
+    attr->size = sizeof(perf_event_attr);
+    attr->type = PERF_TYPE_HARDWARE;
+    switch (event) {
+    case ThreadPerfEvents::CYCLES:
+        attr->config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case ThreadPerfEvents::INSTRUCTIONS:
+        attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case ThreadPerfEvents::LLC_MISSES:
+        attr->type = PERF_TYPE_HW_CACHE;
+        attr->config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    case ThreadPerfEvents::BRANCH_MISSES:
+        attr->config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    default:
+        return false;
+    }
+    attr->exclude_kernel = 1;
+    attr->exclude_hv = 1;
+    attr->read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                        PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return true;
+}
+#endif
+
+ThreadPerfEvents::~ThreadPerfEvents() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+ThreadPerfEvents* ThreadPerfEvents::current() {
+    static thread_local std::unique_ptr<ThreadPerfEvents> events;
+    static thread_local bool opened = false;
+    if (!opened) {
+        opened = true;
+        std::unique_ptr<ThreadPerfEvents> new_events(new ThreadPerfEvents());
+        if (new_events->_open()) {
+            events = std::move(new_events);
+        }
+    }
+    return events.get();
+}
+
+bool ThreadPerfEvents::_open() {
+#ifdef __APPLE__
+    return false;
+#else
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        perf_event_attr attr;
+        init_event_attr(&attr, static_cast<Event>(i));
+        // pid 0 and cpu -1 count the calling thread on any cpu
+        int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, _group_fd, 0));
+        if (fd < 0) {
+            static bool logged = false;
+            if (!logged) {
+                logged = true;
+                LOG(WARNING) << "failed to open perf event " << i << ", errno=" << errno
+                             << ", the operators will not report perf events";
+            }
+            return false;
+        }
+        _fds[i] = fd;
+        if (_group_fd < 0) {
+            _group_fd = fd;
+        }
+    }
+    return true;
+#endif
+}
+
+bool ThreadPerfEvents::read(Values* values) const {
+    // nr, time_enabled, time_running, then a value per event
+    uint64_t buffer[3 + NUM_EVENTS];
+    if (::read(_group_fd, buffer, sizeof(buffer)) != sizeof(buffer) || buffer[0] != NUM_EVENTS) {
+        return false;
+    }
+    double scale = buffer[2] > 0 ? static_cast<double>(buffer[1]) / buffer[2] : 1.0;
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        (*values)[i] = static_cast<int64_t>(buffer[3 + i] * scale);
+    }
+    return true;
+}
+
+void PerfEventCounters::init(RuntimeProfile* profile, int64_t level) {
+    if (!config::enable_pipeline_perf_events) {
+        return;
+    }
+    static const char* names[ThreadPerfEvents::NUM_EVENTS] = {"CpuCycles", "Instructions",
+                                                              "LLCMisses", "BranchMisses"};
+    for (int i = 0; i < ThreadPerfEvents::NUM_EVENTS; ++i) {
+        _counters[i] = ADD_COUNTER_WITH_LEVEL(profile, names[i], TUnit::UNIT, level);
+    }
+}
+
+void PerfEventCounters::update(const ThreadPerfEvents::Values& values) {
+    for (int i = 0; i < ThreadPerfEvents::NUM_EVENTS; ++i) {
+        _counters[i]->update(values[i]);
+    }
+}
+
+ScopedPerfEvents::ScopedPerfEvents(PerfEventCounters* counters, bool inclusive)
+        : _inclusive(inclusive) {
+    if (counters == nullptr || !counters->enabled()) {
+        return;
+    }
+    _events = ThreadPerfEvents::current();
+    if (_events == nullptr || !_events->read(&_start)) {
+        return;
+    }
+    _counters = counters;
+    _outer_nested = t_nested_values;
+    t_nested_values = {};
+}
+
+ScopedPerfEvents::~ScopedPerfEvents() {
+    if (_counters == nullptr) {
+        return;
+    }
+    ThreadPerfEvents::Values end;
+    if (!_events->read(&end)) {
+        end = _start;
+    }
+    ThreadPerfEvents::Values self;
+    for (int i = 0; i < ThreadPerfEvents::NUM_EVENTS; ++i) {
+        int64_t total = end[i] - _start[i];
+        self[i] = _inclusive ? total : std::max<int64_t>(total - t_nested_values[i], 0);
+        _outer_nested[i] += total;
+    }
+    _counters->update(self);
+    t_nested_values = _outer_nested;
+}
+
+} // namespace doris
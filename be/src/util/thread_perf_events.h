@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#pragma once
+
+#include <stdint.h>
+
+#include <array>
+
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+// Counts the cpu cycles, instructions, last level cache misses and branch misses of the current
+// thread by a perf_event group, which the kernel keeps counting with no sampling interrupt.
+// A group is opened once per thread on the first use and read by a single read(2).
+class ThreadPerfEvents {
+public:
+    enum Event { CYCLES = 0, INSTRUCTIONS, LLC_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+    using Values = std::array<int64_t, NUM_EVENTS>;
+
+    ~ThreadPerfEvents();
+
+    // The events of the current thread, nullptr if perf events are not available, e.g. when
+    // `perf_event_paranoid` forbids them or in a container without the permission.
+    static ThreadPerfEvents* current();
+
+    // The counts since the group was opened, scaled if the kernel multiplexed the events.
+    bool read(Values* values) const;
+
+private:
+    ThreadPerfEvents() = default;
+    bool _open();
+
+    int _group_fd = -1;
+    std::array<int, NUM_EVENTS> _fds {-1, -1, -1, -1};
+};
+
+// The perf event counters of an operator in its profile.
+class PerfEventCounters {
+public:
+    // Add the counters to `profile` at `level` if `config::enable_pipeline_perf_events`.
+    void init(RuntimeProfile* profile, int64_t level);
+
+    bool enabled() const { return _counters[0] != nullptr; }
+
+    void update(const ThreadPerfEvents::Values& values);
+
+private:
+    std::array<RuntimeProfile::Counter*, ThreadPerfEvents::NUM_EVENTS> _counters {};
+};
+
+// Adds the events of the current thread within the scope to `counters`, except those already
+// added by the nested scopes, e.g. an operator does not count the events of its children which
+// it pulls blocks from, unless `inclusive`. Does nothing if `counters` is nullptr or not enabled.
+class ScopedPerfEvents {
+public:
+    ScopedPerfEvents(PerfEventCounters* counters, bool inclusive = false);
+    ~ScopedPerfEvents();
+
+private:
+    PerfEventCounters* _counters = nullptr;
+    ThreadPerfEvents* _events = nullptr;
+    bool _inclusive;
+    ThreadPerfEvents::Values _start {};
+    // the events of the nested scopes of the enclosing scope so far
+    ThreadPerfEvents::Values _outer_nested {};
+};
+
+} // namespace doris
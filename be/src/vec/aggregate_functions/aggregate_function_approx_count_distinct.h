@@ -24,6 +24,7 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "olap/hll.h"
 #include "util/hash_util.hpp"
@@ -75,6 +76,13 @@ struct AggregateFunctionApproxCountDistinctData {
         hll_data.deserialize(data);
     }
 
+    // merge the state written by `write`, without deserializing it to a HyperLogLog first
+    void read_and_merge(BufferReadable& buf) {
+        StringRef result;
+        read_binary(result, buf);
+        static_cast<void>(hll_data.merge_serialized(Slice(result.data, result.size)));
+    }
+
     int64_t get() const { return hll_data.estimate_cardinality(); }
 
     void reset() { hll_data.clear(); }
@@ -95,18 +103,31 @@ public:
 
     DataTypePtr get_return_type() const override { return std::make_shared<DataTypeInt64>(); }
 
-    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
-             Arena*) const override {
+    static uint64_t hash_at(const IColumn* column, size_t row_num) {
         if constexpr (IsFixLenColumnType<ColumnDataType>::value) {
-            auto column = assert_cast<const ColumnDataType*>(columns[0]);
-            auto value = column->get_element(row_num);
-            this->data(place).add(
-                    HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED));
+            auto value = assert_cast<const ColumnDataType*>(column)->get_element(row_num);
+            return HashUtil::murmur_hash64A((char*)&value, sizeof(value), HashUtil::MURMUR_SEED);
         } else {
-            auto value = assert_cast<const ColumnDataType*>(columns[0])->get_data_at(row_num);
-            uint64_t hash_value =
-                    HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
-            this->data(place).add(hash_value);
+            auto value = assert_cast<const ColumnDataType*>(column)->get_data_at(row_num);
+            return HashUtil::murmur_hash64A(value.data, value.size, HashUtil::MURMUR_SEED);
+        }
+    }
+
+    void add(AggregateDataPtr __restrict place, const IColumn** columns, ssize_t row_num,
+             Arena*) const override {
+        this->data(place).add(hash_at(columns[0], row_num));
+    }
+
+    // hash the whole column first, so the hashing is not interleaved with the register updates
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena*) const override {
+        std::vector<uint64_t> hash_values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            hash_values[i] = hash_at(columns[0], i);
+        }
+        auto& data = this->data(place);
+        for (auto hash_value : hash_values) {
+            data.add(hash_value);
         }
     }
 
@@ -126,6 +147,11 @@ public:
         this->data(place).read(buf);
     }
 
+    void deserialize_and_merge(AggregateDataPtr __restrict place, AggregateDataPtr __restrict rhs,
+                               BufferReadable& buf, Arena*) const override {
+        this->data(place).read_and_merge(buf);
+    }
+
     void insert_result_into(ConstAggregateDataPtr __restrict place, IColumn& to) const override {
         auto& column = assert_cast<ColumnInt64&>(to);
         column.get_data().push_back(this->data(place).get());
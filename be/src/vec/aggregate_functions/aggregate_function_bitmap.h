@@ -67,6 +67,9 @@ struct AggregateFunctionBitmapUnionOp {
 
     static void add_batch(BitmapValue& res, std::vector<const BitmapValue*>& data, bool& is_first) {
         res.fastunion(data);
+        if (!data.empty()) {
+            is_first = false;
+        }
     }
 
     static void merge(BitmapValue& res, const BitmapValue& data, bool& is_first) {
@@ -137,6 +140,21 @@ struct AggregateFunctionBitmapData {
 
     void merge(const BitmapValue& data) { Op::merge(value, data, is_first); }
 
+    // merge the states of [data, data + num), the unions are done by one many-way union
+    void merge_batch(const BitmapValue* data, size_t num) {
+        if constexpr (std::is_same_v<Op, AggregateFunctionBitmapUnionOp>) {
+            std::vector<const BitmapValue*> values(num);
+            for (size_t i = 0; i != num; ++i) {
+                values[i] = data + i;
+            }
+            Op::add_batch(value, values, is_first);
+        } else {
+            for (size_t i = 0; i != num; ++i) {
+                Op::merge(value, data[i], is_first);
+            }
+        }
+    }
+
     void write(BufferWritable& buf) const { DataTypeBitMap::serialize_as_stream(value, buf); }
 
     void read(BufferReadable& buf) { DataTypeBitMap::deserialize_as_stream(value, buf); }
@@ -197,9 +215,7 @@ public:
             const size_t num_rows = column.size();
             auto* data = col.get_data().data();
 
-            for (size_t i = 0; i != num_rows; ++i) {
-                this->data(place).merge(data[i]);
-            }
+            this->data(place).merge_batch(data, num_rows);
         } else {
             BaseHelper::deserialize_and_merge_from_column(place, column, arena);
         }
@@ -213,9 +229,7 @@ public:
         if (version >= BITMAP_SERDE) {
             auto& col = assert_cast<const ColumnBitmap&>(column);
             auto* data = col.get_data().data();
-            for (size_t i = begin; i <= end; ++i) {
-                this->data(place).merge(data[i]);
-            }
+            this->data(place).merge_batch(data + begin, end - begin + 1);
         } else {
             BaseHelper::deserialize_and_merge_from_column_range(place, column, begin, end, arena);
         }
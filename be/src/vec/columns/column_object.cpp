@@ -33,6 +33,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <vector>
 
@@ -521,13 +522,16 @@ bool ColumnObject::Subcolumn::check_if_sparse_column(size_t num_rows) {
     if (num_rows < config::variant_threshold_rows_to_estimate_sparse_column) {
         return false;
     }
+    return get_ratio_of_defaults() >= config::variant_ratio_of_defaults_as_sparse_column;
+}
+
+double ColumnObject::Subcolumn::get_ratio_of_defaults() const {
     std::vector<double> defaults_ratio;
     for (size_t i = 0; i < data.size(); ++i) {
         defaults_ratio.push_back(data[i]->get_ratio_of_default_rows());
     }
-    double default_ratio = std::accumulate(defaults_ratio.begin(), defaults_ratio.end(), 0.0) /
-                           defaults_ratio.size();
-    return default_ratio >= config::variant_ratio_of_defaults_as_sparse_column;
+    return std::accumulate(defaults_ratio.begin(), defaults_ratio.end(), 0.0) /
+           defaults_ratio.size();
 }
 
 void ColumnObject::Subcolumn::finalize() {
@@ -1309,6 +1313,7 @@ void ColumnObject::finalize(bool ignore_sparse) {
         new_subcolumns.create_root(subcolumns.get_root()->data);
         new_subcolumns.get_mutable_root()->data.finalize();
     }
+    std::vector<Subcolumns::NodePtr> dense_subcolumns;
     for (auto&& entry : subcolumns) {
         const auto& least_common_type = entry->data.get_least_common_type();
         /// Do not add subcolumns, which consists only from NULLs
@@ -1329,7 +1334,38 @@ void ColumnObject::finalize(bool ignore_sparse) {
             continue;
         }
 
-        new_subcolumns.add(entry->path, entry->data);
+        dense_subcolumns.push_back(entry);
+    }
+
+    // Keep the densest subcolumns when there are too many of them, the others are rare paths
+    // which are merged into the root column instead of getting their own pages
+    size_t max_subcolumns = std::max(config::variant_max_subcolumns_count, 0);
+    if (!ignore_sparse && max_subcolumns > 0 && dense_subcolumns.size() > max_subcolumns) {
+        std::vector<double> defaults_ratio;
+        defaults_ratio.reserve(dense_subcolumns.size());
+        for (const auto& entry : dense_subcolumns) {
+            defaults_ratio.push_back(entry->data.get_ratio_of_defaults());
+        }
+        std::vector<size_t> order(dense_subcolumns.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return defaults_ratio[lhs] < defaults_ratio[rhs];
+        });
+        std::vector<bool> is_sparse(dense_subcolumns.size(), false);
+        for (size_t i = max_subcolumns; i < order.size(); ++i) {
+            is_sparse[order[i]] = true;
+        }
+        for (size_t i = 0; i < dense_subcolumns.size(); ++i) {
+            if (is_sparse[i]) {
+                sparse_columns.add(dense_subcolumns[i]->path, dense_subcolumns[i]->data);
+            } else {
+                new_subcolumns.add(dense_subcolumns[i]->path, dense_subcolumns[i]->data);
+            }
+        }
+    } else {
+        for (const auto& entry : dense_subcolumns) {
+            new_subcolumns.add(entry->path, entry->data);
+        }
     }
     std::swap(subcolumns, new_subcolumns);
     doc_structure = nullptr;
@@ -147,6 +147,9 @@ public:
 
         bool check_if_sparse_column(size_t num_rows);
 
+        /// Returns the average ratio of default values of its parts.
+        double get_ratio_of_defaults() const;
+
         /// Returns last inserted field.
         Field get_last_field() const;
 
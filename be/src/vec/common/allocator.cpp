@@ -23,8 +23,11 @@
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
+#include <mutex>
 #include <new>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 // Allocator is used by too many files. For compilation speed, put dependencies in `.cpp` as much as possible.
 #include "runtime/fragment_mgr.h"
@@ -36,6 +39,51 @@
 #include "util/stack_util.h"
 #include "util/uid_util.h"
 
+namespace {
+struct MmapChunkCacheState {
+    std::mutex lock;
+    size_t cached_bytes = 0;
+    // chunks are only reused by the allocations of exactly the same size, the large blocks of
+    // the pipeline tasks are mostly sized by the same batch size, so the sizes repeat.
+    std::unordered_map<size_t, std::vector<void*>> chunks;
+};
+
+MmapChunkCacheState& mmap_chunk_cache_state() {
+    static MmapChunkCacheState state;
+    return state;
+}
+} // namespace
+
+void* MmapChunkCache::get(size_t size) {
+    if (doris::config::mmap_chunk_cache_size <= 0) {
+        return nullptr;
+    }
+    auto& state = mmap_chunk_cache_state();
+    std::lock_guard<std::mutex> l(state.lock);
+    auto it = state.chunks.find(size);
+    if (it == state.chunks.end() || it->second.empty()) {
+        return nullptr;
+    }
+    void* buf = it->second.back();
+    it->second.pop_back();
+    state.cached_bytes -= size;
+    return buf;
+}
+
+bool MmapChunkCache::put(void* buf, size_t size) {
+    if (doris::config::mmap_chunk_cache_size <= 0) {
+        return false;
+    }
+    auto& state = mmap_chunk_cache_state();
+    std::lock_guard<std::mutex> l(state.lock);
+    if (static_cast<int64_t>(state.cached_bytes + size) > doris::config::mmap_chunk_cache_size) {
+        return false;
+    }
+    state.chunks[size].push_back(buf);
+    state.cached_bytes += size;
+    return true;
+}
+
 template <bool clear_memory_, bool mmap_populate, bool use_mmap>
 void Allocator<clear_memory_, mmap_populate, use_mmap>::sys_memory_check(size_t size) const {
 #ifdef BE_TEST
@@ -68,6 +68,17 @@ static constexpr size_t MALLOC_MIN_ALIGNMENT = 8;
 // is always a multiple of sixteen. (https://www.gnu.org/software/libc/manual/html_node/Aligned-Memory-Blocks.html)
 static constexpr int ALLOCATOR_ALIGNMENT_16 = 16;
 
+// Keeps the chunks freed by the mmap branch of Allocator, so that the next allocation of the
+// same size reuses the mapped pages instead of paying for mmap, munmap and the page faults
+// again. The total bytes kept are limited by config::mmap_chunk_cache_size.
+class MmapChunkCache {
+public:
+    // Returns a cached chunk of exactly `size` bytes, nullptr if there is none.
+    static void* get(size_t size);
+    // Returns false if the chunk is not cached, then the caller should unmap it.
+    static bool put(void* buf, size_t size);
+};
+
 /** Responsible for allocating / freeing memory. Used, for example, in PODArray, Arena.
   * Also used in hash tables.
   * The interface is different from std::allocator
@@ -112,11 +123,25 @@ public:
                         "Too large alignment {}: more than page size when allocating {}.",
                         alignment, size);
 
+            // the cached chunks are dirty, so they are not used when the memory must be zeroed
+            if constexpr (!clear_memory) {
+                buf = MmapChunkCache::get(size);
+                if (buf != nullptr) {
+                    return buf;
+                }
+            }
             buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
             if (MAP_FAILED == buf) {
                 release_memory(size);
                 throw_bad_alloc(fmt::format("Allocator: Cannot mmap {}.", size));
             }
+#ifdef MADV_HUGEPAGE
+            // the large hash tables and arena chunks are accessed randomly, huge pages save
+            // the TLB misses. It is only an advice, so a failure is ignored.
+            if (doris::config::enable_mmap_transparent_huge_pages) {
+                madvise(buf, size, MADV_HUGEPAGE);
+            }
+#endif
 
             /// No need for zero-fill, because mmap guarantees it.
         } else {
@@ -155,7 +180,7 @@ public:
     /// Free memory range.
     void free(void* buf, size_t size) {
         if (use_mmap && size >= doris::config::mmap_threshold) {
-            if (0 != munmap(buf, size)) {
+            if (!MmapChunkCache::put(buf, size) && 0 != munmap(buf, size)) {
                 throw_bad_alloc(fmt::format("Allocator: Cannot munmap {}.", size));
             }
         } else {
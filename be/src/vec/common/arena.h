@@ -300,6 +300,37 @@ public:
         _used_size_no_head = 0;
     }
 
+    /// The allocation state of the arena, see 'rewind'.
+    struct Checkpoint {
+        Chunk* head = nullptr;
+        char* pos = nullptr;
+        size_t size_in_bytes = 0;
+        size_t used_size_no_head = 0;
+    };
+
+    Checkpoint checkpoint() const { return {head, head->pos, size_in_bytes, _used_size_no_head}; }
+
+    /** Free everything allocated after 'checkpoint' was taken, the chunks added since then are
+      * returned to the allocator, so that big chunks can be reused by others through the mmap
+      * chunk cache instead of staying in this arena until it is destroyed.
+      * The memory allocated before the checkpoint stays valid. The checkpoint becomes invalid
+      * after 'clear'.
+      */
+    void rewind(const Checkpoint& checkpoint) {
+        while (head != checkpoint.head) {
+            assert(head->prev != nullptr);
+            Chunk* prev = head->prev;
+            head->prev = nullptr;
+            delete head;
+            head = prev;
+        }
+        assert(checkpoint.pos >= head->begin && checkpoint.pos <= head->pos);
+        ASAN_POISON_MEMORY_REGION(checkpoint.pos, head->pos - checkpoint.pos + pad_right);
+        head->pos = checkpoint.pos;
+        size_in_bytes = checkpoint.size_in_bytes;
+        _used_size_no_head = checkpoint.used_size_no_head;
+    }
+
     /// Size of chunks in bytes.
     size_t size() const { return size_in_bytes; }
 
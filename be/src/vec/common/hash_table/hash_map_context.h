@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 
@@ -34,6 +35,10 @@
 #include "vec/exec/join/join_op.h"
 #include "vec/utils/util.hpp"
 
+#if defined(__SSE2__) || defined(__aarch64__)
+#include "util/sse_util.hpp"
+#endif
+
 namespace doris::vectorized {
 
 constexpr auto BITSIZE = 8;
@@ -305,9 +310,40 @@ struct MethodStringNoCache : public MethodBase<TData> {
 
         Base::keys = stored_keys.data();
         if (is_join) {
-            Base::init_join_bucket_num(num_rows, bucket_size, null_map);
+            Base::bucket_nums.resize(num_rows);
+            init_string_hashes(num_rows, null_map, [&](size_t row, size_t hash) {
+                Base::bucket_nums[row] = hash & (bucket_size - 1);
+            });
+            if (null_map != nullptr) {
+                for (size_t row = 0; row < num_rows; row++) {
+                    if (null_map[row]) {
+                        Base::bucket_nums[row] = bucket_size;
+                    }
+                }
+            }
         } else {
-            Base::init_hash_values(num_rows, null_map);
+            Base::hash_values.resize(num_rows);
+            init_string_hashes(num_rows, null_map,
+                               [&](size_t row, size_t hash) { Base::hash_values[row] = hash; });
+        }
+    }
+
+    // The strings of a low cardinality column, e.g. decoded from the dictionary pages of a
+    // clustered segment, often repeat the last one, whose hash is reused instead of hashing
+    // the string again.
+    template <typename F>
+    void init_string_hashes(size_t num_rows, const uint8_t* null_map, F&& set_hash) {
+        size_t last_row = num_rows;
+        size_t last_hash = 0;
+        for (size_t row = 0; row < num_rows; row++) {
+            if (null_map != nullptr && null_map[row]) {
+                continue;
+            }
+            if (last_row == num_rows || stored_keys[row] != stored_keys[last_row]) {
+                last_hash = hash_table->hash(stored_keys[row]);
+            }
+            last_row = row;
+            set_hash(row, last_hash);
         }
     }
 
@@ -338,12 +374,36 @@ struct MethodOneNumber : public MethodBase<TData> {
                                                     .data
                                           : key_columns[0]->get_raw_data().data);
         if (is_join) {
+            if constexpr (is_join_hash_table_v<TData> && std::is_integral_v<FieldType>) {
+                if (is_build) {
+                    hash_table->init_direct_mapping(Base::keys, num_rows, null_map);
+                }
+                if (hash_table->is_direct_mapping()) {
+                    init_direct_bucket_num(num_rows, bucket_size, null_map);
+                    return;
+                }
+            }
             Base::init_join_bucket_num(num_rows, bucket_size, null_map);
         } else {
             Base::init_hash_values(num_rows, null_map);
         }
     }
 
+    void init_direct_bucket_num(uint32_t num_rows, uint32_t bucket_size, const uint8_t* null_map) {
+        auto& bucket_nums = Base::bucket_nums;
+        bucket_nums.resize(num_rows);
+        if (null_map == nullptr) {
+            for (uint32_t k = 0; k < num_rows; ++k) {
+                bucket_nums[k] = hash_table->direct_bucket_num(Base::keys[k]);
+            }
+            return;
+        }
+        for (uint32_t k = 0; k < num_rows; ++k) {
+            bucket_nums[k] =
+                    null_map[k] ? bucket_size : hash_table->direct_bucket_num(Base::keys[k]);
+        }
+    }
+
     void insert_keys_into_columns(std::vector<typename Base::Key>& input_keys,
                                   MutableColumns& key_columns, const size_t num_rows) override {
         key_columns[0]->insert_many_raw_data((char*)input_keys.data(), num_rows);
@@ -370,9 +430,105 @@ struct MethodKeysFixed : public MethodBase<TData> {
 
     MethodKeysFixed(Sizes key_sizes_) : key_sizes(std::move(key_sizes_)) {}
 
+    // Packs `K` key columns of the same width which fill T exactly, the columns are
+    // interleaved by SIMD shuffles instead of being written to every row one by one.
+    template <typename T, typename Fixed, size_t K>
+    static void pack_same_width_fixeds(size_t row_numbers, const ColumnRawPtrs& key_columns,
+                                       T* __restrict result) {
+        static_assert(sizeof(Fixed) * K == sizeof(T));
+        const Fixed* __restrict data[K];
+        for (size_t j = 0; j < K; ++j) {
+            data[j] = reinterpret_cast<const Fixed*>(key_columns[j]->get_raw_data().data);
+        }
+
+        size_t i = 0;
+#if defined(__SSE2__) || defined(__aarch64__)
+        auto load = [&](size_t j) {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data[j] + i));
+        };
+        auto store = [&](size_t row, __m128i value) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(reinterpret_cast<char*>(result) +
+                                                         row * sizeof(T)),
+                             value);
+        };
+        if constexpr (sizeof(T) == 16 && sizeof(Fixed) == 4) {
+            // transpose 4 rows of 4 columns
+            for (; i + 4 <= row_numbers; i += 4) {
+                __m128i a = load(0), b = load(1), c = load(2), d = load(3);
+                __m128i ab_lo = _mm_unpacklo_epi32(a, b);
+                __m128i ab_hi = _mm_unpackhi_epi32(a, b);
+                __m128i cd_lo = _mm_unpacklo_epi32(c, d);
+                __m128i cd_hi = _mm_unpackhi_epi32(c, d);
+                store(i, _mm_unpacklo_epi64(ab_lo, cd_lo));
+                store(i + 1, _mm_unpackhi_epi64(ab_lo, cd_lo));
+                store(i + 2, _mm_unpacklo_epi64(ab_hi, cd_hi));
+                store(i + 3, _mm_unpackhi_epi64(ab_hi, cd_hi));
+            }
+        } else if constexpr (sizeof(T) == 16 && sizeof(Fixed) == 8) {
+            for (; i + 2 <= row_numbers; i += 2) {
+                __m128i a = load(0), b = load(1);
+                store(i, _mm_unpacklo_epi64(a, b));
+                store(i + 1, _mm_unpackhi_epi64(a, b));
+            }
+        } else if constexpr (sizeof(T) == 8 && sizeof(Fixed) == 4) {
+            // every store writes 2 rows
+            for (; i + 4 <= row_numbers; i += 4) {
+                __m128i a = load(0), b = load(1);
+                store(i, _mm_unpacklo_epi32(a, b));
+                store(i + 2, _mm_unpackhi_epi32(a, b));
+            }
+        }
+#endif
+        for (; i < row_numbers; ++i) {
+            char* dst = reinterpret_cast<char*>(result + i);
+            for (size_t j = 0; j < K; ++j) {
+                memcpy_fixed<Fixed, true>(dst + j * sizeof(Fixed),
+                                          reinterpret_cast<const char*>(data[j] + i));
+            }
+        }
+    }
+
+    // Returns false if the keys are not of the same width or do not fill T exactly.
+    template <typename T>
+    bool try_pack_same_width_fixeds(size_t row_numbers, const ColumnRawPtrs& key_columns,
+                                    std::vector<T>& result) {
+        if (key_sizes.empty()) {
+            return false;
+        }
+        const size_t width = key_sizes[0];
+        if (width * key_sizes.size() != sizeof(T) ||
+            !std::all_of(key_sizes.begin(), key_sizes.end(),
+                         [width](size_t size) { return size == width; })) {
+            return false;
+        }
+        auto pack = [&]<typename Fixed>(Fixed) {
+            constexpr size_t K = sizeof(T) / sizeof(Fixed);
+            if constexpr (K * sizeof(Fixed) == sizeof(T)) {
+                // every byte is overwritten, no need to reset the memory
+                result.resize(row_numbers);
+                pack_same_width_fixeds<T, Fixed, K>(row_numbers, key_columns, result.data());
+            }
+        };
+        if (width == sizeof(uint16_t)) {
+            pack(uint16_t());
+        } else if (width == sizeof(uint32_t)) {
+            pack(uint32_t());
+        } else if (width == sizeof(uint64_t)) {
+            pack(uint64_t());
+        } else {
+            return false;
+        }
+        return true;
+    }
+
     template <typename T>
     void pack_fixeds(size_t row_numbers, const ColumnRawPtrs& key_columns,
                      const ColumnRawPtrs& nullmap_columns, std::vector<T>& result) {
+        if (nullmap_columns.empty() &&
+            try_pack_same_width_fixeds(row_numbers, key_columns, result)) {
+            return;
+        }
+
         size_t bitmap_size = get_bitmap_size(nullmap_columns.size());
         // set size to 0 at first, then use resize to call default constructor on index included from [0, row_numbers) to reset all memory
         result.clear();
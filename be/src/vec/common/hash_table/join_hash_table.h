@@ -19,6 +19,14 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "exprs/block_bloom_filter.hpp"
 #include "vec/columns/column_filter_helper.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/common/hash_table/hash_table.h"
@@ -40,7 +48,8 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               (_probe_filter ? _probe_filter->directory().size : 0);
     }
 
     template <int JoinOpType>
@@ -51,7 +60,11 @@ public:
         _empty_build_side = num_elem <= 1;
         max_batch_size = batch_size;
         bucket_size = calc_bucket_size(num_elem + 1);
-        first.resize(bucket_size + 1);
+        // `first[bucket_size]` is the bucket of null, `first[bucket_size + 1]` is always empty,
+        // it is the bucket of the probe keys out of the range of direct mapping.
+        first.resize(bucket_size + 2);
+        _direct_mapping = false;
+        _probe_filter.reset();
         next.resize(num_elem);
 
         if constexpr (JoinOpType == TJoinOp::FULL_OUTER_JOIN ||
@@ -64,6 +77,79 @@ public:
 
     uint32_t get_bucket_size() const { return bucket_size; }
 
+    // For integer keys, if the range of the build keys `keys[1, num_elem)` is less than the
+    // bucket size, a key is mapped to the bucket `key - min_key` instead of hashing it, every
+    // bucket then holds one distinct key. Called before computing the bucket numbers of build.
+    void init_direct_mapping(const Key* __restrict keys, size_t num_elem,
+                             const uint8_t* __restrict null_map) {
+        _direct_mapping = false;
+        if constexpr (std::is_integral_v<Key>) {
+            Key min_key = std::numeric_limits<Key>::max();
+            Key max_key = std::numeric_limits<Key>::min();
+            if (null_map) {
+                for (size_t i = 1; i < num_elem; i++) {
+                    if (!null_map[i]) {
+                        min_key = std::min(min_key, keys[i]);
+                        max_key = std::max(max_key, keys[i]);
+                    }
+                }
+            } else {
+                for (size_t i = 1; i < num_elem; i++) {
+                    min_key = std::min(min_key, keys[i]);
+                    max_key = std::max(max_key, keys[i]);
+                }
+            }
+            if (min_key <= max_key && static_cast<uint64_t>(max_key - min_key) < bucket_size) {
+                _direct_mapping = true;
+                _direct_min_key = min_key;
+            }
+        }
+    }
+
+    bool is_direct_mapping() const { return _direct_mapping; }
+
+    uint32_t direct_bucket_num(const Key& key) const {
+        auto offset = static_cast<Key>(key - _direct_min_key);
+        return offset < bucket_size ? static_cast<uint32_t>(offset) : bucket_size + 1;
+    }
+
+    // Creates a bloom filter of the build keys, the probe rows rejected by it skip `first`.
+    // It is only created when `first` is larger than the L2 cache. Called after `prepare_build`.
+    template <int JoinOpType>
+    void init_probe_filter() {
+        if constexpr (JoinOpType == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN ||
+                      JoinOpType == TJoinOp::NULL_AWARE_LEFT_SEMI_JOIN) {
+            return;
+        }
+        if (bucket_size < PROBE_FILTER_MIN_BUCKETS) {
+            return;
+        }
+        // about 8 bits per key, at most PROBE_FILTER_MAX_BYTES to stay in the cache
+        int log_space_bytes = std::min(__builtin_ctz(bucket_size), PROBE_FILTER_MAX_LOG_BYTES);
+        auto filter = std::make_unique<BlockBloomFilter>();
+        if (filter->init(log_space_bytes, 0).ok()) {
+            _probe_filter = std::move(filter);
+            _probe_filter_enabled = true;
+            _probe_filter_rows = 0;
+            _probe_filter_rejected_rows = 0;
+        }
+    }
+
+    bool has_probe_filter() const { return _probe_filter != nullptr; }
+
+    static constexpr uint32_t PROBE_FILTER_MIN_BUCKETS = 1 << 20;
+    static constexpr int PROBE_FILTER_MAX_LOG_BYTES = 24;
+    // The filter is disabled if it rejects less than 1 / PROBE_FILTER_MIN_REJECT_RATIO of the
+    // first PROBE_FILTER_SAMPLE_ROWS probe rows.
+    static constexpr size_t PROBE_FILTER_SAMPLE_ROWS = 1 << 16;
+    static constexpr size_t PROBE_FILTER_MIN_REJECT_RATIO = 4;
+
+    // `first` of a radix partition fits in the L2 cache.
+    static constexpr uint32_t RADIX_PARTITION_BITS = 16;
+    static constexpr uint32_t MAX_RADIX_PARTITIONS = 1024;
+    // The radix build is used when `first` is larger than the last level cache.
+    static constexpr uint32_t RADIX_BUILD_MIN_BUCKETS = 1 << 23;
+
     size_t size() const { return next.size(); }
 
     std::vector<uint8_t>& get_visited() { return visited; }
@@ -72,17 +158,33 @@ public:
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
                size_t num_elem) {
         build_keys = keys;
-        for (size_t i = 1; i < num_elem; i++) {
-            uint32_t bucket_num = bucket_nums[i];
-            next[i] = first[bucket_num];
-            first[bucket_num] = i;
-        }
-        if constexpr ((JoinOpType != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN &&
-                       JoinOpType != TJoinOp::NULL_AWARE_LEFT_SEMI_JOIN) ||
-                      !with_other_conjuncts) {
-            /// Only null aware join with other conjuncts need to access the null value in hash table
-            first[bucket_size] = 0; // index = bucket_num means null
+        if (bucket_size > RADIX_BUILD_MIN_BUCKETS) {
+            _radix_build(bucket_nums, num_elem, 1, [](size_t num_tasks, const auto& func) {
+                for (size_t i = 0; i < num_tasks; i++) {
+                    func(i);
+                }
+            });
+        } else {
+            for (size_t i = 1; i < num_elem; i++) {
+                uint32_t bucket_num = bucket_nums[i];
+                next[i] = first[bucket_num];
+                first[bucket_num] = i;
+            }
         }
+        _build_probe_filter(bucket_nums, num_elem);
+        _finish_build<JoinOpType, with_other_conjuncts>();
+    }
+
+    // Same as `build`, but the rows are partitioned and linked by `num_tasks` tasks.
+    // `run_tasks(num_tasks, func)` calls `func(task_id)` for every task, maybe concurrently,
+    // and returns after all of them are done. The result is the same as `build`.
+    template <int JoinOpType, bool with_other_conjuncts, typename RunTasks>
+    void parallel_build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
+                        size_t num_elem, size_t num_tasks, RunTasks&& run_tasks) {
+        build_keys = keys;
+        _radix_build(bucket_nums, num_elem, num_tasks, run_tasks);
+        _build_probe_filter(bucket_nums, num_elem);
+        _finish_build<JoinOpType, with_other_conjuncts>();
     }
 
     template <int JoinOpType, bool with_other_conjuncts, bool is_mark_join, bool need_judge_null>
@@ -239,14 +341,23 @@ public:
 
     bool has_null_key() { return _has_null_key; }
 
-    void pre_build_idxs(std::vector<uint32>& buckets, const uint8_t* null_map) const {
+    void pre_build_idxs(const Key* __restrict keys, std::vector<uint32>& buckets,
+                        const uint8_t* null_map) const {
+        if (_probe_filter != nullptr && _probe_filter_enabled.load(std::memory_order_relaxed)) {
+            _filter_probe_buckets(keys, buckets);
+        }
+        // `first` is randomly accessed, prefetch the buckets several rows ahead
+        const size_t num_buckets = buckets.size();
         if (null_map) {
-            for (unsigned int& bucket : buckets) {
+            for (size_t i = 0; i < num_buckets; ++i) {
+                _prefetch_first(buckets, i + HASH_MAP_PREFETCH_DIST);
+                auto& bucket = buckets[i];
                 bucket = bucket == bucket_size ? bucket_size : first[bucket];
             }
         } else {
-            for (unsigned int& bucket : buckets) {
-                bucket = first[bucket];
+            for (size_t i = 0; i < num_buckets; ++i) {
+                _prefetch_first(buckets, i + HASH_MAP_PREFETCH_DIST);
+                buckets[i] = first[buckets[i]];
             }
         }
     }
@@ -270,10 +381,149 @@ private:
         return std::tuple {probe_idx, 0U, matched_cnt};
     }
 
+    template <int JoinOpType, bool with_other_conjuncts>
+    void _finish_build() {
+        if constexpr ((JoinOpType != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN &&
+                       JoinOpType != TJoinOp::NULL_AWARE_LEFT_SEMI_JOIN) ||
+                      !with_other_conjuncts) {
+            /// Only null aware join with other conjuncts need to access the null value in hash table
+            first[bucket_size] = 0; // index = bucket_num means null
+        }
+    }
+
+    // Inserts the rows partition by partition, where a partition is a range of buckets, so the
+    // random writes to `first` stay in the cache. The rows of a bucket are still inserted in
+    // row order, the chains are the same as inserting the rows one by one.
+    //
+    // Every task counts and scatters a slice of the rows into the partitions, the slices of a
+    // partition are laid out in task order to keep the row order. Then every task links a range
+    // of the partitions, the tasks write disjoint parts of `first` and `next`, so no lock is
+    // needed.
+    template <typename RunTasks>
+    void _radix_build(const uint32_t* __restrict bucket_nums, size_t num_elem, size_t num_tasks,
+                      RunTasks&& run_tasks) {
+        if (num_elem <= 1) {
+            return;
+        }
+        uint32_t bucket_bits = 32 - __builtin_clz(bucket_size);
+        uint32_t shift = std::max(RADIX_PARTITION_BITS,
+                                  bucket_bits - __builtin_ctz(MAX_RADIX_PARTITIONS));
+        size_t num_partitions = (bucket_size >> shift) + 1;
+        num_tasks = std::max<size_t>(std::min(num_tasks, num_partitions), 1);
+        size_t rows_per_task = (num_elem - 1 + num_tasks - 1) / num_tasks;
+        auto slice_begin = [&](size_t task) {
+            return std::min(1 + task * rows_per_task, num_elem);
+        };
+
+        // cursors[task * num_partitions + partition]
+        std::vector<uint32_t> cursors(num_tasks * num_partitions, 0);
+        run_tasks(num_tasks, [&](size_t task) {
+            uint32_t* counts = cursors.data() + task * num_partitions;
+            for (size_t i = slice_begin(task); i < slice_begin(task + 1); i++) {
+                counts[bucket_nums[i] >> shift]++;
+            }
+        });
+        std::vector<uint32_t> partition_begins(num_partitions + 1, 0);
+        uint32_t offset = 0;
+        for (size_t partition = 0; partition < num_partitions; partition++) {
+            partition_begins[partition] = offset;
+            for (size_t task = 0; task < num_tasks; task++) {
+                uint32_t count = cursors[task * num_partitions + partition];
+                cursors[task * num_partitions + partition] = offset;
+                offset += count;
+            }
+        }
+        partition_begins[num_partitions] = offset;
+
+        std::vector<uint32_t> rows(offset);
+        run_tasks(num_tasks, [&](size_t task) {
+            uint32_t* task_cursors = cursors.data() + task * num_partitions;
+            for (size_t i = slice_begin(task); i < slice_begin(task + 1); i++) {
+                rows[task_cursors[bucket_nums[i] >> shift]++] = i;
+            }
+        });
+        run_tasks(num_tasks, [&](size_t task) {
+            size_t begin = partition_begins[task * num_partitions / num_tasks];
+            size_t end = partition_begins[(task + 1) * num_partitions / num_tasks];
+            for (size_t i = begin; i < end; i++) {
+                uint32_t row = rows[i];
+                uint32_t bucket_num = bucket_nums[row];
+                next[row] = first[bucket_num];
+                first[bucket_num] = row;
+            }
+        });
+    }
+
+    static uint32_t _probe_filter_hash(size_t hash) {
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
+
+    void _build_probe_filter(const uint32_t* __restrict bucket_nums, size_t num_elem) {
+        if (_probe_filter == nullptr) {
+            return;
+        }
+        if (_direct_mapping) {
+            // the buckets are not hashed, `first` is as small as the filter
+            _probe_filter.reset();
+            return;
+        }
+        for (size_t i = 1; i < num_elem; i++) {
+            // the rows of null keys are in the bucket `bucket_size`
+            if (bucket_nums[i] != bucket_size) {
+                _probe_filter->insert(_probe_filter_hash(hash(build_keys[i])));
+            }
+        }
+    }
+
+    // Moves the probe rows rejected by the filter to the always empty bucket `bucket_size + 1`,
+    // whose `first` stays in the cache. The rows of null keys keep the bucket `bucket_size`.
+    void _filter_probe_buckets(const Key* __restrict keys, std::vector<uint32>& buckets) const {
+        const size_t num_buckets = buckets.size();
+        size_t rejected = 0;
+        for (size_t i = 0; i < num_buckets; ++i) {
+            auto& bucket = buckets[i];
+            if (bucket != bucket_size &&
+                !_probe_filter->find(_probe_filter_hash(hash(keys[i])))) {
+                bucket = bucket_size + 1;
+                ++rejected;
+            }
+        }
+
+        // the filter only costs when most probe rows match, stop using it then
+        size_t rows = _probe_filter_rows.fetch_add(num_buckets, std::memory_order_relaxed) +
+                      num_buckets;
+        size_t rejected_rows =
+                _probe_filter_rejected_rows.fetch_add(rejected, std::memory_order_relaxed) +
+                rejected;
+        if (rows >= PROBE_FILTER_SAMPLE_ROWS &&
+            rejected_rows * PROBE_FILTER_MIN_REJECT_RATIO < rows) {
+            _probe_filter_enabled.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    ALWAYS_INLINE void _prefetch_first(const std::vector<uint32>& buckets, size_t i) const {
+        if (LIKELY(i < buckets.size())) {
+            __builtin_prefetch(&first[buckets[i]]);
+        }
+    }
+
+    // Prefetches the head of the bucket chain of the row several rows ahead, so the probe does
+    // not stall on the cache misses of `build_keys` and `next` when the build side is larger
+    // than the cache.
+    ALWAYS_INLINE void _prefetch_build(const uint32_t* __restrict build_idx_map, int probe_idx,
+                                       int probe_rows) const {
+        if (LIKELY(probe_idx + HASH_MAP_PREFETCH_DIST < probe_rows)) {
+            auto build_idx = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST];
+            __builtin_prefetch(&build_keys[build_idx]);
+            __builtin_prefetch(&next[build_idx]);
+        }
+    }
+
     auto _find_batch_right_semi_anti(const Key* __restrict keys,
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_build(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
@@ -302,6 +552,7 @@ private:
                 }
             }
 
+            _prefetch_build(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -375,6 +626,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -429,6 +681,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_build(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -451,5 +704,20 @@ private:
     vectorized::Arena* pool;
     bool _has_null_key = false;
     bool _empty_build_side = true;
+
+    bool _direct_mapping = false;
+    Key _direct_min_key {};
+
+    std::unique_ptr<BlockBloomFilter> _probe_filter;
+    // The probe instances of a shared hash table update them concurrently.
+    mutable std::atomic<bool> _probe_filter_enabled = false;
+    mutable std::atomic<size_t> _probe_filter_rows = 0;
+    mutable std::atomic<size_t> _probe_filter_rejected_rows = 0;
 };
+
+template <typename T>
+constexpr bool is_join_hash_table_v = false;
+
+template <typename Key, typename Hash>
+constexpr bool is_join_hash_table_v<JoinHashTable<Key, Hash>> = true;
 } // namespace doris
\ No newline at end of file
@@ -26,9 +26,13 @@
 #include <string>
 #include <utility>
 
+#include "common/config.h"
+#include "common/exception.h"
 #include "common/object_pool.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
@@ -59,6 +63,7 @@ namespace doris::vectorized {
 void MergeSorterState::reset() {
     auto empty_queue = std::priority_queue<MergeSortCursor>();
     priority_queue_.swap(empty_queue);
+    merge_tree_.init({});
     std::vector<MergeSortCursorImpl> empty_cursors(0);
     cursors_.swap(empty_cursors);
     std::vector<Block> empty_blocks(0);
@@ -83,9 +88,12 @@ Status MergeSorterState::build_merge_tree(const SortDescription& sort_descriptio
     }
 
     if (sorted_blocks_.size() > 1) {
+        std::vector<MergeSortCursorImpl*> cursors;
         for (auto& cursor : cursors_) {
             priority_queue_.emplace(&cursor);
+            cursors.push_back(&cursor);
         }
+        merge_tree_.init(std::move(cursors));
     }
 
     return Status::OK();
@@ -116,24 +124,26 @@ Status MergeSorterState::_merge_sort_read_impl(int batch_size, doris::vectorized
 
     /// Take rows from queue in right order and push to 'merged'.
     size_t merged_rows = 0;
-    while (!priority_queue_.empty()) {
-        auto current = priority_queue_.top();
-        priority_queue_.pop();
-
-        if (offset_ == 0) {
-            for (size_t i = 0; i < num_columns; ++i)
-                merged_columns[i]->insert_from(*current->all_columns[i], current->pos);
-            ++merged_rows;
-        } else {
-            offset_--;
+    while (merged_rows < batch_size && !merge_tree_.empty()) {
+        auto current = merge_tree_.top();
+        size_t rows = merge_tree_.top_run_rows(batch_size - merged_rows);
+        size_t skipped_rows = std::min<size_t>(offset_, rows);
+        offset_ -= skipped_rows;
+        if (rows > skipped_rows) {
+            for (size_t i = 0; i < num_columns; ++i) {
+                merged_columns[i]->insert_range_from(*current->all_columns[i],
+                                                     current->pos + skipped_rows,
+                                                     rows - skipped_rows);
+            }
+            merged_rows += rows - skipped_rows;
         }
 
-        if (!current->is_last()) {
-            current->next();
-            priority_queue_.push(current);
+        current->pos += rows;
+        if (current->pos < current->rows) {
+            merge_tree_.update_top();
+        } else {
+            merge_tree_.pop();
         }
-
-        if (merged_rows == batch_size) break;
     }
     block->set_columns(std::move(merged_columns));
 
@@ -150,8 +160,7 @@ Status Sorter::merge_sort_read_for_spill(RuntimeState* state, doris::vectorized:
     return get_next(state, block, eos);
 }
 
-Status Sorter::partial_sort(Block& src_block, Block& dest_block) {
-    size_t num_cols = src_block.columns();
+Status Sorter::_prepare_sort_columns(Block& src_block, Block& dest_block, Block** input_block) {
     if (_materialize_sort_exprs) {
         auto output_tuple_expr_ctxs = _vsort_exec_exprs.sort_tuple_slot_expr_ctxs();
         std::vector<int> valid_column_ids(output_tuple_expr_ctxs.size());
@@ -188,14 +197,18 @@ Status Sorter::partial_sort(Block& src_block, Block& dest_block) {
         _sort_description[i].nulls_direction =
                 _nulls_first[i] ? -_sort_description[i].direction : _sort_description[i].direction;
     }
+    *input_block = result_block;
+    return Status::OK();
+}
+
+Status Sorter::partial_sort(Block& src_block, Block& dest_block) {
+    size_t num_cols = src_block.columns();
+    Block* input_block = nullptr;
+    RETURN_IF_ERROR(_prepare_sort_columns(src_block, dest_block, &input_block));
 
     {
         SCOPED_TIMER(_partial_sort_timer);
-        if (_materialize_sort_exprs) {
-            sort_block(dest_block, dest_block, _sort_description, _offset + _limit);
-        } else {
-            sort_block(src_block, dest_block, _sort_description, _offset + _limit);
-        }
+        sort_block(*input_block, dest_block, _sort_description, _offset + _limit);
         src_block.clear_column_data(num_cols);
     }
 
@@ -207,7 +220,8 @@ FullSorter::FullSorter(VSortExecExprs& vsort_exec_exprs, int limit, int64_t offs
                        std::vector<bool>& nulls_first, const RowDescriptor& row_desc,
                        RuntimeState* state, RuntimeProfile* profile)
         : Sorter(vsort_exec_exprs, limit, offset, pool, is_asc_order, nulls_first),
-          _state(MergeSorterState::create_unique(row_desc, offset, limit, state, profile)) {}
+          _state(MergeSorterState::create_unique(row_desc, offset, limit, state, profile)),
+          _runtime_state(state) {}
 
 Status FullSorter::append_block(Block* block) {
     DCHECK(block->rows() > 0);
@@ -248,8 +262,75 @@ Status FullSorter::merge_sort_read_for_spill(RuntimeState* state, doris::vectori
     return _state->merge_sort_read(block, batch_size, eos);
 }
 
+size_t FullSorter::_parallel_sort_tasks(size_t rows) const {
+    // the other tasks of the pipeline are using the other cores, and a top-n sort keeps few
+    // sorted blocks
+    if (_limit != -1 || _runtime_state == nullptr || _runtime_state->task_num() != 1 ||
+        config::parallel_sort_max_tasks <= 1 || config::parallel_sort_min_rows_per_task <= 0) {
+        return 1;
+    }
+    return std::clamp<size_t>(rows / config::parallel_sort_min_rows_per_task, 1,
+                              config::parallel_sort_max_tasks);
+}
+
+Status FullSorter::_do_parallel_sort(size_t num_tasks) {
+    Block* src_block = _state->unsorted_block_.get();
+    size_t num_cols = src_block->columns();
+    Block desc_block = src_block->clone_without_columns();
+    Block* input_block = nullptr;
+    RETURN_IF_ERROR(_prepare_sort_columns(*src_block, desc_block, &input_block));
+
+    SCOPED_TIMER(_partial_sort_timer);
+    const size_t rows = input_block->rows();
+    std::vector<Block> sorted_blocks(num_tasks);
+    std::vector<Status> statuses(num_tasks);
+    auto sort_sub_run = [&](size_t task) -> Status {
+        size_t begin = rows * task / num_tasks;
+        size_t end = rows * (task + 1) / num_tasks;
+        RETURN_IF_CATCH_EXCEPTION({
+            Block sub_run = input_block->clone_without_columns();
+            for (size_t i = 0; i < input_block->columns(); ++i) {
+                sub_run.replace_by_position(
+                        i, input_block->get_by_position(i).column->cut(begin, end - begin));
+            }
+            sorted_blocks[task] = sub_run.clone_without_columns();
+            sort_block(sub_run, sorted_blocks[task], _sort_description, 0);
+        });
+        return Status::OK();
+    };
+
+    ThreadPool* pool = ExecEnv::GetInstance()->sort_thread_pool();
+    CountDownLatch latch(num_tasks - 1);
+    for (size_t task = 1; task < num_tasks; ++task) {
+        auto submit = [&, task]() {
+            return pool->submit_func([&, task]() {
+                SCOPED_ATTACH_TASK(_runtime_state);
+                statuses[task] = sort_sub_run(task);
+                latch.count_down();
+            });
+        };
+        if (pool == nullptr || !submit().ok()) {
+            // run it here if there is no pool or it is full
+            statuses[task] = sort_sub_run(task);
+            latch.count_down();
+        }
+    }
+    statuses[0] = sort_sub_run(0);
+    latch.wait();
+    src_block->clear_column_data(num_cols);
+
+    for (size_t task = 0; task < num_tasks; ++task) {
+        RETURN_IF_ERROR(statuses[task]);
+        RETURN_IF_ERROR(_state->add_sorted_block(sorted_blocks[task]));
+    }
+    return Status::OK();
+}
+
 Status FullSorter::_do_sort() {
     Block* src_block = _state->unsorted_block_.get();
+    if (size_t num_tasks = _parallel_sort_tasks(src_block->rows()); num_tasks > 1) {
+        return _do_parallel_sort(num_tasks);
+    }
     Block desc_block = src_block->clone_without_columns();
     RETURN_IF_ERROR(partial_sort(*src_block, desc_block));
 
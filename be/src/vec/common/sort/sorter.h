@@ -86,7 +86,9 @@ private:
 
     Status _merge_sort_read_impl(int batch_size, doris::vectorized::Block* block, bool* eos);
 
+    // only used by PartitionSorter, the other sorters merge by merge_tree_
     std::priority_queue<MergeSortCursor> priority_queue_;
+    SortCursorLoserTree merge_tree_;
     std::vector<MergeSortCursorImpl> cursors_;
     std::vector<Block> sorted_blocks_;
     size_t in_mem_sorted_bocks_size_ = 0;
@@ -141,6 +143,10 @@ public:
 protected:
     Status partial_sort(Block& src_block, Block& dest_block);
 
+    // Evaluates the sort exprs and sets the columns of _sort_description. Returns the block
+    // to sort in `input_block`, it is `dest_block` if the sort tuple is materialized.
+    Status _prepare_sort_columns(Block& src_block, Block& dest_block, Block** input_block);
+
     bool _enable_spill = false;
     SortDescription _sort_description;
     VSortExecExprs& _vsort_exec_exprs;
@@ -187,7 +193,13 @@ private:
 
     Status _do_sort();
 
+    // Returns how many sub-runs the unsorted block of `rows` rows is sorted in parallel as.
+    size_t _parallel_sort_tasks(size_t rows) const;
+
+    Status _do_parallel_sort(size_t num_tasks);
+
     std::unique_ptr<MergeSorterState> _state;
+    RuntimeState* _runtime_state = nullptr;
 
     static constexpr size_t INITIAL_BUFFERED_BLOCK_SIZE = 1024 * 1024;
     static constexpr size_t INITIAL_BUFFERED_BLOCK_BYTES = 64 << 20;
@@ -701,7 +701,11 @@ void Block::clear_column_data(int column_size) noexcept {
         }
     }
     for (auto& d : data) {
-        DCHECK_EQ(d.column->use_count(), 1) << " " << print_use_count();
+        // a column shared with other blocks, e.g. by a multi cast, must not be cleared in place
+        if (d.column->use_count() != 1) {
+            d.column = d.column->clone_empty();
+            continue;
+        }
         (*std::move(d.column)).assume_mutable()->clear();
     }
     row_same_bit.clear();
@@ -739,12 +743,21 @@ void Block::update_hash(SipHash& hash) const {
     }
 }
 
+static void clear_column_of_block(Block* block, uint32_t position) {
+    auto& column = block->get_by_position(position).column;
+    if (column->is_exclusive()) {
+        std::move(*column).assume_mutable()->clear();
+    } else {
+        column = column->clone_empty();
+    }
+}
+
 void Block::filter_block_internal(Block* block, const std::vector<uint32_t>& columns_to_filter,
                                   const IColumn::Filter& filter) {
     size_t count = filter.size() - simd::count_zero_num((int8_t*)filter.data(), filter.size());
     if (count == 0) {
         for (const auto& col : columns_to_filter) {
-            std::move(*block->get_by_position(col).column).assume_mutable()->clear();
+            clear_column_of_block(block, col);
         }
     } else {
         for (const auto& col : columns_to_filter) {
@@ -822,7 +835,7 @@ Status Block::filter_block(Block* block, const std::vector<uint32_t>& columns_to
         bool ret = const_column->get_bool(0);
         if (!ret) {
             for (const auto& col : columns_to_filter) {
-                std::move(*block->get_by_position(col).column).assume_mutable()->clear();
+                clear_column_of_block(block, col);
             }
         }
     } else {
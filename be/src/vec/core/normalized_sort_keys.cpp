@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/normalized_sort_keys.h"
+
+#include <string>
+
+#include "common/config.h"
+#include "olap/key_coder.h"
+#include "olap/olap_common.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+
+namespace doris::vectorized {
+
+namespace {
+
+FieldType sort_key_field_type(const DataTypePtr& type) {
+    switch (remove_nullable(type)->get_type_id()) {
+    case TypeIndex::UInt8:
+        return FieldType::OLAP_FIELD_TYPE_BOOL;
+    case TypeIndex::Int8:
+        return FieldType::OLAP_FIELD_TYPE_TINYINT;
+    case TypeIndex::Int16:
+        return FieldType::OLAP_FIELD_TYPE_SMALLINT;
+    case TypeIndex::Int32:
+        return FieldType::OLAP_FIELD_TYPE_INT;
+    case TypeIndex::Int64:
+        return FieldType::OLAP_FIELD_TYPE_BIGINT;
+    case TypeIndex::Int128:
+        return FieldType::OLAP_FIELD_TYPE_LARGEINT;
+    case TypeIndex::DateV2:
+        return FieldType::OLAP_FIELD_TYPE_DATEV2;
+    case TypeIndex::DateTimeV2:
+        return FieldType::OLAP_FIELD_TYPE_DATETIMEV2;
+    case TypeIndex::Decimal32:
+        return FieldType::OLAP_FIELD_TYPE_DECIMAL32;
+    case TypeIndex::Decimal64:
+        return FieldType::OLAP_FIELD_TYPE_DECIMAL64;
+    case TypeIndex::Decimal128V3:
+        return FieldType::OLAP_FIELD_TYPE_DECIMAL128I;
+    case TypeIndex::IPv4:
+        return FieldType::OLAP_FIELD_TYPE_IPV4;
+    default:
+        return FieldType::OLAP_FIELD_TYPE_UNKNOWN;
+    }
+}
+
+const ColumnWithTypeAndName& sort_column(const Block& block,
+                                         const SortColumnDescription& column_desc) {
+    return !column_desc.column_name.empty() ? block.get_by_name(column_desc.column_name)
+                                            : block.get_by_position(column_desc.column_number);
+}
+
+} // namespace
+
+bool NormalizedSortKeys::is_supported(const Block& block, const SortDescription& description) {
+    for (const auto& column_desc : description) {
+        const auto& column = sort_column(block, column_desc);
+        if (is_column_const(*column.column) ||
+            sort_key_field_type(column.type) == FieldType::OLAP_FIELD_TYPE_UNKNOWN) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool NormalizedSortKeys::try_encode(const Block& block, const SortDescription& description) {
+    clear();
+    if (!config::enable_sort_normalized_key || description.size() < 2 ||
+        !is_supported(block, description)) {
+        return false;
+    }
+    encode(block, description);
+    return true;
+}
+
+void NormalizedSortKeys::encode(const Block& block, const SortDescription& description) {
+    _key_size = 0;
+    for (const auto& column_desc : description) {
+        _key_size += 1 + remove_nullable(sort_column(block, column_desc).type)
+                                 ->get_size_of_value_in_memory();
+    }
+    const size_t rows = block.rows();
+    // the values of nulls are left as zero
+    _keys.assign(rows * _key_size, 0);
+
+    std::string encoded;
+    size_t offset = 0;
+    for (const auto& column_desc : description) {
+        const auto& column = sort_column(block, column_desc);
+        const size_t width = remove_nullable(column.type)->get_size_of_value_in_memory();
+        const KeyCoder* coder = get_key_coder(sort_key_field_type(column.type));
+
+        const IColumn* data_column = column.column.get();
+        const uint8_t* null_map = nullptr;
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*data_column)) {
+            null_map = nullable->get_null_map_data().data();
+            data_column = &nullable->get_nested_column();
+        }
+        const char* data = data_column->get_raw_data().data;
+        encoded.clear();
+        encoded.reserve(rows * width);
+        for (size_t row = 0; row < rows; ++row) {
+            coder->full_encode_ascending(data + row * width, &encoded);
+        }
+
+        // see the comment of nulls_direction in SortColumnDescription
+        const bool nulls_last = column_desc.direction * column_desc.nulls_direction > 0;
+        const uint8_t null_flag = nulls_last ? 1 : 0;
+        const uint8_t value_flag = nulls_last ? 0 : 1;
+        const bool descending = column_desc.direction < 0;
+        for (size_t row = 0; row < rows; ++row) {
+            uint8_t* dst = _keys.data() + row * _key_size + offset;
+            if (null_map != nullptr && null_map[row]) {
+                dst[0] = null_flag;
+                continue;
+            }
+            dst[0] = value_flag;
+            const auto* src = reinterpret_cast<const uint8_t*>(encoded.data()) + row * width;
+            if (descending) {
+                for (size_t i = 0; i < width; ++i) {
+                    dst[1 + i] = ~src[i];
+                }
+            } else {
+                memcpy(dst + 1, src, width);
+            }
+        }
+        offset += 1 + width;
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
+
+#include "vec/core/sort_description.h"
+
+namespace doris::vectorized {
+
+class Block;
+
+// One memcmp-comparable key per row for the sort columns of a block.
+//
+// Every sort column adds a null flag byte and the value encoded by the order-preserving
+// encoding of olap/key_coder. The value bytes are inverted for descending columns and are
+// zero for nulls, so comparing two keys by memcmp gives the same order as comparing the sort
+// columns one by one. Only fixed width types are supported, every key has the same size.
+class NormalizedSortKeys {
+public:
+    // Whether all the sort columns of `block` are of fixed width types with a key coder.
+    static bool is_supported(const Block& block, const SortDescription& description);
+
+    // Encodes the keys if config::enable_sort_normalized_key is set, there are at least 2 sort
+    // columns and they are supported. Returns whether the keys are encoded.
+    bool try_encode(const Block& block, const SortDescription& description);
+
+    void encode(const Block& block, const SortDescription& description);
+
+    void clear() {
+        _key_size = 0;
+        _keys.clear();
+    }
+
+    bool empty() const { return _key_size == 0; }
+
+    size_t key_size() const { return _key_size; }
+
+    const uint8_t* key(size_t row) const { return _keys.data() + row * _key_size; }
+
+    int compare(size_t row, const NormalizedSortKeys& rhs, size_t rhs_row) const {
+        return memcmp(key(row), rhs.key(rhs_row), _key_size);
+    }
+
+private:
+    size_t _key_size = 0;
+    std::vector<uint8_t> _keys;
+};
+
+} // namespace doris::vectorized
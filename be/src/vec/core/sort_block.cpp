@@ -20,7 +20,10 @@
 
 #include "vec/core/sort_block.h"
 
+#include <algorithm>
+
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/core/normalized_sort_keys.h"
 
 namespace doris::vectorized {
 
@@ -76,6 +79,24 @@ void sort_block(Block& src_block, Block& dest_block, const SortDescription& desc
             limit = 0;
         }
 
+        NormalizedSortKeys sort_keys;
+        if (sort_keys.try_encode(src_block, description)) {
+            auto less = [&sort_keys](size_t lhs, size_t rhs) {
+                return sort_keys.compare(lhs, sort_keys, rhs) < 0;
+            };
+            if (limit) {
+                std::partial_sort(perm.begin(), perm.begin() + limit, perm.end(), less);
+            } else {
+                pdqsort(perm.begin(), perm.end(), less);
+            }
+            size_t columns = src_block.columns();
+            for (size_t i = 0; i < columns; ++i) {
+                dest_block.replace_by_position(
+                        i, src_block.get_by_position(i).column->permute(perm, limit));
+            }
+            return;
+        }
+
         ColumnsWithSortDescriptions columns_with_sort_desc =
                 get_columns_with_sort_description(src_block, description);
         {
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
+#include <cstring>
 #include <utility>
 #include <vector>
 
@@ -141,6 +142,30 @@ struct PermutationWithInlineValue {
 template <typename T>
 using PermutationForColumn = std::vector<PermutationWithInlineValue<T>>;
 
+// A string with its first 8 bytes packed big-endian and zero padded into an integer, so that
+// comparing the prefixes orders the strings like memcmp does. Most comparisons in a string sort
+// are decided by the prefix alone and never touch the chars.
+struct PrefixedStringRef {
+    StringRef ref;
+    uint64_t prefix;
+
+    PrefixedStringRef() = default;
+    explicit PrefixedStringRef(StringRef ref_) : ref(ref_), prefix(0) {
+        memcpy(&prefix, ref.data, std::min<size_t>(ref.size, sizeof(prefix)));
+        prefix = __builtin_bswap64(prefix);
+    }
+
+    int compare(const PrefixedStringRef& rhs) const {
+        if (prefix != rhs.prefix) {
+            return prefix < rhs.prefix ? -1 : 1;
+        }
+        // equal prefixes, e.g. "a" and "a\0", still need the full comparison
+        return memcmp_small_allow_overflow15(reinterpret_cast<const UInt8*>(ref.data), ref.size,
+                                             reinterpret_cast<const UInt8*>(rhs.ref.data),
+                                             rhs.ref.size);
+    }
+};
+
 class ColumnSorter {
 public:
     explicit ColumnSorter(const ColumnWithSortDescription& column, const int limit)
@@ -219,7 +244,8 @@ public:
         if (!_should_inline_value(perms)) {
             _sort_by_default(column, flags, perms, range, last_column);
         } else {
-            _sort_by_inlined_permutation<StringRef>(column, flags, perms, range, last_column);
+            _sort_by_inlined_permutation<PrefixedStringRef>(column, flags, perms, range,
+                                                            last_column);
         }
     }
 
@@ -228,7 +254,8 @@ public:
         if (!_should_inline_value(perms)) {
             _sort_by_default(column, flags, perms, range, last_column);
         } else {
-            _sort_by_inlined_permutation<StringRef>(column, flags, perms, range, last_column);
+            _sort_by_inlined_permutation<PrefixedStringRef>(column, flags, perms, range,
+                                                            last_column);
         }
     }
 
@@ -335,7 +362,8 @@ private:
                 permutation_for_column[i].inline_value = column.get_data()[row_id];
             } else if constexpr (std::is_same_v<ColumnType, ColumnString> ||
                                  std::is_same_v<ColumnType, ColumnString64>) {
-                permutation_for_column[i].inline_value = column.get_data_at(row_id);
+                permutation_for_column[i].inline_value =
+                        PrefixedStringRef(column.get_data_at(row_id));
             } else {
                 static_assert(always_false_v<ColumnType>);
             }
@@ -414,13 +442,11 @@ private:
         _create_permutation(column, permutation_for_column.data(), perms);
         auto comparator = [&](const PermutationWithInlineValue<InlineType>& a,
                               const PermutationWithInlineValue<InlineType>& b) {
-            if constexpr (!std::is_same_v<ColumnType, ColumnString>) {
+            if constexpr (!std::is_same_v<InlineType, PrefixedStringRef>) {
                 return a.inline_value > b.inline_value ? 1
                                                        : (a.inline_value < b.inline_value ? -1 : 0);
             } else {
-                return memcmp_small_allow_overflow15(
-                        reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
-                        reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
+                return a.inline_value.compare(b.inline_value);
             }
         };
 
@@ -20,8 +20,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "vec/columns/column.h"
 #include "vec/core/block.h"
+#include "vec/core/normalized_sort_keys.h"
 #include "vec/core/sort_description.h"
 #include "vec/exprs/vexpr_context.h"
 
@@ -126,6 +130,8 @@ struct MergeSortCursorImpl {
     size_t sort_columns_size = 0;
     size_t pos = 0;
     size_t rows = 0;
+    // empty if the rows are compared column by column
+    NormalizedSortKeys sort_keys;
 
     MergeSortCursorImpl() = default;
     virtual ~MergeSortCursorImpl() = default;
@@ -161,6 +167,12 @@ struct MergeSortCursorImpl {
 
         pos = 0;
         rows = all_columns[0]->size();
+        sort_keys.try_encode(block, desc);
+    }
+
+    // Whether the rows of this cursor and `rhs` can be compared by the normalized keys.
+    bool has_same_sort_keys(const MergeSortCursorImpl& rhs) const {
+        return !sort_keys.empty() && sort_keys.key_size() == rhs.sort_keys.key_size();
     }
 
     bool is_first() const { return pos == 0; }
@@ -250,6 +262,10 @@ struct MergeSortCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t greater_at(const MergeSortCursor& rhs, size_t lhs_pos, size_t rhs_pos) const {
+        if (impl->has_same_sort_keys(*rhs.impl)) {
+            int res = impl->sort_keys.compare(lhs_pos, rhs.impl->sort_keys, rhs_pos);
+            return res > 0 ? 1 : (res < 0 ? -1 : 0);
+        }
         for (size_t i = 0; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
@@ -284,6 +300,137 @@ struct MergeSortCursor {
     bool operator<(const MergeSortCursor& rhs) const { return greater(rhs); }
 };
 
+// A tournament tree of losers over a fixed set of cursors, used to merge many sorted runs.
+//
+// The winner, i.e. the cursor with the smallest current row, is kept at the top, every inner
+// node keeps the loser of the match played there. After the top cursor moves, only the matches
+// on the path from its leaf to the root are replayed, that is log(k) comparisons, while a
+// binary heap needs about 2 * log(k). A cursor is inactive when it has no rows or is popped,
+// e.g. while its next block is not there yet, and is activated again by push.
+class SortCursorLoserTree {
+public:
+    void init(std::vector<MergeSortCursorImpl*> cursors) {
+        _cursors = std::move(cursors);
+        _active.assign(_cursors.size(), false);
+        _num_active = 0;
+        for (size_t i = 0; i < _cursors.size(); ++i) {
+            _active[i] = !_cursors[i]->empty();
+            _num_active += _active[i];
+        }
+        _tree.assign(std::max<size_t>(_cursors.size(), 1), 0);
+        if (!_cursors.empty()) {
+            _tree[0] = _build(1);
+        }
+    }
+
+    bool empty() const { return _num_active == 0; }
+
+    size_t size() const { return _num_active; }
+
+    MergeSortCursor top() const { return MergeSortCursor(_cursors[_tree[0]]); }
+
+    // Returns how many rows from the current row of the top cursor, at most `max_rows`, come
+    // before the current rows of all the other cursors. At least 1 if the tree is not empty.
+    // These rows can be emitted at once, which is most of the rows if a run dominates.
+    size_t top_run_rows(size_t max_rows) const {
+        const size_t winner = _tree[0];
+        const MergeSortCursorImpl* cursor = _cursors[winner];
+        const size_t max_run_rows = std::min(max_rows, cursor->rows - cursor->pos);
+        // the runner-up lost to the winner, so it is on the path of the winner
+        size_t runner_up = _cursors.size();
+        for (size_t node = (winner + _cursors.size()) / 2; node > 0; node /= 2) {
+            if (_active[_tree[node]] &&
+                (runner_up == _cursors.size() || _beats(_tree[node], runner_up))) {
+                runner_up = _tree[node];
+            }
+        }
+        if (runner_up == _cursors.size()) {
+            return max_run_rows;
+        }
+        const MergeSortCursor top_cursor(_cursors[winner]);
+        const MergeSortCursor runner_up_cursor(_cursors[runner_up]);
+        size_t rows = 1;
+        while (rows < max_run_rows &&
+               _beats_at(winner, cursor->pos + rows, runner_up, runner_up_cursor->pos, top_cursor,
+                         runner_up_cursor)) {
+            ++rows;
+        }
+        return rows;
+    }
+
+    // Replays the matches of the top cursor after its current row moved.
+    void update_top() { _replay(_tree[0]); }
+
+    // Deactivates the top cursor.
+    void pop() {
+        const size_t winner = _tree[0];
+        _active[winner] = false;
+        --_num_active;
+        _replay(winner);
+    }
+
+    // Activates a cursor of the tree popped before.
+    void push(MergeSortCursorImpl* cursor) {
+        auto it = std::find(_cursors.begin(), _cursors.end(), cursor);
+        DCHECK(it != _cursors.end());
+        const size_t leaf = it - _cursors.begin();
+        DCHECK(!_active[leaf]);
+        _active[leaf] = !cursor->empty();
+        _num_active += _active[leaf];
+        _replay(leaf);
+    }
+
+private:
+    // Whether row `lhs_pos` of cursor `lhs` comes before row `rhs_pos` of cursor `rhs`, the
+    // ties are broken by the index of the cursors.
+    bool _beats_at(size_t lhs, size_t lhs_pos, size_t rhs, size_t rhs_pos,
+                   const MergeSortCursor& lhs_cursor, const MergeSortCursor& rhs_cursor) const {
+        int8_t res = lhs_cursor.greater_at(rhs_cursor, lhs_pos, rhs_pos);
+        return res < 0 || (res == 0 && lhs < rhs);
+    }
+
+    // An active cursor beats an inactive one.
+    bool _beats(size_t lhs, size_t rhs) const {
+        if (!_active[lhs] || !_active[rhs]) {
+            return _active[lhs];
+        }
+        return _beats_at(lhs, _cursors[lhs]->pos, rhs, _cursors[rhs]->pos,
+                         MergeSortCursor(_cursors[lhs]), MergeSortCursor(_cursors[rhs]));
+    }
+
+    // Node n has the children 2n and 2n + 1, cursor i is the leaf k + i. Returns the winner of
+    // the subtree of `node`.
+    size_t _build(size_t node) {
+        if (node >= _cursors.size()) {
+            return node - _cursors.size();
+        }
+        size_t lhs = _build(node * 2);
+        size_t rhs = _build(node * 2 + 1);
+        if (_beats(lhs, rhs)) {
+            _tree[node] = rhs;
+            return lhs;
+        }
+        _tree[node] = lhs;
+        return rhs;
+    }
+
+    void _replay(size_t leaf) {
+        size_t winner = leaf;
+        for (size_t node = (leaf + _cursors.size()) / 2; node > 0; node /= 2) {
+            if (_beats(_tree[node], winner)) {
+                std::swap(_tree[node], winner);
+            }
+        }
+        _tree[0] = winner;
+    }
+
+    std::vector<MergeSortCursorImpl*> _cursors;
+    std::vector<bool> _active;
+    // _tree[0] is the winner, _tree[1, k) are the losers of the inner nodes
+    std::vector<size_t> _tree;
+    size_t _num_active = 0;
+};
+
 /// For easy copying.
 struct MergeSortBlockCursor {
     MergeSortCursorImpl* impl = nullptr;
@@ -293,6 +440,10 @@ struct MergeSortBlockCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t less_at(const MergeSortBlockCursor& rhs, int rows) const {
+        if (impl->has_same_sort_keys(*rhs.impl)) {
+            int res = impl->sort_keys.compare(rows, rhs.impl->sort_keys, rhs->rows - 1);
+            return res < 0 ? 1 : (res > 0 ? -1 : 0);
+        }
         for (size_t i = 0; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
@@ -65,6 +65,13 @@ public:
         return Status::OK();
     }
 
+    /// Tell the reader the conjuncts of the scanner after new runtime filters arrived, the
+    /// reader may use the runtime filters in them to skip the data it has not read yet.
+    /// The conjuncts are still evaluated by the scanner.
+    virtual Status set_late_arrival_runtime_filters(const VExprContextSPtrs& conjuncts) {
+        return Status::OK();
+    }
+
     virtual Status close() { return Status::OK(); }
 
 protected:
@@ -213,6 +213,9 @@ Status NewJsonReader::get_next_block(Block* block, size_t* read_rows, bool* eof)
 
     const int batch_size = std::max(_state->batch_size(), (int)_MIN_BATCH_SIZE);
 
+    if (_ondemand_json_parser != nullptr) {
+        _simdjson_bind_columns(*block, batch_size);
+    }
     while (block->rows() < batch_size && !_reader_eof) {
         if (UNLIKELY(_read_json_by_line && _skip_first_line)) {
             size_t size = 0;
@@ -1024,6 +1027,14 @@ Status NewJsonReader::_simdjson_init_reader() {
     for (int i = 0; i < _file_slot_descs.size(); ++i) {
         _slot_desc_index[StringRef {_file_slot_descs[i]->col_name()}] = i;
     }
+    // resolve the default values once instead of looking them up by name for every row
+    _simdjson_column_writers.resize(_file_slot_descs.size());
+    for (size_t i = 0; i < _file_slot_descs.size(); ++i) {
+        auto& writer = _simdjson_column_writers[i];
+        writer.slot_desc = _file_slot_descs[i];
+        auto it = _col_default_value_map.find(writer.slot_desc->col_name());
+        writer.default_value = it == _col_default_value_map.end() ? nullptr : &it->second;
+    }
     _simdjson_ondemand_padding_buffer.resize(_padded_size);
     _simdjson_ondemand_unscape_padding_buffer.resize(_padded_size);
     return Status::OK();
@@ -1323,14 +1334,49 @@ size_t NewJsonReader::_column_index(const StringRef& name, size_t key_index) {
     }
     auto* it = _slot_desc_index.find(name);
     if (it) {
-        if (key_index < _prev_positions.size()) {
-            _prev_positions[key_index] = it;
+        if (key_index >= _prev_positions.size()) {
+            _prev_positions.resize(key_index + 1, nullptr);
         }
+        _prev_positions[key_index] = it;
         return it->get_second();
     }
     return size_t(-1);
 }
 
+void NewJsonReader::SimdJsonColumnWriter::bind(IColumn* column) {
+    if (slot_desc->is_nullable()) {
+        nullable_column = assert_cast<ColumnNullable*>(column);
+        string_column = assert_cast<ColumnString*>(&nullable_column->get_nested_column());
+    } else {
+        nullable_column = nullptr;
+        string_column = assert_cast<ColumnString*>(column);
+    }
+}
+
+void NewJsonReader::SimdJsonColumnWriter::insert_data(const char* data, size_t size) {
+    if (nullable_column != nullptr) {
+        nullable_column->get_null_map_data().push_back(0);
+    }
+    string_column->insert_data(data, size);
+}
+
+void NewJsonReader::SimdJsonColumnWriter::insert_default() {
+    if (nullable_column != nullptr) {
+        nullable_column->insert_default();
+    } else {
+        string_column->insert_default();
+    }
+}
+
+void NewJsonReader::_simdjson_bind_columns(Block& block, size_t batch_size) {
+    DCHECK_EQ(block.columns(), _simdjson_column_writers.size());
+    for (size_t i = 0; i < _simdjson_column_writers.size(); ++i) {
+        auto column = block.get_by_position(i).column->assume_mutable();
+        column->reserve(batch_size);
+        _simdjson_column_writers[i].bind(column.get());
+    }
+}
+
 Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* value, Block& block,
                                                  const std::vector<SlotDescriptor*>& slot_descs,
                                                  bool* valid) {
@@ -1349,9 +1395,8 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
             continue;
         }
         simdjson::ondemand::value val = field.value();
-        auto* column_ptr = block.get_by_position(column_index).column->assume_mutable().get();
-        RETURN_IF_ERROR(
-                _simdjson_write_data_to_column(val, slot_descs[column_index], column_ptr, valid));
+        RETURN_IF_ERROR(_simdjson_write_data_to_column(
+                val, _simdjson_column_writers[column_index], valid));
         if (!(*valid)) {
             return Status::OK();
         }
@@ -1378,26 +1423,30 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
         if (_seen_columns[i]) {
             continue;
         }
-        auto* slot_desc = slot_descs[i];
+        auto& writer = _simdjson_column_writers[i];
         // Quick path to insert default value, instead of using default values in the value map.
-        if (_col_default_value_map.empty() ||
-            _col_default_value_map.find(slot_desc->col_name()) == _col_default_value_map.end()) {
-            block.get_by_position(i).column->assume_mutable()->insert_default();
+        if (writer.default_value == nullptr) {
+            writer.insert_default();
             continue;
         }
+        auto* slot_desc = slot_descs[i];
         if (!slot_desc->is_materialized()) {
             continue;
         }
-        auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
-        if (column_ptr->size() < cur_row_count + 1) {
-            DCHECK(column_ptr->size() == cur_row_count);
-            RETURN_IF_ERROR(_fill_missing_column(slot_desc, column_ptr, valid));
-            if (!(*valid)) {
-                return Status::OK();
+        if (writer.string_column->size() < cur_row_count + 1) {
+            DCHECK(writer.string_column->size() == cur_row_count);
+            if (writer.nullable_column == nullptr) {
+                // reports the missing value of the not nullable column
+                RETURN_IF_ERROR(_fill_missing_column(slot_desc, writer.string_column, valid));
+                if (!(*valid)) {
+                    return Status::OK();
+                }
+            } else {
+                writer.insert_data(writer.default_value->data(), writer.default_value->size());
             }
             ++nullcount;
         }
-        DCHECK(column_ptr->size() == cur_row_count + 1);
+        DCHECK(writer.string_column->size() == cur_row_count + 1);
     }
 
 #ifndef NDEBUG
@@ -1415,51 +1464,48 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
 Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value& value,
                                                      SlotDescriptor* slot_desc, IColumn* column,
                                                      bool* valid) {
-    // write
-    ColumnNullable* nullable_column = nullptr;
-    IColumn* column_ptr = nullptr;
-    if (slot_desc->is_nullable()) {
-        nullable_column = assert_cast<ColumnNullable*>(column);
-        column_ptr = &nullable_column->get_nested_column();
-    }
+    SimdJsonColumnWriter writer;
+    writer.slot_desc = slot_desc;
+    writer.bind(column);
+    return _simdjson_write_data_to_column(value, writer, valid);
+}
+
+Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value& value,
+                                                     SimdJsonColumnWriter& writer, bool* valid) {
     // TODO: if the vexpr can support another 'slot_desc type' than 'TYPE_VARCHAR',
     // we need use a function to support these types to insert data in columns.
-    auto* column_string = assert_cast<ColumnString*>(column_ptr);
     switch (value.type()) {
     case simdjson::ondemand::json_type::null: {
-        if (column->is_nullable()) {
+        if (writer.nullable_column != nullptr) {
             // insert_default already push 1 to null_map
-            nullable_column->insert_default();
+            writer.nullable_column->insert_default();
         } else {
             RETURN_IF_ERROR(_append_error_msg(
                     nullptr, "Json value is null, but the column `{}` is not nullable.",
-                    slot_desc->col_name(), valid));
+                    writer.slot_desc->col_name(), valid));
             return Status::OK();
         }
         break;
     }
     case simdjson::ondemand::json_type::boolean: {
-        nullable_column->get_null_map_data().push_back(0);
         if (value.get_bool()) {
-            column_string->insert_data("1", 1);
+            writer.insert_data("1", 1);
         } else {
-            column_string->insert_data("0", 1);
+            writer.insert_data("0", 1);
         }
         break;
     }
+    case simdjson::ondemand::json_type::string: {
+        auto* unescape_buffer =
+                reinterpret_cast<uint8_t*>(_simdjson_ondemand_unscape_padding_buffer.data());
+        std::string_view unescaped_value =
+                _ondemand_json_parser->unescape(value.get_raw_json_string(), unescape_buffer);
+        writer.insert_data(unescaped_value.data(), unescaped_value.length());
+        break;
+    }
     default: {
-        if (value.type() == simdjson::ondemand::json_type::string) {
-            auto* unescape_buffer =
-                    reinterpret_cast<uint8_t*>(_simdjson_ondemand_unscape_padding_buffer.data());
-            std::string_view unescaped_value =
-                    _ondemand_json_parser->unescape(value.get_raw_json_string(), unescape_buffer);
-            nullable_column->get_null_map_data().push_back(0);
-            column_string->insert_data(unescaped_value.data(), unescaped_value.length());
-            break;
-        }
         auto value_str = simdjson::to_json_string(value).value();
-        nullable_column->get_null_map_data().push_back(0);
-        column_string->insert_data(value_str.data(), value_str.length());
+        writer.insert_data(value_str.data(), value_str.length());
     }
     }
     *valid = true;
@@ -71,6 +71,8 @@ namespace vectorized {
 
 struct ScannerCounter;
 class Block;
+class ColumnNullable;
+class ColumnString;
 class IColumn;
 
 class NewJsonReader : public GenericReader {
@@ -177,9 +179,28 @@ private:
     Status _simdjson_set_column_value(simdjson::ondemand::object* value, Block& block,
                                       const std::vector<SlotDescriptor*>& slot_descs, bool* valid);
 
+    // Writes the fields of a simple json object into the columns of a batch, it's built once by
+    // `_simdjson_init_reader` and bound to the columns by `_simdjson_bind_columns` per batch.
+    struct SimdJsonColumnWriter {
+        SlotDescriptor* slot_desc = nullptr;
+        // nullptr if the column has no default value
+        const std::string* default_value = nullptr;
+        // nullptr if the column is not nullable
+        ColumnNullable* nullable_column = nullptr;
+        ColumnString* string_column = nullptr;
+
+        void bind(IColumn* column);
+        void insert_data(const char* data, size_t size);
+        void insert_default();
+    };
+
+    void _simdjson_bind_columns(Block& block, size_t batch_size);
+
     Status _simdjson_write_data_to_column(simdjson::ondemand::value& value,
                                           SlotDescriptor* slot_desc,
                                           vectorized::IColumn* column_ptr, bool* valid);
+    Status _simdjson_write_data_to_column(simdjson::ondemand::value& value,
+                                          SimdJsonColumnWriter& writer, bool* valid);
 
     Status _simdjson_write_columns_by_jsonpath(simdjson::ondemand::object* value,
                                                const std::vector<SlotDescriptor*>& slot_descs,
@@ -264,6 +285,8 @@ private:
     std::vector<NameMap::LookupResult> _prev_positions;
     /// Set of columns which already met in row. Exception is thrown if there are more than one column with the same name.
     std::vector<UInt8> _seen_columns;
+    /// The writers of `_file_slot_descs` for simple json, in the same order.
+    std::vector<SimdJsonColumnWriter> _simdjson_column_writers;
     // simdjson
     std::unique_ptr<uint8_t[]> _json_str_ptr;
     const uint8_t* _json_str = nullptr;
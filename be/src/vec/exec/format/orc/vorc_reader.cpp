@@ -71,6 +71,7 @@
 #include "vec/data_types/data_type_map.h"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_struct.h"
+#include "vec/exec/format/runtime_filter_value_range.h"
 #include "vec/exec/format/table/transactional_hive_common.h"
 #include "vec/exprs/vbloom_predicate.h"
 #include "vec/exprs/vdirect_in_predicate.h"
@@ -192,6 +193,8 @@ void OrcReader::_collect_profile_before_close() {
         COUNTER_UPDATE(_orc_profile.set_fill_column_time, _statistics.set_fill_column_time);
         COUNTER_UPDATE(_orc_profile.decode_value_time, _statistics.decode_value_time);
         COUNTER_UPDATE(_orc_profile.decode_null_map_time, _statistics.decode_null_map_time);
+        COUNTER_UPDATE(_orc_profile.runtime_filter_predicates,
+                       _statistics.runtime_filter_predicates);
 
         if (_file_input_stream != nullptr) {
             _file_input_stream->collect_profile_before_close();
@@ -225,6 +228,8 @@ void OrcReader::_init_profile() {
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "DecodeValueTime", orc_profile, 1);
         _orc_profile.decode_null_map_time =
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "DecodeNullMapTime", orc_profile, 1);
+        _orc_profile.runtime_filter_predicates = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "RuntimeFilterPredicates", TUnit::UNIT, orc_profile, 1);
     }
 }
 
@@ -693,10 +698,16 @@ bool OrcReader::_init_search_argument(
     for (int i = 0; i < root_type.getSubtypeCount(); ++i) {
         type_map.emplace(get_field_name_lower_case(&root_type, i), root_type.getSubtype(i));
     }
+    if (config::enable_orc_runtime_filter_search_argument) {
+        _add_runtime_filter_value_ranges(*colname_to_value_range);
+    }
     for (auto& col_name : _lazy_read_ctx.all_read_columns) {
-        auto iter = colname_to_value_range->find(col_name);
-        if (iter == colname_to_value_range->end()) {
-            continue;
+        auto iter = _runtime_filter_value_ranges.find(col_name);
+        if (iter == _runtime_filter_value_ranges.end()) {
+            iter = colname_to_value_range->find(col_name);
+            if (iter == colname_to_value_range->end()) {
+                continue;
+            }
         }
         auto type_it = type_map.find(col_name);
         if (type_it == type_map.end()) {
@@ -725,6 +736,39 @@ bool OrcReader::_init_search_argument(
     }
 }
 
+void OrcReader::_add_runtime_filter_value_ranges(
+        const std::unordered_map<std::string, ColumnValueRangeType>& colname_to_value_range) {
+    for (const auto& conjunct : _lazy_read_ctx.conjuncts) {
+        auto* runtime_filter = typeid_cast<VRuntimeFilterWrapper*>(conjunct->root().get());
+        // the null aware filters keep the rows of null
+        if (runtime_filter == nullptr || runtime_filter->null_aware()) {
+            continue;
+        }
+        const VExprSPtr& impl = runtime_filter->get_impl();
+        if (impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        std::string col_name = impl->children()[0]->expr_name();
+        auto file_col_iter = _table_col_to_file_col.find(col_name);
+        if (file_col_iter != _table_col_to_file_col.end()) {
+            col_name = file_col_iter->second;
+        }
+        auto range_iter = _runtime_filter_value_ranges.find(col_name);
+        if (range_iter == _runtime_filter_value_ranges.end()) {
+            auto conjunct_iter = colname_to_value_range.find(col_name);
+            if (conjunct_iter == colname_to_value_range.end()) {
+                continue;
+            }
+            range_iter =
+                    _runtime_filter_value_ranges.emplace(col_name, conjunct_iter->second).first;
+        }
+        if (std::visit([&](auto&& range) { return narrow_by_runtime_filter(range, impl.get()); },
+                       range_iter->second)) {
+            _statistics.runtime_filter_predicates++;
+        }
+    }
+}
+
 Status OrcReader::set_fill_columns(
         const std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>&
                 partition_columns,
@@ -127,6 +127,7 @@ public:
         int64_t set_fill_column_time = 0;
         int64_t decode_value_time = 0;
         int64_t decode_null_map_time = 0;
+        int64_t runtime_filter_predicates = 0;
     };
 
     OrcReader(RuntimeProfile* profile, RuntimeState* state, const TFileScanRangeParams& params,
@@ -222,6 +223,7 @@ private:
         RuntimeProfile::Counter* set_fill_column_time = nullptr;
         RuntimeProfile::Counter* decode_value_time = nullptr;
         RuntimeProfile::Counter* decode_null_map_time = nullptr;
+        RuntimeProfile::Counter* runtime_filter_predicates = nullptr;
     };
 
     class ORCFilterImpl : public orc::ORCFilter {
@@ -276,6 +278,10 @@ private:
     static const orc::Type& _remove_acid(const orc::Type& type);
     bool _init_search_argument(
             std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range);
+    // Narrows the value ranges of the columns by the IN and min/max runtime filters in the
+    // conjuncts into `_runtime_filter_value_ranges`.
+    void _add_runtime_filter_value_ranges(
+            const std::unordered_map<std::string, ColumnValueRangeType>& colname_to_value_range);
     void _init_bloom_filter(
             std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range);
     void _init_system_properties();
@@ -578,6 +584,9 @@ private:
     size_t _decimal_scale_params_index;
 
     std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range;
+    // the value ranges of `_colname_to_value_range` intersected with the runtime filters, which
+    // are pushed into the search argument instead of the original ones
+    std::unordered_map<std::string, ColumnValueRangeType> _runtime_filter_value_ranges;
     bool _is_acid = false;
     std::unique_ptr<IColumn::Filter> _filter;
     LazyReadContext _lazy_read_ctx;
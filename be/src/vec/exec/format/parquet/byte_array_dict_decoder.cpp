@@ -89,12 +89,15 @@ Status ByteArrayDictDecoder::get_dict_codes(const ColumnString* string_column,
 MutableColumnPtr ByteArrayDictDecoder::convert_dict_column_to_string_column(
         const ColumnInt32* dict_column) {
     auto res = ColumnString::create();
-    std::vector<StringRef> dict_values(dict_column->size());
+    const size_t num_values = dict_column->size();
+    if (_string_values.size() < num_values) {
+        _string_values.resize(num_values);
+    }
     const auto& data = dict_column->get_data();
-    for (size_t i = 0; i < dict_column->size(); ++i) {
-        dict_values[i] = _dict_items[data[i]];
+    for (size_t i = 0; i < num_values; ++i) {
+        _string_values[i] = _dict_items[data[i]];
     }
-    res->insert_many_strings_overflow(&dict_values[0], dict_values.size(), _max_value_length);
+    res->insert_many_strings_overflow(_string_values.data(), num_values, _max_value_length);
     return res;
 }
 
@@ -125,18 +128,23 @@ Status ByteArrayDictDecoder::_decode_values(MutableColumnPtr& doris_column, Data
         return _decode_dict_values<has_filter>(doris_column, select_vector, is_dict_filter);
     }
 
+    // the runs are no longer than the non-null values, so the refs are gathered into one buffer
+    // which lives as long as the decoder instead of a vector per run
+    if (_string_values.size() < non_null_size) {
+        _string_values.resize(non_null_size);
+    }
+    doris_column->reserve(doris_column->size() + select_vector.num_values() -
+                          select_vector.num_filtered());
     size_t dict_index = 0;
 
     ColumnSelectVector::DataReadType read_type;
     while (size_t run_length = select_vector.get_next_run<has_filter>(&read_type)) {
         switch (read_type) {
         case ColumnSelectVector::CONTENT: {
-            std::vector<StringRef> string_values;
-            string_values.reserve(run_length);
             for (size_t i = 0; i < run_length; ++i) {
-                string_values.emplace_back(_dict_items[_indexes[dict_index++]]);
+                _string_values[i] = _dict_items[_indexes[dict_index++]];
             }
-            doris_column->insert_many_strings_overflow(&string_values[0], run_length,
+            doris_column->insert_many_strings_overflow(_string_values.data(), run_length,
                                                        _max_value_length);
             break;
         }
@@ -65,5 +65,7 @@ protected:
     std::vector<uint8_t> _dict_data;
     size_t _max_value_length;
     std::unordered_map<StringRef, int32_t> _dict_value_to_code;
+    // the dictionary items of the values being copied into a string column
+    std::vector<StringRef> _string_values;
 };
 } // namespace doris::vectorized
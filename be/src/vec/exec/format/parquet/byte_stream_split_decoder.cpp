@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/exec/format/parquet/byte_stream_split_decoder.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/exec/format/parquet/parquet_common.h"
+
+namespace doris::vectorized {
+
+#ifdef __SSE2__
+// Transposes 16 values of 4 bytes at a time, returns the number of values decoded.
+static size_t decode_streams_4_sse2(const uint8_t* src, size_t stride, size_t start,
+                                    size_t num_values, uint8_t* dest) {
+    size_t i = 0;
+    for (; i + 16 <= num_values; i += 16) {
+        __m128i s[4];
+        for (int b = 0; b < 4; ++b) {
+            s[b] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + b * stride + start + i));
+        }
+        // the bytes 0 and 1, then 2 and 3, of the values 0-7 and 8-15
+        __m128i p01_lo = _mm_unpacklo_epi8(s[0], s[1]);
+        __m128i p01_hi = _mm_unpackhi_epi8(s[0], s[1]);
+        __m128i p23_lo = _mm_unpacklo_epi8(s[2], s[3]);
+        __m128i p23_hi = _mm_unpackhi_epi8(s[2], s[3]);
+        auto* out = reinterpret_cast<__m128i*>(dest + i * 4);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(p01_lo, p23_lo));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(p01_lo, p23_lo));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(p01_hi, p23_hi));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(p01_hi, p23_hi));
+    }
+    return i;
+}
+
+// Transposes 16 values of 8 bytes at a time, returns the number of values decoded.
+static size_t decode_streams_8_sse2(const uint8_t* src, size_t stride, size_t start,
+                                    size_t num_values, uint8_t* dest) {
+    size_t i = 0;
+    for (; i + 16 <= num_values; i += 16) {
+        __m128i s[8];
+        for (int b = 0; b < 8; ++b) {
+            s[b] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + b * stride + start + i));
+        }
+        // pairs of bytes of the values 0-7 and 8-15
+        __m128i pairs[8];
+        for (int b = 0; b < 4; ++b) {
+            pairs[b] = _mm_unpacklo_epi8(s[2 * b], s[2 * b + 1]);
+            pairs[b + 4] = _mm_unpackhi_epi8(s[2 * b], s[2 * b + 1]);
+        }
+        // quads of bytes of the values 0-3, 4-7, 8-11 and 12-15
+        __m128i quads[8];
+        for (int h = 0; h < 2; ++h) {
+            __m128i* p = pairs + h * 4;
+            quads[h * 4] = _mm_unpacklo_epi16(p[0], p[1]);
+            quads[h * 4 + 1] = _mm_unpackhi_epi16(p[0], p[1]);
+            quads[h * 4 + 2] = _mm_unpacklo_epi16(p[2], p[3]);
+            quads[h * 4 + 3] = _mm_unpackhi_epi16(p[2], p[3]);
+        }
+        auto* out = reinterpret_cast<__m128i*>(dest + i * 8);
+        for (int q = 0; q < 4; ++q) {
+            // the bytes 0-3 and the bytes 4-7 of the values 4q to 4q+3
+            __m128i low = quads[(q / 2) * 4 + (q % 2)];
+            __m128i high = quads[(q / 2) * 4 + (q % 2) + 2];
+            _mm_storeu_si128(out + q * 2, _mm_unpacklo_epi32(low, high));
+            _mm_storeu_si128(out + q * 2 + 1, _mm_unpackhi_epi32(low, high));
+        }
+    }
+    return i;
+}
+#endif
+
+void ByteStreamSplitDecoder::decode_streams(const uint8_t* src, int width, size_t stride,
+                                            size_t start, size_t num_values, uint8_t* dest) {
+    size_t i = 0;
+#ifdef __SSE2__
+    if (width == 4) {
+        i = decode_streams_4_sse2(src, stride, start, num_values, dest);
+    } else if (width == 8) {
+        i = decode_streams_8_sse2(src, stride, start, num_values, dest);
+    }
+#endif
+    for (; i < num_values; ++i) {
+        for (int b = 0; b < width; ++b) {
+            dest[i * width + b] = src[b * stride + start + i];
+        }
+    }
+}
+
+Status ByteStreamSplitDecoder::skip_values(size_t num_values) {
+    _offset += _type_length * num_values;
+    if (UNLIKELY(_offset > _data->size)) {
+        return Status::IOError("Out-of-bounds access in parquet data decoder");
+    }
+    return Status::OK();
+}
+
+Status ByteStreamSplitDecoder::decode_values(MutableColumnPtr& doris_column,
+                                             DataTypePtr& data_type,
+                                             ColumnSelectVector& select_vector,
+                                             bool is_dict_filter) {
+    if (select_vector.has_filter()) {
+        return _decode_values<true>(doris_column, data_type, select_vector, is_dict_filter);
+    } else {
+        return _decode_values<false>(doris_column, data_type, select_vector, is_dict_filter);
+    }
+}
+
+template <bool has_filter>
+Status ByteStreamSplitDecoder::_decode_values(MutableColumnPtr& doris_column,
+                                              DataTypePtr& data_type,
+                                              ColumnSelectVector& select_vector,
+                                              bool is_dict_filter) {
+    size_t non_null_size = select_vector.num_values() - select_vector.num_nulls();
+    if (UNLIKELY(_offset + _type_length * non_null_size > _data->size)) {
+        return Status::IOError("Out-of-bounds access in parquet data decoder");
+    }
+    if (UNLIKELY(_data->size % _type_length != 0)) {
+        return Status::Corruption("The size of BYTE_STREAM_SPLIT page {} is not a multiple of {}",
+                                  _data->size, _type_length);
+    }
+    const auto* src = reinterpret_cast<const uint8_t*>(_data->data);
+    const size_t stride = _data->size / _type_length;
+
+    auto& column_data = reinterpret_cast<ColumnVector<Int8>&>(*doris_column).get_data();
+    size_t data_index = column_data.size();
+    column_data.resize(data_index +
+                       _type_length * (select_vector.num_values() - select_vector.num_filtered()));
+    ColumnSelectVector::DataReadType read_type;
+    while (size_t run_length = select_vector.get_next_run<has_filter>(&read_type)) {
+        switch (read_type) {
+        case ColumnSelectVector::CONTENT: {
+            decode_streams(src, _type_length, stride, _offset / _type_length, run_length,
+                           reinterpret_cast<uint8_t*>(column_data.data()) + data_index);
+            _offset += run_length * _type_length;
+            data_index += run_length * _type_length;
+            break;
+        }
+        case ColumnSelectVector::NULL_DATA: {
+            data_index += run_length * _type_length;
+            break;
+        }
+        case ColumnSelectVector::FILTERED_CONTENT: {
+            _offset += _type_length * run_length;
+            break;
+        }
+        case ColumnSelectVector::FILTERED_NULL: {
+            // do nothing
+            break;
+        }
+        }
+    }
+    return Status::OK();
+}
+
+} // namespace doris::vectorized
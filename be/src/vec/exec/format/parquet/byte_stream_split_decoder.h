@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common/status.h"
+#include "vec/columns/column.h"
+#include "vec/data_types/data_type.h"
+#include "vec/exec/format/parquet/decoder.h"
+
+namespace doris::vectorized {
+class ColumnSelectVector;
+} // namespace doris::vectorized
+
+namespace doris::vectorized {
+
+// Decodes the BYTE_STREAM_SPLIT encoding, which stores the k-th byte of all the values of a page
+// in the k-th stream, so the bytes of a value are gathered from `_type_length` streams which are
+// `_data->size / _type_length` bytes apart.
+class ByteStreamSplitDecoder final : public Decoder {
+public:
+    ByteStreamSplitDecoder() = default;
+    ~ByteStreamSplitDecoder() override = default;
+
+    Status decode_values(MutableColumnPtr& doris_column, DataTypePtr& data_type,
+                         ColumnSelectVector& select_vector, bool is_dict_filter) override;
+
+    template <bool has_filter>
+    Status _decode_values(MutableColumnPtr& doris_column, DataTypePtr& data_type,
+                          ColumnSelectVector& select_vector, bool is_dict_filter);
+
+    Status skip_values(size_t num_values) override;
+
+    // Gathers the values [start, start + num_values) of the `width` streams in `src` into `dest`.
+    static void decode_streams(const uint8_t* src, int width, size_t stride, size_t start,
+                               size_t num_values, uint8_t* dest);
+};
+
+} // namespace doris::vectorized
@@ -24,6 +24,7 @@
 #include "vec/exec/format/parquet/bool_rle_decoder.h"
 #include "vec/exec/format/parquet/byte_array_dict_decoder.h"
 #include "vec/exec/format/parquet/byte_array_plain_decoder.h"
+#include "vec/exec/format/parquet/byte_stream_split_decoder.h"
 #include "vec/exec/format/parquet/delta_bit_pack_decoder.h"
 #include "vec/exec/format/parquet/fix_length_dict_decoder.hpp"
 #include "vec/exec/format/parquet/fix_length_plain_decoder.h"
@@ -118,6 +119,21 @@ Status Decoder::get_decoder(tparquet::Type::type type, tparquet::Encoding::type
             return Status::InternalError("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY.");
         }
         break;
+    case tparquet::Encoding::BYTE_STREAM_SPLIT:
+        switch (type) {
+        case tparquet::Type::INT32:
+        case tparquet::Type::INT64:
+        case tparquet::Type::FLOAT:
+        case tparquet::Type::DOUBLE:
+        case tparquet::Type::FIXED_LEN_BYTE_ARRAY:
+            decoder.reset(new ByteStreamSplitDecoder());
+            break;
+        default:
+            return Status::InternalError(
+                    "BYTE_STREAM_SPLIT only supports INT32, INT64, FLOAT, DOUBLE and "
+                    "FIXED_LEN_BYTE_ARRAY.");
+        }
+        break;
     default:
         return Status::InternalError("Unsupported encoding {}(type={}) in parquet decoder",
                                      tparquet::to_string(encoding), tparquet::to_string(type));
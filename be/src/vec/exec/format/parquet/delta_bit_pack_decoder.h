@@ -490,10 +490,8 @@ Status DeltaBitPackDecoder<T>::_get_internal(T* buffer, int num_values, int* out
 
         int values_decode = std::min(_values_remaining_current_mini_block,
                                      static_cast<uint32_t>(num_values - i));
-        for (int j = 0; j < values_decode; ++j) {
-            if (!_bit_reader->GetValue(_delta_bit_width, buffer + i + j)) {
-                return Status::IOError("Get batch EOF");
-            }
+        if (!_bit_reader->GetBatch(_delta_bit_width, buffer + i, values_decode)) {
+            return Status::IOError("Get batch EOF");
         }
         for (int j = 0; j < values_decode; ++j) {
             // Addition between min_delta, packed int and last_value should be treated as
@@ -560,10 +558,8 @@ Status DeltaLengthByteArrayDecoder::_get_internal(Slice* buffer, int max_values,
 
     _buffered_data.resize(data_size);
     char* data_ptr = _buffered_data.data();
-    for (int j = 0; j < data_size; j++) {
-        if (!_bit_reader->GetValue(8, data_ptr + j)) {
-            return Status::IOError("Get length bytes EOF");
-        }
+    if (!_bit_reader->GetBatch(8, data_ptr, data_size)) {
+        return Status::IOError("Get length bytes EOF");
     }
 
     for (int i = 0; i < max_values; ++i) {
@@ -90,7 +90,12 @@ size_t doris::vectorized::LevelDecoder::get_levels(doris::vectorized::level_t* l
         _num_levels -= num_decoded;
         return num_decoded;
     } else if (_encoding == tparquet::Encoding::BIT_PACKED) {
-        // TODO(gaoxin): BIT_PACKED encoding
+        n = std::min((size_t)_num_levels, n);
+        if (!_bit_packed_decoder.GetBatch(_bit_width, levels, n)) {
+            return 0;
+        }
+        _num_levels -= n;
+        return n;
     }
     return 0;
 }
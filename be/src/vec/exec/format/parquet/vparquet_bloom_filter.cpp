@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vparquet_bloom_filter.h"
+
+#include <gen_cpp/parquet_types.h>
+#include <xxhash.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "io/fs/file_reader.h"
+#include "util/slice.h"
+#include "util/thrift_util.h"
+
+namespace doris::vectorized {
+
+// the salts of BloomFilter.md, which are the same as the ones of BlockBloomFilter
+static constexpr uint32_t SALT[8] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                     0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+Status ParquetBloomFilter::read(io::FileReaderSPtr file_reader,
+                                const tparquet::ColumnMetaData& column, io::IOContext* io_ctx,
+                                bool* has_filter, int64_t* read_bytes) {
+    *has_filter = false;
+    if (!column.__isset.bloom_filter_offset || column.bloom_filter_offset <= 0 ||
+        static_cast<size_t>(column.bloom_filter_offset) >= file_reader->size()) {
+        return Status::OK();
+    }
+    const size_t offset = column.bloom_filter_offset;
+    uint8_t header_buff[MAX_HEADER_SIZE];
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(
+            offset, Slice(header_buff, std::min(MAX_HEADER_SIZE, file_reader->size() - offset)),
+            &bytes_read, io_ctx));
+    tparquet::BloomFilterHeader header;
+    uint32_t header_size = bytes_read;
+    RETURN_IF_ERROR(deserialize_thrift_msg(header_buff, &header_size, true, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH ||
+        !header.compression.__isset.UNCOMPRESSED) {
+        return Status::OK();
+    }
+    const size_t num_bytes = std::max(header.numBytes, 0);
+    if (num_bytes == 0 || num_bytes % BYTES_PER_BLOCK != 0 || num_bytes > MAX_BITSET_SIZE ||
+        offset + header_size + num_bytes > file_reader->size()) {
+        return Status::Corruption("Invalid parquet bloom filter of {} bytes at offset {}",
+                                  header.numBytes, offset);
+    }
+    RETURN_IF_ERROR(init(num_bytes));
+    // the bitset may be read along with the header already
+    size_t buffered = std::min<size_t>(bytes_read - header_size, num_bytes);
+    auto* bitset = reinterpret_cast<char*>(_bitset.data());
+    memcpy(bitset, header_buff + header_size, buffered);
+    size_t bitset_read = 0;
+    if (buffered < num_bytes) {
+        RETURN_IF_ERROR(file_reader->read_at(offset + header_size + buffered,
+                                             Slice(bitset + buffered, num_bytes - buffered),
+                                             &bitset_read, io_ctx));
+        if (bitset_read != num_bytes - buffered) {
+            return Status::Corruption("Read {} bytes of the parquet bloom filter, expected {}",
+                                      bitset_read, num_bytes - buffered);
+        }
+    }
+    if (read_bytes != nullptr) {
+        *read_bytes += bytes_read + bitset_read;
+    }
+    *has_filter = true;
+    return Status::OK();
+}
+
+Status ParquetBloomFilter::init(size_t num_bytes) {
+    if (num_bytes == 0 || num_bytes % BYTES_PER_BLOCK != 0) {
+        return Status::InvalidArgument("Invalid size {} of parquet bloom filter", num_bytes);
+    }
+    _bitset.assign(num_bytes / sizeof(uint32_t), 0);
+    _num_blocks = num_bytes / BYTES_PER_BLOCK;
+    return Status::OK();
+}
+
+uint64_t ParquetBloomFilter::hash(const void* data, size_t len) {
+    return XXH64(data, len, 0);
+}
+
+void ParquetBloomFilter::insert_hash(uint64_t hash) {
+    uint32_t* block = _block(hash);
+    const auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < WORDS_PER_BLOCK; ++i) {
+        block[i] |= 1U << ((key * SALT[i]) >> 27);
+    }
+}
+
+bool ParquetBloomFilter::find_hash(uint64_t hash) const {
+    const uint32_t* block = _block(hash);
+    const auto key = static_cast<uint32_t>(hash);
+    for (int i = 0; i < WORDS_PER_BLOCK; ++i) {
+        if ((block[i] & (1U << ((key * SALT[i]) >> 27))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "common/status.h"
+#include "io/fs/file_reader_writer_fwd.h"
+
+namespace doris::io {
+struct IOContext;
+} // namespace doris::io
+namespace tparquet {
+class ColumnMetaData;
+} // namespace tparquet
+
+namespace doris::vectorized {
+
+// The split block bloom filter of a parquet column chunk, see BloomFilter.md of parquet-format.
+// The filter is a sequence of 32-byte blocks, a hash selects one block by its upper 32 bits and
+// sets one bit in each of the 8 words of the block by its lower 32 bits.
+// The hash of a value is the xxhash64 with seed 0 of its plain encoding.
+class ParquetBloomFilter {
+public:
+    static constexpr size_t BYTES_PER_BLOCK = 32;
+    // the thrift header before the bitset is about 15 bytes
+    static constexpr size_t MAX_HEADER_SIZE = 64;
+    // parquet-mr and arrow write at most 128MB
+    static constexpr size_t MAX_BITSET_SIZE = 128 * 1024 * 1024;
+
+    ParquetBloomFilter() = default;
+    ~ParquetBloomFilter() = default;
+
+    // Reads the bloom filter of the column chunk, `*has_filter` is false if the chunk has no
+    // bloom filter or the filter is not a split block filter of uncompressed xxhash values.
+    Status read(io::FileReaderSPtr file_reader, const tparquet::ColumnMetaData& column,
+                io::IOContext* io_ctx, bool* has_filter, int64_t* read_bytes = nullptr);
+
+    // Creates an empty filter of `num_bytes` bytes, which is a multiple of BYTES_PER_BLOCK.
+    Status init(size_t num_bytes);
+
+    static uint64_t hash(const void* data, size_t len);
+
+    void insert_hash(uint64_t hash);
+
+    bool find_hash(uint64_t hash) const;
+
+    size_t size() const { return _bitset.size() * sizeof(uint32_t); }
+
+private:
+    static constexpr int WORDS_PER_BLOCK = BYTES_PER_BLOCK / sizeof(uint32_t);
+
+    uint32_t* _block(uint64_t hash) {
+        return _bitset.data() + (((hash >> 32) * _num_blocks) >> 32) * WORDS_PER_BLOCK;
+    }
+    const uint32_t* _block(uint64_t hash) const {
+        return _bitset.data() + (((hash >> 32) * _num_blocks) >> 32) * WORDS_PER_BLOCK;
+    }
+
+    std::vector<uint32_t> _bitset;
+    uint64_t _num_blocks = 0;
+};
+
+} // namespace doris::vectorized
@@ -22,11 +22,15 @@
 #include <gen_cpp/parquet_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/schema_scanner.h"
+#include "exprs/hybrid_set.h"
 #include "io/file_factory.h"
 #include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
@@ -45,12 +49,15 @@
 #include "vec/core/types.h"
 #include "vec/exec/format/parquet/parquet_common.h"
 #include "vec/exec/format/parquet/schema_desc.h"
+#include "vec/exec/format/parquet/vparquet_bloom_filter.h"
 #include "vec/exec/format/parquet/vparquet_file_metadata.h"
 #include "vec/exec/format/parquet/vparquet_group_reader.h"
 #include "vec/exec/format/parquet/vparquet_page_index.h"
+#include "vec/exec/format/runtime_filter_value_range.h"
 #include "vec/exprs/vbloom_predicate.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vin_predicate.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/exprs/vruntimefilter_wrapper.h"
 #include "vec/exprs/vslot_ref.h"
 
@@ -144,6 +151,10 @@ void ParquetReader::_init_profile() {
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "PageIndexFilterTime", parquet_profile, 1);
         _parquet_profile.row_group_filter_time =
                 ADD_CHILD_TIMER_WITH_LEVEL(_profile, "RowGroupFilterTime", parquet_profile, 1);
+        _parquet_profile.bloom_filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByBloomFilter", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.late_rf_filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByLateRuntimeFilter", TUnit::UNIT, parquet_profile, 1);
 
         _parquet_profile.file_read_time = ADD_TIMER_WITH_LEVEL(_profile, "FileReadTime", 1);
         _parquet_profile.file_read_calls =
@@ -334,6 +345,8 @@ Status ParquetReader::init_reader(
     _colname_to_value_range = colname_to_value_range;
     // build column predicates for column lazy read
     _lazy_read_ctx.conjuncts = conjuncts;
+    std::vector<std::string> narrowed_columns;
+    _add_runtime_filter_value_ranges(conjuncts, &narrowed_columns);
     RETURN_IF_ERROR(_init_row_groups(filter_groups));
     return Status::OK();
 }
@@ -556,6 +569,22 @@ Status ParquetReader::_next_row_group_reader() {
     if (_current_group_reader != nullptr) {
         _current_group_reader->collect_profile_before_close();
     }
+    // the row groups are filtered again by the runtime filters which arrived after the row
+    // groups to read were chosen
+    while (!_late_arrival_columns.empty() && !_read_row_groups.empty()) {
+        const auto& next_row_group = _t_metadata->row_groups[_read_row_groups.front().row_group_id];
+        bool filter_group = false;
+        RETURN_IF_ERROR(
+                _process_row_group_filter(next_row_group, _late_arrival_columns, &filter_group));
+        if (!filter_group) {
+            break;
+        }
+        _statistics.late_rf_filtered_row_groups++;
+        _statistics.filtered_row_groups++;
+        _statistics.read_row_groups--;
+        _statistics.filtered_group_rows += next_row_group.num_rows;
+        _read_row_groups.pop_front();
+    }
     if (_read_row_groups.empty()) {
         _row_group_eof = true;
         _current_group_reader.reset(nullptr);
@@ -610,7 +639,7 @@ Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
         }
         bool filter_group = false;
         if (is_filter_groups) {
-            RETURN_IF_ERROR(_process_row_group_filter(row_group, &filter_group));
+            RETURN_IF_ERROR(_process_row_group_filter(row_group, _read_columns, &filter_group));
         }
         int64_t group_size = 0; // only calculate the needed columns
         std::function<int64_t(const FieldSchema*)> column_compressed_size =
@@ -726,7 +755,8 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         _statistics.read_rows += row_group.num_rows;
     };
 
-    if (_lazy_read_ctx.has_complex_type || _lazy_read_ctx.conjuncts.empty() ||
+    if (_lazy_read_ctx.has_complex_type ||
+        (_lazy_read_ctx.conjuncts.empty() && _late_arrival_columns.empty()) ||
         _colname_to_value_range == nullptr || _colname_to_value_range->empty()) {
         read_whole_row_group();
         return Status::OK();
@@ -752,8 +782,8 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
     // read twice: parse column index & parse offset index
     _column_statistics.meta_read_calls += 2;
     for (auto& read_col : _read_columns) {
-        auto conjunct_iter = _colname_to_value_range->find(read_col);
-        if (_colname_to_value_range->end() == conjunct_iter) {
+        ColumnValueRangeType* value_range = _get_value_range(read_col);
+        if (value_range == nullptr) {
             continue;
         }
         int parquet_col_id = _file_metadata->schema().get_column(read_col)->physical_column_index;
@@ -771,11 +801,10 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
         if (num_of_pages <= 0) {
             continue;
         }
-        auto& conjuncts = conjunct_iter->second;
         std::vector<int> skipped_page_range;
         const FieldSchema* col_schema = schema_desc.get_column(read_col);
         static_cast<void>(page_index.collect_skipped_page_range(
-                &column_index, conjuncts, col_schema, skipped_page_range, *_ctz));
+                &column_index, *value_range, col_schema, skipped_page_range, *_ctz));
         if (skipped_page_range.empty()) {
             continue;
         }
@@ -825,26 +854,34 @@ Status ParquetReader::_process_page_index(const tparquet::RowGroup& row_group,
 }
 
 Status ParquetReader::_process_row_group_filter(const tparquet::RowGroup& row_group,
+                                                const std::vector<std::string>& col_names,
                                                 bool* filter_group) {
-    static_cast<void>(_process_column_stat_filter(row_group.columns, filter_group));
+    static_cast<void>(_process_column_stat_filter(row_group.columns, col_names, filter_group));
     _init_chunk_dicts();
     RETURN_IF_ERROR(_process_dict_filter(filter_group));
     _init_bloom_filter();
-    RETURN_IF_ERROR(_process_bloom_filter(filter_group));
+    RETURN_IF_ERROR(_process_bloom_filter(row_group, col_names, filter_group));
     return Status::OK();
 }
 
 Status ParquetReader::_process_column_stat_filter(const std::vector<tparquet::ColumnChunk>& columns,
+                                                  const std::vector<std::string>& col_names,
                                                   bool* filter_group) {
     if (_colname_to_value_range == nullptr || _colname_to_value_range->empty()) {
         return Status::OK();
     }
     auto& schema_desc = _file_metadata->schema();
-    for (auto& col_name : _read_columns) {
-        auto slot_iter = _colname_to_value_range->find(col_name);
-        if (slot_iter == _colname_to_value_range->end()) {
+    for (auto& col_name : col_names) {
+        ColumnValueRangeType* value_range = _get_value_range(col_name);
+        if (value_range == nullptr) {
             continue;
         }
+        // the runtime filters may leave no values to read
+        if (std::visit([](auto&& range) { return range.is_empty_value_range(); },
+                       *value_range)) {
+            *filter_group = true;
+            break;
+        }
         int parquet_col_id = _file_metadata->schema().get_column(col_name)->physical_column_index;
         if (parquet_col_id < 0) {
             // complex type, not support filter yet.
@@ -863,11 +900,11 @@ Status ParquetReader::_process_column_stat_filter(const std::vector<tparquet::Co
         // Min-max of statistic is plain-encoded value
         if (statistic.__isset.min_value) {
             *filter_group = ParquetPredicate::filter_by_stats(
-                    slot_iter->second, col_schema, is_set_min_max, statistic.min_value,
+                    *value_range, col_schema, is_set_min_max, statistic.min_value,
                     statistic.max_value, is_all_null, *_ctz, true);
         } else {
             *filter_group = ParquetPredicate::filter_by_stats(
-                    slot_iter->second, col_schema, is_set_min_max, statistic.min, statistic.max,
+                    *value_range, col_schema, is_set_min_max, statistic.min, statistic.max,
                     is_all_null, *_ctz, false);
         }
         if (*filter_group) {
@@ -885,7 +922,157 @@ Status ParquetReader::_process_dict_filter(bool* filter_group) {
 
 void ParquetReader::_init_bloom_filter() {}
 
-Status ParquetReader::_process_bloom_filter(bool* filter_group) {
+// Appends the hashes of the fixed values of `range` in the parquet bloom filter, returns false
+// if the values can not be plain encoded as the physical type of the column.
+template <PrimitiveType T>
+static bool hash_fixed_values(const ColumnValueRange<T>& range, const FieldSchema* col_schema,
+                              std::vector<uint64_t>* hashes) {
+    if (!range.is_fixed_value_range()) {
+        return false;
+    }
+    if constexpr (T == TYPE_TINYINT || T == TYPE_SMALLINT || T == TYPE_INT) {
+        if (col_schema->type.type != T || col_schema->physical_type != tparquet::Type::INT32) {
+            return false;
+        }
+        for (const auto& value : range.get_fixed_value_set()) {
+            const auto plain_value = static_cast<int32_t>(value);
+            hashes->emplace_back(ParquetBloomFilter::hash(&plain_value, sizeof(plain_value)));
+        }
+        return true;
+    } else if constexpr (T == TYPE_BIGINT) {
+        if (col_schema->type.type != T || col_schema->physical_type != tparquet::Type::INT64) {
+            return false;
+        }
+        for (const auto& value : range.get_fixed_value_set()) {
+            hashes->emplace_back(ParquetBloomFilter::hash(&value, sizeof(value)));
+        }
+        return true;
+    } else if constexpr (T == TYPE_VARCHAR || T == TYPE_STRING) {
+        if (!is_string_type(col_schema->type.type) || col_schema->type.type == TYPE_CHAR ||
+            col_schema->physical_type != tparquet::Type::BYTE_ARRAY) {
+            return false;
+        }
+        for (const auto& value : range.get_fixed_value_set()) {
+            hashes->emplace_back(ParquetBloomFilter::hash(value.data, value.size));
+        }
+        return true;
+    } else {
+        return false;
+    }
+}
+
+Status ParquetReader::_process_bloom_filter(const tparquet::RowGroup& row_group,
+                                            const std::vector<std::string>& col_names,
+                                            bool* filter_group) {
+    if (*filter_group || !config::enable_parquet_bloom_filter_pruning ||
+        _colname_to_value_range == nullptr || _colname_to_value_range->empty()) {
+        return Status::OK();
+    }
+    auto& schema_desc = _file_metadata->schema();
+    for (auto& col_name : col_names) {
+        ColumnValueRangeType* value_range = _get_value_range(col_name);
+        if (value_range == nullptr) {
+            continue;
+        }
+        const FieldSchema* col_schema = schema_desc.get_column(col_name);
+        if (col_schema->physical_column_index < 0) {
+            continue;
+        }
+        auto& meta_data = row_group.columns[col_schema->physical_column_index].meta_data;
+        if (!meta_data.__isset.bloom_filter_offset) {
+            continue;
+        }
+        std::vector<uint64_t> hashes;
+        if (!std::visit([&](auto&& range) { return hash_fixed_values(range, col_schema, &hashes); },
+                        *value_range)) {
+            continue;
+        }
+        ParquetBloomFilter bloom_filter;
+        bool has_filter = false;
+        RETURN_IF_ERROR(bloom_filter.read(_file_reader, meta_data, _io_ctx, &has_filter,
+                                          &_column_statistics.read_bytes));
+        _column_statistics.meta_read_calls++;
+        if (has_filter && std::none_of(hashes.begin(), hashes.end(), [&](uint64_t hash) {
+                return bloom_filter.find_hash(hash);
+            })) {
+            *filter_group = true;
+            _statistics.bloom_filtered_row_groups++;
+            break;
+        }
+    }
+    return Status::OK();
+}
+
+void ParquetReader::_add_runtime_filter_value_ranges(const VExprContextSPtrs& conjuncts,
+                                                     std::vector<std::string>* narrowed_columns) {
+    if (_colname_to_value_range == nullptr) {
+        return;
+    }
+    for (const auto& conjunct : conjuncts) {
+        auto* runtime_filter = typeid_cast<VRuntimeFilterWrapper*>(conjunct->root().get());
+        // the null aware filters keep the rows of null
+        if (runtime_filter == nullptr || runtime_filter->null_aware() ||
+            _runtime_filter_conjuncts.contains(conjunct->root())) {
+            continue;
+        }
+        const VExprSPtr& impl = runtime_filter->get_impl();
+        if (impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        std::string col_name = impl->children()[0]->expr_name();
+        auto file_col_iter = _table_col_to_file_col.find(col_name);
+        if (file_col_iter != _table_col_to_file_col.end()) {
+            col_name = file_col_iter->second;
+        }
+        auto range_iter = _runtime_filter_value_ranges.find(col_name);
+        if (range_iter == _runtime_filter_value_ranges.end()) {
+            auto conjunct_iter = _colname_to_value_range->find(col_name);
+            if (conjunct_iter == _colname_to_value_range->end()) {
+                continue;
+            }
+            range_iter =
+                    _runtime_filter_value_ranges.emplace(col_name, conjunct_iter->second).first;
+        }
+        bool narrowed = std::visit(
+                [&](auto&& range) { return narrow_by_runtime_filter(range, impl.get()); },
+                range_iter->second);
+        if (!narrowed) {
+            continue;
+        }
+        _runtime_filter_conjuncts.emplace(conjunct->root());
+        if (std::find(narrowed_columns->begin(), narrowed_columns->end(), col_name) ==
+            narrowed_columns->end()) {
+            narrowed_columns->emplace_back(col_name);
+        }
+    }
+}
+
+ColumnValueRangeType* ParquetReader::_get_value_range(const std::string& col_name) {
+    auto range_iter = _runtime_filter_value_ranges.find(col_name);
+    if (range_iter != _runtime_filter_value_ranges.end()) {
+        return &range_iter->second;
+    }
+    auto conjunct_iter = _colname_to_value_range->find(col_name);
+    if (conjunct_iter != _colname_to_value_range->end()) {
+        return &conjunct_iter->second;
+    }
+    return nullptr;
+}
+
+Status ParquetReader::set_late_arrival_runtime_filters(const VExprContextSPtrs& conjuncts) {
+    if (!config::enable_late_arrival_runtime_filter_page_pruning || _t_metadata == nullptr) {
+        return Status::OK();
+    }
+    std::vector<std::string> narrowed_columns;
+    _add_runtime_filter_value_ranges(conjuncts, &narrowed_columns);
+    for (auto& col_name : narrowed_columns) {
+        if (std::find(_read_columns.begin(), _read_columns.end(), col_name) !=
+                    _read_columns.end() &&
+            std::find(_late_arrival_columns.begin(), _late_arrival_columns.end(), col_name) ==
+                    _late_arrival_columns.end()) {
+            _late_arrival_columns.emplace_back(col_name);
+        }
+    }
     return Status::OK();
 }
 
@@ -906,6 +1093,10 @@ void ParquetReader::_collect_profile() {
         _current_group_reader->collect_profile_before_close();
     }
     COUNTER_UPDATE(_parquet_profile.filtered_row_groups, _statistics.filtered_row_groups);
+    COUNTER_UPDATE(_parquet_profile.bloom_filtered_row_groups,
+                   _statistics.bloom_filtered_row_groups);
+    COUNTER_UPDATE(_parquet_profile.late_rf_filtered_row_groups,
+                   _statistics.late_rf_filtered_row_groups);
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
@@ -89,6 +89,8 @@ public:
         int64_t open_file_num = 0;
         int64_t row_group_filter_time = 0;
         int64_t page_index_filter_time = 0;
+        int32_t bloom_filtered_row_groups = 0;
+        int32_t late_rf_filtered_row_groups = 0;
     };
 
     ParquetReader(RuntimeProfile* profile, const TFileScanRangeParams& params,
@@ -120,6 +122,8 @@ public:
 
     Status close() override;
 
+    Status set_late_arrival_runtime_filters(const VExprContextSPtrs& conjuncts) override;
+
     RowRange get_whole_range() { return _whole_range; }
 
     // set the delete rows in current parquet file
@@ -170,6 +174,8 @@ private:
         RuntimeProfile::Counter* open_file_num = nullptr;
         RuntimeProfile::Counter* row_group_filter_time = nullptr;
         RuntimeProfile::Counter* page_index_filter_time = nullptr;
+        RuntimeProfile::Counter* bloom_filtered_row_groups = nullptr;
+        RuntimeProfile::Counter* late_rf_filtered_row_groups = nullptr;
 
         RuntimeProfile::Counter* file_read_time = nullptr;
         RuntimeProfile::Counter* file_read_calls = nullptr;
@@ -204,12 +210,24 @@ private:
     // Row Group Filter
     bool _is_misaligned_range_group(const tparquet::RowGroup& row_group);
     Status _process_column_stat_filter(const std::vector<tparquet::ColumnChunk>& column_meta,
+                                       const std::vector<std::string>& col_names,
                                        bool* filter_group);
-    Status _process_row_group_filter(const tparquet::RowGroup& row_group, bool* filter_group);
+    Status _process_row_group_filter(const tparquet::RowGroup& row_group,
+                                     const std::vector<std::string>& col_names,
+                                     bool* filter_group);
     void _init_chunk_dicts();
     Status _process_dict_filter(bool* filter_group);
     void _init_bloom_filter();
-    Status _process_bloom_filter(bool* filter_group);
+    // Filters the row group if none of the fixed values of a column is in its bloom filter.
+    Status _process_bloom_filter(const tparquet::RowGroup& row_group,
+                                 const std::vector<std::string>& col_names, bool* filter_group);
+    // Narrows the value ranges of the columns by the IN and min/max runtime filters in
+    // `conjuncts`, the names of the narrowed columns are appended to `narrowed_columns`.
+    void _add_runtime_filter_value_ranges(const VExprContextSPtrs& conjuncts,
+                                          std::vector<std::string>* narrowed_columns);
+    // The value range of the column narrowed by the runtime filters if there is one, otherwise
+    // the value range of the pushed down conjuncts.
+    ColumnValueRangeType* _get_value_range(const std::string& col_name);
     int64_t _get_column_start_offset(const tparquet::ColumnMetaData& column_init_column_readers);
     std::string _meta_cache_key(const std::string& path) { return "meta_" + path; }
     std::vector<io::PrefetchRange> _generate_random_access_ranges(
@@ -243,6 +261,14 @@ private:
     // table column name to file column name map. For iceberg schema evolution.
     std::unordered_map<std::string, std::string> _table_col_to_file_col;
     std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
+    // the value ranges of `_colname_to_value_range` intersected with the runtime filters
+    std::unordered_map<std::string, ColumnValueRangeType> _runtime_filter_value_ranges;
+    // the runtime filters applied to `_runtime_filter_value_ranges`, the fixed values of the
+    // ranges point into them
+    std::unordered_set<VExprSPtr> _runtime_filter_conjuncts;
+    // the columns narrowed by the late arrival runtime filters, the row groups which are not
+    // read yet are filtered by them again
+    std::vector<std::string> _late_arrival_columns;
     std::vector<std::string> _read_columns;
     RowRange _whole_range = RowRange(0, 0);
     const std::vector<int64_t>* _delete_rows = nullptr;
@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Opcodes_types.h>
+
+#include <cstring>
+#include <type_traits>
+
+#include "common/config.h"
+#include "exec/olap_common.h"
+#include "exec/olap_utils.h"
+#include "exprs/hybrid_set.h"
+#include "runtime/primitive_type.h"
+#include "vec/common/string_ref.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vliteral.h"
+
+namespace doris::vectorized {
+
+// Intersects `range` with the IN or min/max runtime filter `impl`, returns false if the filter
+// is not supported. Only the types whose values in the runtime filters have the same layout as
+// the ones of the ColumnValueRange are supported.
+template <PrimitiveType T>
+bool narrow_by_runtime_filter(ColumnValueRange<T>& range, const VExpr* impl) {
+    using CppType = typename PrimitiveTypeTraits<T>::CppType;
+    if constexpr (T == TYPE_TINYINT || T == TYPE_SMALLINT || T == TYPE_INT || T == TYPE_BIGINT ||
+                  T == TYPE_LARGEINT || T == TYPE_DATEV2 || T == TYPE_DATETIMEV2 ||
+                  T == TYPE_DECIMAL32 || T == TYPE_DECIMAL64 || T == TYPE_DECIMAL128I ||
+                  T == TYPE_DECIMAL256 || T == TYPE_VARCHAR || T == TYPE_STRING) {
+        if (impl->node_type() == TExprNodeType::IN_PRED) {
+            auto hybrid_set = impl->get_set_func();
+            if (hybrid_set == nullptr || hybrid_set->contain_null() ||
+                hybrid_set->size() > config::max_pushdown_conditions_per_column) {
+                return false;
+            }
+            auto in_range = ColumnValueRange<T>::create_empty_column_value_range(
+                    range.is_nullable_col(), range.precision(), range.scale());
+            HybridSetBase::IteratorBase* iter = hybrid_set->begin();
+            for (; iter->has_next(); iter->next()) {
+                const auto* value = reinterpret_cast<const CppType*>(iter->get_value());
+                static_cast<void>(in_range.add_fixed_value(*value));
+            }
+            range.intersection(in_range);
+            return true;
+        }
+        if (impl->node_type() != TExprNodeType::BINARY_PRED || impl->children().size() != 2 ||
+            (impl->op() != TExprOpcode::GE && impl->op() != TExprOpcode::LE)) {
+            return false;
+        }
+        const auto* literal = dynamic_cast<const VLiteral*>(impl->children()[1].get());
+        if (literal == nullptr) {
+            return false;
+        }
+        StringRef data = literal->get_column_ptr()->get_data_at(0);
+        if (data.data == nullptr) {
+            return false;
+        }
+        CppType value;
+        if constexpr (std::is_same_v<CppType, StringRef>) {
+            value = data;
+        } else {
+            if (data.size != sizeof(CppType)) {
+                return false;
+            }
+            memcpy(&value, data.data, sizeof(CppType));
+        }
+        auto op = impl->op() == TExprOpcode::GE ? FILTER_LARGER_OR_EQUAL : FILTER_LESS_OR_EQUAL;
+        return range.add_range(op, value).ok();
+    } else {
+        return false;
+    }
+}
+
+} // namespace doris::vectorized
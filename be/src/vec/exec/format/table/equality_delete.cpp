@@ -17,6 +17,12 @@
 
 #include "vec/exec/format/table/equality_delete.h"
 
+#include <algorithm>
+
+#include "vec/common/hash_table/hash_map_context_creator.h"
+#include "vec/common/hash_table/partitioned_hash_map.h"
+#include "vec/utils/template_helpers.hpp"
+
 namespace doris::vectorized {
 
 std::unique_ptr<EqualityDeleteBase> EqualityDeleteBase::get_delete_impl(Block* delete_block) {
@@ -52,12 +58,8 @@ Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
         return Status::InternalError("Not support type change in column '{}'", _delete_column_name);
     }
     size_t rows = data_block->rows();
-    // _filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 0);
-    } else {
-        _filter->resize_fill(rows, 0);
-    }
+    // filter: 1 => in _hybrid_set; 0 => not in _hybrid_set
+    IColumn::Filter filter(rows, 0);
 
     if (column_and_type->column->is_nullable()) {
         const NullMap& null_map =
@@ -65,96 +67,142 @@ Status SimpleEqualityDelete::filter_data_block(Block* data_block) {
                         ->get_null_map_data();
         _hybrid_set->find_batch_nullable(
                 remove_nullable(column_and_type->column)->assume_mutable_ref(), rows, null_map,
-                *_filter.get());
+                filter);
         if (_hybrid_set->contain_null()) {
-            auto* filter_data = _filter->data();
+            auto* filter_data = filter.data();
             for (size_t i = 0; i < rows; ++i) {
                 filter_data[i] = filter_data[i] || null_map[i];
             }
         }
     } else {
-        _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows,
-                                *_filter.get());
+        _hybrid_set->find_batch(column_and_type->column->assume_mutable_ref(), rows, filter);
     }
-    // should reverse _filter
-    auto* filter_data = _filter->data();
+    // should reverse filter
+    auto* filter_data = filter.data();
     for (size_t i = 0; i < rows; ++i) {
         filter_data[i] = !filter_data[i];
     }
 
-    Block::filter_block_internal(data_block, *_filter.get(), data_block->columns());
+    Block::filter_block_internal(data_block, filter, data_block->columns());
     return Status::OK();
 }
 
 Status MultiEqualityDelete::_build_set() {
     COUNTER_UPDATE(num_delete_rows, _delete_block->rows());
     size_t rows = _delete_block->rows();
-    _delete_hashes.clear();
-    _delete_hashes.resize(rows, 0);
-    for (ColumnPtr column : _delete_block->get_columns()) {
-        column->update_hashes_with_value(_delete_hashes.data(), nullptr);
+    std::vector<DataTypePtr> data_types;
+    ColumnRawPtrs key_columns;
+    for (const auto& column_and_type : *_delete_block) {
+        data_types.emplace_back(column_and_type.type);
+        key_columns.emplace_back(column_and_type.column.get());
     }
-    for (size_t i = 0; i < rows; ++i) {
-        _delete_hash_map.insert({_delete_hashes[i], i});
+    if (!try_get_hash_map_context_fixed<PHNormalHashMap, HashCRC32, char*>(_hash_table_variants,
+                                                                           data_types)) {
+        _hash_table_variants.emplace<SerializedHashTableContext>();
     }
-    _data_column_index.resize(_delete_block->columns());
-    return Status::OK();
+
+    if (rows >= PROBE_FILTER_MIN_ROWS) {
+        // about 8 bits per key
+        int log_space_bytes = std::min(64 - __builtin_clzll(rows - 1), PROBE_FILTER_MAX_LOG_BYTES);
+        auto filter = std::make_unique<BlockBloomFilter>();
+        RETURN_IF_ERROR(filter->init(log_space_bytes, 0));
+        _probe_filter = std::move(filter);
+    }
+
+    return std::visit(
+            Overload {[&](std::monostate&) -> Status {
+                          return Status::InternalError("Uninited hash table of equality delete");
+                      },
+                      [&](auto& build_ctx) -> Status {
+                          // the build keys are kept by the context until it's destroyed
+                          build_ctx.init_serialized_keys(key_columns, rows, nullptr, false, true);
+                          auto& hash_table = *build_ctx.hash_table;
+                          hash_table.expanse_for_add_elem(rows);
+                          for (size_t i = 0; i < rows; ++i) {
+                              typename std::decay_t<decltype(hash_table)>::LookupResult it;
+                              bool inserted;
+                              hash_table.emplace(build_ctx.keys[i], it, inserted,
+                                                 build_ctx.hash_values[i]);
+                              if (_probe_filter != nullptr) {
+                                  _probe_filter->insert(
+                                          _probe_filter_hash(build_ctx.hash_values[i]));
+                              }
+                          }
+                          return Status::OK();
+                      }},
+            _hash_table_variants);
 }
 
-Status MultiEqualityDelete::filter_data_block(Block* data_block) {
-    SCOPED_TIMER(equality_delete_time);
-    size_t column_index = 0;
-    for (string column_name : _delete_block->get_names()) {
-        auto* column_and_type = data_block->try_get_by_name(column_name);
-        if (column_and_type == nullptr) {
-            return Status::InternalError("Can't find the delete column '{}' in data file",
-                                         column_name);
-        }
-        if (!_delete_block->get_by_name(column_name).type->equals(*column_and_type->type)) {
-            return Status::InternalError("Not support type change in column '{}'", column_name);
+template <typename HashTableContext>
+void MultiEqualityDelete::_find_batch(HashTableContext& build_ctx,
+                                      const ColumnRawPtrs& data_columns, size_t rows,
+                                      IColumn::Filter& filter) {
+    // The probe keys are serialized by a context of the caller, which shares the built hash
+    // table, because the build context may be used by other readers concurrently.
+    auto probe_ctx = [&]() {
+        if constexpr (requires { build_ctx.key_sizes; }) {
+            return HashTableContext(build_ctx.key_sizes);
+        } else {
+            return HashTableContext();
         }
-        _data_column_index[column_index++] = data_block->get_position_by_name(column_name);
-    }
-    size_t rows = data_block->rows();
-    _data_hashes.clear();
-    _data_hashes.resize(rows, 0);
-    for (size_t index : _data_column_index) {
-        data_block->get_by_position(index).column->update_hashes_with_value(_data_hashes.data(),
-                                                                            nullptr);
-    }
+    }();
+    probe_ctx.hash_table = build_ctx.hash_table;
+    probe_ctx.init_serialized_keys(data_columns, rows);
 
-    if (_filter == nullptr) {
-        _filter = std::make_unique<IColumn::Filter>(rows, 1);
-    } else {
-        _filter->resize_fill(rows, 1);
-    }
-    auto* filter_data = _filter->data();
-    for (size_t i = 0; i < rows; ++i) {
-        for (auto beg = _delete_hash_map.lower_bound(_data_hashes[i]),
-                  end = _delete_hash_map.upper_bound(_data_hashes[i]);
-             beg != end; ++beg) {
-            if (_equal(data_block, i, beg->second)) {
-                filter_data[i] = 0;
-                break;
+    // the rows which may be deleted
+    std::vector<uint32_t> candidates;
+    candidates.reserve(rows);
+    if (_probe_filter != nullptr) {
+        for (uint32_t i = 0; i < rows; ++i) {
+            if (_probe_filter->find(_probe_filter_hash(probe_ctx.hash_values[i]))) {
+                candidates.push_back(i);
             }
         }
+    } else {
+        for (uint32_t i = 0; i < rows; ++i) {
+            candidates.push_back(i);
+        }
     }
 
-    Block::filter_block_internal(data_block, *_filter.get(), data_block->columns());
-    return Status::OK();
+    auto& hash_table = *probe_ctx.hash_table;
+    auto* filter_data = filter.data();
+    const size_t num_candidates = candidates.size();
+    for (size_t k = 0; k < num_candidates; ++k) {
+        if (k + HASH_MAP_PREFETCH_DIST < num_candidates) {
+            uint32_t row = candidates[k + HASH_MAP_PREFETCH_DIST];
+            hash_table.template prefetch<true>(probe_ctx.keys[row], probe_ctx.hash_values[row]);
+        }
+        uint32_t row = candidates[k];
+        if (hash_table.find(probe_ctx.keys[row], probe_ctx.hash_values[row]) != nullptr) {
+            filter_data[row] = 0;
+        }
+    }
 }
 
-bool MultiEqualityDelete::_equal(Block* data_block, size_t data_row_index,
-                                 size_t delete_row_index) {
-    for (size_t i = 0; i < _delete_block->columns(); ++i) {
-        ColumnPtr data_col = data_block->get_by_position(_data_column_index[i]).column;
-        ColumnPtr delete_col = _delete_block->get_by_position(i).column;
-        if (data_col->compare_at(data_row_index, delete_row_index, delete_col->assume_mutable_ref(),
-                                 -1) != 0) {
-            return false;
+Status MultiEqualityDelete::filter_data_block(Block* data_block) {
+    SCOPED_TIMER(equality_delete_time);
+    ColumnRawPtrs data_columns;
+    for (const auto& delete_column : *_delete_block) {
+        auto* column_and_type = data_block->try_get_by_name(delete_column.name);
+        if (column_and_type == nullptr) {
+            return Status::InternalError("Can't find the delete column '{}' in data file",
+                                         delete_column.name);
+        }
+        if (!delete_column.type->equals(*column_and_type->type)) {
+            return Status::InternalError("Not support type change in column '{}'",
+                                         delete_column.name);
         }
+        data_columns.emplace_back(column_and_type->column.get());
     }
-    return true;
+
+    size_t rows = data_block->rows();
+    IColumn::Filter filter(rows, 1);
+    std::visit(Overload {[&](std::monostate&) {},
+                         [&](auto& build_ctx) { _find_batch(build_ctx, data_columns, rows, filter); }},
+               _hash_table_variants);
+
+    Block::filter_block_internal(data_block, filter, data_block->columns());
+    return Status::OK();
 }
 
 } // namespace doris::vectorized
@@ -15,8 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <memory>
+#include <variant>
+
+#include "exprs/block_bloom_filter.hpp"
 #include "exprs/create_predicate_function.h"
 #include "util/runtime_profile.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
 #include "vec/core/block.h"
 
 namespace doris::vectorized {
@@ -26,8 +32,9 @@ namespace doris::vectorized {
  * If there's only one delete column in delete file, use `SimpleEqualityDelete`,
  * which uses optimized `HybridSetBase` to build the hash set.
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
- * which generates a hash column from all delete columns, and only compare the values
- * when the hash values are the same.
+ * which builds a hash set of the delete keys with the hash table contexts of join.
+ * The delete set is read only once it's built, so `filter_data_block` can be called concurrently
+ * by the readers which share it.
  */
 class EqualityDeleteBase {
 protected:
@@ -65,7 +72,6 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
@@ -76,30 +82,55 @@ public:
 };
 
 /**
- * `MultiEqualityDelete` will generate the hash column for delete block and data block.
+ * `MultiEqualityDelete` packs the delete columns of a row into a fixed size key by `MethodKeysFixed`
+ * if they fit in 32 bytes, otherwise serializes them by `MethodSerialized`, and probes the data
+ * rows in batches. A large delete set has a bloom filter of the key hashes in front of the hash
+ * table, so the data rows which are not deleted, usually most of them, skip the random access
+ * to the hash table.
  */
 class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
-    // hash column for delete block
-    std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
-    // hash code => row index
-    // if hash values are equal, then compare the real values
-    // the row index records the row number of the delete row in delete block
-    std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
+    template <typename Key, bool has_null>
+    using FixedKeyHashTableContext =
+            MethodKeysFixed<PHHashMap<Key, char*, HashCRC32<Key>>, has_null>;
+    using SerializedHashTableContext = MethodSerialized<PHHashMap<StringRef, char*>>;
+    using HashTableVariants =
+            std::variant<std::monostate, SerializedHashTableContext,
+                         FixedKeyHashTableContext<UInt64, true>,
+                         FixedKeyHashTableContext<UInt64, false>,
+                         FixedKeyHashTableContext<UInt128, true>,
+                         FixedKeyHashTableContext<UInt128, false>,
+                         FixedKeyHashTableContext<UInt136, true>,
+                         FixedKeyHashTableContext<UInt136, false>,
+                         FixedKeyHashTableContext<UInt256, true>,
+                         FixedKeyHashTableContext<UInt256, false>>;
+
+    // the delete keys, built by the delete block
+    HashTableVariants _hash_table_variants;
+    // nullptr if the delete set is smaller than PROBE_FILTER_MIN_ROWS
+    std::unique_ptr<BlockBloomFilter> _probe_filter;
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    template <typename HashTableContext>
+    void _find_batch(HashTableContext& build_ctx, const ColumnRawPtrs& data_columns, size_t rows,
+                     IColumn::Filter& filter);
+
+    static uint32_t _probe_filter_hash(size_t hash) {
+        return static_cast<uint32_t>(hash ^ (hash >> 32));
+    }
 
 public:
+    // The hash table is larger than the L2 cache from about so many keys.
+    static constexpr size_t PROBE_FILTER_MIN_ROWS = 1 << 16;
+    // 16MB at most, to stay in the cache
+    static constexpr int PROBE_FILTER_MAX_LOG_BYTES = 24;
+
     MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
 
     Status filter_data_block(Block* data_block) override;
+
+    bool has_probe_filter() const { return _probe_filter != nullptr; }
 };
 
 } // namespace doris::vectorized
@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/iceberg_position_delete_cache.h"
+
+#include "runtime/exec_env.h"
+
+namespace doris::vectorized {
+
+IcebergPositionDeleteCache* IcebergPositionDeleteCache::instance() {
+    return ExecEnv::GetInstance()->get_iceberg_position_delete_cache();
+}
+
+std::shared_ptr<const IcebergPositionDeleteCache::PositionDeletes>
+IcebergPositionDeleteCache::lookup_deletes(const std::string& delete_file_path) {
+    auto* lru_handle = lookup(delete_file_path);
+    if (lru_handle == nullptr) {
+        return nullptr;
+    }
+    // The value keeps a reference of the deletes, so it is safe to release the handle.
+    auto deletes = ((CacheValue*)LRUCachePolicy::value(lru_handle))->deletes;
+    release(lru_handle);
+    return deletes;
+}
+
+void IcebergPositionDeleteCache::insert_deletes(const std::string& delete_file_path,
+                                                std::shared_ptr<const PositionDeletes> deletes) {
+    size_t bytes = sizeof(PositionDeletes);
+    for (const auto& [data_file_path, positions] : *deletes) {
+        bytes += data_file_path.capacity() + positions.capacity() * sizeof(int64_t);
+    }
+    auto* value = new CacheValue(std::move(deletes));
+    auto* lru_handle = insert(delete_file_path, value, bytes, bytes, CachePriority::NORMAL);
+    release(lru_handle);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/config.h"
+#include "runtime/memory/lru_cache_policy.h"
+
+namespace doris::vectorized {
+
+// Caches the parsed rows of iceberg position delete files across scanners and queries, keyed by
+// the path of the delete file. A delete file is immutable once committed, so an entry never goes
+// stale. Each entry holds the sorted deleted positions of every data file the delete file
+// refers to, so that a data file with no rows in it is known to have no deletes without reading
+// the file again.
+class IcebergPositionDeleteCache : public LRUCachePolicy {
+public:
+    // data file path -> the sorted deleted positions in it
+    using PositionDeletes = std::unordered_map<std::string, std::vector<int64_t>>;
+
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        explicit CacheValue(std::shared_ptr<const PositionDeletes> deletes_)
+                : LRUCacheValueBase(CachePolicy::CacheType::ICEBERG_POSITION_DELETE_CACHE),
+                  deletes(std::move(deletes_)) {}
+
+        std::shared_ptr<const PositionDeletes> deletes;
+    };
+
+    IcebergPositionDeleteCache(size_t capacity, uint32_t num_shards)
+            : LRUCachePolicy(CachePolicy::CacheType::ICEBERG_POSITION_DELETE_CACHE, capacity,
+                             LRUCacheType::SIZE,
+                             config::iceberg_position_delete_cache_stale_sweep_time_sec,
+                             num_shards) {}
+
+    // A miss reads and parses the delete file again, usually from remote storage.
+    double refill_cost_per_byte() override { return 4.0; }
+
+    // Returns nullptr if the cache is disabled.
+    static IcebergPositionDeleteCache* instance();
+
+    // Returns nullptr if the delete file is not cached.
+    std::shared_ptr<const PositionDeletes> lookup_deletes(const std::string& delete_file_path);
+
+    void insert_deletes(const std::string& delete_file_path,
+                        std::shared_ptr<const PositionDeletes> deletes);
+};
+
+} // namespace doris::vectorized
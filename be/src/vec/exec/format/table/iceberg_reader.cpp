@@ -95,6 +95,8 @@ IcebergTableReader::IcebergTableReader(std::unique_ptr<GenericReader> file_forma
             ADD_CHILD_TIMER(_profile, "DeleteFileReadTime", iceberg_profile);
     _iceberg_profile.delete_rows_sort_time =
             ADD_CHILD_TIMER(_profile, "DeleteRowsSortTime", iceberg_profile);
+    _iceberg_profile.delete_file_cache_hits =
+            ADD_CHILD_COUNTER(_profile, "DeleteFileCacheHits", TUnit::UNIT, iceberg_profile);
 }
 
 Status IcebergTableReader::get_next_block(Block* block, size_t* read_rows, bool* eof) {
@@ -143,8 +145,8 @@ Status IcebergTableReader::get_next_block(Block* block, size_t* read_rows, bool*
         block->initialize_index_by_name();
     }
 
-    if (_equality_delete_impl != nullptr) {
-        RETURN_IF_ERROR(_equality_delete_impl->filter_data_block(block));
+    if (_equality_delete_set != nullptr) {
+        RETURN_IF_ERROR(_equality_delete_set->impl->filter_data_block(block));
         *read_rows = block->rows();
     }
     return res;
@@ -202,6 +204,42 @@ Status IcebergTableReader::init_row_filters(const TFileRangeDesc& range) {
 
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    Status create_status = Status::OK();
+    _equality_delete_set = _kv_cache->get<EqualityDeleteSet>(
+            _equality_delete_cache_key(delete_files), [&]() -> EqualityDeleteSet* {
+                auto delete_set = std::make_unique<EqualityDeleteSet>();
+                create_status =
+                        _read_equality_delete_files(delete_files, &delete_set->delete_block);
+                if (!create_status.ok()) {
+                    return nullptr;
+                }
+                delete_set->impl = EqualityDeleteBase::get_delete_impl(&delete_set->delete_block);
+                create_status = delete_set->impl->init(_profile);
+                if (!create_status.ok()) {
+                    return nullptr;
+                }
+                return delete_set.release();
+            });
+    return create_status;
+}
+
+std::string IcebergTableReader::_equality_delete_cache_key(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    std::vector<std::string> paths;
+    paths.reserve(delete_files.size());
+    for (const auto& delete_file : delete_files) {
+        paths.emplace_back(delete_file.path);
+    }
+    std::sort(paths.begin(), paths.end());
+    std::string key = "equality_delete";
+    for (const auto& path : paths) {
+        key.append("_").append(path);
+    }
+    return key;
+}
+
+Status IcebergTableReader::_read_equality_delete_files(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, Block* delete_block) {
     bool init_schema = false;
     std::vector<std::string> equality_delete_col_names;
     std::vector<TypeDescriptor> equality_delete_col_types;
@@ -222,7 +260,7 @@ Status IcebergTableReader::_equality_delete_base(
         if (!init_schema) {
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
+            _generate_equality_delete_block(delete_block, equality_delete_col_names,
                                             equality_delete_col_types);
             init_schema = true;
         }
@@ -248,13 +286,12 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    return Status::OK();
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
@@ -281,22 +318,34 @@ Status IcebergTableReader::_position_delete_base(
         }
     }
 
-    std::vector<DeleteRows*> delete_rows_array;
+    std::vector<const DeleteRows*> delete_rows_array;
     int64_t num_delete_rows = 0;
     std::vector<DeleteFile*> erase_data;
+    // keeps the cached rows in delete_rows_array alive until they are sorted
+    std::vector<std::shared_ptr<const IcebergPositionDeleteCache::PositionDeletes>> cached_deletes;
+    auto* position_delete_cache = IcebergPositionDeleteCache::instance();
     for (auto& delete_file : delete_files) {
         SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
+        if (position_delete_cache != nullptr) {
+            std::shared_ptr<const IcebergPositionDeleteCache::PositionDeletes> deletes;
+            RETURN_IF_ERROR(_get_cached_position_deletes(position_delete_cache, delete_file.path,
+                                                         &deletes));
+            if (deletes == nullptr) {
+                continue;
+            }
+            auto iter = deletes->find(data_file_path);
+            if (iter != deletes->end() && !iter->second.empty()) {
+                delete_rows_array.emplace_back(&iter->second);
+                num_delete_rows += iter->second.size();
+                cached_deletes.emplace_back(std::move(deletes));
+            }
+            continue;
+        }
         Status create_status = Status::OK();
         auto* delete_file_cache = _kv_cache->get<DeleteFile>(
                 _delet_file_cache_key(delete_file.path), [&]() -> DeleteFile* {
                     auto* position_delete = new DeleteFile;
-                    TFileRangeDesc delete_file_range;
-                    // must use __set() method to make sure __isset is true
-                    delete_file_range.__set_fs_name(_range.fs_name);
-                    delete_file_range.path = delete_file.path;
-                    delete_file_range.start_offset = 0;
-                    delete_file_range.size = -1;
-                    delete_file_range.file_size = -1;
+                    TFileRangeDesc delete_file_range = _delete_file_range(delete_file.path);
                     //read position delete file base on delete_file_range , generate DeleteFile , add DeleteFile to kv_cache
                     create_status = _read_position_delete_file(&delete_file_range, position_delete);
 
@@ -336,6 +385,42 @@ Status IcebergTableReader::_position_delete_base(
     return Status::OK();
 }
 
+TFileRangeDesc IcebergTableReader::_delete_file_range(const std::string& delete_file_path) {
+    TFileRangeDesc delete_file_range;
+    // must use __set() method to make sure __isset is true
+    delete_file_range.__set_fs_name(_range.fs_name);
+    delete_file_range.path = delete_file_path;
+    delete_file_range.start_offset = 0;
+    delete_file_range.size = -1;
+    delete_file_range.file_size = -1;
+    return delete_file_range;
+}
+
+Status IcebergTableReader::_get_cached_position_deletes(
+        IcebergPositionDeleteCache* cache, const std::string& delete_file_path,
+        std::shared_ptr<const IcebergPositionDeleteCache::PositionDeletes>* deletes) {
+    *deletes = cache->lookup_deletes(delete_file_path);
+    if (*deletes != nullptr) {
+        COUNTER_UPDATE(_iceberg_profile.delete_file_cache_hits, 1);
+        return Status::OK();
+    }
+    DeleteFile position_delete;
+    TFileRangeDesc delete_file_range = _delete_file_range(delete_file_path);
+    Status st = _read_position_delete_file(&delete_file_range, &position_delete);
+    if (st.is<ErrorCode::END_OF_FILE>()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(st);
+    auto parsed_deletes = std::make_shared<IcebergPositionDeleteCache::PositionDeletes>();
+    parsed_deletes->reserve(position_delete.size());
+    for (auto& [data_file_path, delete_rows] : position_delete) {
+        (*parsed_deletes)[data_file_path] = std::move(*delete_rows);
+    }
+    *deletes = parsed_deletes;
+    cache->insert_deletes(delete_file_path, std::move(parsed_deletes));
+    return Status::OK();
+}
+
 IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
         const ColumnDictI32& file_path_column) {
     IcebergTableReader::PositionDeleteRange range;
@@ -378,8 +463,8 @@ IcebergTableReader::PositionDeleteRange IcebergTableReader::_get_range(
     return range;
 }
 
-void IcebergTableReader::_sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
-                                           int64_t num_delete_rows) {
+void IcebergTableReader::_sort_delete_rows(
+        std::vector<const std::vector<int64_t>*>& delete_rows_array, int64_t num_delete_rows) {
     if (delete_rows_array.empty()) {
         return;
     }
@@ -397,7 +482,8 @@ void IcebergTableReader::_sort_delete_rows(std::vector<std::vector<int64_t>*>& d
         return;
     }
 
-    using vec_pair = std::pair<std::vector<int64_t>::iterator, std::vector<int64_t>::iterator>;
+    using vec_pair = std::pair<std::vector<int64_t>::const_iterator,
+                               std::vector<int64_t>::const_iterator>;
     _iceberg_delete_rows.resize(num_delete_rows);
     auto row_id_iter = _iceberg_delete_rows.begin();
     auto iter_end = _iceberg_delete_rows.end();
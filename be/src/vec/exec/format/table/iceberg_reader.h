@@ -38,6 +38,7 @@
 #include "vec/exec/format/orc/vorc_reader.h"
 #include "vec/exec/format/parquet/vparquet_reader.h"
 #include "vec/exec/format/table/equality_delete.h"
+#include "vec/exec/format/table/iceberg_position_delete_cache.h"
 #include "vec/exprs/vslot_ref.h"
 
 namespace tparquet {
@@ -105,6 +106,7 @@ protected:
         RuntimeProfile::Counter* num_delete_rows;
         RuntimeProfile::Counter* delete_files_read_time;
         RuntimeProfile::Counter* delete_rows_sort_time;
+        RuntimeProfile::Counter* delete_file_cache_hits;
     };
     using DeleteRows = std::vector<int64_t>;
     using DeleteFile = phmap::parallel_flat_hash_map<
@@ -118,7 +120,7 @@ protected:
      * Sorting by file_path allows filter pushdown by file in columnar storage formats.
      * Sorting by position allows filtering rows while scanning, to avoid keeping deletes in memory.
      */
-    void _sort_delete_rows(std::vector<std::vector<int64_t>*>& delete_rows_array,
+    void _sort_delete_rows(std::vector<const std::vector<int64_t>*>& delete_rows_array,
                            int64_t num_delete_rows);
 
     PositionDeleteRange _get_range(const ColumnDictI32& file_path_column);
@@ -131,6 +133,12 @@ protected:
     static std::string _delet_file_cache_key(const std::string& path) { return "delete_" + path; }
 
     Status _position_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    TFileRangeDesc _delete_file_range(const std::string& delete_file_path);
+    // Gets the parsed rows of a position delete file from the BE wide cache, reads and caches it
+    // on a miss. `deletes` is nullptr if the delete file is empty.
+    Status _get_cached_position_deletes(
+            IcebergPositionDeleteCache* cache, const std::string& delete_file_path,
+            std::shared_ptr<const IcebergPositionDeleteCache::PositionDeletes>* deletes);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
@@ -185,8 +193,18 @@ protected:
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
     // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    // The rows of the equality delete files and the delete set built from them, cached in
+    // `_kv_cache` and shared by the splits with the same delete files.
+    struct EqualityDeleteSet {
+        Block delete_block;
+        std::unique_ptr<EqualityDeleteBase> impl;
+    };
+    static std::string _equality_delete_cache_key(
+            const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    Status _read_equality_delete_files(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                       Block* delete_block);
+    // owned by `_kv_cache`
+    EqualityDeleteSet* _equality_delete_set = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
@@ -55,6 +55,10 @@ public:
         return _file_format_reader->get_parsed_schema(col_names, col_types);
     }
 
+    Status set_late_arrival_runtime_filters(const VExprContextSPtrs& conjuncts) override {
+        return _file_format_reader->set_late_arrival_runtime_filters(conjuncts);
+    }
+
     virtual Status init_row_filters(const TFileRangeDesc& range) = 0;
 
 protected:
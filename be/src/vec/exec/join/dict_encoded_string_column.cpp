@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/join/dict_encoded_string_column.h"
+
+#include <parallel_hashmap/phmap.h>
+
+#include <limits>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/string_ref.h"
+
+namespace doris::vectorized {
+
+// too small columns are not worth the hash map
+static constexpr size_t DICT_ENCODE_MIN_ROWS = 4096;
+// give up once the dictionary has more than 1/DICT_MAX_SIZE_RATIO of the rows
+static constexpr size_t DICT_MAX_SIZE_RATIO = 4;
+
+std::shared_ptr<DictEncodedStringColumn> DictEncodedStringColumn::encode(const IColumn& column) {
+    const NullMap* null_map = nullptr;
+    const IColumn* nested = &column;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        null_map = &nullable->get_null_map_data();
+        nested = &nullable->get_nested_column();
+    }
+    const auto* strings = check_and_get_column<ColumnString>(*nested);
+    if (strings == nullptr || strings->size() < DICT_ENCODE_MIN_ROWS) {
+        return nullptr;
+    }
+
+    const size_t rows = strings->size();
+    const size_t max_dict_size = rows / DICT_MAX_SIZE_RATIO;
+    auto result = std::make_shared<DictEncodedStringColumn>();
+    result->_codes.resize(rows);
+    auto dict_strings = ColumnString::create();
+    auto dict_null_map = ColumnUInt8::create();
+    phmap::flat_hash_map<StringRef, uint32_t, StringRefHash> dict;
+    uint32_t null_code = std::numeric_limits<uint32_t>::max();
+    for (size_t i = 0; i < rows; ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            if (null_code == std::numeric_limits<uint32_t>::max()) {
+                null_code = dict_strings->size();
+                dict_strings->insert_default();
+                dict_null_map->insert_value(1);
+            }
+            result->_codes[i] = null_code;
+            continue;
+        }
+        auto value = strings->get_data_at(i);
+        auto [it, inserted] = dict.try_emplace(value, dict_strings->size());
+        if (inserted) {
+            if (dict_strings->size() >= max_dict_size) {
+                return nullptr;
+            }
+            dict_strings->insert_data(value.data, value.size);
+            dict_null_map->insert_value(0);
+        }
+        result->_codes[i] = it->second;
+    }
+
+    if (null_map != nullptr) {
+        result->_dict = ColumnNullable::create(std::move(dict_strings), std::move(dict_null_map));
+    } else {
+        result->_dict = std::move(dict_strings);
+    }
+    if (result->allocated_bytes() * 2 > column.allocated_bytes()) {
+        return nullptr;
+    }
+    return result;
+}
+
+void DictEncodedStringColumn::insert_indices_into(IColumn& to, const uint32_t* indices_begin,
+                                                  const uint32_t* indices_end) const {
+    PaddedPODArray<uint32_t> codes(indices_end - indices_begin);
+    for (size_t i = 0; i < codes.size(); ++i) {
+        codes[i] = _codes[indices_begin[i]];
+    }
+    to.insert_indices_from(*_dict, codes.data(), codes.data() + codes.size());
+}
+
+} // namespace doris::vectorized
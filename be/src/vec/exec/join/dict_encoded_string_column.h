@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "vec/columns/column.h"
+#include "vec/common/pod_array.h"
+
+namespace doris::vectorized {
+
+// A string column of the hash join build block encoded by a dictionary. The build block keeps
+// a constant column at its position, the values are decoded only when the rows are gathered
+// into the output block.
+class DictEncodedStringColumn {
+public:
+    // Returns nullptr if the column is not a (nullable) string column, or the dictionary does
+    // not save at least half of its memory.
+    static std::shared_ptr<DictEncodedStringColumn> encode(const IColumn& column);
+
+    // Same as `to.insert_indices_from(original column, indices_begin, indices_end)`.
+    void insert_indices_into(IColumn& to, const uint32_t* indices_begin,
+                             const uint32_t* indices_end) const;
+
+    size_t allocated_bytes() const { return _dict->allocated_bytes() + _codes.allocated_bytes(); }
+
+private:
+    // the distinct values, of the same type as the original column
+    ColumnPtr _dict;
+    // the index in `_dict` of each row
+    PaddedPODArray<uint32_t> _codes;
+};
+
+using DictEncodedStringColumns = std::vector<std::shared_ptr<DictEncodedStringColumn>>;
+
+} // namespace doris::vectorized
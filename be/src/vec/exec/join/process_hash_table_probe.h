@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "join_op.h"
+#include "vec/exec/join/dict_encoded_string_column.h"
 #include "vec/columns/column.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/arena.h"
@@ -88,9 +89,14 @@ struct ProcessHashTableProbe {
     /// we should make this row match with all rows in build side.
     size_t _process_probe_null_key(uint32_t probe_idx);
 
+    bool _is_dict_encoded(size_t column_id) const {
+        return column_id < _build_dict_columns.size() && _build_dict_columns[column_id];
+    }
+
     Parent* _parent = nullptr;
     const int _batch_size;
     const std::shared_ptr<Block>& _build_block;
+    const DictEncodedStringColumns& _build_dict_columns;
     std::unique_ptr<Arena> _arena;
     std::vector<StringRef> _probe_keys;
 
@@ -36,6 +36,7 @@ ProcessHashTableProbe<JoinOpType, Parent>::ProcessHashTableProbe(Parent* parent,
         : _parent(parent),
           _batch_size(batch_size),
           _build_block(parent->build_block()),
+          _build_dict_columns(parent->build_dict_columns()),
           _tuple_is_null_left_flags(parent->is_outer_join()
                                             ? &(reinterpret_cast<ColumnUInt8&>(
                                                         *parent->_tuple_is_null_left_flag_column)
@@ -102,7 +103,7 @@ void ProcessHashTableProbe<JoinOpType, Parent>::build_side_output_column(
             for (int i = 0; i < _right_col_len; i++) {
                 const auto& column = *_build_block->safe_get_by_position(i).column;
                 _build_column_has_null[i] = false;
-                if (output_slot_flags[i] && column.is_nullable()) {
+                if (output_slot_flags[i] && column.is_nullable() && !_is_dict_encoded(i)) {
                     const auto& nullable = assert_cast<const ColumnNullable&>(column);
                     _build_column_has_null[i] = !simd::contain_byte(
                             nullable.get_null_map_data().data() + 1, nullable.size() - 1, 1);
@@ -114,7 +115,11 @@ void ProcessHashTableProbe<JoinOpType, Parent>::build_side_output_column(
         for (int i = 0; i < _right_col_len; i++) {
             const auto& column = *_build_block->safe_get_by_position(i).column;
             if (output_slot_flags[i]) {
-                if (!build_index_has_zero && _build_column_has_null[i]) {
+                if (_is_dict_encoded(i)) {
+                    _build_dict_columns[i]->insert_indices_into(*mcol[i + _right_col_idx],
+                                                                _build_indexs.data(),
+                                                                _build_indexs.data() + size);
+                } else if (!build_index_has_zero && _build_column_has_null[i]) {
                     assert_cast<ColumnNullable*>(mcol[i + _right_col_idx].get())
                             ->insert_indices_from_not_has_null(column, _build_indexs.data(),
                                                                _build_indexs.data() + size);
@@ -175,7 +180,7 @@ typename HashTableType::State ProcessHashTableProbe<JoinOpType, Parent>::_init_p
         hash_table_ctx.reset();
         hash_table_ctx.init_serialized_keys(_parent->_probe_columns, probe_rows, null_map, true,
                                             false, hash_table_ctx.hash_table->get_bucket_size());
-        hash_table_ctx.hash_table->pre_build_idxs(hash_table_ctx.bucket_nums,
+        hash_table_ctx.hash_table->pre_build_idxs(hash_table_ctx.keys, hash_table_ctx.bucket_nums,
                                                   need_judge_null ? null_map : nullptr);
         COUNTER_SET(_parent->_probe_arena_memory_usage,
                     (int64_t)hash_table_ctx.serialized_keys_size(false));
@@ -632,6 +637,12 @@ Status ProcessHashTableProbe<JoinOpType, Parent>::process_data_in_hashtable(
                     mcol.size(), _right_col_len, _right_col_idx);
         }
         for (size_t j = 0; j < _right_col_len; ++j) {
+            if (_is_dict_encoded(j)) {
+                _build_dict_columns[j]->insert_indices_into(*mcol[j + _right_col_idx],
+                                                            _build_indexs.data(),
+                                                            _build_indexs.data() + block_size);
+                continue;
+            }
             const auto& column = *_build_block->safe_get_by_position(j).column;
             mcol[j + _right_col_idx]->insert_indices_from(column, _build_indexs.data(),
                                                           _build_indexs.data() + block_size);
@@ -46,10 +46,12 @@
 #include "pipeline/exec/hashjoin_probe_operator.h"
 #include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_filter_mgr.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
 #include "util/uid_util.h"
 #include "vec/columns/column_nullable.h"
@@ -75,6 +77,23 @@ namespace doris::vectorized {
 
 constexpr uint32_t JOIN_BUILD_SIZE_LIMIT = std::numeric_limits<uint32_t>::max();
 
+void run_hash_table_build_tasks(size_t num_tasks, const std::function<void(size_t)>& func) {
+    CountDownLatch latch(num_tasks - 1);
+    for (size_t task = 1; task < num_tasks; ++task) {
+        auto st = ExecEnv::GetInstance()->join_node_thread_pool()->submit_func([&, task]() {
+            func(task);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            // run it here if the pool is full
+            func(task);
+            latch.count_down();
+        }
+    }
+    func(0);
+    latch.wait();
+}
+
 template Status HashJoinNode::_extract_join_column<true>(
         Block&, COW<IColumn>::mutable_ptr<ColumnVector<unsigned char>>&,
         std::vector<IColumn const*, std::allocator<IColumn const*>>&,
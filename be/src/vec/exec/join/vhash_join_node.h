@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include <atomic>
+#include <functional>
 #include <iosfwd>
 #include <memory>
 #include <string>
@@ -29,6 +30,7 @@
 #include <variant>
 #include <vector>
 
+#include "common/config.h"
 #include "common/global_types.h"
 #include "common/status.h"
 #include "exprs/runtime_filter_slots.h"
@@ -81,7 +83,7 @@ Status process_runtime_filter_build(RuntimeState* state, Block* block, Parent* p
     uint64_t rows = block->rows();
     {
         SCOPED_TIMER(parent->_runtime_filter_init_timer);
-        RETURN_IF_ERROR(parent->_runtime_filter_slots->init_filters(state, rows));
+        RETURN_IF_ERROR(parent->_runtime_filter_slots->init_filters(state, rows, block));
         RETURN_IF_ERROR(parent->_runtime_filter_slots->ignore_filters(state));
     }
 
@@ -99,15 +101,21 @@ Status process_runtime_filter_build(RuntimeState* state, Block* block, Parent* p
 
 using ProfileCounter = RuntimeProfile::Counter;
 
+// Runs `func(task_id)` for `num_tasks` tasks in the join node thread pool and the calling
+// thread, returns after all tasks are done.
+void run_hash_table_build_tasks(size_t num_tasks, const std::function<void(size_t)>& func);
+
 template <class HashTableContext, typename Parent>
 struct ProcessHashTableBuild {
+    // The hash table is built by `build_parallelism` threads if it is larger than 1.
     ProcessHashTableBuild(int rows, ColumnRawPtrs& build_raw_ptrs, Parent* parent, int batch_size,
-                          RuntimeState* state)
+                          RuntimeState* state, int build_parallelism = 1)
             : _rows(rows),
               _build_raw_ptrs(build_raw_ptrs),
               _parent(parent),
               _batch_size(batch_size),
-              _state(state) {}
+              _state(state),
+              _build_parallelism(build_parallelism) {}
 
     template <int JoinOpType, bool ignore_null, bool short_circuit_for_null,
               bool with_other_conjuncts>
@@ -127,12 +135,21 @@ struct ProcessHashTableBuild {
         SCOPED_TIMER(_parent->_build_table_insert_timer);
         hash_table_ctx.hash_table->template prepare_build<JoinOpType>(_rows, _batch_size,
                                                                       *has_null_key);
+        if (config::enable_join_probe_bloom_filter) {
+            hash_table_ctx.hash_table->template init_probe_filter<JoinOpType>();
+        }
 
         hash_table_ctx.init_serialized_keys(_build_raw_ptrs, _rows,
                                             null_map ? null_map->data() : nullptr, true, true,
                                             hash_table_ctx.hash_table->get_bucket_size());
-        hash_table_ctx.hash_table->template build<JoinOpType, with_other_conjuncts>(
-                hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows);
+        if (_build_parallelism > 1) {
+            hash_table_ctx.hash_table->template parallel_build<JoinOpType, with_other_conjuncts>(
+                    hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows,
+                    _build_parallelism, run_hash_table_build_tasks);
+        } else {
+            hash_table_ctx.hash_table->template build<JoinOpType, with_other_conjuncts>(
+                    hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows);
+        }
         hash_table_ctx.bucket_nums.resize(_batch_size);
         hash_table_ctx.bucket_nums.shrink_to_fit();
 
@@ -149,6 +166,7 @@ private:
     Parent* _parent = nullptr;
     int _batch_size;
     RuntimeState* _state = nullptr;
+    const int _build_parallelism;
 };
 
 using I8HashTableContext = PrimaryTypeHashTableContext<UInt8>;
@@ -230,6 +248,7 @@ public:
     bool is_right_semi_anti() const { return _is_right_semi_anti; }
     bool is_outer_join() const { return _is_outer_join; }
     const std::shared_ptr<vectorized::Block>& build_block() const { return _build_block; }
+    const DictEncodedStringColumns& build_dict_columns() const { return _build_dict_columns; }
     std::vector<bool>* left_output_slot_flags() { return &_left_output_slot_flags; }
     std::vector<bool>* right_output_slot_flags() { return &_right_output_slot_flags; }
     bool* has_null_in_build_side() { return &_has_null_in_build_side; }
@@ -327,6 +346,8 @@ private:
     std::unique_ptr<HashTableCtxVariants> _process_hashtable_ctx_variants;
 
     std::shared_ptr<Block> _build_block;
+    // the non-pipeline join does not encode its build block
+    DictEncodedStringColumns _build_dict_columns;
     Block _probe_block;
     ColumnRawPtrs _probe_columns;
     ColumnUInt8::MutablePtr _null_map_column;
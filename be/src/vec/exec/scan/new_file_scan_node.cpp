@@ -69,6 +69,12 @@ void NewFileScanNode::set_scan_ranges(RuntimeState* state,
     }
     if (scan_ranges.size() <= max_scanners) {
         _scan_ranges = scan_ranges;
+        const TFileScanRangeParams* params = nullptr;
+        if (state->get_query_ctx() != nullptr &&
+            state->get_query_ctx()->file_scan_range_params_map.contains(id())) {
+            params = &state->get_query_ctx()->file_scan_range_params_map[id()];
+        }
+        vectorized::VFileScanner::split_parquet_scan_ranges(params, max_scanners, &_scan_ranges);
     } else {
         // There is no need for the number of scanners to exceed the number of threads in thread pool.
         // scan_ranges is sorted by path(as well as partition path) in FE, so merge scan ranges in order.
@@ -23,8 +23,10 @@
 #include <memory>
 #include <ostream>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
+#include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "vec/exec/scan/new_jdbc_scanner.h"
 
@@ -65,11 +67,18 @@ Status NewJdbcScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
     if (_eos == true) {
         return Status::OK();
     }
-    std::unique_ptr<NewJdbcScanner> scanner =
-            NewJdbcScanner::create_unique(_state, this, _limit_per_scanner, _tuple_id,
-                                          _query_string, _table_type, _state->runtime_profile());
-    RETURN_IF_ERROR(scanner->prepare(_state, _conjuncts));
-    scanners->push_back(std::move(scanner));
+    // a limited scan reads a few rows, it's not worth more connections
+    int split_num = _limit_per_scanner < 0 ? config::jdbc_scan_split_num : 1;
+    auto queries = NewJdbcScanner::split_query_string(
+            _query_string, _table_type, _state->desc_tbl().get_tuple_descriptor(_tuple_id),
+            split_num);
+    for (const auto& query : queries) {
+        std::unique_ptr<NewJdbcScanner> scanner =
+                NewJdbcScanner::create_unique(_state, this, _limit_per_scanner, _tuple_id, query,
+                                              _table_type, _state->runtime_profile());
+        RETURN_IF_ERROR(scanner->prepare(_state, _conjuncts));
+        scanners->push_back(std::move(scanner));
+    }
     return Status::OK();
 }
 } // namespace doris::vectorized
@@ -17,12 +17,15 @@
 
 #include "new_jdbc_scanner.h"
 
+#include <fmt/format.h>
+
 #include <new>
 #include <ostream>
 #include <utility>
 #include <vector>
 
 #include "common/logging.h"
+#include "runtime/define_primitive_type.h"
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
@@ -61,6 +64,49 @@ NewJdbcScanner::NewJdbcScanner(RuntimeState* state,
     _init_profile(local_state->_scanner_profile);
 }
 
+std::vector<std::string> NewJdbcScanner::split_query_string(const std::string& query_string,
+                                                            TOdbcTableType::type table_type,
+                                                            const TupleDescriptor* tuple_desc,
+                                                            int num) {
+    char quote;
+    if (table_type == TOdbcTableType::MYSQL) {
+        quote = '`';
+    } else if (table_type == TOdbcTableType::POSTGRESQL) {
+        quote = '"';
+    } else {
+        return {query_string};
+    }
+    if (num <= 1 || tuple_desc == nullptr) {
+        return {query_string};
+    }
+    // the column must be selected by the query as it is quoted, so the name is the same in
+    // the remote table
+    std::string column;
+    for (const auto* slot : tuple_desc->slots()) {
+        auto type = slot->type().type;
+        if (type != TYPE_TINYINT && type != TYPE_SMALLINT && type != TYPE_INT &&
+            type != TYPE_BIGINT) {
+            continue;
+        }
+        std::string quoted = fmt::format("{}{}{}", quote, slot->col_name(), quote);
+        if (query_string.find(quoted) != std::string::npos) {
+            column = std::move(quoted);
+            break;
+        }
+    }
+    if (column.empty()) {
+        return {query_string};
+    }
+    // ABS, since the remainder of a negative value is negative. The nulls go to the first one.
+    std::vector<std::string> queries;
+    for (int i = 0; i < num; ++i) {
+        queries.push_back(fmt::format(
+                "SELECT * FROM ({}) doris_jdbc_split WHERE ABS(MOD({}, {})) = {}{}", query_string,
+                column, num, i, i == 0 ? fmt::format(" OR {} IS NULL", column) : ""));
+    }
+    return queries;
+}
+
 Status NewJdbcScanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts) {
     VLOG_CRITICAL << "NewJdbcScanner::Prepare";
     RETURN_IF_ERROR(VScanner::prepare(state, conjuncts));
@@ -22,6 +22,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/factory_creator.h"
 #include "common/global_types.h"
@@ -57,6 +58,13 @@ public:
 
     Status prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts);
 
+    // Split `query_string` into `num` queries reading disjoint parts of its rows, by the
+    // remainder of the first integer column of `tuple_desc` selected by the query. Only mysql
+    // and postgresql queries are split, the others are returned as they are.
+    static std::vector<std::string> split_query_string(const std::string& query_string,
+                                                       TOdbcTableType::type table_type,
+                                                       const TupleDescriptor* tuple_desc, int num);
+
 protected:
     Status _get_block_impl(RuntimeState* state, Block* block, bool* eos) override;
 
@@ -150,6 +150,14 @@ Status NewOlapScanNode::_init_profile() {
     _stats_filtered_counter = ADD_COUNTER(_segment_profile, "RowsZonemapFiltered", TUnit::UNIT);
     _stats_rp_filtered_counter =
             ADD_COUNTER(_segment_profile, "RowsZonemapRuntimePredicateFiltered", TUnit::UNIT);
+    _late_rf_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsLateRuntimeFilterFiltered", TUnit::UNIT);
+    _topn_rp_filtered_counter =
+            ADD_COUNTER(_segment_profile, "RowsTopNRuntimePredicateFiltered", TUnit::UNIT);
+    _prefetch_hit_counter = ADD_COUNTER(_segment_profile, "PrefetchHitCount", TUnit::UNIT);
+    _prefetch_miss_counter = ADD_COUNTER(_segment_profile, "PrefetchMissCount", TUnit::UNIT);
+    _prefetch_wait_timer = ADD_TIMER(_segment_profile, "PrefetchWaitTime");
+    _prefetch_bytes_counter = ADD_COUNTER(_segment_profile, "PrefetchBytes", TUnit::BYTES);
     _bf_filtered_counter = ADD_COUNTER(_segment_profile, "RowsBloomFilterFiltered", TUnit::UNIT);
     _dict_filtered_counter = ADD_COUNTER(_segment_profile, "RowsDictFiltered", TUnit::UNIT);
     _del_filtered_counter = ADD_COUNTER(_scanner_profile, "RowsDelFiltered", TUnit::UNIT);
@@ -518,6 +526,10 @@ Status NewOlapScanNode::_init_scanners(std::list<VScannerSPtr>* scanners) {
         std::vector<std::function<Status()>> tasks;
         tasks.reserve(_scan_ranges.size());
         for (auto&& [tablet, version] : tablets_to_scan) {
+            // most tablets are up to date, only the stale ones need a bthread to sync
+            if (static_cast<CloudTablet*>(tablet.get())->rowsets_synced(version)) {
+                continue;
+            }
             tasks.emplace_back([tablet, version]() {
                 return std::dynamic_pointer_cast<CloudTablet>(tablet)->sync_rowsets(version);
             });
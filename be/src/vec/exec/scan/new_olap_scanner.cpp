@@ -37,13 +37,16 @@
 #include "common/consts.h"
 #include "common/logging.h"
 #include "exec/olap_utils.h"
+#include "exprs/create_predicate_function.h"
 #include "exprs/function_filter.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "io/io_common.h"
 #include "olap/olap_common.h"
 #include "olap/olap_tuple.h"
+#include "olap/predicate_creator.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_meta.h"
+#include "olap/scan_io_stats.h"
 #include "olap/schema_cache.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
@@ -57,11 +60,15 @@
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/schema_util.h"
 #include "vec/core/block.h"
 #include "vec/exec/scan/new_olap_scan_node.h"
 #include "vec/exec/scan/vscan_node.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vruntimefilter_wrapper.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/json/path_in_data.h"
 #include "vec/olap/block_reader.h"
 
@@ -240,6 +247,7 @@ Status NewOlapScanner::open(RuntimeState* state) {
         return Status::InternalError(ss.str());
     }
 
+    _rowsets_read = _tablet_reader_params.rs_splits.size();
     // Do not hold rs_splits any more to release memory.
     _tablet_reader_params.rs_splits.clear();
 
@@ -425,6 +433,10 @@ Status NewOlapScanner::_init_tablet_reader_params(
         }
     }
 
+    if (_total_rf_num > 0 && config::enable_late_arrival_runtime_filter_page_pruning) {
+        _tablet_reader_params.late_arrival_predicates = std::make_shared<LateArrivalPredicates>();
+    }
+
     // If this is a Two-Phase read query, and we need to delay the release of Rowset
     // by rowset->update_delayed_expired_timestamp().This could expand the lifespan of Rowset
     if (tablet_schema->field_index(BeConsts::ROWID_COL) >= 0) {
@@ -534,6 +546,11 @@ Status NewOlapScanner::_get_block_impl(RuntimeState* state, Block* block, bool*
     // Read one block from block reader
     // ATTN: Here we need to let the _get_block_impl method guarantee the semantics of the interface,
     // that is, eof can be set to true only when the returned block is empty.
+    if (_tablet_reader_params.late_arrival_predicates != nullptr &&
+        _late_arrival_rf_num != _applied_rf_num) {
+        _late_arrival_rf_num = _applied_rf_num;
+        RETURN_IF_ERROR(_update_late_arrival_predicates());
+    }
     RETURN_IF_ERROR(_tablet_reader->next_block_with_aggregation(block, eof));
     if (!_profile_updated) {
         _profile_updated = _tablet_reader->update_profile(_profile);
@@ -545,6 +562,95 @@ Status NewOlapScanner::_get_block_impl(RuntimeState* state, Block* block, bool*
     return Status::OK();
 }
 
+// The min/max values in a literal are exact for these types, so the predicates parsed from
+// them never prune a page wrongly.
+static bool is_exact_literal_type(PrimitiveType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_DATE:
+    case TYPE_DATETIME:
+    case TYPE_DATEV2:
+    case TYPE_DATETIMEV2:
+    case TYPE_DECIMALV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128I:
+    case TYPE_DECIMAL256:
+    case TYPE_VARCHAR:
+    case TYPE_STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+Status NewOlapScanner::_update_late_arrival_predicates() {
+    auto& late_predicates = *_tablet_reader_params.late_arrival_predicates;
+    late_predicates.predicates.clear();
+    late_predicates.arena.clear();
+    late_predicates.version++;
+
+    const auto& tablet_schema = _tablet_reader_params.tablet_schema;
+    for (const auto& conjunct : _conjuncts) {
+        auto* wrapper = dynamic_cast<VRuntimeFilterWrapper*>(conjunct->root().get());
+        if (wrapper == nullptr) {
+            continue;
+        }
+        auto impl = wrapper->get_impl();
+        if (impl->children().empty() || !impl->children()[0]->is_slot_ref()) {
+            continue;
+        }
+        auto slot_id = assert_cast<const VSlotRef*>(impl->children()[0].get())->slot_id();
+        const SlotDescriptor* slot = nullptr;
+        for (const auto* slot_desc : _output_tuple_desc->slots()) {
+            if (slot_desc->id() == slot_id) {
+                slot = slot_desc;
+                break;
+            }
+        }
+        if (slot == nullptr || !slot->column_paths().empty()) {
+            continue;
+        }
+        int32_t index = tablet_schema->field_index(slot->col_name());
+        if (index < 0) {
+            continue;
+        }
+        const TabletColumn& column = tablet_schema->column(index);
+        // same as the conditions in TabletReader, predicates on value columns of the
+        // aggregate and merge-on-read tables can not be applied before merging.
+        if (column.aggregation() != FieldAggregationMethod::OLAP_FIELD_AGGREGATION_NONE ||
+            column.is_variant_type()) {
+            continue;
+        }
+
+        ColumnPredicate* predicate = nullptr;
+        if (impl->node_type() == TExprNodeType::IN_PRED && impl->get_set_func() != nullptr) {
+            predicate = create_column_predicate(index, impl->get_set_func(), column.type(),
+                                                _state->be_exec_version(), &column);
+        } else if (impl->node_type() == TExprNodeType::BINARY_PRED &&
+                   impl->children().size() == 2 && is_exact_literal_type(slot->type().type)) {
+            auto* literal = dynamic_cast<const VLiteral*>(impl->children()[1].get());
+            if (literal == nullptr ||
+                (impl->op() != TExprOpcode::GE && impl->op() != TExprOpcode::LE)) {
+                continue;
+            }
+            TCondition condition;
+            condition.__set_column_name(slot->col_name());
+            condition.__set_condition_op(impl->op() == TExprOpcode::GE ? ">=" : "<=");
+            condition.__set_condition_values({literal->value()});
+            predicate = parse_to_predicate(column, index, condition, &late_predicates.arena);
+        }
+        if (predicate != nullptr) {
+            late_predicates.predicates.emplace_back(predicate);
+        }
+    }
+    return Status::OK();
+}
+
 Status NewOlapScanner::close(RuntimeState* state) {
     if (_is_closed) {
         return Status::OK();
@@ -639,6 +745,12 @@ void NewOlapScanner::_collect_profile_before_close() {
     }                                                                                             \
     COUNTER_UPDATE(Parent->_stats_filtered_counter, stats.rows_stats_filtered);                   \
     COUNTER_UPDATE(Parent->_stats_rp_filtered_counter, stats.rows_stats_rp_filtered);             \
+    COUNTER_UPDATE(Parent->_late_rf_filtered_counter, stats.rows_late_rf_filtered);               \
+    COUNTER_UPDATE(Parent->_topn_rp_filtered_counter, stats.rows_topn_rp_filtered);               \
+    COUNTER_UPDATE(Parent->_prefetch_hit_counter, stats.prefetch_hit_num);                        \
+    COUNTER_UPDATE(Parent->_prefetch_miss_counter, stats.prefetch_miss_num);                      \
+    COUNTER_UPDATE(Parent->_prefetch_wait_timer, stats.prefetch_wait_ns);                         \
+    COUNTER_UPDATE(Parent->_prefetch_bytes_counter, stats.prefetch_bytes);                        \
     COUNTER_UPDATE(Parent->_dict_filtered_counter, stats.rows_dict_filtered);                     \
     COUNTER_UPDATE(Parent->_bf_filtered_counter, stats.rows_bf_filtered);                         \
     COUNTER_UPDATE(Parent->_del_filtered_counter, stats.rows_del_filtered);                       \
@@ -695,6 +807,10 @@ void NewOlapScanner::_collect_profile_before_close() {
     tablet->query_scan_bytes->increment(_compressed_bytes_read);
     tablet->query_scan_rows->increment(_raw_rows_read);
     tablet->query_scan_count->increment(1);
+    if (config::enable_scan_io_stats) {
+        ScanIOStats::instance()->record(tablet->tablet_id(), stats, _compressed_bytes_read,
+                                        _raw_rows_read, _num_rows_return, _rowsets_read);
+    }
     if (_query_statistics) {
         _query_statistics->add_scan_bytes_from_local_storage(
                 stats.file_cache_stats.bytes_read_from_local);
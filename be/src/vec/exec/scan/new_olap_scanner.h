@@ -93,6 +93,9 @@ private:
                                       const std::vector<FunctionFilter>& function_filters);
 
     [[nodiscard]] Status _init_return_columns();
+    // Rebuilds the late arrival predicates of the storage reader from the runtime filters
+    // in `_conjuncts`.
+    [[nodiscard]] Status _update_late_arrival_predicates();
     [[nodiscard]] Status _init_variant_columns();
 
     std::vector<OlapScanRange*> _key_ranges;
@@ -103,10 +106,14 @@ private:
     std::vector<uint32_t> _return_columns;
     std::unordered_set<uint32_t> _tablet_columns_convert_to_null_set;
     std::vector<TCondition> _compound_filters;
+    // `_applied_rf_num` when the late arrival predicates were built last time
+    int _late_arrival_rf_num = 0;
 
     // ========= profiles ==========
     int64_t _compressed_bytes_read = 0;
     int64_t _raw_rows_read = 0;
+    // rowsets merged by `_tablet_reader`
+    int64_t _rowsets_read = 0;
     bool _profile_updated = false;
 };
 } // namespace vectorized
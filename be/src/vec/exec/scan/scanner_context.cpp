@@ -21,6 +21,8 @@
 #include <gen_cpp/Metrics_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <bit>
 #include <mutex>
 #include <ostream>
 #include <utility>
@@ -29,6 +31,7 @@
 #include "common/status.h"
 #include "pipeline/exec/scan_operator.h"
 #include "runtime/descriptors.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
@@ -196,6 +199,17 @@ void ScannerContext::submit_scan_task(std::shared_ptr<ScanTask> scan_task) {
     _scanner_scheduler->submit(shared_from_this(), scan_task);
 }
 
+int ScannerContext::scan_task_priority() const {
+    static constexpr int MAX_PRIORITY = 20;
+    auto* query_ctx = _state->get_query_ctx();
+    if (query_ctx == nullptr) {
+        return MAX_PRIORITY;
+    }
+    // one lower for each doubling of the scan time in ms
+    auto scan_ms = static_cast<uint64_t>(query_ctx->scan_task_time() / 1000 / 1000);
+    return std::max(0, MAX_PRIORITY - static_cast<int>(std::bit_width(scan_ms)));
+}
+
 void ScannerContext::append_block_to_queue(std::shared_ptr<ScanTask> scan_task) {
     if (scan_task->status_ok()) {
         for (const vectorized::BlockUPtr& block : scan_task->cached_blocks) {
@@ -154,6 +154,11 @@ public:
     RuntimeState* state() { return _state; }
     void incr_ctx_scheduling_time(int64_t num) { _scanner_ctx_sched_time->update(num); }
 
+    // The priority of the scan tasks in the shared scan thread pools. The less time the query
+    // has scanned, the higher it is, so a big scan can't starve the small queries. The tasks
+    // waiting in the pool still get higher priorities as they wait.
+    int scan_task_priority() const;
+
     std::string parent_name();
 
     virtual bool empty_in_queue(int id);
@@ -33,6 +33,7 @@
 #include "common/logging.h"
 #include "olap/tablet.h"
 #include "runtime/exec_env.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "util/async_io.h" // IWYU pragma: keep
@@ -41,6 +42,7 @@
 #include "util/defer_op.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
+#include "util/stopwatch.hpp"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/work_thread_pool.hpp"
@@ -127,8 +129,7 @@ void ScannerScheduler::submit(std::shared_ptr<ScannerContext> ctx,
     }
 
     // Submit scanners to thread pool
-    // TODO(cmy): How to handle this "nice"?
-    int nice = 1;
+    int nice = ctx->scan_task_priority();
     if (ctx->thread_token != nullptr) {
         std::shared_ptr<ScannerDelegate> scanner_delegate = scan_task->scanner.lock();
         if (scanner_delegate == nullptr) {
@@ -227,6 +228,8 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
 #endif
     scanner->update_wait_worker_timer();
     scanner->start_scan_cpu_timer();
+    MonotonicStopWatch task_watch;
+    task_watch.start();
     Status status = Status::OK();
     bool eos = false;
     RuntimeState* state = ctx->state();
@@ -268,7 +271,10 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
         }
         raw_bytes_read += free_block->allocated_bytes();
         if (!scan_task->cached_blocks.empty() &&
-            scan_task->cached_blocks.back()->rows() + free_block->rows() <= ctx->batch_size()) {
+            scan_task->cached_blocks.back()->rows() + free_block->rows() <= ctx->batch_size() &&
+            (config::block_target_bytes <= 0 ||
+             scan_task->cached_blocks.back()->bytes() + free_block->bytes() <=
+                     config::block_target_bytes)) {
             size_t block_size = scan_task->cached_blocks.back()->allocated_bytes();
             vectorized::MutableBlock mutable_block(scan_task->cached_blocks.back().get());
             status = mutable_block.merge(*free_block);
@@ -293,6 +299,9 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
     }
 
     scanner->update_scan_cpu_timer();
+    if (auto* query_ctx = state->get_query_ctx()) {
+        query_ctx->update_scan_task_time(task_watch.elapsed_time());
+    }
     if (eos) {
         scanner->mark_to_need_to_close();
     }
@@ -36,9 +36,13 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "io/cache/block_file_cache_profile.h"
+#include "io/file_factory.h"
+#include "io/fs/file_meta_cache.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/threadpool.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
@@ -145,6 +149,53 @@ VFileScanner::VFileScanner(RuntimeState* state, pipeline::FileScanLocalState* lo
     _is_load = (_input_tuple_desc != nullptr);
 }
 
+void VFileScanner::split_parquet_scan_ranges(const TFileScanRangeParams* params,
+                                             int max_scanners,
+                                             std::vector<TScanRangeParams>* scan_ranges) {
+    const int64_t min_bytes = config::parquet_scan_range_split_min_bytes;
+    if (min_bytes <= 0 || scan_ranges->size() >= max_scanners) {
+        return;
+    }
+    int idle_scanners = max_scanners - static_cast<int>(scan_ranges->size());
+    const size_t num_scan_ranges = scan_ranges->size();
+    for (size_t i = 0; i < num_scan_ranges && idle_scanners > 0; ++i) {
+        const TFileScanRange& file_scan_range =
+                (*scan_ranges)[i].scan_range.ext_scan_range.file_scan_range;
+        const TFileScanRangeParams* range_params =
+                params != nullptr ? params
+                                  : (file_scan_range.__isset.params ? &file_scan_range.params
+                                                                    : nullptr);
+        if (range_params == nullptr ||
+            range_params->format_type != TFileFormatType::FORMAT_PARQUET ||
+            file_scan_range.ranges.size() != 1) {
+            continue;
+        }
+        const TFileRangeDesc range = file_scan_range.ranges[0];
+        // a range of size -1 reads the whole file, whose size is not known yet
+        if (range.size < 2 * min_bytes) {
+            continue;
+        }
+        const int num_slices =
+                static_cast<int>(std::min<int64_t>(range.size / min_bytes, idle_scanners + 1));
+        const int64_t slice_size = range.size / num_slices;
+        for (int slice = 0; slice < num_slices; ++slice) {
+            TFileRangeDesc slice_range = range;
+            slice_range.start_offset = range.start_offset + slice * slice_size;
+            slice_range.size = slice == num_slices - 1 ? range.size - slice * slice_size
+                                                       : slice_size;
+            if (slice == 0) {
+                (*scan_ranges)[i].scan_range.ext_scan_range.file_scan_range.ranges[0] =
+                        slice_range;
+            } else {
+                TScanRangeParams slice_params = (*scan_ranges)[i];
+                slice_params.scan_range.ext_scan_range.file_scan_range.ranges[0] = slice_range;
+                scan_ranges->push_back(std::move(slice_params));
+            }
+        }
+        idle_scanners -= num_slices - 1;
+    }
+}
+
 Status VFileScanner::prepare(
         const VExprContextSPtrs& conjuncts,
         std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range,
@@ -323,6 +374,11 @@ Status VFileScanner::_get_block_wrapped(RuntimeState* state, Block* block, bool*
         RETURN_IF_CANCELLED(state);
         if (_cur_reader == nullptr || _cur_reader_eof) {
             RETURN_IF_ERROR(_get_next_reader());
+            // the new reader is initialized with the runtime filters arrived so far
+            _late_arrival_rf_num = _applied_rf_num;
+        } else if (_late_arrival_rf_num != _applied_rf_num) {
+            _late_arrival_rf_num = _applied_rf_num;
+            RETURN_IF_ERROR(_cur_reader->set_late_arrival_runtime_filters(_conjuncts));
         }
 
         if (_scanner_eof) {
@@ -731,6 +787,65 @@ void VFileScanner::_truncate_char_or_varchar_column(Block* block, int idx, int l
     Block::erase_useless_column(block, num_columns_without_result);
 }
 
+void VFileScanner::_prefetch_file_metas() {
+    int prefetch_num = config::external_file_meta_prefetch_num;
+    if (prefetch_num <= 0 || _params->format_type != TFileFormatType::FORMAT_PARQUET ||
+        !_shoudl_enable_file_meta_cache()) {
+        return;
+    }
+    int end = std::min(static_cast<int>(_ranges.size()), _next_range + prefetch_num);
+    const std::string* prev_path = nullptr;
+    for (int i = std::max(_next_meta_prefetch_range, _next_range); i < end; ++i) {
+        const TFileRangeDesc& range = _ranges[i];
+        // the splits of a file share the same footer
+        if (range.path == _current_range_path ||
+            (prev_path != nullptr && *prev_path == range.path)) {
+            continue;
+        }
+        prev_path = &range.path;
+
+        io::FileSystemProperties system_properties;
+        system_properties.system_type =
+                range.__isset.file_type ? range.file_type : _params->file_type;
+        system_properties.properties = _params->properties;
+        system_properties.hdfs_params = _params->hdfs_params;
+        if (_params->__isset.broker_addresses) {
+            system_properties.broker_addresses.assign(_params->broker_addresses.begin(),
+                                                      _params->broker_addresses.end());
+        }
+        io::FileDescription file_description;
+        file_description.path = range.path;
+        file_description.file_size = range.__isset.file_size ? range.file_size : -1;
+        if (range.__isset.fs_name) {
+            file_description.fs_name = range.fs_name;
+        }
+        file_description.mtime = range.__isset.modification_time ? range.modification_time : 0;
+        io::FileReaderOptions reader_options =
+                FileFactory::get_reader_options(_state, file_description);
+        // the prefetch may outlive this scanner, so it must not refer to its statistics
+        io::IOContext io_ctx = *_io_ctx;
+        io_ctx.file_cache_stats = nullptr;
+        io_ctx.query_id = nullptr;
+        io_ctx.should_stop = false;
+
+        auto* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+        static_cast<void>(pool->submit_func([system_properties = std::move(system_properties),
+                                             file_description = std::move(file_description),
+                                             reader_options, io_ctx]() mutable {
+            auto file_reader = FileFactory::create_file_reader(system_properties, file_description,
+                                                               reader_options);
+            if (!file_reader.has_value()) {
+                return;
+            }
+            size_t meta_size = 0;
+            ObjLRUCache::CacheHandle handle;
+            static_cast<void>(ExecEnv::GetInstance()->file_meta_cache()->get_parquet_footer(
+                    file_reader.value(), &io_ctx, file_description.mtime, &meta_size, &handle));
+        }));
+    }
+    _next_meta_prefetch_range = std::max(_next_meta_prefetch_range, end);
+}
+
 Status VFileScanner::_get_next_reader() {
     while (true) {
         if (_cur_reader) {
@@ -750,6 +865,7 @@ Status VFileScanner::_get_next_reader() {
 
         const TFileRangeDesc& range = _ranges[_next_range++];
         _current_range_path = range.path;
+        _prefetch_file_metas();
 
         // create reader for specific format
         Status init_status;
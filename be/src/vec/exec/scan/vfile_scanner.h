@@ -85,6 +85,12 @@ public:
 
     std::string get_current_scan_range_name() override { return _current_range_path; }
 
+    // Splits the large parquet ranges of `scan_ranges` into byte slices until there are
+    // `max_scanners` of them. `params` is the shared params of the scan node, the params of the
+    // ranges are used if it is nullptr.
+    static void split_parquet_scan_ranges(const TFileScanRangeParams* params, int max_scanners,
+                                          std::vector<TScanRangeParams>* scan_ranges);
+
 protected:
     Status _get_block_impl(RuntimeState* state, Block* block, bool* eof) override;
 
@@ -95,12 +101,18 @@ protected:
     // TODO: cast input block columns type to string.
     Status _cast_src_block(Block* block) { return Status::OK(); }
 
+    // Read the footers of the next parquet ranges into the file meta cache in background,
+    // so that opening them does not wait for the remote round trips.
+    void _prefetch_file_metas();
+
     void _collect_profile_before_close() override;
 
 protected:
     const TFileScanRangeParams* _params = nullptr;
     const std::vector<TFileRangeDesc>& _ranges;
     int _next_range;
+    // ranges before it have been submitted to the file meta prefetch
+    int _next_meta_prefetch_range = 0;
 
     std::unique_ptr<GenericReader> _cur_reader;
     bool _cur_reader_eof;
@@ -164,6 +176,8 @@ protected:
     Block _src_block;
 
     VExprContextSPtrs _push_down_conjuncts;
+    // `_applied_rf_num` when the runtime filters were given to `_cur_reader` last time
+    int _late_arrival_rf_num = 0;
 
     std::unique_ptr<io::FileCacheStatistics> _file_cache_statistics;
     std::unique_ptr<io::IOContext> _io_ctx;
@@ -79,6 +79,9 @@ public:
     std::vector<std::list<int>> get_partition_assignments();
     int get_task_count();
     int get_task_id(int partition_id, int64_t index);
+    int get_partition_task_count(int partition_id) const {
+        return _partition_assignments[partition_id].size();
+    }
     void add_data_processed(long data_size);
     void add_partition_row_count(int partition, long row_count);
     void rebalance();
@@ -215,31 +215,9 @@ Status AggregationNode::prepare_profile(RuntimeState* state) {
         evaluator->set_timer(_merge_timer, _expr_timer);
     }
 
-    _offsets_of_aggregate_states.resize(_aggregate_evaluators.size());
-
-    for (size_t i = 0; i < _aggregate_evaluators.size(); ++i) {
-        _offsets_of_aggregate_states[i] = _total_size_of_aggregate_states;
-
-        const auto& agg_function = _aggregate_evaluators[i]->function();
-        // aggreate states are aligned based on maximum requirement
-        _align_aggregate_states = std::max(_align_aggregate_states, agg_function->align_of_data());
-        _total_size_of_aggregate_states += agg_function->size_of_data();
-
-        // If not the last aggregate_state, we need pad it so that next aggregate_state will be aligned.
-        if (i + 1 < _aggregate_evaluators.size()) {
-            size_t alignment_of_next_state =
-                    _aggregate_evaluators[i + 1]->function()->align_of_data();
-            if ((alignment_of_next_state & (alignment_of_next_state - 1)) != 0) {
-                return Status::RuntimeError("Logical error: align_of_data is not 2^N");
-            }
-
-            /// Extend total_size to next alignment requirement
-            /// Add padding by rounding up 'total_size_of_aggregate_states' to be a multiplier of alignment_of_next_state.
-            _total_size_of_aggregate_states =
-                    (_total_size_of_aggregate_states + alignment_of_next_state - 1) /
-                    alignment_of_next_state * alignment_of_next_state;
-        }
-    }
+    RETURN_IF_ERROR(AggFnEvaluator::calc_state_layout(
+            _aggregate_evaluators, &_offsets_of_aggregate_states,
+            &_total_size_of_aggregate_states, &_align_aggregate_states));
 
     if (_probe_expr_ctxs.empty()) {
         _agg_data->init(AggregatedDataVariants::Type::without_key);
@@ -925,6 +903,9 @@ Status AggregationNode::_pre_agg_with_serialized_key(doris::vectorized::Block* i
                                     data_types.emplace_back(data_type);
                                 }
 
+                                // the states serialized here are temporary, free their memory
+                                // after each block instead of growing the arena
+                                auto arena_checkpoint = _agg_arena_pool->checkpoint();
                                 for (int i = 0; i != _aggregate_evaluators.size(); ++i) {
                                     SCOPED_TIMER(_serialize_data_timer);
                                     RETURN_IF_ERROR(_aggregate_evaluators[i]
@@ -932,6 +913,7 @@ Status AggregationNode::_pre_agg_with_serialized_key(doris::vectorized::Block* i
                                                                     in_block, value_columns[i],
                                                                     rows, _agg_arena_pool.get()));
                                 }
+                                _agg_arena_pool->rewind(arena_checkpoint);
 
                                 if (!mem_reuse) {
                                     ColumnsWithTypeAndName columns_with_schema;
@@ -26,6 +26,7 @@
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/logging.h"
 #include "runtime/descriptors.h"
@@ -204,6 +205,9 @@ Status VAnalyticEvalNode::prepare(RuntimeState* state) {
     _fn_place_ptr = _agg_arena_pool->aligned_alloc(_total_size_of_aggregate_states,
                                                    _align_aggregate_states);
     RETURN_IF_ERROR(_create_agg_status());
+    if (_fn_scope == AnalyticFnScope::ROWS) {
+        _init_segment_trees();
+    }
     _executor.insert_result =
             std::bind<void>(&VAnalyticEvalNode::_insert_result_info, this, std::placeholders::_1);
     _executor.execute =
@@ -689,9 +693,19 @@ void VAnalyticEvalNode::_execute_for_win_func(int64_t partition_start, int64_t p
         for (int j = 0; j < _agg_intput_columns[i].size(); ++j) {
             _agg_columns.push_back(_agg_intput_columns[i][j].get());
         }
-        _agg_functions[i]->function()->add_range_single_place(
-                partition_start, partition_end, frame_start, frame_end,
-                _fn_place_ptr + _offsets_of_aggregate_states[i], _agg_columns.data(), nullptr);
+        auto* place = _fn_place_ptr + _offsets_of_aggregate_states[i];
+        if (!_segment_trees.empty() && _segment_trees[i] != nullptr) {
+            // the whole partition has been buffered when its rows are evaluated
+            auto& tree = _segment_trees[i];
+            if (!tree->is_built_for(partition_start, partition_end)) {
+                tree->build(partition_start, partition_end, _agg_columns.data());
+            }
+            tree->aggregate(frame_start, frame_end, place, _agg_columns.data(), nullptr);
+        } else {
+            _agg_functions[i]->function()->add_range_single_place(
+                    partition_start, partition_end, frame_start, frame_end, place,
+                    _agg_columns.data(), nullptr);
+        }
     }
 
     // If the end is not greater than the start, the current window should be empty.
@@ -736,6 +750,29 @@ void VAnalyticEvalNode::_reset_agg_status() {
     }
 }
 
+void VAnalyticEvalNode::_init_segment_trees() {
+    _segment_trees.resize(_agg_functions_size);
+    const int64_t min_frame_rows = config::analytic_segment_tree_min_frame_rows;
+    if (min_frame_rows <= 0 || !_window.__isset.window_end) {
+        return;
+    }
+    // [unbounded preceding, current row] keeps adding up the rows, see _get_next_for_rows
+    if (!_window.__isset.window_start &&
+        _window.window_end.type == TAnalyticWindowBoundaryType::CURRENT_ROW) {
+        return;
+    }
+    if (_window.__isset.window_start &&
+        _rows_end_offset - _rows_start_offset + 1 < min_frame_rows) {
+        return;
+    }
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        if (WindowSegmentTree::is_supported(*_agg_functions[i]->function())) {
+            _segment_trees[i] =
+                    std::make_unique<WindowSegmentTree>(_agg_functions[i]->function().get());
+        }
+    }
+}
+
 Status VAnalyticEvalNode::_create_agg_status() {
     for (size_t i = 0; i < _agg_functions_size; ++i) {
         try {
@@ -810,6 +847,7 @@ std::string VAnalyticEvalNode::debug_window_bound_string(TAnalyticWindowBoundary
 }
 
 void VAnalyticEvalNode::_release_mem() {
+    _segment_trees.clear();
     _agg_arena_pool = nullptr;
 
     std::vector<Block> tmp_input_blocks;
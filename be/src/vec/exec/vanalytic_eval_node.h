@@ -37,6 +37,7 @@
 #include "vec/common/arena.h"
 #include "vec/core/block.h"
 #include "vec/data_types/data_type.h"
+#include "vec/exec/window_segment_tree.h"
 #include "vec/exprs/vexpr_fwd.h"
 
 namespace doris {
@@ -102,6 +103,9 @@ private:
     Status _init_result_columns();
     Status _create_agg_status();
     Status _destroy_agg_status();
+    // Creates the segment trees of the functions whose sliding ROWS frames are wide enough,
+    // see config::analytic_segment_tree_min_frame_rows.
+    void _init_segment_trees();
     Status _insert_range_column(vectorized::Block* block, const VExprContextSPtr& expr,
                                 IColumn* dst_column, size_t length);
 
@@ -143,6 +147,8 @@ private:
     VExprContextSPtrs _partition_by_eq_expr_ctxs;
     VExprContextSPtrs _order_by_eq_expr_ctxs;
     std::vector<std::vector<MutableColumnPtr>> _agg_intput_columns;
+    // null for the functions which add the rows of every frame
+    std::vector<std::unique_ptr<WindowSegmentTree>> _segment_trees;
     std::vector<MutableColumnPtr> _result_window_columns;
 
     BlockRowPos _order_by_start;
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/window_segment_tree.h"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <string>
+
+namespace doris::vectorized {
+
+bool WindowSegmentTree::is_supported(const IAggregateFunction& function) {
+    // the nullable wrapper forwards the name of the nested function
+    const std::string name = function.get_name();
+    return name == "sum" || name == "count" || name == "avg" || name == "min" || name == "max";
+}
+
+void WindowSegmentTree::build(int64_t partition_start, int64_t partition_end,
+                              const IColumn** columns) {
+    _destroy_states();
+    _arena.clear();
+    _partition_start = partition_start;
+    _partition_end = partition_end;
+
+    const size_t align = _function->align_of_data();
+    _state_stride = (_function->size_of_data() + align - 1) / align * align;
+
+    int64_t units = partition_end - partition_start;
+    for (int level = 0; units / FANOUT > 0; ++level) {
+        const int64_t size = units / FANOUT;
+        _levels.push_back({_arena.aligned_alloc(_state_stride * size, align), 0});
+        for (int64_t i = 0; i < size; ++i) {
+            AggregateDataPtr place = _state(level, i);
+            _function->create(place);
+            _levels[level].size++;
+            _add_units(level - 1, i * FANOUT, (i + 1) * FANOUT, place, columns, &_arena);
+        }
+        units = size;
+    }
+    _built = true;
+}
+
+void WindowSegmentTree::aggregate(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                                  const IColumn** columns, Arena* arena) const {
+    DCHECK(_built);
+    int64_t begin = std::max(frame_start, _partition_start) - _partition_start;
+    int64_t end = std::min(frame_end, _partition_end) - _partition_start;
+    for (int level = -1; begin < end; ++level) {
+        const int64_t parent_begin = (begin + FANOUT - 1) / FANOUT;
+        const int64_t parent_end = end / FANOUT;
+        if (parent_begin >= parent_end) {
+            _add_units(level, begin, end, place, columns, arena);
+            break;
+        }
+        // the units of the edges which do not fill a whole node of the next level
+        _add_units(level, begin, parent_begin * FANOUT, place, columns, arena);
+        _add_units(level, parent_end * FANOUT, end, place, columns, arena);
+        begin = parent_begin;
+        end = parent_end;
+    }
+}
+
+void WindowSegmentTree::_add_units(int level, int64_t begin, int64_t end, AggregateDataPtr place,
+                                   const IColumn** columns, Arena* arena) const {
+    if (level < 0) {
+        _function->add_range_single_place(_partition_start, _partition_end,
+                                          _partition_start + begin, _partition_start + end, place,
+                                          columns, arena);
+        return;
+    }
+    DCHECK_LE(end, _levels[level].size);
+    for (int64_t i = begin; i < end; ++i) {
+        _function->merge(place, _state(level, i), arena);
+    }
+}
+
+void WindowSegmentTree::_destroy_states() {
+    for (size_t level = 0; level < _levels.size(); ++level) {
+        for (int64_t i = 0; i < _levels[level].size; ++i) {
+            _function->destroy(_state(level, i));
+        }
+    }
+    _levels.clear();
+    _built = false;
+}
+
+} // namespace doris::vectorized
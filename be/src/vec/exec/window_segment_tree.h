@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/common/arena.h"
+
+namespace doris::vectorized {
+
+class IColumn;
+
+// Evaluates an aggregate function over the sliding ROWS frames of a partition, such as
+// `ROWS BETWEEN 1000 PRECEDING AND CURRENT ROW`, without adding every row of every frame.
+//
+// The rows of the partition are split into nodes of FANOUT rows, and every FANOUT nodes of a
+// level are merged into one node of the next level. A frame adds the rows at its edges which
+// do not fill a whole node and merges the nodes between them level by level, so it costs
+// O(FANOUT * log(frame rows)) instead of O(frame rows).
+//
+// Only the functions whose merged state equals the state of adding the same rows can be
+// evaluated like this, see `is_supported`.
+class WindowSegmentTree {
+public:
+    static constexpr int64_t FANOUT = 16;
+
+    explicit WindowSegmentTree(const IAggregateFunction* function) : _function(function) {}
+    ~WindowSegmentTree() { _destroy_states(); }
+
+    static bool is_supported(const IAggregateFunction& function);
+
+    bool is_built_for(int64_t partition_start, int64_t partition_end) const {
+        return _built && _partition_start == partition_start && _partition_end == partition_end;
+    }
+
+    // Builds the nodes over the rows [partition_start, partition_end) of `columns`.
+    void build(int64_t partition_start, int64_t partition_end, const IColumn** columns);
+
+    // Adds the rows [frame_start, frame_end) to `place`, the frame is clamped to the partition
+    // the tree is built for.
+    void aggregate(int64_t frame_start, int64_t frame_end, AggregateDataPtr place,
+                   const IColumn** columns, Arena* arena) const;
+
+private:
+    struct Level {
+        AggregateDataPtr states = nullptr;
+        int64_t size = 0;
+    };
+
+    AggregateDataPtr _state(size_t level, int64_t index) const {
+        return _levels[level].states + index * _state_stride;
+    }
+
+    // Adds the units [begin, end) of `level` to `place`, level -1 stands for the rows.
+    void _add_units(int level, int64_t begin, int64_t end, AggregateDataPtr place,
+                    const IColumn** columns, Arena* arena) const;
+
+    void _destroy_states();
+
+    const IAggregateFunction* _function;
+    size_t _state_stride = 0;
+    int64_t _partition_start = 0;
+    int64_t _partition_end = 0;
+    bool _built = false;
+    // level i holds the nodes of FANOUT^(i+1) rows which lie wholly inside the partition
+    std::vector<Level> _levels;
+    Arena _arena;
+};
+
+} // namespace doris::vectorized
@@ -18,6 +18,8 @@
 #pragma once
 #include <gen_cpp/Opcodes_types.h>
 
+#include <algorithm>
+
 #include "common/status.h"
 #include "gutil/integral_types.h"
 #include "util/simd/bits.h"
@@ -130,8 +132,7 @@ public:
         int lhs_id = -1;
         int rhs_id = -1;
         RETURN_IF_ERROR(_children[0]->execute(context, block, &lhs_id));
-        ColumnPtr lhs_column =
-                block->get_by_position(lhs_id).column->convert_to_full_column_if_const();
+        ColumnPtr lhs_column = _get_modifiable_column(block, lhs_id);
         size_t size = lhs_column->size();
         bool lhs_is_nullable = lhs_column->is_nullable();
         auto [lhs_data_column, lhs_null_map] =
@@ -157,9 +158,9 @@ public:
 
         auto get_rhs_colum = [&]() {
             if (rhs_id == -1) {
-                RETURN_IF_ERROR(_children[1]->execute(context, block, &rhs_id));
-                rhs_column =
-                        block->get_by_position(rhs_id).column->convert_to_full_column_if_const();
+                RETURN_IF_ERROR(
+                        _execute_rhs(context, block, lhs_data_column, lhs_null_map, size, &rhs_id));
+                rhs_column = _get_modifiable_column(block, rhs_id);
                 rhs_is_nullable = rhs_column->is_nullable();
                 auto rhs_nullable_column = _get_raw_data_and_null_map(rhs_column, rhs_is_nullable);
                 rhs_data_column = rhs_nullable_column.first;
@@ -310,13 +311,109 @@ private:
     bool _all_child_is_compound_and_not_const() const {
         for (auto child : _children) {
             // we can make sure non const compound predicate's return column is allow modifyied locally.
-            if (child->is_constant() || !child->is_compound_predicate()) {
+            // A comparison always returns a new column too, so `a + b > c AND d < e` skips
+            // evaluating `d < e` when no row passes `a + b > c`, and combines them in place.
+            if (child->is_constant() || !(child->is_compound_predicate() ||
+                                          child->node_type() == TExprNodeType::BINARY_PRED)) {
                 return false;
             }
         }
         return true;
     }
 
+    // A comparison of columns and literals is cheaper to evaluate on all rows than filtering the
+    // block for it.
+    bool _rhs_is_cheap() const {
+        const auto& rhs = _children[1];
+        if (rhs->node_type() != TExprNodeType::BINARY_PRED) {
+            return false;
+        }
+        return std::all_of(rhs->children().begin(), rhs->children().end(), [](const auto& child) {
+            return child->node_type() == TExprNodeType::SLOT_REF || child->is_constant();
+        });
+    }
+
+    // Only the rows not decided by the lhs, true or null for AND and false or null for OR, need
+    // the rhs. When few of them are left, the rhs is evaluated on these rows only and its result
+    // is expanded back to all rows. The other rows get false, they do not change the result.
+    Status _execute_rhs(VExprContext* context, Block* block, const uint8* lhs_data,
+                        const uint8* lhs_null_map, size_t size, int* rhs_id) {
+        if (size == 0 || _rhs_is_cheap()) {
+            return _children[1]->execute(context, block, rhs_id);
+        }
+        IColumn::Filter filter(size);
+        auto* __restrict filter_data = filter.data();
+        if (_op == TExprOpcode::COMPOUND_AND) {
+            for (size_t i = 0; i < size; ++i) {
+                filter_data[i] = lhs_data[i] != 0;
+            }
+        } else {
+            for (size_t i = 0; i < size; ++i) {
+                filter_data[i] = lhs_data[i] == 0;
+            }
+        }
+        if (lhs_null_map != nullptr) {
+            for (size_t i = 0; i < size; ++i) {
+                filter_data[i] |= lhs_null_map[i];
+            }
+        }
+        size_t selected = size - simd::count_zero_num((int8_t*)filter_data, size);
+        if (selected * SELECTIVE_EVALUATION_MAX_RATIO > size) {
+            return _children[1]->execute(context, block, rhs_id);
+        }
+
+        // the columns not filled yet, e.g. the results of the lazily materialized columns, can
+        // not be referenced by the rhs, they only keep the positions of the other columns
+        Block selected_block;
+        for (const auto& column : *block) {
+            selected_block.insert({column.column->size() == size
+                                           ? column.column->filter(filter, selected)
+                                           : column.column->clone_empty(),
+                                   column.type, column.name});
+        }
+        int selected_rhs_id = -1;
+        RETURN_IF_ERROR(_children[1]->execute(context, &selected_block, &selected_rhs_id));
+        const auto& selected_rhs = selected_block.get_by_position(selected_rhs_id);
+        ColumnPtr selected_column = selected_rhs.column->convert_to_full_column_if_const();
+        auto [selected_data, selected_null_map] =
+                _get_raw_data_and_null_map(selected_column, selected_column->is_nullable());
+
+        auto data_column = ColumnUInt8::create(size, 0);
+        auto* __restrict data = data_column->get_data().data();
+        ColumnUInt8::MutablePtr null_map_column;
+        uint8* __restrict null_map = nullptr;
+        if (selected_null_map != nullptr) {
+            null_map_column = ColumnUInt8::create(size, 0);
+            null_map = null_map_column->get_data().data();
+        }
+        for (size_t i = 0, j = 0; i < size; ++i) {
+            if (filter_data[i]) {
+                data[i] = selected_data[j];
+                if (null_map != nullptr) {
+                    null_map[i] = selected_null_map[j];
+                }
+                ++j;
+            }
+        }
+        ColumnPtr rhs_column = std::move(data_column);
+        if (null_map != nullptr) {
+            rhs_column = ColumnNullable::create(std::move(rhs_column), std::move(null_map_column));
+        }
+        *rhs_id = block->columns();
+        block->insert({std::move(rhs_column), selected_rhs.type, selected_rhs.name});
+        return Status::OK();
+    }
+
+    // The result column of a child is modified in place, so it is made full if it is const and
+    // copied if it is still shared, e.g. with the result of an inverted index.
+    static ColumnPtr _get_modifiable_column(Block* block, int column_id) {
+        auto& column = block->get_by_position(column_id).column;
+        ColumnPtr full_column = column->convert_to_full_column_if_const();
+        column = nullptr;
+        column = IColumn::mutate(std::move(full_column));
+        return column;
+    }
+
     std::pair<uint8*, uint8*> _get_raw_data_and_null_map(ColumnPtr column,
                                                          bool nullable_column) const {
         if (nullable_column) {
@@ -337,6 +434,9 @@ private:
         }
     }
 
+    // the rhs is evaluated on the undecided rows only when they are at most 1/8 of the block
+    static constexpr size_t SELECTIVE_EVALUATION_MAX_RATIO = 8;
+
     TExprOpcode::type _op;
 };
 } // namespace doris::vectorized
@@ -23,7 +23,9 @@
 #include <gen_cpp/PlanNodes_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <string_view>
 
@@ -370,4 +372,37 @@ Status AggFnEvaluator::check_agg_fn_output(int key_size,
     }
     return Status::OK();
 }
+
+Status AggFnEvaluator::calc_state_layout(const std::vector<vectorized::AggFnEvaluator*>& agg_fn,
+                                         std::vector<size_t>* offsets, size_t* total_size,
+                                         size_t* align) {
+    auto is_small = [&](size_t i) {
+        return agg_fn[i]->function()->size_of_data() <= SMALL_STATE_BYTES;
+    };
+    std::vector<size_t> order(agg_fn.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        if (is_small(lhs) != is_small(rhs)) {
+            return is_small(lhs);
+        }
+        return agg_fn[lhs]->function()->align_of_data() > agg_fn[rhs]->function()->align_of_data();
+    });
+
+    offsets->resize(agg_fn.size());
+    *total_size = 0;
+    *align = 1;
+    for (size_t i : order) {
+        const auto& function = agg_fn[i]->function();
+        size_t alignment = function->align_of_data();
+        if ((alignment & (alignment - 1)) != 0) {
+            return Status::RuntimeError("Logical error: align_of_data is not 2^N");
+        }
+        // aggreate states are aligned based on maximum requirement
+        *align = std::max(*align, alignment);
+        *total_size = (*total_size + alignment - 1) / alignment * alignment;
+        (*offsets)[i] = *total_size;
+        *total_size += function->size_of_data();
+    }
+    return Status::OK();
+}
 } // namespace doris::vectorized
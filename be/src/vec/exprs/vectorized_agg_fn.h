@@ -101,6 +101,17 @@ public:
                                       const std::vector<vectorized::AggFnEvaluator*>& agg_fn,
                                       const RowDescriptor& output_row_desc);
 
+    // Computes the offset of the state of each function in the states of a group, the size
+    // and the alignment of the states. The small states of simple aggregates like
+    // sum/count/min/max are placed first, ordered by alignment, so they are packed without
+    // padding and the states updated by every row share as few cache lines as possible.
+    static Status calc_state_layout(const std::vector<vectorized::AggFnEvaluator*>& agg_fn,
+                                    std::vector<size_t>* offsets, size_t* total_size,
+                                    size_t* align);
+
+    // Max size of the states placed at the beginning of the states of a group.
+    static constexpr size_t SMALL_STATE_BYTES = 16;
+
     void set_version(const int version) { _function->set_version(version); }
 
     AggFnEvaluator* clone(RuntimeState* state, ObjectPool* pool);
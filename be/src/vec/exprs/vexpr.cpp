@@ -26,12 +26,14 @@
 #include <boost/iterator/iterator_facade.hpp>
 #include <memory>
 #include <stack>
+#include <unordered_set>
 
 #include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
 #include "vec/data_types/data_type_factory.hpp"
 #include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
@@ -486,6 +488,87 @@ std::string VExpr::debug_string() const {
     return out.str();
 }
 
+std::string VExpr::fingerprint() const {
+    static const std::unordered_set<std::string> nondeterministic_functions = {
+            "rand", "random", "uuid", "uuid_numeric"};
+    std::string result;
+    switch (_node_type) {
+    case TExprNodeType::SLOT_REF:
+        result = fmt::format("slot#{}", assert_cast<const VSlotRef*>(this)->column_id());
+        break;
+    case TExprNodeType::BOOL_LITERAL:
+    case TExprNodeType::INT_LITERAL:
+    case TExprNodeType::LARGE_INT_LITERAL:
+    case TExprNodeType::FLOAT_LITERAL:
+    case TExprNodeType::DECIMAL_LITERAL:
+    case TExprNodeType::DATE_LITERAL:
+    case TExprNodeType::STRING_LITERAL:
+    case TExprNodeType::NULL_LITERAL:
+        result = fmt::format("literal#{}", assert_cast<const VLiteral*>(this)->value());
+        break;
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::COMPOUND_PRED:
+    case TExprNodeType::FUNCTION_CALL:
+        if ((_fn.__isset.binary_type && _fn.binary_type != TFunctionBinaryType::BUILTIN) ||
+            nondeterministic_functions.contains(_fn.name.function_name)) {
+            return "";
+        }
+        result = fmt::format("{}#{}", static_cast<int>(_node_type), _fn.name.function_name);
+        break;
+    default:
+        return "";
+    }
+    result += fmt::format(":{}(", _data_type->get_name());
+    for (const auto& child : _children) {
+        auto child_fingerprint = child->fingerprint();
+        if (child_fingerprint.empty()) {
+            return "";
+        }
+        result += child_fingerprint;
+        result += ',';
+    }
+    result += ')';
+    return result;
+}
+
+bool VExpr::collect_read_column_ids(std::vector<int>* column_ids) const {
+    switch (_node_type) {
+    case TExprNodeType::SLOT_REF:
+        column_ids->push_back(assert_cast<const VSlotRef*>(this)->column_id());
+        return true;
+    case TExprNodeType::BOOL_LITERAL:
+    case TExprNodeType::INT_LITERAL:
+    case TExprNodeType::LARGE_INT_LITERAL:
+    case TExprNodeType::IPV4_LITERAL:
+    case TExprNodeType::IPV6_LITERAL:
+    case TExprNodeType::FLOAT_LITERAL:
+    case TExprNodeType::DECIMAL_LITERAL:
+    case TExprNodeType::DATE_LITERAL:
+    case TExprNodeType::STRING_LITERAL:
+    case TExprNodeType::JSON_LITERAL:
+    case TExprNodeType::NULL_LITERAL:
+    case TExprNodeType::ARRAY_LITERAL:
+    case TExprNodeType::MAP_LITERAL:
+    case TExprNodeType::STRUCT_LITERAL:
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::COMPOUND_PRED:
+    case TExprNodeType::FUNCTION_CALL:
+    case TExprNodeType::IN_PRED:
+    case TExprNodeType::CASE_EXPR:
+        // these exprs only read the block by their children
+        break;
+    default:
+        return false;
+    }
+    return std::all_of(_children.begin(), _children.end(), [&](const VExprSPtr& child) {
+        return child->collect_read_column_ids(column_ids);
+    });
+}
+
 std::string VExpr::debug_string(const VExprSPtrs& exprs) {
     std::stringstream out;
     out << "[";
@@ -184,6 +184,15 @@ public:
     static std::string debug_string(const VExprSPtrs& exprs);
     static std::string debug_string(const VExprContextSPtrs& ctxs);
 
+    // Identifies the result of a prepared expr tree, the trees with the same non-empty
+    // fingerprint return the same column on the same block. It is empty if the tree is not
+    // known to be deterministic, e.g. it calls rand() or an udf.
+    std::string fingerprint() const;
+
+    // Appends the ids of the block columns that the tree reads to `column_ids`. Returns false if
+    // the tree may read a column that is not known here, e.g. by a lambda or tuple_is_null.
+    bool collect_read_column_ids(std::vector<int>* column_ids) const;
+
     void set_getting_const_col(bool val = true) { _getting_const_col = val; }
 
     bool is_and_expr() const { return _fn.name.function_name == "and"; }
@@ -28,6 +28,7 @@
 #include "vec/columns/column_const.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
+#include "util/simd/bits.h"
 #include "vec/exprs/vexpr.h"
 
 namespace doris {
@@ -149,6 +150,50 @@ Status VExprContext::filter_block(const VExprContextSPtrs& expr_contexts, Block*
                                               column_to_keep);
 }
 
+Status VExprContext::filter_block_columns(const VExprContextSPtrs& expr_contexts, Block* block,
+                                          const std::vector<uint32_t>& columns_to_filter) {
+    if (expr_contexts.empty() || block->rows() == 0) {
+        return Status::OK();
+    }
+    const size_t column_to_keep = block->columns();
+    IColumn::Filter filter(block->rows(), 1);
+    bool can_filter_all;
+    RETURN_IF_ERROR(
+            execute_conjuncts(expr_contexts, nullptr, false, block, &filter, &can_filter_all));
+    Block::erase_useless_column(block, column_to_keep);
+
+    const size_t count =
+            can_filter_all ? 0
+                           : filter.size() - simd::count_zero_num((int8_t*)filter.data(),
+                                                                  filter.size());
+    if (count == filter.size()) {
+        return Status::OK();
+    }
+    std::vector<bool> need_filter(column_to_keep, false);
+    for (auto id : columns_to_filter) {
+        if (id < column_to_keep) {
+            need_filter[id] = true;
+        }
+    }
+    std::vector<uint32_t> filtered_columns;
+    for (uint32_t i = 0; i < column_to_keep; ++i) {
+        if (need_filter[i]) {
+            filtered_columns.push_back(i);
+            continue;
+        }
+        auto& column = block->get_by_position(i).column;
+        if (count == 0) {
+            column = column->clone_empty();
+        } else if (is_column_const(*column)) {
+            column = column->clone_resized(count);
+        } else {
+            column = ColumnConst::create(column->clone_resized(1), count);
+        }
+    }
+    RETURN_IF_CATCH_EXCEPTION(Block::filter_block_internal(block, filtered_columns, filter));
+    return Status::OK();
+}
+
 Status VExprContext::execute_conjuncts(const VExprContextSPtrs& ctxs,
                                        const std::vector<IColumn::Filter*>* filters, Block* block,
                                        IColumn::Filter* result_filter, bool* can_filter_all) {
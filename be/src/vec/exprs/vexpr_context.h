@@ -91,6 +91,13 @@ public:
     [[nodiscard]] static Status filter_block(const VExprContextSPtrs& expr_contexts, Block* block,
                                              int column_to_keep);
 
+    // Like filter_block, but only the columns in `columns_to_filter` are filtered, the other
+    // columns are replaced by constant columns of the filtered size. It is used when the caller
+    // never reads the other columns, so they do not need to be copied.
+    [[nodiscard]] static Status filter_block_columns(
+            const VExprContextSPtrs& expr_contexts, Block* block,
+            const std::vector<uint32_t>& columns_to_filter);
+
     [[nodiscard]] static Status execute_conjuncts(const VExprContextSPtrs& ctxs,
                                                   const std::vector<IColumn::Filter*>* filters,
                                                   bool accept_null, Block* block,
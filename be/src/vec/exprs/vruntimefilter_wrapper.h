@@ -57,6 +57,8 @@ public:
 
     const VExprSPtr get_impl() const override { return _impl; }
 
+    bool null_aware() const { return _null_aware; }
+
     void attach_profile_counter(RuntimeProfile::Counter* expr_filtered_rows_counter,
                                 RuntimeProfile::Counter* expr_input_rows_counter,
                                 RuntimeProfile::Counter* always_true_counter) {
@@ -19,6 +19,9 @@
 
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_array.h"
@@ -37,6 +40,7 @@ public:
         double sum = 0;
     };
     static void accumulate(State& state, double x, double y) { state.sum += fabs(x - y); }
+    static void merge(State& state, const State& other) { state.sum += other.sum; }
     static double finalize(const State& state) { return state.sum; }
 };
 
@@ -47,6 +51,7 @@ public:
         double sum = 0;
     };
     static void accumulate(State& state, double x, double y) { state.sum += (x - y) * (x - y); }
+    static void merge(State& state, const State& other) { state.sum += other.sum; }
     static double finalize(const State& state) { return sqrt(state.sum); }
 };
 
@@ -57,6 +62,7 @@ public:
         double sum = 0;
     };
     static void accumulate(State& state, double x, double y) { state.sum += x * y; }
+    static void merge(State& state, const State& other) { state.sum += other.sum; }
     static double finalize(const State& state) { return state.sum; }
 };
 
@@ -73,6 +79,11 @@ public:
         state.squared_x += x * x;
         state.squared_y += y * y;
     }
+    static void merge(State& state, const State& other) {
+        state.dot_prod += other.dot_prod;
+        state.squared_x += other.squared_x;
+        state.squared_y += other.squared_y;
+    }
     static double finalize(const State& state) {
         return 1 - state.dot_prod / sqrt(state.squared_x * state.squared_y);
     }
@@ -102,12 +113,14 @@ public:
                                                     arg2.type->get_name()));
         }
 
-        auto col1 = arg1.column->convert_to_full_column_if_const();
-        auto col2 = arg2.column->convert_to_full_column_if_const();
-        if (col1->size() != col2->size()) {
+        // a constant argument, usually the query vector, is read from its only row instead of
+        // being copied to every row
+        auto [col1, is_const1] = unpack_if_const(arg1.column);
+        auto [col2, is_const2] = unpack_if_const(arg2.column);
+        if (arg1.column->size() != arg2.column->size()) {
             return Status::RuntimeError(
                     fmt::format("function {} have different input array sizes: {} and {}",
-                                get_name(), col1->size(), col2->size()));
+                                get_name(), arg1.column->size(), arg2.column->size()));
         }
 
         ColumnArrayExecutionData arr1;
@@ -120,57 +133,111 @@ public:
 
         // prepare return data
         auto dst = ColumnVector<Float64>::create(input_rows_count);
-        auto& dst_data = dst->get_data();
         auto dst_null_column = ColumnUInt8::create(input_rows_count);
-        auto& dst_null_data = dst_null_column->get_data();
 
+        Status status;
+        _visit_elements(arr1.nested_col, [&](auto get1) {
+            _visit_elements(arr2.nested_col, [&](auto get2) {
+                status = _execute_rows(arr1, is_const1, get1, arr2, is_const2, get2,
+                                       input_rows_count, dst->get_data(),
+                                       dst_null_column->get_data());
+            });
+        });
+        RETURN_IF_ERROR(status);
+
+        block.replace_by_position(
+                result, ColumnNullable::create(std::move(dst), std::move(dst_null_column)));
+        return Status::OK();
+    }
+
+private:
+    // Calls f with a getter of the elements as double, the float elements are read directly
+    // so that the distance loop is inlined.
+    template <typename F>
+    static void _visit_elements(const IColumn* column, F&& f) {
+        if (const auto* float32_column = check_and_get_column<ColumnFloat32>(column)) {
+            const auto* data = float32_column->get_data().data();
+            f([data](size_t pos) -> double { return data[pos]; });
+        } else if (const auto* float64_column = check_and_get_column<ColumnFloat64>(column)) {
+            const auto* data = float64_column->get_data().data();
+            f([data](size_t pos) -> double { return data[pos]; });
+        } else {
+            f([column](size_t pos) -> double { return column->get_float64(pos); });
+        }
+    }
+
+    // The elements are accumulated into independent lanes, which the compiler can vectorize,
+    // a single running sum of doubles has to be added in order and can not be.
+    template <typename Getter1, typename Getter2>
+    static void _accumulate(typename DistanceImpl::State& st, Getter1 get1, size_t begin1,
+                            Getter2 get2, size_t begin2, size_t size) {
+        constexpr size_t LANES = 8;
+        typename DistanceImpl::State lanes[LANES];
+        size_t i = 0;
+        for (; i + LANES <= size; i += LANES) {
+            for (size_t lane = 0; lane < LANES; ++lane) {
+                DistanceImpl::accumulate(lanes[lane], get1(begin1 + i + lane),
+                                         get2(begin2 + i + lane));
+            }
+        }
+        for (; i < size; ++i) {
+            DistanceImpl::accumulate(lanes[0], get1(begin1 + i), get2(begin2 + i));
+        }
+        for (const auto& lane : lanes) {
+            DistanceImpl::merge(st, lane);
+        }
+    }
+
+    template <typename Getter1, typename Getter2>
+    Status _execute_rows(const ColumnArrayExecutionData& arr1, bool is_const1, Getter1 get1,
+                         const ColumnArrayExecutionData& arr2, bool is_const2, Getter2 get2,
+                         size_t input_rows_count, PaddedPODArray<Float64>& dst_data,
+                         NullMap& dst_null_data) const {
         const auto& offsets1 = *arr1.offsets_ptr;
         const auto& offsets2 = *arr2.offsets_ptr;
-        const auto& nested_col1 = arr1.nested_col;
-        const auto& nested_col2 = arr2.nested_col;
-        for (ssize_t row = 0; row < offsets1.size(); ++row) {
-            if (arr1.array_nullmap_data && arr1.array_nullmap_data[row]) {
-                dst_null_data[row] = true;
-                continue;
-            }
-            if (arr2.array_nullmap_data && arr2.array_nullmap_data[row]) {
+        for (ssize_t row = 0; row < input_rows_count; ++row) {
+            ssize_t row1 = index_check_const(row, is_const1);
+            ssize_t row2 = index_check_const(row, is_const2);
+            if ((arr1.array_nullmap_data && arr1.array_nullmap_data[row1]) ||
+                (arr2.array_nullmap_data && arr2.array_nullmap_data[row2])) {
                 dst_null_data[row] = true;
                 continue;
             }
 
             dst_null_data[row] = false;
-            if (offsets1[row] != offsets2[row]) [[unlikely]] {
+            size_t begin1 = offsets1[row1 - 1];
+            size_t begin2 = offsets2[row2 - 1];
+            size_t size1 = offsets1[row1] - begin1;
+            size_t size2 = offsets2[row2] - begin2;
+            if (size1 != size2) [[unlikely]] {
                 return Status::InvalidArgument(
                         "function {} have different input element sizes of array: {} and {}",
-                        get_name(), offsets1[row] - offsets1[row - 1],
-                        offsets2[row] - offsets2[row - 1]);
+                        get_name(), size1, size2);
             }
 
             typename DistanceImpl::State st;
-            for (ssize_t pos = offsets1[row - 1]; pos < offsets1[row]; ++pos) {
-                if (arr1.nested_nullmap_data && arr1.nested_nullmap_data[pos]) {
-                    dst_null_data[row] = true;
-                    break;
-                }
-                if (arr2.nested_nullmap_data && arr2.nested_nullmap_data[pos]) {
+            if (!arr1.nested_nullmap_data && !arr2.nested_nullmap_data) {
+                _accumulate(st, get1, begin1, get2, begin2, size1);
+                dst_data[row] = DistanceImpl::finalize(st);
+                dst_null_data[row] = std::isnan(dst_data[row]);
+                continue;
+            }
+            for (size_t i = 0; i < size1; ++i) {
+                if ((arr1.nested_nullmap_data && arr1.nested_nullmap_data[begin1 + i]) ||
+                    (arr2.nested_nullmap_data && arr2.nested_nullmap_data[begin2 + i])) {
                     dst_null_data[row] = true;
                     break;
                 }
-                DistanceImpl::accumulate(st, nested_col1->get_float64(pos),
-                                         nested_col2->get_float64(pos));
+                DistanceImpl::accumulate(st, get1(begin1 + i), get2(begin2 + i));
             }
             if (!dst_null_data[row]) {
                 dst_data[row] = DistanceImpl::finalize(st);
                 dst_null_data[row] = std::isnan(dst_data[row]);
             }
         }
-
-        block.replace_by_position(
-                result, ColumnNullable::create(std::move(dst), std::move(dst_null_column)));
         return Status::OK();
     }
 
-private:
     bool _check_input_type(const DataTypePtr& type) const {
         auto array_type = remove_nullable(type);
         if (!is_array(array_type)) {
@@ -154,9 +154,31 @@ BITMAP_FUNCTION_VARIADIC(BitmapOr, bitmap_or, |=);
 BITMAP_FUNCTION_VARIADIC(BitmapAnd, bitmap_and, &=);
 BITMAP_FUNCTION_VARIADIC(BitmapXor, bitmap_xor, ^=);
 BITMAP_FUNCTION_COUNT_VARIADIC(BitmapOrCount, bitmap_or_count, |=);
-BITMAP_FUNCTION_COUNT_VARIADIC(BitmapAndCount, bitmap_and_count, &=);
+BITMAP_FUNCTION_COUNT_VARIADIC(BitmapAndCountAll, bitmap_and_count, &=);
 BITMAP_FUNCTION_COUNT_VARIADIC(BitmapXorCount, bitmap_xor_count, ^=);
 
+// The intersection of two bitmaps is counted by the containers, without copying the first bitmap
+// of each row and building the intersection.
+struct BitmapAndCount {
+    static constexpr auto name = BitmapAndCountAll::name;
+    using ResultDataType = BitmapAndCountAll::ResultDataType;
+    using ResTData = BitmapAndCountAll::ResTData;
+    static Status vector_vector(ColumnPtr argument_columns[], size_t col_size,
+                                size_t input_rows_count, ResTData& res, IColumn* res_nulls) {
+        if (col_size != 2 || argument_columns[0]->is_nullable() ||
+            argument_columns[1]->is_nullable()) {
+            return BitmapAndCountAll::vector_vector(argument_columns, col_size, input_rows_count,
+                                                    res, res_nulls);
+        }
+        const auto& lhs = assert_cast<const ColumnBitmap*>(argument_columns[0].get())->get_data();
+        const auto& rhs = assert_cast<const ColumnBitmap*>(argument_columns[1].get())->get_data();
+        for (size_t row = 0; row < input_rows_count; ++row) {
+            res[row] = lhs[row].and_cardinality(rhs[row]);
+        }
+        return Status::OK();
+    }
+};
+
 Status execute_bitmap_op_count_null_to_zero(
         FunctionContext* context, Block& block, const ColumnNumbers& arguments, size_t result,
         size_t input_rows_count,
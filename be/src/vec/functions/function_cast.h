@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <atomic>
 #include <boost/iterator/iterator_facade.hpp>
+#include <charconv>
 #include <cmath>
 #include <cstdint>
 #include <functional>
@@ -545,6 +546,13 @@ struct ConvertImplGenericToString {
 
         size_t size = col_from.size();
 
+        if (execute_int<DataTypeInt8>(block, type, col_from, result) ||
+            execute_int<DataTypeInt16>(block, type, col_from, result) ||
+            execute_int<DataTypeInt32>(block, type, col_from, result) ||
+            execute_int<DataTypeInt64>(block, type, col_from, result)) {
+            return Status::OK();
+        }
+
         auto col_to = ColumnString::create();
         col_to->reserve(size * 2);
         VectorBufferWriter write_buffer(*col_to.get());
@@ -561,6 +569,35 @@ struct ConvertImplGenericToString {
                            const size_t result, size_t /*input_rows_count*/) {
         return execute(block, arguments, result);
     }
+private:
+    // The integers are written into one buffer of the longest possible size, instead of going
+    // through the type's to_string for each row.
+    template <typename DataType>
+    static bool execute_int(Block& block, const IDataType& type, const IColumn& col_from,
+                            size_t result) {
+        using FieldType = typename DataType::FieldType;
+        const auto* column = check_and_get_column<ColumnVector<FieldType>>(col_from);
+        if (check_and_get_data_type<DataType>(&type) == nullptr || column == nullptr) {
+            return false;
+        }
+        constexpr size_t max_length = std::numeric_limits<FieldType>::digits10 + 2;
+        const auto& data = column->get_data();
+        auto col_to = ColumnString::create();
+        auto& chars = col_to->get_chars();
+        auto& offsets = col_to->get_offsets();
+        ColumnString::check_chars_length(data.size() * max_length, data.size());
+        chars.resize(data.size() * max_length);
+        offsets.resize(data.size());
+        char* begin = reinterpret_cast<char*>(chars.data());
+        char* pos = begin;
+        for (size_t i = 0; i < data.size(); ++i) {
+            pos = std::to_chars(pos, pos + max_length, data[i]).ptr;
+            offsets[i] = pos - begin;
+        }
+        chars.resize(pos - begin);
+        block.replace_by_position(result, std::move(col_to));
+        return true;
+    }
 };
 //this is for data in compound type
 struct ConvertImplGenericFromString {
@@ -984,6 +1021,27 @@ struct NameToDateTime {
     static constexpr auto name = "toDateTime";
 };
 
+// Parses the integers written as plain digits with an optional '-', which are most of the
+// strings cast to integers. There are too few digits to overflow, so the digits are checked
+// once after the loop. Any other string returns false and goes to the general parser.
+template <typename T>
+bool try_parse_plain_int(const char* data, size_t size, T& x) {
+    bool negative = std::is_signed_v<T> && size > 0 && data[0] == '-';
+    size_t i = negative;
+    if (i == size || size - i > std::numeric_limits<T>::digits10) {
+        return false;
+    }
+    T value = 0;
+    uint8_t invalid = 0;
+    for (; i < size; ++i) {
+        auto digit = static_cast<uint8_t>(data[i] - '0');
+        invalid |= digit > 9;
+        value = value * 10 + digit;
+    }
+    x = negative ? -value : value;
+    return invalid == 0;
+}
+
 template <typename DataType, typename Additions = void*, typename FromDataType = void*>
 bool try_parse_impl(typename DataType::FieldType& x, ReadBuffer& rb, FunctionContext* context,
                     Additions additions [[maybe_unused]] = Additions()) {
@@ -1522,6 +1580,10 @@ struct ConvertThroughParsing {
             offsets = &col_from_string->get_offsets();
         }
 
+        if constexpr (IsDataTypeDecimal<ToDataType>) {
+            ToDataType::check_type_precision((PrecisionScaleArg(additions).precision));
+        }
+
         size_t current_offset = 0;
         for (size_t i = 0; i < size; ++i) {
             size_t next_offset = std::is_same_v<FromDataType, DataTypeString>
@@ -1531,11 +1593,21 @@ struct ConvertThroughParsing {
                                          ? next_offset - current_offset
                                          : fixed_string_size;
 
+            if constexpr (std::is_same_v<ToDataType, DataTypeNumber<ToFieldType>> &&
+                          std::is_integral_v<ToFieldType> && !std::is_same_v<ToFieldType, UInt8>) {
+                if (try_parse_plain_int(
+                            reinterpret_cast<const char*>(&(*chars)[current_offset]), string_size,
+                            vec_to[i])) {
+                    (*vec_null_map_to)[i] = false;
+                    current_offset = next_offset;
+                    continue;
+                }
+            }
+
             ReadBuffer read_buffer(&(*chars)[current_offset], string_size);
 
             bool parsed;
             if constexpr (IsDataTypeDecimal<ToDataType>) {
-                ToDataType::check_type_precision((PrecisionScaleArg(additions).precision));
                 StringParser::ParseResult res = try_parse_decimal_impl<ToDataType>(
                         vec_to[i], read_buffer, context->state()->timezone_obj(),
                         PrecisionScaleArg(additions));
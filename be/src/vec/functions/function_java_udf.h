@@ -26,6 +26,8 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
+#include <utility>
 
 #include "common/logging.h"
 #include "common/status.h"
@@ -121,6 +123,9 @@ private:
         jmethodID executor_evaluate_id;
         jmethodID executor_close_id;
         jobject executor = nullptr;
+        // the global ref of the output params, and the input schema, built by the first call
+        jobject output_map = nullptr;
+        std::pair<std::string, std::string> input_table_schema;
         bool is_closed = false;
         bool open_successes = false;
 
@@ -144,6 +149,9 @@ private:
             env->CallNonvirtualVoidMethodA(executor, executor_cl, executor_close_id, nullptr);
             env->DeleteGlobalRef(executor);
             env->DeleteGlobalRef(executor_cl);
+            if (output_map != nullptr) {
+                env->DeleteGlobalRef(output_map);
+            }
             RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
             is_closed = true;
             return Status::OK();
@@ -32,6 +32,7 @@
 #include <boost/token_functions.hpp>
 #include <boost/tokenizer.hpp>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -227,8 +228,10 @@ rapidjson::Value* match_value(const std::vector<JsonPath>& parsed_paths, rapidjs
 template <JsonFunctionType fntype>
 rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
                                   rapidjson::Document* document) {
-    std::vector<JsonPath>* parsed_paths;
-    std::vector<JsonPath> tmp_parsed_paths;
+    // The path is usually the same for all rows, so the path parsed for the previous call is
+    // kept, instead of tokenizing the path and matching each part of it for every row.
+    static thread_local std::optional<std::string> cached_path_string;
+    static thread_local std::vector<JsonPath> cached_parsed_paths;
 
     //Cannot use '\' as the last character, return NULL
     if (path_string.back() == '\\') {
@@ -236,20 +239,24 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
         return document;
     }
 
+    if (!cached_path_string.has_value() || *cached_path_string != path_string) {
 #ifdef USE_LIBCPP
-    std::string s(path_string);
-    auto tok = get_json_token(s);
+        std::string s(path_string);
+        auto tok = get_json_token(s);
 #else
-    auto tok = get_json_token(path_string);
+        auto tok = get_json_token(path_string);
 #endif
 
-    std::vector<std::string> paths(tok.begin(), tok.end());
-    get_parsed_paths(paths, &tmp_parsed_paths);
-    if (tmp_parsed_paths.empty()) {
+        std::vector<std::string> paths(tok.begin(), tok.end());
+        cached_parsed_paths.clear();
+        get_parsed_paths(paths, &cached_parsed_paths);
+        cached_path_string = std::string(path_string);
+    }
+    if (cached_parsed_paths.empty()) {
         return document;
     }
 
-    parsed_paths = &tmp_parsed_paths;
+    const std::vector<JsonPath>* parsed_paths = &cached_parsed_paths;
 
     if (!(*parsed_paths)[0].is_valid) {
         return document;
@@ -51,6 +51,46 @@
 
 namespace doris::vectorized {
 
+// The regex of a constant pattern, with the literal every match of it contains. The rows
+// without the literal can not match, so the regex is not run on them.
+struct RegexpState {
+    std::unique_ptr<re2::RE2> re;
+    std::string required_literal;
+
+    bool may_match(const StringRef& str) const {
+        return required_literal.empty() ||
+               str.to_string_view().find(required_literal) != std::string_view::npos;
+    }
+};
+
+// The literal the pattern starts with, empty if it is not required by every match,
+// e.g. the pattern has an alternation.
+static std::string get_required_literal(const StringRef& pattern) {
+    std::string_view pattern_sv = pattern.to_string_view();
+    if (pattern_sv.find('|') != std::string_view::npos) {
+        return {};
+    }
+    std::string literal;
+    for (size_t i = pattern_sv.starts_with('^') ? 1 : 0; i < pattern_sv.size(); ++i) {
+        char c = pattern_sv[i];
+        if (std::string_view("\\^$.|?*+()[]{}").find(c) == std::string_view::npos) {
+            literal.push_back(c);
+            continue;
+        }
+        if (c == '?' || c == '*' || c == '{') {
+            // the last utf8 char may not appear
+            while (!literal.empty() && (literal.back() & 0xC0) == 0x80) {
+                literal.pop_back();
+            }
+            if (!literal.empty()) {
+                literal.pop_back();
+            }
+        }
+        break;
+    }
+    return literal;
+}
+
 struct RegexpReplaceImpl {
     static constexpr auto name = "regexp_replace";
     // 3 args
@@ -93,8 +133,9 @@ struct RegexpReplaceImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        auto* state = reinterpret_cast<RegexpState*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
+        re2::RE2* re = state != nullptr ? state->re.get() : nullptr;
         std::unique_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
         if (re == nullptr) {
             std::string error_str;
@@ -108,10 +149,17 @@ struct RegexpReplaceImpl {
             re = scoped_re.get();
         }
 
+        const auto& str = str_col->get_data_at(index_now);
+        if (state != nullptr && !state->may_match(str)) {
+            StringOP::push_value_string(str.to_string_view(), index_now, result_data,
+                                        result_offset);
+            return;
+        }
+
         re2::StringPiece replace_str = re2::StringPiece(
                 replace_col->get_data_at(index_check_const(index_now, Const)).to_string_view());
 
-        std::string result_str(str_col->get_data_at(index_now).to_string());
+        std::string result_str(str.to_string());
         re2::RE2::GlobalReplace(&result_str, *re, replace_str);
         StringOP::push_value_string(result_str, index_now, result_data, result_offset);
     }
@@ -160,8 +208,9 @@ struct RegexpReplaceOneImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        auto* state = reinterpret_cast<RegexpState*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
+        re2::RE2* re = state != nullptr ? state->re.get() : nullptr;
         std::unique_ptr<re2::RE2> scoped_re; // destroys re if state->re is nullptr
         if (re == nullptr) {
             std::string error_str;
@@ -175,10 +224,17 @@ struct RegexpReplaceOneImpl {
             re = scoped_re.get();
         }
 
+        const auto& str = str_col->get_data_at(index_now);
+        if (state != nullptr && !state->may_match(str)) {
+            StringOP::push_value_string(str.to_string_view(), index_now, result_data,
+                                        result_offset);
+            return;
+        }
+
         re2::StringPiece replace_str = re2::StringPiece(
                 replace_col->get_data_at(index_check_const(index_now, Const)).to_string_view());
 
-        std::string result_str(str_col->get_data_at(index_now).to_string());
+        std::string result_str(str.to_string());
         re2::RE2::Replace(&result_str, *re, replace_str);
         StringOP::push_value_string(result_str, index_now, result_data, result_offset);
     }
@@ -241,8 +297,9 @@ struct RegexpExtractImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        auto* state = reinterpret_cast<RegexpState*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
+        re2::RE2* re = state != nullptr ? state->re.get() : nullptr;
         std::unique_ptr<re2::RE2> scoped_re;
         if (re == nullptr) {
             std::string error_str;
@@ -256,6 +313,10 @@ struct RegexpExtractImpl {
             re = scoped_re.get();
         }
         const auto& str = str_col->get_data_at(index_now);
+        if (state != nullptr && !state->may_match(str)) {
+            StringOP::push_empty_string(index_now, result_data, result_offset);
+            return;
+        }
         re2::StringPiece str_sp = re2::StringPiece(str.data, str.size);
 
         int max_matches = 1 + re->NumberOfCapturingGroups();
@@ -317,8 +378,9 @@ struct RegexpExtractAllImpl {
                                     ColumnString::Chars& result_data,
                                     ColumnString::Offsets& result_offset, NullMap& null_map,
                                     const size_t index_now) {
-        re2::RE2* re = reinterpret_cast<re2::RE2*>(
+        auto* state = reinterpret_cast<RegexpState*>(
                 context->get_function_state(FunctionContext::THREAD_LOCAL));
+        re2::RE2* re = state != nullptr ? state->re.get() : nullptr;
         std::unique_ptr<re2::RE2> scoped_re;
         if (re == nullptr) {
             std::string error_str;
@@ -336,6 +398,10 @@ struct RegexpExtractAllImpl {
             return;
         }
         const auto& str = str_col->get_data_at(index_now);
+        if (state != nullptr && !state->may_match(str)) {
+            StringOP::push_empty_string(index_now, result_data, result_offset);
+            return;
+        }
         int max_matches = 1 + re->NumberOfCapturingGroups();
         std::vector<re2::StringPiece> res_matches;
         size_t pos = 0;
@@ -410,15 +476,15 @@ public:
                 }
 
                 std::string error_str;
-                std::unique_ptr<re2::RE2> scoped_re;
+                auto state = std::make_shared<RegexpState>();
                 bool st =
-                        StringFunctions::compile_regex(pattern, &error_str, StringRef(), scoped_re);
+                        StringFunctions::compile_regex(pattern, &error_str, StringRef(), state->re);
                 if (!st) {
                     context->set_error(error_str.c_str());
                     return Status::InvalidArgument(error_str);
                 }
-                std::shared_ptr<re2::RE2> re(scoped_re.release());
-                context->set_function_state(scope, re);
+                state->required_literal = get_required_literal(pattern);
+                context->set_function_state(scope, state);
             }
         }
         return Status::OK();
@@ -20,12 +20,16 @@
 #include <glog/logging.h>
 
 #include <algorithm>
+#include <tuple>
 #include <boost/iterator/iterator_facade.hpp>
 #include <utility>
 
 #include "geo/geo_common.h"
 #include "geo/geo_types.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -462,45 +466,93 @@ struct StContains {
     static Status execute(FunctionContext* context, Block& block, const ColumnNumbers& arguments,
                           size_t result) {
         DCHECK_EQ(arguments.size(), 2);
-        auto return_type = block.get_data_type(result);
-        auto shape1 = block.get_by_position(arguments[0]).column->convert_to_full_column_if_const();
-        auto shape2 = block.get_by_position(arguments[1]).column->convert_to_full_column_if_const();
-
-        const auto size = shape1->size();
-        MutableColumnPtr res = return_type->create_column();
-
-        int i;
-        std::vector<std::shared_ptr<GeoShape>> shapes = {nullptr, nullptr};
-        for (int row = 0; row < size; ++row) {
-            auto lhs_value = shape1->get_data_at(row);
-            auto rhs_value = shape2->get_data_at(row);
-            StringRef* strs[2] = {&lhs_value, &rhs_value};
-            for (i = 0; i < 2; ++i) {
-                shapes[i] = std::shared_ptr<GeoShape>(
-                        GeoShape::from_encoded(strs[i]->data, strs[i]->size));
-                if (shapes[i] == nullptr) {
-                    res->insert_default();
-                    break;
+        auto* state = reinterpret_cast<StContainsState*>(
+                context->get_function_state(FunctionContext::THREAD_LOCAL));
+        const auto size = block.get_by_position(arguments[0]).column->size();
+        auto res = ColumnUInt8::create(size, 0);
+        auto null_map = ColumnUInt8::create(size, 0);
+        auto& res_data = res->get_data();
+        auto& null_map_data = null_map->get_data();
+
+        // the shapes parsed once for all the rows: the constant arguments parsed in open, and
+        // the constant columns of this block
+        ColumnPtr columns[2];
+        const GeoShape* const_shapes[2] = {nullptr, nullptr};
+        std::unique_ptr<GeoShape> block_shapes[2];
+        for (int i = 0; i < 2; ++i) {
+            bool is_const = false;
+            std::tie(columns[i], is_const) =
+                    unpack_if_const(block.get_by_position(arguments[i]).column);
+            if (state != nullptr && state->shapes[i] != nullptr) {
+                const_shapes[i] = state->shapes[i].get();
+            } else if (is_const) {
+                auto value = columns[i]->get_data_at(0);
+                block_shapes[i] = GeoShape::from_encoded(value.data, value.size);
+                if (block_shapes[i] == nullptr) {
+                    memset(null_map_data.data(), 1, size);
+                    block.replace_by_position(
+                            result, ColumnNullable::create(std::move(res), std::move(null_map)));
+                    return Status::OK();
                 }
+                const_shapes[i] = block_shapes[i].get();
             }
+        }
 
-            if (i == 2) {
-                auto contains_value = shapes[0]->contains(shapes[1].get());
-                res->insert_data(const_cast<const char*>((char*)&contains_value), 0);
+        GeoPoint points[2];
+        std::unique_ptr<GeoShape> row_shapes[2];
+        for (size_t row = 0; row < size; ++row) {
+            const GeoShape* shapes[2];
+            for (int i = 0; i < 2; ++i) {
+                shapes[i] = const_shapes[i] != nullptr
+                                    ? const_shapes[i]
+                                    : decode_shape(columns[i]->get_data_at(row), &points[i],
+                                                   &row_shapes[i]);
+            }
+            if (shapes[0] == nullptr || shapes[1] == nullptr) {
+                null_map_data[row] = 1;
+                continue;
             }
+            res_data[row] = shapes[0]->contains(shapes[1]);
         }
-        block.replace_by_position(result, std::move(res));
+        block.replace_by_position(result,
+                                  ColumnNullable::create(std::move(res), std::move(null_map)));
         return Status::OK();
     }
 
+    // The points, which are the most of the rows, are decoded into `point` without allocation.
+    static const GeoShape* decode_shape(const StringRef& value, GeoPoint* point,
+                                        std::unique_ptr<GeoShape>* shape) {
+        if (value.size >= 2 && value.data[1] == GEO_SHAPE_POINT) {
+            return point->decode_from(value.data, value.size) ? point : nullptr;
+        }
+        *shape = GeoShape::from_encoded(value.data, value.size);
+        return shape->get();
+    }
+
     static Status open(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
+        if (scope != FunctionContext::THREAD_LOCAL) {
+            return Status::OK();
+        }
+        // parse the constant shapes, e.g. the fence polygon, once instead of for every row
+        auto state = std::make_shared<StContainsState>();
+        for (int i = 0; i < 2; ++i) {
+            if (context->is_col_constant(i)) {
+                const auto& column = context->get_constant_col(i)->column_ptr;
+                if (column->is_null_at(0)) {
+                    continue;
+                }
+                auto value = column->get_data_at(0);
+                state->shapes[i] = GeoShape::from_encoded(value.data, value.size);
+            }
+        }
+        context->set_function_state(scope, state);
         return Status::OK();
     }
 
     static Status close(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
         return Status::OK();
     }
-}; // namespace doris::vectorized
+};
 
 struct StGeometryFromText {
     static constexpr auto NAME = "st_geometryfromtext";
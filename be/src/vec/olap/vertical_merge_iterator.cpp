@@ -302,6 +302,15 @@ Status VerticalMergeIteratorContext::copy_rows(Block* block, size_t count) {
 
     auto start = _index_in_block;
     _index_in_block += count - 1;
+    if (start == 0 && count == src.rows() && dst.rows() == 0 && _can_swap_columns(dst)) {
+        // The whole source block comes from one run of the row sources, which is common when
+        // the rowsets hardly overlap. Hand the columns over instead of copying them, the source
+        // block is reset before loading the next batch.
+        for (size_t i = 0; i < _ori_return_cols; ++i) {
+            std::swap(src.get_by_position(i).column, dst.get_by_position(i).column);
+        }
+        return Status::OK();
+    }
     RETURN_IF_CATCH_EXCEPTION({
         for (size_t i = 0; i < _ori_return_cols; ++i) {
             auto& s_col = src.get_by_position(i);
@@ -315,6 +324,18 @@ Status VerticalMergeIteratorContext::copy_rows(Block* block, size_t count) {
     });
     return Status::OK();
 }
+bool VerticalMergeIteratorContext::_can_swap_columns(const Block& dst) const {
+    if (dst.columns() < _ori_return_cols || _block->columns() < _ori_return_cols) {
+        return false;
+    }
+    for (size_t i = 0; i < _ori_return_cols; ++i) {
+        if (!_block->get_by_position(i).type->equals(*dst.get_by_position(i).type)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // `advanced = false` when current block finished
 Status VerticalMergeIteratorContext::copy_rows(Block* block, bool advanced) {
     Block& src = *_block;
@@ -204,6 +204,9 @@ private:
     // Load next block into _block
     Status _load_next_block();
 
+    // Whether the columns of _block can be handed over to `dst` as they are
+    bool _can_swap_columns(const Block& dst) const;
+
     RowwiseIteratorUPtr _iter;
     RowsetId _rowset_id;
     size_t _ori_return_cols = 0;
@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/runtime/exchange_sender_credits.h"
+
+#include <algorithm>
+
+namespace doris::vectorized {
+
+void ExchangeSenderCredits::on_consumed(int sender, int64_t bytes, int64_t now_ns) {
+    auto& state = _senders[sender];
+    state.buffered_bytes -= bytes;
+    if (state.last_consume_ns > 0) {
+        const int64_t interval_ns = std::max(now_ns - state.last_consume_ns, MIN_INTERVAL_NS);
+        const double rate = static_cast<double>(bytes) * 1e9 / static_cast<double>(interval_ns);
+        const double new_rate = state.consume_rate == 0
+                                        ? rate
+                                        : state.consume_rate * (1 - ALPHA) + rate * ALPHA;
+        _total_rate += new_rate - state.consume_rate;
+        state.consume_rate = new_rate;
+    }
+    state.last_consume_ns = now_ns;
+}
+
+int64_t ExchangeSenderCredits::credit(int sender) const {
+    int64_t share = 0;
+    if (_total_rate > 0) {
+        auto it = _senders.find(sender);
+        const double rate = it == _senders.end() ? 0 : it->second.consume_rate;
+        share = static_cast<int64_t>(static_cast<double>(_total_credit) * rate / _total_rate);
+    } else {
+        // nothing is measured yet, every sender gets the same share
+        share = _total_credit / static_cast<int64_t>(std::max<size_t>(_senders.size(), 1));
+    }
+    return std::max(share, _min_credit);
+}
+
+} // namespace doris::vectorized
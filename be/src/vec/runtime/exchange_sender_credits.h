@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <unordered_map>
+
+namespace doris::vectorized {
+
+// Grants every sender of a sender queue of the exchange receiver a credit, the bytes of its
+// blocks the queue may buffer before the response of its next rpc is held back. Every sender
+// has one rpc in flight at most, so holding its response stops it until the credit is granted
+// again by consuming its blocks.
+//
+// The credit of a sender is its share of `total_credit` by the rate its blocks are consumed,
+// measured as a moving average, and at least `min_credit` so that a slow or new sender still
+// makes progress. So the buffered bytes of the queue are bounded while a sender which the
+// consumer drains fast is not stalled by the others.
+//
+// Not thread safe, it is guarded by the lock of the sender queue.
+class ExchangeSenderCredits {
+public:
+    ExchangeSenderCredits(int64_t total_credit, int64_t min_credit)
+            : _total_credit(total_credit), _min_credit(min_credit) {}
+
+    // A block of `bytes` of `sender` is buffered.
+    void on_received(int sender, int64_t bytes) { _senders[sender].buffered_bytes += bytes; }
+
+    // A block of `bytes` of `sender` is consumed at `now_ns`.
+    void on_consumed(int sender, int64_t bytes, int64_t now_ns);
+
+    int64_t credit(int sender) const;
+
+    // Whether the buffered bytes of `sender` exceed its credit.
+    bool exhausted(int sender) const { return buffered_bytes(sender) > credit(sender); }
+
+    int64_t buffered_bytes(int sender) const {
+        auto it = _senders.find(sender);
+        return it == _senders.end() ? 0 : it->second.buffered_bytes;
+    }
+
+private:
+    struct SenderState {
+        int64_t buffered_bytes = 0;
+        // the consumed bytes per second
+        double consume_rate = 0;
+        int64_t last_consume_ns = 0;
+    };
+
+    static constexpr double ALPHA = 0.2;
+    // the interval between two consumed blocks is taken as at least this long, so that the
+    // blocks consumed in a burst do not make up an unbounded rate
+    static constexpr int64_t MIN_INTERVAL_NS = 1000;
+
+    const int64_t _total_credit;
+    const int64_t _min_credit;
+    std::unordered_map<int, SenderState> _senders;
+    double _total_rate = 0;
+};
+
+} // namespace doris::vectorized
@@ -27,6 +27,7 @@
 
 #include "common/status.h"
 #include "vec/core/block.h"
+#include "vec/exec/join/dict_encoded_string_column.h"
 
 namespace doris {
 
@@ -62,6 +63,7 @@ struct SharedHashTableContext {
     std::shared_ptr<Arena> arena;
     std::shared_ptr<void> hash_table_variants;
     std::shared_ptr<Block> block;
+    DictEncodedStringColumns build_dict_columns;
     std::shared_ptr<std::vector<uint32_t>> build_indexes_null;
     std::map<int, SharedRuntimeFilterContext> runtime_filters;
     std::atomic<bool> signaled = false;
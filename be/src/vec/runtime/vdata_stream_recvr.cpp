@@ -33,6 +33,7 @@
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/core/materialize_block.h"
@@ -59,6 +60,13 @@ VDataStreamRecvr::SenderQueue::~SenderQueue() {
         closure_pair.first->Run();
     }
     _pending_closures.clear();
+    DCHECK(_credit_held_closures.empty());
+    for (auto& [_, closures] : _credit_held_closures) {
+        for (auto closure_pair : closures) {
+            closure_pair.first->Run();
+        }
+    }
+    _credit_held_closures.clear();
 }
 
 bool VDataStreamRecvr::SenderQueue::should_wait() {
@@ -97,9 +105,13 @@ Status VDataStreamRecvr::SenderQueue::_inner_get_batch_without_lock(Block* block
     _received_first_batch = true;
 
     DCHECK(!_block_queue.empty());
-    auto [next_block, block_byte_size] = std::move(_block_queue.front());
+    auto [next_block, block_byte_size, be_number] = std::move(_block_queue.front());
     update_blocks_memory_usage(-block_byte_size);
     _block_queue.pop_front();
+    if (_sender_credits && be_number >= 0) {
+        _sender_credits->on_consumed(be_number, block_byte_size, MonotonicNanos());
+        _release_credit_held_closures_without_lock(false);
+    }
     _record_debug_info();
     if (_block_queue.empty() && _source_dependency) {
         if (!_is_cancelled && _num_remaining_senders > 0) {
@@ -123,6 +135,21 @@ Status VDataStreamRecvr::SenderQueue::_inner_get_batch_without_lock(Block* block
     return Status::OK();
 }
 
+void VDataStreamRecvr::SenderQueue::_release_credit_held_closures_without_lock(bool all) {
+    for (auto it = _credit_held_closures.begin(); it != _credit_held_closures.end();) {
+        if (!all && _sender_credits->exhausted(it->first)) {
+            ++it;
+            continue;
+        }
+        for (auto& closure_pair : it->second) {
+            closure_pair.first->Run();
+            closure_pair.second.stop();
+            _recvr->_buffer_full_total_timer->update(closure_pair.second.elapsed_time());
+        }
+        it = _credit_held_closures.erase(it);
+    }
+}
+
 void VDataStreamRecvr::SenderQueue::try_set_dep_ready_without_lock() {
     if (!_source_dependency) {
         return;
@@ -190,12 +217,23 @@ Status VDataStreamRecvr::SenderQueue::add_block(const PBlock& pblock, int be_num
     COUNTER_UPDATE(_recvr->_rows_produced_counter, rows);
     COUNTER_UPDATE(_recvr->_blocks_produced_counter, 1);
 
-    _block_queue.emplace_back(std::move(block), block_byte_size);
+    _block_queue.emplace_back(std::move(block), block_byte_size, be_number);
     _record_debug_info();
     try_set_dep_ready_without_lock();
 
-    // if done is nullptr, this function can't delay this response
-    if (done != nullptr && _recvr->exceeds_limit(block_byte_size)) {
+    if (_sender_credits) {
+        _sender_credits->on_received(be_number, block_byte_size);
+        // if done is nullptr, this function can't delay this response
+        if (done != nullptr && _sender_credits->exhausted(be_number)) {
+            MonotonicStopWatch monotonicStopWatch;
+            monotonicStopWatch.start();
+            DCHECK(*done != nullptr);
+            _credit_held_closures[be_number].emplace_back(*done, monotonicStopWatch);
+            *done = nullptr;
+            COUNTER_UPDATE(_recvr->_sender_credit_exhausted_counter, 1);
+        }
+    } else if (done != nullptr && _recvr->exceeds_limit(block_byte_size)) {
+        // if done is nullptr, this function can't delay this response
         MonotonicStopWatch monotonicStopWatch;
         monotonicStopWatch.start();
         DCHECK(*done != nullptr);
@@ -240,7 +278,7 @@ void VDataStreamRecvr::SenderQueue::add_block(Block* block, bool use_move) {
     COUNTER_UPDATE(_recvr->_rows_produced_counter, rows);
     COUNTER_UPDATE(_recvr->_blocks_produced_counter, 1);
 
-    _block_queue.emplace_back(std::move(nblock), block_mem_size);
+    _block_queue.emplace_back(std::move(nblock), block_mem_size, -1);
     _record_debug_info();
     try_set_dep_ready_without_lock();
     _data_arrival_cv.notify_one();
@@ -310,6 +348,7 @@ void VDataStreamRecvr::SenderQueue::cancel(Status cancel_status) {
             closure_pair.first->Run();
         }
         _pending_closures.clear();
+        _release_credit_held_closures_without_lock(true);
     }
 }
 
@@ -326,6 +365,7 @@ void VDataStreamRecvr::SenderQueue::close() {
             closure_pair.first->Run();
         }
         _pending_closures.clear();
+        _release_credit_held_closures_without_lock(true);
     }
 
     // Delete any batches queued in _block_queue
@@ -376,6 +416,10 @@ VDataStreamRecvr::VDataStreamRecvr(VDataStreamMgr* stream_mgr, RuntimeState* sta
         } else {
             queue = _sender_queue_pool.add(new SenderQueue(this, num_sender_per_queue, profile));
         }
+        if (config::enable_exchange_sender_credits) {
+            // the queues share the memory of the receiver
+            queue->init_sender_credits(config::exchg_node_buffer_size_bytes / num_queues);
+        }
         _sender_queues.push_back(queue);
     }
 
@@ -395,6 +439,8 @@ VDataStreamRecvr::VDataStreamRecvr(VDataStreamMgr* stream_mgr, RuntimeState* sta
     _decompress_bytes = ADD_COUNTER(_profile, "DecompressBytes", TUnit::BYTES);
     _rows_produced_counter = ADD_COUNTER(_profile, "RowsProduced", TUnit::UNIT);
     _blocks_produced_counter = ADD_COUNTER(_profile, "BlocksProduced", TUnit::UNIT);
+    _sender_credit_exhausted_counter =
+            ADD_COUNTER(_profile, "SenderCreditExhaustedCount", TUnit::UNIT);
 }
 
 VDataStreamRecvr::~VDataStreamRecvr() {
@@ -548,7 +594,7 @@ void VDataStreamRecvr::PipSenderQueue::add_block(Block* block, bool use_move) {
         if (_is_cancelled) {
             return;
         }
-        _block_queue.emplace_back(std::move(nblock), block_mem_size);
+        _block_queue.emplace_back(std::move(nblock), block_mem_size, -1);
         _record_debug_info();
         try_set_dep_ready_without_lock();
         COUNTER_UPDATE(_recvr->_local_bytes_received_counter, block_mem_size);
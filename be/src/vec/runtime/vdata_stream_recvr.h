@@ -32,6 +32,7 @@
 #include <ostream>
 #include <sstream>
 #include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -47,6 +48,7 @@
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/runtime/exchange_sender_credits.h"
 
 namespace doris {
 class MemTracker;
@@ -171,6 +173,8 @@ private:
     RuntimeProfile::Counter* _rows_produced_counter = nullptr;
     // Number of blocks received
     RuntimeProfile::Counter* _blocks_produced_counter = nullptr;
+    // Number of rpc responses held back because the sender ran out of credit
+    RuntimeProfile::Counter* _sender_credit_exhausted_counter = nullptr;
 
     bool _enable_pipeline;
     std::vector<std::shared_ptr<pipeline::Dependency>> _sender_to_local_channel_dependency;
@@ -226,12 +230,22 @@ public:
 
     void update_blocks_memory_usage(int64_t size);
 
+    // Holds back the rpc responses of a sender by its credit of `total_credit` bytes, see
+    // ExchangeSenderCredits, instead of by the memory usage of the whole receiver.
+    void init_sender_credits(int64_t total_credit) {
+        _sender_credits = std::make_unique<ExchangeSenderCredits>(
+                total_credit, config::exchange_sender_min_credit_bytes);
+    }
+
 protected:
     friend class pipeline::ExchangeLocalState;
     Status _inner_get_batch_without_lock(Block* block, bool* eos);
 
     void try_set_dep_ready_without_lock();
 
+    // Runs the held responses of the senders which are granted credit again, or all of them.
+    void _release_credit_held_closures_without_lock(bool all);
+
     // To record information about several variables in the event of a DCHECK failure.
     //  DCHECK(_is_cancelled || !_block_queue.empty() || _num_remaining_senders == 0)
 #ifndef NDEBUG
@@ -284,7 +298,8 @@ protected:
     int _num_remaining_senders;
     std::condition_variable _data_arrival_cv;
     std::condition_variable _data_removal_cv;
-    std::list<std::pair<BlockUPtr, size_t>> _block_queue;
+    // block, allocated bytes, be_number of the sender or -1 for a local sender
+    std::list<std::tuple<BlockUPtr, size_t, int>> _block_queue;
 
     bool _received_first_batch;
     // sender_id
@@ -292,6 +307,10 @@ protected:
     // be_number => packet_seq
     std::unordered_map<int, int64_t> _packet_seq_map;
     std::deque<std::pair<google::protobuf::Closure*, MonotonicStopWatch>> _pending_closures;
+    std::unique_ptr<ExchangeSenderCredits> _sender_credits;
+    // be_number => the responses held back until the sender is granted credit again
+    std::unordered_map<int, std::deque<std::pair<google::protobuf::Closure*, MonotonicStopWatch>>>
+            _credit_held_closures;
     std::unordered_map<std::thread::id, std::unique_ptr<ThreadClosure>> _local_closure;
 
     std::shared_ptr<pipeline::Dependency> _source_dependency;
@@ -17,6 +17,7 @@
 
 #include "vec/runtime/vsorted_run_merger.h"
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -81,11 +82,11 @@ Status VSortedRunMerger::prepare(const vector<BlockSupplier>& input_runs) {
         return Status::Cancelled(e.what());
     }
 
-    for (auto& _cursor : _cursors) {
-        if (!_cursor._is_eof) {
-            _priority_queue.push(MergeSortCursor(&_cursor));
-        }
+    std::vector<MergeSortCursorImpl*> cursors;
+    for (auto& cursor : _cursors) {
+        cursors.push_back(&cursor);
     }
+    _merge_tree.init(std::move(cursors));
 
     for (const auto& cursor : _cursors) {
         if (!cursor._is_eof) {
@@ -106,22 +107,22 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     if (_pending_cursor != nullptr) {
         MergeSortCursor cursor(_pending_cursor);
         if (has_next_block(cursor)) {
-            _priority_queue.push(cursor);
+            _merge_tree.push(_pending_cursor);
         }
         _pending_cursor = nullptr;
     }
 
-    if (_priority_queue.empty()) {
+    if (_merge_tree.empty()) {
         *eos = true;
         return Status::OK();
-    } else if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+    } else if (_merge_tree.size() == 1) {
+        auto current = _merge_tree.top();
         while (_offset != 0 && current->block_ptr() != nullptr) {
             if (_offset >= current->rows - current->pos) {
                 _offset -= (current->rows - current->pos);
                 if (_pipeline_engine_enabled) {
                     _pending_cursor = current.impl;
-                    _priority_queue.pop();
+                    _merge_tree.pop();
                     return Status::OK();
                 }
                 has_next_block(current);
@@ -136,7 +137,7 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                 current->block_ptr()->swap(*output_block);
                 if (_pipeline_engine_enabled) {
                     _pending_cursor = current.impl;
-                    _priority_queue.pop();
+                    _merge_tree.pop();
                     return Status::OK();
                 }
                 *eos = !has_next_block(current);
@@ -153,7 +154,7 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                 current->block_ptr()->swap(*output_block);
                 if (_pipeline_engine_enabled) {
                     _pending_cursor = current.impl;
-                    _priority_queue.pop();
+                    _merge_tree.pop();
                     return Status::OK();
                 }
                 *eos = !has_next_block(current);
@@ -192,17 +193,18 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 
         /// Take rows from queue in right order and push to 'merged'.
         size_t merged_rows = 0;
-        while (merged_rows != _batch_size && !_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
-
-            if (_offset > 0) {
-                _offset--;
-            } else {
-                _indexs.emplace_back(current->pos);
+        while (merged_rows != _batch_size && !_merge_tree.empty()) {
+            auto current = _merge_tree.top();
+            size_t rows = _merge_tree.top_run_rows(_batch_size - merged_rows);
+            size_t skipped_rows = std::min(_offset, rows);
+            _offset -= skipped_rows;
+            for (size_t i = skipped_rows; i < rows; ++i) {
+                _indexs.emplace_back(current->pos + i);
                 _block_addrs.emplace_back(current->block_ptr());
-                ++merged_rows;
             }
+            merged_rows += rows - skipped_rows;
+            // the cursor is at the last row taken
+            current->pos += rows - 1;
 
             if (!next_heap(current)) {
                 do_insert();
@@ -229,11 +231,12 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
 bool VSortedRunMerger::next_heap(MergeSortCursor& current) {
     if (!current->is_last()) {
         current->next();
-        _priority_queue.push(current);
+        _merge_tree.update_top();
         return true;
     }
 
     _pending_cursor = current.impl;
+    _merge_tree.pop();
     return false;
 }
 
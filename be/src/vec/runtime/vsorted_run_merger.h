@@ -20,7 +20,6 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
 #include <vector>
 
 #include "common/status.h"
@@ -36,8 +35,9 @@ namespace vectorized {
 
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree that maintains the run with the next
+// rows in sorted order at the top of the tree, the consecutive rows of the top run which
+// come before all other runs are taken at once.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -55,8 +55,7 @@ public:
     virtual ~VSortedRunMerger() = default;
 
     // Prepare this merger to merge and return rows from the sorted runs in 'input_runs'.
-    // Retrieves the first batch from each run and sets up the binary heap implementing
-    // the priority queue.
+    // Retrieves the first batch from each run and sets up the loser tree.
     Status prepare(const std::vector<BlockSupplier>& input_runs);
 
     // Return the next block of sorted rows from this merger.
@@ -79,7 +78,7 @@ protected:
     bool _pipeline_engine_enabled = false;
 
     std::vector<BlockSupplierSortCursorImpl> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    SortCursorLoserTree _merge_tree;
 
     /// In pipeline engine, if a cursor needs to read one more block from supplier,
     /// we make it as a pending cursor until the supplier is readable.
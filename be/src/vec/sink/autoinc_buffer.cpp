@@ -24,6 +24,7 @@
 #include "runtime/exec_env.h"
 #include "util/runtime_profile.h"
 #include "util/thrift_rpc_helper.h"
+#include "util/time.h"
 #include "vec/sink/vtablet_block_convertor.h"
 
 namespace doris::vectorized {
@@ -49,37 +50,51 @@ void AutoIncIDBuffer::_wait_for_prefetching() {
 Status AutoIncIDBuffer::sync_request_ids(size_t length,
                                          std::vector<std::pair<int64_t, size_t>>* result) {
     std::unique_lock<std::mutex> lock(_mutex);
-    RETURN_IF_ERROR(_prefetch_ids(_prefetch_size()));
-    if (_front_buffer.second > 0) {
-        auto min_length = std::min(_front_buffer.second, length);
-        length -= min_length;
-        result->emplace_back(_front_buffer.first, min_length);
-        _front_buffer.first += min_length;
-        _front_buffer.second -= min_length;
-    }
-    if (length > 0) {
+    while (true) {
+        {
+            std::lock_guard<std::mutex> latch(_latch);
+            while (length > 0 && !_buffers.empty()) {
+                auto& [start, count] = _buffers.front();
+                auto min_length = std::min(count, length);
+                result->emplace_back(start, min_length);
+                start += min_length;
+                count -= min_length;
+                length -= min_length;
+                _current_volume -= min_length;
+                if (count == 0) {
+                    _buffers.pop_front();
+                }
+            }
+        }
+        if (length == 0) {
+            break;
+        }
+        // the ids run out before the next range arrives, so prefetch more from now on
+        _prefetch_scale = std::min(_prefetch_scale * 2, MAX_PREFETCH_SCALE);
+        RETURN_IF_ERROR(_prefetch_ids(length));
         _wait_for_prefetching();
         if (!_rpc_status.ok()) {
             return _rpc_status;
         }
-
-        {
-            std::lock_guard<std::mutex> lock(_backend_buffer_latch);
-            std::swap(_front_buffer, _backend_buffer);
-        }
-
-        DCHECK_LE(length, _front_buffer.second);
-        result->emplace_back(_front_buffer.first, length);
-        _front_buffer.first += length;
-        _front_buffer.second -= length;
     }
-    return Status::OK();
+    // keep a range in flight before the buffered ids run out
+    return _prefetch_ids(0);
 }
 
-Status AutoIncIDBuffer::_prefetch_ids(size_t length) {
-    if (_front_buffer.second > _low_water_level_mark() || _is_fetching) {
-        return Status::OK();
+Status AutoIncIDBuffer::_prefetch_ids(size_t min_length) {
+    {
+        std::lock_guard<std::mutex> latch(_latch);
+        if (_current_volume > _low_water_level_mark() || _is_fetching) {
+            return Status::OK();
+        }
     }
+    int64_t now_ms = MonotonicMillis();
+    if (_last_prefetch_time_ms > 0 &&
+        now_ms - _last_prefetch_time_ms > PREFETCH_SCALE_DOWN_INTERVAL_MS) {
+        _prefetch_scale = std::max<size_t>(_prefetch_scale / 2, 1);
+    }
+    _last_prefetch_time_ms = now_ms;
+    size_t length = std::max(min_length, _prefetch_size());
     TNetworkAddress master_addr = ExecEnv::GetInstance()->master_info()->network_address;
     _is_fetching = true;
     RETURN_IF_ERROR(_rpc_token->submit_func([=, this]() {
@@ -102,19 +117,24 @@ Status AutoIncIDBuffer::_prefetch_ids(size_t length) {
         LOG(INFO) << "[auto-inc-range][start=" << result.start << ",length=" << result.length
                   << "][elapsed=" << get_auto_inc_range_rpc_ns / 1000000 << " ms]";
 
-        if (!_rpc_status.ok() || result.length <= 0) {
+        if (_rpc_status.ok() && result.length <= 0) {
+            _rpc_status = Status::InternalError("Got an empty auto-increment range");
+        }
+        if (!_rpc_status.ok()) {
             LOG(WARNING) << "Failed to fetch auto-incremnt range, encounter rpc failure."
                          << "errmsg=" << _rpc_status.to_string();
+            _is_fetching = false;
             return;
         }
 
         {
-            std::lock_guard<std::mutex> lock(_backend_buffer_latch);
-            _backend_buffer = {result.start, result.length};
+            std::lock_guard<std::mutex> latch(_latch);
+            _buffers.emplace_back(result.start, result.length);
+            _current_volume += result.length;
         }
         _is_fetching = false;
     }));
     return Status::OK();
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+} // namespace doris::vectorized
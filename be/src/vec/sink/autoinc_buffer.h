@@ -56,6 +56,10 @@ class AutoIncIDBuffer {
     ENABLE_FACTORY_CREATOR(AutoIncIDBuffer);
     // GenericReader::_MIN_BATCH_SIZE = 4064
     static constexpr size_t MIN_BATCH_SIZE = 4064;
+    // the prefetch size doubles each time the buffered ids run out, up to this times the
+    // configured one, and halves when a prefetched range lasts longer than the interval below
+    static constexpr size_t MAX_PREFETCH_SCALE = 64;
+    static constexpr int64_t PREFETCH_SCALE_DOWN_INTERVAL_MS = 10000;
 
 public:
     // all public functions are thread safe
@@ -64,12 +68,14 @@ public:
     Status sync_request_ids(size_t length, std::vector<std::pair<int64_t, size_t>>* result);
 
 private:
-    Status _prefetch_ids(size_t length);
+    // start fetching a range of at least `min_length` ids if the buffered ids are below the low
+    // water level mark and no range is in flight, must hold _mutex
+    Status _prefetch_ids(size_t min_length);
     [[nodiscard]] size_t _prefetch_size() const {
-        return _batch_size * config::auto_inc_prefetch_size_ratio;
+        return _batch_size * config::auto_inc_prefetch_size_ratio * _prefetch_scale;
     }
     [[nodiscard]] size_t _low_water_level_mark() const {
-        return _batch_size * config::auto_inc_low_water_level_mark_size_ratio;
+        return _batch_size * config::auto_inc_low_water_level_mark_size_ratio * _prefetch_scale;
     };
     void _wait_for_prefetching();
 
@@ -83,9 +89,14 @@ private:
     Status _rpc_status {Status::OK()};
     std::atomic<bool> _is_fetching {false};
 
-    std::pair<int64_t, size_t> _front_buffer {0, 0};
-    std::pair<int64_t, size_t> _backend_buffer {0, 0};
-    std::mutex _backend_buffer_latch; // for _backend_buffer
+    // guarded by _mutex
+    size_t _prefetch_scale {1};
+    int64_t _last_prefetch_time_ms {0};
+
+    // the fetched ranges in the order of fetching, ids are taken from the front one
+    std::list<std::pair<int64_t, size_t>> _buffers;
+    size_t _current_volume {0};
+    std::mutex _latch; // for _buffers and _current_volume
     std::mutex _mutex;
 };
 
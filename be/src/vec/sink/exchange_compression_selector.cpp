@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/exchange_compression_selector.h"
+
+#include <algorithm>
+
+namespace doris::vectorized {
+
+segment_v2::CompressionTypePB ExchangeCompressionSelector::next_type() {
+    std::lock_guard<std::mutex> l(_lock);
+    size_t index = 0;
+    if (!_network_measured) {
+        auto it = std::find(CANDIDATES.begin(), CANDIDATES.end(), _default_type);
+        index = it == CANDIDATES.end() ? 0 : it - CANDIDATES.begin();
+    } else if (_probe_interval > 0 && ++_num_blocks % _probe_interval == 0) {
+        index = _next_probe++ % CANDIDATES.size();
+    } else {
+        double best_cost = 0;
+        for (size_t i = 0; i < CANDIDATES.size(); ++i) {
+            if (!_stats[i].measured) {
+                // measure every codec once before comparing them
+                index = i;
+                break;
+            }
+            double cost = _stats[i].compress_ns_per_byte + _stats[i].ratio * _rpc_ns_per_byte;
+            if (i == 0 || cost < best_cost) {
+                best_cost = cost;
+                index = i;
+            }
+        }
+    }
+    _stats[index].num_blocks++;
+    return CANDIDATES[index];
+}
+
+void ExchangeCompressionSelector::update_compression(segment_v2::CompressionTypePB type,
+                                                     size_t uncompressed_bytes,
+                                                     size_t compressed_bytes, int64_t compress_ns) {
+    auto it = std::find(CANDIDATES.begin(), CANDIDATES.end(), type);
+    if (it == CANDIDATES.end() || uncompressed_bytes == 0) {
+        return;
+    }
+    const double ratio = double(compressed_bytes) / uncompressed_bytes;
+    const double ns_per_byte = double(compress_ns) / uncompressed_bytes;
+
+    std::lock_guard<std::mutex> l(_lock);
+    auto& stats = _stats[it - CANDIDATES.begin()];
+    if (stats.measured) {
+        stats.ratio = _moving_average(stats.ratio, ratio);
+        stats.compress_ns_per_byte = _moving_average(stats.compress_ns_per_byte, ns_per_byte);
+    } else {
+        stats.ratio = ratio;
+        stats.compress_ns_per_byte = ns_per_byte;
+        stats.measured = true;
+    }
+}
+
+void ExchangeCompressionSelector::update_network(size_t bytes, int64_t rpc_ns) {
+    if (bytes == 0 || rpc_ns <= 0) {
+        return;
+    }
+    const double ns_per_byte = double(rpc_ns) / bytes;
+
+    std::lock_guard<std::mutex> l(_lock);
+    if (_network_measured) {
+        _rpc_ns_per_byte = _moving_average(_rpc_ns_per_byte, ns_per_byte);
+    } else {
+        _rpc_ns_per_byte = ns_per_byte;
+        _network_measured = true;
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/segment_v2.pb.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <mutex>
+
+namespace doris::vectorized {
+
+// Chooses the codec of the blocks sent to one destination instance.
+//
+// Every codec is rated by the cost of sending one uncompressed byte: the time to compress it
+// plus the time to send what is left of it, `compress_ns_per_byte + ratio * rpc_ns_per_byte`.
+// The ratio and the compression time of a codec are measured from the blocks it compressed,
+// and the rpc time from the rpcs to the destination, all as moving averages. So a fast network
+// is left uncompressed while a slow one gets the codec of the best ratio.
+//
+// The codec chosen at the moment is not measured against the others any more, so another one is
+// probed every `probe_interval` blocks to keep its estimation fresh.
+class ExchangeCompressionSelector {
+public:
+    static constexpr std::array<segment_v2::CompressionTypePB, 3> CANDIDATES = {
+            segment_v2::CompressionTypePB::NO_COMPRESSION, segment_v2::CompressionTypePB::LZ4,
+            segment_v2::CompressionTypePB::ZSTD};
+
+    // `default_type` is used until the network is measured by the first rpc.
+    ExchangeCompressionSelector(segment_v2::CompressionTypePB default_type, int64_t probe_interval)
+            : _default_type(default_type), _probe_interval(probe_interval) {}
+
+    // The codec of the next block.
+    segment_v2::CompressionTypePB next_type();
+
+    void update_compression(segment_v2::CompressionTypePB type, size_t uncompressed_bytes,
+                            size_t compressed_bytes, int64_t compress_ns);
+
+    void update_network(size_t bytes, int64_t rpc_ns);
+
+    // The number of blocks `CANDIDATES[index]` was chosen for.
+    int64_t num_blocks(size_t index) const {
+        std::lock_guard<std::mutex> l(_lock);
+        return _stats[index].num_blocks;
+    }
+
+private:
+    struct CodecStats {
+        double ratio = 1;
+        double compress_ns_per_byte = 0;
+        bool measured = false;
+        int64_t num_blocks = 0;
+    };
+
+    static double _moving_average(double average, double value) {
+        return average * (1 - ALPHA) + value * ALPHA;
+    }
+
+    static constexpr double ALPHA = 0.2;
+
+    const segment_v2::CompressionTypePB _default_type;
+    const int64_t _probe_interval;
+
+    mutable std::mutex _lock;
+    std::array<CodecStats, CANDIDATES.size()> _stats;
+    double _rpc_ns_per_byte = 0;
+    bool _network_measured = false;
+    int64_t _num_blocks = 0;
+    size_t _next_probe = 0;
+};
+
+} // namespace doris::vectorized
@@ -165,9 +165,7 @@ Status GroupCommitBlockSink::send(RuntimeState* state, vectorized::Block* input_
         _partitions.assign(rows, nullptr);
         _filter_bitmap.Reset(rows);
 
-        for (int index = 0; index < rows; index++) {
-            _vpartition->find_partition(block.get(), index, _partitions[index]);
-        }
+        _vpartition->find_partitions(block.get(), rows, _partitions);
         for (int row_index = 0; row_index < rows; row_index++) {
             if (_partitions[row_index] == nullptr) [[unlikely]] {
                 _filter_bitmap.Set(row_index, true);
@@ -134,6 +134,11 @@ LoadStreamStub::LoadStreamStub(PUniqueId load_id, int64_t src_id,
           _enable_unique_mow_for_index(mow_map) {};
 
 LoadStreamStub::~LoadStreamStub() {
+    if (_open_cntl != nullptr) {
+        // the open rpc is started but never waited, it must finish before its response is freed
+        brpc::StartCancel(_open_cntl->call_id());
+        brpc::Join(_open_cntl->call_id());
+    }
     if (_is_init.load() && !_is_closed.load()) {
         auto ret = brpc::StreamClose(_stream_id);
         LOG(INFO) << *this << " is deconstructed, close " << (ret == 0 ? "success" : "failed");
@@ -146,23 +151,34 @@ Status LoadStreamStub::open(BrpcClientCache<PBackendService_Stub>* client_cache,
                             const OlapTableSchemaParam& schema,
                             const std::vector<PTabletID>& tablets_for_schema, int total_streams,
                             int64_t idle_timeout_ms, bool enable_profile) {
+    RETURN_IF_ERROR(start_open(client_cache, node_info, txn_id, schema, tablets_for_schema,
+                               total_streams, idle_timeout_ms, enable_profile));
+    return wait_for_open();
+}
+
+Status LoadStreamStub::start_open(BrpcClientCache<PBackendService_Stub>* client_cache,
+                                  const NodeInfo& node_info, int64_t txn_id,
+                                  const OlapTableSchemaParam& schema,
+                                  const std::vector<PTabletID>& tablets_for_schema,
+                                  int total_streams, int64_t idle_timeout_ms,
+                                  bool enable_profile) {
     std::unique_lock<bthread::Mutex> lock(_open_mutex);
-    if (_is_init.load()) {
+    if (_is_init.load() || _open_cntl != nullptr) {
         return Status::OK();
     }
     _dst_id = node_info.id;
-    std::string host_port = get_host_port(node_info.host, node_info.brpc_port);
+    _host_port = get_host_port(node_info.host, node_info.brpc_port);
     brpc::StreamOptions opt;
     opt.max_buf_size = config::load_stream_max_buf_size;
     opt.idle_timeout_ms = idle_timeout_ms;
     opt.messages_in_batch = config::load_stream_messages_in_batch;
     opt.handler = new LoadStreamReplyHandler(_load_id, _dst_id, shared_from_this());
-    brpc::Controller cntl;
-    if (int ret = brpc::StreamCreate(&_stream_id, cntl, &opt)) {
+    auto cntl = std::make_unique<brpc::Controller>();
+    if (int ret = brpc::StreamCreate(&_stream_id, *cntl, &opt)) {
         delete opt.handler;
         return Status::Error<true>(ret, "Failed to create stream");
     }
-    cntl.set_timeout_ms(config::open_load_stream_timeout_ms);
+    cntl->set_timeout_ms(config::open_load_stream_timeout_ms);
     POpenLoadStreamRequest request;
     *request.mutable_load_id() = _load_id;
     request.set_src_id(_src_id);
@@ -174,24 +190,40 @@ Status LoadStreamStub::open(BrpcClientCache<PBackendService_Stub>* client_cache,
     for (auto& tablet : tablets_for_schema) {
         *request.add_tablets() = tablet;
     }
-    POpenLoadStreamResponse response;
+    _open_response = std::make_unique<POpenLoadStreamResponse>();
     // use "pooled" connection to avoid conflicts between streaming rpc and regular rpc,
     // see: https://github.com/apache/brpc/issues/392
-    const auto& stub = client_cache->get_new_client_no_cache(host_port, "baidu_std", "pooled");
-    stub->open_load_stream(&cntl, &request, &response, nullptr);
-    for (const auto& resp : response.tablet_schemas()) {
+    _open_stub = client_cache->get_new_client_no_cache(_host_port, "baidu_std", "pooled");
+    _open_stub->open_load_stream(cntl.get(), &request, _open_response.get(), brpc::DoNothing());
+    _open_cntl = std::move(cntl);
+    return Status::OK();
+}
+
+Status LoadStreamStub::wait_for_open() {
+    std::unique_lock<bthread::Mutex> lock(_open_mutex);
+    if (_is_init.load()) {
+        return Status::OK();
+    }
+    if (_open_cntl == nullptr) {
+        return Status::InternalError("Failed to open load stream to backend {}", _dst_id);
+    }
+    brpc::Join(_open_cntl->call_id());
+    auto cntl = std::move(_open_cntl);
+    auto response = std::move(_open_response);
+    _open_stub.reset();
+    for (const auto& resp : response->tablet_schemas()) {
         auto tablet_schema = std::make_unique<TabletSchema>();
         tablet_schema->init_from_pb(resp.tablet_schema());
         _tablet_schema_for_index->emplace(resp.index_id(), std::move(tablet_schema));
         _enable_unique_mow_for_index->emplace(resp.index_id(),
                                               resp.enable_unique_key_merge_on_write());
     }
-    if (cntl.Failed()) {
+    if (cntl->Failed()) {
         brpc::StreamClose(_stream_id);
         return Status::InternalError("Failed to connect to backend {}: {}", _dst_id,
-                                     cntl.ErrorText());
+                                     cntl->ErrorText());
     }
-    LOG(INFO) << "open load stream to " << host_port << ", " << *this;
+    LOG(INFO) << "open load stream to " << _host_port << ", " << *this;
     _is_init.store(true);
     return Status::OK();
 }
@@ -130,6 +130,16 @@ public:
                 const std::vector<PTabletID>& tablets_for_schema, int total_streams,
                 int64_t idle_timeout_ms, bool enable_profile);
 
+    // Send the open_load_stream rpc without waiting for its response, so that the streams to
+    // all the backends are opened concurrently. wait_for_open() must be called before the stream
+    // is used.
+    Status start_open(BrpcClientCache<PBackendService_Stub>* client_cache,
+                      const NodeInfo& node_info, int64_t txn_id, const OlapTableSchemaParam& schema,
+                      const std::vector<PTabletID>& tablets_for_schema, int total_streams,
+                      int64_t idle_timeout_ms, bool enable_profile);
+
+    Status wait_for_open();
+
 // for mock this class in UT
 #ifdef BE_TEST
     virtual
@@ -238,6 +248,11 @@ protected:
     Status _cancel_reason;
 
     bthread::Mutex _open_mutex;
+    // the open_load_stream rpc in flight, see start_open()
+    std::unique_ptr<brpc::Controller> _open_cntl;
+    std::unique_ptr<POpenLoadStreamResponse> _open_response;
+    std::shared_ptr<PBackendService_Stub> _open_stub;
+    std::string _host_port;
     bthread::Mutex _close_mutex;
     bthread::Mutex _cancel_mutex;
     bthread::ConditionVariable _close_cv;
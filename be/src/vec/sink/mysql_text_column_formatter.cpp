@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/mysql_text_column_formatter.h"
+
+#include <fmt/compile.h>
+#include <fmt/format.h>
+
+#include "common/logging.h"
+#include "util/binary_cast.hpp"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_time_v2.h"
+#include "vec/runtime/vdatetime_value.h"
+
+namespace doris::vectorized {
+
+// the flag of a null cell
+static constexpr char NULL_CELL = static_cast<char>(251);
+// "-9223372036854775808"
+static constexpr size_t MAX_INTEGER_WIDTH = 20;
+// "9999-12-31 23:59:59.999999" and the trailing '\0' written by to_string
+static constexpr size_t MAX_DATETIME_WIDTH = 27;
+
+bool MysqlTextColumnFormatter::is_supported(const DataTypePtr& type) {
+    switch (remove_nullable(type)->get_type_id()) {
+    case TypeIndex::Int8:
+    case TypeIndex::Int16:
+    case TypeIndex::Int32:
+    case TypeIndex::Int64:
+    case TypeIndex::DateV2:
+    case TypeIndex::DateTimeV2:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void MysqlTextColumnFormatter::format(const IColumn& column, const DataTypePtr& type,
+                                      bool is_const, size_t rows) {
+    _is_const = is_const;
+    rows = is_const ? 1 : rows;
+    const IColumn* values = &column;
+    const NullMap* null_map = nullptr;
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        values = &nullable->get_nested_column();
+        null_map = &nullable->get_null_map_data();
+    }
+
+    auto format_integer = [](auto value, char* to) {
+        return fmt::format_to(to, FMT_COMPILE("{}"), value);
+    };
+    const auto nested_type = remove_nullable(type);
+    switch (nested_type->get_type_id()) {
+    case TypeIndex::Int8:
+        _format<Int8>(*values, null_map, rows, MAX_INTEGER_WIDTH, format_integer);
+        break;
+    case TypeIndex::Int16:
+        _format<Int16>(*values, null_map, rows, MAX_INTEGER_WIDTH, format_integer);
+        break;
+    case TypeIndex::Int32:
+        _format<Int32>(*values, null_map, rows, MAX_INTEGER_WIDTH, format_integer);
+        break;
+    case TypeIndex::Int64:
+        _format<Int64>(*values, null_map, rows, MAX_INTEGER_WIDTH, format_integer);
+        break;
+    case TypeIndex::DateV2:
+        _format<UInt32>(*values, null_map, rows, MAX_DATETIME_WIDTH, [](UInt32 value, char* to) {
+            auto date = binary_cast<UInt32, DateV2Value<DateV2ValueType>>(value);
+            // to_string returns the end after the trailing '\0'
+            return date.to_string(to) - 1;
+        });
+        break;
+    case TypeIndex::DateTimeV2: {
+        const int scale = assert_cast<const DataTypeDateTimeV2&>(*nested_type).get_scale();
+        _format<UInt64>(*values, null_map, rows, MAX_DATETIME_WIDTH,
+                        [scale](UInt64 value, char* to) {
+                            auto datetime =
+                                    binary_cast<UInt64, DateV2Value<DateTimeV2ValueType>>(value);
+                            return datetime.to_string(to, scale) - 1;
+                        });
+        break;
+    }
+    default:
+        LOG(FATAL) << "unsupported type " << type->get_name();
+    }
+}
+
+template <typename T, typename Format>
+void MysqlTextColumnFormatter::_format(const IColumn& column, const NullMap* null_map,
+                                       size_t rows, size_t max_width, Format format) {
+    const auto& data = assert_cast<const ColumnVector<T>&>(column).get_data();
+    // a byte of length for every cell, so no cell checks the capacity
+    _chars.resize(rows * (max_width + 1));
+    _offsets.resize(rows + 1);
+    char* begin = _chars.data();
+    char* pos = begin;
+    _offsets[0] = 0;
+    for (size_t i = 0; i < rows; ++i) {
+        if (null_map != nullptr && (*null_map)[i]) {
+            *pos++ = NULL_CELL;
+        } else {
+            char* end = format(data[i], pos + 1);
+            *pos = static_cast<char>(end - pos - 1);
+            pos = end;
+        }
+        _offsets[i + 1] = pos - begin;
+    }
+}
+
+} // namespace doris::vectorized
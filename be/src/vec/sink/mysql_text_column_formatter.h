@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include "vec/columns/column.h"
+#include "vec/common/pod_array.h"
+#include "vec/common/string_ref.h"
+#include "vec/data_types/data_type.h"
+
+namespace doris::vectorized {
+
+// Formats a whole column into the cells of the mysql text protocol, the length or the null
+// flag followed by the text of the value, the same bytes as MysqlRowBuffer<false> pushes. The
+// rows are then assembled by copying the cells, instead of dispatching on the serde of every
+// cell. The buffer is reused by the next column formatted.
+class MysqlTextColumnFormatter {
+public:
+    // The integers, datev2 and datetimev2, whose text is always shorter than 251 bytes.
+    static bool is_supported(const DataTypePtr& type);
+
+    // Formats the first `rows` rows of `column`, or its only row if `is_const`.
+    void format(const IColumn& column, const DataTypePtr& type, bool is_const, size_t rows);
+
+    StringRef cell(size_t row) const {
+        const size_t index = _is_const ? 0 : row;
+        return {_chars.data() + _offsets[index], _offsets[index + 1] - _offsets[index]};
+    }
+
+private:
+    template <typename T, typename Format>
+    void _format(const IColumn& column, const NullMap* null_map, size_t rows, size_t max_width,
+                 Format format);
+
+    PaddedPODArray<char> _chars;
+    PaddedPODArray<size_t> _offsets;
+    bool _is_const = false;
+};
+
+} // namespace doris::vectorized
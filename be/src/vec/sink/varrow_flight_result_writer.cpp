@@ -65,6 +65,10 @@ Status VArrowFlightResultWriter::write(Block& input_block) {
     Block block;
     RETURN_IF_ERROR(VExprContext::get_output_block_after_execute_exprs(_output_vexpr_ctxs,
                                                                        input_block, &block));
+    // The batch shares the numeric columns of `block` instead of copying them, and stays in the
+    // result queue after this, so they must not be shared with `input_block` which is reused by
+    // the next batch.
+    input_block.set_columns(input_block.clone_empty_columns());
 
     // convert one batch
     std::shared_ptr<arrow::RecordBatch> result;
@@ -74,7 +78,7 @@ Status VArrowFlightResultWriter::write(Block& input_block) {
     {
         SCOPED_TIMER(_convert_tuple_timer);
         RETURN_IF_ERROR(convert_to_arrow_batch(block, _arrow_schema, arrow::default_memory_pool(),
-                                               &result, _timezone_obj));
+                                               &result, _timezone_obj, true));
     }
     {
         SCOPED_TIMER(_result_send_timer);
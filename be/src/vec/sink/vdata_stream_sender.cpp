@@ -50,6 +50,7 @@
 #include "vec/exprs/vexpr.h"
 #include "vec/runtime/vdata_stream_mgr.h"
 #include "vec/runtime/vdata_stream_recvr.h"
+#include "vec/sink/exchange_compression_selector.h"
 #include "vec/sink/vrow_distribution.h"
 #include "vec/sink/writer/vtablet_writer_v2.h"
 
@@ -269,7 +270,7 @@ Status Channel<Parent>::send_local_block(Status exec_status, bool eos) {
 }
 
 template <typename Parent>
-Status Channel<Parent>::send_local_block(Block* block) {
+Status Channel<Parent>::send_local_block(Block* block, bool can_be_moved) {
     SCOPED_TIMER(_parent->local_send_timer());
     if (_recvr_is_valid()) {
         if constexpr (!std::is_same_v<pipeline::ResultFileSinkLocalState, Parent>) {
@@ -277,6 +278,13 @@ Status Channel<Parent>::send_local_block(Block* block) {
             COUNTER_UPDATE(_parent->local_sent_rows(), block->rows());
             COUNTER_UPDATE(_parent->blocks_sent_counter(), 1);
         }
+        if (can_be_moved) {
+            // the caller reuses the structure of the block for its next batch
+            Block moved = block->clone_empty();
+            moved.swap(*block);
+            _local_recvr->add_block(&moved, _parent->sender_id(), true);
+            return Status::OK();
+        }
         _local_recvr->add_block(block, _parent->sender_id(), false);
         return Status::OK();
     } else {
@@ -866,7 +874,9 @@ Status BlockSerializer<Parent>::next_serialized_block(Block* block, PBlock* dest
         }
     }
 
-    if (_mutable_block->rows() >= _batch_size || eos) {
+    if (_mutable_block->rows() >= _batch_size || eos ||
+        (config::block_target_bytes > 0 &&
+         _mutable_block->bytes() >= static_cast<size_t>(config::block_target_bytes))) {
         if (!_is_local) {
             RETURN_IF_ERROR(serialize_block(dest, num_receivers));
         }
@@ -895,9 +905,18 @@ Status BlockSerializer<Parent>::serialize_block(const Block* src, PBlock* dest,
         SCOPED_TIMER(_parent->_serialize_batch_timer);
         dest->Clear();
         size_t uncompressed_bytes = 0, compressed_bytes = 0;
-        RETURN_IF_ERROR(src->serialize(
-                _parent->_state->be_exec_version(), dest, &uncompressed_bytes, &compressed_bytes,
-                _parent->compression_type(), _parent->transfer_large_data_by_brpc()));
+        const auto compression_type = _compression_selector != nullptr
+                                              ? _compression_selector->next_type()
+                                              : _parent->compression_type();
+        const int64_t compress_time = src->get_compress_time();
+        RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest,
+                                       &uncompressed_bytes, &compressed_bytes, compression_type,
+                                       _parent->transfer_large_data_by_brpc()));
+        if (_compression_selector != nullptr) {
+            _compression_selector->update_compression(compression_type, uncompressed_bytes,
+                                                      compressed_bytes,
+                                                      src->get_compress_time() - compress_time);
+        }
         COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
         COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
         COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
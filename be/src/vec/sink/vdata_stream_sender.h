@@ -75,6 +75,7 @@ class ExchangeSinkLocalState;
 namespace vectorized {
 template <typename>
 class Channel;
+class ExchangeCompressionSelector;
 class VDataStreamSender;
 
 template <typename Parent>
@@ -92,9 +93,15 @@ public:
 
     void set_is_local(bool is_local) { _is_local = is_local; }
 
+    // The codec of the serialized blocks is chosen by `selector` instead of the parent.
+    void set_compression_selector(ExchangeCompressionSelector* selector) {
+        _compression_selector = selector;
+    }
+
 private:
     Parent* _parent;
     std::unique_ptr<MutableBlock> _mutable_block;
+    ExchangeCompressionSelector* _compression_selector = nullptr;
 
     bool _is_local;
     const int _batch_size;
@@ -304,7 +311,10 @@ public:
 
     Status send_local_block(Status exec_status, bool eos = false);
 
-    Status send_local_block(Block* block);
+    // Hands the columns of `block` to the receiver on the same BE instead of copying them when
+    // `can_be_moved`, and leaves `block` with empty columns of the same structure.
+    Status send_local_block(Block* block, bool can_be_moved = false);
+
     // Flush buffered rows and close channel. This function don't wait the response
     // of close operation, client should call close_wait() to finish channel's close.
     // We split one close operation into two phases in order to make multiple channels
@@ -522,7 +532,16 @@ public:
 
     void register_exchange_buffer(pipeline::ExchangeSinkBuffer* buffer) {
         _buffer = buffer;
-        _buffer->register_sink(Channel<pipeline::ExchangeSinkLocalState>::_fragment_instance_id);
+        _buffer->register_sink(Channel<pipeline::ExchangeSinkLocalState>::_fragment_instance_id,
+                               Channel<pipeline::ExchangeSinkLocalState>::_brpc_dest_addr);
+        Channel<pipeline::ExchangeSinkLocalState>::_serializer.set_compression_selector(
+                _buffer->compression_selector(
+                        Channel<pipeline::ExchangeSinkLocalState>::_fragment_instance_id.lo));
+    }
+
+    // Serializes `src` with the codec of this channel.
+    Status serialize_block(const Block* src, PBlock* dest) {
+        return Channel<pipeline::ExchangeSinkLocalState>::_serializer.serialize_block(src, dest);
     }
 
     std::shared_ptr<pipeline::ExchangeSendCallback<PTransmitDataResult>> get_send_callback(
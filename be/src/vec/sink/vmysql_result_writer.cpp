@@ -174,8 +174,29 @@ Status VMysqlResultWriter<is_binary_format>::write(Block& input_block) {
             }
         }
 
+        // the text of the integer and date columns is formatted by column, and the rows copy it
+        std::vector<MysqlTextColumnFormatter*> formatters(num_cols, nullptr);
+        if constexpr (!is_binary_format) {
+            _column_formatters.resize(num_cols);
+            for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                const auto& type = block.get_by_position(col_idx).type;
+                if (!MysqlTextColumnFormatter::is_supported(type)) {
+                    continue;
+                }
+                const auto& argument = arguments[col_idx];
+                _column_formatters[col_idx].format(*argument.column, type, argument.is_const,
+                                                   num_rows);
+                formatters[col_idx] = &_column_formatters[col_idx];
+            }
+        }
+
         for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
             for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                if (formatters[col_idx] != nullptr) {
+                    const auto cell = formatters[col_idx]->cell(row_idx);
+                    row_buffer.push_encoded(cell.data, cell.size);
+                    continue;
+                }
                 RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
                         *(arguments[col_idx].column), row_buffer, row_idx,
                         arguments[col_idx].is_const));
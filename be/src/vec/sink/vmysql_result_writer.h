@@ -29,6 +29,7 @@
 #include "util/runtime_profile.h"
 #include "vec/data_types/data_type.h"
 #include "vec/exprs/vexpr_fwd.h"
+#include "vec/sink/mysql_text_column_formatter.h"
 
 namespace doris {
 class BufferControlBlock;
@@ -68,6 +69,9 @@ private:
 
     BufferControlBlock* _sinker = nullptr;
 
+    // the buffers of the columns formatted by column for the text protocol, reused by batches
+    std::vector<MysqlTextColumnFormatter> _column_formatters;
+
     const VExprContextSPtrs& _output_vexpr_ctxs;
 
     RuntimeProfile* _parent_profile; // parent profile from result sink. not owned
@@ -111,9 +111,14 @@ Status VTabletWriterV2::_incremental_open_streams(
             }
         }
     }
+    std::vector<std::shared_ptr<Streams>> opening_streams;
     for (int64_t dst_id : new_backends) {
         auto streams = _load_stream_map->get_or_create(dst_id);
         RETURN_IF_ERROR(_open_streams_to_backend(dst_id, *streams));
+        opening_streams.push_back(std::move(streams));
+    }
+    for (auto& streams : opening_streams) {
+        RETURN_IF_ERROR(_wait_for_streams_open(*streams));
     }
     return Status::OK();
 }
@@ -260,9 +265,23 @@ Status VTabletWriterV2::open(RuntimeState* state, RuntimeProfile* profile) {
 }
 
 Status VTabletWriterV2::_open_streams() {
+    // send the open rpcs to all the backends before waiting for any of them,
+    // so that opening the streams costs about one round trip instead of one per stream
+    std::vector<std::shared_ptr<Streams>> opening_streams;
     for (auto& [dst_id, _] : _tablets_for_node) {
         auto streams = _load_stream_map->get_or_create(dst_id);
         RETURN_IF_ERROR(_open_streams_to_backend(dst_id, *streams));
+        opening_streams.push_back(std::move(streams));
+    }
+    for (auto& streams : opening_streams) {
+        RETURN_IF_ERROR(_wait_for_streams_open(*streams));
+    }
+    return Status::OK();
+}
+
+Status VTabletWriterV2::_wait_for_streams_open(Streams& streams) {
+    for (auto& stream : streams) {
+        RETURN_IF_ERROR(stream->wait_for_open());
     }
     return Status::OK();
 }
@@ -278,15 +297,16 @@ Status VTabletWriterV2::_open_streams_to_backend(int64_t dst_id, Streams& stream
     // get tablet schema from each backend only in the 1st stream
     for (auto& stream : streams | std::ranges::views::take(1)) {
         const std::vector<PTabletID>& tablets_for_schema = _indexes_from_node[node_info->id];
-        RETURN_IF_ERROR(stream->open(_state->exec_env()->brpc_internal_client_cache(), *node_info,
-                                     _txn_id, *_schema, tablets_for_schema, _total_streams,
-                                     idle_timeout_ms, _state->enable_profile()));
+        RETURN_IF_ERROR(stream->start_open(_state->exec_env()->brpc_internal_client_cache(),
+                                           *node_info, _txn_id, *_schema, tablets_for_schema,
+                                           _total_streams, idle_timeout_ms,
+                                           _state->enable_profile()));
     }
     // for the rest streams, open without getting tablet schema
     for (auto& stream : streams | std::ranges::views::drop(1)) {
-        RETURN_IF_ERROR(stream->open(_state->exec_env()->brpc_internal_client_cache(), *node_info,
-                                     _txn_id, *_schema, {}, _total_streams, idle_timeout_ms,
-                                     _state->enable_profile()));
+        RETURN_IF_ERROR(stream->start_open(_state->exec_env()->brpc_internal_client_cache(),
+                                           *node_info, _txn_id, *_schema, {}, _total_streams,
+                                           idle_timeout_ms, _state->enable_profile()));
     }
     return Status::OK();
 }
@@ -130,6 +130,8 @@ private:
 
     Status _open_streams_to_backend(int64_t dst_id, Streams& streams);
 
+    Status _wait_for_streams_open(Streams& streams);
+
     Status _incremental_open_streams(const std::vector<TOlapTablePartition>& partitions);
 
     Status _send_new_partition_batch();
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/spill/spill_async_io.h"
+
+#include <glog/logging.h>
+
+#include <utility>
+
+#include "common/config.h"
+#include "runtime/exec_env.h"
+#include "util/threadpool.h"
+#include "vec/spill/spill_stream_manager.h"
+
+namespace doris::vectorized {
+
+void SpillAsyncIO::submit(std::function<Status()> io) {
+    DCHECK(_state == nullptr);
+    auto state = std::make_shared<State>();
+    _state = state;
+    auto task = [state, io]() {
+        Status st = io();
+        std::lock_guard l(state->lock);
+        state->status = std::move(st);
+        state->done = true;
+        state->done_cv.notify_all();
+    };
+    auto* spill_stream_mgr = ExecEnv::GetInstance()->spill_stream_mgr();
+    ThreadPool* pool = spill_stream_mgr == nullptr || !config::enable_spill_async_io
+                               ? nullptr
+                               : spill_stream_mgr->get_spill_async_io_thread_pool();
+    if (pool == nullptr || !pool->submit_func(task).ok()) {
+        task();
+    }
+}
+
+Status SpillAsyncIO::wait() {
+    if (_state == nullptr) {
+        return Status::OK();
+    }
+    auto state = std::move(_state);
+    std::unique_lock l(state->lock);
+    state->done_cv.wait(l, [&state]() { return state->done; });
+    return state->status;
+}
+
+} // namespace doris::vectorized
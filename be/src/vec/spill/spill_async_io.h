@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "common/status.h"
+
+namespace doris::vectorized {
+
+// At most one async I/O of a spill file in flight, so the spill writer can serialize the next
+// block while the previous one is being written, and the spill reader can read the next block
+// while the current one is being deserialized.
+//
+// The I/O runs on the spill async io thread pool, whose tasks never wait for other tasks, so the
+// spill tasks on the spill io thread pool can wait for them without deadlock. The buffers used by
+// the I/O must be kept alive until `wait` returns.
+class SpillAsyncIO {
+public:
+    SpillAsyncIO() = default;
+
+    ~SpillAsyncIO() { static_cast<void>(wait()); }
+
+    SpillAsyncIO(const SpillAsyncIO&) = delete;
+    SpillAsyncIO& operator=(const SpillAsyncIO&) = delete;
+
+    // Runs `io` on the pool, or here if it can not be submitted or config::enable_spill_async_io
+    // is off. The previous I/O must have been waited for.
+    void submit(std::function<Status()> io);
+
+    // Waits for the submitted I/O and returns its status, OK if there is none.
+    Status wait();
+
+    bool pending() const { return _state != nullptr; }
+
+private:
+    struct State {
+        std::mutex lock;
+        std::condition_variable done_cv;
+        bool done = false;
+        Status status;
+    };
+
+    std::shared_ptr<State> _state;
+};
+
+} // namespace doris::vectorized
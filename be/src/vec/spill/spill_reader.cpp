@@ -104,12 +104,24 @@ Status SpillReader::read(Block* block, bool* eos) {
     size_t bytes_read = 0;
     {
         SCOPED_TIMER(read_timer_);
-        RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
-                                              &bytes_read));
+        bool read_ahead = read_ahead_.pending() && read_ahead_block_index_ == read_block_index_;
+        // a failed read ahead is read again below
+        if (read_ahead_.wait().ok() && read_ahead) {
+            std::swap(read_buff_, read_ahead_buff_);
+            result.data = read_buff_.get();
+            bytes_read = bytes_to_read;
+        } else {
+            RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
+                                                  &bytes_read));
+        }
     }
     DCHECK(bytes_read == bytes_to_read);
     COUNTER_UPDATE(read_bytes_, bytes_read);
 
+    ++read_block_index_;
+    // read the next block while this one is being deserialized
+    _read_ahead(read_block_index_);
+
     if (bytes_read > 0) {
         {
             SCOPED_TIMER(deserialize_timer_);
@@ -122,12 +134,45 @@ Status SpillReader::read(Block* block, bool* eos) {
         block->clear_column_data();
     }
 
-    ++read_block_index_;
-
     return Status::OK();
 }
 
+void SpillReader::_read_ahead(size_t block_index) {
+    if (block_index >= block_count_) {
+        return;
+    }
+    size_t offset = block_start_offsets_[block_index];
+    size_t size = block_start_offsets_[block_index + 1] - offset;
+    if (size == 0) {
+        return;
+    }
+    if (read_ahead_buff_ == nullptr) {
+        try {
+            read_ahead_buff_.reset(new char[max_sub_block_size_]);
+        } catch (const std::bad_alloc&) {
+            return;
+        }
+    }
+    read_ahead_block_index_ = block_index;
+    read_ahead_.submit([reader = file_reader_, buf = read_ahead_buff_.get(), offset, size]() {
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(reader->read_at(offset, Slice(buf, size), &bytes_read));
+        if (bytes_read != size) {
+            return Status::InternalError("spill read ahead short read, offset={}, size={}, read={}",
+                                         offset, size, bytes_read);
+        }
+        return Status::OK();
+    });
+}
+
+void SpillReader::seek(size_t block_index) {
+    // the block read ahead is dropped
+    static_cast<void>(read_ahead_.wait());
+    read_block_index_ = block_index;
+}
+
 Status SpillReader::close() {
+    static_cast<void>(read_ahead_.wait());
     if (!file_reader_) {
         return Status::OK();
     }
@@ -26,6 +26,7 @@
 #include "common/status.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/runtime_profile.h"
+#include "vec/spill/spill_async_io.h"
 
 namespace doris::vectorized {
 class Block;
@@ -59,6 +60,9 @@ public:
     }
 
 private:
+    // Reads the block at `block_index` into `read_ahead_buff_` asynchronously.
+    void _read_ahead(size_t block_index);
+
     int64_t stream_id_;
     std::string file_path_;
     io::FileReaderSPtr file_reader_;
@@ -74,6 +78,11 @@ private:
     RuntimeProfile::Counter* read_timer_;
     RuntimeProfile::Counter* deserialize_timer_;
     RuntimeProfile::Counter* read_bytes_;
+
+    std::unique_ptr<char[]> read_ahead_buff_;
+    size_t read_ahead_block_index_ = 0;
+    // the last member, so the read in flight is waited for before its buffer is freed
+    SpillAsyncIO read_ahead_;
 };
 
 using SpillReaderUPtr = std::unique_ptr<SpillReader>;
@@ -92,6 +92,7 @@ Status SpillStream::prepare_spill() {
 Status SpillStream::spill_block(RuntimeState* state, const Block& block, bool eof) {
     size_t written_bytes = 0;
     RETURN_IF_ERROR(writer_->write(state, block, written_bytes));
+    spilled_block_bytes_ += block.bytes();
     if (eof) {
         RETURN_IF_ERROR(writer_->close());
         writer_.reset();
@@ -115,4 +116,9 @@ Status SpillStream::read_next_block_sync(Block* block, bool* eos) {
     return reader_->read(block, eos);
 }
 
+void SpillStream::seek_for_read(size_t block_index) {
+    DCHECK(reader_ != nullptr);
+    reader_->seek(block_index);
+}
+
 } // namespace doris::vectorized
@@ -51,6 +51,10 @@ public:
 
     size_t get_written_bytes() const { return writer_->get_written_bytes(); }
 
+    // The in memory bytes of the blocks spilled, what they take when they are read back.
+    // Unlike get_written_bytes, it is still valid after spill_eof.
+    size_t get_spilled_block_bytes() const { return spilled_block_bytes_; }
+
     Status prepare_spill();
 
     Status spill_block(RuntimeState* state, const Block& block, bool eof);
@@ -59,6 +63,9 @@ public:
 
     Status read_next_block_sync(Block* block, bool* eos);
 
+    // The next read_next_block_sync reads the block at `block_index`.
+    void seek_for_read(size_t block_index);
+
     void set_write_counters(RuntimeProfile::Counter* serialize_timer,
                             RuntimeProfile::Counter* write_block_counter,
                             RuntimeProfile::Counter* write_bytes_counter,
@@ -93,6 +100,7 @@ private:
     std::string spill_dir_;
     size_t batch_rows_;
     size_t batch_bytes_;
+    size_t spilled_block_bytes_ = 0;
 
     std::atomic_bool _is_reading = false;
 
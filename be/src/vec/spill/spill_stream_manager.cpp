@@ -32,6 +32,7 @@
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
 #include "runtime/runtime_state.h"
+#include "util/hash_util.hpp"
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
 #include "util/runtime_profile.h"
@@ -86,6 +87,12 @@ Status SpillStreamManager::init() {
                               .set_max_threads(config::spill_io_thread_pool_thread_num)
                               .set_max_queue_size(config::spill_io_thread_pool_queue_size)
                               .build(&_spill_io_thread_pool));
+    // every spill task has at most one async io in flight
+    static_cast<void>(ThreadPoolBuilder("SpillAsyncIOThreadPool")
+                              .set_min_threads(config::spill_io_thread_pool_thread_num)
+                              .set_max_threads(config::spill_io_thread_pool_thread_num)
+                              .set_max_queue_size(config::spill_io_thread_pool_queue_size)
+                              .build(&_spill_async_io_thread_pool));
 
     RETURN_IF_ERROR(Thread::create(
             "Spill", "spill_gc_thread", [this]() { this->_spill_gc_thread_callback(); },
@@ -206,6 +213,19 @@ void SpillStreamManager::delete_spill_stream(SpillStreamSPtr stream) {
     }
 }
 
+SpillDataDir* SpillStreamManager::get_capture_data_dir(const TUniqueId& query_id) {
+    if (_spill_store_map.empty()) {
+        return nullptr;
+    }
+    std::vector<SpillDataDir*> stores;
+    for (const auto& [_, store] : _spill_store_map) {
+        stores.push_back(store.get());
+    }
+    std::sort(stores.begin(), stores.end(),
+              [](SpillDataDir* a, SpillDataDir* b) { return a->path() < b->path(); });
+    return stores[HashUtil::hash64(&query_id, sizeof(query_id), 0) % stores.size()];
+}
+
 void SpillStreamManager::gc(int64_t max_file_count) {
     if (max_file_count < 1) {
         return;
@@ -326,6 +346,28 @@ Status SpillDataDir::update_capacity() {
     return Status::OK();
 }
 
+void SpillDataDir::update_write_bandwidth(size_t bytes, int64_t ns) {
+    // small writes mostly measure the syscall
+    if (bytes < MIN_BANDWIDTH_SAMPLE_BYTES || ns <= 0) {
+        return;
+    }
+    auto bytes_per_second = (int64_t)(bytes * 1000000000.0 / ns);
+    int64_t old_value = _write_bytes_per_second.load(std::memory_order_relaxed);
+    int64_t new_value;
+    do {
+        new_value = old_value == 0 ? bytes_per_second : (old_value * 7 + bytes_per_second) / 8;
+    } while (!_write_bytes_per_second.compare_exchange_weak(old_value, new_value,
+                                                            std::memory_order_relaxed));
+}
+
+segment_v2::CompressionTypePB SpillDataDir::spill_compression_type() const {
+    int64_t bytes_per_second = _write_bytes_per_second.load(std::memory_order_relaxed);
+    bool disk_bound = bytes_per_second == 0
+                              ? _storage_medium == TStorageMedium::HDD
+                              : bytes_per_second < config::spill_zstd_max_disk_bandwidth_mb << 20;
+    return disk_bound ? segment_v2::CompressionTypePB::ZSTD : segment_v2::CompressionTypePB::LZ4;
+}
+
 bool SpillDataDir::_reach_disk_capacity_limit(int64_t incoming_data_size) {
     double used_pct = _get_disk_usage(incoming_data_size);
     int64_t left_bytes = _available_bytes - incoming_data_size;
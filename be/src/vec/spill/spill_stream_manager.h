@@ -17,6 +17,8 @@
 // under the License.
 
 #pragma once
+#include <gen_cpp/segment_v2.pb.h>
+
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -64,6 +66,16 @@ public:
         return _spill_data_limit_bytes;
     }
 
+    // Records a write of `bytes` taking `ns`, for the moving average of the write bandwidth.
+    void update_write_bandwidth(size_t bytes, int64_t ns);
+
+    // The codec of the next spilled block, ZSTD when the disk is the bottleneck, see
+    // config::spill_zstd_max_disk_bandwidth_mb. Before any write has been measured, HDD is
+    // assumed to be slow and SSD fast.
+    segment_v2::CompressionTypePB spill_compression_type() const;
+
+    static constexpr size_t MIN_BANDWIDTH_SAMPLE_BYTES = 64 * 1024;
+
 private:
     bool _reach_disk_capacity_limit(int64_t incoming_data_size);
     double _get_disk_usage(int64_t incoming_data_size) const {
@@ -85,6 +97,8 @@ private:
     size_t _available_bytes = 0;
     int64_t _spill_data_bytes = 0;
     TStorageMedium::type _storage_medium;
+    // moving average of the write bandwidth in bytes/s, 0 before the first measured write
+    std::atomic<int64_t> _write_bytes_per_second = 0;
 };
 class SpillStreamManager {
 public:
@@ -108,12 +122,21 @@ public:
     // 标记SpillStream需要被删除，在GC线程中异步删除落盘文件
     void delete_spill_stream(SpillStreamSPtr spill_stream);
 
+    // The data dir of the fragments of the query captured by pipeline::FragmentCapture, the
+    // same one for all of them, nullptr if there is no spill data dir.
+    SpillDataDir* get_capture_data_dir(const TUniqueId& query_id);
+
     void async_cleanup_query(TUniqueId query_id);
 
     void gc(int64_t max_file_count);
 
     ThreadPool* get_spill_io_thread_pool() const { return _spill_io_thread_pool.get(); }
 
+    // Pool of the SpillAsyncIO of the spill writers and readers.
+    ThreadPool* get_spill_async_io_thread_pool() const {
+        return _spill_async_io_thread_pool.get();
+    }
+
 private:
     Status _init_spill_store_map();
     void _spill_gc_thread_callback();
@@ -123,6 +146,7 @@ private:
 
     CountDownLatch _stop_background_threads_latch;
     std::unique_ptr<ThreadPool> _spill_io_thread_pool;
+    std::unique_ptr<ThreadPool> _spill_async_io_thread_pool;
     scoped_refptr<Thread> _spill_gc_thread;
 
     std::atomic_uint64_t id_ = 0;
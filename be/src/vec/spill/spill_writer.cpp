@@ -24,6 +24,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/stopwatch.hpp"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::vectorized {
@@ -39,6 +40,7 @@ Status SpillWriter::close() {
         return Status::OK();
     }
     closed_ = true;
+    RETURN_IF_ERROR(_wait_for_writing());
 
     meta_.append((const char*)&max_sub_block_size_, sizeof(max_sub_block_size_));
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
@@ -95,24 +97,23 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
 Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
 
-    Status status;
     std::string buff;
 
     if (block.rows() > 0) {
         {
             PBlock pblock;
             SCOPED_TIMER(serialize_timer_);
-            status = block.serialize(
-                    BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
-                    &compressed_bytes,
-                    segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
-            RETURN_IF_ERROR(status);
+            // ZSTD for better compression ratio when the disk is slow, LZ4 for less cpu
+            RETURN_IF_ERROR(block.serialize(BeExecVersionManager::get_newest_version(), &pblock,
+                                            &uncompressed_bytes, &compressed_bytes,
+                                            data_dir_->spill_compression_type()));
             if (!pblock.SerializeToString(&buff)) {
                 return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
                         "serialize spill data error. [path={}]", file_path_);
             }
         }
-        if (data_dir_->reach_capacity_limit(buff.size())) {
+        // the block in flight is not in the spill data usage yet
+        if (data_dir_->reach_capacity_limit(buff.size() + writing_buff_.size())) {
             return Status::Error<ErrorCode::DISK_REACH_CAPACITY_LIMIT>(
                     "spill data total size exceed limit, path: {}, size limit: {}, spill data "
                     "size: {}",
@@ -120,22 +121,12 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
                     PrettyPrinter::print_bytes(data_dir_->get_spill_data_limit()),
                     PrettyPrinter::print_bytes(data_dir_->get_spill_data_bytes()));
         }
-
-        {
-            Defer defer {[&]() {
-                if (status.ok()) {
-                    data_dir_->update_spill_data_usage(buff.size());
-                }
-            }};
-            {
-                SCOPED_TIMER(write_timer_);
-                status = file_writer_->append(buff);
-                RETURN_IF_ERROR(status);
-            }
-        }
     }
 
     auto buff_size = buff.size();
+    if (buff_size > 0) {
+        RETURN_IF_ERROR(_submit_write(std::move(buff)));
+    }
     written_bytes += buff_size;
     max_sub_block_size_ = std::max(max_sub_block_size_, buff_size);
 
@@ -148,4 +139,31 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     return Status::OK();
 }
 
-} // namespace doris::vectorized
\ No newline at end of file
+Status SpillWriter::_submit_write(std::string buff) {
+    RETURN_IF_ERROR(_wait_for_writing());
+    writing_buff_ = std::move(buff);
+    async_write_.submit([this]() {
+        MonotonicStopWatch watch;
+        watch.start();
+        RETURN_IF_ERROR(file_writer_->append(writing_buff_));
+        writing_ns_ = watch.elapsed_time();
+        return Status::OK();
+    });
+    return Status::OK();
+}
+
+Status SpillWriter::_wait_for_writing() {
+    if (!async_write_.pending()) {
+        return Status::OK();
+    }
+    Status status = async_write_.wait();
+    size_t size = writing_buff_.size();
+    writing_buff_.clear();
+    RETURN_IF_ERROR(status);
+    COUNTER_UPDATE(write_timer_, writing_ns_);
+    data_dir_->update_write_bandwidth(size, writing_ns_);
+    data_dir_->update_spill_data_usage(size);
+    return Status::OK();
+}
+
+} // namespace doris::vectorized
@@ -24,6 +24,7 @@
 #include "io/fs/file_writer.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
+#include "vec/spill/spill_async_io.h"
 namespace doris {
 class RuntimeState;
 
@@ -63,6 +64,12 @@ private:
 
     Status _write_internal(const Block& block, size_t& written_bytes);
 
+    // Writes `buff` asynchronously after the previous write finishes.
+    Status _submit_write(std::string buff);
+
+    // Waits for the write in flight and accounts it.
+    Status _wait_for_writing();
+
     // not owned, point to the data dir of this rowset
     // for checking disk capacity when write data to disk.
     SpillDataDir* data_dir_ = nullptr;
@@ -82,6 +89,12 @@ private:
     RuntimeProfile::Counter* serialize_timer_;
     RuntimeProfile::Counter* write_timer_;
     RuntimeProfile::Counter* write_block_counter_;
+
+    // the block being written by `async_write_`
+    std::string writing_buff_;
+    int64_t writing_ns_ = 0;
+    // the last member, so the write in flight is waited for before the others are destroyed
+    SpillAsyncIO async_write_;
 };
 using SpillWriterUPtr = std::unique_ptr<SpillWriter>;
 } // namespace vectorized
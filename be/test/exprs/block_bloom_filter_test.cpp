@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exprs/block_bloom_filter.hpp"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+TEST(BlockBloomFilterTest, FoldSparseFilter) {
+    BlockBloomFilter filter;
+    // 64KB
+    ASSERT_TRUE(filter.init(16, 0).ok());
+    for (uint32_t i = 0; i < 100; ++i) {
+        filter.insert(i * 7919);
+    }
+    ASSERT_TRUE(filter.fold(0.5));
+    EXPECT_LT(filter.log_space_bytes(), 16);
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_TRUE(filter.find(i * 7919));
+    }
+    // the 800 bits of 100 elements fill more than half of a 128B filter
+    EXPECT_GE(filter.log_space_bytes(), 7);
+    EXPECT_EQ(1ULL << filter.log_space_bytes(), filter.directory().size);
+}
+
+TEST(BlockBloomFilterTest, NotFoldDenseFilter) {
+    BlockBloomFilter filter;
+    ASSERT_TRUE(filter.init(10, 0).ok());
+    for (uint32_t i = 0; i < 1000; ++i) {
+        filter.insert(i * 7919);
+    }
+    EXPECT_FALSE(filter.fold(0.5));
+    EXPECT_EQ(10, filter.log_space_bytes());
+}
+
+} // namespace doris
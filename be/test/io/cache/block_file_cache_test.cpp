@@ -4097,4 +4097,41 @@ TEST_F(BlockFileCacheTest, recyle_unvalid_ttl_async) {
     }
 }
 
+TEST_F(BlockFileCacheTest, shard_group_reset_capacity) {
+    io::FileCacheSettings settings;
+    settings.query_queue_size = 60;
+    settings.query_queue_elements = 5;
+    settings.index_queue_size = 20;
+    settings.index_queue_elements = 5;
+    settings.disposable_queue_size = 20;
+    settings.disposable_queue_elements = 5;
+    settings.capacity = 100;
+    settings.max_file_block_size = 10;
+    settings.max_query_cache_size = 30;
+    auto group = std::make_shared<FileCacheShardGroup>(cache_base_path, 200);
+    std::vector<std::unique_ptr<BlockFileCache>> shards;
+    for (size_t i = 0; i < 2; ++i) {
+        shards.push_back(std::make_unique<BlockFileCache>(
+                cache_base_path + "/shard_" + std::to_string(i), settings));
+        shards.back()->set_shard_group(group, i);
+        group->shards.push_back(shards.back().get());
+    }
+    // A key always belongs to the same shard.
+    auto key = io::BlockFileCache::hash("key1");
+    EXPECT_EQ(group->get_shard(key), group->get_shard(key));
+
+    shards[0]->reset_capacity(50);
+    EXPECT_EQ(shards[0]->capacity(), 50);
+    EXPECT_EQ(shards[0]->_normal_queue.get_max_size(), 30);
+    EXPECT_EQ(shards[0]->_index_queue.get_max_size(), 10);
+    EXPECT_EQ(shards[0]->_disposable_queue.get_max_size(), 10);
+
+    // Nothing is cached or evicted, so there is no demand to rebalance by.
+    config::file_cache_shard_rebalance_interval_second = 0;
+    group->rebalance();
+    EXPECT_EQ(shards[0]->capacity(), 50);
+    EXPECT_EQ(shards[1]->capacity(), 100);
+    config::file_cache_shard_rebalance_interval_second = 60;
+}
+
 } // namespace doris::io
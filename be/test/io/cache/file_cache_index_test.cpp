@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/file_cache_index.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::io {
+
+namespace fs = std::filesystem;
+
+TEST(FileCacheIndexTest, ReplayAndCheckpoint) {
+    fs::path dir = fs::current_path() / "file_cache_index_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    UInt128Wrapper key1(1);
+    UInt128Wrapper key2(2);
+    UInt128Wrapper key3(3);
+    FileCacheIndex::Entries entries;
+    bool clean = true;
+    {
+        FileCacheIndex index(dir);
+        ASSERT_TRUE(index.load(&entries, &clean).ok());
+        EXPECT_TRUE(entries.empty());
+        EXPECT_FALSE(clean);
+        ASSERT_TRUE(index.open().ok());
+        index.log_add(key1, 0, 100, 0, FileCacheType::NORMAL);
+        index.log_add(key1, 100, 50, 0, FileCacheType::NORMAL);
+        index.log_add(key2, 0, 10, 0, FileCacheType::INDEX);
+        index.log_change_type(key1, 100, FileCacheType::INDEX);
+        index.log_remove(key2, 0);
+        index.log_change_expiration(key1, 123);
+    }
+    {
+        FileCacheIndex index(dir);
+        ASSERT_TRUE(index.load(&entries, &clean).ok());
+        EXPECT_FALSE(clean);
+        EXPECT_FALSE(index.has_snapshot());
+        ASSERT_EQ(1, entries.size());
+        ASSERT_EQ(2, entries[key1].size());
+        EXPECT_EQ(100, entries[key1][0].size);
+        EXPECT_EQ(FileCacheType::NORMAL, entries[key1][0].type);
+        EXPECT_EQ(50, entries[key1][100].size);
+        EXPECT_EQ(FileCacheType::INDEX, entries[key1][100].type);
+        EXPECT_EQ(123, entries[key1][100].expiration_time);
+        ASSERT_TRUE(index.open().ok());
+        auto loaded = entries;
+        ASSERT_TRUE(index.checkpoint([&](FileCacheIndex::Entries* e) { *e = loaded; }, true).ok());
+    }
+    {
+        FileCacheIndex index(dir);
+        ASSERT_TRUE(index.load(&entries, &clean).ok());
+        EXPECT_TRUE(clean);
+        EXPECT_TRUE(index.has_snapshot());
+        ASSERT_EQ(1, entries.size());
+        EXPECT_EQ(2, entries[key1].size());
+        ASSERT_TRUE(index.open().ok());
+        index.log_add(key3, 0, 10, 0, FileCacheType::DISPOSABLE);
+    }
+    // A torn record at the tail of the log is ignored.
+    std::string last_log;
+    for (auto& file : fs::directory_iterator(dir)) {
+        auto name = file.path().filename().native();
+        if (name.starts_with("index_log_") && name > last_log) {
+            last_log = name;
+        }
+    }
+    ASSERT_EQ(FileCacheIndex::RECORD_SIZE, fs::file_size(dir / last_log));
+    {
+        std::ofstream log(dir / last_log, std::ios::app | std::ios::binary);
+        log << "torn";
+    }
+    {
+        FileCacheIndex index(dir);
+        ASSERT_TRUE(index.load(&entries, &clean).ok());
+        EXPECT_FALSE(clean);
+        ASSERT_EQ(2, entries.size());
+        EXPECT_EQ(FileCacheType::DISPOSABLE, entries[key3][0].type);
+    }
+    fs::remove_all(dir);
+}
+
+} // namespace doris::io
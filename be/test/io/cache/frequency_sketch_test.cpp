@@ -0,0 +1,41 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/frequency_sketch.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::io {
+
+TEST(FrequencySketchTest, EstimateAndSaturate) {
+    FrequencySketch sketch(1024);
+    EXPECT_EQ(1024, sketch.width());
+    EXPECT_EQ(0, sketch.estimate(1));
+    for (int i = 0; i < 5; ++i) {
+        sketch.increment(1);
+    }
+    EXPECT_EQ(5, sketch.estimate(1));
+    for (int i = 0; i < 100; ++i) {
+        sketch.increment(2);
+    }
+    EXPECT_EQ(FrequencySketch::MAX_COUNT, sketch.estimate(2));
+}
+
+} // namespace doris::io
@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/peer_file_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "io/cache/block_file_cache.h"
+
+namespace doris::io {
+
+TEST(PeerFileCacheTest, parse_hash) {
+    auto hash = BlockFileCache::hash("segment_0.dat");
+    UInt128Wrapper parsed;
+    ASSERT_TRUE(PeerFileCache::parse_hash(hash.to_string(), &parsed).ok());
+    EXPECT_TRUE(hash == parsed);
+    EXPECT_FALSE(PeerFileCache::parse_hash("1234", &parsed).ok());
+    EXPECT_FALSE(PeerFileCache::parse_hash(std::string(32, 'g'), &parsed).ok());
+}
+
+TEST(PeerFileCacheTest, peers_of) {
+    auto hash = BlockFileCache::hash("segment_0.dat");
+    std::string addresses = "be1:8040, be2:8040,be3:8040,,be4:8040";
+    auto peers = PeerFileCache::peers_of(hash, addresses, "be2:8040", 10);
+    ASSERT_EQ(3, peers.size());
+    for (const auto& peer : peers) {
+        EXPECT_NE("be2:8040", peer);
+    }
+    // the same peers in the same order for the same file
+    EXPECT_EQ(peers, PeerFileCache::peers_of(hash, addresses, "be2:8040", 10));
+    EXPECT_EQ(std::vector<std::string>(peers.begin(), peers.begin() + 2),
+              PeerFileCache::peers_of(hash, addresses, "be2:8040", 2));
+
+    // removing a peer keeps the order of the others
+    std::string removed = peers[1];
+    std::string rest;
+    for (const auto& peer : peers) {
+        if (peer != removed) {
+            rest += peer + ",";
+        }
+    }
+    auto rest_peers = PeerFileCache::peers_of(hash, rest, "be2:8040", 10);
+    ASSERT_EQ(2, rest_peers.size());
+    EXPECT_EQ(peers[0], rest_peers[0]);
+    EXPECT_EQ(peers[2], rest_peers[1]);
+}
+
+} // namespace doris::io
@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/remote_read_single_flight.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "io/cache/block_file_cache.h"
+
+namespace doris::io {
+
+class RemoteReadSingleFlightTest : public testing::Test {
+protected:
+    // fill the slice with the low byte of its file offsets
+    static Status fill(size_t offset, Slice slice) {
+        for (size_t i = 0; i < slice.size; ++i) {
+            slice.data[i] = static_cast<char>(offset + i);
+        }
+        return Status::OK();
+    }
+
+    static void wait_for_flights(size_t num) {
+        while (RemoteReadSingleFlight::instance()->num_flights() != num) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+};
+
+TEST_F(RemoteReadSingleFlightTest, coalesce) {
+    auto* single_flight = RemoteReadSingleFlight::instance();
+    auto key = BlockFileCache::hash("coalesce");
+    std::atomic<int> num_reads = 0;
+    std::atomic<bool> release = false;
+
+    std::thread leader([&] {
+        RemoteReadSingleFlight::FlightSPtr flight;
+        bool coalesced = true;
+        auto st = single_flight->read(
+                key, 0, 1024,
+                [&](Slice slice) {
+                    ++num_reads;
+                    while (!release) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    return fill(0, slice);
+                },
+                &flight, &coalesced);
+        EXPECT_TRUE(st.ok());
+        EXPECT_FALSE(coalesced);
+    });
+    wait_for_flights(1);
+
+    std::vector<std::thread> waiters;
+    std::atomic<int> num_coalesced = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        waiters.emplace_back([&, i] {
+            size_t offset = i * 100;
+            RemoteReadSingleFlight::FlightSPtr flight;
+            bool coalesced = false;
+            auto st = single_flight->read(
+                    key, offset, 100,
+                    [&](Slice slice) {
+                        ++num_reads;
+                        return fill(offset, slice);
+                    },
+                    &flight, &coalesced);
+            ASSERT_TRUE(st.ok());
+            num_coalesced += coalesced;
+            for (size_t j = 0; j < 100; ++j) {
+                ASSERT_EQ(static_cast<char>(offset + j), flight->data(offset)[j]);
+            }
+        });
+    }
+    // give the waiters time to join the flight
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    release = true;
+    leader.join();
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_EQ(1, num_reads);
+    EXPECT_EQ(4, num_coalesced);
+    EXPECT_EQ(0, single_flight->num_flights());
+}
+
+TEST_F(RemoteReadSingleFlightTest, uncovered_range) {
+    auto* single_flight = RemoteReadSingleFlight::instance();
+    auto key = BlockFileCache::hash("uncovered_range");
+    std::atomic<bool> release = false;
+
+    std::thread leader([&] {
+        RemoteReadSingleFlight::FlightSPtr flight;
+        bool coalesced = true;
+        auto st = single_flight->read(
+                key, 0, 1024,
+                [&](Slice slice) {
+                    while (!release) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    return fill(0, slice);
+                },
+                &flight, &coalesced);
+        EXPECT_TRUE(st.ok());
+    });
+    wait_for_flights(1);
+
+    // the range is not covered by the in-flight read, and the other files are never shared
+    RemoteReadSingleFlight::FlightSPtr flight;
+    bool coalesced = true;
+    auto read_func = [](Slice slice) { return fill(1000, slice); };
+    ASSERT_TRUE(single_flight->read(key, 1000, 100, read_func, &flight, &coalesced).ok());
+    EXPECT_FALSE(coalesced);
+    ASSERT_TRUE(single_flight->read(BlockFileCache::hash("other"), 0, 100, read_func, &flight,
+                                    &coalesced)
+                        .ok());
+    EXPECT_FALSE(coalesced);
+    release = true;
+    leader.join();
+}
+
+TEST_F(RemoteReadSingleFlightTest, leader_failed) {
+    auto* single_flight = RemoteReadSingleFlight::instance();
+    auto key = BlockFileCache::hash("leader_failed");
+    std::atomic<bool> release = false;
+
+    std::thread leader([&] {
+        RemoteReadSingleFlight::FlightSPtr flight;
+        bool coalesced = true;
+        auto st = single_flight->read(
+                key, 0, 1024,
+                [&](Slice) {
+                    while (!release) {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                    return Status::Cancelled("query is cancelled");
+                },
+                &flight, &coalesced);
+        EXPECT_FALSE(st.ok());
+    });
+    wait_for_flights(1);
+
+    std::thread waiter([&] {
+        RemoteReadSingleFlight::FlightSPtr flight;
+        bool coalesced = true;
+        // the waiter reads the range again after the leader failed
+        auto st = single_flight->read(
+                key, 10, 100, [](Slice slice) { return fill(10, slice); }, &flight, &coalesced);
+        ASSERT_TRUE(st.ok());
+        EXPECT_FALSE(coalesced);
+        EXPECT_EQ(static_cast<char>(10), flight->data(10)[0]);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    release = true;
+    leader.join();
+    waiter.join();
+}
+
+} // namespace doris::io
@@ -17,6 +17,7 @@
 
 #include "io/fs/local_file_system.h"
 
+#include <fcntl.h>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
@@ -29,11 +30,15 @@
 #include <filesystem>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "common/sync_point.h"
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/local_io_uring.h"
+#include "io/io_common.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
 
 namespace doris {
@@ -137,6 +142,88 @@ TEST_F(LocalFileSystemTest, WriteRead) {
     }
 }
 
+TEST_F(LocalFileSystemTest, ReadByIoUring) {
+    auto fname = fmt::format("{}/io_uring", test_dir);
+    std::string content;
+    for (int i = 0; i < 10000; ++i) {
+        content.push_back((char)('a' + i % 26));
+    }
+    auto st = save_string_file(fname, content);
+    ASSERT_TRUE(st.ok()) << st;
+
+    bool enable_io_uring = config::enable_local_file_io_uring;
+    config::enable_local_file_io_uring = true;
+    Defer defer {[&] { config::enable_local_file_io_uring = enable_io_uring; }};
+    if (io::LocalIoUring::thread_local_ring() == nullptr) {
+        GTEST_SKIP() << "io_uring is not available";
+    }
+
+    io::FileReaderSPtr file_reader;
+    st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+    char mem[4096];
+    size_t bytes_read = 0;
+    st = file_reader->read_at(1234, Slice(mem, sizeof(mem)), &bytes_read);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(sizeof(mem), bytes_read);
+    EXPECT_EQ(std::string_view(mem, bytes_read), std::string_view(content).substr(1234, 4096));
+    // the read crosses the end of the file
+    st = file_reader->read_at(8000, Slice(mem, sizeof(mem)), &bytes_read);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(2000, bytes_read);
+    EXPECT_EQ(std::string_view(mem, bytes_read), std::string_view(content).substr(8000));
+
+    // a batch larger than the ring
+    std::vector<std::string> bufs(config::local_file_io_uring_entries * 2 + 1, std::string(100, 0));
+    std::vector<io::LocalIoUring::ReadRequest> requests(bufs.size());
+    int fd = ::open(fname.c_str(), O_RDONLY);
+    ASSERT_GE(fd, 0);
+    for (size_t i = 0; i < requests.size(); ++i) {
+        requests[i] = {.fd = fd, .offset = i * 50, .buf = bufs[i].data(), .len = 100};
+    }
+    st = io::LocalIoUring::thread_local_ring()->read(requests);
+    ::close(fd);
+    ASSERT_TRUE(st.ok()) << st;
+    for (size_t i = 0; i < requests.size(); ++i) {
+        ASSERT_EQ(100, requests[i].res);
+        EXPECT_EQ(bufs[i], content.substr(i * 50, 100));
+    }
+    st = file_reader->close();
+    ASSERT_TRUE(st.ok()) << st;
+}
+
+TEST_F(LocalFileSystemTest, ReadByDirectIO) {
+    auto fname = fmt::format("{}/direct_io", test_dir);
+    std::string content;
+    for (int i = 0; i < 5 * 1024 * 1024 + 123; ++i) {
+        content.push_back((char)(i * 7));
+    }
+    auto st = save_string_file(fname, content);
+    ASSERT_TRUE(st.ok()) << st;
+
+    bool enable_direct_io = config::enable_local_file_direct_io;
+    config::enable_local_file_direct_io = true;
+    Defer defer {[&] { config::enable_local_file_direct_io = enable_direct_io; }};
+
+    io::FileReaderSPtr file_reader;
+    st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+    io::IOContext io_ctx;
+    io_ctx.reader_type = ReaderType::READER_BASE_COMPACTION;
+    std::string buf(content.size(), 0);
+    // the unaligned reads, which cross the aligned buffer and the end of the file
+    for (size_t offset : {0UL, 1UL, 4095UL, 5000UL, content.size() - 10}) {
+        size_t bytes_read = 0;
+        st = file_reader->read_at(offset, Slice(buf.data(), buf.size()), &bytes_read, &io_ctx);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(content.size() - offset, bytes_read);
+        EXPECT_TRUE(std::string_view(buf.data(), bytes_read) ==
+                    std::string_view(content).substr(offset));
+    }
+    st = file_reader->close();
+    ASSERT_TRUE(st.ok()) << st;
+}
+
 TEST_F(LocalFileSystemTest, Exist) {
     auto fname = fmt::format("{}/abc", test_dir);
     ASSERT_FALSE(check_exist(fname));
@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/io_throttler.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "io/io_common.h"
+#include "util/defer_op.h"
+
+namespace doris::io {
+
+TEST(IOThrottlerTest, priority) {
+    EXPECT_EQ(IOPriority::QUERY, IOThrottler::priority(nullptr));
+    IOContext io_ctx;
+    EXPECT_EQ(IOPriority::QUERY, IOThrottler::priority(&io_ctx));
+    io_ctx.reader_type = ReaderType::READER_CUMULATIVE_COMPACTION;
+    EXPECT_EQ(IOPriority::COMPACTION, IOThrottler::priority(&io_ctx));
+    io_ctx.reader_type = ReaderType::READER_ALTER_TABLE;
+    EXPECT_EQ(IOPriority::SCHEMA_CHANGE, IOThrottler::priority(&io_ctx));
+    io_ctx.reader_type = ReaderType::UNKNOWN;
+    io_ctx.is_warmup = true;
+    EXPECT_EQ(IOPriority::WARMUP, IOThrottler::priority(&io_ctx));
+}
+
+TEST(IOThrottlerTest, acquire) {
+    int64_t limit = config::compaction_read_io_limit_mb_per_sec;
+    Defer defer {[&] { config::compaction_read_io_limit_mb_per_sec = limit; }};
+    config::compaction_read_io_limit_mb_per_sec = 4;
+
+    IOContext query_ctx;
+    IOContext compaction_ctx;
+    compaction_ctx.reader_type = ReaderType::READER_BASE_COMPACTION;
+    auto& throttler = IOThrottler::instance();
+    // the queries are never throttled
+    EXPECT_EQ(0, throttler.acquire(&query_ctx, IOThrottler::Domain::LOCAL, 64 << 20));
+    // a full bucket of one second
+    EXPECT_EQ(0, throttler.acquire(&compaction_ctx, IOThrottler::Domain::LOCAL, 4 << 20));
+    // the bucket is empty now, so 1MB waits about 1/4 seconds
+    int64_t wait_us = throttler.acquire(&compaction_ctx, IOThrottler::Domain::LOCAL, 1 << 20);
+    EXPECT_GT(wait_us, 150000);
+    EXPECT_LE(wait_us, 250000);
+    // the domains have their own buckets
+    EXPECT_EQ(0, throttler.acquire(&compaction_ctx, IOThrottler::Domain::REMOTE, 1 << 20));
+
+    config::compaction_read_io_limit_mb_per_sec = 0;
+    EXPECT_EQ(0, throttler.acquire(&compaction_ctx, IOThrottler::Domain::LOCAL, 64 << 20));
+}
+
+} // namespace doris::io
@@ -86,6 +86,27 @@ TEST_F(BlockColumnPredicateTest, SINGLE_COLUMN_VEC) {
     EXPECT_EQ(pred_col->get_data()[sel_idx[0]], value);
 }
 
+TEST_F(BlockColumnPredicateTest, DENSE_COLUMN_BY_BITMASK) {
+    // 3 full batches of 32 rows and a tail of 5 rows
+    const uint16_t size = 101;
+    std::vector<int32_t> codes(size);
+    for (uint16_t i = 0; i < size; ++i) {
+        codes[i] = i % 7;
+    }
+    std::vector<uint16_t> sel(size);
+    uint16_t selected_size = evaluate_dense_column_by_bitmask(
+            size, sel.data(), [&](uint32_t idx) { return codes[idx] == 3; });
+    EXPECT_EQ(selected_size, 14);
+    for (uint16_t i = 0; i < selected_size; ++i) {
+        EXPECT_EQ(sel[i], i * 7 + 3);
+    }
+
+    selected_size = evaluate_dense_column_by_bitmask(size, sel.data(),
+                                                     [&](uint32_t idx) { return true; });
+    EXPECT_EQ(selected_size, size);
+    EXPECT_EQ(sel[size - 1], size - 1);
+}
+
 TEST_F(BlockColumnPredicateTest, AND_MUTI_COLUMN_VEC) {
     vectorized::MutableColumns block;
     block.push_back(vectorized::PredicateColumnType<TYPE_INT>::create());
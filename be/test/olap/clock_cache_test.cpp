@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/clock_cache.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "runtime/memory/lru_cache_policy.h"
+#include "runtime/memory/lru_cache_value_base.h"
+
+namespace doris {
+
+class ClockCacheTest : public testing::Test {
+public:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        CacheValue(int value_, std::atomic<int>* deleted_)
+                : LRUCacheValueBase(CachePolicy::CacheType::FOR_UT),
+                  value(value_),
+                  deleted(deleted_) {}
+        ~CacheValue() override { (*deleted)++; }
+
+        int value;
+        std::atomic<int>* deleted;
+    };
+
+    class CacheTestPolicy : public LRUCachePolicy {
+    public:
+        CacheTestPolicy(size_t capacity, uint32_t num_shards)
+                : LRUCachePolicy(CachePolicy::CacheType::FOR_UT, capacity, LRUCacheType::NUMBER,
+                                 -1, num_shards) {}
+    };
+
+    void SetUp() override {
+        _origin_clock_cache_types = config::clock_cache_types;
+        config::clock_cache_types = "DataPageCache, ForUT";
+    }
+
+    void TearDown() override { config::clock_cache_types = _origin_clock_cache_types; }
+
+    static std::string key_of(int k) { return std::to_string(k); }
+
+    void insert(LRUCachePolicy* cache, int k, int v) {
+        cache->release(cache->insert(key_of(k), new CacheValue(v, &_deleted), 1, 1));
+    }
+
+    int lookup(LRUCachePolicy* cache, int k) {
+        auto* handle = cache->lookup(key_of(k));
+        if (handle == nullptr) {
+            return -1;
+        }
+        int v = ((CacheValue*)cache->value(handle))->value;
+        cache->release(handle);
+        return v;
+    }
+
+    std::atomic<int> _deleted = 0;
+
+private:
+    std::string _origin_clock_cache_types;
+};
+
+TEST_F(ClockCacheTest, HitMissAndErase) {
+    CacheTestPolicy cache(100, 1);
+    EXPECT_TRUE(LRUCachePolicy::use_clock_cache(CachePolicy::CacheType::FOR_UT));
+    EXPECT_EQ(-1, lookup(&cache, 1));
+    insert(&cache, 1, 101);
+    insert(&cache, 2, 201);
+    EXPECT_EQ(101, lookup(&cache, 1));
+    EXPECT_EQ(201, lookup(&cache, 2));
+
+    // Replaced and erased entries are freed at once if no lookup is running.
+    insert(&cache, 1, 102);
+    EXPECT_EQ(102, lookup(&cache, 1));
+    EXPECT_EQ(1, _deleted);
+    cache.erase(key_of(2));
+    EXPECT_EQ(-1, lookup(&cache, 2));
+    EXPECT_EQ(2, _deleted);
+    EXPECT_EQ(1, cache.get_usage());
+
+    // An entry in use is freed by the last release.
+    auto* handle = cache.lookup(key_of(1));
+    cache.erase(key_of(1));
+    EXPECT_EQ(-1, lookup(&cache, 1));
+    EXPECT_EQ(2, _deleted);
+    EXPECT_EQ(102, ((CacheValue*)cache.value(handle))->value);
+    cache.release(handle);
+    EXPECT_EQ(3, _deleted);
+}
+
+TEST_F(ClockCacheTest, EvictVisitedLater) {
+    CacheTestPolicy cache(10, 1);
+    for (int i = 0; i < 10; ++i) {
+        insert(&cache, i, i);
+    }
+    // Visited entries survive one round of the clock hand.
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(i, lookup(&cache, i));
+    }
+    auto* pinned = cache.lookup(key_of(9));
+    insert(&cache, 10, 10);
+    EXPECT_EQ(10, cache.get_usage());
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(i, lookup(&cache, i));
+    }
+    int evicted = 0;
+    for (int i = 5; i < 9; ++i) {
+        evicted += lookup(&cache, i) == -1;
+    }
+    EXPECT_EQ(1, evicted);
+
+    // Entries in use are never evicted.
+    for (int i = 11; i < 30; ++i) {
+        insert(&cache, i, i);
+    }
+    EXPECT_EQ(9, lookup(&cache, 9));
+    cache.release(pinned);
+
+    cache.prune_all(true);
+    EXPECT_EQ(0, cache.get_usage());
+    EXPECT_EQ(30, _deleted);
+}
+
+TEST_F(ClockCacheTest, ConcurrentLookupAndInsert) {
+    CacheTestPolicy cache(1000, 4);
+    constexpr int NUM_KEYS = 2000;
+    std::atomic<bool> done = false;
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&] {
+            while (!done) {
+                for (int k = 0; k < NUM_KEYS; ++k) {
+                    int v = lookup(&cache, k);
+                    EXPECT_TRUE(v == -1 || v == k);
+                }
+            }
+        });
+    }
+    for (int round = 0; round < 10; ++round) {
+        for (int k = 0; k < NUM_KEYS; ++k) {
+            insert(&cache, k, k);
+        }
+    }
+    done = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_LE(cache.get_usage(), 1000);
+}
+
+} // namespace doris
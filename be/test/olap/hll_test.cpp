@@ -20,6 +20,8 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <vector>
+
 #include "gtest/gtest_pred_impl.h"
 #include "util/hash_util.hpp"
 #include "util/slice.h"
@@ -194,6 +196,37 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, MergeSerialized) {
+    // empty, explicit, sparse and full ones
+    std::vector<HyperLogLog> hlls(4);
+    std::vector<int> sizes = {0, 10, 1000, 20000};
+    for (size_t i = 0; i < hlls.size(); ++i) {
+        for (int j = 0; j < sizes[i]; ++j) {
+            hlls[i].update(hash(i * 100000 + j));
+        }
+    }
+    std::vector<uint8_t> buf(HLL_COLUMN_DEFAULT_LEN);
+    for (const auto& dst : hlls) {
+        for (const auto& src : hlls) {
+            HyperLogLog expected;
+            expected.merge(dst);
+            expected.merge(src);
+
+            HyperLogLog merged;
+            merged.merge(dst);
+            size_t len = src.serialize(buf.data());
+            EXPECT_TRUE(merged.merge_serialized(Slice(buf.data(), len)));
+            EXPECT_EQ(expected.estimate_cardinality(), merged.estimate_cardinality());
+            EXPECT_EQ(expected.to_string(), merged.to_string());
+        }
+    }
+
+    HyperLogLog hll;
+    EXPECT_FALSE(hll.merge_serialized(Slice((char*)nullptr, 0)));
+    uint8_t invalid[1] = {60};
+    EXPECT_FALSE(hll.merge_serialized(Slice(invalid, 1)));
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
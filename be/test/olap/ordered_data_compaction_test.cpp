@@ -28,6 +28,7 @@
 #include <stdint.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -487,5 +488,51 @@ TEST_F(OrderedDataCompactionTest, test_01) {
     }
 }
 
+TEST_F(OrderedDataCompactionTest, ordered_segments_in_overlapping_rowsets) {
+    auto num_input_rowset = 3;
+    auto num_segments = 3;
+    auto rows_per_segment = 100;
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    generate_input_data(num_input_rowset, num_segments, rows_per_segment, input_data);
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false, 10000, false);
+    EXPECT_TRUE(io::global_local_filesystem()->create_directory(tablet->tablet_path()).ok());
+    // the segments are marked overlapping, but their keys are ordered
+    vector<RowsetSharedPtr> input_rowsets;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        input_rowsets.push_back(create_rowset(tablet_schema, tablet, OVERLAPPING, input_data[i]));
+        EXPECT_TRUE(input_rowsets.back()->is_segments_overlapping());
+    }
+    CumulativeCompaction cu_compaction(*engine_ref, tablet);
+    cu_compaction._input_rowsets = std::move(input_rowsets);
+    EXPECT_EQ(cu_compaction.handle_ordered_data_compaction(), true);
+    auto& out_rowset = cu_compaction._output_rowset;
+    EXPECT_EQ(out_rowset->rowset_meta()->segments_overlap(), NONOVERLAPPING);
+    EXPECT_EQ(out_rowset->num_segments(), num_input_rowset * num_segments);
+    EXPECT_EQ(out_rowset->num_rows(), num_input_rowset * num_segments * rows_per_segment);
+}
+
+TEST_F(OrderedDataCompactionTest, unordered_segments_in_overlapping_rowset) {
+    auto num_input_rowset = 2;
+    auto num_segments = 2;
+    auto rows_per_segment = 100;
+    std::vector<std::vector<std::vector<std::tuple<int64_t, int64_t>>>> input_data;
+    generate_input_data(num_input_rowset, num_segments, rows_per_segment, input_data);
+    // the segments of the first rowset are in the reverse order of their keys
+    std::reverse(input_data[0].begin(), input_data[0].end());
+
+    TabletSchemaSPtr tablet_schema = create_schema();
+    TabletSharedPtr tablet = create_tablet(*tablet_schema, false, 10000, false);
+    EXPECT_TRUE(io::global_local_filesystem()->create_directory(tablet->tablet_path()).ok());
+    vector<RowsetSharedPtr> input_rowsets;
+    for (auto i = 0; i < num_input_rowset; i++) {
+        input_rowsets.push_back(create_rowset(tablet_schema, tablet, OVERLAPPING, input_data[i]));
+    }
+    CumulativeCompaction cu_compaction(*engine_ref, tablet);
+    cu_compaction._input_rowsets = std::move(input_rowsets);
+    EXPECT_EQ(cu_compaction.handle_ordered_data_compaction(), false);
+}
+
 } // namespace vectorized
 } // namespace doris
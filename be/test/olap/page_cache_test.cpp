@@ -265,4 +265,17 @@ TEST_F(StoragePageCacheTest, mixed_pages) {
     }
 }
 
+TEST(StoragePageCacheTest, InternFile) {
+    uint64_t file_id = StoragePageCache::intern_file("intern_abc", 10);
+    EXPECT_NE(0, file_id);
+    EXPECT_EQ(file_id, StoragePageCache::intern_file("intern_abc", 10));
+    // a rewritten file is a new file
+    EXPECT_NE(file_id, StoragePageCache::intern_file("intern_abc", 11));
+    EXPECT_NE(file_id, StoragePageCache::intern_file("intern_bcd", 10));
+
+    StoragePageCache::CacheKey key("intern_abc", 10, 100);
+    EXPECT_EQ(file_id, key.file_id);
+    EXPECT_EQ(16, key.encode().size());
+}
+
 } // namespace doris
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/primary_key_filter.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "olap/rowset/beta_rowset.h"
+#include "olap/rowset/rowset_meta.h"
+#include "olap/tablet_schema.h"
+
+namespace doris {
+
+class PrimaryKeyFilterTest : public testing::Test {
+protected:
+    RowsetSharedPtr create_rowset(int64_t id, int64_t num_segments) {
+        auto schema = std::make_shared<TabletSchema>();
+        RowsetMetaSharedPtr rsm(new RowsetMeta());
+        RowsetId rowset_id;
+        rowset_id.init(id);
+        rsm->set_rowset_id(rowset_id);
+        rsm->set_num_segments(num_segments);
+        rsm->set_tablet_schema(schema);
+        return std::make_shared<BetaRowset>(schema, "", rsm);
+    }
+
+    static std::vector<uint64_t> key_hashes(int begin, int end) {
+        std::vector<uint64_t> hashes;
+        for (int i = begin; i < end; ++i) {
+            std::string key = "key_" + std::to_string(i);
+            hashes.push_back(PrimaryKeyFilter::hash(Slice(key)));
+        }
+        return hashes;
+    }
+
+    static uint64_t key_hash(int i) { return key_hashes(i, i + 1)[0]; }
+};
+
+TEST_F(PrimaryKeyFilterTest, skip_covered_rowsets) {
+    PrimaryKeyFilter filter;
+    auto rs1 = create_rowset(1, 2);
+    auto rs2 = create_rowset(2, 1);
+    std::vector<RowsetSharedPtr> rowsets {rs1, rs2};
+    std::vector<bool> skip;
+
+    // rs1 is not covered until both of its segments are added
+    ASSERT_TRUE(filter.add_segment(rs1->rowset_id(), 0, key_hashes(0, 1000)).ok());
+    EXPECT_FALSE(filter.may_skip(key_hash(5000), rowsets, &skip));
+    ASSERT_TRUE(filter.add_segment(rs1->rowset_id(), 1, key_hashes(1000, 2000)).ok());
+    // adding a segment again is a no-op
+    ASSERT_TRUE(filter.add_segment(rs1->rowset_id(), 1, key_hashes(1000, 2000)).ok());
+    EXPECT_EQ(2000, filter.num_keys());
+
+    ASSERT_TRUE(filter.may_skip(key_hash(5000), rowsets, &skip));
+    EXPECT_TRUE(skip[0]);
+    EXPECT_FALSE(skip[1]);
+    // no false negative
+    for (int i = 0; i < 2000; ++i) {
+        EXPECT_FALSE(filter.may_skip(key_hash(i), rowsets, &skip));
+    }
+
+    size_t num_skipped = 0;
+    for (int i = 10000; i < 20000; ++i) {
+        num_skipped += filter.may_skip(key_hash(i), rowsets, &skip);
+    }
+    EXPECT_GT(num_skipped, 9500);
+}
+
+TEST_F(PrimaryKeyFilterTest, inherit) {
+    PrimaryKeyFilter filter;
+    auto rs1 = create_rowset(1, 1);
+    auto rs2 = create_rowset(2, 1);
+    auto output = create_rowset(3, 3);
+    std::vector<bool> skip;
+
+    ASSERT_TRUE(filter.add_segment(rs1->rowset_id(), 0, key_hashes(0, 100)).ok());
+    filter.inherit({rs1, rs2}, output);
+    EXPECT_FALSE(filter.may_skip(key_hash(1000), {output}, &skip));
+
+    ASSERT_TRUE(filter.add_segment(rs2->rowset_id(), 0, key_hashes(100, 200)).ok());
+    filter.inherit({rs1, rs2}, output);
+    ASSERT_TRUE(filter.may_skip(key_hash(1000), {output}, &skip));
+    EXPECT_TRUE(skip[0]);
+}
+
+TEST_F(PrimaryKeyFilterTest, reset_when_full) {
+    auto max_keys = config::mow_primary_key_filter_max_keys;
+    config::mow_primary_key_filter_max_keys = PrimaryKeyFilter::INITIAL_CAPACITY * 2;
+    PrimaryKeyFilter filter;
+    auto rs1 = create_rowset(1, 1);
+    auto rs2 = create_rowset(2, 1);
+    std::vector<bool> skip;
+
+    ASSERT_TRUE(filter.add_segment(rs1->rowset_id(), 0, key_hashes(0, 8000)).ok());
+    EXPECT_EQ(8000, filter.num_keys());
+    // the second bloom filter exceeds the max keys, the keys of rs1 are dropped
+    ASSERT_TRUE(filter.add_segment(rs2->rowset_id(), 0, key_hashes(8000, 16000)).ok());
+    EXPECT_EQ(8000, filter.num_keys());
+    ASSERT_TRUE(filter.may_skip(key_hash(100000), {rs1, rs2}, &skip));
+    EXPECT_FALSE(skip[0]);
+    EXPECT_TRUE(skip[1]);
+    config::mow_primary_key_filter_max_keys = max_keys;
+}
+
+} // namespace doris
@@ -107,6 +107,32 @@ TEST_F(RowsetMetaTest, TestInit) {
     do_check(rowset_meta_3);
 }
 
+TEST_F(RowsetMetaTest, TestShareTabletSchema) {
+    RowsetMetaPB rowset_meta_pb;
+    rowset_meta_pb.set_start_version(2);
+    rowset_meta_pb.set_end_version(2);
+    auto* column = rowset_meta_pb.mutable_tablet_schema()->add_column();
+    column->set_unique_id(0);
+    column->set_name("k1");
+    column->set_type("INT");
+    column->set_is_key(true);
+    rowset_meta_pb.mutable_tablet_schema()->set_schema_version(3);
+    RowsetMeta rowset_meta;
+    rowset_meta.init_from_pb(rowset_meta_pb);
+    ASSERT_NE(nullptr, rowset_meta.tablet_schema());
+
+    rowset_meta_pb.clear_tablet_schema();
+    rowset_meta_pb.set_start_version(3);
+    rowset_meta_pb.set_end_version(3);
+    RowsetMeta rowset_meta_2;
+    rowset_meta_2.init_from_pb(rowset_meta_pb);
+    EXPECT_EQ(nullptr, rowset_meta_2.tablet_schema());
+    rowset_meta_2.share_tablet_schema(rowset_meta);
+    EXPECT_EQ(rowset_meta.tablet_schema(), rowset_meta_2.tablet_schema());
+    EXPECT_EQ(3, rowset_meta_2.tablet_schema()->schema_version());
+    EXPECT_EQ(3, rowset_meta_2.start_version());
+}
+
 TEST_F(RowsetMetaTest, TestInitWithInvalidData) {
     RowsetMeta rowset_meta;
     EXPECT_FALSE(rowset_meta.init_from_json("invalid json meta data"));
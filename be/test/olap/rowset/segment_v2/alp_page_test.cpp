@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/rowset/segment_v2/alp_page.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris::segment_v2 {
+
+template <FieldType Type, typename CppType = typename TypeTraits<Type>::CppType>
+static OwnedSlice encode(const std::vector<CppType>& values) {
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    AlpPageBuilder<Type> builder(options);
+    size_t count = values.size();
+    EXPECT_TRUE(builder.add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+    EXPECT_EQ(values.size(), count);
+    return builder.finish();
+}
+
+template <FieldType Type, typename CppType = typename TypeTraits<Type>::CppType>
+static void check_decode(const Slice& page, const std::vector<CppType>& values) {
+    AlpPageDecoder<Type> decoder(page, PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    ASSERT_EQ(values.size(), decoder.count());
+
+    auto column = vectorized::ColumnVector<CppType>::create();
+    vectorized::MutableColumnPtr dst = column->get_ptr();
+    size_t n = values.size();
+    ASSERT_TRUE(decoder.next_batch(&n, dst).ok());
+    ASSERT_EQ(values.size(), n);
+    const auto& data = assert_cast<const vectorized::ColumnVector<CppType>&>(*dst).get_data();
+    for (size_t i = 0; i < values.size(); ++i) {
+        // bitwise, for NaN and -0.0
+        ASSERT_EQ(0, memcmp(&values[i], &data[i], sizeof(CppType))) << "at " << i;
+    }
+
+    std::vector<rowid_t> rowids {3, 7, 100, static_cast<rowid_t>(values.size() - 1)};
+    vectorized::MutableColumnPtr picked = vectorized::ColumnVector<CppType>::create();
+    n = rowids.size();
+    ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 0, &n, picked).ok());
+    ASSERT_EQ(rowids.size(), n);
+    const auto& picked_data =
+            assert_cast<const vectorized::ColumnVector<CppType>&>(*picked).get_data();
+    for (size_t i = 0; i < rowids.size(); ++i) {
+        EXPECT_EQ(0, memcmp(&values[rowids[i]], &picked_data[i], sizeof(CppType)));
+    }
+}
+
+TEST(AlpPageTest, decimal_doubles) {
+    std::mt19937 rng(0);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; ++i) {
+        // decimals with 2 digits, as parsed from text
+        values.push_back((static_cast<double>(rng() % 100000) - 20000) / 100);
+    }
+    // stored as exceptions
+    values[10] = std::numeric_limits<double>::quiet_NaN();
+    values[20] = -0.0;
+    values[30] = std::numeric_limits<double>::infinity();
+    values[40] = 1.0 / 3;
+
+    auto page = encode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(values);
+    EXPECT_EQ(alp::MODE_ALP, page.slice().data[0]);
+    // 17 bits of the 64 of each value are enough
+    EXPECT_LT(page.slice().size, values.size() * sizeof(double) / 3);
+    check_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(page.slice(), values);
+}
+
+TEST(AlpPageTest, decimal_floats) {
+    std::vector<float> values;
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(static_cast<float>(i % 1000) / 10);
+    }
+    auto page = encode<FieldType::OLAP_FIELD_TYPE_FLOAT>(values);
+    EXPECT_EQ(alp::MODE_ALP, page.slice().data[0]);
+    EXPECT_LT(page.slice().size, values.size() * sizeof(float) / 2);
+    check_decode<FieldType::OLAP_FIELD_TYPE_FLOAT>(page.slice(), values);
+}
+
+TEST(AlpPageTest, random_doubles) {
+    std::mt19937_64 rng(0);
+    std::uniform_real_distribution<double> dist(0, 1);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(dist(rng));
+    }
+    // the page is stored plain, not larger than the values
+    auto page = encode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(values);
+    EXPECT_EQ(alp::MODE_PLAIN, page.slice().data[0]);
+    EXPECT_EQ(alp::HEADER_SIZE + values.size() * sizeof(double), page.slice().size);
+    check_decode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(page.slice(), values);
+}
+
+TEST(AlpPageTest, choose_exponent_and_factor) {
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i * 0.5);
+    }
+    uint8_t exponent = 0;
+    uint8_t factor = 0;
+    AlpPageBuilder<FieldType::OLAP_FIELD_TYPE_DOUBLE>::choose_exponent_and_factor(
+            values.data(), values.size(), &exponent, &factor);
+    // one decimal digit
+    EXPECT_EQ(1, exponent - factor);
+}
+
+TEST(AlpPageTest, corrupted) {
+    std::vector<double> values(1000, 1.25);
+    auto page = encode<FieldType::OLAP_FIELD_TYPE_DOUBLE>(values);
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    AlpPageDecoder<FieldType::OLAP_FIELD_TYPE_DOUBLE> decoder(truncated, PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+} // namespace doris::segment_v2
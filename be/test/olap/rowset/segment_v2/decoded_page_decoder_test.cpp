@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/rowset/segment_v2/decoded_page_decoder.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris::segment_v2 {
+
+// Decodes int32 values from memory and counts the decoded values.
+class FakeInt32PageDecoder : public PageDecoder {
+public:
+    explicit FakeInt32PageDecoder(std::vector<int32_t> values) : _values(std::move(values)) {}
+
+    Status init() override { return Status::OK(); }
+
+    Status seek_to_position_in_page(size_t pos) override {
+        _cur_index = pos;
+        return Status::OK();
+    }
+
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
+        *n = std::min(*n, _values.size() - _cur_index);
+        dst->insert_many_fix_len_data((const char*)&_values[_cur_index], *n);
+        _cur_index += *n;
+        decoded_count += *n;
+        return Status::OK();
+    }
+
+    Status read_by_rowids(const rowid_t* rowids, ordinal_t page_first_ordinal, size_t* n,
+                          vectorized::MutableColumnPtr& dst) override {
+        for (size_t i = 0; i < *n; ++i) {
+            dst->insert_many_fix_len_data((const char*)&_values[rowids[i] - page_first_ordinal],
+                                          1);
+        }
+        decoded_count += *n;
+        return Status::OK();
+    }
+
+    size_t count() const override { return _values.size(); }
+
+    size_t current_index() const override { return _cur_index; }
+
+    size_t decoded_count = 0;
+
+private:
+    std::vector<int32_t> _values;
+    size_t _cur_index = 0;
+};
+
+TEST(DecodedPageDecoderTest, FillAndHit) {
+    DecodedPageCache cache(1024 * 1024, 16);
+    StoragePageCache::CacheKey key(1, 0);
+    std::vector<int32_t> values {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // Miss, the whole page is decoded into the cache at the first read.
+    auto fake = std::make_unique<FakeInt32PageDecoder>(values);
+    auto* fake_ptr = fake.get();
+    DecodedPageDecoder miss(std::move(fake), cache.lookup_column(key), &cache, key);
+    vectorized::MutableColumnPtr dst = vectorized::ColumnInt32::create();
+    size_t n = 3;
+    EXPECT_TRUE(miss.seek_to_position_in_page(2).ok());
+    EXPECT_TRUE(miss.next_batch(&n, dst).ok());
+    EXPECT_EQ(3, n);
+    EXPECT_EQ(5, miss.current_index());
+    EXPECT_EQ(values.size(), fake_ptr->decoded_count);
+    ASSERT_EQ(3, dst->size());
+    EXPECT_EQ(3, dst->get_int(0));
+    EXPECT_EQ(5, dst->get_int(2));
+
+    auto cached = cache.lookup_column(key);
+    ASSERT_NE(nullptr, cached);
+    EXPECT_EQ(values.size(), cached->size());
+
+    // Hit, nothing is decoded and the null map of a nullable column is filled.
+    fake = std::make_unique<FakeInt32PageDecoder>(values);
+    fake_ptr = fake.get();
+    DecodedPageDecoder hit(std::move(fake), cached, &cache, key);
+    dst = vectorized::ColumnNullable::create(vectorized::ColumnInt32::create(),
+                                             vectorized::ColumnUInt8::create());
+    n = 100;
+    EXPECT_TRUE(hit.seek_to_position_in_page(6).ok());
+    EXPECT_TRUE(hit.next_batch(&n, dst).ok());
+    EXPECT_EQ(2, n);
+    EXPECT_FALSE(hit.has_remaining());
+    std::vector<rowid_t> rowids {100, 103, 107};
+    n = rowids.size();
+    EXPECT_TRUE(hit.read_by_rowids(rowids.data(), 100, &n, dst).ok());
+    EXPECT_EQ(3, n);
+    EXPECT_EQ(0, fake_ptr->decoded_count);
+    ASSERT_EQ(5, dst->size());
+    auto& nullable = assert_cast<vectorized::ColumnNullable&>(*dst);
+    EXPECT_EQ(5, nullable.get_null_map_data().size());
+    EXPECT_FALSE(nullable.has_null());
+    EXPECT_EQ(7, nullable.get_nested_column().get_int(0));
+    EXPECT_EQ(8, nullable.get_nested_column().get_int(1));
+    EXPECT_EQ(1, nullable.get_nested_column().get_int(2));
+    EXPECT_EQ(4, nullable.get_nested_column().get_int(3));
+    EXPECT_EQ(8, nullable.get_nested_column().get_int(4));
+}
+
+} // namespace doris::segment_v2
@@ -0,0 +1,201 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "olap/rowset/segment_v2/fsst_page.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/segment_v2.pb.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "olap/rowset/segment_v2/binary_dict_page.h"
+#include "vec/columns/column_string.h"
+
+namespace doris::segment_v2 {
+
+static std::vector<std::string> make_urls(size_t num) {
+    std::mt19937 rng(0);
+    const char* hosts[] = {"www.example.com", "doris.apache.org", "github.com/apache"};
+    std::vector<std::string> urls;
+    for (size_t i = 0; i < num; ++i) {
+        urls.push_back(fmt::format("https://{}/path/{}?id={}", hosts[rng() % 3], rng() % 100000,
+                                   i));
+    }
+    return urls;
+}
+
+static OwnedSlice encode(const std::vector<std::string>& values) {
+    std::vector<Slice> slices(values.begin(), values.end());
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    FsstPageBuilder<FieldType::OLAP_FIELD_TYPE_VARCHAR> builder(options);
+    size_t count = slices.size();
+    EXPECT_TRUE(builder.add(reinterpret_cast<const uint8_t*>(slices.data()), &count).ok());
+    EXPECT_EQ(values.size(), count);
+    OwnedSlice page = builder.finish();
+    EXPECT_EQ(values.size(), builder.count());
+    Slice first;
+    EXPECT_TRUE(builder.get_first_value(&first).ok());
+    EXPECT_EQ(values.front(), first.to_string());
+    Slice last;
+    EXPECT_TRUE(builder.get_last_value(&last).ok());
+    EXPECT_EQ(values.back(), last.to_string());
+    return page;
+}
+
+static void check_decode(const Slice& page, const std::vector<std::string>& values) {
+    FsstPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> decoder(page, PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    ASSERT_EQ(values.size(), decoder.count());
+
+    vectorized::MutableColumnPtr dst = vectorized::ColumnString::create();
+    size_t n = values.size();
+    ASSERT_TRUE(decoder.next_batch(&n, dst).ok());
+    ASSERT_EQ(values.size(), n);
+    for (size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], dst->get_data_at(i).to_string()) << "at " << i;
+    }
+
+    ASSERT_TRUE(decoder.seek_to_position_in_page(values.size() - 2).ok());
+    vectorized::MutableColumnPtr tail = vectorized::ColumnString::create();
+    n = 10;
+    ASSERT_TRUE(decoder.next_batch(&n, tail).ok());
+    ASSERT_EQ(2, n);
+    EXPECT_EQ(values[values.size() - 1], tail->get_data_at(1).to_string());
+
+    std::vector<rowid_t> rowids {1000, 1003, 1007, static_cast<rowid_t>(1000 + values.size())};
+    vectorized::MutableColumnPtr picked = vectorized::ColumnString::create();
+    n = rowids.size();
+    ASSERT_TRUE(decoder.read_by_rowids(rowids.data(), 1000, &n, picked).ok());
+    ASSERT_EQ(3, n);
+    EXPECT_EQ(values[0], picked->get_data_at(0).to_string());
+    EXPECT_EQ(values[3], picked->get_data_at(1).to_string());
+    EXPECT_EQ(values[7], picked->get_data_at(2).to_string());
+}
+
+TEST(FsstPageTest, urls) {
+    auto values = make_urls(5000);
+    values.emplace_back("");
+    values.emplace_back(std::string("\xff\x00\xfe", 3));
+    size_t raw_size = 0;
+    for (const auto& value : values) {
+        raw_size += value.size();
+    }
+    OwnedSlice page = encode(values);
+    EXPECT_LT(page.slice().size, raw_size / 2);
+    check_decode(page.slice(), values);
+}
+
+TEST(FsstPageTest, incompressible) {
+    std::mt19937 rng(0);
+    std::vector<std::string> values;
+    for (int i = 0; i < 1000; ++i) {
+        std::string value(rng() % 32, '\0');
+        for (auto& c : value) {
+            c = static_cast<char>(rng());
+        }
+        values.push_back(std::move(value));
+    }
+    OwnedSlice page = encode(values);
+    // stored as they are, with the offsets and an empty symbol table
+    size_t raw_size = 0;
+    for (const auto& value : values) {
+        raw_size += value.size();
+    }
+    EXPECT_EQ(sizeof(uint32_t) * (values.size() + 2) + 1 + raw_size, page.slice().size);
+    check_decode(page.slice(), values);
+}
+
+TEST(FsstPageTest, match) {
+    auto values = make_urls(1000);
+    values[10] = values[20];
+    OwnedSlice page = encode(values);
+    FsstPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> decoder(page.slice(),
+                                                                PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+
+    std::vector<uint8_t> matches(values.size());
+    decoder.match_equal(Slice(values[20]), 0, values.size(), matches.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(i == 10 || i == 20, matches[i] != 0) << "at " << i;
+    }
+    decoder.match_equal(Slice("https://github.com/apache"), 0, values.size(), matches.data());
+    EXPECT_EQ(0, std::count(matches.begin(), matches.end(), 1));
+
+    std::string prefix = "https://doris.apache.org/path/1";
+    decoder.match_prefix(Slice(prefix), 100, 500, matches.data());
+    for (size_t i = 0; i < 500; ++i) {
+        EXPECT_EQ(values[100 + i].starts_with(prefix), matches[i] != 0) << "at " << i;
+    }
+}
+
+TEST(FsstPageTest, corrupted) {
+    auto values = make_urls(100);
+    OwnedSlice page = encode(values);
+    Slice truncated(page.slice().data, page.slice().size - 1);
+    FsstPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> decoder(truncated, PageDecoderOptions());
+    EXPECT_FALSE(decoder.init().ok());
+}
+
+TEST(FsstPageTest, dict_page_fallback) {
+    bool enabled = config::enable_fsst_string_page;
+    config::enable_fsst_string_page = true;
+    auto values = make_urls(3000);
+    std::vector<Slice> slices(values.begin(), values.end());
+    PageBuilderOptions options;
+    options.data_page_size = 1024 * 1024;
+    options.dict_page_size = 4096;
+    BinaryDictPageBuilder builder(options);
+    size_t count = slices.size();
+    ASSERT_TRUE(builder.add(reinterpret_cast<const uint8_t*>(slices.data()), &count).ok());
+    ASSERT_LT(count, slices.size());
+    static_cast<void>(builder.finish());
+
+    // the dictionary is full, the next pages are FSST pages
+    builder.reset();
+    size_t rest = slices.size() - count;
+    ASSERT_TRUE(builder.add(reinterpret_cast<const uint8_t*>(slices.data() + count), &rest).ok());
+    ASSERT_EQ(slices.size() - count, rest);
+    OwnedSlice page = builder.finish();
+    Slice last;
+    ASSERT_TRUE(builder.get_last_value(&last).ok());
+    EXPECT_EQ(values.back(), last.to_string());
+    EXPECT_EQ(static_cast<uint32_t>(FOR_ENCODING),
+              decode_fixed32_le(reinterpret_cast<const uint8_t*>(page.slice().data)));
+
+    BinaryDictPageDecoder decoder(page.slice(), PageDecoderOptions());
+    ASSERT_TRUE(decoder.init().ok());
+    EXPECT_FALSE(decoder.is_dict_encoding());
+    vectorized::MutableColumnPtr dst = vectorized::ColumnString::create();
+    size_t n = rest;
+    ASSERT_TRUE(decoder.next_batch(&n, dst).ok());
+    ASSERT_EQ(rest, n);
+    for (size_t i = 0; i < rest; ++i) {
+        ASSERT_EQ(values[count + i], dst->get_data_at(i).to_string()) << "at " << i;
+    }
+    config::enable_fsst_string_page = enabled;
+}
+
+} // namespace doris::segment_v2
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/scan_io_stats.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris {
+
+TEST(ScanIOStatsTest, record) {
+    ScanIOStats scan_io_stats;
+    OlapReaderStatistics stats;
+    stats.uncompressed_bytes_read = 400;
+    stats.total_pages_num = 4;
+    stats.cached_pages_num = 1;
+    stats.file_cache_stats.bytes_read_from_local = 30;
+    stats.file_cache_stats.bytes_read_from_remote = 70;
+    stats.column_io_stats[1] = {.compressed_bytes_read = 60,
+                                .uncompressed_bytes_read = 300,
+                                .total_pages_num = 3,
+                                .cached_pages_num = 1};
+    stats.column_io_stats[2] = {.compressed_bytes_read = 40,
+                                .uncompressed_bytes_read = 100,
+                                .total_pages_num = 1,
+                                .cached_pages_num = 0};
+    scan_io_stats.record(10001, stats, 100, 1000, 10, 3);
+    scan_io_stats.record(10001, stats, 100, 1000, 30, 5);
+    scan_io_stats.record(10002, stats, 50, 100, 100, 1);
+
+    ScanIOStats::TabletStats tablet;
+    ASSERT_TRUE(scan_io_stats.get(10001, &tablet));
+    EXPECT_EQ(2, tablet.scan_count);
+    EXPECT_EQ(40, tablet.rows_returned);
+    EXPECT_EQ(2000, tablet.raw_rows_read);
+    EXPECT_EQ(8, tablet.rowsets_read);
+    EXPECT_EQ(200, tablet.compressed_bytes_read);
+    EXPECT_EQ(800, tablet.uncompressed_bytes_read);
+    EXPECT_EQ(2, tablet.cached_pages_num);
+    EXPECT_EQ(140, tablet.file_cache_remote_bytes);
+    ASSERT_EQ(2, tablet.columns.size());
+    EXPECT_EQ(120, tablet.columns[1].compressed_bytes_read);
+    EXPECT_EQ(6, tablet.columns[1].total_pages_num);
+    EXPECT_FALSE(scan_io_stats.get(10003, &tablet));
+
+    auto top = scan_io_stats.top_tablets(1);
+    ASSERT_EQ(1, top.size());
+    EXPECT_EQ(10001, top[0].first);
+    EXPECT_EQ(2, scan_io_stats.top_tablets(0).size());
+    EXPECT_NE(std::string::npos, scan_io_stats.to_json(0).find("\"read_amplification\":50.0"));
+
+    scan_io_stats.reset();
+    EXPECT_TRUE(scan_io_stats.top_tablets(0).empty());
+}
+
+TEST(ScanIOStatsTest, evict_least_recently_scanned) {
+    auto max_tablets = config::scan_io_stats_max_tablets;
+    config::scan_io_stats_max_tablets = 16;
+    ScanIOStats scan_io_stats;
+    OlapReaderStatistics stats;
+    // the same shard, which keeps one tablet
+    scan_io_stats.record(16, stats, 100, 0, 0, 1);
+    scan_io_stats.record(32, stats, 100, 0, 0, 1);
+    ScanIOStats::TabletStats tablet;
+    EXPECT_FALSE(scan_io_stats.get(16, &tablet));
+    EXPECT_TRUE(scan_io_stats.get(32, &tablet));
+    config::scan_io_stats_max_tablets = max_tablets;
+}
+
+} // namespace doris
@@ -245,4 +245,28 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     }
 }
 
+TEST(TabletMetaTest, TestDeleteBitmapIncrementalAgg) {
+    DeleteBitmap dbmp(10087);
+    RowsetId rowset_id {2, 0, 1, 1};
+    dbmp.add({rowset_id, 0, 1}, 1);
+    dbmp.add({rowset_id, 0, 3}, 3);
+    ASSERT_EQ(dbmp.get_agg({rowset_id, 0, 3})->cardinality(), 2);
+
+    // a later version starts from the cached aggregation of version 3
+    dbmp.add({rowset_id, 0, 5}, 5);
+    auto bm = dbmp.get_agg({rowset_id, 0, 6});
+    EXPECT_EQ(bm->cardinality(), 3);
+    EXPECT_TRUE(bm->contains(1));
+    EXPECT_TRUE(bm->contains(3));
+    EXPECT_TRUE(bm->contains(5));
+
+    // an earlier version is still aggregated from the beginning
+    EXPECT_EQ(dbmp.get_agg({rowset_id, 0, 2})->cardinality(), 1);
+
+    // removing the bitmaps of the rowset also forgets its aggregated versions
+    dbmp.remove({rowset_id, 0, 0}, {rowset_id, UINT32_MAX, 0});
+    dbmp.add({rowset_id, 0, 7}, 7);
+    EXPECT_EQ(dbmp.get_agg({rowset_id, 0, 7})->cardinality(), 1);
+}
+
 } // namespace doris
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "pipeline/fragment_capture.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "io/fs/local_file_system.h"
+#include "runtime/runtime_state.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/spill/spill_stream_manager.h"
+
+namespace doris::pipeline {
+
+TEST(FragmentCaptureTest, sampled) {
+    int captured = 0;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_TRUE(FragmentCapture::sampled(i, 1));
+        EXPECT_FALSE(FragmentCapture::sampled(i, 0));
+        captured += FragmentCapture::sampled(i, 0.1);
+    }
+    EXPECT_EQ(10, captured);
+    // evenly spaced
+    EXPECT_FALSE(FragmentCapture::sampled(0, 0.5));
+    EXPECT_TRUE(FragmentCapture::sampled(1, 0.5));
+    EXPECT_FALSE(FragmentCapture::sampled(2, 0.5));
+}
+
+TEST(FragmentCaptureTest, write_and_read) {
+    std::string root = "./ut_dir/fragment_capture_test";
+    auto fs = io::global_local_filesystem();
+    static_cast<void>(fs->delete_directory(root));
+    ASSERT_TRUE(fs->create_directory(root).ok());
+    vectorized::SpillDataDir data_dir(root, 0);
+    ASSERT_TRUE(data_dir.init().ok());
+
+    RuntimeState state;
+    RuntimeProfile profile("capture");
+    {
+        FragmentCaptureWriter writer(&data_dir, root + "/exchange-1-0", &profile);
+        ASSERT_TRUE(writer.open().ok());
+        for (int i = 0; i < 3; ++i) {
+            auto column = vectorized::ColumnInt32::create();
+            for (int j = 0; j < 10; ++j) {
+                column->insert_value(i * 10 + j);
+            }
+            vectorized::Block block({vectorized::ColumnWithTypeAndName(
+                    std::move(column), std::make_shared<vectorized::DataTypeInt32>(), "k")});
+            writer.write(&state, block);
+        }
+        writer.close();
+    }
+    // the captures are not counted as spilled data
+    EXPECT_EQ(0, data_dir.get_spill_data_bytes());
+
+    std::vector<std::string> streams;
+    ASSERT_TRUE(FragmentCapture::list_streams(root, &streams).ok());
+    ASSERT_EQ(1, streams.size());
+    FragmentCaptureReader reader(streams[0]);
+    ASSERT_TRUE(reader.open().ok());
+    EXPECT_EQ(3, reader.num_blocks());
+    // replayed twice
+    for (int round = 0; round < 2; ++round) {
+        int64_t rows = 0;
+        int64_t sum = 0;
+        bool eos = false;
+        while (!eos) {
+            vectorized::Block block;
+            ASSERT_TRUE(reader.read(&block, &eos).ok());
+            if (block.rows() == 0) {
+                continue;
+            }
+            const auto& column = assert_cast<const vectorized::ColumnInt32&>(
+                    *block.get_by_position(0).column);
+            for (size_t i = 0; i < block.rows(); ++i) {
+                sum += column.get_element(i);
+            }
+            rows += block.rows();
+        }
+        EXPECT_EQ(30, rows);
+        EXPECT_EQ(435, sum);
+        reader.rewind();
+    }
+    static_cast<void>(fs->delete_directory(root));
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "pipeline/plan_regression_detector.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "util/runtime_profile.h"
+
+namespace doris::pipeline {
+
+static PlanRegressionDetector::FragmentSummary make_summary(int64_t time_ms, int64_t rows,
+                                                            int64_t filtered_rows,
+                                                            int64_t max_instance_rows = 0) {
+    PlanRegressionDetector::FragmentSummary summary;
+    summary.exec_time_ns = time_ms * 1000000;
+    auto& op = summary.operators["OLAP_SCAN_OPERATOR (id=0)"];
+    op.rows = rows;
+    op.exec_time_ns = time_ms * 1000000;
+    op.runtime_filter_filtered_rows = filtered_rows;
+    op.num_instances = 4;
+    op.max_instance_rows = max_instance_rows > 0 ? max_instance_rows : rows / 4;
+    return summary;
+}
+
+TEST(PlanRegressionDetectorTest, check) {
+    PlanRegressionDetector detector;
+    for (int i = 0; i < config::plan_baseline_min_samples; ++i) {
+        EXPECT_TRUE(detector.check(1, make_summary(2000, 1000000, 5000000)).empty());
+    }
+    // within the ratio of the baseline
+    EXPECT_TRUE(detector.check(1, make_summary(3000, 1200000, 4000000)).empty());
+
+    // the runtime filter stopped pruning, the scan read more rows and got slower
+    auto deviations = detector.check(1, make_summary(10000, 6000000, 0));
+    ASSERT_EQ(4, deviations.size());
+    EXPECT_EQ("fragment exec time 10000ms, baseline 2200ms", deviations[0]);
+    EXPECT_EQ("OLAP_SCAN_OPERATOR (id=0) runtime filters filtered 0 rows, baseline 4800000",
+              deviations[3]);
+
+    // one instance reads all the rows
+    deviations = detector.check(1, make_summary(2000, 2000000, 5000000, 2000000));
+    ASSERT_EQ(1, deviations.size());
+    EXPECT_EQ("OLAP_SCAN_OPERATOR (id=0) skew 4.00 of 4 instances, baseline 1.00", deviations[0]);
+
+    // another plan has its own baseline
+    EXPECT_TRUE(detector.check(2, make_summary(10000, 6000000, 0)).empty());
+    EXPECT_EQ(2, detector.size());
+    detector.clear();
+    EXPECT_EQ(0, detector.size());
+}
+
+TEST(PlanRegressionDetectorTest, evict) {
+    int32_t max_fingerprints = config::plan_baseline_max_fingerprints;
+    config::plan_baseline_max_fingerprints = 2;
+    PlanRegressionDetector detector;
+    detector.check(1, make_summary(1, 1, 0));
+    detector.check(2, make_summary(1, 1, 0));
+    detector.check(1, make_summary(1, 1, 0));
+    // 2 is the least recently executed
+    detector.check(3, make_summary(1, 1, 0));
+    EXPECT_EQ(2, detector.size());
+    for (int i = 1; i < config::plan_baseline_min_samples; ++i) {
+        detector.check(1, make_summary(1, 1, 0));
+        detector.check(2, make_summary(1, 1, 0));
+    }
+    // 1 kept its samples, 2 started over
+    EXPECT_FALSE(detector.check(1, make_summary(10000, 1, 0)).empty());
+    EXPECT_TRUE(detector.check(2, make_summary(10000, 1, 0)).empty());
+    config::plan_baseline_max_fingerprints = max_fingerprints;
+}
+
+TEST(PlanRegressionDetectorTest, summarize) {
+    std::vector<std::unique_ptr<RuntimeProfile>> profiles;
+    auto new_profile = [&](RuntimeProfile* parent, const std::string& name, int node_id) {
+        auto* profile = profiles.emplace_back(std::make_unique<RuntimeProfile>(name)).get();
+        if (node_id >= 0) {
+            profile->set_metadata(node_id);
+        }
+        parent->add_child(profile, true, nullptr);
+        return profile;
+    };
+
+    auto pipeline = std::make_shared<RuntimeProfile>("Pipeline 0");
+    for (int i = 0; i < 2; ++i) {
+        auto* task = new_profile(pipeline.get(), "PipelineTask", -1);
+        auto* sink = new_profile(task, "EXCHANGE_SINK_OPERATOR (id=1)", 1);
+        ADD_COUNTER(sink, "InputRows", TUnit::UNIT)->update(100 * (i + 1));
+        ADD_TIMER(sink, "ExecTime")->update(1000);
+        auto* scan = new_profile(sink, "OLAP_SCAN_OPERATOR (id=0)", 0);
+        ADD_COUNTER(scan, "RowsProduced", TUnit::UNIT)->update(100 * (i + 1));
+        ADD_TIMER(scan, "ExecTime")->update(2000);
+        auto* filter = new_profile(scan, "RuntimeFilter", -1);
+        ADD_COUNTER(filter, "expr_filtered_rows", TUnit::UNIT)->update(50);
+    }
+
+    auto summary = PlanRegressionDetector::summarize({pipeline}, 5000);
+    EXPECT_EQ(5000, summary.exec_time_ns);
+    ASSERT_EQ(2, summary.operators.size());
+    const auto& sink = summary.operators["EXCHANGE_SINK_OPERATOR (id=1)"];
+    EXPECT_EQ(300, sink.rows);
+    EXPECT_EQ(2000, sink.exec_time_ns);
+    // the runtime filters of the scan belong to the scan only
+    EXPECT_EQ(0, sink.runtime_filter_filtered_rows);
+    const auto& scan = summary.operators["OLAP_SCAN_OPERATOR (id=0)"];
+    EXPECT_EQ(300, scan.rows);
+    EXPECT_EQ(4000, scan.exec_time_ns);
+    EXPECT_EQ(100, scan.runtime_filter_filtered_rows);
+    EXPECT_EQ(2, scan.num_instances);
+    EXPECT_EQ(200, scan.max_instance_rows);
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/work_stealing_task_queue.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::pipeline {
+
+// The deque never dereferences the tasks, fake pointers are enough.
+static PipelineTask* fake_task(uintptr_t i) {
+    return reinterpret_cast<PipelineTask*>(i);
+}
+
+TEST(WorkStealingDequeTest, FifoAndGrow) {
+    WorkStealingDeque deque(4);
+    EXPECT_TRUE(deque.empty());
+    EXPECT_EQ(nullptr, deque.steal());
+    for (uintptr_t i = 1; i <= 100; ++i) {
+        deque.push(fake_task(i));
+    }
+    EXPECT_EQ(100, deque.size());
+    for (uintptr_t i = 1; i <= 100; ++i) {
+        EXPECT_EQ(fake_task(i), deque.steal());
+    }
+    EXPECT_TRUE(deque.empty());
+    EXPECT_EQ(nullptr, deque.steal());
+}
+
+TEST(WorkStealingDequeTest, ConcurrentSteal) {
+    constexpr int NUM_TASKS = 100000;
+    constexpr int NUM_THIEVES = 4;
+    WorkStealingDeque deque(16);
+    std::atomic<bool> done = false;
+    std::atomic<int64_t> stolen_count = 0;
+    std::vector<std::atomic<int>> seen(NUM_TASKS + 1);
+    std::vector<std::thread> thieves;
+    for (int i = 0; i < NUM_THIEVES; ++i) {
+        thieves.emplace_back([&] {
+            while (!done || !deque.empty()) {
+                auto* task = deque.steal();
+                if (task) {
+                    seen[reinterpret_cast<uintptr_t>(task)]++;
+                    stolen_count++;
+                }
+            }
+        });
+    }
+    for (uintptr_t i = 1; i <= NUM_TASKS; ++i) {
+        deque.push(fake_task(i));
+    }
+    done = true;
+    for (auto& thief : thieves) {
+        thief.join();
+    }
+    EXPECT_EQ(NUM_TASKS, stolen_count);
+    for (int i = 1; i <= NUM_TASKS; ++i) {
+        EXPECT_EQ(1, seen[i]);
+    }
+}
+
+TEST(EventCountTest, NotifyWakesWaiter) {
+    EventCount event_count;
+    // Nobody waits, notify is a no-op.
+    event_count.notify();
+
+    std::atomic<bool> ready = false;
+    std::thread waiter([&] {
+        while (!ready) {
+            auto key = event_count.prepare_wait();
+            if (ready) {
+                event_count.cancel_wait();
+                break;
+            }
+            event_count.wait(key, 10000);
+        }
+    });
+    ready = true;
+    event_count.notify();
+    waiter.join();
+    EXPECT_TRUE(ready);
+
+    // The epoch has changed, so waiting on an old key returns at once.
+    auto key = event_count.prepare_wait();
+    event_count.notify();
+    event_count.wait(key, 10000);
+}
+
+} // namespace doris::pipeline
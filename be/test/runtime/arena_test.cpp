@@ -21,7 +21,9 @@
 #include <gtest/gtest-test-part.h>
 #include <stdint.h>
 
+#include <cstring>
 #include <iostream>
+#include <string>
 
 #include "gtest/gtest_pred_impl.h"
 #include "util/bit_util.h"
@@ -117,4 +119,34 @@ TEST(ArenaTest, MaxAllocation) {
                   p3.remaining_space_in_current_chunk());
     }
 }
+
+TEST(ArenaTest, Rewind) {
+    vectorized::Arena p;
+    char* kept = p.alloc(100);
+    memset(kept, 'k', 100);
+    auto checkpoint = p.checkpoint();
+    size_t size = p.size();
+    size_t used_size = p.used_size();
+
+    // within the same chunk
+    p.alloc(1000);
+    p.rewind(checkpoint);
+    EXPECT_EQ(size, p.size());
+    EXPECT_EQ(used_size, p.used_size());
+
+    // the chunks added after the checkpoint are freed
+    for (int i = 0; i < 100; ++i) {
+        p.alloc(1024);
+    }
+    EXPECT_GT(p.size(), size);
+    p.rewind(checkpoint);
+    EXPECT_EQ(size, p.size());
+    EXPECT_EQ(used_size, p.used_size());
+    EXPECT_EQ(std::string(100, 'k'), std::string(kept, 100));
+
+    // the arena is still usable after rewinding
+    char* ptr = p.alloc(10 * 1024);
+    EXPECT_TRUE(ptr != nullptr);
+    EXPECT_EQ(used_size + 10 * 1024, p.used_size());
+}
 } // namespace doris
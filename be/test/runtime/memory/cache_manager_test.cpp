@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/cache_manager.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+TEST(CacheManagerTest, SplitPruneBytes) {
+    // Proportional to consumption / cost.
+    auto result = CacheManager::split_prune_bytes(300, {1000, 1000}, {1.0, 2.0});
+    EXPECT_EQ(200, result[0]);
+    EXPECT_EQ(100, result[1]);
+
+    // The cheap cache is pruned entirely, the others share the rest.
+    result = CacheManager::split_prune_bytes(1100, {100, 1000, 1000}, {0.01, 1.0, 1.0});
+    EXPECT_EQ(100, result[0]);
+    EXPECT_EQ(500, result[1]);
+    EXPECT_EQ(500, result[2]);
+
+    // Not enough memory in caches.
+    result = CacheManager::split_prune_bytes(5000, {100, 1000}, {1.0, 8.0});
+    EXPECT_EQ(100, result[0]);
+    EXPECT_EQ(1000, result[1]);
+
+    result = CacheManager::split_prune_bytes(100, {}, {});
+    EXPECT_TRUE(result.empty());
+}
+
+} // namespace doris
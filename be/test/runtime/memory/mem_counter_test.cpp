@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "runtime/memory/mem_tracker.h"
+
+namespace doris {
+
+TEST(MemCounterTest, TestSharded) {
+    MemTracker::MemCounter counter(true);
+    counter.add(100);
+    EXPECT_EQ(100, counter.current_value());
+    // the small adds stay in the shard
+    EXPECT_EQ(0, counter.approximate_value());
+    EXPECT_GE(counter.approximate_value() + counter.max_pending_value(),
+              counter.current_value());
+
+    counter.add(4 * 1024 * 1024);
+    EXPECT_EQ(4 * 1024 * 1024 + 100, counter.approximate_value());
+    EXPECT_EQ(4 * 1024 * 1024 + 100, counter.current_value());
+    EXPECT_EQ(4 * 1024 * 1024 + 100, counter.peak_value());
+
+    counter.sub(4 * 1024 * 1024);
+    EXPECT_EQ(100, counter.current_value());
+
+    counter.set(0);
+    EXPECT_EQ(0, counter.current_value());
+}
+
+TEST(MemCounterTest, TestShardedConcurrent) {
+    MemTracker::MemCounter counter(true);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 16; ++i) {
+        threads.emplace_back([&counter]() {
+            for (int j = 0; j < 10000; ++j) {
+                counter.add(1000);
+                counter.sub(400);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(16L * 10000 * 600, counter.current_value());
+}
+
+} // namespace doris
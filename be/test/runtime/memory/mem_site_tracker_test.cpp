@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/mem_site_tracker.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+TEST(MemSiteTrackerTest, disabled) {
+    config::enable_mem_site_tracking = false;
+    MemSiteTracker mem_sites;
+    mem_sites.init("Op");
+    EXPECT_FALSE(mem_sites.enabled());
+    EXPECT_EQ(nullptr, mem_sites.tracker(MemSite::HASH_TABLE));
+    mem_sites.consume(MemSite::HASH_TABLE, 100);
+    EXPECT_EQ("", mem_sites.debug_string());
+}
+
+TEST(MemSiteTrackerTest, consume) {
+    config::enable_mem_site_tracking = true;
+    MemSiteTracker mem_sites;
+    mem_sites.init("Op");
+    ASSERT_TRUE(mem_sites.enabled());
+    mem_sites.consume(MemSite::HASH_TABLE, 2048);
+    mem_sites.consume(MemSite::HASH_TABLE, -1024);
+    mem_sites.set_consumption(MemSite::SORT, 512);
+    EXPECT_EQ(1024, mem_sites.tracker(MemSite::HASH_TABLE)->consumption());
+    EXPECT_EQ(2048, mem_sites.tracker(MemSite::HASH_TABLE)->peak_consumption());
+    EXPECT_EQ(512, mem_sites.tracker(MemSite::SORT)->consumption());
+
+    auto str = mem_sites.debug_string();
+    EXPECT_NE(std::string::npos, str.find("HashTable"));
+    EXPECT_NE(std::string::npos, str.find("Sort"));
+    // the sites never used are left out
+    EXPECT_EQ(std::string::npos, str.find("Arena"));
+
+    RuntimeProfile profile("Op");
+    profile.AddHighWaterMarkCounter("PeakMemoryUsage", TUnit::BYTES);
+    mem_sites.update_profile(&profile, "PeakMemoryUsage");
+    auto* counter = profile.get_counter("HashTablePeakMemory");
+    ASSERT_NE(nullptr, counter);
+    EXPECT_EQ(2048, counter->value());
+    EXPECT_EQ(nullptr, profile.get_counter("ArenaPeakMemory"));
+    config::enable_mem_site_tracking = false;
+}
+
+} // namespace doris
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/runtime_predicate.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <memory>
+
+#include "gtest/gtest_pred_impl.h"
+#include "olap/tablet_schema.h"
+
+namespace doris::vectorized {
+
+TEST(RuntimePredicateTest, version_bumped_when_tightened) {
+    auto schema = std::make_shared<TabletSchema>();
+    TabletColumn column;
+    column.set_name("ts");
+    column.set_unique_id(1);
+    column.set_type(FieldType::OLAP_FIELD_TYPE_BIGINT);
+    schema->append_column(column);
+
+    RuntimePredicate predicate;
+    // ORDER BY ts DESC, the bound is ts >= the min value of the heap
+    EXPECT_TRUE(predicate.init(TYPE_BIGINT, false, false, "ts").ok());
+    EXPECT_TRUE(predicate.set_tablet_schema(schema).ok());
+    EXPECT_EQ(predicate.version(), 0);
+
+    EXPECT_TRUE(predicate.update(Field(Int64(10))).ok());
+    EXPECT_EQ(predicate.version(), 1);
+    // not tighter
+    EXPECT_TRUE(predicate.update(Field(Int64(5))).ok());
+    EXPECT_EQ(predicate.version(), 1);
+    EXPECT_TRUE(predicate.update(Field()).ok());
+    EXPECT_EQ(predicate.version(), 1);
+
+    EXPECT_TRUE(predicate.update(Field(Int64(20))).ok());
+    EXPECT_EQ(predicate.version(), 2);
+    EXPECT_EQ(predicate.get_value().get<Int64>(), 20);
+}
+
+} // namespace doris::vectorized
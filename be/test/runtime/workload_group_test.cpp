@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/workload_group/workload_group.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+static WorkloadGroupInfo create_group_info(int64_t memory_limit) {
+    WorkloadGroupInfo info;
+    info.id = 1;
+    info.name = "test_group";
+    info.cpu_share = 1024;
+    info.memory_limit = memory_limit;
+    info.enable_memory_overcommit = true;
+    info.version = 1;
+    info.cpu_hard_limit = -1;
+    info.enable_cpu_hard_limit = false;
+    info.scan_thread_num = 1;
+    info.max_remote_scan_thread_num = 1;
+    info.min_remote_scan_thread_num = 1;
+    info.spill_low_watermark = 50;
+    info.spill_high_watermark = 80;
+    return info;
+}
+
+TEST(WorkloadGroupTest, TryReserveMemory) {
+    WorkloadGroup wg(create_group_info(1000));
+    // the high watermark is 800 bytes
+    EXPECT_TRUE(wg.try_reserve_memory(500));
+    EXPECT_TRUE(wg.try_reserve_memory(300));
+    EXPECT_FALSE(wg.try_reserve_memory(1));
+    EXPECT_EQ(800, wg.reserved_memory());
+
+    bool is_low_watermark = false;
+    bool is_high_watermark = false;
+    wg.check_mem_used(&is_low_watermark, &is_high_watermark);
+    EXPECT_TRUE(is_low_watermark);
+    EXPECT_FALSE(is_high_watermark);
+
+    wg.release_reserved_memory(500);
+    EXPECT_EQ(300, wg.reserved_memory());
+    wg.set_weighted_memory_used(400, 1.0);
+    EXPECT_TRUE(wg.try_reserve_memory(100));
+    EXPECT_FALSE(wg.try_reserve_memory(1));
+
+    wg.release_reserved_memory(400);
+    EXPECT_EQ(0, wg.reserved_memory());
+}
+
+TEST(WorkloadGroupTest, TryReserveMemoryWithoutLimit) {
+    WorkloadGroup wg(create_group_info(0));
+    EXPECT_TRUE(wg.try_reserve_memory(1L << 40));
+    EXPECT_EQ(0, wg.reserved_memory());
+}
+
+} // namespace doris
@@ -16,21 +16,31 @@
 // under the License.
 
 #include <benchmark/benchmark.h>
+#include <gen_cpp/data.pb.h>
 #include <gflags/gflags.h>
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 
 #include <algorithm>
+#include <bit>
 #include <chrono>
+#include <cmath>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "agent/be_exec_version_manager.h"
 #include "common/compiler_util.h"
 #include "common/logging.h"
+#include "exprs/bloom_filter_func.h"
 #include "gutil/strings/split.h"
 #include "gutil/strings/substitute.h"
 #include "io/fs/file_system.h"
@@ -52,16 +62,38 @@
 #include "olap/types.h"
 #include "testutil/test_util.h"
 #include "util/debug_util.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/hash_table/hash_map_context.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+#include "vec/exec/vaggregation_node.h"
 
 DEFINE_string(operation, "Custom",
               "valid operation: Custom, BinaryDictPageEncode, BinaryDictPageDecode, SegmentScan, "
               "SegmentWrite, "
-              "SegmentScanByFile, SegmentWriteByFile");
+              "SegmentScanByFile, SegmentWriteByFile, PackFixedKeys, SortBlock, BlockSerialize, "
+              "BlockDeserialize, HashJoinProbe, AggKeysFixedEmplace, BloomFilterBuild, "
+              "BloomFilterProbe, Operators");
 DEFINE_string(input_file, "./sample.dat", "input file directory");
 DEFINE_string(column_type, "int,varchar", "valid type: int, char, varchar, string");
 DEFINE_string(rows_number, "10000", "rows number");
 DEFINE_string(iterations, "10",
               "run times, this is set to 0 means the number of iterations is automatically set ");
+// the shape of the data generated for the operator benchmarks
+DEFINE_int64(ndv, 0, "distinct keys of the generated data, 0 means as many as the rows");
+DEFINE_double(skew, 0, "zipf exponent of the generated keys, 0 means uniform");
+DEFINE_double(null_ratio, 0, "ratio of the nulls, greater than 0 makes the columns nullable");
+DEFINE_int32(string_length, 16, "length of the generated strings");
+DEFINE_string(baseline_file, "", "the json file of the baseline times of the benchmarks");
+DEFINE_bool(save_baseline, false, "save the times to --baseline_file instead of comparing them");
+DEFINE_double(regression_threshold, 0.1,
+              "fail if a benchmark is slower than its baseline by more than this ratio");
 
 const std::string kSegmentDir = "./segment_benchmark";
 
@@ -84,6 +116,13 @@ std::string get_usage(const std::string& progname) {
           "--iterations=10\n";
     ss << "./benchmark_tool --operation=SegmentWriteByFile --input_file=./sample.dat "
           "--iterations=10\n";
+    ss << "./benchmark_tool --operation=PackFixedKeys --rows_number=4096 --iterations=0\n";
+    ss << "./benchmark_tool --operation=SortBlock --rows_number=1000000 --ndv=1000 --skew=1.2 "
+          "--null_ratio=0.1 --string_length=32 --iterations=0\n";
+    ss << "./benchmark_tool --operation=Operators --rows_number=1000000 --iterations=0 "
+          "--baseline_file=./baseline.json --save_baseline\n";
+    ss << "./benchmark_tool --operation=Operators --rows_number=1000000 --iterations=0 "
+          "--baseline_file=./baseline.json --regression_threshold=0.1\n";
 
     ss << "Sampe data file format: \n"
        << "The first line defines Shcema\n"
@@ -263,6 +302,464 @@ void custom_run_mod() {
     }
 }
 
+// Packs and hashes the fixed width keys of a multi-column GROUP BY.
+// Call method: ./benchmark_tool --operation=PackFixedKeys
+template <typename T, size_t num_columns, bool nullable>
+class PackFixedKeysBenchmark : public BaseBenchmark {
+public:
+    using Method = vectorized::MethodKeysFixed<vectorized::AggregatedDataWithUInt128Key, nullable>;
+
+    PackFixedKeysBenchmark(const std::string& name, int iterations, int rows_number)
+            : BaseBenchmark(name + "/rows_number:" + std::to_string(rows_number), iterations),
+              _rows_number(rows_number),
+              _method(vectorized::Sizes(num_columns, sizeof(T))) {}
+    ~PackFixedKeysBenchmark() override = default;
+
+    void init() override {
+        if (!_columns.empty()) {
+            return;
+        }
+        std::mt19937 rng(0);
+        for (size_t j = 0; j < num_columns; ++j) {
+            auto column = vectorized::ColumnVector<T>::create();
+            for (int i = 0; i < _rows_number; ++i) {
+                column->insert_value(static_cast<T>(rng()));
+            }
+            if constexpr (nullable) {
+                auto null_map = vectorized::ColumnUInt8::create();
+                for (int i = 0; i < _rows_number; ++i) {
+                    null_map->insert_value(rng() % 8 == 0);
+                }
+                _columns.emplace_back(vectorized::ColumnNullable::create(std::move(column),
+                                                                         std::move(null_map)));
+            } else {
+                _columns.emplace_back(std::move(column));
+            }
+            _raw_columns.push_back(_columns.back().get());
+        }
+    }
+
+    void run() override {
+        _method.init_serialized_keys(_raw_columns, _rows_number);
+        benchmark::DoNotOptimize(_method.hash_values.data());
+    }
+
+private:
+    int _rows_number;
+    Method _method;
+    vectorized::Columns _columns;
+    vectorized::ColumnRawPtrs _raw_columns;
+};
+
+// Generates the synthetic data of the operator benchmarks, shaped by --ndv, --skew, --null_ratio
+// and --string_length. The same arguments always generate the same data.
+class DataGenerator {
+public:
+    DataGenerator(size_t rows, uint32_t seed = 0)
+            : _rows(rows),
+              _ndv(FLAGS_ndv > 0 ? FLAGS_ndv : rows),
+              _null_ratio(FLAGS_null_ratio),
+              _string_length(FLAGS_string_length),
+              _rng(seed) {
+        if (FLAGS_skew > 0) {
+            // the cumulative probabilities of the zipf distribution over the keys
+            _zipf_cdf.resize(_ndv);
+            double sum = 0;
+            for (int64_t k = 0; k < _ndv; ++k) {
+                sum += 1.0 / std::pow(k + 1, FLAGS_skew);
+                _zipf_cdf[k] = sum;
+            }
+            for (auto& p : _zipf_cdf) {
+                p /= sum;
+            }
+        }
+    }
+
+    int64_t ndv() const { return _ndv; }
+    bool nullable() const { return _null_ratio > 0; }
+
+    // the ids of the keys of the rows, in [0, ndv)
+    std::vector<int64_t> key_ids() {
+        std::vector<int64_t> ids(_rows);
+        if (_zipf_cdf.empty()) {
+            std::uniform_int_distribution<int64_t> dist(0, _ndv - 1);
+            for (auto& id : ids) {
+                id = dist(_rng);
+            }
+        } else {
+            std::uniform_real_distribution<double> dist(0, 1);
+            for (auto& id : ids) {
+                auto it = std::lower_bound(_zipf_cdf.begin(), _zipf_cdf.end(), dist(_rng));
+                id = std::min<int64_t>(it - _zipf_cdf.begin(), _ndv - 1);
+            }
+        }
+        return ids;
+    }
+
+    // the key of an id, which scatters the ids so that the keys are not sorted
+    static int64_t int64_key(int64_t id) {
+        return static_cast<int64_t>(static_cast<uint64_t>(id) * 0x9E3779B97F4A7C15ULL);
+    }
+
+    std::string string_key(int64_t id) const {
+        std::mt19937_64 rng(id);
+        std::string key(_string_length, '\0');
+        for (auto& c : key) {
+            c = static_cast<char>('a' + rng() % 26);
+        }
+        return key;
+    }
+
+    vectorized::ColumnWithTypeAndName int64_column(const std::vector<int64_t>& ids,
+                                                   const std::string& name) {
+        auto column = vectorized::ColumnInt64::create();
+        for (int64_t id : ids) {
+            column->insert_value(int64_key(id));
+        }
+        return _with_nulls(std::move(column), std::make_shared<vectorized::DataTypeInt64>(),
+                           name);
+    }
+
+    vectorized::ColumnWithTypeAndName string_column(const std::vector<int64_t>& ids,
+                                                    const std::string& name) {
+        auto column = vectorized::ColumnString::create();
+        for (int64_t id : ids) {
+            std::string key = string_key(id);
+            column->insert_data(key.data(), key.size());
+        }
+        return _with_nulls(std::move(column), std::make_shared<vectorized::DataTypeString>(),
+                           name);
+    }
+
+private:
+    vectorized::ColumnWithTypeAndName _with_nulls(vectorized::MutableColumnPtr column,
+                                                  vectorized::DataTypePtr type,
+                                                  const std::string& name) {
+        if (!nullable()) {
+            return {std::move(column), std::move(type), name};
+        }
+        std::bernoulli_distribution is_null(_null_ratio);
+        auto null_map = vectorized::ColumnUInt8::create();
+        for (size_t i = 0; i < column->size(); ++i) {
+            null_map->insert_value(is_null(_rng));
+        }
+        return {vectorized::ColumnNullable::create(std::move(column), std::move(null_map)),
+                vectorized::make_nullable(type), name};
+    }
+
+    size_t _rows;
+    int64_t _ndv;
+    double _null_ratio;
+    int _string_length;
+    std::mt19937_64 _rng;
+    std::vector<double> _zipf_cdf;
+};
+
+// The name of an operator benchmark with the shape of its data.
+static std::string operator_bm_name(const std::string& name, int rows_number) {
+    return fmt::format("{}/rows:{}/ndv:{}/skew:{}/null_ratio:{}/string_length:{}", name,
+                       rows_number, FLAGS_ndv, FLAGS_skew, FLAGS_null_ratio,
+                       FLAGS_string_length);
+}
+
+// Sorts a block by an int64 and a string column, like the sort node does for each input block.
+// Call method: ./benchmark_tool --operation=SortBlock
+class SortBlockBenchmark : public BaseBenchmark {
+public:
+    SortBlockBenchmark(int iterations, int rows_number)
+            : BaseBenchmark(operator_bm_name("SortBlock", rows_number), iterations),
+              _rows_number(rows_number) {}
+
+    void init() override {
+        if (_block.columns() == 0) {
+            DataGenerator generator(_rows_number);
+            _block.insert(generator.int64_column(generator.key_ids(), "k1"));
+            _block.insert(generator.string_column(generator.key_ids(), "k2"));
+            _description.emplace_back(0, 1, 1);
+            _description.emplace_back(1, 1, 1);
+        }
+        _sorted = _block.clone_empty();
+    }
+
+    void run() override {
+        vectorized::sort_block(_block, _sorted, _description);
+        benchmark::DoNotOptimize(_sorted.rows());
+    }
+
+private:
+    int _rows_number;
+    vectorized::Block _block;
+    vectorized::Block _sorted;
+    vectorized::SortDescription _description;
+};
+
+// Serializes or deserializes a block with lz4, like the exchange does for each sent block.
+// Call method: ./benchmark_tool --operation=BlockSerialize
+//              ./benchmark_tool --operation=BlockDeserialize
+template <bool serialize>
+class BlockSerializeBenchmark : public BaseBenchmark {
+public:
+    BlockSerializeBenchmark(int iterations, int rows_number)
+            : BaseBenchmark(operator_bm_name(serialize ? "BlockSerialize" : "BlockDeserialize",
+                                             rows_number),
+                            iterations),
+              _rows_number(rows_number) {}
+
+    void init() override {
+        if (_block.columns() == 0) {
+            DataGenerator generator(_rows_number);
+            _block.insert(generator.int64_column(generator.key_ids(), "k1"));
+            _block.insert(generator.string_column(generator.key_ids(), "k2"));
+            _serialize(&_pblock);
+        }
+    }
+
+    void run() override {
+        if constexpr (serialize) {
+            PBlock pblock;
+            _serialize(&pblock);
+            benchmark::DoNotOptimize(pblock.column_values().size());
+        } else {
+            vectorized::Block block;
+            static_cast<void>(block.deserialize(_pblock));
+            benchmark::DoNotOptimize(block.rows());
+        }
+    }
+
+private:
+    void _serialize(PBlock* pblock) {
+        size_t uncompressed_bytes = 0;
+        size_t compressed_bytes = 0;
+        static_cast<void>(_block.serialize(BeExecVersionManager::get_newest_version(), pblock,
+                                           &uncompressed_bytes, &compressed_bytes,
+                                           segment_v2::CompressionTypePB::LZ4));
+    }
+
+    int _rows_number;
+    vectorized::Block _block;
+    PBlock _pblock;
+};
+
+// Probes a hash table of int64 keys with prefetching, like the probe of a hash join on one
+// integer column. The build side has every key once, the probe side follows the distribution.
+// Call method: ./benchmark_tool --operation=HashJoinProbe
+class HashJoinProbeBenchmark : public BaseBenchmark {
+public:
+    using HashMap = PHHashMap<int64_t, uint32_t, HashCRC32<int64_t>>;
+
+    HashJoinProbeBenchmark(int iterations, int rows_number)
+            : BaseBenchmark(operator_bm_name("HashJoinProbe", rows_number), iterations),
+              _rows_number(rows_number) {}
+
+    void init() override {
+        if (!_probe_keys.empty()) {
+            return;
+        }
+        DataGenerator generator(_rows_number);
+        for (int64_t id = 0; id < generator.ndv(); ++id) {
+            int64_t key = DataGenerator::int64_key(id);
+            _hash_map.insert(key, _hash_map.hash(key), static_cast<uint32_t>(id));
+        }
+        for (int64_t id : generator.key_ids()) {
+            _probe_keys.push_back(DataGenerator::int64_key(id));
+        }
+        _hash_values.resize(_probe_keys.size());
+    }
+
+    void run() override {
+        size_t num_rows = _probe_keys.size();
+        for (size_t i = 0; i < num_rows; ++i) {
+            _hash_values[i] = _hash_map.hash(_probe_keys[i]);
+        }
+        uint64_t matched = 0;
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (i + HASH_MAP_PREFETCH_DIST < num_rows) {
+                _hash_map.prefetch(_probe_keys[i + HASH_MAP_PREFETCH_DIST],
+                                   _hash_values[i + HASH_MAP_PREFETCH_DIST]);
+            }
+            auto* it = _hash_map.find(_probe_keys[i], _hash_values[i]);
+            matched += it != nullptr ? it->second : 0;
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+
+private:
+    int _rows_number;
+    HashMap _hash_map;
+    std::vector<int64_t> _probe_keys;
+    std::vector<size_t> _hash_values;
+};
+
+// Packs two int32 group by keys and emplaces them into the hash table of the aggregation, like
+// the `MethodKeysFixed` path of the aggregation node.
+// Call method: ./benchmark_tool --operation=AggKeysFixedEmplace
+class AggKeysFixedEmplaceBenchmark : public BaseBenchmark {
+public:
+    using Method = vectorized::MethodKeysFixed<vectorized::AggregatedDataWithUInt64Key, false>;
+
+    AggKeysFixedEmplaceBenchmark(int iterations, int rows_number)
+            : BaseBenchmark(operator_bm_name("AggKeysFixedEmplace", rows_number), iterations),
+              _rows_number(rows_number),
+              _method(vectorized::Sizes(2, sizeof(int32_t))) {}
+
+    void init() override {
+        if (_columns.empty()) {
+            DataGenerator generator(_rows_number);
+            auto ids = generator.key_ids();
+            auto high = vectorized::ColumnInt32::create();
+            auto low = vectorized::ColumnInt32::create();
+            for (int64_t id : ids) {
+                uint64_t key = DataGenerator::int64_key(id);
+                high->insert_value(static_cast<int32_t>(key >> 32));
+                low->insert_value(static_cast<int32_t>(key));
+            }
+            _columns.emplace_back(std::move(high));
+            _columns.emplace_back(std::move(low));
+            for (const auto& column : _columns) {
+                _raw_columns.push_back(column.get());
+            }
+        }
+        _method.hash_table = std::make_shared<vectorized::AggregatedDataWithUInt64Key>();
+    }
+
+    void run() override {
+        _method.init_serialized_keys(_raw_columns, _rows_number);
+        auto& hash_table = *_method.hash_table;
+        for (int i = 0; i < _rows_number; ++i) {
+            if (i + HASH_MAP_PREFETCH_DIST < _rows_number) {
+                hash_table.prefetch(_method.keys[i + HASH_MAP_PREFETCH_DIST],
+                                    _method.hash_values[i + HASH_MAP_PREFETCH_DIST]);
+            }
+            vectorized::AggregatedDataWithUInt64Key::LookupResult it;
+            bool inserted = false;
+            hash_table.emplace(_method.keys[i], it, inserted, _method.hash_values[i]);
+        }
+        benchmark::DoNotOptimize(hash_table.size());
+    }
+
+private:
+    int _rows_number;
+    Method _method;
+    vectorized::Columns _columns;
+    vectorized::ColumnRawPtrs _raw_columns;
+};
+
+// Builds or probes the bloom filter of a runtime filter on an int64 column, sized with about
+// 8 bits per distinct key.
+// Call method: ./benchmark_tool --operation=BloomFilterBuild
+//              ./benchmark_tool --operation=BloomFilterProbe
+template <bool build>
+class BloomFilterBenchmark : public BaseBenchmark {
+public:
+    BloomFilterBenchmark(int iterations, int rows_number)
+            : BaseBenchmark(operator_bm_name(build ? "BloomFilterBuild" : "BloomFilterProbe",
+                                             rows_number),
+                            iterations),
+              _rows_number(rows_number) {}
+
+    void init() override {
+        if (_build_column == nullptr) {
+            DataGenerator generator(_rows_number);
+            std::vector<int64_t> build_ids(generator.ndv());
+            std::iota(build_ids.begin(), build_ids.end(), 0);
+            _build_column = generator.int64_column(build_ids, "build").column;
+            _probe_column = generator.int64_column(generator.key_ids(), "probe").column;
+            _bytes = std::bit_ceil(static_cast<uint64_t>(std::max<int64_t>(generator.ndv(), 64)));
+            _results.resize(_probe_column->size());
+            if constexpr (!build) {
+                _bloom_filter = _new_bloom_filter();
+            }
+        }
+        if constexpr (build) {
+            _bloom_filter = _new_bloom_filter();
+        }
+    }
+
+    void run() override {
+        if constexpr (build) {
+            _bloom_filter->insert_fixed_len(_build_column, 0);
+        } else {
+            _bloom_filter->find_fixed_len(_probe_column, _results.data());
+            benchmark::DoNotOptimize(_results.data());
+        }
+    }
+
+private:
+    std::unique_ptr<BloomFilterFuncBase> _new_bloom_filter() {
+        std::unique_ptr<BloomFilterFuncBase> bloom_filter(new BloomFilterFunc<TYPE_BIGINT>());
+        static_cast<void>(bloom_filter->init_with_fixed_length(_bytes));
+        if constexpr (!build) {
+            bloom_filter->insert_fixed_len(_build_column, 0);
+        }
+        return bloom_filter;
+    }
+
+    int _rows_number;
+    int64_t _bytes = 0;
+    vectorized::ColumnPtr _build_column;
+    vectorized::ColumnPtr _probe_column;
+    std::vector<uint8_t> _results;
+    std::unique_ptr<BloomFilterFuncBase> _bloom_filter;
+};
+
+// Prints the runs like the console reporter and keeps the time of each benchmark, so that they
+// can be compared with or saved as a baseline.
+class BaselineReporter : public benchmark::ConsoleReporter {
+public:
+    void ReportRuns(const std::vector<Run>& runs) override {
+        for (const auto& run : runs) {
+            if (run.run_type == Run::RT_Iteration) {
+                times[run.benchmark_name()] = run.GetAdjustedRealTime();
+            }
+        }
+        ConsoleReporter::ReportRuns(runs);
+    }
+
+    std::map<std::string, double> times;
+};
+
+static bool save_baseline(const std::string& path, const std::map<std::string, double>& times) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    for (const auto& [name, time] : times) {
+        writer.Key(name.c_str());
+        writer.Double(time);
+    }
+    writer.EndObject();
+    std::ofstream out(path);
+    out << buffer.GetString() << std::endl;
+    return out.good();
+}
+
+// Returns false if a benchmark is slower than its baseline by more than the threshold.
+static bool compare_baseline(const std::string& path,
+                             const std::map<std::string, double>& times, double threshold) {
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    rapidjson::Document baseline;
+    if (!in.good() || baseline.Parse(content.str().c_str()).HasParseError() ||
+        !baseline.IsObject()) {
+        std::cout << "invalid baseline file: " << path << std::endl;
+        return false;
+    }
+    bool passed = true;
+    for (const auto& [name, time] : times) {
+        if (!baseline.HasMember(name.c_str()) || !baseline[name.c_str()].IsNumber()) {
+            std::cout << "NEW        " << name << ": " << time << std::endl;
+            continue;
+        }
+        double base = baseline[name.c_str()].GetDouble();
+        double change = base > 0 ? time / base - 1 : 0;
+        bool regressed = change > threshold;
+        passed &= !regressed;
+        std::cout << (regressed ? "REGRESSION " : "OK         ") << name << ": " << base << " -> "
+                  << time << fmt::format(" ({:+.1f}%)", change * 100) << std::endl;
+    }
+    return passed;
+}
+
 class MultiBenchmark {
 public:
     MultiBenchmark() {}
@@ -286,10 +783,48 @@ public:
         } else if (equal_ignore_case(FLAGS_operation, "BinaryDictPageDecode")) {
             benchmarks.emplace_back(new doris::BinaryDictPageDecodeBenchmark(
                     FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number)));
-        } else {
+        } else if (equal_ignore_case(FLAGS_operation, "PackFixedKeys")) {
+            int iterations = std::stoi(FLAGS_iterations);
+            int rows_number = std::stoi(FLAGS_rows_number);
+            benchmarks.emplace_back(new doris::PackFixedKeysBenchmark<int32_t, 4, false>(
+                    "PackFixedKeys/int32x4", iterations, rows_number));
+            benchmarks.emplace_back(new doris::PackFixedKeysBenchmark<int64_t, 2, false>(
+                    "PackFixedKeys/int64x2", iterations, rows_number));
+            benchmarks.emplace_back(new doris::PackFixedKeysBenchmark<int32_t, 3, false>(
+                    "PackFixedKeys/int32x3", iterations, rows_number));
+            benchmarks.emplace_back(new doris::PackFixedKeysBenchmark<int32_t, 3, true>(
+                    "PackFixedKeys/nullable_int32x3", iterations, rows_number));
+        } else if (!add_operator_bm()) {
             std::cout << "operation invalid!" << std::endl;
         }
     }
+    // The benchmarks of the operators, "Operators" adds all of them.
+    bool add_operator_bm() {
+        int iterations = std::stoi(FLAGS_iterations);
+        int rows_number = std::stoi(FLAGS_rows_number);
+        bool all = equal_ignore_case(FLAGS_operation, "Operators");
+        bool added = false;
+        auto add = [&](const std::string& operation, auto create) {
+            if (all || equal_ignore_case(FLAGS_operation, operation)) {
+                benchmarks.emplace_back(create());
+                added = true;
+            }
+        };
+        add("SortBlock", [&] { return new SortBlockBenchmark(iterations, rows_number); });
+        add("BlockSerialize",
+            [&] { return new BlockSerializeBenchmark<true>(iterations, rows_number); });
+        add("BlockDeserialize",
+            [&] { return new BlockSerializeBenchmark<false>(iterations, rows_number); });
+        add("HashJoinProbe", [&] { return new HashJoinProbeBenchmark(iterations, rows_number); });
+        add("AggKeysFixedEmplace",
+            [&] { return new AggKeysFixedEmplaceBenchmark(iterations, rows_number); });
+        add("BloomFilterBuild",
+            [&] { return new BloomFilterBenchmark<true>(iterations, rows_number); });
+        add("BloomFilterProbe",
+            [&] { return new BloomFilterBenchmark<false>(iterations, rows_number); });
+        return added;
+    }
+
     void register_bm() {
         for (auto bm : benchmarks) {
             bm->register_bm();
@@ -313,8 +848,18 @@ int main(int argc, char** argv) {
     multi_bm.register_bm();
 
     benchmark::Initialize(&argc, argv);
-    benchmark::RunSpecifiedBenchmarks();
+    doris::BaselineReporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
     benchmark::Shutdown();
 
-    return 0;
+    if (FLAGS_baseline_file.empty()) {
+        return 0;
+    }
+    if (FLAGS_save_baseline) {
+        return doris::save_baseline(FLAGS_baseline_file, reporter.times) ? 0 : 1;
+    }
+    return doris::compare_baseline(FLAGS_baseline_file, reporter.times,
+                                   FLAGS_regression_threshold)
+                   ? 0
+                   : 1;
 }
@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// Replays the inputs of a fragment captured by pipeline::FragmentCapture offline, to profile
+// and tune the operators with the data of a production query. It prints the plan of the
+// fragment from the captured params, then reads every captured exchange and scan stream
+// `iterations` times, and reports the rows, bytes and time of each:
+//
+//   read        the blocks are read and deserialized, as received by an exchange
+//   hash        the columns of each block are hashed, as by a shuffle or a hash join
+//
+// Usage: fragment_replay_tool --capture_dir=<spill dir>/capture/<query id>/<fragment id>
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gflags/gflags.h>
+
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+#include "common/status.h"
+#include "pipeline/fragment_capture.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/debug_util.h"
+#include "util/mem_info.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+#include "vec/core/block.h"
+
+DEFINE_string(capture_dir, "", "the dir of the captured fragment");
+DEFINE_int32(iterations, 10, "times each captured stream is replayed");
+DEFINE_bool(hash, true, "hash the columns of the replayed blocks");
+
+namespace doris {
+
+static void print_plan(const TPipelineFragmentParams& params) {
+    std::cout << "query " << print_id(params.query_id) << " fragment " << params.fragment_id
+              << ", " << params.local_params.size() << " instances" << std::endl;
+    for (const auto& node : params.fragment.plan.nodes) {
+        std::cout << "  node " << node.node_id << " " << print_plan_node_type(node.node_type)
+                  << ", " << node.num_children << " children, " << node.conjuncts.size()
+                  << " conjuncts";
+        if (node.limit >= 0) {
+            std::cout << ", limit " << node.limit;
+        }
+        std::cout << std::endl;
+    }
+}
+
+static Status replay(const std::string& stream_dir) {
+    pipeline::FragmentCaptureReader reader(stream_dir);
+    RETURN_IF_ERROR(reader.open());
+    int64_t rows = 0;
+    int64_t bytes = 0;
+    int64_t read_ns = 0;
+    int64_t hash_ns = 0;
+    std::string structure;
+    std::vector<uint64_t> hashes;
+    for (int i = 0; i < FLAGS_iterations; ++i) {
+        reader.rewind();
+        bool eos = false;
+        while (!eos) {
+            vectorized::Block block;
+            int64_t start = MonotonicNanos();
+            RETURN_IF_ERROR(reader.read(&block, &eos));
+            read_ns += MonotonicNanos() - start;
+            if (block.rows() == 0) {
+                continue;
+            }
+            if (structure.empty()) {
+                structure = block.dump_structure();
+            }
+            rows += block.rows();
+            bytes += block.bytes();
+            if (FLAGS_hash) {
+                start = MonotonicNanos();
+                hashes.assign(block.rows(), 0);
+                for (size_t col = 0; col < block.columns(); ++col) {
+                    block.get_by_position(col).column->update_hashes_with_value(hashes.data());
+                }
+                hash_ns += MonotonicNanos() - start;
+            }
+        }
+    }
+    int iterations = std::max(FLAGS_iterations, 1);
+    auto per_second = [](int64_t value, int64_t ns) {
+        return ns == 0 ? 0 : static_cast<int64_t>(value * 1e9 / ns);
+    };
+    std::cout << stream_dir << ": " << reader.num_blocks() << " blocks, " << rows / iterations
+              << " rows, " << bytes / iterations << " bytes" << std::endl;
+    std::cout << "  " << structure << std::endl;
+    std::cout << "  read " << read_ns / iterations / 1000 << "us, " << per_second(rows, read_ns)
+              << " rows/s, " << per_second(bytes, read_ns) << " bytes/s" << std::endl;
+    if (FLAGS_hash) {
+        std::cout << "  hash " << hash_ns / iterations / 1000 << "us, "
+                  << per_second(rows, hash_ns) << " rows/s" << std::endl;
+    }
+    return Status::OK();
+}
+
+static Status run() {
+    TPipelineFragmentParams params;
+    RETURN_IF_ERROR(pipeline::FragmentCapture::read_params(FLAGS_capture_dir, &params));
+    print_plan(params);
+    std::vector<std::string> streams;
+    RETURN_IF_ERROR(pipeline::FragmentCapture::list_streams(FLAGS_capture_dir, &streams));
+    for (const auto& stream : streams) {
+        RETURN_IF_ERROR(replay(stream));
+    }
+    return Status::OK();
+}
+
+} // namespace doris
+
+int main(int argc, char** argv) {
+    gflags::SetUsageMessage("replay of the inputs of a captured fragment");
+    google::ParseCommandLineFlags(&argc, &argv, true);
+
+    doris::ThreadLocalHandle::create_thread_local_if_not_exits();
+    doris::ExecEnv::GetInstance()->init_mem_tracker();
+    doris::thread_context()->thread_mem_tracker_mgr->init();
+    doris::thread_context()->thread_mem_tracker_mgr->attach_limiter_tracker(
+            doris::MemTrackerLimiter::create_shared(doris::MemTrackerLimiter::Type::GLOBAL,
+                                                    "FragmentReplay"));
+    doris::CpuInfo::init();
+    doris::MemInfo::init();
+
+    auto st = doris::run();
+    if (!st.ok()) {
+        std::cerr << "fragment replay failed: " << st << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,472 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A reproducible benchmark of the load path of a stream load, run in one process without FE.
+// It generates the CSV or JSON rows of a duplicate key table and pushes them through the stages
+// of the load, one after another for each batch of rows:
+//
+//   receive     the body arrives in chunks to the StreamLoadPipe, as by the http handler
+//   parse       the rows are read into a block by the serdes of the columns, as by the readers
+//   distribute  the tablet of each row is the crc of the distribution column, as by the sink
+//   rpc         the rows of each tablet are copied, serialized and deserialized as a PBlock
+//   memtable    the rows are inserted into the memtable of the tablet
+//   flush       a full memtable is sorted and written as a segment
+//   close       the segment file is closed and synced
+//
+// Usage: load_benchmark_tool --format=json --rows=1000000 --num_tablets=16
+
+#include <fmt/format.h>
+#include <gen_cpp/Descriptors_types.h>
+#include <gen_cpp/data.pb.h>
+#include <gen_cpp/olap_file.pb.h>
+#include <gflags/gflags.h>
+#include <simdjson/simdjson.h> // IWYU pragma: keep
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "agent/be_exec_version_manager.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "common/status.h"
+#include "io/fs/file_writer.h"
+#include "io/fs/local_file_system.h"
+#include "io/fs/stream_load_pipe.h"
+#include "olap/memtable.h"
+#include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/tablet_schema.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/mem_tracker.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+#include "util/mem_info.h"
+#include "util/time.h"
+#include "vec/core/block.h"
+#include "vec/data_types/serde/data_type_serde.h"
+
+DEFINE_string(format, "csv", "format of the generated rows: csv or json");
+DEFINE_int64(rows, 1000000, "rows to load");
+DEFINE_int32(batch_rows, 4096, "rows parsed into one block");
+DEFINE_int32(num_tablets, 8, "tablets the rows are distributed to");
+DEFINE_int64(ndv, 0, "distinct keys of the generated rows, 0 means as many as the rows");
+DEFINE_int32(string_length, 32, "length of the generated strings");
+DEFINE_string(compression, "lz4", "compression of the blocks sent to the tablets: none, lz4, zstd");
+DEFINE_int64(write_buffer_size, 0, "memtable size to flush, 0 means config::write_buffer_size");
+DEFINE_string(output_dir, "./load_benchmark_dir", "directory of the segments written");
+DEFINE_int32(seed, 0, "seed of the generated rows");
+
+namespace doris {
+
+enum Stage { RECEIVE, PARSE, DISTRIBUTE, RPC, MEMTABLE, FLUSH, CLOSE, NUM_STAGES };
+static const char* kStageNames[] = {"receive",  "parse", "distribute", "rpc",
+                                    "memtable", "flush", "close"};
+
+class ScopedStageTimer {
+public:
+    explicit ScopedStageTimer(int64_t* ns) : _ns(ns), _start(MonotonicNanos()) {}
+    ~ScopedStageTimer() { *_ns += MonotonicNanos() - _start; }
+
+private:
+    int64_t* _ns;
+    int64_t _start;
+};
+
+// k1 BIGINT, k2 DATEV2, v1 VARCHAR, v2 DOUBLE, v3 INT, duplicate keys k1, k2, distributed by k1
+static TabletSchemaSPtr create_tablet_schema() {
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(KeysType::DUP_KEYS);
+    schema_pb.set_num_short_key_columns(2);
+    schema_pb.set_compression_type(segment_v2::CompressionTypePB::LZ4F);
+    auto add_column = [&](int32_t id, const std::string& name, const std::string& type,
+                          bool is_key, int32_t length) {
+        ColumnPB* column = schema_pb.add_column();
+        column->set_unique_id(id);
+        column->set_name(name);
+        column->set_type(type);
+        column->set_is_key(is_key);
+        column->set_is_nullable(false);
+        column->set_length(length);
+        column->set_index_length(std::min(length, 8));
+        column->set_aggregation("NONE");
+    };
+    add_column(0, "k1", "BIGINT", true, 8);
+    add_column(1, "k2", "DATEV2", true, 4);
+    add_column(2, "v1", "VARCHAR", false, FLAGS_string_length + 4);
+    add_column(3, "v2", "DOUBLE", false, 8);
+    add_column(4, "v3", "INT", false, 4);
+    auto schema = std::make_shared<TabletSchema>();
+    schema->init_from_pb(schema_pb);
+    return schema;
+}
+
+static TDescriptorTable create_descriptor_table() {
+    TDescriptorTableBuilder dtb;
+    TTupleDescriptorBuilder tuple_builder;
+    auto add_slot = [&](TSlotDescriptorBuilder builder, const std::string& name, int pos) {
+        tuple_builder.add_slot(builder.column_name(name).column_pos(pos).nullable(false).build());
+    };
+    add_slot(TSlotDescriptorBuilder().type(TYPE_BIGINT), "k1", 0);
+    add_slot(TSlotDescriptorBuilder().type(TYPE_DATEV2), "k2", 1);
+    add_slot(TSlotDescriptorBuilder().string_type(FLAGS_string_length), "v1", 2);
+    add_slot(TSlotDescriptorBuilder().type(TYPE_DOUBLE), "v2", 3);
+    add_slot(TSlotDescriptorBuilder().type(TYPE_INT), "v3", 4);
+    tuple_builder.build(&dtb);
+    return dtb.desc_tbl();
+}
+
+// One row per line, JSON lines for json.
+static std::string generate_payload() {
+    std::mt19937_64 rng(FLAGS_seed);
+    int64_t ndv = FLAGS_ndv > 0 ? FLAGS_ndv : FLAGS_rows;
+    std::string payload;
+    std::string str(FLAGS_string_length, 'a');
+    for (int64_t i = 0; i < FLAGS_rows; ++i) {
+        int64_t k1 = static_cast<int64_t>(rng() % ndv);
+        int day = 1 + static_cast<int>(rng() % 28);
+        int month = 1 + static_cast<int>(rng() % 12);
+        for (auto& c : str) {
+            c = static_cast<char>('a' + rng() % 26);
+        }
+        double v2 = static_cast<double>(rng() % 1000000) / 100;
+        int32_t v3 = static_cast<int32_t>(rng() % 100000);
+        if (FLAGS_format == "json") {
+            payload += fmt::format(
+                    R"({{"k1":{},"k2":"2024-{:02d}-{:02d}","v1":"{}","v2":{},"v3":{}}})", k1,
+                    month, day, str, v2, v3);
+        } else {
+            payload += fmt::format("{},2024-{:02d}-{:02d},{},{},{}", k1, month, day, str, v2, v3);
+        }
+        payload += '\n';
+    }
+    return payload;
+}
+
+class LoadBenchmark {
+public:
+    Status init() {
+        _schema = create_tablet_schema();
+        RETURN_IF_ERROR(DescriptorTbl::create(&_pool, create_descriptor_table(), &_desc_tbl));
+        _tuple_desc = _desc_tbl->get_tuple_descriptor(0);
+        for (auto* slot : _tuple_desc->slots()) {
+            _serdes.push_back(slot->get_data_type_ptr()->get_serde());
+        }
+        if (FLAGS_compression == "none") {
+            _compression = segment_v2::CompressionTypePB::NO_COMPRESSION;
+        } else if (FLAGS_compression == "zstd") {
+            _compression = segment_v2::CompressionTypePB::ZSTD;
+        } else {
+            _compression = segment_v2::CompressionTypePB::LZ4;
+        }
+        _memtables.resize(FLAGS_num_tablets);
+        _insert_tracker = std::make_shared<MemTracker>("LoadBenchmarkInsert");
+        _flush_tracker = std::make_shared<MemTracker>("LoadBenchmarkFlush");
+        auto fs = io::global_local_filesystem();
+        RETURN_IF_ERROR(fs->delete_directory(FLAGS_output_dir));
+        return fs->create_directory(FLAGS_output_dir);
+    }
+
+    Status run(const std::string& payload) {
+        std::string body;
+        RETURN_IF_ERROR(_receive(payload, &body));
+        // simdjson reads a few bytes past the end of a document
+        size_t body_size = body.size();
+        body.resize(body_size + simdjson::SIMDJSON_PADDING);
+
+        auto block = _new_block();
+        auto columns = block.mutate_columns();
+        size_t pos = 0;
+        while (pos < body_size) {
+            size_t end = body.find('\n', pos);
+            if (end == std::string::npos || end > body_size) {
+                end = body_size;
+            }
+            {
+                ScopedStageTimer timer(&_stage_ns[PARSE]);
+                RETURN_IF_ERROR(
+                        _parse_row(body.data() + pos, end - pos, body.size() - pos, columns));
+            }
+            pos = end + 1;
+            if (columns[0]->size() >= FLAGS_batch_rows) {
+                block.set_columns(std::move(columns));
+                RETURN_IF_ERROR(_write_block(block));
+                block = _new_block();
+                columns = block.mutate_columns();
+            }
+        }
+        if (columns[0]->size() > 0) {
+            block.set_columns(std::move(columns));
+            RETURN_IF_ERROR(_write_block(block));
+        }
+        for (int tablet = 0; tablet < FLAGS_num_tablets; ++tablet) {
+            RETURN_IF_ERROR(_flush(tablet));
+        }
+        return Status::OK();
+    }
+
+    void report(size_t payload_bytes) const {
+        int64_t total_ns = std::accumulate(_stage_ns, _stage_ns + NUM_STAGES, int64_t(0));
+        std::cout << fmt::format("format: {}, rows: {}, bytes: {}, tablets: {}, segments: {}\n",
+                                 FLAGS_format, _rows, payload_bytes, FLAGS_num_tablets,
+                                 _segments);
+        std::cout << fmt::format("{:<12}{:>12}{:>10}{:>16}\n", "stage", "time(ms)", "share",
+                                 "rows/s");
+        for (int stage = 0; stage < NUM_STAGES; ++stage) {
+            std::cout << fmt::format("{:<12}{:>12.1f}{:>9.1f}%{:>16.0f}\n", kStageNames[stage],
+                                     _stage_ns[stage] / 1e6,
+                                     total_ns == 0 ? 0 : 100.0 * _stage_ns[stage] / total_ns,
+                                     _stage_ns[stage] == 0 ? 0 : _rows * 1e9 / _stage_ns[stage]);
+        }
+        std::cout << fmt::format("{:<12}{:>12.1f}{:>10}{:>16.0f}\n", "total", total_ns / 1e6, "",
+                                 total_ns == 0 ? 0 : _rows * 1e9 / total_ns);
+        std::cout << fmt::format("throughput: {:.1f} MB/s\n",
+                                 total_ns == 0 ? 0 : payload_bytes * 1e3 / total_ns);
+    }
+
+private:
+    vectorized::Block _new_block() const {
+        vectorized::Block block;
+        for (auto* slot : _tuple_desc->slots()) {
+            block.insert({slot->get_empty_mutable_column(), slot->get_data_type_ptr(),
+                          slot->col_name()});
+        }
+        return block;
+    }
+
+    // The http handler appends the chunks of the body to the pipe, the reader reads it.
+    Status _receive(const std::string& payload, std::string* body) {
+        ScopedStageTimer timer(&_stage_ns[RECEIVE]);
+        auto pipe = std::make_shared<io::StreamLoadPipe>();
+        Status append_status;
+        std::thread sender([&]() {
+            constexpr size_t kChunkSize = 64 * 1024;
+            for (size_t pos = 0; pos < payload.size() && append_status.ok(); pos += kChunkSize) {
+                append_status = pipe->append(payload.data() + pos,
+                                             std::min(kChunkSize, payload.size() - pos));
+            }
+            if (append_status.ok()) {
+                append_status = pipe->finish();
+            }
+        });
+        body->resize(payload.size());
+        size_t received = 0;
+        Status st;
+        while (received < body->size()) {
+            size_t bytes_read = 0;
+            st = pipe->read_at(received, Slice(body->data() + received, body->size() - received),
+                               &bytes_read);
+            if (!st.ok() || bytes_read == 0) {
+                break;
+            }
+            received += bytes_read;
+        }
+        if (!st.ok()) {
+            pipe->cancel(st.to_string());
+        }
+        sender.join();
+        RETURN_IF_ERROR(st);
+        RETURN_IF_ERROR(append_status);
+        body->resize(received);
+        return Status::OK();
+    }
+
+    // Append the row of `data` to `columns`, `capacity` is the bytes readable from `data`.
+    Status _parse_row(const char* data, size_t size, size_t capacity,
+                      vectorized::MutableColumns& columns) {
+        if (size == 0) {
+            return Status::OK();
+        }
+        if (FLAGS_format == "json") {
+            try {
+                auto doc = _json_parser.iterate(data, size, capacity);
+                simdjson::ondemand::object object = doc.get_object();
+                size_t column_index = 0;
+                for (auto field : object) {
+                    simdjson::ondemand::value value = field.value();
+                    std::string_view str;
+                    if (value.type() == simdjson::ondemand::json_type::string) {
+                        str = value.get_string();
+                    } else {
+                        str = value.raw_json_token();
+                    }
+                    while (!str.empty() && std::isspace(str.back())) {
+                        str.remove_suffix(1);
+                    }
+                    Slice slice(str.data(), str.size());
+                    RETURN_IF_ERROR(_serdes[column_index]->deserialize_one_cell_from_json(
+                            *columns[column_index], slice, _format_options));
+                    ++column_index;
+                }
+            } catch (simdjson::simdjson_error& e) {
+                return Status::DataQualityError("failed to parse json: {}", e.what());
+            }
+        } else {
+            size_t column_index = 0;
+            size_t begin = 0;
+            for (size_t i = 0; i <= size && column_index < columns.size(); ++i) {
+                if (i == size || data[i] == ',') {
+                    Slice slice(data + begin, i - begin);
+                    RETURN_IF_ERROR(_serdes[column_index]->deserialize_one_cell_from_json(
+                            *columns[column_index], slice, _format_options));
+                    ++column_index;
+                    begin = i + 1;
+                }
+            }
+        }
+        ++_rows;
+        return Status::OK();
+    }
+
+    Status _write_block(const vectorized::Block& block) {
+        std::vector<std::vector<uint32_t>> tablet_rows(FLAGS_num_tablets);
+        {
+            ScopedStageTimer timer(&_stage_ns[DISTRIBUTE]);
+            std::vector<uint32_t> hashes(block.rows(), 0);
+            block.get_by_position(0).column->update_crcs_with_value(
+                    hashes.data(), TYPE_BIGINT, static_cast<uint32_t>(hashes.size()));
+            for (uint32_t row = 0; row < hashes.size(); ++row) {
+                tablet_rows[hashes[row] % FLAGS_num_tablets].push_back(row);
+            }
+        }
+        for (int tablet = 0; tablet < FLAGS_num_tablets; ++tablet) {
+            const auto& rows = tablet_rows[tablet];
+            if (rows.empty()) {
+                continue;
+            }
+            vectorized::Block received;
+            {
+                ScopedStageTimer timer(&_stage_ns[RPC]);
+                auto empty = block.clone_empty();
+                auto sent = vectorized::MutableBlock::build_mutable_block(&empty);
+                sent.add_rows(&block, rows.data(), rows.data() + rows.size());
+                PBlock pblock;
+                size_t uncompressed_bytes = 0;
+                size_t compressed_bytes = 0;
+                RETURN_IF_ERROR(sent.to_block().serialize(
+                        BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
+                        &compressed_bytes, _compression));
+                RETURN_IF_ERROR(received.deserialize(pblock));
+            }
+            {
+                ScopedStageTimer timer(&_stage_ns[MEMTABLE]);
+                auto& memtable = _memtables[tablet];
+                if (memtable == nullptr) {
+                    memtable = std::make_unique<MemTable>(tablet, _schema.get(),
+                                                          &_tuple_desc->slots(), _tuple_desc,
+                                                          false, nullptr, _insert_tracker,
+                                                          _flush_tracker);
+                }
+                std::vector<uint32_t> row_idxs(received.rows());
+                std::iota(row_idxs.begin(), row_idxs.end(), 0);
+                memtable->insert(&received, row_idxs);
+            }
+            if (_memtables[tablet]->need_flush()) {
+                RETURN_IF_ERROR(_flush(tablet));
+            }
+        }
+        return Status::OK();
+    }
+
+    Status _flush(int tablet) {
+        auto& memtable = _memtables[tablet];
+        if (memtable == nullptr || memtable->empty()) {
+            return Status::OK();
+        }
+        auto fs = io::global_local_filesystem();
+        io::FileWriterPtr file_writer;
+        {
+            ScopedStageTimer timer(&_stage_ns[FLUSH]);
+            auto block = memtable->to_block();
+            memtable.reset();
+            RETURN_IF_ERROR(fs->create_file(
+                    fmt::format("{}/{}_{}.dat", FLAGS_output_dir, tablet, _segments),
+                    &file_writer));
+            segment_v2::SegmentWriterOptions opts;
+            segment_v2::SegmentWriter writer(file_writer.get(), _segments, _schema, nullptr,
+                                             nullptr, INT32_MAX, opts, nullptr, fs);
+            RETURN_IF_ERROR(writer.init());
+            RETURN_IF_ERROR(writer.append_block(block.get(), 0, block->rows()));
+            uint64_t segment_size = 0;
+            uint64_t index_size = 0;
+            RETURN_IF_ERROR(writer.finalize(&segment_size, &index_size));
+        }
+        {
+            ScopedStageTimer timer(&_stage_ns[CLOSE]);
+            RETURN_IF_ERROR(file_writer->close());
+        }
+        ++_segments;
+        return Status::OK();
+    }
+
+    ObjectPool _pool;
+    DescriptorTbl* _desc_tbl = nullptr;
+    TupleDescriptor* _tuple_desc = nullptr;
+    TabletSchemaSPtr _schema;
+    vectorized::DataTypeSerDeSPtrs _serdes;
+    vectorized::DataTypeSerDe::FormatOptions _format_options;
+    simdjson::ondemand::parser _json_parser;
+    segment_v2::CompressionTypePB _compression;
+    std::vector<std::unique_ptr<MemTable>> _memtables;
+    std::shared_ptr<MemTracker> _insert_tracker;
+    std::shared_ptr<MemTracker> _flush_tracker;
+
+    int64_t _rows = 0;
+    int64_t _segments = 0;
+    int64_t _stage_ns[NUM_STAGES] = {};
+};
+
+} // namespace doris
+
+int main(int argc, char** argv) {
+    gflags::SetUsageMessage("benchmark of the load path, from the http body to the segments");
+    google::ParseCommandLineFlags(&argc, &argv, true);
+
+    doris::ThreadLocalHandle::create_thread_local_if_not_exits();
+    doris::ExecEnv::GetInstance()->init_mem_tracker();
+    doris::thread_context()->thread_mem_tracker_mgr->init();
+    doris::thread_context()->thread_mem_tracker_mgr->attach_limiter_tracker(
+            doris::MemTrackerLimiter::create_shared(doris::MemTrackerLimiter::Type::GLOBAL,
+                                                    "LoadBenchmark"));
+    doris::CpuInfo::init();
+    doris::MemInfo::init();
+    if (FLAGS_write_buffer_size > 0) {
+        doris::config::write_buffer_size = FLAGS_write_buffer_size;
+    }
+
+    std::string payload = doris::generate_payload();
+    doris::LoadBenchmark benchmark;
+    auto st = benchmark.init();
+    if (st.ok()) {
+        st = benchmark.run(payload);
+    }
+    if (!st.ok()) {
+        std::cerr << "load benchmark failed: " << st << std::endl;
+        return 1;
+    }
+    benchmark.report(payload.size());
+    return 0;
+}
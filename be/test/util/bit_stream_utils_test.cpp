@@ -166,6 +166,38 @@ TEST(TestBitStreamUtil, TestMixed) {
     }
 }
 
+// GetBatch unpacks the byte aligned values in batches, it must read the same values as
+// GetValue wherever the batch starts.
+TEST(TestBitStreamUtil, TestGetBatch) {
+    const int num_values = 200;
+    for (int width = 1; width <= 32; ++width) {
+        const int len_bytes = BitUtil::Ceil(width * num_values, 8);
+        faststring buffer(len_bytes);
+        BitWriter writer(&buffer);
+        for (int i = 0; i < num_values; ++i) {
+            writer.PutValue((i * 2654435761U) & ((1ULL << width) - 1), width);
+        }
+        writer.Flush();
+
+        for (int start : {0, 1, 3, 7}) {
+            BitReader reader(buffer.data(), len_bytes);
+            std::vector<uint32_t> values(num_values);
+            for (int i = 0; i < start; ++i) {
+                EXPECT_TRUE(reader.GetValue(width, values.data() + i));
+            }
+            EXPECT_TRUE(reader.GetBatch(width, values.data() + start, 100));
+            EXPECT_TRUE(reader.GetBatch(width, values.data() + start + 100,
+                                        num_values - start - 100));
+            for (int i = 0; i < num_values; ++i) {
+                EXPECT_EQ((i * 2654435761U) & ((1ULL << width) - 1), values[i])
+                        << "width=" << width << ", start=" << start << ", i=" << i;
+            }
+            uint32_t value = 0;
+            EXPECT_FALSE(reader.GetBatch(width, &value, 8));
+        }
+    }
+}
+
 TEST(TestBitStreamUtil, TestSeekToBit) {
     faststring buffer(1);
 
@@ -1028,6 +1028,34 @@ TEST(BitmapValueTest, bitmap_union) {
     EXPECT_EQ(5, bitmap3.cardinality());
 }
 
+TEST(BitmapValueTest, bitmap_fastunion_many) {
+    std::vector<BitmapValue> values(100);
+    BitmapValue expected;
+    for (uint64_t i = 0; i < values.size(); ++i) {
+        for (uint64_t j = 0; j < 100; ++j) {
+            // some values share the high 32 bits with the others
+            uint64_t v = ((i % 7) << 32) + i * 1000 + j * 3;
+            values[i].add(v);
+            expected.add(v);
+        }
+    }
+    std::vector<const BitmapValue*> inputs;
+    for (const auto& value : values) {
+        inputs.push_back(&value);
+    }
+
+    BitmapValue empty;
+    empty.fastunion(inputs);
+    EXPECT_EQ(expected.cardinality(), empty.cardinality());
+    EXPECT_EQ(expected.to_string(), empty.to_string());
+
+    // a shared bitmap joins the union without changing the bitmap it shares with
+    BitmapValue bitmap = values[0];
+    bitmap.fastunion(inputs);
+    EXPECT_EQ(expected.to_string(), bitmap.to_string());
+    EXPECT_EQ(100, values[0].cardinality());
+}
+
 TEST(BitmapValueTest, bitmap_intersect) {
     BitmapValue empty;
     BitmapValue single(1024);
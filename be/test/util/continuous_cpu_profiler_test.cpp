@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#include "util/continuous_cpu_profiler.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "common/config.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+TEST(ContinuousCpuProfilerTest, tag_samples) {
+#ifdef __APPLE__
+    GTEST_SKIP() << "not supported on macos";
+#endif
+    config::continuous_cpu_profile_frequency = 1000;
+    auto* profiler = ContinuousCpuProfiler::instance();
+    ASSERT_TRUE(profiler->start().ok());
+    profiler->reset();
+
+    TUniqueId query_id;
+    query_id.__set_hi(123);
+    query_id.__set_lo(456);
+    cpu_profiler::t_query_id_hi = query_id.hi;
+    cpu_profiler::t_query_id_lo = query_id.lo;
+    cpu_profiler::t_workload_group_id = 7;
+    // burn about 200ms of cpu
+    volatile uint64_t sum = 0;
+    int64_t start = MonotonicMillis();
+    while (MonotonicMillis() - start < 200) {
+        for (int i = 0; i < 10000; ++i) {
+            sum = sum + i;
+        }
+    }
+    cpu_profiler::t_query_id_hi = 0;
+    cpu_profiler::t_query_id_lo = 0;
+    cpu_profiler::t_workload_group_id = 0;
+    profiler->collect();
+    profiler->stop();
+    config::continuous_cpu_profile_frequency = 0;
+
+    std::string top = profiler->top_json();
+    EXPECT_NE(std::string::npos, top.find(print_id(query_id))) << top;
+    uint64_t workload_group_id = 7;
+    std::string stacks = profiler->folded_stacks(&query_id, &workload_group_id);
+    EXPECT_EQ(0, stacks.find("workload_group_7;query_" + print_id(query_id))) << stacks;
+    uint64_t other_workload_group_id = 8;
+    EXPECT_TRUE(profiler->folded_stacks(&query_id, &other_workload_group_id).empty());
+}
+
+} // namespace doris
@@ -20,6 +20,7 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 
 namespace doris {
@@ -246,4 +247,46 @@ TEST_F(TestForCoding, TestValueSeek) {
     EXPECT_EQ(found, false);
 }
 
+TEST_F(TestForCoding, TestMinDelta) {
+    // timestamps of a fixed interval, and with jitters
+    std::vector<int64_t> fixed;
+    std::vector<int64_t> jittered;
+    for (int64_t i = 0; i < 1000; ++i) {
+        fixed.push_back(1700000000000000 + i * 1000000);
+        jittered.push_back(1700000000000000 + i * 1000000 + (i * 7919) % 64);
+    }
+    auto encode = [](const std::vector<int64_t>& data, faststring* buffer) {
+        ForEncoder<int64_t> encoder(buffer);
+        encoder.put_batch(data.data(), data.size());
+        return encoder.flush();
+    };
+    bool enabled = config::enable_delta_bitpacked_encoding;
+    for (const auto* data : {&fixed, &jittered}) {
+        config::enable_delta_bitpacked_encoding = false;
+        faststring delta_buffer(1);
+        uint32_t delta_size = encode(*data, &delta_buffer);
+        config::enable_delta_bitpacked_encoding = true;
+        faststring buffer(1);
+        uint32_t size = encode(*data, &buffer);
+        EXPECT_LT(size * 2, delta_size);
+
+        ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+        ASSERT_TRUE(decoder.init());
+        std::vector<int64_t> actual_result(data->size());
+        ASSERT_TRUE(decoder.get_batch(actual_result.data(), data->size()));
+        EXPECT_EQ(*data, actual_result);
+
+        int64_t target = (*data)[300] + 1;
+        bool exact_match;
+        ASSERT_TRUE(decoder.seek_at_or_after_value(&target, &exact_match));
+        EXPECT_FALSE(exact_match);
+        EXPECT_EQ(301, decoder.current_index());
+        ASSERT_TRUE(decoder.skip(500));
+        int64_t actual_value;
+        ASSERT_TRUE(decoder.get(&actual_value));
+        EXPECT_EQ((*data)[801], actual_value);
+    }
+    config::enable_delta_bitpacked_encoding = enabled;
+}
+
 } // namespace doris
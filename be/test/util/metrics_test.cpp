@@ -485,4 +485,71 @@ test_registry_task_duration_standard_deviation{instance="test",type="create_tabl
         registry.deregister_entity(entity);
     }
 }
+
+TEST_F(MetricsTest, LatencyHistogram) {
+    // every value is in the bucket of its index, and the buckets do not overlap
+    for (uint64_t value : {0UL, 1UL, 7UL, 8UL, 9UL, 15UL, 16UL, 17UL, 1000UL, 123456789UL,
+                           ~0UL}) {
+        size_t index = LatencyHistogramMetric::bucket_index(value);
+        ASSERT_LT(index, LatencyHistogramMetric::kNumBuckets);
+        EXPECT_LE(value, LatencyHistogramMetric::bucket_upper_bound(index));
+        if (index > 0) {
+            EXPECT_GT(value, LatencyHistogramMetric::bucket_upper_bound(index - 1));
+        }
+    }
+
+    LatencyHistogramMetric histogram;
+    EXPECT_EQ(0, histogram.percentile(50));
+    for (uint64_t i = 1; i <= 100000; ++i) {
+        histogram.add(i);
+    }
+    EXPECT_EQ(100000, histogram.num());
+    EXPECT_EQ(100000, histogram.max());
+    for (double p : {50.0, 90.0, 99.0, 99.9}) {
+        double expected = p / 100 * 100000;
+        double actual = histogram.percentile(p);
+        EXPECT_GE(actual, expected);
+        EXPECT_LE(actual, expected * (1 + 1.0 / LatencyHistogramMetric::kSubBuckets));
+    }
+    EXPECT_EQ(100000, histogram.percentile(100));
+
+    histogram.clear();
+    EXPECT_EQ(0, histogram.num());
+    EXPECT_EQ(0, histogram.percentile(99));
+}
+
+TEST_F(MetricsTest, LatencyHistogramRegistryOutput) {
+    MetricRegistry registry("test_registry");
+    auto entity = registry.register_entity("test_entity");
+    LatencyHistogramFamily family(entity.get(), "rpc_latency_us", "host", 2);
+    auto* host1 = family.get("host1");
+    EXPECT_EQ(host1, family.get("host1"));
+    for (int i = 1; i <= 100; i++) {
+        host1->add(i);
+    }
+    EXPECT_EQ(R"(# TYPE test_registry_rpc_latency_us summary
+test_registry_rpc_latency_us{host="host1",quantile="0.5"} 51
+test_registry_rpc_latency_us{host="host1",quantile="0.99"} 100
+test_registry_rpc_latency_us{host="host1",quantile="0.999"} 100
+test_registry_rpc_latency_us_sum{host="host1"} 5050
+test_registry_rpc_latency_us_count{host="host1"} 100
+test_registry_rpc_latency_us_max{host="host1"} 100
+)",
+              registry.to_prometheus());
+    EXPECT_EQ(
+            R"*([{"tags":{"metric":"rpc_latency_us","host":"host1"},"unit":"microseconds",)*"
+            R"*("value":{"total_count":100,"total_sum":5050,"p50":51,"p99":100,"p999":100,)*"
+            R"*("max":100}}])*",
+            registry.to_json());
+
+    // the hosts beyond the max labels share one histogram
+    auto* host2 = family.get("host2");
+    EXPECT_NE(host1, host2);
+    auto* other = family.get("host3");
+    EXPECT_NE(host2, other);
+    EXPECT_EQ(other, family.get("host4"));
+    EXPECT_EQ(host2, family.get("host2"));
+    registry.deregister_entity(entity);
+}
+
 } // namespace doris
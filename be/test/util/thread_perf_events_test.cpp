@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+#include "util/thread_perf_events.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+static int64_t busy_loop(int64_t n) {
+    volatile int64_t sum = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        sum = sum + i;
+    }
+    return sum;
+}
+
+TEST(ThreadPerfEventsTest, disabled) {
+    config::enable_pipeline_perf_events = false;
+    RuntimeProfile profile("test");
+    PerfEventCounters counters;
+    counters.init(&profile, 2);
+    EXPECT_FALSE(counters.enabled());
+    EXPECT_EQ(nullptr, profile.get_counter("CpuCycles"));
+    ScopedPerfEvents perf_events(&counters);
+}
+
+TEST(ThreadPerfEventsTest, nested_scopes) {
+    if (ThreadPerfEvents::current() == nullptr) {
+        GTEST_SKIP() << "perf events are not available";
+    }
+    config::enable_pipeline_perf_events = true;
+    RuntimeProfile outer_profile("outer");
+    RuntimeProfile inner_profile("inner");
+    RuntimeProfile total_profile("total");
+    PerfEventCounters outer;
+    PerfEventCounters inner;
+    PerfEventCounters total;
+    outer.init(&outer_profile, 2);
+    inner.init(&inner_profile, 2);
+    total.init(&total_profile, 2);
+    {
+        ScopedPerfEvents total_events(&total, true);
+        ScopedPerfEvents outer_events(&outer);
+        busy_loop(1000);
+        {
+            ScopedPerfEvents inner_events(&inner);
+            busy_loop(10000000);
+        }
+    }
+    config::enable_pipeline_perf_events = false;
+
+    int64_t outer_instructions = outer_profile.get_counter("Instructions")->value();
+    int64_t inner_instructions = inner_profile.get_counter("Instructions")->value();
+    int64_t total_instructions = total_profile.get_counter("Instructions")->value();
+    // the outer scope does not count the loop of the inner scope
+    EXPECT_GT(inner_instructions, 10000000);
+    EXPECT_LT(outer_instructions, inner_instructions / 10);
+    EXPECT_GE(total_instructions, outer_instructions + inner_instructions);
+}
+
+} // namespace doris
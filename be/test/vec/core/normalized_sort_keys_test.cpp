@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/normalized_sort_keys.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/block.h"
+#include "vec/core/sort_block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class NormalizedSortKeysTest : public testing::Test {
+protected:
+    static Block create_block(size_t rows) {
+        std::mt19937 rng(rows);
+        auto ints = ColumnInt32::create();
+        auto null_map = ColumnUInt8::create();
+        auto bigints = ColumnInt64::create();
+        for (size_t i = 0; i < rows; ++i) {
+            // few distinct values to have ties on the first column
+            ints->insert_value(static_cast<int32_t>(rng() % 5) - 2);
+            null_map->insert_value(rng() % 4 == 0);
+            bigints->insert_value(static_cast<int64_t>(rng()) - (1LL << 31));
+        }
+        Block block;
+        block.insert({ColumnNullable::create(std::move(ints), std::move(null_map)),
+                      make_nullable(std::make_shared<DataTypeInt32>()), "a"});
+        block.insert({std::move(bigints), std::make_shared<DataTypeInt64>(), "b"});
+        return block;
+    }
+
+    static int compare_columns(const Block& block, const SortDescription& description,
+                               size_t lhs, size_t rhs) {
+        for (const auto& column_desc : description) {
+            const auto& column = block.get_by_position(column_desc.column_number).column;
+            int res = column_desc.direction *
+                      column->compare_at(lhs, rhs, *column, column_desc.nulls_direction);
+            if (res != 0) {
+                return res;
+            }
+        }
+        return 0;
+    }
+
+    static int sign(int value) { return (value > 0) - (value < 0); }
+};
+
+TEST_F(NormalizedSortKeysTest, same_order_as_columns) {
+    Block block = create_block(64);
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            SortDescription description {{0, direction, nulls_direction}, {1, -direction, 1}};
+            ASSERT_TRUE(NormalizedSortKeys::is_supported(block, description));
+            NormalizedSortKeys keys;
+            keys.encode(block, description);
+            EXPECT_EQ(keys.key_size(), 1 + sizeof(int32_t) + 1 + sizeof(int64_t));
+            for (size_t i = 0; i < block.rows(); ++i) {
+                for (size_t j = 0; j < block.rows(); ++j) {
+                    ASSERT_EQ(sign(keys.compare(i, keys, j)),
+                              sign(compare_columns(block, description, i, j)))
+                            << i << " " << j;
+                }
+            }
+        }
+    }
+}
+
+TEST_F(NormalizedSortKeysTest, sort_block) {
+    Block block = create_block(1000);
+    SortDescription description {{0, -1, 1}, {1, 1, 1}};
+    for (size_t limit : {0, 10}) {
+        Block sorted = block.clone_without_columns();
+        sort_block(block, sorted, description, limit);
+        EXPECT_EQ(sorted.rows(), limit == 0 ? block.rows() : limit);
+        for (size_t i = 1; i < sorted.rows(); ++i) {
+            ASSERT_LE(compare_columns(sorted, description, i - 1, i), 0) << i;
+        }
+    }
+}
+
+TEST_F(NormalizedSortKeysTest, unsupported_types) {
+    Block block = create_block(4);
+    auto strings = ColumnString::create();
+    for (size_t i = 0; i < block.rows(); ++i) {
+        strings->insert_data("x", 1);
+    }
+    block.insert({std::move(strings), std::make_shared<DataTypeString>(), "c"});
+    SortDescription description {{0, 1, 1}, {2, 1, 1}};
+    EXPECT_FALSE(NormalizedSortKeys::is_supported(block, description));
+    NormalizedSortKeys keys;
+    EXPECT_FALSE(keys.try_encode(block, description));
+    EXPECT_TRUE(keys.empty());
+}
+
+} // namespace doris::vectorized
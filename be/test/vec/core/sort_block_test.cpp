@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+
+#include "vec/columns/column_string.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+TEST(SortBlockTest, prefixed_string_ref_compare) {
+    auto compare = [](const std::string& lhs, const std::string& rhs) {
+        return PrefixedStringRef(StringRef(lhs)).compare(PrefixedStringRef(StringRef(rhs)));
+    };
+    EXPECT_EQ(compare("abc", "abc"), 0);
+    EXPECT_LT(compare("abc", "abd"), 0);
+    EXPECT_LT(compare("", "a"), 0);
+    // same prefix, decided by the chars after it
+    EXPECT_GT(compare("abcdefgh2", "abcdefgh10"), 0);
+    // the zero padding of the prefix must not make them equal
+    EXPECT_LT(compare("a", std::string("a\0", 2)), 0);
+    EXPECT_GT(compare("\xff", "\x01\xff"), 0);
+}
+
+TEST(SortBlockTest, sort_by_string_columns) {
+    std::mt19937 rng(117);
+    auto first = ColumnString::create();
+    auto second = ColumnString::create();
+    const size_t rows = 1000;
+    for (size_t i = 0; i < rows; ++i) {
+        // long common prefixes and few distinct values to have ties on the first column
+        std::string value = "prefix_" + std::to_string(rng() % 20);
+        first->insert_data(value.data(), value.size());
+        value = std::string(rng() % 10, static_cast<char>(rng() % 3)) + std::to_string(rng());
+        second->insert_data(value.data(), value.size());
+    }
+    Block block;
+    block.insert({std::move(first), std::make_shared<DataTypeString>(), "a"});
+    block.insert({std::move(second), std::make_shared<DataTypeString>(), "b"});
+
+    for (UInt64 limit : {0, 10}) {
+        SortDescription description {{0, 1, 1}, {1, -1, 1}};
+        Block sorted = block.clone_empty();
+        sort_block(block, sorted, description, limit);
+        ASSERT_EQ(sorted.rows(), limit == 0 ? rows : limit);
+        const auto& a = sorted.get_by_position(0).column;
+        const auto& b = sorted.get_by_position(1).column;
+        for (size_t i = 1; i < sorted.rows(); ++i) {
+            int res = a->compare_at(i - 1, i, *a, 1);
+            ASSERT_LE(res, 0);
+            if (res == 0) {
+                ASSERT_GE(b->compare_at(i - 1, i, *b, 1), 0);
+            }
+        }
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_cursor.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+class SortCursorLoserTreeTest : public testing::Test {
+protected:
+    static Block create_sorted_block(std::vector<int32_t> values) {
+        std::sort(values.begin(), values.end());
+        auto column = ColumnInt32::create();
+        for (auto value : values) {
+            column->insert_value(value);
+        }
+        Block block;
+        block.insert({std::move(column), std::make_shared<DataTypeInt32>(), "a"});
+        return block;
+    }
+
+    // Merges all the cursors, taking at most `max_rows` rows at once.
+    static std::vector<int32_t> merge(std::vector<MergeSortCursorImpl>& cursors,
+                                      size_t max_rows) {
+        std::vector<MergeSortCursorImpl*> cursor_ptrs;
+        for (auto& cursor : cursors) {
+            cursor_ptrs.push_back(&cursor);
+        }
+        SortCursorLoserTree tree;
+        tree.init(std::move(cursor_ptrs));
+        std::vector<int32_t> result;
+        while (!tree.empty()) {
+            auto current = tree.top();
+            size_t rows = tree.top_run_rows(max_rows);
+            EXPECT_GE(rows, 1U);
+            const auto& column = assert_cast<const ColumnInt32&>(*current->all_columns[0]);
+            for (size_t i = 0; i < rows; ++i) {
+                result.push_back(column.get_data()[current->pos + i]);
+            }
+            current->pos += rows;
+            if (current->pos < current->rows) {
+                tree.update_top();
+            } else {
+                tree.pop();
+            }
+        }
+        return result;
+    }
+};
+
+TEST_F(SortCursorLoserTreeTest, merge) {
+    std::mt19937 rng(0);
+    for (size_t num_runs : {1, 2, 3, 7, 64}) {
+        std::vector<Block> blocks;
+        std::vector<int32_t> expected;
+        for (size_t i = 0; i < num_runs; ++i) {
+            std::vector<int32_t> values(rng() % 100);
+            for (auto& value : values) {
+                value = rng() % 1000;
+            }
+            expected.insert(expected.end(), values.begin(), values.end());
+            blocks.push_back(create_sorted_block(std::move(values)));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        SortDescription description {{0, 1, 1}};
+        for (size_t max_rows : {1, 16, 4096}) {
+            std::vector<MergeSortCursorImpl> cursors;
+            for (auto& block : blocks) {
+                cursors.emplace_back(block, description);
+            }
+            EXPECT_EQ(merge(cursors, max_rows), expected) << num_runs << " " << max_rows;
+        }
+    }
+}
+
+TEST_F(SortCursorLoserTreeTest, dominating_run) {
+    std::vector<Block> blocks;
+    blocks.push_back(create_sorted_block({5, 6, 7, 8, 100}));
+    blocks.push_back(create_sorted_block({1, 2, 3, 4, 9}));
+    SortDescription description {{0, 1, 1}};
+    std::vector<MergeSortCursorImpl> cursors;
+    for (auto& block : blocks) {
+        cursors.emplace_back(block, description);
+    }
+    SortCursorLoserTree tree;
+    tree.init({&cursors[0], &cursors[1]});
+    ASSERT_EQ(tree.top().impl, &cursors[1]);
+    // 1, 2, 3, 4 come before 5
+    EXPECT_EQ(tree.top_run_rows(100), 4U);
+    EXPECT_EQ(tree.top_run_rows(2), 2U);
+
+    cursors[1].pos += 4;
+    tree.update_top();
+    ASSERT_EQ(tree.top().impl, &cursors[0]);
+    EXPECT_EQ(tree.top_run_rows(100), 4U);
+
+    // the popped run does not take part until it is pushed again
+    tree.pop();
+    EXPECT_EQ(tree.size(), 1U);
+    ASSERT_EQ(tree.top().impl, &cursors[1]);
+    EXPECT_EQ(tree.top_run_rows(100), 1U);
+    tree.push(&cursors[0]);
+    EXPECT_EQ(tree.size(), 2U);
+    ASSERT_EQ(tree.top().impl, &cursors[0]);
+}
+
+} // namespace doris::vectorized
@@ -60,6 +60,8 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
 #include "vec/core/block.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
@@ -651,4 +653,54 @@ TEST(DataTypeSerDeArrowTest, DataTypeMapNullKeySerDeTest) {
     EXPECT_EQ(block.dump_data(1, 1), new_block.dump_data(1, 1));
 }
 
+TEST(DataTypeSerDeArrowTest, ZeroCopyConvertTest) {
+    auto int_column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    auto double_column = ColumnFloat64::create();
+    auto string_column = ColumnString::create();
+    for (int i = 0; i < 100; ++i) {
+        if (i % 7 == 0) {
+            int_column->insert_default();
+        } else {
+            int_column->insert(Field(Int64(i * 3)));
+        }
+        double_column->insert_value(i * 0.5);
+        string_column->insert_data(std::to_string(i).data(), std::to_string(i).size());
+    }
+    const auto* int_values = assert_cast<const ColumnInt32&>(int_column->get_nested_column())
+                                     .get_data()
+                                     .data();
+    const auto* double_values = double_column->get_data().data();
+    Block block;
+    block.insert({std::move(int_column),
+                  std::make_shared<DataTypeNullable>(std::make_shared<DataTypeInt32>()), "i"});
+    block.insert({std::move(double_column), std::make_shared<DataTypeFloat64>(), "d"});
+    block.insert({std::move(string_column), std::make_shared<DataTypeString>(), "s"});
+    auto schema = arrow::schema({arrow::field("i", arrow::int32(), true),
+                                 arrow::field("d", arrow::float64(), false),
+                                 arrow::field("s", arrow::utf8(), false)});
+
+    cctz::time_zone timezone_obj;
+    TimezoneUtils::find_cctz_time_zone(TimezoneUtils::default_time_zone, timezone_obj);
+    std::shared_ptr<arrow::RecordBatch> copied;
+    std::shared_ptr<arrow::RecordBatch> wrapped;
+    EXPECT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &copied,
+                                       timezone_obj)
+                        .ok());
+    EXPECT_TRUE(convert_to_arrow_batch(block, schema, arrow::default_memory_pool(), &wrapped,
+                                       timezone_obj, true)
+                        .ok());
+    EXPECT_TRUE(copied->Equals(*wrapped));
+    EXPECT_EQ(15, wrapped->column(0)->null_count());
+
+    // the numeric values are read in place, the strings are copied
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(int_values),
+              wrapped->column(0)->data()->buffers[1]->data());
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(double_values),
+              wrapped->column(1)->data()->buffers[1]->data());
+
+    // the batch keeps the columns alive
+    block.clear();
+    EXPECT_TRUE(copied->Equals(*wrapped));
+}
+
 } // namespace doris::vectorized
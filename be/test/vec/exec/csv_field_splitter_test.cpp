@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "util/simd/bits.h"
+#include "vec/exec/format/csv/csv_reader.h"
+
+namespace doris::vectorized {
+
+static std::vector<std::string> split(PlainCsvTextFieldSplitter& splitter, const std::string& line) {
+    std::vector<Slice> values;
+    splitter.split_line(Slice(line.data(), line.size()), &values);
+    std::vector<std::string> result;
+    for (const auto& value : values) {
+        result.emplace_back(value.to_string());
+    }
+    return result;
+}
+
+TEST(CsvFieldSplitterTest, bytes64_mask_of_byte) {
+    std::string data(64, 'a');
+    data[0] = ',';
+    data[17] = ',';
+    data[63] = ',';
+    EXPECT_EQ((1ULL << 0) | (1ULL << 17) | (1ULL << 63),
+              simd::bytes64_mask_of_byte(reinterpret_cast<const uint8_t*>(data.data()), ','));
+    EXPECT_EQ(0, simd::bytes64_mask_of_byte(reinterpret_cast<const uint8_t*>(data.data()), 'b'));
+}
+
+TEST(CsvFieldSplitterTest, single_char_separator) {
+    PlainCsvTextFieldSplitter splitter(false, false, ",");
+    EXPECT_EQ(std::vector<std::string>({"a", "", "bc", ""}), split(splitter, "a,,bc,"));
+
+    // the fields cross the 64 bytes blocks
+    std::vector<std::string> expected;
+    std::string line;
+    for (int i = 0; i < 50; ++i) {
+        expected.emplace_back(std::string(i % 7, 'x') + std::to_string(i));
+        line.append(expected.back());
+        if (i != 49) {
+            line.push_back(',');
+        }
+    }
+    ASSERT_GT(line.size(), 128);
+    EXPECT_EQ(expected, split(splitter, line));
+}
+
+TEST(CsvFieldSplitterTest, trim_values) {
+    PlainCsvTextFieldSplitter splitter(true, true, "|", 1, '"');
+    std::string long_value(70, 'v');
+    EXPECT_EQ(std::vector<std::string>({"a", long_value, "b", ""}),
+              split(splitter, "\"a\"  |" + long_value + "|b |"));
+}
+
+} // namespace doris::vectorized
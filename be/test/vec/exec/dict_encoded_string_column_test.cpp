@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/join/dict_encoded_string_column.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris::vectorized {
+
+static std::string long_value(size_t i) {
+    return std::string(64, 'a' + i % 8);
+}
+
+TEST(DictEncodedStringColumnTest, encode_and_gather) {
+    auto strings = ColumnString::create();
+    auto null_map = ColumnUInt8::create();
+    for (size_t i = 0; i < 10000; ++i) {
+        auto value = long_value(i);
+        strings->insert_data(value.data(), value.size());
+        null_map->insert_value(i % 10 == 3);
+    }
+    auto column = ColumnNullable::create(std::move(strings), std::move(null_map));
+    auto encoded = DictEncodedStringColumn::encode(*column);
+    ASSERT_NE(nullptr, encoded);
+    EXPECT_LT(encoded->allocated_bytes() * 2, column->allocated_bytes());
+
+    std::vector<uint32_t> indices = {0, 3, 9999, 17, 17, 5000};
+    auto expected = column->clone_empty();
+    expected->insert_indices_from(*column, indices.data(), indices.data() + indices.size());
+    auto result = column->clone_empty();
+    encoded->insert_indices_into(*result, indices.data(), indices.data() + indices.size());
+    ASSERT_EQ(indices.size(), result->size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        EXPECT_EQ(0, result->compare_at(i, i, *expected, 1)) << i;
+    }
+}
+
+TEST(DictEncodedStringColumnTest, skip_high_cardinality) {
+    auto strings = ColumnString::create();
+    for (size_t i = 0; i < 10000; ++i) {
+        auto value = std::to_string(i);
+        strings->insert_data(value.data(), value.size());
+    }
+    EXPECT_EQ(nullptr, DictEncodedStringColumn::encode(*strings));
+
+    auto numbers = ColumnInt32::create(10000, 1);
+    EXPECT_EQ(nullptr, DictEncodedStringColumn::encode(*numbers));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/equality_delete.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "util/runtime_profile.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class EqualityDeleteTest : public testing::Test {
+protected:
+    static ColumnWithTypeAndName int_column(const std::string& name,
+                                            const std::vector<int64_t>& values) {
+        auto column = ColumnInt64::create();
+        for (auto value : values) {
+            column->insert_value(value);
+        }
+        return nullable_column(name, std::move(column), std::make_shared<DataTypeInt64>());
+    }
+
+    static ColumnWithTypeAndName string_column(const std::string& name,
+                                               const std::vector<std::string>& values) {
+        auto column = ColumnString::create();
+        for (const auto& value : values) {
+            column->insert_data(value.data(), value.size());
+        }
+        return nullable_column(name, std::move(column), std::make_shared<DataTypeString>());
+    }
+
+    static ColumnWithTypeAndName nullable_column(const std::string& name,
+                                                 MutableColumnPtr column, DataTypePtr type) {
+        auto null_map = ColumnUInt8::create(column->size(), 0);
+        return {ColumnNullable::create(std::move(column), std::move(null_map)),
+                make_nullable(type), name};
+    }
+
+    static std::vector<int64_t> ids(const Block& block) {
+        std::vector<int64_t> result;
+        const auto& column = assert_cast<const ColumnNullable&>(*block.get_by_name("id").column);
+        for (size_t i = 0; i < block.rows(); ++i) {
+            result.push_back(column.get_nested_column().get_int(i));
+        }
+        return result;
+    }
+
+    RuntimeProfile _profile {"test"};
+};
+
+TEST_F(EqualityDeleteTest, fixed_keys) {
+    Block delete_block({int_column("id", {1, 3, 5}), int_column("version", {10, 30, 50})});
+    auto impl = EqualityDeleteBase::get_delete_impl(&delete_block);
+    ASSERT_TRUE(impl->init(&_profile).ok());
+
+    Block data_block({int_column("id", {1, 2, 3, 4, 5}), int_column("version", {10, 20, 31, 40, 50}),
+                      string_column("name", {"a", "b", "c", "d", "e"})});
+    ASSERT_TRUE(impl->filter_data_block(&data_block).ok());
+    EXPECT_EQ(std::vector<int64_t>({2, 3, 4}), ids(data_block));
+}
+
+TEST_F(EqualityDeleteTest, serialized_keys) {
+    Block delete_block({int_column("id", {1, 3}), string_column("name", {"a", "x"})});
+    auto impl = EqualityDeleteBase::get_delete_impl(&delete_block);
+    ASSERT_TRUE(impl->init(&_profile).ok());
+
+    Block data_block({int_column("id", {1, 2, 3}), string_column("name", {"a", "b", "c"})});
+    ASSERT_TRUE(impl->filter_data_block(&data_block).ok());
+    EXPECT_EQ(std::vector<int64_t>({2, 3}), ids(data_block));
+
+    Block missing_column_block({int_column("id", {1})});
+    EXPECT_FALSE(impl->filter_data_block(&missing_column_block).ok());
+}
+
+TEST_F(EqualityDeleteTest, probe_filter) {
+    const int64_t num_deletes = MultiEqualityDelete::PROBE_FILTER_MIN_ROWS;
+    std::vector<int64_t> delete_ids;
+    std::vector<int64_t> delete_versions;
+    for (int64_t i = 0; i < num_deletes; ++i) {
+        delete_ids.push_back(i * 2);
+        delete_versions.push_back(i);
+    }
+    Block delete_block({int_column("id", delete_ids), int_column("version", delete_versions)});
+    MultiEqualityDelete impl(&delete_block);
+    ASSERT_TRUE(impl.init(&_profile).ok());
+    ASSERT_TRUE(impl.has_probe_filter());
+
+    // the even ids with their version are deleted
+    std::vector<int64_t> data_ids;
+    std::vector<int64_t> data_versions;
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 4096; ++i) {
+        data_ids.push_back(i);
+        data_versions.push_back(i / 2);
+        if (i % 2 == 1) {
+            expected.push_back(i);
+        }
+    }
+    Block data_block({int_column("id", data_ids), int_column("version", data_versions)});
+    ASSERT_TRUE(impl.filter_data_block(&data_block).ok());
+    EXPECT_EQ(expected, ids(data_block));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "vec/common/hash_table/hash_map_context.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+
+namespace doris::vectorized {
+
+class HashMapContextTest : public testing::Test {
+protected:
+    // Packs the random columns and checks every key against the column values.
+    template <typename Key, typename T, size_t num_columns>
+    static void check_pack_fixeds(size_t num_rows) {
+        std::mt19937 rng(num_rows);
+        Columns columns;
+        ColumnRawPtrs raw_columns;
+        for (size_t j = 0; j < num_columns; ++j) {
+            auto column = ColumnVector<T>::create();
+            for (size_t i = 0; i < num_rows; ++i) {
+                column->insert_value(static_cast<T>(rng()));
+            }
+            columns.emplace_back(std::move(column));
+            raw_columns.push_back(columns.back().get());
+        }
+
+        MethodKeysFixed<PHHashMap<Key, char*, HashCRC32<Key>>> method(
+                Sizes(num_columns, sizeof(T)));
+        std::vector<Key> result(3);
+        // the stale keys must be overwritten
+        memset(result.data(), 0xff, result.size() * sizeof(Key));
+        method.pack_fixeds<Key>(num_rows, raw_columns, {}, result);
+        ASSERT_EQ(result.size(), num_rows);
+        for (size_t i = 0; i < num_rows; ++i) {
+            const char* key = reinterpret_cast<const char*>(&result[i]);
+            for (size_t j = 0; j < num_columns; ++j) {
+                T value = assert_cast<const ColumnVector<T>&>(*raw_columns[j]).get_data()[i];
+                ASSERT_EQ(memcmp(key + j * sizeof(T), &value, sizeof(T)), 0) << i << " " << j;
+            }
+            for (size_t k = num_columns * sizeof(T); k < sizeof(Key); ++k) {
+                ASSERT_EQ(key[k], 0) << i;
+            }
+        }
+    }
+};
+
+TEST_F(HashMapContextTest, pack_fixeds_same_width) {
+    for (size_t num_rows : {0, 1, 3, 4, 7, 1023}) {
+        check_pack_fixeds<UInt128, uint32_t, 4>(num_rows);
+        check_pack_fixeds<UInt128, uint64_t, 2>(num_rows);
+        check_pack_fixeds<UInt64, uint32_t, 2>(num_rows);
+        check_pack_fixeds<UInt64, uint16_t, 4>(num_rows);
+        check_pack_fixeds<UInt256, uint64_t, 4>(num_rows);
+        // not filling the key, packed by the generic path
+        check_pack_fixeds<UInt128, uint32_t, 3>(num_rows);
+    }
+}
+
+TEST_F(HashMapContextTest, string_hashes_of_repeated_keys) {
+    auto column = ColumnString::create();
+    auto null_map = ColumnUInt8::create();
+    for (const auto* value : {"cn", "cn", "cn", "us", "", "us", "us", "cn", "de"}) {
+        column->insert_data(value, strlen(value));
+        null_map->insert_value(strlen(value) == 0);
+    }
+    const size_t num_rows = column->size();
+    auto nullable = ColumnNullable::create(std::move(column), std::move(null_map));
+    const uint8_t* nulls = nullable->get_null_map_data().data();
+    ColumnRawPtrs key_columns {nullable.get()};
+
+    MethodStringNoCache<PHHashMap<StringRef, char*>> method;
+    method.init_serialized_keys(key_columns, num_rows, nulls);
+    ASSERT_EQ(method.hash_values.size(), num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        if (!nulls[i]) {
+            EXPECT_EQ(method.hash_values[i], method.hash_table->hash(method.keys[i])) << i;
+        }
+    }
+
+    constexpr uint32_t bucket_size = 16;
+    method.init_serialized_keys(key_columns, num_rows, nulls, true, false, bucket_size);
+    ASSERT_EQ(method.bucket_nums.size(), num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        EXPECT_EQ(method.bucket_nums[i],
+                  nulls[i] ? bucket_size
+                           : method.hash_table->hash(method.keys[i]) & (bucket_size - 1))
+                << i;
+    }
+}
+
+} // namespace doris::vectorized
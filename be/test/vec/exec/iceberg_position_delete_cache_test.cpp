@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/iceberg_position_delete_cache.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <memory>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+TEST(IcebergPositionDeleteCacheTest, LookupAndEvict) {
+    IcebergPositionDeleteCache cache(16 * 1024, 1);
+    EXPECT_EQ(nullptr, cache.lookup_deletes("delete_1.parquet"));
+
+    auto deletes = std::make_shared<IcebergPositionDeleteCache::PositionDeletes>();
+    (*deletes)["data_1.parquet"] = {1, 5, 9};
+    (*deletes)["data_2.parquet"] = {0};
+    cache.insert_deletes("delete_1.parquet", deletes);
+
+    auto cached = cache.lookup_deletes("delete_1.parquet");
+    ASSERT_NE(nullptr, cached);
+    EXPECT_EQ(2, cached->size());
+    EXPECT_EQ(std::vector<int64_t>({1, 5, 9}), cached->at("data_1.parquet"));
+    EXPECT_EQ(nullptr, cache.lookup_deletes("delete_2.parquet"));
+
+    // a large delete file evicts the first one, which stays valid for its holders
+    auto large_deletes = std::make_shared<IcebergPositionDeleteCache::PositionDeletes>();
+    (*large_deletes)["data_1.parquet"] = std::vector<int64_t>(2000, 0);
+    cache.insert_deletes("delete_2.parquet", large_deletes);
+    EXPECT_EQ(nullptr, cache.lookup_deletes("delete_1.parquet"));
+    EXPECT_NE(nullptr, cache.lookup_deletes("delete_2.parquet"));
+    EXPECT_EQ(3, cached->at("data_1.parquet").size());
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "vec/common/hash_table/hash.h"
+
+namespace doris::vectorized {
+
+using TestJoinHashTable = JoinHashTable<uint32_t, HashCRC32<uint32_t>>;
+
+class JoinHashTableTest : public testing::Test {
+protected:
+    // keys[0] is the mocked row of the build side
+    static void build(TestJoinHashTable& table, const std::vector<uint32_t>& keys,
+                      std::vector<uint32_t>& bucket_nums, bool direct, size_t num_tasks,
+                      bool probe_filter = false) {
+        table.prepare_build<TJoinOp::INNER_JOIN>(keys.size(), 4096, false);
+        if (probe_filter) {
+            table.init_probe_filter<TJoinOp::INNER_JOIN>();
+        }
+        if (direct) {
+            table.init_direct_mapping(keys.data(), keys.size(), nullptr);
+        }
+        bucket_nums.resize(keys.size());
+        for (size_t i = 0; i < keys.size(); i++) {
+            bucket_nums[i] = table.is_direct_mapping()
+                                     ? table.direct_bucket_num(keys[i])
+                                     : table.hash(keys[i]) & (table.get_bucket_size() - 1);
+        }
+        if (num_tasks > 1) {
+            table.parallel_build<TJoinOp::INNER_JOIN, false>(
+                    keys.data(), bucket_nums.data(), keys.size(), num_tasks,
+                    [](size_t n, const auto& func) {
+                        for (size_t i = n; i > 0; i--) {
+                            func(i - 1);
+                        }
+                    });
+        } else {
+            table.build<TJoinOp::INNER_JOIN, false>(keys.data(), bucket_nums.data(), keys.size());
+        }
+    }
+
+    // Returns the number of matched rows of `probe_keys`.
+    static int probe(TestJoinHashTable& table, const std::vector<uint32_t>& probe_keys) {
+        std::vector<uint32_t> buckets(probe_keys.size());
+        for (size_t i = 0; i < probe_keys.size(); i++) {
+            buckets[i] = table.is_direct_mapping()
+                                 ? table.direct_bucket_num(probe_keys[i])
+                                 : table.hash(probe_keys[i]) & (table.get_bucket_size() - 1);
+        }
+        table.pre_build_idxs(probe_keys.data(), buckets, nullptr);
+        std::vector<uint32_t> probe_idxs(4096);
+        std::vector<uint32_t> build_idxs(4096);
+        bool probe_visited = false;
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        int matched = 0;
+        int probe_rows = static_cast<int>(probe_keys.size());
+        while (probe_idx < probe_rows) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] =
+                    table.find_batch<TJoinOp::INNER_JOIN, false, false, false>(
+                            probe_keys.data(), buckets.data(), probe_idx, build_idx, probe_rows,
+                            probe_idxs.data(), probe_visited, build_idxs.data());
+            for (int i = 0; i < matched_cnt; i++) {
+                EXPECT_EQ(probe_keys[probe_idxs[i]], table.build_keys[build_idxs[i]]);
+            }
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+            matched += matched_cnt;
+        }
+        return matched;
+    }
+};
+
+TEST_F(JoinHashTableTest, direct_mapping) {
+    // dense keys 100..1099, every key twice
+    std::vector<uint32_t> keys {0};
+    for (uint32_t i = 0; i < 2000; i++) {
+        keys.push_back(100 + i % 1000);
+    }
+    TestJoinHashTable table;
+    std::vector<uint32_t> bucket_nums;
+    build(table, keys, bucket_nums, true, 1);
+    ASSERT_TRUE(table.is_direct_mapping());
+
+    // 0..99 and 1100..1199 are out of range
+    std::vector<uint32_t> probe_keys;
+    for (uint32_t i = 0; i < 1200; i++) {
+        probe_keys.push_back(i);
+    }
+    EXPECT_EQ(2000, probe(table, probe_keys));
+
+    // sparse keys are hashed
+    std::vector<uint32_t> sparse_keys {0, 1, 1000000, 2000000};
+    TestJoinHashTable sparse_table;
+    build(sparse_table, sparse_keys, bucket_nums, true, 1);
+    EXPECT_FALSE(sparse_table.is_direct_mapping());
+    EXPECT_EQ(2, probe(sparse_table, {1, 2, 2000000}));
+}
+
+TEST_F(JoinHashTableTest, parallel_build) {
+    std::vector<uint32_t> keys {0};
+    for (uint32_t i = 0; i < 100000; i++) {
+        keys.push_back(i * 7919 % 30011);
+    }
+    TestJoinHashTable serial_table;
+    TestJoinHashTable parallel_table;
+    std::vector<uint32_t> serial_buckets;
+    std::vector<uint32_t> parallel_buckets;
+    build(serial_table, keys, serial_buckets, false, 1);
+    build(parallel_table, keys, parallel_buckets, false, 4);
+    EXPECT_EQ(serial_table.first, parallel_table.first);
+    EXPECT_EQ(serial_table.next, parallel_table.next);
+}
+
+TEST_F(JoinHashTableTest, probe_filter) {
+    // large enough for the filter
+    std::vector<uint32_t> keys {0};
+    for (uint32_t i = 0; i < 1000000; i++) {
+        keys.push_back(i * 2);
+    }
+    TestJoinHashTable table;
+    std::vector<uint32_t> bucket_nums;
+    build(table, keys, bucket_nums, false, 1, true);
+    ASSERT_TRUE(table.has_probe_filter());
+
+    // the odd keys miss, the filter rejects most of them but no matched key
+    std::vector<uint32_t> probe_keys;
+    for (uint32_t i = 0; i < 4000; i++) {
+        probe_keys.push_back(i * 7);
+    }
+    EXPECT_EQ(2000, probe(table, probe_keys));
+    EXPECT_TRUE(table._probe_filter_enabled.load());
+    EXPECT_GT(table._probe_filter_rejected_rows.load(), 1500U);
+
+    // disabled after the sample rows if most rows match
+    std::vector<uint32_t> matched_keys(keys.begin() + 1, keys.end());
+    EXPECT_EQ(1000000, probe(table, matched_keys));
+    EXPECT_FALSE(table._probe_filter_enabled.load());
+    EXPECT_EQ(1000000, probe(table, matched_keys));
+
+    // the buckets of direct mapping are not hashed
+    TestJoinHashTable direct_table;
+    build(direct_table, keys, bucket_nums, true, 1, true);
+    EXPECT_TRUE(direct_table.is_direct_mapping());
+    EXPECT_FALSE(direct_table.has_probe_filter());
+}
+
+} // namespace doris::vectorized
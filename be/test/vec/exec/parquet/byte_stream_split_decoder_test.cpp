@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "vec/exec/format/parquet/byte_stream_split_decoder.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+// The transposed widths 4 and 8 must gather the same bytes as the scalar loop, including the
+// values after the last whole batch.
+TEST(ByteStreamSplitDecoderTest, DecodeStreams) {
+    for (int width : {2, 4, 8, 12}) {
+        for (size_t num_values : {1, 15, 16, 17, 100}) {
+            for (size_t start : {0, 3}) {
+                const size_t stride = start + num_values + 5;
+                std::vector<uint8_t> src(stride * width);
+                for (size_t i = 0; i < src.size(); ++i) {
+                    src[i] = static_cast<uint8_t>(i * 131 + 7);
+                }
+                std::vector<uint8_t> dest(num_values * width);
+                ByteStreamSplitDecoder::decode_streams(src.data(), width, stride, start,
+                                                       num_values, dest.data());
+                for (size_t i = 0; i < num_values; ++i) {
+                    for (int b = 0; b < width; ++b) {
+                        EXPECT_EQ(src[b * stride + start + i], dest[i * width + b])
+                                << "width=" << width << ", num_values=" << num_values
+                                << ", i=" << i << ", b=" << b;
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/vparquet_bloom_filter.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <stdint.h>
+
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+TEST(ParquetBloomFilterTest, Hash) {
+    // the hash of parquet is the 64 bits xxhash, not xxh3
+    EXPECT_EQ(0xEF46DB3751D8E999ULL, ParquetBloomFilter::hash("", 0));
+}
+
+TEST(ParquetBloomFilterTest, FindInsertedValues) {
+    ParquetBloomFilter bloom_filter;
+    EXPECT_FALSE(bloom_filter.init(100).ok());
+    ASSERT_TRUE(bloom_filter.init(1024).ok());
+    EXPECT_EQ(1024, bloom_filter.size());
+
+    for (int32_t value = 0; value < 100; ++value) {
+        bloom_filter.insert_hash(ParquetBloomFilter::hash(&value, sizeof(value)));
+    }
+    std::string text = "customer_42";
+    bloom_filter.insert_hash(ParquetBloomFilter::hash(text.data(), text.size()));
+
+    for (int32_t value = 0; value < 100; ++value) {
+        EXPECT_TRUE(bloom_filter.find_hash(ParquetBloomFilter::hash(&value, sizeof(value))));
+    }
+    EXPECT_TRUE(bloom_filter.find_hash(ParquetBloomFilter::hash(text.data(), text.size())));
+
+    int false_positives = 0;
+    for (int32_t value = 1000; value < 11000; ++value) {
+        false_positives += bloom_filter.find_hash(ParquetBloomFilter::hash(&value, sizeof(value)));
+    }
+    // 101 values in 32 blocks, the false positive rate is far below 5%
+    EXPECT_LT(false_positives, 500);
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <vector>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "vec/exec/scan/vfile_scanner.h"
+
+namespace doris::vectorized {
+
+static TScanRangeParams create_scan_range(int64_t start_offset, int64_t size) {
+    TFileRangeDesc range;
+    range.__set_path("file.parquet");
+    range.__set_start_offset(start_offset);
+    range.__set_size(size);
+    TScanRangeParams scan_range;
+    scan_range.scan_range.ext_scan_range.file_scan_range.ranges.push_back(range);
+    return scan_range;
+}
+
+TEST(VFileScannerSplitTest, SplitParquetScanRanges) {
+    const int64_t min_bytes = config::parquet_scan_range_split_min_bytes;
+    TFileScanRangeParams params;
+    params.__set_format_type(TFileFormatType::FORMAT_PARQUET);
+
+    // the small range is kept, the large one takes the four idle scanners
+    std::vector<TScanRangeParams> scan_ranges {create_scan_range(0, min_bytes),
+                                               create_scan_range(100, min_bytes * 10 + 7)};
+    VFileScanner::split_parquet_scan_ranges(&params, 6, &scan_ranges);
+    ASSERT_EQ(6, scan_ranges.size());
+    EXPECT_EQ(min_bytes, scan_ranges[0].scan_range.ext_scan_range.file_scan_range.ranges[0].size);
+
+    int64_t next_offset = 100;
+    for (size_t i : {1, 2, 3, 4, 5}) {
+        const auto& range = scan_ranges[i].scan_range.ext_scan_range.file_scan_range.ranges[0];
+        EXPECT_EQ(next_offset, range.start_offset);
+        EXPECT_GE(range.size, min_bytes);
+        next_offset += range.size;
+    }
+    EXPECT_EQ(100 + min_bytes * 10 + 7, next_offset);
+
+    // the other formats and the whole file ranges are not split
+    std::vector<TScanRangeParams> whole_file {create_scan_range(0, -1)};
+    VFileScanner::split_parquet_scan_ranges(&params, 6, &whole_file);
+    EXPECT_EQ(1, whole_file.size());
+    params.__set_format_type(TFileFormatType::FORMAT_ORC);
+    std::vector<TScanRangeParams> orc {create_scan_range(0, min_bytes * 10)};
+    VFileScanner::split_parquet_scan_ranges(&params, 6, &orc);
+    EXPECT_EQ(1, orc.size());
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/window_segment_tree.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-param-test.h>
+#include <gtest/gtest-test-part.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+// declare function
+void register_aggregate_function_sum(AggregateFunctionSimpleFactory& factory);
+void register_aggregate_function_minmax(AggregateFunctionSimpleFactory& factory);
+void register_aggregate_function_avg(AggregateFunctionSimpleFactory& factory);
+
+class WindowSegmentTreeTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(WindowSegmentTreeTest, sliding_frames) {
+    auto column = ColumnVector<Int32>::create();
+    for (int i = 0; i < 2000; i++) {
+        column->insert_value((i * 7919) % 1009 - 500);
+    }
+    const IColumn* columns[1] = {column.get()};
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_sum(factory);
+    register_aggregate_function_minmax(factory);
+    register_aggregate_function_avg(factory);
+    DataTypes data_types = {std::make_shared<DataTypeInt32>()};
+    auto function = factory.get(GetParam(), data_types);
+    ASSERT_TRUE(WindowSegmentTree::is_supported(*function));
+
+    const int64_t partition_start = 100;
+    const int64_t partition_end = 1900;
+    WindowSegmentTree tree(function.get());
+    EXPECT_FALSE(tree.is_built_for(partition_start, partition_end));
+    tree.build(partition_start, partition_end, columns);
+    EXPECT_TRUE(tree.is_built_for(partition_start, partition_end));
+
+    std::vector<char> expected_place(function->size_of_data());
+    std::vector<char> actual_place(function->size_of_data());
+    for (int64_t width : {1, 15, 16, 17, 255, 256, 1000, 3000}) {
+        for (int64_t row = partition_start - 20; row < partition_end + 20; row += 13) {
+            const int64_t frame_start = row - width / 2;
+            const int64_t frame_end = frame_start + width;
+            if (std::min(frame_end, partition_end) <= std::max(frame_start, partition_start)) {
+                continue;
+            }
+            function->create(expected_place.data());
+            function->create(actual_place.data());
+            function->add_range_single_place(partition_start, partition_end, frame_start,
+                                             frame_end, expected_place.data(), columns, nullptr);
+            tree.aggregate(frame_start, frame_end, actual_place.data(), columns, nullptr);
+
+            auto result = function->get_return_type()->create_column();
+            function->insert_result_into(expected_place.data(), *result);
+            function->insert_result_into(actual_place.data(), *result);
+            EXPECT_EQ(0, result->compare_at(0, 1, *result, 1))
+                    << "width=" << width << ", row=" << row;
+            function->destroy(expected_place.data());
+            function->destroy(actual_place.data());
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Params, WindowSegmentTreeTest,
+                         ::testing::ValuesIn(std::vector<std::string> {"sum", "min", "max",
+                                                                        "avg"}));
+
+} // namespace doris::vectorized
@@ -141,6 +141,8 @@ TEST(FunctionLikeTest, regexp_extract) {
                          std::string("i")},
                         {{std::string("hitdecisiondlist"), std::string("(i)(.*?)(e)"), (int64_t)2},
                          std::string("td")},
+                        {{std::string("x=a3&x=18abc"), std::string("y=([0-9]+)"), (int64_t)1},
+                         std::string("")},
                         // null
                         {{std::string("abc"), Null(), (int64_t)0}, Null()},
                         {{Null(), std::string("i([0-9]+)"), (int64_t)0}, Null()}};
@@ -198,6 +200,8 @@ TEST(FunctionLikeTest, regexp_replace) {
              std::string("doris-doris")},
 
             {{std::string("a b c"), std::string(" "), std::string("-")}, std::string("a-b-c")},
+            {{std::string("axzb"), std::string("xy?z"), std::string("-")}, std::string("a-b")},
+            {{std::string("abc"), std::string("xy?z"), std::string("-")}, std::string("abc")},
             {{std::string("a b c"), std::string("(b)"), std::string("<\\1>")},
              std::string("a <b> c")},
             {{std::string("qwewe"), std::string(""), std::string("true")},
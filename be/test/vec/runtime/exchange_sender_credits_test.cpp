@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/runtime/exchange_sender_credits.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+TEST(ExchangeSenderCreditsTest, EvenShareBeforeMeasured) {
+    ExchangeSenderCredits credits(1000, 100);
+    EXPECT_EQ(1000, credits.credit(0));
+    credits.on_received(0, 600);
+    credits.on_received(1, 300);
+    EXPECT_EQ(500, credits.credit(0));
+    EXPECT_EQ(500, credits.credit(1));
+    EXPECT_TRUE(credits.exhausted(0));
+    EXPECT_FALSE(credits.exhausted(1));
+
+    credits.on_consumed(0, 200, 1000000);
+    EXPECT_EQ(400, credits.buffered_bytes(0));
+    EXPECT_FALSE(credits.exhausted(0));
+}
+
+TEST(ExchangeSenderCreditsTest, ShareByConsumeRate) {
+    ExchangeSenderCredits credits(1000, 100);
+    int64_t now_ns = 1000000;
+    for (int i = 0; i < 20; ++i) {
+        // the blocks of sender 0 are consumed three times as fast as those of sender 1
+        credits.on_received(0, 300);
+        credits.on_received(1, 100);
+        credits.on_consumed(0, 300, now_ns);
+        credits.on_consumed(1, 100, now_ns);
+        now_ns += 1000000;
+    }
+    EXPECT_NEAR(750, credits.credit(0), 1);
+    EXPECT_NEAR(250, credits.credit(1), 1);
+    // a sender whose blocks are not consumed yet still gets the least credit
+    EXPECT_EQ(100, credits.credit(2));
+    credits.on_received(2, 150);
+    EXPECT_TRUE(credits.exhausted(2));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/exchange_compression_selector.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris::vectorized {
+
+using segment_v2::CompressionTypePB;
+
+// compresses every block with the ratio and the time per byte of its codec
+static void feed(ExchangeCompressionSelector* selector, int blocks, double lz4_ratio,
+                 double zstd_ratio) {
+    for (int i = 0; i < blocks; ++i) {
+        auto type = selector->next_type();
+        const size_t bytes = 1000000;
+        if (type == CompressionTypePB::LZ4) {
+            selector->update_compression(type, bytes, bytes * lz4_ratio, bytes * 1);
+        } else if (type == CompressionTypePB::ZSTD) {
+            selector->update_compression(type, bytes, bytes * zstd_ratio, bytes * 5);
+        } else {
+            selector->update_compression(type, bytes, bytes, 0);
+        }
+    }
+}
+
+TEST(ExchangeCompressionSelectorTest, DefaultBeforeNetworkMeasured) {
+    ExchangeCompressionSelector selector(CompressionTypePB::LZ4, 0);
+    EXPECT_EQ(CompressionTypePB::LZ4, selector.next_type());
+    EXPECT_EQ(CompressionTypePB::LZ4, selector.next_type());
+    EXPECT_EQ(2, selector.num_blocks(1));
+}
+
+TEST(ExchangeCompressionSelectorTest, FastNetworkIsNotCompressed) {
+    ExchangeCompressionSelector selector(CompressionTypePB::LZ4, 0);
+    // 0.1ns per byte, 10GB/s
+    selector.update_network(1000000, 100000);
+    feed(&selector, 100, 0.5, 0.3);
+    EXPECT_EQ(CompressionTypePB::NO_COMPRESSION, selector.next_type());
+}
+
+TEST(ExchangeCompressionSelectorTest, SlowNetworkIsCompressed) {
+    ExchangeCompressionSelector selector(CompressionTypePB::NO_COMPRESSION, 0);
+    // 100ns per byte, 10MB/s, zstd saves more than it costs
+    selector.update_network(1000000, 100000000);
+    feed(&selector, 100, 0.5, 0.3);
+    EXPECT_EQ(CompressionTypePB::ZSTD, selector.next_type());
+
+    // 8ns per byte, lz4 costs 1 + 4 and zstd costs 5 + 2.4
+    for (int i = 0; i < 100; ++i) {
+        selector.update_network(1000000, 8000000);
+    }
+    EXPECT_EQ(CompressionTypePB::LZ4, selector.next_type());
+}
+
+TEST(ExchangeCompressionSelectorTest, Probe) {
+    ExchangeCompressionSelector selector(CompressionTypePB::LZ4, 4);
+    selector.update_network(1000000, 100000);
+    feed(&selector, 400, 0.5, 0.3);
+    // every codec is still tried sometimes
+    EXPECT_GT(selector.num_blocks(1), 0);
+    EXPECT_GT(selector.num_blocks(2), 0);
+    EXPECT_GT(selector.num_blocks(0), 300);
+}
+
+} // namespace doris::vectorized
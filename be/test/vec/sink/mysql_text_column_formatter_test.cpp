@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/mysql_text_column_formatter.h"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include <limits>
+#include <string>
+
+#include "gtest/gtest_pred_impl.h"
+#include "util/mysql_row_buffer.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_time_v2.h"
+
+namespace doris::vectorized {
+
+// the cells must be the bytes the serde pushes into the row buffer
+static void check_cells(const IColumn& column, const DataTypePtr& type, bool is_const,
+                        size_t rows) {
+    ASSERT_TRUE(MysqlTextColumnFormatter::is_supported(type));
+    MysqlTextColumnFormatter formatter;
+    const IColumn& values =
+            is_const ? assert_cast<const ColumnConst&>(column).get_data_column() : column;
+    formatter.format(values, type, is_const, rows);
+    auto serde = type->get_serde();
+    for (size_t i = 0; i < rows; ++i) {
+        MysqlRowBuffer<false> buffer;
+        ASSERT_TRUE(serde->write_column_to_mysql(values, buffer, i, is_const).ok());
+        auto cell = formatter.cell(i);
+        EXPECT_EQ(std::string(buffer.buf(), buffer.length()), cell.to_string()) << "row " << i;
+    }
+}
+
+TEST(MysqlTextColumnFormatterTest, Integers) {
+    auto column = ColumnNullable::create(ColumnInt64::create(), ColumnUInt8::create());
+    column->insert(Field(std::numeric_limits<Int64>::min()));
+    column->insert(Field(std::numeric_limits<Int64>::max()));
+    column->insert_default();
+    column->insert(Field(Int64(0)));
+    column->insert(Field(Int64(-42)));
+    check_cells(*column, make_nullable(std::make_shared<DataTypeInt64>()), false,
+                column->size());
+
+    auto tiny = ColumnInt8::create();
+    tiny->insert_value(-128);
+    tiny->insert_value(127);
+    tiny->insert_value(7);
+    check_cells(*tiny, std::make_shared<DataTypeInt8>(), false, tiny->size());
+
+    auto const_column = ColumnConst::create(ColumnInt32::create(1, 123456), 10);
+    check_cells(*const_column, std::make_shared<DataTypeInt32>(), true, 10);
+}
+
+TEST(MysqlTextColumnFormatterTest, Dates) {
+    auto dates = ColumnDateV2::create();
+    auto datetimes = ColumnDateTimeV2::create();
+    DateV2Value<DateV2ValueType> date;
+    date.from_date_str("2024-02-29", 10);
+    dates->insert_value(date.to_date_int_val());
+    date.from_date_str("0001-01-01", 10);
+    dates->insert_value(date.to_date_int_val());
+    DateV2Value<DateTimeV2ValueType> datetime;
+    datetime.from_date_str("2024-02-29 23:59:58.123456", 26, 6);
+    datetimes->insert_value(datetime.to_date_int_val());
+    datetime.from_date_str("1999-01-01 00:00:00", 19, 6);
+    datetimes->insert_value(datetime.to_date_int_val());
+    check_cells(*dates, std::make_shared<DataTypeDateV2>(), false, dates->size());
+    for (int scale : {0, 3, 6}) {
+        check_cells(*datetimes, std::make_shared<DataTypeDateTimeV2>(scale), false,
+                    datetimes->size());
+    }
+}
+
+} // namespace doris::vectorized
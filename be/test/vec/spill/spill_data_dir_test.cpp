@@ -0,0 +1,56 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "common/config.h"
+#include "gtest/gtest_pred_impl.h"
+#include "vec/spill/spill_stream_manager.h"
+
+namespace doris::vectorized {
+
+TEST(SpillDataDirTest, compression_type_by_medium) {
+    SpillDataDir hdd("/tmp/spill_hdd", 0, TStorageMedium::HDD);
+    SpillDataDir ssd("/tmp/spill_ssd", 0, TStorageMedium::SSD);
+    EXPECT_EQ(hdd.spill_compression_type(), segment_v2::CompressionTypePB::ZSTD);
+    EXPECT_EQ(ssd.spill_compression_type(), segment_v2::CompressionTypePB::LZ4);
+}
+
+TEST(SpillDataDirTest, compression_type_by_bandwidth) {
+    SpillDataDir dir("/tmp/spill", 0, TStorageMedium::HDD);
+    int64_t threshold = config::spill_zstd_max_disk_bandwidth_mb << 20;
+
+    // too small to be measured
+    dir.update_write_bandwidth(1024, 1);
+    EXPECT_EQ(dir.spill_compression_type(), segment_v2::CompressionTypePB::ZSTD);
+
+    // 4x the threshold
+    size_t bytes = 4 * 1024 * 1024;
+    int64_t fast_ns = bytes * 1000000000L / (threshold * 4);
+    dir.update_write_bandwidth(bytes, fast_ns);
+    EXPECT_EQ(dir.spill_compression_type(), segment_v2::CompressionTypePB::LZ4);
+
+    // the moving average falls below the threshold after some slow writes
+    int64_t slow_ns = bytes * 1000000000L / (threshold / 4);
+    for (int i = 0; i < 20; ++i) {
+        dir.update_write_bandwidth(bytes, slow_ns);
+    }
+    EXPECT_EQ(dir.spill_compression_type(), segment_v2::CompressionTypePB::ZSTD);
+}
+
+} // namespace doris::vectorized
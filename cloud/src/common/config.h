@@ -35,6 +35,10 @@ CONF_Int32(meta_server_register_interval_ms, "20000");
 CONF_Int32(meta_server_lease_ms, "60000");
 
 CONF_Int64(fdb_txn_timeout_ms, "10000");
+// The read-only txns created by `TxnKv::create_read_only_txn` reuse a read version which is at
+// most this old instead of getting a new one from fdb, 0 to always get a new one. It must be far
+// less than 5000, the max age of a fdb read version.
+CONF_mInt64(fdb_read_only_txn_read_version_cache_ms, "0");
 CONF_Int64(brpc_max_body_size, "3147483648");
 CONF_Int64(brpc_socket_max_unwritten_bytes, "1073741824");
 
@@ -159,7 +163,13 @@ CONF_Int32(txn_store_retry_times, "4");
 CONF_Int32(txn_store_retry_base_intervals_ms, "500");
 // Whether to retry the txn conflict errors that returns by the underlying txn store.
 CONF_Bool(enable_retry_txn_conflict, "true");
+// The identical `get_version` and `get_rowset` requests of an instance which arrive within this
+// window share one read of the txn store. A request waits at most this long for the others to
+// join, 0 to disable it.
+CONF_mInt64(rpc_coalesce_window_us, "0");
 
+// Whether the `DeleteObjects` requests of the batches of a large deletion are sent in parallel.
+CONF_mBool(enable_parallel_s3_delete_objects, "true");
 CONF_mBool(enable_s3_rate_limiter, "false");
 CONF_mInt64(s3_get_bucket_tokens, "1000000000000000000");
 CONF_mInt64(s3_get_token_per_second, "1000000000000000000");
@@ -1512,16 +1512,24 @@ void MetaServiceImpl::get_tablet_stats(::google::protobuf::RpcController* contro
     }
     RPC_RATE_LIMIT(get_tablet_stats)
 
+    // A txn reads the stats of a bounded number of tablets, so that it never lives long enough
+    // to get `transaction_too_old`, while most tablets do not pay for a txn and a read version.
+    constexpr int max_tablets_per_txn = 100;
     std::unique_ptr<Transaction> txn;
+    int num_tablets_of_txn = 0;
     for (auto& i : request->tablet_idx()) {
         TabletIndexPB idx(i);
-        // FIXME(plat1ko): Get all tablet stats in one txn
-        TxnErrorCode err = txn_kv_->create_txn(&txn);
-        if (err != TxnErrorCode::TXN_OK) {
-            code = cast_as<ErrCategory::CREATE>(err);
-            msg = fmt::format("failed to create txn, tablet_id={}", idx.tablet_id());
-            return;
+        if (txn == nullptr || num_tablets_of_txn >= max_tablets_per_txn) {
+            // the stats are only reported, a slightly stale snapshot is fine
+            TxnErrorCode err = txn_kv_->create_read_only_txn(&txn);
+            if (err != TxnErrorCode::TXN_OK) {
+                code = cast_as<ErrCategory::CREATE>(err);
+                msg = fmt::format("failed to create txn, tablet_id={}", idx.tablet_id());
+                return;
+            }
+            num_tablets_of_txn = 0;
         }
+        ++num_tablets_of_txn;
         if (!(/* idx.has_db_id() && */ idx.has_table_id() && idx.has_index_id() &&
               idx.has_partition_id() && i.has_tablet_id())) {
             get_tablet_idx(code, msg, txn.get(), instance_id, idx.tablet_id(), idx);
@@ -25,10 +25,13 @@
 
 #include <chrono>
 #include <random>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "common/config.h"
 #include "common/sync_point.h"
+#include "meta-service/rpc_single_flight.h"
 #include "meta-service/txn_kv.h"
 #include "rate-limiter/rate_limiter.h"
 #include "resource-manager/resource_manager.h"
@@ -37,6 +40,9 @@ namespace doris::cloud {
 
 class Transaction;
 
+std::string get_instance_id(const std::shared_ptr<ResourceManager>& rc_mgr,
+                            const std::string& cloud_unique_id);
+
 constexpr std::string_view BUILT_IN_STORAGE_VAULT_NAME = "built_in_storage_vault";
 
 class MetaServiceImpl : public cloud::MetaService {
@@ -337,7 +343,8 @@ public:
     void get_version(::google::protobuf::RpcController* controller,
                      const GetVersionRequest* request, GetVersionResponse* response,
                      ::google::protobuf::Closure* done) override {
-        call_impl(&cloud::MetaService::get_version, controller, request, response, done);
+        call_impl_coalesced("get_version", &cloud::MetaService::get_version, controller, request,
+                            response, done);
     }
 
     void create_tablets(::google::protobuf::RpcController* controller,
@@ -384,7 +391,8 @@ public:
 
     void get_rowset(::google::protobuf::RpcController* controller, const GetRowsetRequest* request,
                     GetRowsetResponse* response, ::google::protobuf::Closure* done) override {
-        call_impl(&cloud::MetaService::get_rowset, controller, request, response, done);
+        call_impl_coalesced("get_rowset", &cloud::MetaService::get_rowset, controller, request,
+                            response, done);
     }
 
     void prepare_index(::google::protobuf::RpcController* controller, const IndexRequest* request,
@@ -677,7 +685,36 @@ private:
         }
     }
 
+    // Like `call_impl`, but the identical requests of an instance which arrive together share
+    // one call, see `RpcSingleFlight`. Only for the rpcs which do not write.
+    template <typename Request, typename Response>
+    void call_impl_coalesced(std::string_view name, MetaServiceMethod<Request, Response> method,
+                             ::google::protobuf::RpcController* ctrl, const Request* req,
+                             Response* resp, ::google::protobuf::Closure* done) {
+        int64_t window_us = config::rpc_coalesce_window_us;
+        std::string instance_id;
+        if (window_us > 0) {
+            instance_id = get_instance_id(impl_->resource_mgr(), req->cloud_unique_id());
+        }
+        if (instance_id.empty()) {
+            call_impl(method, ctrl, req, resp, done);
+            return;
+        }
+
+        brpc::ClosureGuard done_guard(done);
+        // the BEs of an instance have different cloud unique ids
+        Request key_req(*req);
+        key_req.clear_cloud_unique_id();
+        std::string key;
+        key.append(name).append(1, '\0').append(instance_id).append(1, '\0');
+        key.append(key_req.SerializeAsString());
+        single_flight_.run(key, window_us, resp, [&] {
+            call_impl(method, ctrl, req, resp, brpc::DoNothing());
+        });
+    }
+
     std::unique_ptr<MetaServiceImpl> impl_;
+    RpcSingleFlight single_flight_;
 };
 
 } // namespace doris::cloud
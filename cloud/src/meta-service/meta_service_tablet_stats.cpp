@@ -21,6 +21,7 @@
 
 #include "common/logging.h"
 #include "common/util.h"
+#include "meta-service/codec.h"
 #include "meta-service/keys.h"
 #include "meta-service/meta_service_helper.h"
 #include "meta-service/txn_kv.h"
@@ -32,6 +33,8 @@ void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transact
                                TabletStatsPB& stats, TabletStats& detached_stats, bool snapshot) {
     auto begin_key = stats_tablet_key(
             {instance_id, idx.table_id(), idx.index_id(), idx.partition_id(), idx.tablet_id()});
+    // the detached stats keys are the tablet stats key followed by their suffixes
+    const std::string tablet_stats_key = begin_key;
     auto end_key = stats_tablet_key(
             {instance_id, idx.table_id(), idx.index_id(), idx.partition_id(), idx.tablet_id() + 1});
     std::unique_ptr<RangeGetIterator> it;
@@ -65,36 +68,31 @@ void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transact
                 begin_key = k;
             }
             // 0x01 "stats" ${instance_id} "tablet" ${table_id} ${index_id} ${partition_id} ${tablet_id} "data_size"
-            auto k1 = k;
-            k1.remove_prefix(1);
-            std::vector<std::tuple<std::variant<int64_t, std::string>, int, int>> out;
-            if (decode_key(&k1, &out) != 0) [[unlikely]] {
-                code = MetaServiceCode::UNDEFINED_ERR;
-                msg = fmt::format("failed to decode tablet stats key, key={}", hex(k));
-                return;
-            }
-            if (out.size() != 8) [[unlikely]] {
+            // only the suffix is decoded, the prefix is the tablet stats key
+            if (!k.starts_with(tablet_stats_key)) [[unlikely]] {
                 code = MetaServiceCode::UNDEFINED_ERR;
                 msg = fmt::format("failed to decode tablet stats key, key={}", hex(k));
                 return;
             }
-            auto suffix = std::get_if<std::string>(&std::get<0>(out.back()));
-            if (!suffix) [[unlikely]] {
+            auto k1 = k;
+            k1.remove_prefix(tablet_stats_key.size());
+            std::string suffix;
+            if (decode_bytes(&k1, &suffix) != 0 || !k1.empty()) [[unlikely]] {
                 code = MetaServiceCode::UNDEFINED_ERR;
                 msg = fmt::format("failed to decode tablet stats key, key={}", hex(k));
                 return;
             }
             int64_t val = *reinterpret_cast<const int64_t*>(v.data());
-            if (*suffix == STATS_KEY_SUFFIX_DATA_SIZE) {
+            if (suffix == STATS_KEY_SUFFIX_DATA_SIZE) {
                 detached_stats.data_size = val;
-            } else if (*suffix == STATS_KEY_SUFFIX_NUM_ROWS) {
+            } else if (suffix == STATS_KEY_SUFFIX_NUM_ROWS) {
                 detached_stats.num_rows = val;
-            } else if (*suffix == STATS_KEY_SUFFIX_NUM_ROWSETS) {
+            } else if (suffix == STATS_KEY_SUFFIX_NUM_ROWSETS) {
                 detached_stats.num_rowsets = val;
-            } else if (*suffix == STATS_KEY_SUFFIX_NUM_SEGS) {
+            } else if (suffix == STATS_KEY_SUFFIX_NUM_SEGS) {
                 detached_stats.num_segs = val;
             } else {
-                VLOG_DEBUG << "unknown suffix=" << *suffix;
+                VLOG_DEBUG << "unknown suffix=" << suffix;
             }
         }
         if (it->more()) {
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "meta-service/rpc_single_flight.h"
+
+#include <bthread/bthread.h>
+#include <bvar/bvar.h>
+
+#include <mutex>
+
+namespace doris::cloud {
+
+static bvar::Adder<int64_t> g_bvar_rpc_coalesced("ms_rpc_coalesced");
+
+void RpcSingleFlight::run(const std::string& key, int64_t window_us,
+                          google::protobuf::Message* response, const std::function<void()>& rpc) {
+    std::shared_ptr<Flight> flight;
+    bool leader = false;
+    {
+        std::lock_guard lock(mtx_);
+        auto& slot = flights_[key];
+        if (slot == nullptr) {
+            slot = std::make_shared<Flight>();
+            leader = true;
+        }
+        flight = slot;
+    }
+
+    if (!leader) {
+        g_bvar_rpc_coalesced << 1;
+        std::unique_lock lock(flight->mtx);
+        while (!flight->done) {
+            flight->cv.wait(lock);
+        }
+        response->CopyFrom(*flight->response);
+        return;
+    }
+
+    bthread_usleep(window_us);
+    {
+        // the later requests lead a new flight, since this one may miss their preceding commits
+        std::lock_guard lock(mtx_);
+        flights_.erase(key);
+    }
+    rpc();
+    std::unique_ptr<google::protobuf::Message> shared(response->New());
+    shared->CopyFrom(*response);
+    std::lock_guard lock(flight->mtx);
+    flight->response = std::move(shared);
+    flight->done = true;
+    flight->cv.notify_all();
+}
+
+} // namespace doris::cloud
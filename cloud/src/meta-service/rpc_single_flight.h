@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bthread/condition_variable.h>
+#include <bthread/mutex.h>
+#include <google/protobuf/message.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace doris::cloud {
+
+// Coalesces the concurrent identical read requests, e.g. the `get_version` of the same
+// partitions from many BEs. The first request of a key leads a flight, it waits `window_us` for
+// the others to join, then runs the rpc once and the joined requests copy its response.
+//
+// A request only joins a flight which has not run the rpc yet, so the read of the rpc starts
+// after every joined request arrived, and each of them sees all the commits finished before it
+// arrived, just like it ran the rpc by itself.
+class RpcSingleFlight {
+public:
+    // Run `rpc`, which fills `response`, or copy the response of the flight of `key`.
+    void run(const std::string& key, int64_t window_us, google::protobuf::Message* response,
+             const std::function<void()>& rpc);
+
+private:
+    struct Flight {
+        bthread::Mutex mtx;
+        bthread::ConditionVariable cv;
+        bool done = false;
+        // a copy of the response of the leader, valid once `done`
+        std::unique_ptr<google::protobuf::Message> response;
+    };
+
+    bthread::Mutex mtx_;
+    // the flights which have not run the rpc yet
+    std::unordered_map<std::string, std::shared_ptr<Flight>> flights_;
+};
+
+} // namespace doris::cloud
@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <optional>
@@ -78,6 +79,43 @@ TxnErrorCode FdbTxnKv::create_txn(std::unique_ptr<Transaction>* txn) {
     return ret;
 }
 
+TxnErrorCode FdbTxnKv::create_read_only_txn(std::unique_ptr<Transaction>* txn) {
+    int64_t cache_ms = config::fdb_read_only_txn_read_version_cache_ms;
+    if (cache_ms <= 0) {
+        return create_txn(txn);
+    }
+    auto* t = new fdb::Transaction(database_);
+    txn->reset(t);
+    auto ret = t->init();
+    if (ret != TxnErrorCode::TXN_OK) {
+        LOG(WARNING) << "failed to init txn, ret=" << ret;
+        return ret;
+    }
+
+    using namespace std::chrono;
+    int64_t now_ms = duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    {
+        std::lock_guard lock(read_version_mtx_);
+        if (cached_read_version_ >= 0 && now_ms - cached_read_version_time_ms_ <= cache_ms) {
+            t->set_read_version(cached_read_version_);
+            return TxnErrorCode::TXN_OK;
+        }
+    }
+    // The read version is got by the txn itself, so it is consistent with the reads of the txn
+    int64_t version = 0;
+    ret = t->get_read_version(&version);
+    if (ret != TxnErrorCode::TXN_OK) {
+        LOG(WARNING) << "failed to get read version, ret=" << ret;
+        return ret;
+    }
+    std::lock_guard lock(read_version_mtx_);
+    if (version > cached_read_version_) {
+        cached_read_version_ = version;
+        cached_read_version_time_ms_ = now_ms;
+    }
+    return TxnErrorCode::TXN_OK;
+}
+
 } // namespace doris::cloud
 
 namespace doris::cloud::fdb {
@@ -492,6 +530,10 @@ TxnErrorCode Transaction::get_read_version(int64_t* version) {
     return TxnErrorCode::TXN_OK;
 }
 
+void Transaction::set_read_version(int64_t version) {
+    fdb_transaction_set_read_version(txn_, version);
+}
+
 TxnErrorCode Transaction::get_committed_version(int64_t* version) {
     StopWatch sw;
     auto err = fdb_transaction_get_committed_version(txn_, version);
@@ -21,6 +21,7 @@
 #include <foundationdb/fdb_c_options.g.h>
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -53,6 +54,18 @@ public:
      */
     virtual TxnErrorCode create_txn(std::unique_ptr<Transaction>* txn) = 0;
 
+    /**
+     * Creates a transaction which only reads, it may read a snapshot which is up to
+     * `config::fdb_read_only_txn_read_version_cache_ms` old, so it must not be used to write
+     * or to read the data which must be the latest.
+     *
+     * @param txn output param
+     * @return TXN_OK for success
+     */
+    virtual TxnErrorCode create_read_only_txn(std::unique_ptr<Transaction>* txn) {
+        return create_txn(txn);
+    }
+
     virtual int init() = 0;
 };
 
@@ -278,11 +291,18 @@ public:
 
     TxnErrorCode create_txn(std::unique_ptr<Transaction>* txn) override;
 
+    TxnErrorCode create_read_only_txn(std::unique_ptr<Transaction>* txn) override;
+
     int init() override;
 
 private:
     std::shared_ptr<fdb::Network> network_;
     std::shared_ptr<fdb::Database> database_;
+
+    // The read version shared by the read-only txns and the time it was got at
+    std::mutex read_version_mtx_;
+    int64_t cached_read_version_ = -1;
+    int64_t cached_read_version_time_ms_ = 0;
 };
 
 namespace fdb {
@@ -491,6 +511,10 @@ public:
     TxnErrorCode get_read_version(int64_t* version) override;
     TxnErrorCode get_committed_version(int64_t* version) override;
 
+    // Read at `version` instead of a new read version got from fdb, it must be called before
+    // any read.
+    void set_read_version(int64_t version);
+
     TxnErrorCode abort() override;
 
     TxnErrorCode batch_get(std::vector<std::optional<std::string>>* res,
@@ -242,55 +242,76 @@ int S3Accessor::delete_objects(const std::vector<std::string>& relative_paths) {
     }
     // `DeleteObjectsRequest` can only contain 1000 keys at most.
     constexpr size_t max_delete_batch = 1000;
-    auto path_iter = relative_paths.begin();
-
-    Aws::S3::Model::DeleteObjectsRequest delete_request;
-    delete_request.SetBucket(conf_.bucket);
-    do {
-        Aws::S3::Model::Delete del;
-        Aws::Vector<Aws::S3::Model::ObjectIdentifier> objects;
-        auto path_begin = path_iter;
-        for (; path_iter != relative_paths.end() && (path_iter - path_begin < max_delete_batch);
-             ++path_iter) {
-            auto key = get_key(*path_iter);
-            LOG_INFO("delete object")
-                    .tag("endpoint", conf_.endpoint)
-                    .tag("bucket", conf_.bucket)
-                    .tag("key", key)
-                    .tag("size", objects.size());
-            objects.emplace_back().SetKey(std::move(key));
-        }
-        if (objects.empty()) {
-            return 0;
-        }
-        del.WithObjects(std::move(objects)).SetQuiet(true);
-        delete_request.SetDelete(std::move(del));
-        auto delete_outcome = SYNC_POINT_HOOK_RETURN_VALUE(
-                s3_client_->DeleteObjects(delete_request), std::ref(delete_request).get(),
-                "s3_client::delete_objects", S3RateLimitType::PUT);
-        if (!delete_outcome.IsSuccess()) {
-            LOG_WARNING("failed to delete objects")
-                    .tag("endpoint", conf_.endpoint)
-                    .tag("bucket", conf_.bucket)
-                    .tag("key[0]", delete_request.GetDelete().GetObjects().front().GetKey())
-                    .tag("responseCode",
-                         static_cast<int>(delete_outcome.GetError().GetResponseCode()))
-                    .tag("error", delete_outcome.GetError().GetMessage());
-            return -1;
+    std::vector<std::pair<size_t, size_t>> batches;
+    for (size_t begin = 0; begin < relative_paths.size(); begin += max_delete_batch) {
+        batches.emplace_back(begin, std::min(begin + max_delete_batch, relative_paths.size()));
+    }
+    if (batches.size() == 1 || !config::enable_parallel_s3_delete_objects) {
+        for (auto [begin, end] : batches) {
+            int ret = delete_objects(relative_paths, begin, end);
+            if (ret != 0) {
+                return ret;
+            }
         }
-        if (!delete_outcome.GetResult().GetErrors().empty()) {
-            const auto& e = delete_outcome.GetResult().GetErrors().front();
-            LOG_WARNING("failed to delete object")
-                    .tag("endpoint", conf_.endpoint)
-                    .tag("bucket", conf_.bucket)
-                    .tag("key", e.GetKey())
-                    .tag("responseCode",
-                         static_cast<int>(delete_outcome.GetError().GetResponseCode()))
-                    .tag("error", e.GetMessage());
-            return -2;
+        return 0;
+    }
+    // The requests are still limited by the s3 rate limiter if it is enabled.
+    std::vector<int> delete_rets(batches.size());
+    std::transform(std::execution::par, batches.begin(), batches.end(), delete_rets.begin(),
+                   [&](const std::pair<size_t, size_t>& batch) {
+                       return delete_objects(relative_paths, batch.first, batch.second);
+                   });
+    for (int delete_ret : delete_rets) {
+        if (delete_ret != 0) {
+            return delete_ret;
         }
-    } while (path_iter != relative_paths.end());
+    }
+    return 0;
+}
 
+int S3Accessor::delete_objects(const std::vector<std::string>& relative_paths, size_t begin,
+                               size_t end) {
+    Aws::S3::Model::DeleteObjectsRequest delete_request;
+    delete_request.SetBucket(conf_.bucket);
+    Aws::S3::Model::Delete del;
+    Aws::Vector<Aws::S3::Model::ObjectIdentifier> objects;
+    objects.reserve(end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        auto key = get_key(relative_paths[i]);
+        LOG_INFO("delete object")
+                .tag("endpoint", conf_.endpoint)
+                .tag("bucket", conf_.bucket)
+                .tag("key", key)
+                .tag("size", objects.size());
+        objects.emplace_back().SetKey(std::move(key));
+    }
+    if (objects.empty()) {
+        return 0;
+    }
+    del.WithObjects(std::move(objects)).SetQuiet(true);
+    delete_request.SetDelete(std::move(del));
+    auto delete_outcome = SYNC_POINT_HOOK_RETURN_VALUE(
+            s3_client_->DeleteObjects(delete_request), std::ref(delete_request).get(),
+            "s3_client::delete_objects", S3RateLimitType::PUT);
+    if (!delete_outcome.IsSuccess()) {
+        LOG_WARNING("failed to delete objects")
+                .tag("endpoint", conf_.endpoint)
+                .tag("bucket", conf_.bucket)
+                .tag("key[0]", delete_request.GetDelete().GetObjects().front().GetKey())
+                .tag("responseCode", static_cast<int>(delete_outcome.GetError().GetResponseCode()))
+                .tag("error", delete_outcome.GetError().GetMessage());
+        return -1;
+    }
+    if (!delete_outcome.GetResult().GetErrors().empty()) {
+        const auto& e = delete_outcome.GetResult().GetErrors().front();
+        LOG_WARNING("failed to delete object")
+                .tag("endpoint", conf_.endpoint)
+                .tag("bucket", conf_.bucket)
+                .tag("key", e.GetKey())
+                .tag("responseCode", static_cast<int>(delete_outcome.GetError().GetResponseCode()))
+                .tag("error", e.GetMessage());
+        return -2;
+    }
     return 0;
 }
 
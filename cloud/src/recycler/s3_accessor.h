@@ -84,6 +84,9 @@ public:
     virtual int check_bucket_versioning();
 
 private:
+    // Delete the objects of relative_paths[begin, end) by one `DeleteObjectsRequest`
+    int delete_objects(const std::vector<std::string>& relative_paths, size_t begin, size_t end);
+
     std::string get_key(const std::string& relative_path) const;
     // return empty string if the input key does not start with the prefix of S3 conf
     std::string get_relative_path(const std::string& key) const;